@@ -110,8 +110,11 @@ static int yyParenLineNo;
 static QTextCodec *yyCodecForTr = 0;
 static QTextCodec *yyCodecForSource = 0;
 
-// the file to read from (if reading from a file)
+// the file to read from (if reading from a file) and its contents, which are
+// read in one go rather than a character at a time
 static FILE *yyInFile;
+static QByteArray yyInData;
+static int yyInDataPos;
 
 // the string to read from and current position in the string (otherwise)
 static QString yyInStr;
@@ -127,12 +130,20 @@ static int (*peekChar)();
 
 static bool yyParsingUtf8;
 
+static inline int getRawCharFromFile()
+{
+    if ( yyInDataPos >= yyInData.size() )
+        return EOF;
+
+    return (uchar)yyInData.at( yyInDataPos++ );
+}
+
 static int getTranslatedCharFromFile()
 {
     int c;
 
     if ( rawbuf < 0 )           // Empty raw buffer?
-        c = getc( yyInFile );
+        c = getRawCharFromFile();
     else {
         c = rawbuf;
         rawbuf = -1;            // Declare the raw buffer empty.
@@ -140,7 +151,7 @@ static int getTranslatedCharFromFile()
 
     // Universal newline translation, similar to what Python does
     if ( c == '\r' ) {
-        c = getc( yyInFile ); // Last byte of a \r\n sequence?
+        c = getRawCharFromFile(); // Last byte of a \r\n sequence?
         if ( c != '\n')
             {
                 rawbuf = c; // No, put it in 'rawbuf' for later processing.
@@ -816,9 +827,17 @@ void fetchtr_py(const char *fileName, MetaTranslator *tor,
         return;
     }
 
+    {
+        QFile f;
+        if ( f.open(yyInFile, QIODevice::ReadOnly) )
+            yyInData = f.readAll();
+    }
+    fclose( yyInFile );
+    yyInDataPos = 0;
+
     startTokenizer( fileName, getCharFromFile, peekCharFromFile, tor->codecForTr(), QTextCodec::codecForName(codecForSource) );
     parse( tor, 0, defaultContext );
-    fclose( yyInFile );
+    yyInData = QByteArray();
 }
 
 class UiHandler : public QXmlDefaultHandler
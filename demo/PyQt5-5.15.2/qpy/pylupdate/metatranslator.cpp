@@ -379,7 +379,8 @@ MetaTranslator::MetaTranslator()
 }
 
 MetaTranslator::MetaTranslator( const MetaTranslator& tor )
-    : mm( tor.mm ), codecName( tor.codecName ), codec( tor.codec )
+    : mm( tor.mm ), codecName( tor.codecName ), codec( tor.codec ),
+      locationIndexValid( false )
 {
 }
 
@@ -388,6 +389,7 @@ MetaTranslator& MetaTranslator::operator=( const MetaTranslator& tor )
     mm = tor.mm;
     codecName = tor.codecName;
     codec = tor.codec;
+    invalidateLocationIndex();
     return *this;
 }
 
@@ -396,6 +398,7 @@ void MetaTranslator::clear()
     mm.clear();
     codecName = "ISO-8859-1";
     codec = 0;
+    invalidateLocationIndex();
 }
 
 bool MetaTranslator::load( const QString& filename )
@@ -638,34 +641,59 @@ MetaTranslatorMessage MetaTranslator::find(const char *context, const char *comm
                                 const QString &fileName, int lineNumber) const
 {
     if (lineNumber >= 0 && !fileName.isEmpty()) {
-        MetaTranslatorMessage m;
-
-        for (QMap<MetaTranslatorMessage, int>::const_iterator it = mm.constBegin();
-            it != mm.constEnd(); ++it) {
-            m = it.key();
-            int delta = qstrcmp(m.context(), context);
-            if (delta == 0) {
-                delta = qstrcmp(m.comment(), comment);
-                if (delta == 0) {
-                    delta = QString::compare(m.fileName(), fileName);
-                    if (delta == 0) {
-                        delta = m.lineNumber() - lineNumber;
-                        if (delta == 0)
-                            return m;
-                    }
-                }
+        // Merging looks up most messages by location so index them all once
+        // rather than searching every message each time.  The first message
+        // (in map order) at a location is the one that is found.
+        if (!locationIndexValid) {
+            for (TMM::ConstIterator it = mm.constBegin(); it != mm.constEnd(); ++it) {
+                const MetaTranslatorMessage &m = it.key();
+                const QByteArray key = locationKey(m.context(), m.comment(),
+                                                   m.fileName(), m.lineNumber());
+                if (!locationIndex.contains(key))
+                    locationIndex.insert(key, m);
             }
+            locationIndexValid = true;
         }
+
+        QHash<QByteArray, MetaTranslatorMessage>::ConstIterator it =
+            locationIndex.constFind(locationKey(context, comment, fileName, lineNumber));
+        if (it != locationIndex.constEnd())
+            return *it;
     }
     return MetaTranslatorMessage();
 }
 
+QByteArray MetaTranslator::locationKey(const char *context, const char *comment,
+                                       const QString &fileName, int lineNumber)
+{
+    // None of the parts can contain a '\0' so use it as a separator.  A null
+    // context or comment is distinct from an empty one, as with qstrcmp().
+    QByteArray key(context ? "=" : "!");
+    key += context;
+    key += '\0';
+    key += comment ? '=' : '!';
+    key += comment;
+    key += '\0';
+    key += fileName.toUtf8();
+    key += '\0';
+    key += QByteArray::number(lineNumber);
+    return key;
+}
+
+void MetaTranslator::invalidateLocationIndex()
+{
+    locationIndex.clear();
+    locationIndexValid = false;
+}
+
 void MetaTranslator::insert( const MetaTranslatorMessage& m )
 {
+    invalidateLocationIndex();
     int pos = mm.count();
-    if (mm.contains(m)) {
-        pos = mm.value(m);
-        mm.remove(m);
+    TMM::Iterator it = mm.find(m);
+    if (it != mm.end()) {
+        pos = *it;
+        mm.erase(it);
     }
     mm.insert(m, pos);
 }
@@ -680,6 +708,7 @@ void MetaTranslator::stripObsoleteMessages()
         ++m;
     }
     mm = newmm;
+    invalidateLocationIndex();
 }
 
 void MetaTranslator::stripEmptyContexts()
@@ -701,6 +730,7 @@ void MetaTranslator::stripEmptyContexts()
         ++m;
     }
     mm = newmm;
+    invalidateLocationIndex();
 }
 
 void MetaTranslator::makeFileNamesAbsolute(const QDir &oldPath)
@@ -718,6 +748,7 @@ void MetaTranslator::makeFileNamesAbsolute(const QDir &oldPath)
         newmm.insert(msg, m.value());
     }
     mm = newmm;
+    invalidateLocationIndex();
 }
 
 void MetaTranslator::setCodec( const char *name )
@@ -55,6 +55,7 @@
 #ifndef METATRANSLATOR_H
 #define METATRANSLATOR_H
 
+#include <qhash.h>
 #include <qmap.h>
 #include <qstring.h>
 #include <qlist.h>
@@ -157,6 +158,9 @@ public:
 
 private:
     void makeFileNamesAbsolute(const QDir &oldPath);
+    static QByteArray locationKey(const char *context, const char *comment,
+                                  const QString &fileName, int lineNumber);
+    void invalidateLocationIndex();
 
     typedef QMap<MetaTranslatorMessage, int> TMM;
     typedef QMap<int, MetaTranslatorMessage> TMMInv;
@@ -173,6 +177,10 @@ private:
                             // 'pt_BR'      Brazilian portuguese (ISO 639-1 language code)
                             // 'por_BR'     Brazilian portuguese (ISO 639-2 language code)
     QString m_sourceLanguage;
+
+    // The messages indexed by location, built when first needed by find().
+    mutable QHash<QByteArray, MetaTranslatorMessage> locationIndex;
+    mutable bool locationIndexValid;
 };
 
 /*
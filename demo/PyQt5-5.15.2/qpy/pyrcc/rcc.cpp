@@ -47,51 +47,183 @@
 #include <qstack.h>
 #include <qdom.h>
 #include <qdatetime.h>
+#include <qdatastream.h>
+#include <qatomic.h>
+#include <qrunnable.h>
+#include <qthreadpool.h>
 
 #include "rcc.h"
 
 
-static void qt_rcc_write_number(FILE *out, quint64 number, int width)
+static void qt_rcc_write_number(FILE *out, quint64 number, int width,
+        bool binary)
 {
-    // Write <width> bytes
+    // Write <width> bytes, most significant first.
     while (width-- > 0)
     {
         const quint8 tmp = number >> (width * 8);
-        fprintf(out, "\\x%02x", tmp);
+
+        if (binary)
+            fputc(tmp, out);
+        else
+            fprintf(out, "\\x%02x", tmp);
+    }
+}
+
+// A thread pool task that prepares the data of a single file.
+class RCCPrepareTask : public QRunnable
+{
+public:
+    RCCPrepareTask(RCCFileInfo *file, QAtomicInt &failures)
+        : mFile(file), mFailures(failures) {}
+
+    void run()
+    {
+        if (!mFile->prepareData())
+            mFailures.ref();
     }
+
+private:
+    RCCFileInfo *mFile;
+    QAtomicInt &mFailures;
+};
+
+// The magic number and version of the payload cache file.
+#define RCC_CACHE_MAGIC 0x70726363
+#define RCC_CACHE_VERSION 1
+
+// An entry in the payload cache.  A payload is only reused if the file and
+// the compression settings are unchanged.
+struct RCCCacheEntry
+{
+    qint64 lastModified;
+    qint64 size;
+    int compressLevel;
+    int compressThreshold;
+    bool compressed;
+    QByteArray payload;
+};
+
+static QDataStream &operator<<(QDataStream &s, const RCCCacheEntry &entry)
+{
+    s << entry.lastModified << entry.size << entry.compressLevel
+      << entry.compressThreshold << entry.compressed << entry.payload;
+
+    return s;
+}
+
+static QDataStream &operator>>(QDataStream &s, RCCCacheEntry &entry)
+{
+    s >> entry.lastModified >> entry.size >> entry.compressLevel
+      >> entry.compressThreshold >> entry.compressed >> entry.payload;
+
+    return s;
+}
+
+// Return the cache entry describing the current state of a file.
+static RCCCacheEntry qt_rcc_cache_entry(const RCCFileInfo *file)
+{
+    RCCCacheEntry entry;
+
+    const QDateTime lastModified = file->fileInfo.lastModified();
+
+    entry.lastModified = lastModified.isValid() ? lastModified.toMSecsSinceEpoch() : 0;
+    entry.size = file->fileInfo.size();
+    entry.compressLevel = file->mCompressLevel;
+    entry.compressThreshold = file->mCompressThreshold;
+    entry.compressed = (file->flags & RCCFileInfo::Compressed);
+    entry.payload = file->payload;
+
+    return entry;
+}
+
+// Load the payload cache.  A missing or unreadable cache is treated as empty.
+static QHash<QString, RCCCacheEntry> qt_rcc_load_cache(const QString &cache_name)
+{
+    QHash<QString, RCCCacheEntry> cache;
+    QFile file(cache_name);
+
+    if (!file.open(QIODevice::ReadOnly))
+        return cache;
+
+    QDataStream s(&file);
+    s.setVersion(QDataStream::Qt_5_0);
+
+    quint32 magic, version;
+    s >> magic >> version;
+
+    if (magic != RCC_CACHE_MAGIC || version != RCC_CACHE_VERSION)
+        return cache;
+
+    s >> cache;
+
+    if (s.status() != QDataStream::Ok)
+        cache.clear();
+
+    return cache;
+}
+
+// Save the payloads of a set of files as the new cache.
+static bool qt_rcc_save_cache(const QString &cache_name,
+        const QList<RCCFileInfo *> &files)
+{
+    QHash<QString, RCCCacheEntry> cache;
+
+    for (int i = 0; i < files.size(); ++i)
+        cache.insert(files.at(i)->fileInfo.absoluteFilePath(),
+                qt_rcc_cache_entry(files.at(i)));
+
+    QFile file(cache_name);
+
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    QDataStream s(&file);
+    s.setVersion(QDataStream::Qt_5_0);
+
+    s << quint32(RCC_CACHE_MAGIC) << quint32(RCC_CACHE_VERSION) << cache;
+
+    return (s.status() == QDataStream::Ok);
+}
+
+static void qt_rcc_write_break(FILE *out, bool binary)
+{
+    // Continue the bytes literal on the next line.
+    if (!binary)
+        fprintf(out, "\\\n");
 }
 
-void RCCFileInfo::writeDataInfo(FILE *out, int version)
+void RCCFileInfo::writeDataInfo(FILE *out, int version, bool binary)
 {
     //pointer data
     if(flags & RCCFileInfo::Directory) {
         //name offset
-        qt_rcc_write_number(out, nameOffset, 4);
+        qt_rcc_write_number(out, nameOffset, 4, binary);
 
         //flags
-        qt_rcc_write_number(out, flags, 2);
+        qt_rcc_write_number(out, flags, 2, binary);
 
         //child count
-        qt_rcc_write_number(out, children.size(), 4);
+        qt_rcc_write_number(out, children.size(), 4, binary);
 
         //first child offset
-        qt_rcc_write_number(out, childOffset, 4);
+        qt_rcc_write_number(out, childOffset, 4, binary);
     } else {
         //name offset
-        qt_rcc_write_number(out, nameOffset, 4);
+        qt_rcc_write_number(out, nameOffset, 4, binary);
 
         //flags
-        qt_rcc_write_number(out, flags, 2);
+        qt_rcc_write_number(out, flags, 2, binary);
 
         //locale
-        qt_rcc_write_number(out, locale.country(), 2);
-        qt_rcc_write_number(out, locale.language(), 2);
+        qt_rcc_write_number(out, locale.country(), 2, binary);
+        qt_rcc_write_number(out, locale.language(), 2, binary);
 
         //data offset
-        qt_rcc_write_number(out, dataOffset, 4);
+        qt_rcc_write_number(out, dataOffset, 4, binary);
     }
 
-    fprintf(out, "\\\n");
+    qt_rcc_write_break(out, binary);
 
     if (version >= 2)
     {
@@ -99,17 +231,16 @@ void RCCFileInfo::writeDataInfo(FILE *out, int version)
 
         qt_rcc_write_number(out,
                 lastModified.isValid() ? lastModified.toMSecsSinceEpoch() : 0,
-                8);
+                8, binary);
 
-        fprintf(out, "\\\n");
+        qt_rcc_write_break(out, binary);
     }
 }
 
-qint64 RCCFileInfo::writeDataBlob(FILE *out, qint64 offset)
+// Read (and possibly compress) the data of a file.  This is called from the
+// threads of a thread pool so must only touch this file's state.
+bool RCCFileInfo::prepareData()
 {
-    //capture the offset
-    dataOffset = offset;
-
     //find the data to be written
     QFile file(fileInfo.absoluteFilePath());
     if (!file.open(QFile::ReadOnly)) {
@@ -130,51 +261,71 @@ qint64 RCCFileInfo::writeDataBlob(FILE *out, qint64 offset)
         }
     }
 #endif // QT_NO_COMPRESS
-    
+
+    payload = data;
+    return true;
+}
+
+qint64 RCCFileInfo::writeDataBlob(FILE *out, qint64 offset, bool binary)
+{
+    //capture the offset
+    dataOffset = offset;
+
+    const QByteArray &data = payload;
+
     //write the length
-    qt_rcc_write_number(out, data.size(), 4);
-    fprintf(out, "\\\n");
+    qt_rcc_write_number(out, data.size(), 4, binary);
+    qt_rcc_write_break(out, binary);
     offset += 4;
 
     //write the payload
-    for (int i=0; i<data.size(); i++) {
-        qt_rcc_write_number(out, data.at(i), 1);
-        if(!(i % 16))
-            fprintf(out, "\\\n");
+    if (binary) {
+        if (fwrite(data.constData(), 1, data.size(), out) != size_t(data.size()))
+            return false;
+    } else {
+        for (int i=0; i<data.size(); i++) {
+            qt_rcc_write_number(out, data.at(i), 1, binary);
+            if(!(i % 16))
+                qt_rcc_write_break(out, binary);
+        }
     }
     offset += data.size();
 
     //done
-    fprintf(out, "\\\n");
+    qt_rcc_write_break(out, binary);
+
+    // The payload is no longer needed.
+    payload = QByteArray();
+
     return offset;
 }
 
-qint64 RCCFileInfo::writeDataName(FILE *out, qint64 offset)
+qint64 RCCFileInfo::writeDataName(FILE *out, qint64 offset, bool binary)
 {
     //capture the offset
     nameOffset = offset;
 
     //write the length
-    qt_rcc_write_number(out, name.length(), 2);
-    fprintf(out, "\\\n");
+    qt_rcc_write_number(out, name.length(), 2, binary);
+    qt_rcc_write_break(out, binary);
     offset += 2;
 
     //write the hash
-    qt_rcc_write_number(out, qt_hash(name), 4);
-    fprintf(out, "\\\n");
+    qt_rcc_write_number(out, qt_hash(name), 4, binary);
+    qt_rcc_write_break(out, binary);
     offset += 4;
 
     //write the name
     const QChar *unicode = name.unicode();
     for (int i=0; i<name.length(); i++) {
-        qt_rcc_write_number(out, unicode[i].unicode(), 2);
+        qt_rcc_write_number(out, unicode[i].unicode(), 2, binary);
         if(!(i % 16))
-            fprintf(out, "\\\n");
+            qt_rcc_write_break(out, binary);
     }
     offset += name.length()*2;
 
     //done
-    fprintf(out, "\\\n");
+    qt_rcc_write_break(out, binary);
     return offset;
 }
 
@@ -377,6 +528,9 @@ RCCResourceLibrary::dataFiles() const
 
 bool RCCResourceLibrary::output(const QString &out_name)
 {
+    if (mFormat == Binary)
+        return outputBinary(out_name);
+
     FILE *out;
 
     // Create the output file or use stdout if not specified.
@@ -445,14 +599,20 @@ RCCResourceLibrary::writeHeader(FILE *out)
 bool
 RCCResourceLibrary::writeDataBlobs(FILE *out)
 {
-    fprintf(out, "qt_resource_data = b\"\\\n");
+    const bool binary = (mFormat == Binary);
+
+    if (!binary)
+        fprintf(out, "qt_resource_data = b\"\\\n");
+
     QStack<RCCFileInfo*> pending;
 
     if (!root)
         return false;
 
+    // Collect the files in the order their data is written.
+    QList<RCCFileInfo *> files;
+
     pending.push(root);
-    qint64 offset = 0;
     while(!pending.isEmpty()) {
         RCCFileInfo *file = pending.pop();
         for(QHash<QString, RCCFileInfo*>::iterator it = file->children.begin();
@@ -461,17 +621,103 @@ RCCResourceLibrary::writeDataBlobs(FILE *out)
             if(child->flags & RCCFileInfo::Directory)
                 pending.push(child);
             else
-                offset = child->writeDataBlob(out, offset);
+                files.append(child);
         }
     }
-    fprintf(out, "\"\n\n");
+
+    // Reuse the payloads of any files that haven't changed since the cache
+    // was written.  Compression is deterministic so the output is the same
+    // as if they had been compressed again.
+    QHash<QString, RCCCacheEntry> cache;
+
+    if (!mCacheFile.isEmpty())
+        cache = qt_rcc_load_cache(mCacheFile);
+
+    // Reading and compressing the files is independent of the output so do
+    // it in parallel.
+    QAtomicInt failures;
+    QThreadPool pool;
+    int reused = 0;
+
+    for (int i = 0; i < files.size(); ++i) {
+        RCCFileInfo *child = files.at(i);
+        QHash<QString, RCCCacheEntry>::const_iterator cached = cache.constFind(child->fileInfo.absoluteFilePath());
+
+        if (cached != cache.constEnd()) {
+            const RCCCacheEntry current = qt_rcc_cache_entry(child);
+
+            if (cached->lastModified == current.lastModified &&
+                cached->size == current.size &&
+                cached->compressLevel == current.compressLevel &&
+                cached->compressThreshold == current.compressThreshold) {
+                child->payload = cached->payload;
+
+                if (cached->compressed)
+                    child->flags |= RCCFileInfo::Compressed;
+
+                ++reused;
+                continue;
+            }
+        }
+
+        pool.start(new RCCPrepareTask(child, failures));
+    }
+
+    pool.waitForDone();
+
+    if (failures.load() != 0)
+        return false;
+
+    if (mVerbose && !mCacheFile.isEmpty())
+        fprintf(stderr, "Reused %d of %d cached files\n", reused, files.size());
+
+    if (!mCacheFile.isEmpty()) {
+        cache.clear();
+
+        if (!qt_rcc_save_cache(mCacheFile, files))
+            fprintf(stderr, "Unable to write cache %s\n", mCacheFile.toLatin1().constData());
+    }
+
+    // Files with identical contents (eg. the same icon under several
+    // aliases) share a single copy of the data.  Compressed and uncompressed
+    // payloads are kept apart as the flag is not part of the data.
+    QHash<QByteArray, qint64> written[2];
+    qint64 offset = 0;
+
+    for (int i = 0; i < files.size(); ++i) {
+        RCCFileInfo *child = files.at(i);
+        QHash<QByteArray, qint64> &same = written[(child->flags & RCCFileInfo::Compressed) ? 1 : 0];
+        QHash<QByteArray, qint64>::const_iterator dup = same.constFind(child->payload);
+        const bool shared = (dup != same.constEnd());
+
+        if (mVerbose)
+            fprintf(stderr, "%s: %lld -> %d bytes%s%s\n",
+                    child->fileInfo.filePath().toLatin1().constData(),
+                    child->fileInfo.size(), child->payload.size(),
+                    (child->flags & RCCFileInfo::Compressed) ? " (compressed)" : "",
+                    shared ? " (shared)" : "");
+
+        if (shared) {
+            child->dataOffset = dup.value();
+            child->payload = QByteArray();
+        } else {
+            same.insert(child->payload, offset);
+            offset = child->writeDataBlob(out, offset, binary);
+        }
+    }
+
+    if (!binary)
+        fprintf(out, "\"\n\n");
     return true;
 }
 
 bool
 RCCResourceLibrary::writeDataNames(FILE *out)
 {
-    fprintf(out, "qt_resource_name = b\"\\\n");
+    const bool binary = (mFormat == Binary);
+
+    if (!binary)
+        fprintf(out, "qt_resource_name = b\"\\\n");
 
     QHash<QString, int> names;
     QStack<RCCFileInfo*> pending;
@@ -492,14 +738,36 @@ RCCResourceLibrary::writeDataNames(FILE *out)
                 child->nameOffset = names.value(child->name);
             } else {
                 names.insert(child->name, offset);
-                offset = child->writeDataName(out, offset);
+                offset = child->writeDataName(out, offset, binary);
             }
         }
     }
-    fprintf(out, "\"\n\n");
+    if (!binary)
+        fprintf(out, "\"\n\n");
     return true;
 }
 
+// Return a string as a Python string literal.
+static QByteArray qt_rcc_python_string(const QString &str)
+{
+    QByteArray lit("'");
+    const QByteArray utf8 = str.toUtf8();
+
+    for (int i = 0; i < utf8.size(); ++i)
+    {
+        const char ch = utf8.at(i);
+
+        if (ch == '\\' || ch == '\'')
+            lit.append('\\');
+
+        lit.append(ch);
+    }
+
+    lit.append('\'');
+
+    return lit;
+}
+
 static bool qt_rcc_compare_hash(const RCCFileInfo *left, const RCCFileInfo *right)
 {
     return qt_hash(left->name) < qt_hash(right->name);
@@ -507,7 +775,10 @@ static bool qt_rcc_compare_hash(const RCCFileInfo *left, const RCCFileInfo *righ
 
 bool RCCResourceLibrary::writeDataStructure(FILE *out, int version)
 {
-    fprintf(out, "qt_resource_struct_v%d = b\"\\\n", version);
+    const bool binary = (mFormat == Binary);
+
+    if (!binary)
+        fprintf(out, "qt_resource_struct_v%d = b\"\\\n", version);
     QStack<RCCFileInfo*> pending;
 
     if (!root)
@@ -535,7 +806,7 @@ bool RCCResourceLibrary::writeDataStructure(FILE *out, int version)
 
     //write out the structure (ie iterate again!)
     pending.push(root);
-    root->writeDataInfo(out, version);
+    root->writeDataInfo(out, version, binary);
     while(!pending.isEmpty()) {
         RCCFileInfo *file = pending.pop();
 
@@ -546,12 +817,13 @@ bool RCCResourceLibrary::writeDataStructure(FILE *out, int version)
         //write out the actual data now
         for(int i = 0; i < children.size(); ++i) {
             RCCFileInfo *child = children.at(i);
-            child->writeDataInfo(out, version);
+            child->writeDataInfo(out, version, binary);
             if(child->flags & RCCFileInfo::Directory)
                 pending.push(child);
         }
     }
-    fprintf(out, "\"\n\n");
+    if (!binary)
+        fprintf(out, "\"\n\n");
 
     return true;
 }
@@ -583,3 +855,120 @@ RCCResourceLibrary::writeInitializer(FILE *out)
 
     return true;
 }
+
+bool RCCResourceLibrary::outputBinary(const QString &out_name)
+{
+    // The resources are written to a .rcc file next to the loader module.
+    if (out_name.isEmpty())
+    {
+        fprintf(stderr, "An output file is required for binary resources\n");
+        return false;
+    }
+
+    const QFileInfo out_info(out_name);
+    const QString rcc_name = out_info.completeBaseName() + ".rcc";
+    const QString rcc_path = out_info.dir().filePath(rcc_name);
+    FILE *rcc, *out;
+
+#if defined(_MSC_VER) && _MSC_VER >= 1400
+    if (fopen_s(&rcc, rcc_path.toLocal8Bit().constData(), "wb"))
+#else
+    if ((rcc = fopen(rcc_path.toLocal8Bit().constData(), "wb")) == NULL)
+#endif
+    {
+        fprintf(stderr, "Unable to open %s for writing\n",
+                rcc_path.toLatin1().constData());
+        return false;
+    }
+
+    if (mVerbose)
+        fprintf(stderr, "Outputting binary resources\n");
+
+    // The header is written first with zero offsets and is then rewritten
+    // once the offsets of the sections are known.
+    mTreeOffset = mNamesOffset = mDataOffset = 0;
+
+    const char *error;
+
+    if (!writeBinaryHeader(rcc))
+        error = "header";
+    else if ((mDataOffset = ftell(rcc)) < 0 || !writeDataBlobs(rcc))
+        error = "data blob";
+    else if ((mNamesOffset = ftell(rcc)) < 0 || !writeDataNames(rcc))
+        error = "file names";
+    else if ((mTreeOffset = ftell(rcc)) < 0 || !writeDataStructure(rcc, RCC_BINARY_VERSION))
+        error = "data tree";
+    else if (fseek(rcc, 0, SEEK_SET) != 0 || !writeBinaryHeader(rcc))
+        error = "header";
+    else
+        error = 0;
+
+    if (fclose(rcc) != 0 && !error)
+        error = "binary resources";
+
+    if (error)
+    {
+        fprintf(stderr, "Couldn't write %s\n", error);
+        return false;
+    }
+
+#if defined(_MSC_VER) && _MSC_VER >= 1400
+    if (fopen_s(&out, out_name.toLocal8Bit().constData(), "w"))
+#else
+    if ((out = fopen(out_name.toLocal8Bit().constData(), "w")) == NULL)
+#endif
+    {
+        fprintf(stderr, "Unable to open %s for writing\n",
+                out_name.toLatin1().constData());
+        return false;
+    }
+
+    if (!writeHeader(out) || !writeBinaryLoader(out, rcc_name))
+        error = "loader";
+
+    fclose(out);
+
+    if (error)
+    {
+        fprintf(stderr, "Couldn't write %s\n", error);
+        return false;
+    }
+
+    return true;
+}
+
+bool
+RCCResourceLibrary::writeBinaryHeader(FILE *out)
+{
+    fputs("qres", out);
+    qt_rcc_write_number(out, RCC_BINARY_VERSION, 4, true);
+    qt_rcc_write_number(out, mTreeOffset, 4, true);
+    qt_rcc_write_number(out, mDataOffset, 4, true);
+    qt_rcc_write_number(out, mNamesOffset, 4, true);
+
+    return !ferror(out);
+}
+
+bool
+RCCResourceLibrary::writeBinaryLoader(FILE *out, const QString &rcc_name)
+{
+    fprintf(out, "import os\n\n");
+    fprintf(out, "qt_resource_file = os.path.join(os.path.dirname(os.path.abspath(__file__)), %s)\n",
+            qt_rcc_python_string(rcc_name).constData());
+
+    fprintf(out, "\n");
+
+    fprintf(out, "def qInitResources():\n");
+    fprintf(out, "    QtCore.QResource.registerResource(qt_resource_file)\n");
+
+    fprintf(out, "\n");
+
+    fprintf(out, "def qCleanupResources():\n");
+    fprintf(out, "    QtCore.QResource.unregisterResource(qt_resource_file)\n");
+
+    fprintf(out, "\n");
+
+    fprintf(out, "qInitResources()\n");
+
+    return !ferror(out);
+}
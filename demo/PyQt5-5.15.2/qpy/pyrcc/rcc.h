@@ -44,6 +44,7 @@
 
 #include <stdio.h>
 
+#include <QByteArray>
 #include <QFileInfo>
 #include <QHash>
 #include <QIODevice>
@@ -66,11 +67,28 @@
 #define CONSTANT_COMPRESSLEVEL_DEFAULT -1
 #define CONSTANT_COMPRESSTHRESHOLD_DEFAULT 70
 
+// The format version of binary resources.  Version 2 (which adds the last
+// modified time of each file) is understood by Qt v5.8 and later.
+#if QT_VERSION >= 0x050800
+#define RCC_BINARY_VERSION 2
+#else
+#define RCC_BINARY_VERSION 1
+#endif
+
 struct RCCFileInfo;
 
 class RCCResourceLibrary
 {
 public:
+    // The output formats.  Binary writes the resources as a .rcc file and a
+    // small Python module that registers it with QResource::registerResource()
+    // so that the data is mapped rather than copied into Python objects.
+    enum Format
+    {
+        Python_Code,
+        Binary
+    };
+
     inline RCCResourceLibrary();
     ~RCCResourceLibrary();
 
@@ -95,6 +113,14 @@ public:
     inline void setResourceRoot(QString str) { mResourceRoot = str; }
     inline QString resourceRoot() const { return mResourceRoot; }
 
+    inline void setFormat(Format f) { mFormat = f; }
+    inline Format format() const { return mFormat; }
+
+    // The cache file holds the prepared data of each file so that unchanged
+    // files are not read and compressed again on the next run.
+    inline void setCacheFile(QString file) { mCacheFile = file; }
+    inline QString cacheFile() const { return mCacheFile; }
+
 private:
     RCCFileInfo *root;
     bool addFile(const QString &alias, const RCCFileInfo &file);
@@ -105,10 +131,15 @@ private:
     bool writeDataNames(FILE *out);
     bool writeDataStructure(FILE *out, int version);
     bool writeInitializer(FILE *out);
+    bool outputBinary(const QString &out_name);
+    bool writeBinaryHeader(FILE *out);
+    bool writeBinaryLoader(FILE *out, const QString &rcc_name);
 
     QStringList mFileNames;
     QString mResourceRoot;
+    QString mCacheFile;
     bool mVerbose;
+    Format mFormat;
     int mCompressLevel;
     int mCompressThreshold;
     int mTreeOffset, mNamesOffset, mDataOffset;
@@ -118,6 +149,7 @@ inline RCCResourceLibrary::RCCResourceLibrary()
 {
     root = 0;
     mVerbose = false;
+    mFormat = Python_Code;
     mCompressLevel = -1;
     mCompressThreshold = 70;
     mTreeOffset = mNamesOffset = mDataOffset = 0;
@@ -153,9 +185,11 @@ struct RCCFileInfo
     int mCompressThreshold;
 
     qint64 nameOffset, dataOffset, childOffset;
-    qint64 writeDataBlob(FILE *out, qint64 offset);
-    qint64 writeDataName(FILE *out, qint64 offset);
-    void writeDataInfo(FILE *out, int version);
+    QByteArray payload;
+    bool prepareData();
+    qint64 writeDataBlob(FILE *out, qint64 offset, bool binary);
+    qint64 writeDataName(FILE *out, qint64 offset, bool binary);
+    void writeDataInfo(FILE *out, int version, bool binary);
 };
 
 inline RCCFileInfo::RCCFileInfo(QString name, QFileInfo fileInfo, QLocale locale, uint flags,
@@ -184,6 +184,12 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
         else if (mode == FAST_RSEARCH)
             return STRINGLIB(rfind_char)(s, n, p[0]);
         else {  /* FAST_COUNT */
+            if (maxcount == PY_SSIZE_T_MAX) {
+                /* without the early exit the compiler can vectorize this */
+                for (i = 0; i < n; i++)
+                    count += (s[i] == p[0]);
+                return count;
+            }
             for (i = 0; i < n; i++)
                 if (s[i] == p[0]) {
                     count++;
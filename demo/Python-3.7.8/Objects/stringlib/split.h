@@ -47,6 +47,11 @@
     count++; }
 
 
+/* Separators in delimited data are usually close together, where an inline
+   loop is fastest.  Once a field is longer than this, the rest of it is
+   scanned with find_char()/rfind_char(), which use memchr()/memrchr(). */
+#define SPLIT_INLINE_SCAN 32
+
 /* Always force the list to the expected size. */
 #define FIX_PREALLOC_SIZE(list) Py_SIZE(list) = count
 
@@ -113,13 +118,18 @@ STRINGLIB(split_char)(PyObject* str_obj,
 
     i = j = 0;
     while ((j < str_len) && (maxcount-- > 0)) {
-        for(; j < str_len; j++) {
-            /* I found that using memchr makes no difference */
-            if (str[j] == ch) {
-                SPLIT_ADD(str, i, j);
-                i = j = j + 1;
+        Py_ssize_t end = Py_MIN(str_len, j + SPLIT_INLINE_SCAN);
+        for(; j < end; j++) {
+            if (str[j] == ch)
                 break;
-            }
+        }
+        if (j == end && j < str_len) {
+            Py_ssize_t pos = STRINGLIB(find_char)(str + j, str_len - j, ch);
+            j = (pos < 0) ? str_len : j + pos;
+        }
+        if (j < str_len) {
+            SPLIT_ADD(str, i, j);
+            i = j = j + 1;
         }
     }
 #ifndef STRINGLIB_MUTABLE
@@ -254,12 +264,16 @@ STRINGLIB(rsplit_char)(PyObject* str_obj,
 
     i = j = str_len - 1;
     while ((i >= 0) && (maxcount-- > 0)) {
-        for(; i >= 0; i--) {
-            if (str[i] == ch) {
-                SPLIT_ADD(str, i + 1, j + 1);
-                j = i = i - 1;
+        Py_ssize_t end = Py_MAX(-1, i - SPLIT_INLINE_SCAN);
+        for(; i > end; i--) {
+            if (str[i] == ch)
                 break;
-            }
+        }
+        if (i == end && i >= 0)
+            i = STRINGLIB(rfind_char)(str, i + 1, ch);
+        if (i >= 0) {
+            SPLIT_ADD(str, i + 1, j + 1);
+            j = i = i - 1;
         }
     }
 #ifndef STRINGLIB_MUTABLE
@@ -27,6 +27,7 @@
 #include <qdatetime.h>
 #include <qdesktopwidget.h>
 #include <qfont.h>
+#include <qfontinfo.h>
 #include <qimage.h>
 #include <qpainter.h>
 #include <qpixmap.h>
@@ -220,6 +221,7 @@ private:
     static QFont convertQFont(Font &font);
     QFontMetricsF metrics(Font &font_);
     QString convertText(const char *s, int len);
+    static bool isPrintableAscii(const char *s, int len);
     static QColor convertQColor(const ColourDesired &col,
             unsigned alpha = 255);
 
@@ -575,8 +577,26 @@ void SurfaceImpl::DrawRGBAImage(PRectangle rc, int width, int height,
 void SurfaceImpl::MeasureWidths(Font &font_, const char *s, int len,
         XYPOSITION *positions)
 {
+    QFont fnt = convertQFont(font_);
+
+    // Printable ASCII in a fixed pitch font doesn't need to be shaped.
+    if (isPrintableAscii(s, len) && QFontInfo(fnt).fixedPitch())
+    {
+        QFontMetricsF fm(fnt, pd);
+        XYPOSITION advance = fm.width(QLatin1Char('i'));
+
+        // Don't trust fonts that only claim to be fixed pitch.
+        if (advance == fm.width(QLatin1Char('W')))
+        {
+            for (int i = 0; i < len; ++i)
+                positions[i] = advance * (i + 1);
+
+            return;
+        }
+    }
+
     QString qs = convertText(s, len);
-    QTextLayout text_layout(qs, convertQFont(font_), pd);
+    QTextLayout text_layout(qs, fnt, pd);
 
     text_layout.beginLayout();
     QTextLine text_line = text_layout.createLine();
@@ -697,6 +717,16 @@ QFontMetricsF SurfaceImpl::metrics(Font &font_)
     return QFontMetricsF(fnt, pd);
 }
 
+// See if a Scintilla string only contains printable ASCII characters.
+bool SurfaceImpl::isPrintableAscii(const char *s, int len)
+{
+    for (int i = 0; i < len; ++i)
+        if (s[i] < 0x20 || s[i] > 0x7e)
+            return false;
+
+    return true;
+}
+
 // Convert a Scintilla string to a Qt Unicode string.
 QString SurfaceImpl::convertText(const char *s, int len)
 {
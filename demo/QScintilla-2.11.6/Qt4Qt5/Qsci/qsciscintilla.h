@@ -228,6 +228,24 @@ public:
         BoxedTreeFoldStyle
     };
 
+    //! This enum defines the different modes of styling text while the
+    //! editor is idle rather than synchronously when it is displayed.
+    enum IdleStyling {
+        //! All text is styled synchronously before it is displayed.
+        IdleStyleNone = SC_IDLESTYLING_NONE,
+
+        //! Only a bounded amount of the visible text is styled synchronously
+        //! and the rest of it is styled in idle time.
+        IdleStyleToVisible = SC_IDLESTYLING_TOVISIBLE,
+
+        //! The text after the visible text is styled in idle time.
+        IdleStyleAfterVisible = SC_IDLESTYLING_AFTERVISIBLE,
+
+        //! Both the visible text and the text after it are styled in idle
+        //! time.
+        IdleStyleAll = SC_IDLESTYLING_ALL
+    };
+
     //! This enum defines the different indicator styles.
     enum IndicatorStyle {
         //! A single straight underline.
@@ -881,6 +899,11 @@ public:
     //! \sa selectedText()
     bool hasSelectedText() const {return selText;}
 
+    //! Returns the current idle styling mode.
+    //!
+    //! \sa setIdleStyling()
+    IdleStyling idleStyling() const;
+
     //! Returns the number of characters that line \a line is indented by.
     //!
     //! \sa setIndentation()
@@ -1493,6 +1516,14 @@ public:
     //! area to following lines.  The default is true.
     void setHotspotWrap(bool enable);
 
+    //! Sets the idle styling mode to \a mode.  With a mode other than
+    //! IdleStyleNone large documents, and QsciLexerCustom lexers in
+    //! particular, are styled in time-limited chunks so that the editor
+    //! remains responsive.  The default is IdleStyleNone.
+    //!
+    //! \sa idleStyling()
+    void setIdleStyling(IdleStyling mode);
+
     //! Sets whether or not the selection is drawn up to the right hand border.
     //! \a filled is set if the selection is drawn to the border.
     //!
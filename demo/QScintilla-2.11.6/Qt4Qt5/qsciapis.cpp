@@ -29,6 +29,7 @@
 #include <QFile>
 #include <QLibraryInfo>
 #include <QMap>
+#include <QSet>
 #include <QTextStream>
 #include <QThread>
 
@@ -430,6 +431,13 @@ void QsciAPIs::updateAutoCompletionList(const QStringList &context,
         const QString wsep = lexer()->autoCompletionWordSeparators().first();
         QStringList::const_iterator it = origin;
 
+        // Many entries can share the same next word so use a set to check
+        // for duplicates rather than scanning the list each time.
+        QSet<QString> seen;
+
+        for (int i = 0; i < list.count(); ++i)
+            seen.insert(list[i]);
+
         unambiguous_context = path;
 
         while (it != prep->raw_apis.end())
@@ -449,8 +457,11 @@ void QsciAPIs::updateAutoCompletionList(const QStringList &context,
                 // Append the space, we know the origin is unambiguous.
                 w.append(' ');
 
-                if (!list.contains(w))
+                if (!seen.contains(w))
+                {
+                    seen.insert(w);
                     list << w;
+                }
             }
 
             ++it;
@@ -470,8 +481,19 @@ void QsciAPIs::updateAutoCompletionList(const QStringList &context,
         else
             lastPartialWord(new_context.last(), with_context, unambig);
 
+        // Remove duplicates, keeping the first occurrence of each.  This is
+        // done once here as a short prefix can match many thousands of
+        // entries.
+        QSet<QString> seen;
+        seen.reserve(with_context.count());
+
         for (int i = 0; i < with_context.count(); ++i)
         {
+            if (seen.contains(with_context[i]))
+                continue;
+
+            seen.insert(with_context[i]);
+
             // Remove any unambigious context (allowing for a possible image
             // identifier).
             QString noc = with_context[i];
@@ -676,8 +698,9 @@ void QsciAPIs::addAPIEntries(const WordIndexList &wl, bool complete,
             }
         }
 
-        if (!with_context.contains(api_word))
-            with_context.append(api_word);
+        // Duplicates are removed by the caller once all entries have been
+        // added.
+        with_context.append(api_word);
     }
 }
 
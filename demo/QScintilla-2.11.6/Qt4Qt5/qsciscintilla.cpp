@@ -22,6 +22,7 @@
 
 #include "Qsci/qsciscintilla.h"
 
+#include <limits.h>
 #include <string.h>
 
 #include <QAction>
@@ -2163,6 +2164,20 @@ void QsciScintilla::setHotspotWrap(bool enable)
 }
 
 
+// Return the idle styling mode.
+QsciScintilla::IdleStyling QsciScintilla::idleStyling() const
+{
+    return (IdleStyling)SendScintilla(SCI_GETIDLESTYLING);
+}
+
+
+// Set the idle styling mode.
+void QsciScintilla::setIdleStyling(IdleStyling mode)
+{
+    SendScintilla(SCI_SETIDLESTYLING, mode);
+}
+
+
 // Query the read-only state.
 bool QsciScintilla::isReadOnly() const
 {
@@ -4091,6 +4106,16 @@ bool QsciScintilla::read(QIODevice *io)
     const int min_size = 1024 * 8;
 
     int buf_size = min_size;
+
+    // Avoid growing the buffer repeatedly if we know how much there is.
+    if (!io->isSequential())
+    {
+        qint64 expected = io->size() - io->pos();
+
+        if (expected > 0 && expected < INT_MAX / 2)
+            buf_size += expected;
+    }
+
     char *buf = new char[buf_size];
 
     int data_len = 0;
@@ -4106,7 +4131,7 @@ bool QsciScintilla::read(QIODevice *io)
         if (buf_size - data_len < min_size)
         {
             buf_size *= 2;
-            char *new_buf = new char[buf_size * 2];
+            char *new_buf = new char[buf_size];
 
             memcpy(new_buf, buf, data_len);
             delete[] buf;
@@ -4126,7 +4151,13 @@ bool QsciScintilla::read(QIODevice *io)
 
         bool ro = ensureRW();
 
+        // Don't keep a copy of the old and new text for undo as the undo
+        // buffer is emptied immediately.
+        bool collect = SendScintilla(SCI_GETUNDOCOLLECTION);
+
+        SendScintilla(SCI_SETUNDOCOLLECTION, false);
         SendScintilla(SCI_SETTEXT, buf);
+        SendScintilla(SCI_SETUNDOCOLLECTION, collect);
         SendScintilla(SCI_EMPTYUNDOBUFFER);
 
         setReadOnly(ro);
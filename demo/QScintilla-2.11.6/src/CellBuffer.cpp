@@ -269,6 +269,16 @@ public:
 	}
 };
 
+namespace {
+
+// Returns the first occurrence of ch in [start, end) or end if there is none.
+const char *FindByte(const char *start, const char *end, char ch) noexcept {
+	const void *found = memchr(start, ch, end - start);
+	return found ? static_cast<const char *>(found) : end;
+}
+
+}
+
 Action::Action() {
 	at = startAction;
 	position = 0;
@@ -964,31 +974,63 @@ void CellBuffer::BasicInsertString(Sci::Position position, const char *s, Sci::P
 		RemoveLine(lineInsert);
 	}
 	unsigned char ch = ' ';
-	for (Sci::Position i = 0; i < insertLength; i++) {
-		ch = s[i];
-		if (ch == '\r') {
-			InsertLine(lineInsert, (position + i) + 1, atLineStart);
-			lineInsert++;
-			simpleInsertion = false;
-		} else if (ch == '\n') {
-			if (chPrev == '\r') {
-				// Patch up what was end of line
-				plv->SetLineStart(lineInsert - 1, (position + i) + 1);
-			} else {
+	if (utf8LineEnds) {
+		for (Sci::Position i = 0; i < insertLength; i++) {
+			ch = s[i];
+			if (ch == '\r') {
 				InsertLine(lineInsert, (position + i) + 1, atLineStart);
 				lineInsert++;
+				simpleInsertion = false;
+			} else if (ch == '\n') {
+				if (chPrev == '\r') {
+					// Patch up what was end of line
+					plv->SetLineStart(lineInsert - 1, (position + i) + 1);
+				} else {
+					InsertLine(lineInsert, (position + i) + 1, atLineStart);
+					lineInsert++;
+				}
+				simpleInsertion = false;
+			} else {
+				const unsigned char back3[3] = {chBeforePrev, chPrev, ch};
+				if (UTF8IsSeparator(back3) || UTF8IsNEL(back3+1)) {
+					InsertLine(lineInsert, (position + i) + 1, atLineStart);
+					lineInsert++;
+					simpleInsertion = false;
+				}
 			}
-			simpleInsertion = false;
-		} else if (utf8LineEnds) {
-			const unsigned char back3[3] = {chBeforePrev, chPrev, ch};
-			if (UTF8IsSeparator(back3) || UTF8IsNEL(back3+1)) {
+			chBeforePrev = chPrev;
+			chPrev = ch;
+		}
+	} else {
+		// Only '\r' and '\n' can end lines so jump between them with memchr rather
+		// than testing every byte. Each search only restarts once its match has
+		// been consumed so the whole insertion is scanned at most twice.
+		const char *const end = s + insertLength;
+		const char *nextCR = FindByte(s, end, '\r');
+		const char *nextLF = FindByte(s, end, '\n');
+		while (true) {
+			const char *lineEnd = std::min(nextCR, nextLF);
+			if (lineEnd == end)
+				break;
+			const Sci::Position i = lineEnd - s;
+			if (*lineEnd == '\r') {
 				InsertLine(lineInsert, (position + i) + 1, atLineStart);
 				lineInsert++;
-				simpleInsertion = false;
+				nextCR = FindByte(lineEnd + 1, end, '\r');
+			} else {
+				const unsigned char chBefore = (i > 0) ? s[i - 1] : chPrev;
+				if (chBefore == '\r') {
+					// Patch up what was end of line
+					plv->SetLineStart(lineInsert - 1, (position + i) + 1);
+				} else {
+					InsertLine(lineInsert, (position + i) + 1, atLineStart);
+					lineInsert++;
+				}
+				nextLF = FindByte(lineEnd + 1, end, '\n');
 			}
+			simpleInsertion = false;
 		}
-		chBeforePrev = chPrev;
-		chPrev = ch;
+		ch = s[insertLength - 1];
 	}
 	// Joining two lines where last insertion is cr and following substance starts with lf
 	if (chAfter == '\n') {
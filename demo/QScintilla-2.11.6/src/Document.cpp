@@ -1942,6 +1942,23 @@ bool Document::MatchesWordOptions(bool word, bool wordStart, Sci::Position pos,
 			(wordStart && IsWordStartAt(pos));
 }
 
+/**
+ * Return the first position in [start, end) holding ch or end if there is none.
+ * Each side of the gap is searched separately so the buffer is not rearranged.
+ */
+Sci::Position Document::FindByteForward(Sci::Position start, Sci::Position end, char ch) noexcept {
+	const Sci::Position gap = cb.GapPosition();
+	while (start < end) {
+		const Sci::Position segmentEnd = (start < gap) ? std::min(gap, end) : end;
+		const char *segment = cb.RangePointer(start, segmentEnd - start);
+		const void *found = memchr(segment, ch, segmentEnd - start);
+		if (found)
+			return start + (static_cast<const char *>(found) - segment);
+		start = segmentEnd;
+	}
+	return end;
+}
+
 bool Document::HasCaseFolder() const noexcept {
 	return pcf != nullptr;
 }
@@ -2008,7 +2025,16 @@ Sci::Position Document::FindText(Sci::Position minPos, Sci::Position maxPos, con
 		if (caseSensitive) {
 			const Sci::Position endSearch = (startPos <= endPos) ? endPos - lengthFind + 1 : endPos;
 			const char charStartSearch =  search[0];
+			// Searching forward, jump straight to the next occurrence of the first byte
+			// when that can not land inside a multi-byte character
+			const bool skipToCandidate = forward && (!dbcsCodePage ||
+				((SC_CP_UTF8 == dbcsCodePage) && !UTF8IsTrailByte(charStartSearch)));
 			while (forward ? (pos < endSearch) : (pos >= endSearch)) {
+				if (skipToCandidate) {
+					pos = FindByteForward(pos, endSearch, charStartSearch);
+					if (pos >= endSearch)
+						break;
+				}
 				if (CharAt(pos) == charStartSearch) {
 					bool found = (pos + lengthFind) <= limitPos;
 					for (int indexSearch = 1; (indexSearch < lengthFind) && found; indexSearch++) {
@@ -432,6 +432,7 @@ public:
 	bool IsWordAt(Sci::Position start, Sci::Position end) const;
 
 	bool MatchesWordOptions(bool word, bool wordStart, Sci::Position pos, Sci::Position length) const;
+	Sci::Position FindByteForward(Sci::Position start, Sci::Position end, char ch) noexcept;
 	bool HasCaseFolder() const noexcept;
 	void SetCaseFolder(CaseFolder *pcf_);
 	Sci::Position FindText(Sci::Position minPos, Sci::Position maxPos, const char *search, int flags, Sci::Position *length);
@@ -0,0 +1 @@
+#include "../../../../../src/core/resources/qframearena_p.h"
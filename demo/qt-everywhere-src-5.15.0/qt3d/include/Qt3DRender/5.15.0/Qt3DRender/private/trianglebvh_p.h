@@ -0,0 +1 @@
+#include "../../../../../src/render/backend/trianglebvh_p.h"
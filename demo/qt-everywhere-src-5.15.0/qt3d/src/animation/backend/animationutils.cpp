@@ -232,7 +232,7 @@ ComponentIndices channelComponentsToIndicesHelper(const Channel &channel,
     return indices;
 }
 
-ClipResults evaluateClipAtLocalTime(AnimationClip *clip, float localTime)
+ClipResults evaluateClipAtLocalTime(AnimationClip *clip, float localTime, KeyframeCursors *cursors)
 {
     QVector<float> channelResults;
     Q_ASSERT(clip);
@@ -240,6 +240,15 @@ ClipResults evaluateClipAtLocalTime(AnimationClip *clip, float localTime)
     // Ensure we have enough storage to hold the evaluations
     channelResults.resize(clip->channelCount());
 
+    // Start the keyframe lookups from the caller's cursors if we have some,
+    // otherwise use the lookup state shared by all users of the fcurves
+    if (cursors && cursors->size() != clip->channelCount())
+        cursors->fill(0, clip->channelCount());
+    auto lowerKeyframeBound = [cursors, localTime] (const FCurve &fcurve, int componentIndex) {
+        return cursors ? fcurve.lowerKeyframeBound(localTime, (*cursors)[componentIndex])
+                       : fcurve.lowerKeyframeBound(localTime);
+    };
+
     // Iterate over channels and evaluate the fcurves
     const QVector<Channel> &channels = clip->channels();
     int i = 0;
@@ -258,8 +267,8 @@ ClipResults evaluateClipAtLocalTime(AnimationClip *clip, float localTime)
             if (!canSlerp) {
                 // Interpolate per component
                 for (const auto &channelComponent : qAsConst(channel.channelComponents)) {
-                    const int lowerKeyframeBound = channelComponent.fcurve.lowerKeyframeBound(localTime);
-                    channelResults[i++] = channelComponent.fcurve.evaluateAtTime(localTime, lowerKeyframeBound);
+                    const int lowerBound = lowerKeyframeBound(channelComponent.fcurve, i);
+                    channelResults[i++] = channelComponent.fcurve.evaluateAtTime(localTime, lowerBound);
                 }
             } else {
                 // There's only one keyframe. We cant compute omega. Interpolate per component
@@ -267,7 +276,7 @@ ClipResults evaluateClipAtLocalTime(AnimationClip *clip, float localTime)
                     for (const auto &channelComponent : qAsConst(channel.channelComponents))
                         channelResults[i++] = channelComponent.fcurve.keyframe(0).value;
                 } else {
-                    auto quaternionFromChannel = [channel](const int keyframe) {
+                    auto quaternionFromChannel = [&channel](const int keyframe) {
                         const float w = channel.channelComponents[0].fcurve.keyframe(keyframe).value;
                         const float x = channel.channelComponents[1].fcurve.keyframe(keyframe).value;
                         const float y = channel.channelComponents[2].fcurve.keyframe(keyframe).value;
@@ -277,9 +286,9 @@ ClipResults evaluateClipAtLocalTime(AnimationClip *clip, float localTime)
                         return quat;
                     };
 
-                    const int lowerKeyframeBound = channel.channelComponents[0].fcurve.lowerKeyframeBound(localTime);
-                    const auto lowerQuat = quaternionFromChannel(lowerKeyframeBound);
-                    const auto higherQuat = quaternionFromChannel(lowerKeyframeBound + 1);
+                    const int lowerBound = lowerKeyframeBound(channel.channelComponents[0].fcurve, i);
+                    const auto lowerQuat = quaternionFromChannel(lowerBound);
+                    const auto higherQuat = quaternionFromChannel(lowerBound + 1);
                     auto cosHalfTheta = QQuaternion::dotProduct(lowerQuat, higherQuat);
                     // If the two keyframe quaternions are equal, just return the first one as the interpolated value.
                     if (std::abs(cosHalfTheta) >= 1.0f) {
@@ -292,7 +301,7 @@ ClipResults evaluateClipAtLocalTime(AnimationClip *clip, float localTime)
                         if (std::abs(sinHalfTheta) < ::slerpThreshold) {
                             auto initial_i = i;
                             for (const auto &channelComponent : qAsConst(channel.channelComponents))
-                                channelResults[i++] = channelComponent.fcurve.evaluateAtTime(localTime, lowerKeyframeBound);
+                                channelResults[i++] = channelComponent.fcurve.evaluateAtTime(localTime, lowerBound);
 
                             // Normalize the resulting quaternion
                             QQuaternion quat{channelResults[initial_i], channelResults[initial_i+1], channelResults[initial_i+2], channelResults[initial_i+3]};
@@ -307,7 +316,7 @@ ClipResults evaluateClipAtLocalTime(AnimationClip *clip, float localTime)
                             const auto halfTheta = std::acos(cosHalfTheta);
                             for (const auto &channelComponent : qAsConst(channel.channelComponents))
                                 channelResults[i++] = channelComponent.fcurve.evaluateAtTimeAsSlerp(localTime,
-                                                                                                    lowerKeyframeBound,
+                                                                                                    lowerBound,
                                                                                                     halfTheta,
                                                                                                     sinHalfTheta,
                                                                                                     reverseQ1);
@@ -320,19 +329,19 @@ ClipResults evaluateClipAtLocalTime(AnimationClip *clip, float localTime)
             // TODO How do we handle other interpolations. For exammple, color interpolation
             // in a linear perceptual way or other non linear spaces?
             for (const auto &channelComponent : qAsConst(channel.channelComponents)) {
-                const int lowerKeyframeBound = channelComponent.fcurve.lowerKeyframeBound(localTime);
-                channelResults[i++] = channelComponent.fcurve.evaluateAtTime(localTime, lowerKeyframeBound);
+                const int lowerBound = lowerKeyframeBound(channelComponent.fcurve, i);
+                channelResults[i++] = channelComponent.fcurve.evaluateAtTime(localTime, lowerBound);
             }
         }
     }
     return channelResults;
 }
 
-ClipResults evaluateClipAtPhase(AnimationClip *clip, float phase)
+ClipResults evaluateClipAtPhase(AnimationClip *clip, float phase, KeyframeCursors *cursors)
 {
     // Calculate the clip local time from the phase and clip duration
     const double localTime = phase * clip->duration();
-    return evaluateClipAtLocalTime(clip, localTime);
+    return evaluateClipAtLocalTime(clip, localTime, cursors);
 }
 
 template<typename Container>
@@ -127,6 +127,10 @@ struct ClipEvaluationData
 
 typedef QVector<float> ClipResults;
 
+// Last keyframe range found for each channel component of a clip, kept by
+// whoever evaluates the clip so that subsequent frames start from there
+typedef QVector<int> KeyframeCursors;
+
 struct ChannelNameAndType
 {
     QString jointName;
@@ -352,11 +356,13 @@ ComponentIndices channelComponentsToIndicesHelper(const Channel &channelGroup,
 
 Q_AUTOTEST_EXPORT
 ClipResults evaluateClipAtLocalTime(AnimationClip *clip,
-                                    float localTime);
+                                    float localTime,
+                                    KeyframeCursors *cursors = nullptr);
 
 Q_AUTOTEST_EXPORT
 ClipResults evaluateClipAtPhase(AnimationClip *clip,
-                                float phase);
+                                float phase,
+                                KeyframeCursors *cursors = nullptr);
 
 Q_AUTOTEST_EXPORT
 QVector<AnimationCallbackAndValue> prepareCallbacks(const QVector<MappingData> &mappingDataVec,
@@ -112,6 +112,7 @@ void ClipAnimator::cleanup()
     m_running = false;
     m_loops = 1;
     m_clipFormat = ClipFormat();
+    m_keyframeCursors.clear();
     m_normalizedLocalTime = m_lastNormalizedLocalTime = -1.0f;
 }
 
@@ -97,6 +97,7 @@ public:
 
     void setClipFormat(const ClipFormat &clipFormat) { m_clipFormat = clipFormat; }
     ClipFormat clipFormat() const { return m_clipFormat; }
+    KeyframeCursors *keyframeCursors() { return &m_keyframeCursors; }
 
     qint64 nsSincePreviousFrame(qint64 currentGlobalTimeNS);
     void setLastGlobalTimeNS(qint64 lastGlobalTimeNS);
@@ -126,6 +127,7 @@ private:
 
     int m_currentLoop;
     ClipFormat m_clipFormat;
+    KeyframeCursors m_keyframeCursors;
 
     float m_normalizedLocalTime;
     float m_lastNormalizedLocalTime;
@@ -88,8 +88,10 @@ void ClipBlendValue::setClipFormat(Qt3DCore::QNodeId animatorId, const ClipForma
         // Nope, add it
         m_animatorIds.push_back(animatorId);
         m_clipFormats.push_back(formatIndices);
+        m_keyframeCursors.push_back(KeyframeCursors());
     } else {
         m_clipFormats[animatorIndex] = formatIndices;
+        m_keyframeCursors[animatorIndex].clear();
     }
 }
 
@@ -105,6 +107,12 @@ const ClipFormat &ClipBlendValue::clipFormat(Qt3DCore::QNodeId animatorId) const
     return m_clipFormats[animatorIndex];
 }
 
+KeyframeCursors *ClipBlendValue::keyframeCursors(Qt3DCore::QNodeId animatorId)
+{
+    const int animatorIndex = m_animatorIds.indexOf(animatorId);
+    return animatorIndex != -1 ? &m_keyframeCursors[animatorIndex] : nullptr;
+}
+
 } // namespace Animation
 } // namespace Qt3DAnimation
 
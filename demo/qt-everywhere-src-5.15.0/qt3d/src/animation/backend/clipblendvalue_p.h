@@ -81,6 +81,7 @@ public:
     void setClipFormat(Qt3DCore::QNodeId animatorId, const ClipFormat &formatIndices);
     ClipFormat &clipFormat(Qt3DCore::QNodeId animatorId);
     const ClipFormat &clipFormat(Qt3DCore::QNodeId animatorId) const;
+    KeyframeCursors *keyframeCursors(Qt3DCore::QNodeId animatorId);
 
 protected:
     ClipResults doBlend(const QVector<ClipResults> &blendData) const override;
@@ -90,6 +91,7 @@ private:
 
     QVector<Qt3DCore::QNodeId> m_animatorIds;
     QVector<ClipFormat> m_clipFormats;
+    QVector<KeyframeCursors> m_keyframeCursors;
 };
 
 } // namespace Animation
@@ -109,7 +109,8 @@ void EvaluateBlendClipAnimatorJob::run()
         AnimationClip *clip = clipLoaderManager->lookupResource(valueNode->clipId());
         Q_ASSERT(clip);
 
-        ClipResults rawClipResults = evaluateClipAtPhase(clip, float(phase));
+        ClipResults rawClipResults = evaluateClipAtPhase(clip, float(phase),
+                                                         valueNode->keyframeCursors(blendedClipAnimator->peerId()));
 
         // Reformat the clip results into the layout used by this animator/blend tree
         const ClipFormat format = valueNode->clipFormat(blendedClipAnimator->peerId());
@@ -87,7 +87,8 @@ void EvaluateClipAnimatorJob::run()
                                                                                     nsSincePreviousFrame);
 
     const ClipEvaluationData preEvaluationDataForClip = evaluationDataForClip(clip, animatorEvaluationData);
-    const ClipResults rawClipResults = evaluateClipAtPhase(clip, preEvaluationDataForClip.normalizedLocalTime);
+    const ClipResults rawClipResults = evaluateClipAtPhase(clip, preEvaluationDataForClip.normalizedLocalTime,
+                                                            clipAnimator->keyframeCursors());
 
     // Reformat the clip results into the layout used by this animator/blend tree
     const ClipFormat clipFormat = clipAnimator->clipFormat();
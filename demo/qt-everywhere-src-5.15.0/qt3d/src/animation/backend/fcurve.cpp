@@ -41,6 +41,8 @@
 #include <QtCore/qjsonobject.h>
 #include <QtCore/QLatin1String>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 namespace Qt3DAnimation {
@@ -144,6 +146,43 @@ int FCurve::lowerKeyframeBound(float localTime) const
     return m_rangeFinder.findLowerBound(localTime);
 }
 
+/*!
+    \internal
+
+    Same as lowerKeyframeBound(float) but starts from, and updates, a \a cursor
+    owned by the caller instead of the state shared by all users of the curve.
+    During playback the requested time is usually in the range found for the
+    previous frame or in the next one, which both only need a comparison.
+ */
+int FCurve::lowerKeyframeBound(float localTime, int &cursor) const
+{
+    if (localTime < m_localTimes.first())
+        return 0;
+    if (localTime > m_localTimes.last())
+        return 0;
+
+    const int lastRange = m_localTimes.size() - 2;
+    if (lastRange < 0)
+        return -1;
+
+    const auto sandwiches = [&] (int lowerBound) {
+        return m_localTimes[lowerBound] <= localTime
+                && (lowerBound == lastRange || localTime < m_localTimes[lowerBound + 1]);
+    };
+
+    int lowerBound = qBound(0, cursor, lastRange);
+    if (!sandwiches(lowerBound)) {
+        if (lowerBound < lastRange && sandwiches(lowerBound + 1)) {
+            ++lowerBound;
+        } else {
+            const auto it = std::upper_bound(m_localTimes.cbegin(), m_localTimes.cend(), localTime);
+            lowerBound = qBound(0, int(std::distance(m_localTimes.cbegin(), it)) - 1, lastRange);
+        }
+    }
+    cursor = lowerBound;
+    return lowerBound;
+}
+
 float FCurve::startTime() const
 {
     if (!m_localTimes.isEmpty())
@@ -86,6 +86,7 @@ public:
     float evaluateAtTime(float localTime, int lowerBound) const;
     float evaluateAtTimeAsSlerp(float localTime, int lowerBound, float halfTheta, float sinHalfTheta, float reverseQ1) const;
     int lowerKeyframeBound(float localTime) const;
+    int lowerKeyframeBound(float localTime, int &cursor) const;
 
     void read(const QJsonObject &json);
     void setFromQChannelComponent(const QChannelComponent &qcc);
@@ -95,6 +95,7 @@ void QAbstractAspectPrivate::onEngineAboutToShutdown()
 void QAbstractAspectPrivate::unregisterBackendType(const QMetaObject &mo)
 {
     m_backendCreatorFunctors.remove(&mo);
+    m_resolvedMappers.clear();
 }
 
 /*!
@@ -181,6 +182,7 @@ void QAbstractAspect::registerBackendType(const QMetaObject &obj, const QBackend
 {
     Q_D(QAbstractAspect);
     d->m_backendCreatorFunctors.insert(&obj, {functor, QAbstractAspectPrivate::DefaultMapper});
+    d->m_resolvedMappers.clear();
 }
 
 void QAbstractAspect::registerBackendType(const QMetaObject &obj, const QBackendNodeMapperPtr &functor, bool supportsSyncing)
@@ -188,12 +190,14 @@ void QAbstractAspect::registerBackendType(const QMetaObject &obj, const QBackend
     Q_D(QAbstractAspect);
     const auto f = supportsSyncing ? QAbstractAspectPrivate::SupportsSyncing : QAbstractAspectPrivate::DefaultMapper;
     d->m_backendCreatorFunctors.insert(&obj, {functor, f});
+    d->m_resolvedMappers.clear();
 }
 
 void QAbstractAspect::unregisterBackendType(const QMetaObject &obj)
 {
     Q_D(QAbstractAspect);
     d->m_backendCreatorFunctors.remove(&obj);
+    d->m_resolvedMappers.clear();
 }
 
 QVariant QAbstractAspect::executeCommand(const QStringList &args)
@@ -211,21 +215,37 @@ QVector<QAspectJobPtr> QAbstractAspect::jobsToExecute(qint64 time)
 QAbstractAspectPrivate::BackendNodeMapperAndInfo QAbstractAspectPrivate::mapperForNode(const QMetaObject *metaObj) const
 {
     Q_ASSERT(metaObj);
-    BackendNodeMapperAndInfo info;
 
-    while (metaObj != nullptr && info.first.isNull()) {
-        info = m_backendCreatorFunctors.value(metaObj);
-        metaObj = metaObj->superClass();
+    // Walking up the class hierarchy costs one lookup per base class, so
+    // remember the result for each concrete type, as long as no backend
+    // type gets registered or unregistered
+    const auto it = m_resolvedMappers.constFind(metaObj);
+    if (it != m_resolvedMappers.cend())
+        return it.value();
+
+    BackendNodeMapperAndInfo info;
+    const QMetaObject *mo = metaObj;
+    while (mo != nullptr && info.first.isNull()) {
+        info = m_backendCreatorFunctors.value(mo);
+        mo = mo->superClass();
     }
+    m_resolvedMappers.insert(metaObj, info);
     return info;
 }
 
 void QAbstractAspectPrivate::syncDirtyFrontEndNodes(const QVector<QNode *> &nodes)
 {
+    // Dirty nodes mostly come in runs of the same type, e.g. animated transforms
+    const QMetaObject *previousMetaObj = nullptr;
+    BackendNodeMapperAndInfo backendNodeMapperInfo;
+
     for (auto node: qAsConst(nodes)) {
         const QMetaObject *metaObj = QNodePrivate::get(node)->m_typeInfo;
-        const BackendNodeMapperAndInfo backendNodeMapperInfo = mapperForNode(metaObj);
-        const QBackendNodeMapperPtr backendNodeMapper = backendNodeMapperInfo.first;
+        if (metaObj != previousMetaObj) {
+            backendNodeMapperInfo = mapperForNode(metaObj);
+            previousMetaObj = metaObj;
+        }
+        const QBackendNodeMapperPtr &backendNodeMapper = backendNodeMapperInfo.first;
 
         if (!backendNodeMapper)
             continue;
@@ -159,6 +159,8 @@ public:
     QAbstractAspectJobManager *m_jobManager;
     QChangeArbiter *m_arbiter;
     QHash<const QMetaObject*, BackendNodeMapperAndInfo> m_backendCreatorFunctors;
+    // Resolved mapper of each concrete node type, see mapperForNode()
+    mutable QHash<const QMetaObject*, BackendNodeMapperAndInfo> m_resolvedMappers;
     QMutex m_singleShotMutex;
     QVector<QAspectJobPtr> m_singleShotJobs;
 
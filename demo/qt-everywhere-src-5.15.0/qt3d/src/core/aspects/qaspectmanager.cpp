@@ -55,6 +55,7 @@
 #include <Qt3DCore/private/qaspectjobmanager_p.h>
 #include <Qt3DCore/private/qaspectjob_p.h>
 #include <Qt3DCore/private/qchangearbiter_p.h>
+#include <Qt3DCore/private/qframearena_p.h>
 #include <Qt3DCore/private/qscheduler_p.h>
 #include <Qt3DCore/private/qservicelocator_p.h>
 #include <Qt3DCore/private/qsysteminformationservice_p_p.h>
@@ -546,6 +547,9 @@ void QAspectManager::processFrame()
     m_jobsInLastFrame = m_scheduler->scheduleAndWaitForFrameAspectJobs(t, m_dumpJobs);
     m_dumpJobs = false;
 
+    // All jobs are done, release their scratch memory
+    QFrameArena::resetAll();
+
     // Tell the aspect the frame is complete (except rendering)
     for (QAbstractAspect *aspect : qAsConst(m_aspects))
         QAbstractAspectPrivate::get(aspect)->frameDone();
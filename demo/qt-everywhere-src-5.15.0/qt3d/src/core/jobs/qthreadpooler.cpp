@@ -98,9 +98,9 @@ void QThreadPooler::enqueueTasks(const QVector<RunnableInterface *> &tasks)
     }
 }
 
-void QThreadPooler::skipTask(RunnableInterface *task)
+void QThreadPooler::skipTask(RunnableInterface *task, RunnableInterface **continuation)
 {
-    enqueueDepencies(task);
+    enqueueDepencies(task, continuation);
 
     if (currentCount() == 0) {
         if (m_futureInterface) {
@@ -113,7 +113,13 @@ void QThreadPooler::skipTask(RunnableInterface *task)
     delete task; // normally gets deleted by threadpool
 }
 
-void QThreadPooler::enqueueDepencies(RunnableInterface *task)
+/*
+    Starts the dependers of \a task that have no pending dependencies left.
+    If \a continuation is given, the first of them is handed back through it
+    instead, so that the calling worker thread can run it right away rather
+    than queuing it on the thread pool and waking up another thread.
+ */
+void QThreadPooler::enqueueDepencies(RunnableInterface *task, RunnableInterface **continuation)
 {
     release();
 
@@ -127,9 +133,12 @@ void QThreadPooler::enqueueDepencies(RunnableInterface *task)
                     dependerTask->setReserved(true);
                     if ((*it)->isRequired()) {
                         dependerTask->setPooler(this);
-                        m_threadPool->start(dependerTask);
+                        if (continuation && !*continuation)
+                            *continuation = dependerTask;
+                        else
+                            m_threadPool->start(dependerTask);
                     } else {
-                        skipTask(*it);
+                        skipTask(*it, continuation);
                     }
                 }
             }
@@ -137,13 +146,19 @@ void QThreadPooler::enqueueDepencies(RunnableInterface *task)
     }
 }
 
-void QThreadPooler::taskFinished(RunnableInterface *task)
+/*
+    Returns a depender of \a task that became ready to run, if any. The caller
+    is expected to run it next on the current thread and to delete it after
+    that, as it is not owned by the thread pool.
+ */
+RunnableInterface *QThreadPooler::taskFinished(RunnableInterface *task)
 {
     const QMutexLocker locker(&m_mutex);
 
     m_totalRunJobs++;
 
-    enqueueDepencies(task);
+    RunnableInterface *continuation = nullptr;
+    enqueueDepencies(task, &continuation);
 
     if (currentCount() == 0) {
         if (m_futureInterface) {
@@ -152,6 +167,8 @@ void QThreadPooler::taskFinished(RunnableInterface *task)
         }
         m_futureInterface = nullptr;
     }
+
+    return continuation;
 }
 
 QFuture<void> QThreadPooler::mapDependables(QVector<RunnableInterface *> &taskQueue)
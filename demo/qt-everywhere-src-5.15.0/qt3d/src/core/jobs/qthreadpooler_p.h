@@ -74,15 +74,15 @@ public:
 
     QFuture<void> mapDependables(QVector<RunnableInterface *> &taskQueue);
     int waitForAllJobs();
-    void taskFinished(RunnableInterface *task);
+    RunnableInterface *taskFinished(RunnableInterface *task);
     QFuture<void> future();
 
     int maxThreadCount() const;
 
 private:
     void enqueueTasks(const QVector<RunnableInterface *> &tasks);
-    void skipTask(RunnableInterface *task);
-    void enqueueDepencies(RunnableInterface *task);
+    void skipTask(RunnableInterface *task, RunnableInterface **continuation = nullptr);
+    void enqueueDepencies(RunnableInterface *task, RunnableInterface **continuation = nullptr);
     void acquire(int add);
     void release();
     int currentCount() const;
@@ -75,17 +75,26 @@ bool AspectTaskRunnable::isRequired() const
 
 void AspectTaskRunnable::run()
 {
-    if (m_job) {
-        QAspectJobPrivate *jobD = QAspectJobPrivate::get(m_job.data());
-        QTaskLogger logger(m_pooler ? m_service : nullptr, jobD->m_jobId, QTaskLogger::AspectJob);
-        m_job->run();
+    // Keep running the dependers this task makes ready on the same thread;
+    // only the first task is owned and deleted by the thread pool.
+    AspectTaskRunnable *task = this;
+    while (task) {
+        if (task->m_job) {
+            QAspectJobPrivate *jobD = QAspectJobPrivate::get(task->m_job.data());
+            QTaskLogger logger(task->m_pooler ? task->m_service : nullptr, jobD->m_jobId, QTaskLogger::AspectJob);
+            task->m_job->run();
+        }
+
+        // We could have an append sub task or something in here
+        // So that a job can post sub jobs ?
+
+        AspectTaskRunnable *next = nullptr;
+        if (task->m_pooler)
+            next = static_cast<AspectTaskRunnable *>(task->m_pooler->taskFinished(task));
+        if (task != this)
+            delete task;
+        task = next;
     }
-
-    // We could have an append sub task or something in here
-    // So that a job can post sub jobs ?
-
-    if (m_pooler)
-        m_pooler->taskFinished(this);
 }
 
 // Synchronized task
@@ -0,0 +1,210 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qframearena_p.h"
+
+#include <Qt3DCore/private/corelogging_p.h>
+
+#include <QtCore/QMutex>
+#include <QtCore/QThreadStorage>
+#include <QtCore/QVector>
+
+#include <algorithm>
+#include <new>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DCore {
+
+namespace {
+
+struct FrameArenaRegistry
+{
+    QMutex mutex;
+    QVector<QFrameArena *> arenas;
+    size_t lastFrameUsedBytes = 0;
+    size_t frameHighWaterMark = 0;
+};
+
+Q_GLOBAL_STATIC(FrameArenaRegistry, arenaRegistry)
+Q_GLOBAL_STATIC(QThreadStorage<QFrameArena *>, threadArenas)
+
+} // anonymous
+
+/*!
+    \class Qt3DCore::QFrameArena
+    \internal
+
+    Per-thread linear allocator from which jobs can allocate their scratch
+    containers, see QFrameVector. Allocating only moves a pointer forward
+    within the current chunk; nothing is freed before the arena is reset.
+*/
+
+QFrameArena::QFrameArena(size_t chunkSize)
+    : m_chunkSize(chunkSize)
+    , m_currentChunk(0)
+    , m_offset(0)
+    , m_usedBytes(0)
+    , m_highWaterMark(0)
+{
+}
+
+QFrameArena::~QFrameArena()
+{
+    if (!arenaRegistry.isDestroyed()) {
+        FrameArenaRegistry *registry = arenaRegistry();
+        QMutexLocker lock(&registry->mutex);
+        registry->arenas.removeOne(this);
+    }
+    for (const Chunk &chunk : m_chunks)
+        ::operator delete(chunk.data);
+}
+
+void *QFrameArena::allocate(size_t size, size_t alignment)
+{
+    Q_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+    size = std::max<size_t>(size, 1);
+
+    while (m_currentChunk < m_chunks.size()) {
+        const Chunk &chunk = m_chunks[m_currentChunk];
+        const quintptr base = quintptr(chunk.data);
+        const quintptr aligned = (base + m_offset + alignment - 1) & ~quintptr(alignment - 1);
+        const size_t end = size_t(aligned - base) + size;
+        if (end <= chunk.size) {
+            m_usedBytes += end - m_offset;
+            m_offset = end;
+            return reinterpret_cast<void *>(aligned);
+        }
+        // Whatever is left in this chunk stays unused until the next reset
+        ++m_currentChunk;
+        m_offset = 0;
+    }
+
+    const size_t chunkSize = std::max(m_chunkSize, size + alignment);
+    m_chunks.push_back({ static_cast<char *>(::operator new(chunkSize)), chunkSize });
+    m_currentChunk = m_chunks.size() - 1;
+    m_offset = 0;
+    return allocate(size, alignment);
+}
+
+void QFrameArena::reset()
+{
+    m_highWaterMark = std::max(m_highWaterMark, m_usedBytes);
+
+    // Replace several chunks by a single one large enough for all of them
+    // so that the next frame allocates from contiguous memory
+    if (m_chunks.size() > 1) {
+        const size_t total = capacity();
+        for (const Chunk &chunk : m_chunks)
+            ::operator delete(chunk.data);
+        m_chunks.clear();
+        m_chunks.push_back({ static_cast<char *>(::operator new(total)), total });
+    }
+
+    m_currentChunk = 0;
+    m_offset = 0;
+    m_usedBytes = 0;
+}
+
+size_t QFrameArena::capacity() const
+{
+    size_t total = 0;
+    for (const Chunk &chunk : m_chunks)
+        total += chunk.size;
+    return total;
+}
+
+/*!
+    Returns the arena of the calling thread, creating it on first use.
+ */
+QFrameArena *QFrameArena::currentThreadArena()
+{
+    QThreadStorage<QFrameArena *> *storage = threadArenas();
+    if (!storage->hasLocalData()) {
+        QFrameArena *arena = new QFrameArena();
+        FrameArenaRegistry *registry = arenaRegistry();
+        {
+            QMutexLocker lock(&registry->mutex);
+            registry->arenas.push_back(arena);
+        }
+        storage->setLocalData(arena);
+    }
+    return storage->localData();
+}
+
+/*!
+    Resets the arenas of all threads. Must only be called while no job is
+    running, QAspectManager does it at the end of each frame.
+ */
+void QFrameArena::resetAll()
+{
+    FrameArenaRegistry *registry = arenaRegistry();
+    QMutexLocker lock(&registry->mutex);
+
+    size_t usedBytes = 0;
+    for (QFrameArena *arena : qAsConst(registry->arenas)) {
+        usedBytes += arena->usedBytes();
+        arena->reset();
+    }
+
+    registry->lastFrameUsedBytes = usedBytes;
+    if (usedBytes > registry->frameHighWaterMark) {
+        registry->frameHighWaterMark = usedBytes;
+        qCDebug(Resources) << "Frame arenas high-water mark:" << usedBytes << "bytes over"
+                           << registry->arenas.size() << "threads";
+    }
+}
+
+size_t QFrameArena::lastFrameUsedBytes()
+{
+    FrameArenaRegistry *registry = arenaRegistry();
+    QMutexLocker lock(&registry->mutex);
+    return registry->lastFrameUsedBytes;
+}
+
+size_t QFrameArena::frameHighWaterMark()
+{
+    FrameArenaRegistry *registry = arenaRegistry();
+    QMutexLocker lock(&registry->mutex);
+    return registry->frameHighWaterMark;
+}
+
+} // Qt3DCore
+
+QT_END_NAMESPACE
@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QT3DCORE_QFRAMEARENA_P_H
+#define QT3DCORE_QFRAMEARENA_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <Qt3DCore/private/qt3dcore_global_p.h>
+
+#include <cstddef>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DCore {
+
+// Linear allocator for the scratch memory of aspect jobs. Each thread has
+// its own arena, memory is never released individually: all arenas are
+// reset at once by the aspect manager when every job of a frame has run,
+// keeping their chunks for the next frame. Memory obtained from an arena
+// must therefore not outlive the job that allocated it.
+class Q_3DCORE_PRIVATE_EXPORT QFrameArena
+{
+public:
+    explicit QFrameArena(size_t chunkSize = 64 * 1024);
+    ~QFrameArena();
+
+    void *allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    void reset();
+
+    size_t usedBytes() const { return m_usedBytes; }
+    size_t highWaterMark() const { return m_highWaterMark; }
+    size_t capacity() const;
+
+    static QFrameArena *currentThreadArena();
+    static void resetAll();
+    // Bytes allocated from all arenas during the last frame
+    static size_t lastFrameUsedBytes();
+    // Largest value reached by lastFrameUsedBytes()
+    static size_t frameHighWaterMark();
+
+private:
+    Q_DISABLE_COPY(QFrameArena)
+
+    struct Chunk
+    {
+        char *data;
+        size_t size;
+    };
+
+    std::vector<Chunk> m_chunks;
+    size_t m_chunkSize;
+    size_t m_currentChunk;
+    size_t m_offset;
+    size_t m_usedBytes;
+    size_t m_highWaterMark;
+};
+
+template<typename T>
+class QFrameArenaAllocator
+{
+public:
+    using value_type = T;
+
+    QFrameArenaAllocator() noexcept
+        : m_arena(QFrameArena::currentThreadArena())
+    {}
+
+    template<typename U>
+    QFrameArenaAllocator(const QFrameArenaAllocator<U> &other) noexcept
+        : m_arena(other.arena())
+    {}
+
+    T *allocate(size_t n)
+    {
+        return static_cast<T *>(m_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *, size_t) noexcept
+    {
+        // Released when the arena is reset
+    }
+
+    QFrameArena *arena() const noexcept { return m_arena; }
+
+private:
+    QFrameArena *m_arena;
+};
+
+template<typename T, typename U>
+inline bool operator==(const QFrameArenaAllocator<T> &a, const QFrameArenaAllocator<U> &b) noexcept
+{ return a.arena() == b.arena(); }
+
+template<typename T, typename U>
+inline bool operator!=(const QFrameArenaAllocator<T> &a, const QFrameArenaAllocator<U> &b) noexcept
+{ return a.arena() != b.arena(); }
+
+// Scratch container for use within a job's run()
+template<typename T>
+using QFrameVector = std::vector<T, QFrameArenaAllocator<T>>;
+
+} // Qt3DCore
+
+QT_END_NAMESPACE
+
+#endif // QT3DCORE_QFRAMEARENA_P_H
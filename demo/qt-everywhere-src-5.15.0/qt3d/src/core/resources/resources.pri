@@ -5,11 +5,13 @@ HEADERS += \
     $$PWD/qboundedcircularbuffer_p.h \
     $$PWD/qframeallocator_p.h \
     $$PWD/qframeallocator_p_p.h \
+    $$PWD/qframearena_p.h \
     $$PWD/qhandle_p.h
 
 SOURCES += \
     $$PWD/qresourcemanager.cpp \
-    $$PWD/qframeallocator.cpp
+    $$PWD/qframeallocator.cpp \
+    $$PWD/qframearena.cpp
 
 
 # Define proper SIMD flags for qresourcemanager.cpp
@@ -40,6 +40,7 @@
 #include "gltfgeometryloader.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
 #include <QtCore/QVersionNumber>
@@ -124,6 +125,7 @@ bool GLTFGeometryLoader::load(QIODevice *ioDev, const QString &subMesh)
 GLTFGeometryLoader::BufferData::BufferData()
     : length(0)
     , data(nullptr)
+    , file(nullptr)
 {
 }
 
@@ -131,6 +133,7 @@ GLTFGeometryLoader::BufferData::BufferData(const QJsonObject &json)
     : length(json.value(KEY_BYTE_LENGTH).toInt())
     , path(json.value(KEY_URI).toString())
     , data(nullptr)
+    , file(nullptr)
 {
 }
 
@@ -320,7 +323,7 @@ void GLTFGeometryLoader::processJSONBufferView(const QString &id, const QJsonObj
 
     const quint64 len = json.value(KEY_BYTE_LENGTH).toInt();
 
-    QByteArray bytes = bufferData.data->mid(offset, len);
+    QByteArray bytes = bufferViewData(bufferData, offset, len);
     if (Q_UNLIKELY(bytes.count() != int(len))) {
         qCWarning(GLTFGeometryLoaderLog, "failed to read sufficient bytes from: %ls for view %ls",
                   qUtf16PrintableImpl(bufferData.path), qUtf16PrintableImpl(id));
@@ -357,7 +360,7 @@ void GLTFGeometryLoader::processJSONBufferViewV2(const QJsonObject &json)
     }
 
     const quint64 len = json.value(KEY_BYTE_LENGTH).toInt();
-    QByteArray bytes = bufferData.data->mid(offset, len);
+    QByteArray bytes = bufferViewData(bufferData, offset, len);
     if (Q_UNLIKELY(bytes.count() != int(len))) {
         qCWarning(GLTFGeometryLoaderLog, "failed to read sufficient bytes from: %ls for view",
                   qUtf16PrintableImpl(bufferData.path));
@@ -539,45 +542,70 @@ void GLTFGeometryLoader::processJSONMeshV2(const QJsonObject &json)
 void GLTFGeometryLoader::loadBufferData()
 {
     for (auto &bufferData : m_gltf1.m_bufferDatas) {
-        if (!bufferData.data) {
-            bufferData.data = new QByteArray(resolveLocalData(bufferData.path));
-        }
+        if (!bufferData.data)
+            resolveLocalData(bufferData);
     }
 }
 
 void GLTFGeometryLoader::unloadBufferData()
 {
-    for (const auto &bufferData : qAsConst(m_gltf1.m_bufferDatas)) {
-        QByteArray *data = bufferData.data;
-        delete data;
-    }
+    for (auto &bufferData : m_gltf1.m_bufferDatas)
+        releaseLocalData(bufferData);
 }
 
 void GLTFGeometryLoader::loadBufferDataV2()
 {
     for (auto &bufferData : m_gltf2.m_bufferDatas) {
         if (!bufferData.data)
-            bufferData.data = new QByteArray(resolveLocalData(bufferData.path));
+            resolveLocalData(bufferData);
     }
 }
 
 void GLTFGeometryLoader::unloadBufferDataV2()
 {
-    for (const auto &bufferData : qAsConst(m_gltf2.m_bufferDatas)) {
-        QByteArray *data = bufferData.data;
-        delete data;
-    }
+    for (auto &bufferData : m_gltf2.m_bufferDatas)
+        releaseLocalData(bufferData);
 }
 
-QByteArray GLTFGeometryLoader::resolveLocalData(const QString &path) const
+void GLTFGeometryLoader::resolveLocalData(BufferData &bufferData) const
 {
     QDir d(m_basePath);
     Q_ASSERT(d.exists());
 
-    QString absPath = d.absoluteFilePath(path);
-    QFile f(absPath);
-    f.open(QIODevice::ReadOnly);
-    return f.readAll();
+    QString absPath = d.absoluteFilePath(bufferData.path);
+    QFile *f = new QFile(absPath);
+    f->open(QIODevice::ReadOnly);
+
+    // Map the file rather than reading it so that only the buffer views
+    // get copied to the heap, each of them ending up in its own QBuffer
+    const qint64 size = f->size();
+    const uchar *mapped = size > 0 ? f->map(0, size) : nullptr;
+    if (mapped) {
+        bufferData.data = new QByteArray(QByteArray::fromRawData(reinterpret_cast<const char *>(mapped),
+                                                                 int(size)));
+        bufferData.file = f;
+    } else {
+        bufferData.data = new QByteArray(f->readAll());
+        delete f;
+    }
+}
+
+void GLTFGeometryLoader::releaseLocalData(BufferData &bufferData)
+{
+    delete bufferData.data;
+    bufferData.data = nullptr;
+    // Unmaps the data
+    delete bufferData.file;
+    bufferData.file = nullptr;
+}
+
+QByteArray GLTFGeometryLoader::bufferViewData(const BufferData &bufferData, quint64 offset, quint64 length)
+{
+    // Always deep copy, the buffer data may be a mapping released after parsing
+    const quint64 size = quint64(bufferData.data->size());
+    if (offset >= size)
+        return QByteArray();
+    return QByteArray(bufferData.data->constData() + offset, int(qMin(length, size - offset)));
 }
 
 QAttribute::VertexBaseType GLTFGeometryLoader::accessorTypeFromJSON(int componentType)
@@ -61,6 +61,8 @@
 
 QT_BEGIN_NAMESPACE
 
+class QFile;
+
 namespace Qt3DRender {
 
 #define GLTFGEOMETRYLOADER_EXT QLatin1String("gltf")
@@ -90,6 +92,8 @@ class GLTFGeometryLoader : public QGeometryLoaderInterface
         quint64 length;
         QString path;
         QByteArray *data;
+        // Owns the file mapping data refers to, if any
+        QFile *file;
         // type if ever useful
     };
 
@@ -168,7 +172,9 @@ protected:
     void loadBufferDataV2();
     void unloadBufferDataV2();
 
-    QByteArray resolveLocalData(const QString &path) const;
+    void resolveLocalData(BufferData &bufferData) const;
+    static void releaseLocalData(BufferData &bufferData);
+    static QByteArray bufferViewData(const BufferData &bufferData, quint64 offset, quint64 length);
 
     static QAttribute::VertexBaseType accessorTypeFromJSON(int componentType);
     static uint accessorDataSizeFromJson(const QString &type);
@@ -73,9 +73,11 @@
 #include <submissioncontext_p.h>
 #include <glresourcemanagers_p.h>
 #include <Qt3DCore/qentity.h>
+#include <Qt3DCore/private/qframearena_p.h>
 #include <QtGui/qsurface.h>
 #include <algorithm>
 #include <atomic>
+#include <numeric>
 #include <gllights_p.h>
 #include <QDebug>
 #if defined(QT3D_RENDER_VIEW_JOB_TIMINGS)
@@ -326,27 +328,32 @@ struct AdjacentSubRangeFinder<QSortPolicy::Texture>
     }
 };
 
+// Sorting is done on indices into the commands rather than on the
+// RenderCommands themselves, which are expensive to copy around. The
+// commands are reordered once at the end of RenderView::sort.
+using CommandIndices = Qt3DCore::QFrameVector<int>;
+using IndexIt = CommandIndices::iterator;
+
 template<typename Predicate>
-int advanceUntilNonAdjacent(const QVector<RenderCommand> &commands,
+int advanceUntilNonAdjacent(const QVector<RenderCommand> &commands, const CommandIndices &indices,
                             const int beg, const int end, Predicate pred)
 {
+    const RenderCommand &first = commands.at(indices.at(beg));
     int i = beg + 1;
     while (i < end) {
-        if (!pred(*(commands.begin() + beg), *(commands.begin() + i)))
+        if (!pred(first, commands.at(indices.at(i))))
             break;
         ++i;
     }
     return i;
 }
 
-
-using CommandIt = QVector<RenderCommand>::iterator;
-
 template<int SortType>
 struct SubRangeSorter
 {
-    static void sortSubRange(CommandIt begin, const CommandIt end)
+    static void sortSubRange(const QVector<RenderCommand> &commands, IndexIt begin, const IndexIt end)
     {
+        Q_UNUSED(commands)
         Q_UNUSED(begin)
         Q_UNUSED(end)
         Q_UNREACHABLE();
@@ -356,10 +363,10 @@ struct SubRangeSorter
 template<>
 struct SubRangeSorter<QSortPolicy::StateChangeCost>
 {
-    static void sortSubRange(CommandIt begin, const CommandIt end)
+    static void sortSubRange(const QVector<RenderCommand> &commands, IndexIt begin, const IndexIt end)
     {
-        std::stable_sort(begin, end, [] (const RenderCommand &a, const RenderCommand &b) {
-            return a.m_changeCost > b.m_changeCost;
+        std::stable_sort(begin, end, [&commands] (const int &iA, const int &iB) {
+            return commands.at(iA).m_changeCost > commands.at(iB).m_changeCost;
         });
     }
 };
@@ -367,10 +374,10 @@ struct SubRangeSorter<QSortPolicy::StateChangeCost>
 template<>
 struct SubRangeSorter<QSortPolicy::BackToFront>
 {
-    static void sortSubRange(CommandIt begin, const CommandIt end)
+    static void sortSubRange(const QVector<RenderCommand> &commands, IndexIt begin, const IndexIt end)
     {
-        std::stable_sort(begin, end, [] (const RenderCommand &a, const RenderCommand &b) {
-            return a.m_depth > b.m_depth;
+        std::stable_sort(begin, end, [&commands] (const int &iA, const int &iB) {
+            return commands.at(iA).m_depth > commands.at(iB).m_depth;
         });
     }
 };
@@ -378,11 +385,11 @@ struct SubRangeSorter<QSortPolicy::BackToFront>
 template<>
 struct SubRangeSorter<QSortPolicy::Material>
 {
-    static void sortSubRange(CommandIt begin, const CommandIt end)
+    static void sortSubRange(const QVector<RenderCommand> &commands, IndexIt begin, const IndexIt end)
     {
         // First we sort by shader
-        std::stable_sort(begin, end, [] (const RenderCommand &a, const RenderCommand &b) {
-            return a.m_glShader > b.m_glShader;
+        std::stable_sort(begin, end, [&commands] (const int &iA, const int &iB) {
+            return commands.at(iA).m_glShader > commands.at(iB).m_glShader;
         });
     }
 };
@@ -390,10 +397,10 @@ struct SubRangeSorter<QSortPolicy::Material>
 template<>
 struct SubRangeSorter<QSortPolicy::FrontToBack>
 {
-    static void sortSubRange(CommandIt begin, const CommandIt end)
+    static void sortSubRange(const QVector<RenderCommand> &commands, IndexIt begin, const IndexIt end)
     {
-        std::stable_sort(begin, end, [] (const RenderCommand &a, const RenderCommand &b) {
-            return a.m_depth < b.m_depth;
+        std::stable_sort(begin, end, [&commands] (const int &iA, const int &iB) {
+            return commands.at(iA).m_depth < commands.at(iB).m_depth;
         });
     }
 };
@@ -401,12 +408,12 @@ struct SubRangeSorter<QSortPolicy::FrontToBack>
 template<>
 struct SubRangeSorter<QSortPolicy::Texture>
 {
-    static void sortSubRange(CommandIt begin, const CommandIt end)
+    static void sortSubRange(const QVector<RenderCommand> &commands, IndexIt begin, const IndexIt end)
     {
 #ifndef Q_OS_WIN
-        std::stable_sort(begin, end, [] (const RenderCommand &a, const RenderCommand &b) {
-            QVector<ShaderParameterPack::NamedResource> texturesA = a.m_parameterPack.textures();
-            QVector<ShaderParameterPack::NamedResource> texturesB = b.m_parameterPack.textures();
+        std::stable_sort(begin, end, [&commands] (const int &iA, const int &iB) {
+            QVector<ShaderParameterPack::NamedResource> texturesA = commands.at(iA).m_parameterPack.textures();
+            QVector<ShaderParameterPack::NamedResource> texturesB = commands.at(iB).m_parameterPack.textures();
 
             const int originalTextureASize = texturesA.size();
 
@@ -422,25 +429,29 @@ struct SubRangeSorter<QSortPolicy::Texture>
 
             return identicalTextureCount < originalTextureASize;
         });
+#else
+        Q_UNUSED(commands)
+        Q_UNUSED(begin)
+        Q_UNUSED(end)
 #endif
     }
 };
 
-int findSubRange(const QVector<RenderCommand> &commands,
+int findSubRange(const QVector<RenderCommand> &commands, const CommandIndices &indices,
                  const int begin, const int end,
                  const QSortPolicy::SortType sortType)
 {
     switch (sortType) {
     case QSortPolicy::StateChangeCost:
-        return advanceUntilNonAdjacent(commands, begin, end, AdjacentSubRangeFinder<QSortPolicy::StateChangeCost>::adjacentSubRange);
+        return advanceUntilNonAdjacent(commands, indices, begin, end, AdjacentSubRangeFinder<QSortPolicy::StateChangeCost>::adjacentSubRange);
     case QSortPolicy::BackToFront:
-        return advanceUntilNonAdjacent(commands, begin, end, AdjacentSubRangeFinder<QSortPolicy::BackToFront>::adjacentSubRange);
+        return advanceUntilNonAdjacent(commands, indices, begin, end, AdjacentSubRangeFinder<QSortPolicy::BackToFront>::adjacentSubRange);
     case QSortPolicy::Material:
-        return advanceUntilNonAdjacent(commands, begin, end, AdjacentSubRangeFinder<QSortPolicy::Material>::adjacentSubRange);
+        return advanceUntilNonAdjacent(commands, indices, begin, end, AdjacentSubRangeFinder<QSortPolicy::Material>::adjacentSubRange);
     case QSortPolicy::FrontToBack:
-        return advanceUntilNonAdjacent(commands, begin, end, AdjacentSubRangeFinder<QSortPolicy::FrontToBack>::adjacentSubRange);
+        return advanceUntilNonAdjacent(commands, indices, begin, end, AdjacentSubRangeFinder<QSortPolicy::FrontToBack>::adjacentSubRange);
     case QSortPolicy::Texture:
-        return advanceUntilNonAdjacent(commands, begin, end, AdjacentSubRangeFinder<QSortPolicy::Texture>::adjacentSubRange);
+        return advanceUntilNonAdjacent(commands, indices, begin, end, AdjacentSubRangeFinder<QSortPolicy::Texture>::adjacentSubRange);
     case QSortPolicy::Uniform:
         return end;
     default:
@@ -449,22 +460,23 @@ int findSubRange(const QVector<RenderCommand> &commands,
     }
 }
 
-void sortByMaterial(QVector<RenderCommand> &commands, int begin, const int end)
+void sortByMaterial(const QVector<RenderCommand> &commands, CommandIndices &indices, int begin, const int end)
 {
     // We try to arrange elements so that their rendering cost is minimized for a given shader
-    int rangeEnd = advanceUntilNonAdjacent(commands, begin, end, AdjacentSubRangeFinder<QSortPolicy::Material>::adjacentSubRange);
+    int rangeEnd = advanceUntilNonAdjacent(commands, indices, begin, end, AdjacentSubRangeFinder<QSortPolicy::Material>::adjacentSubRange);
     while (begin != end) {
         if (begin + 1 < rangeEnd) {
-            std::stable_sort(commands.begin() + begin + 1, commands.begin() + rangeEnd, [] (const RenderCommand &a, const RenderCommand &b){
-                return a.m_material.handle() < b.m_material.handle();
+            std::stable_sort(indices.begin() + begin + 1, indices.begin() + rangeEnd, [&commands] (const int &iA, const int &iB) {
+                return commands.at(iA).m_material.handle() < commands.at(iB).m_material.handle();
             });
         }
         begin = rangeEnd;
-        rangeEnd = advanceUntilNonAdjacent(commands, begin, end, AdjacentSubRangeFinder<QSortPolicy::Material>::adjacentSubRange);
+        rangeEnd = advanceUntilNonAdjacent(commands, indices, begin, end, AdjacentSubRangeFinder<QSortPolicy::Material>::adjacentSubRange);
     }
 }
 
-void sortCommandRange(QVector<RenderCommand> &commands, int begin, const int end, const int level,
+void sortCommandRange(const QVector<RenderCommand> &commands, CommandIndices &indices,
+                      int begin, const int end, const int level,
                       const QVector<Qt3DRender::QSortPolicy::SortType> &sortingTypes)
 {
     if (level >= sortingTypes.size())
@@ -472,22 +484,22 @@ void sortCommandRange(QVector<RenderCommand> &commands, int begin, const int end
 
     switch (sortingTypes.at(level)) {
     case QSortPolicy::StateChangeCost:
-        SubRangeSorter<QSortPolicy::StateChangeCost>::sortSubRange(commands.begin() + begin, commands.begin() + end);
+        SubRangeSorter<QSortPolicy::StateChangeCost>::sortSubRange(commands, indices.begin() + begin, indices.begin() + end);
         break;
     case QSortPolicy::BackToFront:
-        SubRangeSorter<QSortPolicy::BackToFront>::sortSubRange(commands.begin() + begin, commands.begin() + end);
+        SubRangeSorter<QSortPolicy::BackToFront>::sortSubRange(commands, indices.begin() + begin, indices.begin() + end);
         break;
     case QSortPolicy::Material:
         // Groups all same shader DNA together
-        SubRangeSorter<QSortPolicy::Material>::sortSubRange(commands.begin() + begin, commands.begin() + end);
+        SubRangeSorter<QSortPolicy::Material>::sortSubRange(commands, indices.begin() + begin, indices.begin() + end);
         // Group all same material together (same parameters most likely)
-        sortByMaterial(commands, begin, end);
+        sortByMaterial(commands, indices, begin, end);
         break;
     case QSortPolicy::FrontToBack:
-        SubRangeSorter<QSortPolicy::FrontToBack>::sortSubRange(commands.begin() + begin, commands.begin() + end);
+        SubRangeSorter<QSortPolicy::FrontToBack>::sortSubRange(commands, indices.begin() + begin, indices.begin() + end);
         break;
     case QSortPolicy::Texture:
-        SubRangeSorter<QSortPolicy::Texture>::sortSubRange(commands.begin() + begin, commands.begin() + end);
+        SubRangeSorter<QSortPolicy::Texture>::sortSubRange(commands, indices.begin() + begin, indices.begin() + end);
         break;
     case QSortPolicy::Uniform:
         break;
@@ -497,11 +509,11 @@ void sortCommandRange(QVector<RenderCommand> &commands, int begin, const int end
 
     // For all sub ranges of adjacent item for sortType[i]
     // Perform filtering with sortType[i + 1]
-    int rangeEnd = findSubRange(commands, begin, end, sortingTypes.at(level));
+    int rangeEnd = findSubRange(commands, indices, begin, end, sortingTypes.at(level));
     while (begin != end) {
-        sortCommandRange(commands, begin, rangeEnd, level + 1, sortingTypes);
+        sortCommandRange(commands, indices, begin, rangeEnd, level + 1, sortingTypes);
         begin = rangeEnd;
-        rangeEnd = findSubRange(commands, begin, end, sortingTypes.at(level));
+        rangeEnd = findSubRange(commands, indices, begin, end, sortingTypes.at(level));
     }
 }
 
@@ -511,7 +523,19 @@ void RenderView::sort()
 {
     // Compares the bitsetKey of the RenderCommands
     // Key[Depth | StateCost | Shader]
-    sortCommandRange(m_commands, 0, m_commands.size(), 0, m_data.m_sortingTypes);
+    const int commandCount = m_commands.size();
+    CommandIndices indices(commandCount);
+    std::iota(indices.begin(), indices.end(), 0);
+    sortCommandRange(qAsConst(m_commands), indices, 0, commandCount, 0, m_data.m_sortingTypes);
+
+    // Only reorder the commands themselves once
+    if (!std::is_sorted(indices.cbegin(), indices.cend())) {
+        QVector<RenderCommand> sortedCommands;
+        sortedCommands.reserve(commandCount);
+        for (const int index : qAsConst(indices))
+            sortedCommands.push_back(std::move(m_commands[index]));
+        m_commands = std::move(sortedCommands);
+    }
 
     // For RenderCommand with the same shader
     // We compute the adjacent change cost
@@ -539,7 +563,11 @@ void RenderView::sort()
                 // not the copy
                 PackUniformHash &uniforms = m_commands[j].m_parameterPack.m_uniforms;
 
-                for (int u = 0; u < uniforms.keys.size();) {
+                // Compact the uniforms in place rather than erasing them one
+                // by one, which shifts the remaining keys and values each time
+                const int uniformCount = uniforms.keys.size();
+                int kept = 0;
+                for (int u = 0; u < uniformCount; ++u) {
                     // We are comparing the values:
                     // - raw uniform values
                     // - the texture Node id if the uniform represents a texture
@@ -548,18 +576,28 @@ void RenderView::sort()
                     // where two uniforms, referencing the same texture eventually have 2 different
                     // texture unit values
                     const int uniformNameId = uniforms.keys.at(u);
-                    const UniformValue &refValue = cachedUniforms.value(uniformNameId);
                     const UniformValue &newValue = uniforms.values.at(u);
-                    if (newValue == refValue) {
-                        uniforms.erase(u);
+                    const int refIdx = cachedUniforms.keys.indexOf(uniformNameId);
+                    if (refIdx != -1 && newValue == cachedUniforms.values.at(refIdx))
+                        continue;
+
+                    // Record updated value so that subsequent comparison
+                    // for the next command will be made againts latest
+                    // uniform value
+                    if (refIdx != -1) {
+                        cachedUniforms.values[refIdx] = newValue;
                     } else {
-                        // Record updated value so that subsequent comparison
-                        // for the next command will be made againts latest
-                        // uniform value
-                        cachedUniforms.insert(uniformNameId, newValue);
-                        ++u;
+                        cachedUniforms.keys.push_back(uniformNameId);
+                        cachedUniforms.values.push_back(newValue);
+                    }
+                    if (kept != u) {
+                        uniforms.keys[kept] = uniformNameId;
+                        uniforms.values[kept] = uniforms.values.at(u);
                     }
+                    ++kept;
                 }
+                uniforms.keys.resize(kept);
+                uniforms.values.resize(kept);
                 ++j;
             }
         }
@@ -550,6 +550,7 @@ void RenderViewBuilder::prepareJobs()
 {
     // Init what we can here
     m_filterProximityJob->setManager(m_renderer->nodeManagers());
+    m_frustumCullingJob->setManagers(m_renderer->nodeManagers());
     m_frustumCullingJob->setRoot(m_renderer->sceneRoot());
 
     if (m_renderCommandCacheNeedsToBeRebuilt) {
@@ -758,9 +758,12 @@ void Renderer::doRender(bool swapBuffers)
                 }
             }
             // 2) Proceed to next frame and start preparing frame n + 1
+            // In low latency mode, this is delayed until frame n has been
+            // submitted so that frame n + 1 samples its input as late as possible
             m_renderQueue->reset();
             locker.unlock(); // Done protecting RenderQueue
-            m_vsyncFrameAdvanceService->proceedToNextFrame();
+            if (!m_lowLatency)
+                m_vsyncFrameAdvanceService->proceedToNextFrame();
             hasCleanedQueueAndProceeded = true;
 
             // Only try to submit the RenderViews if the preprocessing was successful
@@ -822,6 +825,9 @@ void Renderer::doRender(bool swapBuffers)
         if (mustCleanResources)
             cleanGraphicsResources();
     }
+
+    if (hasCleanedQueueAndProceeded && m_lowLatency)
+        m_vsyncFrameAdvanceService->proceedToNextFrame();
 }
 
 // Called by RenderViewJobs
@@ -409,6 +409,8 @@ private:
     QMetaObject::Connection m_contextConnection;
     RendererCache m_cache;
     bool m_shouldSwapBuffers;
+    // Start the next frame only once the current one has been submitted
+    const bool m_lowLatency = qEnvironmentVariableIntValue("QT3D_RENDER_LOW_LATENCY") > 0;
 
     QVector<FrameGraphNode *> m_frameGraphLeaves;
     QScreen *m_screen = nullptr;
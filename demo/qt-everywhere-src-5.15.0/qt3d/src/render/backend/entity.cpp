@@ -104,6 +104,7 @@ Entity::Entity()
     : BackendNode(*new EntityPrivate)
     , m_nodeManagers(nullptr)
     , m_boundingDirty(false)
+    , m_worldTransformDirty(true)
     , m_treeEnabled(true)
 {
 }
@@ -155,6 +156,7 @@ void Entity::cleanup()
     m_worldBoundingVolumeWithChildren.reset();
     m_parentHandle = {};
     m_boundingDirty = false;
+    m_worldTransformDirty = true;
     QBackendNode::setEnabled(false);
 
     // Ensure we rebuild caches when an Entity gets cleaned up
@@ -172,6 +174,7 @@ void Entity::setParentHandle(HEntity parentHandle)
     removeFromParentChildHandles();
 
     m_parentHandle = parentHandle;
+    m_worldTransformDirty = true;
     auto parent = m_nodeManagers->renderNodesManager()->data(parentHandle);
     if (parent != nullptr && !parent->m_childrenHandles.contains(m_handle))
         parent->m_childrenHandles.append(m_handle);
@@ -195,6 +198,7 @@ void Entity::syncFromFrontEnd(const QNode *frontEnd, bool firstTime)
 
     if (this->isEnabled() != node->isEnabled()) {
         markDirty(AbstractRenderer::EntityEnabledDirty);
+        m_worldTransformDirty = true;
         // We let QBackendNode::syncFromFrontEnd change the enabled property
     }
 
@@ -318,6 +322,7 @@ void Entity::addComponent(Qt3DCore::QNodeIdTypePair idAndType)
     qCDebug(Render::RenderNodes) << Q_FUNC_INFO << "id =" << id << type->className();
     if (type->inherits(&Qt3DCore::QTransform::staticMetaObject)) {
         m_transformComponent = id;
+        m_worldTransformDirty = true;
     } else if (type->inherits(&QCameraLens::staticMetaObject)) {
         m_cameraComponent = id;
     } else if (type->inherits(&QLayer::staticMetaObject)) {
@@ -355,6 +360,7 @@ void Entity::removeComponent(Qt3DCore::QNodeId nodeId)
 {
     if (m_transformComponent == nodeId) {
         m_transformComponent = QNodeId();
+        m_worldTransformDirty = true;
     } else if (m_cameraComponent == nodeId) {
         m_cameraComponent = QNodeId();
     } else if (m_layerComponents.contains(nodeId)) {
@@ -396,6 +402,16 @@ void Entity::unsetBoundingVolumeDirty()
     m_boundingDirty = false;
 }
 
+bool Entity::isWorldTransformDirty() const
+{
+    return m_worldTransformDirty;
+}
+
+void Entity::unsetWorldTransformDirty()
+{
+    m_worldTransformDirty = false;
+}
+
 void Entity::addRecursiveLayerId(const QNodeId layerId)
 {
     if (!m_recursiveLayerComponents.contains(layerId) && !m_layerComponents.contains(layerId))
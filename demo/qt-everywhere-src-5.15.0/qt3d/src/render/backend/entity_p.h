@@ -120,6 +120,11 @@ public:
     bool isBoundingVolumeDirty() const;
     void unsetBoundingVolumeDirty();
 
+    // true when the parent, enabled state or transform component changed and
+    // the world transform of the whole subtree needs to be recomputed
+    bool isWorldTransformDirty() const;
+    void unsetWorldTransformDirty();
+
     void setTreeEnabled(bool enabled) { m_treeEnabled = enabled; }
     bool isTreeEnabled() const { return m_treeEnabled; }
 
@@ -211,6 +216,7 @@ private:
 
     QString m_objectName;
     bool m_boundingDirty;
+    bool m_worldTransformDirty;
     // true only if this and all parent nodes are enabled
     bool m_treeEnabled;
 };
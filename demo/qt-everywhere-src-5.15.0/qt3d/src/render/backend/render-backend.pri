@@ -20,6 +20,7 @@ HEADERS += \
     $$PWD/boundingvolumedebug_p.h \
     $$PWD/nodemanagers_p.h \
     $$PWD/triangleboundingvolume_p.h \
+    $$PWD/trianglebvh_p.h \
     $$PWD/trianglesextractor_p.h \
     $$PWD/buffervisitor_p.h \
     $$PWD/bufferutils_p.h \
@@ -54,6 +55,7 @@ SOURCES += \
     $$PWD/boundingvolumedebug.cpp \
     $$PWD/nodemanagers.cpp \
     $$PWD/triangleboundingvolume.cpp \
+    $$PWD/trianglebvh.cpp \
     $$PWD/trianglesextractor.cpp \
     $$PWD/trianglesvisitor.cpp \
     $$PWD/computecommand.cpp \
@@ -55,6 +55,7 @@ Transform::Transform()
     , m_rotation()
     , m_scale(1.0f, 1.0f, 1.0f)
     , m_translation()
+    , m_transformDirty(true)
 {
 }
 
@@ -64,6 +65,7 @@ void Transform::cleanup()
     m_scale = QVector3D();
     m_translation = QVector3D();
     m_transformMatrix = Matrix4x4();
+    m_transformDirty = true;
     QBackendNode::setEnabled(false);
 }
 
@@ -87,6 +89,16 @@ QVector3D Transform::translation() const
     return m_translation;
 }
 
+bool Transform::isTransformDirty() const
+{
+    return m_transformDirty;
+}
+
+void Transform::unsetTransformDirty()
+{
+    m_transformDirty = false;
+}
+
 void Transform::syncFromFrontEnd(const QNode *frontEnd, bool firstTime)
 {
     const Qt3DCore::QTransform *transform = qobject_cast<const Qt3DCore::QTransform *>(frontEnd);
@@ -102,11 +114,14 @@ void Transform::syncFromFrontEnd(const QNode *frontEnd, bool firstTime)
 
     if (dirty || firstTime) {
         updateMatrix();
+        m_transformDirty = true;
         markDirty(AbstractRenderer::TransformDirty);
     }
 
-    if (transform->isEnabled() != isEnabled())
+    if (transform->isEnabled() != isEnabled()) {
+        m_transformDirty = true;
         markDirty(AbstractRenderer::TransformDirty);
+    }
 
     BackendNode::syncFromFrontEnd(frontEnd, firstTime);
 }
@@ -76,6 +76,11 @@ public:
     QQuaternion rotation() const;
     QVector3D translation() const;
 
+    // true when the matrix or enabled state changed since the last world
+    // transform update of the entities referencing this transform
+    bool isTransformDirty() const;
+    void unsetTransformDirty();
+
     void syncFromFrontEnd(const Qt3DCore::QNode *frontEnd, bool firstTime) final;
 
 private:
@@ -84,6 +89,7 @@ private:
     QQuaternion m_rotation;
     QVector3D m_scale;
     QVector3D m_translation;
+    bool m_transformDirty;
 };
 
 } // namespace Render
@@ -0,0 +1,228 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "trianglebvh_p.h"
+#include <Qt3DRender/private/trianglesvisitor_p.h>
+#include <Qt3DRender/private/geometryrenderer_p.h>
+
+#include <QVarLengthArray>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+namespace Render {
+
+namespace {
+
+const int MaxTrianglesPerLeaf = 4;
+
+class TriangleGatherer : public TrianglesVisitor
+{
+public:
+    explicit TriangleGatherer(NodeManagers *manager)
+        : TrianglesVisitor(manager)
+    {
+    }
+
+    QVector<TriangleBvh::Triangle> triangles;
+
+private:
+    void visit(uint andx, const Vector3D &a,
+               uint bndx, const Vector3D &b,
+               uint cndx, const Vector3D &c) override
+    {
+        const uint index = uint(triangles.size());
+        triangles.push_back({ a, b, c, andx, bndx, cndx, index });
+    }
+};
+
+// Three times the centroid, only used for ordering
+inline float centroid(const TriangleBvh::Triangle &t, int axis)
+{
+    return t.a[axis] + t.b[axis] + t.c[axis];
+}
+
+// Slab test of the segment origin + t * delta, t in [0, 1]
+bool segmentIntersectsBox(const float *origin, const float *delta,
+                          const float *min, const float *max)
+{
+    float tMin = 0.0f;
+    float tMax = 1.0f;
+    for (int i = 0; i < 3; ++i) {
+        if (delta[i] == 0.0f) {
+            if (origin[i] < min[i] || origin[i] > max[i])
+                return false;
+            continue;
+        }
+        const float invDelta = 1.0f / delta[i];
+        float t1 = (min[i] - origin[i]) * invDelta;
+        float t2 = (max[i] - origin[i]) * invDelta;
+        if (t1 > t2)
+            std::swap(t1, t2);
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+        if (tMin > tMax)
+            return false;
+    }
+    return true;
+}
+
+} // anonymous
+
+TriangleBvh::TriangleBvh()
+{
+}
+
+TriangleBvh::TriangleBvh(QVector<Triangle> triangles)
+    : m_triangles(std::move(triangles))
+{
+    if (m_triangles.isEmpty())
+        return;
+    m_nodes.reserve(2 * (m_triangles.size() / MaxTrianglesPerLeaf + 1));
+    build(0, m_triangles.size());
+}
+
+QSharedPointer<TriangleBvh> TriangleBvh::fromGeometryRenderer(const GeometryRenderer *renderer,
+                                                              NodeManagers *manager)
+{
+    TriangleGatherer gatherer(manager);
+    gatherer.apply(renderer, renderer->peerId());
+    return QSharedPointer<TriangleBvh>::create(std::move(gatherer.triangles));
+}
+
+int TriangleBvh::build(int begin, int end)
+{
+    const int nodeIndex = m_nodes.size();
+    m_nodes.push_back(Node());
+
+    Node node;
+    float centroidMin[3];
+    float centroidMax[3];
+    for (int i = 0; i < 3; ++i) {
+        node.min[i] = centroidMin[i] = std::numeric_limits<float>::max();
+        node.max[i] = centroidMax[i] = -std::numeric_limits<float>::max();
+    }
+
+    Triangle *triangles = m_triangles.data();
+    for (int t = begin; t < end; ++t) {
+        const Triangle &triangle = triangles[t];
+        for (int i = 0; i < 3; ++i) {
+            node.min[i] = std::min({ node.min[i], triangle.a[i], triangle.b[i], triangle.c[i] });
+            node.max[i] = std::max({ node.max[i], triangle.a[i], triangle.b[i], triangle.c[i] });
+            const float c = centroid(triangle, i);
+            centroidMin[i] = std::min(centroidMin[i], c);
+            centroidMax[i] = std::max(centroidMax[i], c);
+        }
+    }
+
+    // Grow the bounds slightly so that the box test, done in model space,
+    // never rejects a triangle that the triangle test done in world space
+    // would have hit on one of its edges
+    for (int i = 0; i < 3; ++i) {
+        const float pad = (std::abs(node.min[i]) + std::abs(node.max[i])) * 1.0e-5f
+                + std::numeric_limits<float>::min();
+        node.min[i] -= pad;
+        node.max[i] += pad;
+    }
+
+    if (end - begin <= MaxTrianglesPerLeaf) {
+        node.first = begin;
+        node.count = end - begin;
+        m_nodes[nodeIndex] = node;
+        return nodeIndex;
+    }
+
+    int axis = 0;
+    for (int i = 1; i < 3; ++i) {
+        if (centroidMax[i] - centroidMin[i] > centroidMax[axis] - centroidMin[axis])
+            axis = i;
+    }
+
+    const int middle = begin + (end - begin) / 2;
+    std::nth_element(triangles + begin, triangles + middle, triangles + end,
+                     [axis] (const Triangle &t1, const Triangle &t2) {
+        return centroid(t1, axis) < centroid(t2, axis);
+    });
+
+    node.count = 0;
+    m_nodes[nodeIndex] = node;
+    build(begin, middle);
+    const int right = build(middle, end);
+    m_nodes[nodeIndex].first = right;
+    return nodeIndex;
+}
+
+void TriangleBvh::intersectingTriangles(const Vector3D &start, const Vector3D &end,
+                                        QVector<int> &candidates) const
+{
+    if (m_nodes.isEmpty())
+        return;
+
+    const float origin[3] = { start[0], start[1], start[2] };
+    const float delta[3] = { end[0] - start[0], end[1] - start[1], end[2] - start[2] };
+
+    QVarLengthArray<int, 64> stack;
+    stack.push_back(0);
+    while (!stack.isEmpty()) {
+        const Node &node = m_nodes.at(stack.last());
+        stack.removeLast();
+        if (!segmentIntersectsBox(origin, delta, node.min, node.max))
+            continue;
+
+        if (node.count > 0) {
+            for (int i = node.first, last = node.first + node.count; i < last; ++i)
+                candidates.push_back(i);
+        } else {
+            const int left = int(&node - m_nodes.constData()) + 1;
+            stack.push_back(node.first);
+            stack.push_back(left);
+        }
+    }
+}
+
+} // namespace Render
+
+} // namespace Qt3DRender
+
+QT_END_NAMESPACE
@@ -0,0 +1,124 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QT3DRENDER_RENDER_TRIANGLEBVH_P_H
+#define QT3DRENDER_RENDER_TRIANGLEBVH_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <Qt3DCore/private/vector3d_p.h>
+#include <private/qt3drender_global_p.h>
+
+#include <QSharedPointer>
+#include <QVector>
+
+QT_BEGIN_NAMESPACE
+
+namespace Qt3DRender {
+
+namespace Render {
+
+class GeometryRenderer;
+class NodeManagers;
+
+// Bounding volume hierarchy over the triangles of a geometry, in model
+// space. Used to restrict triangle picking to the triangles whose bounds
+// are crossed by the picking segment.
+class Q_AUTOTEST_EXPORT TriangleBvh
+{
+public:
+    struct Triangle
+    {
+        Vector3D a;
+        Vector3D b;
+        Vector3D c;
+        uint andx;
+        uint bndx;
+        uint cndx;
+        uint index;
+    };
+
+    TriangleBvh();
+    explicit TriangleBvh(QVector<Triangle> triangles);
+
+    static QSharedPointer<TriangleBvh> fromGeometryRenderer(const GeometryRenderer *renderer,
+                                                            NodeManagers *manager);
+
+    const QVector<Triangle> &triangles() const { return m_triangles; }
+    int nodeCount() const { return m_nodes.size(); }
+
+    // Appends to candidates the offsets in triangles() of the triangles
+    // whose leaf bounds intersect the segment [start, end]
+    void intersectingTriangles(const Vector3D &start, const Vector3D &end,
+                               QVector<int> &candidates) const;
+
+private:
+    struct Node
+    {
+        float min[3];
+        float max[3];
+        // Leaves reference count triangles from first, inner nodes have
+        // count == 0, their left child following them and first being
+        // the index of the right child
+        int first;
+        int count;
+    };
+
+    int build(int begin, int end);
+
+    QVector<Triangle> m_triangles;
+    QVector<Node> m_nodes;
+};
+
+} // namespace Render
+
+} // namespace Qt3DRender
+
+QT_END_NAMESPACE
+
+#endif // QT3DRENDER_RENDER_TRIANGLEBVH_P_H
@@ -42,6 +42,7 @@
 #include <Qt3DRender/private/qboundingvolume_p.h>
 #include <Qt3DRender/private/qgeometryrenderer_p.h>
 #include <Qt3DRender/private/qmesh_p.h>
+#include <Qt3DRender/private/trianglebvh_p.h>
 #include <Qt3DCore/qpropertyupdatedchange.h>
 #include <Qt3DCore/private/qnode_p.h>
 #include <Qt3DCore/private/qtypedpropertyupdatechange_p.h>
@@ -96,6 +97,7 @@ void GeometryRenderer::cleanup()
     m_geometryFactory.reset();
     qDeleteAll(m_triangleVolumes);
     m_triangleVolumes.clear();
+    invalidateTriangleBvh();
 }
 
 void GeometryRenderer::setManager(GeometryRendererManager *manager)
@@ -151,6 +153,9 @@ void GeometryRenderer::syncFromFrontEnd(const QNode *frontEnd, bool firstTime)
         }
     }
 
+    if (m_dirty)
+        invalidateTriangleBvh();
+
     markDirty(AbstractRenderer::GeometryDirty);
 }
 
@@ -213,6 +218,21 @@ QVector<RayCasting::QBoundingVolume *> GeometryRenderer::triangleData() const
     return m_triangleVolumes;
 }
 
+QSharedPointer<TriangleBvh> GeometryRenderer::triangleBvh(NodeManagers *manager)
+{
+    // Entities sharing this renderer can be picked concurrently
+    QMutexLocker lock(&m_triangleBvhMutex);
+    if (!m_triangleBvh)
+        m_triangleBvh = TriangleBvh::fromGeometryRenderer(this, manager);
+    return m_triangleBvh;
+}
+
+void GeometryRenderer::invalidateTriangleBvh()
+{
+    QMutexLocker lock(&m_triangleBvhMutex);
+    m_triangleBvh.reset();
+}
+
 GeometryRendererFunctor::GeometryRendererFunctor(AbstractRenderer *renderer, GeometryRendererManager *manager)
     : m_manager(manager)
     , m_renderer(renderer)
@@ -55,6 +55,7 @@
 #include <Qt3DRender/qgeometryrenderer.h>
 #include <Qt3DRender/qgeometryfactory.h>
 #include <Qt3DRender/qmesh.h>
+#include <QMutex>
 
 QT_BEGIN_NAMESPACE
 
@@ -66,6 +67,8 @@ class QBoundingVolume;
 namespace Render {
 
 class GeometryRendererManager;
+class NodeManagers;
+class TriangleBvh;
 
 struct GeometryFunctorResult
 {
@@ -104,6 +107,11 @@ public:
     // Pick volumes job
     QVector<RayCasting::QBoundingVolume *> triangleData() const;
 
+    // Picking jobs, built on first use after each invalidation
+    QSharedPointer<TriangleBvh> triangleBvh(NodeManagers *manager);
+    // Bounding volume job, when positions or indices changed
+    void invalidateTriangleBvh();
+
 private:
     Qt3DCore::QNodeId m_geometryId;
     int m_instanceCount;
@@ -120,6 +128,8 @@ private:
     QGeometryFactoryPtr m_geometryFactory;
     GeometryRendererManager *m_manager;
     QVector<RayCasting::QBoundingVolume *> m_triangleVolumes;
+    QMutex m_triangleBvhMutex;
+    QSharedPointer<TriangleBvh> m_triangleBvh;
 };
 
 class GeometryRendererFunctor : public Qt3DCore::QBackendNodeMapper
@@ -53,6 +53,7 @@
 #include <Qt3DRender/private/buffervisitor_p.h>
 #include <Qt3DRender/private/entityvisitor_p.h>
 #include <Qt3DCore/private/qaspectmanager_p.h>
+#include <Qt3DCore/private/qframearena_p.h>
 
 #include <QtCore/qmath.h>
 #if QT_CONFIG(concurrent)
@@ -217,6 +218,7 @@ private:
 
 struct BoundingVolumeComputeData {
     Entity *entity = nullptr;
+    GeometryRenderer *geometryRenderer = nullptr;
     Geometry *geometry = nullptr;
     Attribute *positionAttribute = nullptr;
     Attribute *indexAttribute = nullptr;
@@ -317,6 +319,7 @@ BoundingVolumeComputeData findBoundingVolumeComputeData(NodeManagers *manager, E
         || (indexBuf && indexBuf->isDirty())) {
         BoundingVolumeComputeData res;
         res.entity = node;
+        res.geometryRenderer = gRenderer;
         res.geometry = geom;
         res.positionAttribute = positionAttribute;
         res.indexAttribute = indexAttribute;
@@ -336,6 +339,9 @@ QVector<Geometry *> calculateLocalBoundingVolume(NodeManagers *manager, const Bo
 
     QVector<Geometry *> updatedGeometries;
 
+    // Triangles used for picking are rebuilt on the next pick
+    data.geometryRenderer->invalidateTriangleBvh();
+
     BoundingVolumeCalculator reader(manager);
     if (reader.apply(data.positionAttribute, data.indexAttribute, data.vertexCount,
                      data.primitiveRestartEnabled, data.primitiveRestartIndex)) {
@@ -390,7 +396,7 @@ public:
         return Continue;
     }
 
-    std::vector<BoundingVolumeComputeData> m_entities;
+    Qt3DCore::QFrameVector<BoundingVolumeComputeData> m_entities;
 };
 
 } // anonymous
@@ -407,7 +413,7 @@ void CalculateBoundingVolumeJob::run()
     DirtyEntityAccumulator accumulator(m_manager);
     accumulator.apply(m_node);
 
-    std::vector<BoundingVolumeComputeData> entities = std::move(accumulator.m_entities);
+    Qt3DCore::QFrameVector<BoundingVolumeComputeData> entities = std::move(accumulator.m_entities);
 
     QVector<Geometry *> updatedGeometries;
     updatedGeometries.reserve(entities.size());
@@ -77,33 +77,40 @@ void FrustumCullingJob::run()
         Plane(m_viewProjection.row(3) - m_viewProjection.row(2)), // Back
     };
 
-    cullScene(m_root, planes);
+    cullScene(m_root, planes, false);
 
     // sort needed for set_intersection in RenderViewBuilder
     std::sort(m_visibleEntities.begin(), m_visibleEntities.end());
 }
 
-void FrustumCullingJob::cullScene(Entity *e, const Plane *planes)
+void FrustumCullingJob::cullScene(Entity *e, const Plane *planes, bool fullyInside)
 {
-    e->traverse([planes, this](Entity *e) {
+    // worldBoundingVolumeWithChildren encloses the volumes of all enabled
+    // descendants: a subtree outside of one plane can be skipped entirely and
+    // one inside of all planes needs no further tests
+    if (!fullyInside) {
         const Sphere *s = e->worldBoundingVolumeWithChildren();
-
-        // Unrolled loop
-        if (Vector3D::dotProduct(s->center(), planes[0].normal) + planes[0].d < -s->radius())
-            return;
-        if (Vector3D::dotProduct(s->center(), planes[1].normal) + planes[1].d < -s->radius())
-            return;
-        if (Vector3D::dotProduct(s->center(), planes[2].normal) + planes[2].d < -s->radius())
-            return;
-        if (Vector3D::dotProduct(s->center(), planes[3].normal) + planes[3].d < -s->radius())
-            return;
-        if (Vector3D::dotProduct(s->center(), planes[4].normal) + planes[4].d < -s->radius())
-            return;
-        if (Vector3D::dotProduct(s->center(), planes[5].normal) + planes[5].d < -s->radius())
-            return;
-
-        m_visibleEntities.push_back(e);
-    });
+        const Vector3D center = s->center();
+        const float radius = s->radius();
+        bool intersects = false;
+
+        for (int i = 0; i < 6; ++i) {
+            const float distance = Vector3D::dotProduct(center, planes[i].normal) + planes[i].d;
+            if (distance < -radius)
+                return;
+            intersects |= distance < radius;
+        }
+        fullyInside = !intersects;
+    }
+
+    m_visibleEntities.push_back(e);
+
+    const auto childrenHandles = e->childrenHandles();
+    for (const HEntity &handle : childrenHandles) {
+        Entity *child = m_manager->renderNodesManager()->data(handle);
+        if (child != nullptr)
+            cullScene(child, planes, fullyInside);
+    }
 }
 
 } // Render
@@ -45,6 +45,7 @@
 #include <Qt3DRender/private/viewportnode_p.h>
 #include <Qt3DRender/private/rendersurfaceselector_p.h>
 #include <Qt3DRender/private/triangleboundingvolume_p.h>
+#include <Qt3DRender/private/trianglebvh_p.h>
 #include <Qt3DRender/private/nodemanagers_p.h>
 #include <Qt3DRender/private/sphere_p.h>
 #include <Qt3DRender/private/entity_p.h>
@@ -157,6 +158,10 @@ public:
     {
     }
 
+    void visitTriangle(uint index, uint andx, const Vector3D &a,
+                       uint bndx, const Vector3D &b,
+                       uint cndx, const Vector3D &c);
+
 private:
     const Entity *m_root;
     RayCasting::QRay3D m_ray;
@@ -174,6 +179,13 @@ private:
 
 void TriangleCollisionVisitor::visit(uint andx, const Vector3D &a, uint bndx, const Vector3D &b, uint cndx, const Vector3D &c)
 {
+    visitTriangle(m_triangleIndex++, andx, a, bndx, b, cndx, c);
+}
+
+void TriangleCollisionVisitor::visitTriangle(uint index, uint andx, const Vector3D &a, uint bndx, const Vector3D &b, uint cndx, const Vector3D &c)
+{
+    m_triangleIndex = index;
+
     const Matrix4x4 &mat = *m_root->worldTransform();
     const Vector3D tA = mat * a;
     const Vector3D tB = mat * b;
@@ -184,8 +196,6 @@ void TriangleCollisionVisitor::visit(uint andx, const Vector3D &a, uint bndx, co
     if (!intersected && m_backFaceRequested) {
         intersected = intersectsSegmentTriangle(andx, tA, bndx, tB, cndx, tC);    // back facing
     }
-
-    m_triangleIndex++;
 }
 
 
@@ -593,7 +603,27 @@ HitList TriangleCollisionGathererFunctor::pick(const Entity *entity) const
 
     if (rayHitsEntity(entity)) {
         TriangleCollisionVisitor visitor(m_manager, entity, m_ray, m_frontFaceRequested, m_backFaceRequested);
-        visitor.apply(gRenderer, entity->peerId());
+
+        // Only test the triangles whose model space bounds are crossed by the
+        // picking segment; triangles are still tested in world space
+        bool invertible = false;
+        const QMatrix4x4 worldToModel = convertToQMatrix4x4(*entity->worldTransform()).inverted(&invertible);
+        if (invertible) {
+            const Matrix4x4 inverse(worldToModel);
+            const Vector3D start = inverse * m_ray.origin();
+            const Vector3D end = inverse * m_ray.point(m_ray.distance());
+            const QSharedPointer<TriangleBvh> bvh = gRenderer->triangleBvh(m_manager);
+
+            QVector<int> candidates;
+            bvh->intersectingTriangles(start, end, candidates);
+            const QVector<TriangleBvh::Triangle> &triangles = bvh->triangles();
+            for (const int candidate : qAsConst(candidates)) {
+                const TriangleBvh::Triangle &t = triangles.at(candidate);
+                visitor.visitTriangle(t.index, t.andx, t.a, t.bndx, t.b, t.cndx, t.c);
+            }
+        } else {
+            visitor.apply(gRenderer, entity->peerId());
+        }
         result = visitor.hits;
 
         sortHits(result);
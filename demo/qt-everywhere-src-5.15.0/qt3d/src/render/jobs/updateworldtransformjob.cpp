@@ -42,6 +42,7 @@
 #include <Qt3DCore/qtransform.h>
 #include <Qt3DCore/private/qtransform_p.h>
 #include <Qt3DCore/private/qaspectmanager_p.h>
+#include <Qt3DCore/private/qframearena_p.h>
 #include <Qt3DRender/private/entity_p.h>
 #include <Qt3DRender/private/transform_p.h>
 #include <Qt3DRender/private/renderlogging_p.h>
@@ -64,29 +65,52 @@ struct TransformUpdate
     QMatrix4x4 worldTransformMatrix;
 };
 
-void updateWorldTransformAndBounds(NodeManagers *manager, Entity *node, const Matrix4x4 &parentTransform, QVector<TransformUpdate> &updatedTransforms)
+// parentDirty is set when the world transform of the parent changed, force
+// when an ancestor was reparented, re-enabled or had its transform component
+// swapped. Subtrees where neither holds and no local transform changed keep
+// their current world transforms and are only walked through.
+void updateWorldTransformAndBounds(NodeManagers *manager, Entity *node, const Matrix4x4 &parentTransform,
+                                   bool parentDirty, bool force,
+                                   QVector<TransformUpdate> &updatedTransforms,
+                                   Qt3DCore::QFrameVector<Transform *> &dirtyTransforms)
 {
     if (!node->isEnabled())
         return;
 
-    Matrix4x4 worldTransform(parentTransform);
-    Transform *nodeTransform = node->renderComponent<Transform>();
+    force |= node->isWorldTransformDirty();
+    node->unsetWorldTransformDirty();
 
+    Transform *nodeTransform = node->renderComponent<Transform>();
     const bool hasTransformComponent = nodeTransform != nullptr && nodeTransform->isEnabled();
-    if (hasTransformComponent)
-        worldTransform = worldTransform * nodeTransform->transformMatrix();
+    bool localDirty = false;
+    if (nodeTransform != nullptr && nodeTransform->isTransformDirty()) {
+        // Transforms can be shared between entities, only reset them once
+        // the whole tree has been traversed
+        dirtyTransforms.push_back(nodeTransform);
+        localDirty = true;
+    }
 
-    if (*(node->worldTransform()) != worldTransform) {
-        *(node->worldTransform()) = worldTransform;
+    bool worldChanged = false;
+    if (force || parentDirty || localDirty) {
+        Matrix4x4 worldTransform(parentTransform);
         if (hasTransformComponent)
-            updatedTransforms.push_back({nodeTransform->peerId(), convertToQMatrix4x4(worldTransform)});
+            worldTransform = worldTransform * nodeTransform->transformMatrix();
+
+        if (*(node->worldTransform()) != worldTransform) {
+            *(node->worldTransform()) = worldTransform;
+            worldChanged = true;
+            if (hasTransformComponent)
+                updatedTransforms.push_back({nodeTransform->peerId(), convertToQMatrix4x4(worldTransform)});
+        }
     }
 
+    const Matrix4x4 &worldTransform = *(node->worldTransform());
     const auto childrenHandles = node->childrenHandles();
     for (const HEntity &handle : childrenHandles) {
         Entity *child = manager->renderNodesManager()->data(handle);
         if (child)
-            updateWorldTransformAndBounds(manager, child, worldTransform, updatedTransforms);
+            updateWorldTransformAndBounds(manager, child, worldTransform, worldChanged, force,
+                                          updatedTransforms, dirtyTransforms);
     }
 }
 
@@ -137,7 +161,11 @@ void UpdateWorldTransformJob::run()
     Entity *parent = m_node->parent();
     if (parent != nullptr)
         parentTransform = *(parent->worldTransform());
-    updateWorldTransformAndBounds(m_manager, m_node, parentTransform, d->m_updatedTransforms);
+    Qt3DCore::QFrameVector<Transform *> dirtyTransforms;
+    updateWorldTransformAndBounds(m_manager, m_node, parentTransform, false, false,
+                                  d->m_updatedTransforms, dirtyTransforms);
+    for (Transform *transform : qAsConst(dirtyTransforms))
+        transform->unsetTransformDirty();
 
     qCDebug(Jobs) << "Exiting" << Q_FUNC_INFO << QThread::currentThread();
 }
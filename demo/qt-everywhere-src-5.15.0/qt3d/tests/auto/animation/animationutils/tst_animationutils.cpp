@@ -45,6 +45,8 @@
 #include <QtGui/qcolor.h>
 #include <QtCore/qbitarray.h>
 
+#include <limits>
+
 #include <qbackendnodetester.h>
 #include <testpostmanarbiter.h>
 
@@ -1310,6 +1312,16 @@ private Q_SLOTS:
             QVERIFY(fuzzyCompare(actual, expected) == true);
         }
 
+        // WHEN
+        KeyframeCursors cursors(clip->channelCount(), std::numeric_limits<int>::max());
+        const ClipResults resultsWithCursors = evaluateClipAtLocalTime(clip, localTime, &cursors);
+        const ClipResults resultsWithWarmCursors = evaluateClipAtLocalTime(clip, localTime, &cursors);
+
+        // THEN
+        QCOMPARE(cursors.size(), clip->channelCount());
+        QCOMPARE(resultsWithCursors, actualResults);
+        QCOMPARE(resultsWithWarmCursors, actualResults);
+
         // Cleanup
         delete handler;
     }
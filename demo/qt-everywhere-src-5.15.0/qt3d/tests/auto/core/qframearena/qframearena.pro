@@ -0,0 +1,7 @@
+TARGET = tst_qframearena
+CONFIG += testcase
+TEMPLATE = app
+
+SOURCES += tst_qframearena.cpp
+
+QT += testlib 3dcore 3dcore-private
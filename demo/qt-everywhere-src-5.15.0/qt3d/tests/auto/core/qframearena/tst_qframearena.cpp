@@ -0,0 +1,121 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <Qt3DCore/private/qframearena_p.h>
+
+using namespace Qt3DCore;
+
+class tst_QFrameArena : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void checkAlignment()
+    {
+        // GIVEN
+        QFrameArena arena(256);
+
+        // WHEN
+        arena.allocate(1, 1);
+        void *p = arena.allocate(sizeof(double), alignof(double));
+
+        // THEN
+        QCOMPARE(quintptr(p) % alignof(double), quintptr(0));
+        QVERIFY(arena.usedBytes() >= 1 + sizeof(double));
+    }
+
+    void checkOversizedAllocation()
+    {
+        // GIVEN
+        QFrameArena arena(64);
+
+        // WHEN
+        char *p = static_cast<char *>(arena.allocate(1024));
+
+        // THEN
+        QVERIFY(p != nullptr);
+        QVERIFY(arena.capacity() >= 1024);
+        memset(p, 0, 1024);
+    }
+
+    void checkResetReusesMemory()
+    {
+        // GIVEN
+        QFrameArena arena(128);
+        for (int i = 0; i < 16; ++i)
+            arena.allocate(100);
+        const size_t used = arena.usedBytes();
+
+        // WHEN
+        arena.reset();
+
+        // THEN
+        QCOMPARE(arena.usedBytes(), size_t(0));
+        QCOMPARE(arena.highWaterMark(), used);
+        QVERIFY(arena.capacity() >= used);
+
+        // WHEN
+        const size_t capacity = arena.capacity();
+        for (int i = 0; i < 16; ++i)
+            arena.allocate(100);
+
+        // THEN
+        QCOMPARE(arena.capacity(), capacity);
+    }
+
+    void checkFrameVector()
+    {
+        // GIVEN
+        QFrameVector<int> v;
+
+        // WHEN
+        for (int i = 0; i < 1000; ++i)
+            v.push_back(i);
+
+        // THEN
+        QCOMPARE(v.get_allocator().arena(), QFrameArena::currentThreadArena());
+        for (int i = 0; i < 1000; ++i)
+            QCOMPARE(v[i], i);
+        QVERIFY(QFrameArena::currentThreadArena()->usedBytes() >= 1000 * sizeof(int));
+
+        // WHEN
+        v = QFrameVector<int>();
+        QFrameArena::resetAll();
+
+        // THEN
+        QCOMPARE(QFrameArena::currentThreadArena()->usedBytes(), size_t(0));
+        QVERIFY(QFrameArena::lastFrameUsedBytes() >= 1000 * sizeof(int));
+        QVERIFY(QFrameArena::frameHighWaterMark() >= QFrameArena::lastFrameUsedBytes());
+    }
+};
+
+QTEST_APPLESS_MAIN(tst_QFrameArena)
+
+#include "tst_qframearena.moc"
@@ -65,6 +65,7 @@ private Q_SLOTS:
     void defaultAspectQueue();
     void doubleAspectQueue();
     void dependencyAspectQueue();
+    void dependencyChain();
     void massTest();
     void perThreadUniqueCall();
 };
@@ -167,6 +168,11 @@ void multiplyBy2(QAtomicInt *counter, int *value)
     *value = *value * 2;
 }
 
+void recordRunOrder(QAtomicInt *counter, int *value)
+{
+    *value = counter->fetchAndAddOrdered(1);
+}
+
 void massTestFunction(QVector3D *data)
 {
     QVector3D point(4.5f, 4.5f, 4.5f);
@@ -285,6 +291,50 @@ void tst_ThreadPooler::dependencyAspectQueue()
     QVERIFY(value == 8);
 }
 
+/*
+ * Jobs that become ready when another job finishes may be run straight away
+ * on the same worker thread. Check that chains and fan-outs still run every
+ * job exactly once, and in dependency order.
+ */
+void tst_ThreadPooler::dependencyChain()
+{
+    // GIVEN
+    QAtomicInt callCounter;
+    callCounter.storeRelaxed(0);
+    const int chainLength = 50;
+    const int fanOut = 8;
+    QVector<int> chainOrder(chainLength, -1);
+    QVector<int> fanOutOrder(fanOut, -1);
+    QVector<QSharedPointer<Qt3DCore::QAspectJob> > jobList;
+
+    // WHEN
+    QSharedPointer<TestAspectJob> previousJob;
+    for (int i = 0; i < chainLength; i++) {
+        QSharedPointer<TestAspectJob> job(new TestAspectJob(recordRunOrder, &callCounter,
+                                                            &chainOrder[i]));
+        if (previousJob)
+            job->addDependency(previousJob);
+        jobList.append(job);
+        previousJob = job;
+    }
+    for (int i = 0; i < fanOut; i++) {
+        QSharedPointer<TestAspectJob> job(new TestAspectJob(recordRunOrder, &callCounter,
+                                                            &fanOutOrder[i]));
+        job->addDependency(previousJob);
+        jobList.append(job);
+    }
+    m_jobManager->enqueueJobs(jobList);
+    const int runJobs = m_jobManager->waitForAllJobs();
+
+    // THEN
+    QCOMPARE(runJobs, chainLength + fanOut);
+    QCOMPARE(callCounter.loadRelaxed(), chainLength + fanOut);
+    for (int i = 0; i < chainLength; i++)
+        QCOMPARE(chainOrder.at(i), i);
+    for (int i = 0; i < fanOut; i++)
+        QVERIFY(fanOutOrder.at(i) >= chainLength);
+}
+
 void tst_ThreadPooler::massTest()
 {
     // GIVEN
@@ -245,6 +245,13 @@ private Q_SLOTS:
 
         ShaderParameterPack minifiedPack1;
 
+        // Uniform not set by the first command, with a value equal to a
+        // default constructed UniformValue
+        ShaderParameterPack pack2 = pack1;
+        pack2.setUniform(4, UniformValue(0));
+        ShaderParameterPack minifiedPack2;
+        minifiedPack2.setUniform(4, UniformValue(0));
+
         QTest::newRow("NoMinification")
                 << (QVector<QShaderProgram*>() << shader1 << shader2)
                 << (QVector<ShaderParameterPack>() << pack1 << pack1)
@@ -259,6 +266,11 @@ private Q_SLOTS:
                 << (QVector<QShaderProgram*>() << shader1 << shader1 << shader1 << shader2 << shader2 << shader2)
                 << (QVector<ShaderParameterPack>() << pack1 << pack1 << pack1 << pack1 << pack1 << pack1)
                 << (QVector<ShaderParameterPack>() << pack1 << minifiedPack1 << minifiedPack1 << pack1 << minifiedPack1 << minifiedPack1);
+
+        QTest::newRow("NewUniformKept")
+                << (QVector<QShaderProgram*>() << shader1 << shader1 << shader1)
+                << (QVector<ShaderParameterPack>() << pack1 << pack2 << pack2)
+                << (QVector<ShaderParameterPack>() << pack1 << minifiedPack2 << minifiedPack1);
     }
 
     void checkRenderViewUniformMinification()
@@ -52,6 +52,7 @@ private Q_SLOTS:
         QCOMPARE(backendTransform.isEnabled(), false);
         QVERIFY(backendTransform.peerId().isNull());
         QCOMPARE(convertToQMatrix4x4(backendTransform.transformMatrix()), QMatrix4x4());
+        QVERIFY(backendTransform.isTransformDirty());
     }
 
     void checkCleanupState()
@@ -71,6 +72,7 @@ private Q_SLOTS:
             simulateInitializationSync(&transform, &backendTransform);
         }
         backendTransform.setEnabled(true);
+        backendTransform.unsetTransformDirty();
 
         backendTransform.cleanup();
 
@@ -80,6 +82,7 @@ private Q_SLOTS:
         QCOMPARE(backendTransform.rotation(), QQuaternion());
         QCOMPARE(backendTransform.scale(), QVector3D());
         QCOMPARE(backendTransform.translation(), QVector3D());
+        QVERIFY(backendTransform.isTransformDirty());
     }
 
     void checkInitializeFromPeer()
@@ -133,6 +136,7 @@ private Q_SLOTS:
         backendTransform.setRenderer(&renderer);
         backendTransform.syncFromFrontEnd(&frontendTranform, true);
         renderer.clearDirtyBits(Qt3DRender::Render::AbstractRenderer::AllDirty);
+        backendTransform.unsetTransformDirty();
 
         {
             // WHEN
@@ -143,7 +147,9 @@ private Q_SLOTS:
             // THEN
             QCOMPARE(backendTransform.isEnabled(), newValue);
             QVERIFY(renderer.dirtyBits() & Qt3DRender::Render::AbstractRenderer::TransformDirty);
+            QVERIFY(backendTransform.isTransformDirty());
             renderer.clearDirtyBits(Qt3DRender::Render::AbstractRenderer::AllDirty);
+            backendTransform.unsetTransformDirty();
         }
         {
             // WHEN
@@ -154,7 +160,9 @@ private Q_SLOTS:
             // THEN
             QCOMPARE(backendTransform.rotation(), newValue);
             QVERIFY(renderer.dirtyBits() & Qt3DRender::Render::AbstractRenderer::TransformDirty);
+            QVERIFY(backendTransform.isTransformDirty());
             renderer.clearDirtyBits(Qt3DRender::Render::AbstractRenderer::AllDirty);
+            backendTransform.unsetTransformDirty();
         }
         {
             // WHEN
@@ -165,7 +173,9 @@ private Q_SLOTS:
             // THEN
             QCOMPARE(backendTransform.scale(), newValue);
             QVERIFY(renderer.dirtyBits() & Qt3DRender::Render::AbstractRenderer::TransformDirty);
+            QVERIFY(backendTransform.isTransformDirty());
             renderer.clearDirtyBits(Qt3DRender::Render::AbstractRenderer::AllDirty);
+            backendTransform.unsetTransformDirty();
         }
         {
             // WHEN
@@ -176,7 +186,17 @@ private Q_SLOTS:
             // THEN
             QCOMPARE(backendTransform.translation(), newValue);
             QVERIFY(renderer.dirtyBits() & Qt3DRender::Render::AbstractRenderer::TransformDirty);
+            QVERIFY(backendTransform.isTransformDirty());
             renderer.clearDirtyBits(Qt3DRender::Render::AbstractRenderer::AllDirty);
+            backendTransform.unsetTransformDirty();
+        }
+        {
+            // WHEN
+            backendTransform.syncFromFrontEnd(&frontendTranform, false);
+
+            // THEN
+            QVERIFY(!backendTransform.isTransformDirty());
+            QVERIFY(!(renderer.dirtyBits() & Qt3DRender::Render::AbstractRenderer::TransformDirty));
         }
     }
 };
@@ -0,0 +1,10 @@
+TEMPLATE = app
+
+TARGET = tst_trianglebvh
+
+QT += 3dcore 3dcore-private 3drender 3drender-private testlib
+
+CONFIG += testcase
+
+SOURCES += tst_trianglebvh.cpp
+
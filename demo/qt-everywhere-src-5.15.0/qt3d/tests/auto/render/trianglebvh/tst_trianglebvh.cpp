@@ -0,0 +1,180 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt3D module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <Qt3DRender/private/trianglebvh_p.h>
+#include <Qt3DRender/private/triangleboundingvolume_p.h>
+#include <Qt3DRender/private/qray3d_p.h>
+
+using Qt3DRender::Render::TriangleBvh;
+
+namespace {
+
+// Grid of size x size quads on a wavy surface, two triangles per quad
+QVector<TriangleBvh::Triangle> gridTriangles(int size)
+{
+    QVector<TriangleBvh::Triangle> triangles;
+    const auto vertex = [] (int x, int y) {
+        const float z = std::sin(float(x) * 0.3f) * std::cos(float(y) * 0.2f);
+        return Vector3D(float(x), float(y), z);
+    };
+    const auto vertexIndex = [size] (int x, int y) { return uint(y * (size + 1) + x); };
+
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            const uint index = uint(triangles.size());
+            triangles.push_back({ vertex(x, y), vertex(x + 1, y), vertex(x + 1, y + 1),
+                                  vertexIndex(x, y), vertexIndex(x + 1, y), vertexIndex(x + 1, y + 1),
+                                  index });
+            triangles.push_back({ vertex(x, y), vertex(x + 1, y + 1), vertex(x, y + 1),
+                                  vertexIndex(x, y), vertexIndex(x + 1, y + 1), vertexIndex(x, y + 1),
+                                  index + 1 });
+        }
+    }
+    return triangles;
+}
+
+bool hits(const Qt3DRender::RayCasting::QRay3D &ray, const TriangleBvh::Triangle &t)
+{
+    Vector3D uvw;
+    float s = 0.0f;
+    return Qt3DRender::Render::intersectsSegmentTriangle(ray, t.a, t.b, t.c, uvw, s)
+            || Qt3DRender::Render::intersectsSegmentTriangle(ray, t.c, t.b, t.a, uvw, s);
+}
+
+} // anonymous
+
+class tst_TriangleBvh : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void checkEmpty()
+    {
+        // GIVEN
+        TriangleBvh bvh;
+        QVector<int> candidates;
+
+        // WHEN
+        bvh.intersectingTriangles(Vector3D(0.0f, 0.0f, -1.0f), Vector3D(0.0f, 0.0f, 1.0f), candidates);
+
+        // THEN
+        QVERIFY(bvh.triangles().isEmpty());
+        QCOMPARE(bvh.nodeCount(), 0);
+        QVERIFY(candidates.isEmpty());
+    }
+
+    void checkTrianglesArePreserved()
+    {
+        // GIVEN
+        const QVector<TriangleBvh::Triangle> triangles = gridTriangles(10);
+
+        // WHEN
+        const TriangleBvh bvh(triangles);
+
+        // THEN
+        QCOMPARE(bvh.triangles().size(), triangles.size());
+        QVector<bool> seen(triangles.size(), false);
+        for (const TriangleBvh::Triangle &t : bvh.triangles()) {
+            const TriangleBvh::Triangle &original = triangles.at(int(t.index));
+            QCOMPARE(t.a, original.a);
+            QCOMPARE(t.b, original.b);
+            QCOMPARE(t.c, original.c);
+            QCOMPARE(t.andx, original.andx);
+            QCOMPARE(t.bndx, original.bndx);
+            QCOMPARE(t.cndx, original.cndx);
+            QVERIFY(!seen.at(int(t.index)));
+            seen[int(t.index)] = true;
+        }
+    }
+
+    void checkCandidates_data()
+    {
+        QTest::addColumn<Vector3D>("start");
+        QTest::addColumn<Vector3D>("end");
+
+        QTest::newRow("vertical") << Vector3D(12.3f, 7.6f, 5.0f) << Vector3D(12.3f, 7.6f, -5.0f);
+        QTest::newRow("onVertex") << Vector3D(10.0f, 10.0f, 5.0f) << Vector3D(10.0f, 10.0f, -5.0f);
+        QTest::newRow("slanted") << Vector3D(-2.0f, -3.0f, 4.0f) << Vector3D(35.0f, 28.0f, -3.0f);
+        QTest::newRow("grazing") << Vector3D(-1.0f, 20.5f, 0.1f) << Vector3D(41.0f, 20.5f, 0.1f);
+        QTest::newRow("outside") << Vector3D(-5.0f, -5.0f, 5.0f) << Vector3D(-5.0f, -5.0f, -5.0f);
+        QTest::newRow("tooShort") << Vector3D(20.5f, 20.5f, 5.0f) << Vector3D(20.5f, 20.5f, 2.0f);
+    }
+
+    void checkCandidates()
+    {
+        // GIVEN
+        QFETCH(Vector3D, start);
+        QFETCH(Vector3D, end);
+        const TriangleBvh bvh(gridTriangles(40));
+        const Vector3D direction = end - start;
+        const Qt3DRender::RayCasting::QRay3D ray(start, direction.normalized(), direction.length());
+
+        // WHEN
+        QVector<int> candidates;
+        bvh.intersectingTriangles(start, end, candidates);
+
+        // THEN
+        int expectedHits = 0;
+        for (int i = 0, m = bvh.triangles().size(); i < m; ++i) {
+            if (hits(ray, bvh.triangles().at(i))) {
+                ++expectedHits;
+                QVERIFY(candidates.contains(i));
+            }
+        }
+        int candidateHits = 0;
+        for (const int candidate : qAsConst(candidates)) {
+            if (hits(ray, bvh.triangles().at(candidate)))
+                ++candidateHits;
+        }
+        QCOMPARE(candidateHits, expectedHits);
+        QVector<int> sortedCandidates = candidates;
+        std::sort(sortedCandidates.begin(), sortedCandidates.end());
+        QVERIFY(std::adjacent_find(sortedCandidates.begin(), sortedCandidates.end()) == sortedCandidates.end());
+        QVERIFY(candidates.size() < bvh.triangles().size());
+    }
+
+    void checkVerticalRayVisitsFewTriangles()
+    {
+        // GIVEN
+        const TriangleBvh bvh(gridTriangles(100));
+
+        // WHEN
+        QVector<int> candidates;
+        bvh.intersectingTriangles(Vector3D(50.5f, 50.5f, 5.0f), Vector3D(50.5f, 50.5f, -5.0f), candidates);
+
+        // THEN
+        QVERIFY(!candidates.isEmpty());
+        QVERIFY(candidates.size() <= 16);
+    }
+};
+
+QTEST_APPLESS_MAIN(tst_TriangleBvh)
+
+#include "tst_trianglebvh.moc"
@@ -0,0 +1 @@
+#include "../../../../../src/corelib/io/qdirwalker_p.h"
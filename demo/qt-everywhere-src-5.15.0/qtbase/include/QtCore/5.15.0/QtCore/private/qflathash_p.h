@@ -0,0 +1 @@
+#include "../../../../../src/corelib/tools/qflathash_p.h"
@@ -0,0 +1 @@
+#include "../../../../../src/corelib/serialization/qjsontape_p.h"
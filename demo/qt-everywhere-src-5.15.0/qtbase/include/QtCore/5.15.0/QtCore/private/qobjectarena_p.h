@@ -0,0 +1 @@
+#include "../../../../../src/corelib/kernel/qobjectarena_p.h"
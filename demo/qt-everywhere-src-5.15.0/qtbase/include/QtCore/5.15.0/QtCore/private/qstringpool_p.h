@@ -0,0 +1 @@
+#include "../../../../../src/corelib/text/qstringpool_p.h"
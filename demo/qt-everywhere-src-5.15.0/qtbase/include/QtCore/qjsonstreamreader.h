@@ -0,0 +1 @@
+#include "../../src/corelib/serialization/qjsonstreamreader.h"
@@ -0,0 +1 @@
+#include "../../../../../src/gui/painting/qsharedglyphcache_p.h"
@@ -1,6 +1,6 @@
 SYNCQT.HEADER_FILES = accessible/qaccessible.h accessible/qaccessiblebridge.h accessible/qaccessibleobject.h accessible/qaccessibleplugin.h image/qbitmap.h image/qicon.h image/qiconengine.h image/qiconengineplugin.h image/qimage.h image/qimageiohandler.h image/qimagereader.h image/qimagewriter.h image/qmovie.h image/qpicture.h image/qpictureformatplugin.h image/qpixmap.h image/qpixmapcache.h itemmodels/qstandarditemmodel.h kernel/qclipboard.h kernel/qcursor.h kernel/qdrag.h kernel/qevent.h kernel/qgenericplugin.h kernel/qgenericpluginfactory.h kernel/qguiapplication.h kernel/qinputmethod.h kernel/qkeysequence.h kernel/qoffscreensurface.h kernel/qopenglcontext.h kernel/qopenglwindow.h kernel/qpaintdevicewindow.h kernel/qpalette.h kernel/qpixelformat.h kernel/qrasterwindow.h kernel/qscreen.h kernel/qsessionmanager.h kernel/qstylehints.h kernel/qsurface.h kernel/qsurfaceformat.h kernel/qtestsupport_gui.h kernel/qtguiglobal.h kernel/qtouchdevice.h kernel/qwindow.h kernel/qwindowdefs.h kernel/qwindowdefs_win.h math3d/qgenericmatrix.h math3d/qmatrix4x4.h math3d/qquaternion.h math3d/qvector2d.h math3d/qvector3d.h math3d/qvector4d.h opengl/qopengl.h opengl/qopenglbuffer.h opengl/qopengldebug.h opengl/qopengles2ext.h opengl/qopenglext.h opengl/qopenglextrafunctions.h opengl/qopenglframebufferobject.h opengl/qopenglfunctions.h opengl/qopenglfunctions_1_0.h opengl/qopenglfunctions_1_1.h opengl/qopenglfunctions_1_2.h opengl/qopenglfunctions_1_3.h opengl/qopenglfunctions_1_4.h opengl/qopenglfunctions_1_5.h opengl/qopenglfunctions_2_0.h opengl/qopenglfunctions_2_1.h opengl/qopenglfunctions_3_0.h opengl/qopenglfunctions_3_1.h opengl/qopenglfunctions_3_2_compatibility.h opengl/qopenglfunctions_3_2_core.h opengl/qopenglfunctions_3_3_compatibility.h opengl/qopenglfunctions_3_3_core.h opengl/qopenglfunctions_4_0_compatibility.h opengl/qopenglfunctions_4_0_core.h opengl/qopenglfunctions_4_1_compatibility.h opengl/qopenglfunctions_4_1_core.h opengl/qopenglfunctions_4_2_compatibility.h opengl/qopenglfunctions_4_2_core.h opengl/qopenglfunctions_4_3_compatibility.h opengl/qopenglfunctions_4_3_core.h opengl/qopenglfunctions_4_4_compatibility.h opengl/qopenglfunctions_4_4_core.h opengl/qopenglfunctions_4_5_compatibility.h opengl/qopenglfunctions_4_5_core.h opengl/qopenglfunctions_es2.h opengl/qopenglpaintdevice.h opengl/qopenglpixeltransferoptions.h opengl/qopenglshaderprogram.h opengl/qopengltexture.h opengl/qopengltextureblitter.h opengl/qopengltimerquery.h opengl/qopenglversionfunctions.h opengl/qopenglvertexarrayobject.h painting/qbackingstore.h painting/qbrush.h painting/qcolor.h painting/qcolorspace.h painting/qcolortransform.h painting/qmatrix.h painting/qpagedpaintdevice.h painting/qpagelayout.h painting/qpagesize.h painting/qpaintdevice.h painting/qpaintengine.h painting/qpainter.h painting/qpainterpath.h painting/qpdfwriter.h painting/qpen.h painting/qpolygon.h painting/qregion.h painting/qrgb.h painting/qrgba64.h painting/qtransform.h text/qabstracttextdocumentlayout.h text/qfont.h text/qfontdatabase.h text/qfontinfo.h text/qfontmetrics.h text/qglyphrun.h text/qrawfont.h text/qstatictext.h text/qsyntaxhighlighter.h text/qtextcursor.h text/qtextdocument.h text/qtextdocumentfragment.h text/qtextdocumentwriter.h text/qtextformat.h text/qtextlayout.h text/qtextlist.h text/qtextobject.h text/qtextoption.h text/qtexttable.h util/qdesktopservices.h util/qvalidator.h vulkan/qvulkaninstance.h vulkan/qvulkanwindow.h 
 SYNCQT.GENERATED_HEADER_FILES = QAccessible QAccessibleInterface QAccessibleTextInterface QAccessibleEditableTextInterface QAccessibleValueInterface QAccessibleTableCellInterface QAccessibleTableInterface QAccessibleActionInterface QAccessibleImageInterface QAccessibleEvent QAccessibleStateChangeEvent QAccessibleTextCursorEvent QAccessibleTextSelectionEvent QAccessibleTextInsertEvent QAccessibleTextRemoveEvent QAccessibleTextUpdateEvent QAccessibleValueChangeEvent QAccessibleTableModelChangeEvent QAccessibleBridge QAccessibleBridgePlugin QAccessibleObject QAccessibleApplication QAccessiblePlugin QBitmap QIcon QIconEngine QIconEngineV2 QIconEnginePlugin QImageTextKeyLang QImageCleanupFunction QImage QImageIOHandler QImageIOPlugin QImageReader QImageWriter QMovie QPicture QPictureIO QPictureFormatPlugin QPixmap QPixmapCache QStandardItem QStandardItemModel QClipboard QCursor QDrag QInputEvent QEnterEvent QMouseEvent QHoverEvent QWheelEvent QTabletEvent QNativeGestureEvent QKeyEvent QFocusEvent QPaintEvent QMoveEvent QExposeEvent QPlatformSurfaceEvent QResizeEvent QCloseEvent QIconDragEvent QShowEvent QHideEvent QContextMenuEvent QInputMethodEvent QInputMethodQueryEvent QDropEvent QDragMoveEvent QDragEnterEvent QDragLeaveEvent QHelpEvent QStatusTipEvent QWhatsThisClickedEvent QActionEvent QFileOpenEvent QToolBarChangeEvent QShortcutEvent QWindowStateChangeEvent QPointingDeviceUniqueId QTouchEvent QScrollPrepareEvent QScrollEvent QScreenOrientationChangeEvent QApplicationStateChangeEvent QtEvents QGenericPlugin QGenericPluginFactory QGuiApplication QInputMethod QKeySequence QOffscreenSurface QOpenGLVersionProfile QOpenGLContextGroup QOpenGLContext QOpenGLWindow QPaintDeviceWindow QPalette QPixelFormat QRasterWindow QScreen QSessionManager QStyleHints QSurface QSurfaceFormat QTouchDevice QWindow QWidgetList QWindowList QWidgetMapper QWidgetSet QGenericMatrix QMatrix2x2 QMatrix2x3 QMatrix2x4 QMatrix3x2 QMatrix3x3 QMatrix3x4 QMatrix4x2 QMatrix4x3 QMatrix4x4 QQuaternion QVector2D QVector3D QVector4D QOpenGLBuffer QOpenGLDebugMessage QOpenGLDebugLogger QOpenGLExtraFunctions QOpenGLExtraFunctionsPrivate QOpenGLFramebufferObject QOpenGLFramebufferObjectFormat QOpenGLFunctions QOpenGLFunctionsPrivate QOpenGLFunctions_1_0 QOpenGLFunctions_1_1 QOpenGLFunctions_1_2 QOpenGLFunctions_1_3 QOpenGLFunctions_1_4 QOpenGLFunctions_1_5 QOpenGLFunctions_2_0 QOpenGLFunctions_2_1 QOpenGLFunctions_3_0 QOpenGLFunctions_3_1 QOpenGLFunctions_3_2_Compatibility QOpenGLFunctions_3_2_Core QOpenGLFunctions_3_3_Compatibility QOpenGLFunctions_3_3_Core QOpenGLFunctions_4_0_Compatibility QOpenGLFunctions_4_0_Core QOpenGLFunctions_4_1_Compatibility QOpenGLFunctions_4_1_Core QOpenGLFunctions_4_2_Compatibility QOpenGLFunctions_4_2_Core QOpenGLFunctions_4_3_Compatibility QOpenGLFunctions_4_3_Core QOpenGLFunctions_4_4_Compatibility QOpenGLFunctions_4_4_Core QOpenGLFunctions_4_5_Compatibility QOpenGLFunctions_4_5_Core QOpenGLFunctions_ES2 QOpenGLPaintDevice QOpenGLPixelTransferOptions QOpenGLShader QOpenGLShaderProgram QOpenGLTexture QOpenGLTextureBlitter QOpenGLTimerQuery QOpenGLTimeMonitor QOpenGLVersionFunctions QOpenGLVertexArrayObject QBackingStore QBrush QBrushData QGradientStop QGradientStops QGradient QLinearGradient QRadialGradient QConicalGradient QColor QColorSpace QColorTransform QMatrix QPagedPaintDevice QPageLayout QPageSize QPaintDevice QTextItem QPaintEngine QPaintEngineState QPainter QPainterPath QPainterPathStroker QPdfWriter QPen QPolygon QPolygonF QRegion QRgb QRgba64 QTransform QAbstractTextDocumentLayout QTextObjectInterface QFont QFontDatabase QFontInfo QFontMetrics QFontMetricsF QGlyphRun QRawFont QStaticText QSyntaxHighlighter QTextCursor QAbstractUndoItem QTextDocument QTextDocumentFragment QTextDocumentWriter QTextLength QTextFormat QTextCharFormat QTextBlockFormat QTextListFormat QTextImageFormat QTextFrameFormat QTextTableFormat QTextTableCellFormat QTextInlineObject QTextLayout QTextLine QTextList QTextObject QTextBlockGroup QTextFrameLayoutData QTextFrame QTextBlockUserData QTextBlock QTextFragment QTextOption QTextTableCell QTextTable QDesktopServices QValidator QIntValidator QDoubleValidator QRegExpValidator QRegularExpressionValidator QVulkanLayer QVulkanExtension QVulkanInfoVector QVulkanInstance QVulkanWindowRenderer QVulkanWindow QGenericPluginFactory QGenericPlugin qtguiversion.h QtGuiVersion QtGui 
-SYNCQT.PRIVATE_HEADER_FILES = accessible/qaccessiblecache_p.h image/qbmphandler_p.h image/qicon_p.h image/qiconloader_p.h image/qimage_p.h image/qimagepixmapcleanuphooks_p.h image/qimagereaderwriterhelpers_p.h image/qpaintengine_pic_p.h image/qpicture_p.h image/qpixmap_blitter_p.h image/qpixmap_raster_p.h image/qpixmapcache_p.h image/qpnghandler_p.h image/qppmhandler_p.h image/qxbmhandler_p.h image/qxpmhandler_p.h itemmodels/qstandarditemmodel_p.h kernel/qcursor_p.h kernel/qdnd_p.h kernel/qevent_p.h kernel/qguiapplication_p.h kernel/qhighdpiscaling_p.h kernel/qinputdevicemanager_p.h kernel/qinputdevicemanager_p_p.h kernel/qinputmethod_p.h kernel/qinternalmimedata_p.h kernel/qkeymapper_p.h kernel/qkeysequence_p.h kernel/qopenglcontext_p.h kernel/qpaintdevicewindow_p.h kernel/qscreen_p.h kernel/qsessionmanager_p.h kernel/qshapedpixmapdndwindow_p.h kernel/qshortcutmap_p.h kernel/qsimpledrag_p.h kernel/qt_gui_pch.h kernel/qtguiglobal_p.h kernel/qtouchdevice_p.h kernel/qwindow_p.h opengl/qopengl2pexvertexarray_p.h opengl/qopengl_p.h opengl/qopenglcustomshaderstage_p.h opengl/qopenglengineshadermanager_p.h opengl/qopenglengineshadersource_p.h opengl/qopenglextensions_p.h opengl/qopenglframebufferobject_p.h opengl/qopenglgradientcache_p.h opengl/qopenglpaintdevice_p.h opengl/qopenglpaintengine_p.h opengl/qopenglprogrambinarycache_p.h opengl/qopenglqueryhelper_p.h opengl/qopenglshadercache_p.h opengl/qopengltexture_p.h opengl/qopengltexturecache_p.h opengl/qopengltextureglyphcache_p.h opengl/qopengltexturehelper_p.h opengl/qopengltextureuploader_p.h opengl/qopenglversionfunctionsfactory_p.h opengl/qopenglvertexarrayobject_p.h painting/qbezier_p.h painting/qblendfunctions_p.h painting/qblittable_p.h painting/qcolor_p.h painting/qcolormatrix_p.h painting/qcolorspace_p.h painting/qcolortransferfunction_p.h painting/qcolortransfertable_p.h painting/qcolortransform_p.h painting/qcolortrc_p.h painting/qcolortrclut_p.h painting/qcoregraphics_p.h painting/qcosmeticstroker_p.h painting/qcssutil_p.h painting/qdatabuffer_p.h painting/qdrawhelper_mips_dsp_p.h painting/qdrawhelper_neon_p.h painting/qdrawhelper_p.h painting/qdrawhelper_x86_p.h painting/qdrawingprimitive_sse2_p.h painting/qemulationpaintengine_p.h painting/qfixed_p.h painting/qgrayraster_p.h painting/qicc_p.h painting/qimagescale_p.h painting/qmath_p.h painting/qmemrotate_p.h painting/qoutlinemapper_p.h painting/qpagedpaintdevice_p.h painting/qpaintengine_blitter_p.h painting/qpaintengine_p.h painting/qpaintengine_raster_p.h painting/qpaintengineex_p.h painting/qpainter_p.h painting/qpainterpath_p.h painting/qpathclipper_p.h painting/qpathsimplifier_p.h painting/qpdf_p.h painting/qpen_p.h painting/qpolygonclipper_p.h painting/qrasterdefs_p.h painting/qrasterizer_p.h painting/qrbtree_p.h painting/qrgba64_p.h painting/qstroker_p.h painting/qt_mips_asm_dsp_p.h painting/qtextureglyphcache_p.h painting/qtriangulatingstroker_p.h painting/qtriangulator_p.h painting/qvectorpath_p.h rhi/cs_tdr_p.h rhi/qrhi_p.h rhi/qrhi_p_p.h rhi/qrhid3d11_p.h rhi/qrhid3d11_p_p.h rhi/qrhigles2_p.h rhi/qrhigles2_p_p.h rhi/qrhimetal_p.h rhi/qrhimetal_p_p.h rhi/qrhinull_p.h rhi/qrhinull_p_p.h rhi/qrhiprofiler_p.h rhi/qrhiprofiler_p_p.h rhi/qrhivulkan_p.h rhi/qrhivulkan_p_p.h rhi/qrhivulkanext_p.h rhi/qshader_p.h rhi/qshader_p_p.h rhi/qshaderdescription_p.h rhi/qshaderdescription_p_p.h text/qabstracttextdocumentlayout_p.h text/qcssparser_p.h text/qdistancefield_p.h text/qfont_p.h text/qfontengine_p.h text/qfontengine_qpf2_p.h text/qfontengineglyphcache_p.h text/qfontsubset_p.h text/qfragmentmap_p.h text/qglyphrun_p.h text/qharfbuzzng_p.h text/qinputcontrol_p.h text/qrawfont_p.h text/qstatictext_p.h text/qtextcursor_p.h text/qtextdocument_p.h text/qtextdocumentfragment_p.h text/qtextdocumentlayout_p.h text/qtextengine_p.h text/qtextformat_p.h text/qtexthtmlparser_p.h text/qtextimagehandler_p.h text/qtextmarkdownimporter_p.h text/qtextmarkdownwriter_p.h text/qtextobject_p.h text/qtextodfwriter_p.h text/qtexttable_p.h text/qzipreader_p.h text/qzipwriter_p.h util/qabstractlayoutstyleinfo_p.h util/qastchandler_p.h util/qgridlayoutengine_p.h util/qhexstring_p.h util/qktxhandler_p.h util/qlayoutpolicy_p.h util/qpkmhandler_p.h util/qshaderformat_p.h util/qshadergenerator_p.h util/qshadergraph_p.h util/qshadergraphloader_p.h util/qshaderlanguage_p.h util/qshadernode_p.h util/qshadernodeport_p.h util/qshadernodesloader_p.h util/qtexturefiledata_p.h util/qtexturefilehandler_p.h util/qtexturefilereader_p.h vulkan/qvulkanwindow_p.h platform/wasm/qwasmlocalfileaccess_p.h 
+SYNCQT.PRIVATE_HEADER_FILES = accessible/qaccessiblecache_p.h image/qbmphandler_p.h image/qicon_p.h image/qiconloader_p.h image/qimage_p.h image/qimagepixmapcleanuphooks_p.h image/qimagereaderwriterhelpers_p.h image/qpaintengine_pic_p.h image/qpicture_p.h image/qpixmap_blitter_p.h image/qpixmap_raster_p.h image/qpixmapcache_p.h image/qpnghandler_p.h image/qppmhandler_p.h image/qxbmhandler_p.h image/qxpmhandler_p.h itemmodels/qstandarditemmodel_p.h kernel/qcursor_p.h kernel/qdnd_p.h kernel/qevent_p.h kernel/qguiapplication_p.h kernel/qhighdpiscaling_p.h kernel/qinputdevicemanager_p.h kernel/qinputdevicemanager_p_p.h kernel/qinputmethod_p.h kernel/qinternalmimedata_p.h kernel/qkeymapper_p.h kernel/qkeysequence_p.h kernel/qopenglcontext_p.h kernel/qpaintdevicewindow_p.h kernel/qscreen_p.h kernel/qsessionmanager_p.h kernel/qshapedpixmapdndwindow_p.h kernel/qshortcutmap_p.h kernel/qsimpledrag_p.h kernel/qt_gui_pch.h kernel/qtguiglobal_p.h kernel/qtouchdevice_p.h kernel/qwindow_p.h opengl/qopengl2pexvertexarray_p.h opengl/qopengl_p.h opengl/qopenglcustomshaderstage_p.h opengl/qopenglengineshadermanager_p.h opengl/qopenglengineshadersource_p.h opengl/qopenglextensions_p.h opengl/qopenglframebufferobject_p.h opengl/qopenglgradientcache_p.h opengl/qopenglpaintdevice_p.h opengl/qopenglpaintengine_p.h opengl/qopenglprogrambinarycache_p.h opengl/qopenglqueryhelper_p.h opengl/qopenglshadercache_p.h opengl/qopengltexture_p.h opengl/qopengltexturecache_p.h opengl/qopengltextureglyphcache_p.h opengl/qopengltexturehelper_p.h opengl/qopengltextureuploader_p.h opengl/qopenglversionfunctionsfactory_p.h opengl/qopenglvertexarrayobject_p.h painting/qbezier_p.h painting/qblendfunctions_p.h painting/qblittable_p.h painting/qcolor_p.h painting/qcolormatrix_p.h painting/qcolorspace_p.h painting/qcolortransferfunction_p.h painting/qcolortransfertable_p.h painting/qcolortransform_p.h painting/qcolortrc_p.h painting/qcolortrclut_p.h painting/qcoregraphics_p.h painting/qcosmeticstroker_p.h painting/qcssutil_p.h painting/qdatabuffer_p.h painting/qdrawhelper_mips_dsp_p.h painting/qdrawhelper_neon_p.h painting/qdrawhelper_p.h painting/qdrawhelper_x86_p.h painting/qdrawingprimitive_sse2_p.h painting/qemulationpaintengine_p.h painting/qfixed_p.h painting/qgrayraster_p.h painting/qicc_p.h painting/qimagescale_p.h painting/qmath_p.h painting/qmemrotate_p.h painting/qoutlinemapper_p.h painting/qpagedpaintdevice_p.h painting/qpaintengine_blitter_p.h painting/qpaintengine_p.h painting/qpaintengine_raster_p.h painting/qpaintengineex_p.h painting/qpainter_p.h painting/qpainterpath_p.h painting/qpathclipper_p.h painting/qpathsimplifier_p.h painting/qpdf_p.h painting/qpen_p.h painting/qpolygonclipper_p.h painting/qrasterdefs_p.h painting/qrasterizer_p.h painting/qrbtree_p.h painting/qrgba64_p.h painting/qstroker_p.h painting/qt_mips_asm_dsp_p.h painting/qsharedglyphcache_p.h painting/qtextureglyphcache_p.h painting/qtriangulatingstroker_p.h painting/qtriangulator_p.h painting/qvectorpath_p.h rhi/cs_tdr_p.h rhi/qrhi_p.h rhi/qrhi_p_p.h rhi/qrhid3d11_p.h rhi/qrhid3d11_p_p.h rhi/qrhigles2_p.h rhi/qrhigles2_p_p.h rhi/qrhimetal_p.h rhi/qrhimetal_p_p.h rhi/qrhinull_p.h rhi/qrhinull_p_p.h rhi/qrhiprofiler_p.h rhi/qrhiprofiler_p_p.h rhi/qrhivulkan_p.h rhi/qrhivulkan_p_p.h rhi/qrhivulkanext_p.h rhi/qshader_p.h rhi/qshader_p_p.h rhi/qshaderdescription_p.h rhi/qshaderdescription_p_p.h text/qabstracttextdocumentlayout_p.h text/qcssparser_p.h text/qdistancefield_p.h text/qfont_p.h text/qfontengine_p.h text/qfontengine_qpf2_p.h text/qfontengineglyphcache_p.h text/qfontsubset_p.h text/qfragmentmap_p.h text/qglyphrun_p.h text/qharfbuzzng_p.h text/qinputcontrol_p.h text/qrawfont_p.h text/qstatictext_p.h text/qtextcursor_p.h text/qtextdocument_p.h text/qtextdocumentfragment_p.h text/qtextdocumentlayout_p.h text/qtextengine_p.h text/qtextformat_p.h text/qtexthtmlparser_p.h text/qtextimagehandler_p.h text/qtextmarkdownimporter_p.h text/qtextmarkdownwriter_p.h text/qtextobject_p.h text/qtextodfwriter_p.h text/qtexttable_p.h text/qzipreader_p.h text/qzipwriter_p.h util/qabstractlayoutstyleinfo_p.h util/qastchandler_p.h util/qgridlayoutengine_p.h util/qhexstring_p.h util/qktxhandler_p.h util/qlayoutpolicy_p.h util/qpkmhandler_p.h util/qshaderformat_p.h util/qshadergenerator_p.h util/qshadergraph_p.h util/qshadergraphloader_p.h util/qshaderlanguage_p.h util/qshadernode_p.h util/qshadernodeport_p.h util/qshadernodesloader_p.h util/qtexturefiledata_p.h util/qtexturefilehandler_p.h util/qtexturefilereader_p.h vulkan/qvulkanwindow_p.h platform/wasm/qwasmlocalfileaccess_p.h 
 SYNCQT.QPA_HEADER_FILES = accessible/qplatformaccessibility.h image/qplatformpixmap.h kernel/qplatformclipboard.h kernel/qplatformcursor.h kernel/qplatformdialoghelper.h kernel/qplatformdrag.h kernel/qplatformgraphicsbuffer.h kernel/qplatformgraphicsbufferhelper.h kernel/qplatforminputcontext.h kernel/qplatforminputcontext_p.h kernel/qplatforminputcontextfactory_p.h kernel/qplatforminputcontextplugin_p.h kernel/qplatformintegration.h kernel/qplatformintegrationfactory_p.h kernel/qplatformintegrationplugin.h kernel/qplatformmenu.h kernel/qplatformnativeinterface.h kernel/qplatformoffscreensurface.h kernel/qplatformopenglcontext.h kernel/qplatformscreen.h kernel/qplatformscreen_p.h kernel/qplatformservices.h kernel/qplatformsessionmanager.h kernel/qplatformsharedgraphicscache.h kernel/qplatformsurface.h kernel/qplatformsystemtrayicon.h kernel/qplatformtheme.h kernel/qplatformtheme_p.h kernel/qplatformthemefactory_p.h kernel/qplatformthemeplugin.h kernel/qplatformwindow.h kernel/qplatformwindow_p.h kernel/qwindowsysteminterface.h kernel/qwindowsysteminterface_p.h painting/qplatformbackingstore.h text/qplatformfontdatabase.h vulkan/qplatformvulkaninstance.h 
 SYNCQT.CLEAN_HEADER_FILES = accessible/qaccessible.h accessible/qaccessiblebridge.h accessible/qaccessibleobject.h accessible/qaccessibleplugin.h image/qbitmap.h image/qicon.h image/qiconengine.h image/qiconengineplugin.h image/qimage.h image/qimageiohandler.h image/qimagereader.h image/qimagewriter.h image/qmovie.h:movie image/qpicture.h image/qpictureformatplugin.h image/qpixmap.h image/qpixmapcache.h itemmodels/qstandarditemmodel.h:standarditemmodel kernel/qclipboard.h kernel/qcursor.h kernel/qdrag.h:draganddrop kernel/qevent.h kernel/qgenericplugin.h kernel/qgenericpluginfactory.h kernel/qguiapplication.h kernel/qinputmethod.h kernel/qkeysequence.h kernel/qoffscreensurface.h kernel/qopenglcontext.h kernel/qopenglwindow.h kernel/qpaintdevicewindow.h kernel/qpalette.h kernel/qpixelformat.h kernel/qrasterwindow.h kernel/qscreen.h kernel/qsessionmanager.h kernel/qstylehints.h kernel/qsurface.h kernel/qsurfaceformat.h kernel/qtestsupport_gui.h kernel/qtguiglobal.h kernel/qtouchdevice.h kernel/qwindow.h kernel/qwindowdefs.h kernel/qwindowdefs_win.h math3d/qgenericmatrix.h math3d/qmatrix4x4.h math3d/qquaternion.h math3d/qvector2d.h math3d/qvector3d.h math3d/qvector4d.h opengl/qopengl.h opengl/qopenglbuffer.h opengl/qopengldebug.h opengl/qopenglextrafunctions.h opengl/qopenglframebufferobject.h opengl/qopenglfunctions.h opengl/qopenglfunctions_1_0.h opengl/qopenglfunctions_1_1.h opengl/qopenglfunctions_1_2.h opengl/qopenglfunctions_1_3.h opengl/qopenglfunctions_1_4.h opengl/qopenglfunctions_1_5.h opengl/qopenglfunctions_2_0.h opengl/qopenglfunctions_2_1.h opengl/qopenglfunctions_3_0.h opengl/qopenglfunctions_3_1.h opengl/qopenglfunctions_3_2_compatibility.h opengl/qopenglfunctions_3_2_core.h opengl/qopenglfunctions_3_3_compatibility.h opengl/qopenglfunctions_3_3_core.h opengl/qopenglfunctions_4_0_compatibility.h opengl/qopenglfunctions_4_0_core.h opengl/qopenglfunctions_4_1_compatibility.h opengl/qopenglfunctions_4_1_core.h opengl/qopenglfunctions_4_2_compatibility.h opengl/qopenglfunctions_4_2_core.h opengl/qopenglfunctions_4_3_compatibility.h opengl/qopenglfunctions_4_3_core.h opengl/qopenglfunctions_4_4_compatibility.h opengl/qopenglfunctions_4_4_core.h opengl/qopenglfunctions_4_5_compatibility.h opengl/qopenglfunctions_4_5_core.h opengl/qopenglfunctions_es2.h opengl/qopenglpaintdevice.h opengl/qopenglpixeltransferoptions.h opengl/qopenglshaderprogram.h opengl/qopengltexture.h opengl/qopengltextureblitter.h opengl/qopengltimerquery.h opengl/qopenglversionfunctions.h opengl/qopenglvertexarrayobject.h painting/qbackingstore.h painting/qbrush.h painting/qcolor.h painting/qcolorspace.h painting/qcolortransform.h painting/qmatrix.h painting/qpagedpaintdevice.h painting/qpagelayout.h painting/qpagesize.h painting/qpaintdevice.h painting/qpaintengine.h painting/qpainter.h painting/qpainterpath.h painting/qpdfwriter.h painting/qpen.h painting/qpolygon.h painting/qregion.h painting/qrgb.h painting/qrgba64.h painting/qtransform.h text/qabstracttextdocumentlayout.h text/qfont.h text/qfontdatabase.h text/qfontinfo.h text/qfontmetrics.h text/qglyphrun.h text/qrawfont.h text/qstatictext.h text/qsyntaxhighlighter.h text/qtextcursor.h text/qtextdocument.h text/qtextdocumentfragment.h text/qtextdocumentwriter.h text/qtextformat.h text/qtextlayout.h text/qtextlist.h text/qtextobject.h text/qtextoption.h text/qtexttable.h util/qdesktopservices.h util/qvalidator.h vulkan/qvulkaninstance.h vulkan/qvulkanwindow.h 
 SYNCQT.INJECTIONS = src/gui/vulkan/qvulkanfunctions.h:^qvulkanfunctions.h:QVulkanFunctions:QVulkanDeviceFunctions src/gui/vulkan/qvulkanfunctions_p.h:^5.15.0/QtGui/private/qvulkanfunctions_p.h 
@@ -220,13 +220,13 @@ struct PushBackWrapper
     typedef void result_type;
 
     template <class C, class U>
-    inline void operator()(C &c, const U &u) const
+    inline auto operator()(C &c, const U &u) const -> decltype(void(c.push_back(u)))
     {
         return c.push_back(u);
     }
 
     template <class C, class U>
-    inline void operator()(C &c, U &&u) const
+    inline auto operator()(C &c, U &&u) const -> decltype(void(c.push_back(u)))
     {
         return c.push_back(u);
     }
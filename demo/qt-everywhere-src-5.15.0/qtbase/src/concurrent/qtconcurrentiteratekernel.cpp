@@ -42,6 +42,8 @@
 #include <qdeadlinetimer.h>
 #include "private/qfunctions_p.h"
 
+#include <atomic>
+
 
 #if !defined(QT_NO_CONCURRENT) || defined(Q_CLANG_QDOC)
 
@@ -49,7 +51,9 @@ QT_BEGIN_NAMESPACE
 
 enum {
     TargetRatio = 100,
-    MedianSize = 7
+    MedianSize = 7,
+    // a thread takes at most this fraction of the range it owns at a time
+    RangeBlockDivisor = 4
 };
 
 static qint64 getticks()
@@ -88,6 +92,18 @@ namespace QtConcurrent {
   \internal
  */
 
+/*!
+  \class QtConcurrent::RangePartitioner
+  \inmodule QtConcurrent
+  \internal
+ */
+
+/*!
+  \class QtConcurrent::RangePartitioner::SlotClaim
+  \inmodule QtConcurrent
+  \internal
+ */
+
 /*!
   \class QtConcurrent::ResultReporter
   \inmodule QtConcurrent
@@ -217,6 +233,170 @@ int BlockSizeManagerV2::blockSize()
     return m_blockSize;
 }
 
+// The range of a slot is packed into one word, begin in the high half and
+// end in the low half, so that the owner and the thieves can update it with
+// a single compare-and-swap. A range that compares equal also holds the same
+// iterations, so a swap based on an older load of the same value is still
+// correct.
+static quint64 packRange(int begin, int end)
+{
+    return (quint64(quint32(begin)) << 32) | quint32(end);
+}
+
+static int rangeBegin(quint64 range)
+{
+    return int(quint32(range >> 32));
+}
+
+static int rangeEnd(quint64 range)
+{
+    return int(quint32(range));
+}
+
+struct alignas(64) RangePartitioner::Slot
+{
+    std::atomic<quint64> range{0};
+    std::atomic<bool> claimed{false};
+};
+
+/*! \internal
+
+*/
+RangePartitioner::RangePartitioner()
+    : slotCount(0), maxBlockSize(1)
+{ }
+
+RangePartitioner::~RangePartitioner()
+{ }
+
+// Hands the whole range to the first slot; the other slots get their share
+// by stealing from it.
+void RangePartitioner::reset(int iterationCount)
+{
+    const int threadCount = qMax(1, QThreadPool::globalInstance()->maxThreadCount());
+    // one more slot for the thread that calls one of the blocking functions
+    slotCount = threadCount + 1;
+    rangeSlots.reset(new Slot[slotCount]);
+    rangeSlots[0].range.store(packRange(0, iterationCount), std::memory_order_relaxed);
+    maxBlockSize = qMax(1, iterationCount / (threadCount * 2));
+}
+
+// Returns a free slot, or -1 if more threads than expected call into the
+// kernel; those only steal.
+int RangePartitioner::claimSlot()
+{
+    for (int i = 0; i < slotCount; ++i) {
+        bool expected = false;
+        if (!rangeSlots[i].claimed.load(std::memory_order_relaxed)
+                && rangeSlots[i].claimed.compare_exchange_strong(expected, true,
+                                                            std::memory_order_acquire)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// The remaining range of a released slot stays in place and is stolen in
+// one piece by the next thread that runs out of work.
+void RangePartitioner::releaseSlot(int slot)
+{
+    if (slot >= 0)
+        rangeSlots[slot].claimed.store(false, std::memory_order_release);
+}
+
+bool RangePartitioner::nextBlock(int slot, int blockSize, int *beginIndex, int *endIndex)
+{
+    if (slot < 0)
+        return steal(slot, blockSize, beginIndex, endIndex);
+
+    // steal() refills our own range, so take the block from there
+    while (!takeBlock(slot, blockSize, beginIndex, endIndex)) {
+        if (!steal(slot, blockSize, beginIndex, endIndex))
+            return false;
+    }
+    return true;
+}
+
+bool RangePartitioner::hasRemainingWork() const
+{
+    for (int i = 0; i < slotCount; ++i) {
+        const quint64 range = rangeSlots[i].range.load(std::memory_order_relaxed);
+        if (rangeBegin(range) < rangeEnd(range))
+            return true;
+    }
+    return false;
+}
+
+static int blockSizeFor(int available, int blockSize, int maxBlockSize)
+{
+    const int size = qMin(qMax(qMax(blockSize, 1), available / RangeBlockDivisor), maxBlockSize);
+    return qBound(1, size, available);
+}
+
+// Takes a block from the front of our own range.
+bool RangePartitioner::takeBlock(int slot, int blockSize, int *beginIndex, int *endIndex)
+{
+    std::atomic<quint64> &range = rangeSlots[slot].range;
+    quint64 current = range.load(std::memory_order_acquire);
+    for (;;) {
+        const int begin = rangeBegin(current);
+        const int end = rangeEnd(current);
+        if (begin >= end)
+            return false;
+        const int size = blockSizeFor(end - begin, blockSize, maxBlockSize);
+        if (range.compare_exchange_weak(current, packRange(begin + size, end),
+                                        std::memory_order_acquire)) {
+            *beginIndex = begin;
+            *endIndex = begin + size;
+            return true;
+        }
+    }
+}
+
+// Takes the back half of another slot's range, or all of it if that slot has
+// no owner or too little work left to split. With a slot of our own the
+// stolen range is stored there and an empty block is returned; without one,
+// a single block is taken from the back of the victim.
+bool RangePartitioner::steal(int slot, int blockSize, int *beginIndex, int *endIndex)
+{
+    for (int i = 1; i <= slotCount; ++i) {
+        const int victim = (qMax(slot, 0) + i) % slotCount;
+        if (victim == slot)
+            continue;
+        std::atomic<quint64> &range = rangeSlots[victim].range;
+        quint64 current = range.load(std::memory_order_acquire);
+        for (;;) {
+            const int begin = rangeBegin(current);
+            const int end = rangeEnd(current);
+            if (begin >= end)
+                break;
+
+            int split;
+            if (slot < 0)
+                split = end - blockSizeFor(end - begin, blockSize, maxBlockSize);
+            else if (!rangeSlots[victim].claimed.load(std::memory_order_relaxed)
+                     || end - begin <= 2 * qMax(blockSize, 1))
+                split = begin;
+            else
+                split = begin + (end - begin) / 2;
+
+            if (range.compare_exchange_weak(current, packRange(begin, split),
+                                            std::memory_order_acq_rel)) {
+                if (slot < 0) {
+                    *beginIndex = split;
+                    *endIndex = end;
+                } else {
+                    // only thieves look at an empty range, and they leave it alone
+                    rangeSlots[slot].range.store(packRange(split, end), std::memory_order_release);
+                    *beginIndex = *endIndex = split;
+                }
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 } // namespace QtConcurrent
 
 QT_END_NAMESPACE
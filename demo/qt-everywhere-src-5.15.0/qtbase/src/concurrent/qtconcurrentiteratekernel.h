@@ -49,6 +49,7 @@
 #include <QtConcurrent/qtconcurrentthreadengine.h>
 
 #include <iterator>
+#include <memory>
 
 QT_BEGIN_NAMESPACE
 
@@ -113,6 +114,55 @@ private:
     Q_DISABLE_COPY(BlockSizeManagerV2)
 };
 
+/*
+    The RangePartitioner class splits the iteration range between the
+    threads. Each thread claims a slot holding a contiguous range of its own
+    and takes blocks from the front of it, so the threads don't contend on a
+    shared index. A thread whose range is empty steals the back half of the
+    range of another slot, which splits the work recursively as threads are
+    started and keeps each thread on neighbouring items.
+*/
+class Q_CONCURRENT_EXPORT RangePartitioner
+{
+public:
+    RangePartitioner();
+    ~RangePartitioner();
+
+    void reset(int iterationCount);
+    int claimSlot();
+    void releaseSlot(int slot);
+    bool nextBlock(int slot, int blockSize, int *beginIndex, int *endIndex);
+    bool hasRemainingWork() const;
+
+    class SlotClaim
+    {
+    public:
+        explicit SlotClaim(RangePartitioner *_partitioner)
+            : partitioner(_partitioner), m_slot(_partitioner->claimSlot())
+        { }
+        ~SlotClaim() { partitioner->releaseSlot(m_slot); }
+
+        int slot() const { return m_slot; }
+
+    private:
+        RangePartitioner *partitioner;
+        const int m_slot;
+
+        Q_DISABLE_COPY(SlotClaim)
+    };
+
+private:
+    bool takeBlock(int slot, int blockSize, int *beginIndex, int *endIndex);
+    bool steal(int slot, int blockSize, int *beginIndex, int *endIndex);
+
+    struct Slot;
+    std::unique_ptr<Slot[]> rangeSlots;
+    int slotCount;
+    int maxBlockSize;
+
+    Q_DISABLE_COPY(RangePartitioner)
+};
+
 template <typename T>
 class ResultReporter
 {
@@ -187,6 +237,8 @@ public:
            forIteration(selectIteration(typename std::iterator_traits<Iterator>::iterator_category())), progressReportingEnabled(true)
     {
         iterationCount =  forIteration ? std::distance(_begin, _end) : 0;
+        if (forIteration)
+            partitioner.reset(iterationCount);
     }
 
     virtual ~IterateKernel() { }
@@ -206,7 +258,7 @@ public:
     bool shouldStartThread() override
     {
         if (forIteration)
-            return (currentIndex.loadRelaxed() < iterationCount) && !this->shouldThrottleThread();
+            return partitioner.hasRemainingWork() && !this->shouldThrottleThread();
         else // whileIteration
             return (iteratorThreads.loadRelaxed() == 0);
     }
@@ -223,6 +275,7 @@ public:
     {
         BlockSizeManagerV2 blockSizeManager(iterationCount);
         ResultReporter<T> resultReporter(this);
+        const RangePartitioner::SlotClaim claim(&partitioner);
 
         for(;;) {
             if (this->isCanceled())
@@ -230,14 +283,10 @@ public:
 
             const int currentBlockSize = blockSizeManager.blockSize();
 
-            if (currentIndex.loadRelaxed() >= iterationCount)
-                break;
-
-            // Atomically reserve a block of iterationCount for this thread.
-            const int beginIndex = currentIndex.fetchAndAddRelease(currentBlockSize);
-            const int endIndex = qMin(beginIndex + currentBlockSize, iterationCount);
-
-            if (beginIndex >= endIndex) {
+            // Reserve a block of at least currentBlockSize iterations for this thread.
+            int beginIndex;
+            int endIndex;
+            if (!partitioner.nextBlock(claim.slot(), currentBlockSize, &beginIndex, &endIndex)) {
                 // No more work
                 break;
             }
@@ -318,6 +367,7 @@ public:
 
     bool progressReportingEnabled;
     QAtomicInt completed;
+    RangePartitioner partitioner;
 };
 
 } // namespace QtConcurrent
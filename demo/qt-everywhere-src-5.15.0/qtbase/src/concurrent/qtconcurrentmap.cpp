@@ -127,8 +127,16 @@
     \value OrderedReduce Reduction is done in the order of the
     original sequence.
     \value SequentialReduce Reduction is done sequentially: only one
-    thread will enter the reduce function at a time. (Parallel reduction
-    might be supported in a future version of Qt Concurrent.)
+    thread will enter the reduce function at a time.
+    \value ParallelReduce Reduction is done in an arbitrary order by
+    several threads at once. Each thread reduces into its own
+    default-constructed partial result, and the partial results are passed
+    to the reduce function as the intermediate value and combined pairwise
+    when the map or filter step is done. The reduce function must be
+    associative and commutative, must be safe to call from several threads
+    for different result variables, and must accept the result type as its
+    second argument; otherwise this option is ignored. It has no effect
+    together with OrderedReduce. (This value was introduced in 5.16.)
 */
 
 /*!
@@ -221,6 +229,14 @@
     undefined, while QtConcurrent::OrderedReduce ensures that the reduction
     is done in the order of the original sequence.
 
+    When the reduce operation is associative, such as a sum or a histogram,
+    the reduction itself can be spread over the worker threads with
+    QtConcurrent::ParallelReduce. Each thread then reduces into a partial
+    result of its own, and the partial results are merged into \e{result}
+    by calling the reduce function with a partial result as the
+    intermediate value. In this mode reduce is called by several threads
+    at a time, but never on the same result variable.
+
     \section1 Additional API Features
 
     \section2 Using Iterators instead of Sequence
@@ -48,11 +48,16 @@
 #include <QtCore/qlist.h>
 #include <QtCore/qmap.h>
 #include <QtCore/qmutex.h>
+#include <QtCore/qsemaphore.h>
 #include <QtCore/qthread.h>
 #include <QtCore/qthreadpool.h>
 #include <QtCore/qvector.h>
 
+#include <memory>
 #include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
@@ -92,12 +97,24 @@ public:
 enum ReduceOption {
     UnorderedReduce = 0x1,
     OrderedReduce = 0x2,
-    SequentialReduce = 0x4
-    // ParallelReduce = 0x8
+    SequentialReduce = 0x4,
+    ParallelReduce = 0x8
 };
 Q_DECLARE_FLAGS(ReduceOptions, ReduceOption)
 #ifndef Q_CLANG_QDOC
 Q_DECLARE_OPERATORS_FOR_FLAGS(ReduceOptions)
+
+// ParallelReduce combines partial results by passing them to the reduce
+// functor as the intermediate value; for functors that don't take that,
+// the option is ignored.
+template <typename ReduceFunctor, typename ReduceResultType, typename = void>
+struct CanCombineReduceResults : std::false_type {};
+
+template <typename ReduceFunctor, typename ReduceResultType>
+struct CanCombineReduceResults<ReduceFunctor, ReduceResultType,
+        decltype(void(std::declval<ReduceFunctor &>()(std::declval<ReduceResultType &>(),
+                                                       std::declval<const ReduceResultType &>())))>
+    : std::true_type {};
 #endif
 // supports both ordered and out-of-order reduction
 template <typename ReduceFunctor, typename ReduceResultType, typename T>
@@ -107,10 +124,75 @@ class ReduceKernel
 
     const ReduceOptions reduceOptions;
 
+    typedef CanCombineReduceResults<ReduceFunctor, ReduceResultType> CanCombine;
+
     QMutex mutex;
     int progress, resultsMapSize, threadCount;
     ResultsMap resultsMap;
 
+    // ParallelReduce: one partial result for each thread reducing at the
+    // same time; the mutex only guards handing them out
+    std::vector<std::unique_ptr<ReduceResultType>> partialResults;
+    std::vector<ReduceResultType *> idlePartialResults;
+
+    bool isParallel() const
+    {
+        return CanCombine::value
+                && (reduceOptions & ParallelReduce)
+                && !(reduceOptions & OrderedReduce);
+    }
+
+    ReduceResultType *acquirePartialResult()
+    {
+        std::lock_guard<QMutex> locker(mutex);
+        if (idlePartialResults.empty()) {
+            partialResults.emplace_back(new ReduceResultType());
+            return partialResults.back().get();
+        }
+        ReduceResultType *partial = idlePartialResults.back();
+        idlePartialResults.pop_back();
+        return partial;
+    }
+
+    void releasePartialResult(ReduceResultType *partial)
+    {
+        std::lock_guard<QMutex> locker(mutex);
+        idlePartialResults.push_back(partial);
+    }
+
+    void combinePartialResults(ReduceFunctor &, ReduceResultType &, std::false_type)
+    {
+    }
+
+    // Combines the partial results pairwise, level by level, so that the
+    // combination takes log2(n) steps when the thread pool has threads to
+    // spare for it.
+    void combinePartialResults(ReduceFunctor &reduce, ReduceResultType &r, std::true_type)
+    {
+        const size_t count = partialResults.size();
+        for (size_t step = 1; step < count; step *= 2) {
+            QSemaphore done;
+            int started = 0;
+            for (size_t i = 2 * step; i + step < count; i += 2 * step) {
+                ReduceResultType *target = partialResults[i].get();
+                ReduceResultType *source = partialResults[i + step].get();
+                const auto combine = [&reduce, &done, target, source]() {
+                    reduce(*target, *source);
+                    done.release();
+                };
+                if (!QThreadPool::globalInstance()->tryStart(combine))
+                    combine();
+                ++started;
+            }
+            reduce(*partialResults[0], *partialResults[step]);
+            done.acquire(started);
+        }
+        if (count > 0)
+            reduce(r, *partialResults[0]);
+        partialResults.clear();
+        idlePartialResults.clear();
+    }
+
     bool canReduce(int begin) const
     {
         return (((reduceOptions & UnorderedReduce)
@@ -149,6 +231,13 @@ public:
                    ReduceResultType &r,
                    const IntermediateResults<T> &result)
     {
+        if (isParallel()) {
+            ReduceResultType *partial = acquirePartialResult();
+            reduceResult(reduce, *partial, result);
+            releasePartialResult(partial);
+            return;
+        }
+
         std::unique_lock<QMutex> locker(mutex);
         if (!canReduce(result.begin)) {
             ++resultsMapSize;
@@ -208,6 +297,7 @@ public:
     void finish(ReduceFunctor &reduce, ReduceResultType &r)
     {
         reduceResults(reduce, r, resultsMap);
+        combinePartialResults(reduce, r, CanCombine());
     }
 
     inline bool shouldThrottle()
@@ -370,6 +370,273 @@ static inline const uchar *simdFindNonAscii(const uchar *src, const uchar *end,
 }
 #endif
 
+// The functions below transcode blocks made of one-, two- and three-byte
+// UTF-8 sequences (that is, text in the BMP) without going back to the
+// character-by-character code. They are called when the ASCII functions above
+// stopped at a non-ASCII character and they return as soon as they find a
+// block they cannot handle (four-byte sequences, surrogates or invalid input),
+// leaving it to the regular code to deal with it.
+//
+// The decoder looks at 16 bytes at a time. Each byte is decoded as if it
+// started a sequence, the sequence boundaries are validated with bit masks
+// and the real characters are then extracted from the decoded block.
+// It needs two bytes of lookahead for sequences starting in the last bytes of
+// the block.
+//
+// The encoder converts 8 code units at a time and writes each character as a
+// 32-bit word, advancing by the number of bytes the character really needs.
+// That writes up to 4 bytes past the end of the last character, which is why
+// it requires one more code unit than it converts: the caller's buffer has
+// room for 3 bytes per code unit.
+
+#if QT_COMPILER_SUPPORTS_HERE(SSE4_1) \
+    || (defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64) && Q_BYTE_ORDER == Q_LITTLE_ENDIAN)
+#  define QT_HAVE_SIMD_UTF8_BLOCKS
+static Q_ALWAYS_INLINE bool simdCheckUtf8Block(uint ascii, uint cont, uint lead3, uint bad,
+                                               const uchar *src, uint &expected)
+{
+    // continuation bytes the lead bytes in [src, src + 16) need, including
+    // the two bytes after the block
+    const uint lead2 = ~(ascii | cont | lead3) & 0xffff;
+    expected = (lead2 << 1) | (lead3 << 1) | (lead3 << 2);
+    const uint tail = uint(QUtf8Functions::isContinuationByte(src[16]))
+            | uint(QUtf8Functions::isContinuationByte(src[17])) << 1;
+    const uint actual = cont | (tail << 16);
+
+    // every continuation byte in the block must be expected and every
+    // expected byte past it must be a continuation byte
+    return !bad && (actual & (expected | 0xffff)) == expected;
+}
+
+static Q_ALWAYS_INLINE void simdCompactUtf8Block(ushort *&dst, const ushort *decoded, uint starts)
+{
+    do {
+        *dst++ = decoded[qCountTrailingZeroBits(starts)];
+        starts &= starts - 1;
+    } while (starts);
+}
+
+static Q_ALWAYS_INLINE void simdStoreUtf8Words(uchar *&dst, const quint32 *words, const uchar *lengths)
+{
+    // the words hold the bytes in memory order
+    for (int i = 0; i < 8; ++i) {
+        qToUnaligned(words[i], dst);
+        dst += lengths[i];
+    }
+}
+#endif
+
+#if QT_COMPILER_SUPPORTS_HERE(SSE4_1)
+QT_FUNCTION_TARGET(SSE4_1)
+static void simdDecodeNonAsciiSse41(ushort *&dst, const uchar *&src, const uchar *end)
+{
+    const __m128i contLimit = _mm_set1_epi8(char(0xc0));
+    for ( ; end - src >= 18; ) {
+        const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 1));
+        const __m128i b2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 2));
+
+        // classify the bytes; the comparisons are signed, so 0x80 to 0xff
+        // compare lower than US-ASCII
+        const uint ascii = ~_mm_movemask_epi8(b0) & 0xffff;
+        const uint cont = _mm_movemask_epi8(_mm_cmplt_epi8(b0, contLimit));
+        const uint aboveC1 = _mm_movemask_epi8(_mm_cmpgt_epi8(b0, _mm_set1_epi8(char(0xc1)))) & ~ascii;
+        const uint aboveDF = _mm_movemask_epi8(_mm_cmpgt_epi8(b0, _mm_set1_epi8(char(0xdf)))) & ~ascii;
+        const uint aboveEF = _mm_movemask_epi8(_mm_cmpgt_epi8(b0, _mm_set1_epi8(char(0xef)))) & ~ascii;
+
+        // 0xc0 and 0xc1 only start overlong sequences, 0xe0 must be followed
+        // by at least 0xa0 and 0xed by less than 0xa0 (surrogates), and we
+        // leave four-byte sequences to the regular code
+        const uint e0 = _mm_movemask_epi8(_mm_cmpeq_epi8(b0, _mm_set1_epi8(char(0xe0))));
+        const uint ed = _mm_movemask_epi8(_mm_cmpeq_epi8(b0, _mm_set1_epi8(char(0xed))));
+        const uint belowA0 = _mm_movemask_epi8(_mm_cmplt_epi8(b1, _mm_set1_epi8(char(0xa0))));
+        const uint bad = (~(ascii | cont | aboveC1) & 0xffff) | aboveEF
+                | (e0 & belowA0) | (ed & ~belowA0);
+
+        const uint lead3 = aboveDF & ~aboveEF;
+        uint expected;
+        if (!simdCheckUtf8Block(ascii, cont, lead3, bad, src, expected))
+            return;
+
+        // decode every position as ASCII, two- and three-byte sequence and
+        // pick the right one
+        ushort decoded[16];
+        const __m128i mask6 = _mm_set1_epi16(0x3f);
+        for (int half = 0; half < 2; ++half) {
+            const __m128i c0 = _mm_cvtepu8_epi16(half ? _mm_srli_si128(b0, 8) : b0);
+            const __m128i c1 = _mm_and_si128(_mm_cvtepu8_epi16(half ? _mm_srli_si128(b1, 8) : b1), mask6);
+            const __m128i c2 = _mm_and_si128(_mm_cvtepu8_epi16(half ? _mm_srli_si128(b2, 8) : b2), mask6);
+
+            const __m128i two = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(c0, _mm_set1_epi16(0x1f)), 6), c1);
+            const __m128i three = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(c0, 12), _mm_slli_epi16(c1, 6)), c2);
+
+            __m128i r = _mm_blendv_epi8(c0, two, _mm_cmpgt_epi16(c0, _mm_set1_epi16(0x7f)));
+            r = _mm_blendv_epi8(r, three, _mm_cmpgt_epi16(c0, _mm_set1_epi16(0xdf)));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(decoded) + half, r);
+        }
+
+        simdCompactUtf8Block(dst, decoded, ~cont & 0xffff);
+        src += 16 + qPopulationCount(expected >> 16);
+    }
+}
+
+QT_FUNCTION_TARGET(SSE4_1)
+static void simdEncodeNonAsciiSse41(uchar *&dst, const ushort *&src, const ushort *end)
+{
+    const __m128i mask6 = _mm_set1_epi16(0x3f);
+    for ( ; end - src > 8; src += 8) {
+        const __m128i u = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+
+        // leave surrogates to the regular code
+        const __m128i surrogates = _mm_cmpeq_epi16(_mm_and_si128(u, _mm_set1_epi16(short(0xf800))),
+                                                   _mm_set1_epi16(short(0xd800)));
+        if (!_mm_testz_si128(surrogates, surrogates))
+            return;
+
+        // unsigned comparisons: x < limit if min(x, limit - 1) == x
+        const __m128i isAscii = _mm_cmpeq_epi16(_mm_min_epu16(u, _mm_set1_epi16(0x7f)), u);
+        const __m128i isTwo = _mm_cmpeq_epi16(_mm_min_epu16(u, _mm_set1_epi16(0x7ff)), u);
+
+        const __m128i first = _mm_blendv_epi8(
+                    _mm_blendv_epi8(_mm_or_si128(_mm_srli_epi16(u, 12), _mm_set1_epi16(0xe0)),
+                                    _mm_or_si128(_mm_srli_epi16(u, 6), _mm_set1_epi16(0xc0)), isTwo),
+                    u, isAscii);
+        const __m128i last = _mm_or_si128(_mm_and_si128(u, mask6), _mm_set1_epi16(0x80));
+        const __m128i middle = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(u, 6), mask6), _mm_set1_epi16(0x80));
+        const __m128i second = _mm_blendv_epi8(middle, last, isTwo);
+
+        // bytes 0 and 1 in the low half of each word, byte 2 in the high half
+        const __m128i low = _mm_or_si128(first, _mm_slli_epi16(second, 8));
+        quint32 words[8];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(words), _mm_unpacklo_epi16(low, last));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(words) + 1, _mm_unpackhi_epi16(low, last));
+
+        // 3 bytes per character, minus one if it's < U+0800 and another if it's ASCII
+        const __m128i lengths16 = _mm_add_epi16(_mm_set1_epi16(3), _mm_add_epi16(isAscii, isTwo));
+        uchar lengths[16];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lengths), _mm_packus_epi16(lengths16, lengths16));
+
+        simdStoreUtf8Words(dst, words, lengths);
+    }
+}
+#endif
+
+#if defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64) && Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+static inline uint neonMovemask(uint8x16_t v)
+{
+    // one bit per byte that has all bits set
+    const uint8x16_t bits = { 1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7,
+                              1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7 };
+    const uint8x16_t masked = vandq_u8(v, bits);
+    return vaddv_u8(vget_low_u8(masked)) | (uint(vaddv_u8(vget_high_u8(masked))) << 8);
+}
+
+static void simdDecodeNonAsciiNeon(ushort *&dst, const uchar *&src, const uchar *end)
+{
+    for ( ; end - src >= 18; ) {
+        const uint8x16_t b0 = vld1q_u8(src);
+        const uint8x16_t b1 = vld1q_u8(src + 1);
+        const uint8x16_t b2 = vld1q_u8(src + 2);
+
+        const uint ascii = neonMovemask(vcltq_u8(b0, vdupq_n_u8(0x80)));
+        const uint cont = neonMovemask(vcltq_u8(b0, vdupq_n_u8(0xc0))) & ~ascii;
+        const uint aboveC1 = neonMovemask(vcgtq_u8(b0, vdupq_n_u8(0xc1)));
+        const uint aboveDF = neonMovemask(vcgtq_u8(b0, vdupq_n_u8(0xdf)));
+        const uint aboveEF = neonMovemask(vcgtq_u8(b0, vdupq_n_u8(0xef)));
+        const uint e0 = neonMovemask(vceqq_u8(b0, vdupq_n_u8(0xe0)));
+        const uint ed = neonMovemask(vceqq_u8(b0, vdupq_n_u8(0xed)));
+        const uint belowA0 = neonMovemask(vcltq_u8(b1, vdupq_n_u8(0xa0)));
+        const uint bad = (~(ascii | cont | aboveC1) & 0xffff) | aboveEF
+                | (e0 & belowA0) | (ed & ~belowA0);
+
+        const uint lead3 = aboveDF & ~aboveEF;
+        uint expected;
+        if (!simdCheckUtf8Block(ascii, cont, lead3, bad, src, expected))
+            return;
+
+        ushort decoded[16];
+        const uint16x8_t mask6 = vdupq_n_u16(0x3f);
+        for (int half = 0; half < 2; ++half) {
+            const uint16x8_t c0 = vmovl_u8(half ? vget_high_u8(b0) : vget_low_u8(b0));
+            const uint16x8_t c1 = vandq_u16(vmovl_u8(half ? vget_high_u8(b1) : vget_low_u8(b1)), mask6);
+            const uint16x8_t c2 = vandq_u16(vmovl_u8(half ? vget_high_u8(b2) : vget_low_u8(b2)), mask6);
+
+            const uint16x8_t two = vorrq_u16(vshlq_n_u16(vandq_u16(c0, vdupq_n_u16(0x1f)), 6), c1);
+            const uint16x8_t three = vorrq_u16(vorrq_u16(vshlq_n_u16(c0, 12), vshlq_n_u16(c1, 6)), c2);
+
+            uint16x8_t r = vbslq_u16(vcgtq_u16(c0, vdupq_n_u16(0x7f)), two, c0);
+            r = vbslq_u16(vcgtq_u16(c0, vdupq_n_u16(0xdf)), three, r);
+            vst1q_u16(decoded + 8 * half, r);
+        }
+
+        simdCompactUtf8Block(dst, decoded, ~cont & 0xffff);
+        src += 16 + qPopulationCount(expected >> 16);
+    }
+}
+
+static void simdEncodeNonAsciiNeon(uchar *&dst, const ushort *&src, const ushort *end)
+{
+    const uint16x8_t mask6 = vdupq_n_u16(0x3f);
+    for ( ; end - src > 8; src += 8) {
+        const uint16x8_t u = vld1q_u16(src);
+
+        // leave surrogates to the regular code
+        if (vmaxvq_u16(vceqq_u16(vandq_u16(u, vdupq_n_u16(0xf800)), vdupq_n_u16(0xd800))))
+            return;
+
+        const uint16x8_t isAscii = vcleq_u16(u, vdupq_n_u16(0x7f));
+        const uint16x8_t isTwo = vcleq_u16(u, vdupq_n_u16(0x7ff));
+
+        const uint16x8_t first = vbslq_u16(isAscii, u,
+                    vbslq_u16(isTwo, vorrq_u16(vshrq_n_u16(u, 6), vdupq_n_u16(0xc0)),
+                              vorrq_u16(vshrq_n_u16(u, 12), vdupq_n_u16(0xe0))));
+        const uint16x8_t last = vorrq_u16(vandq_u16(u, mask6), vdupq_n_u16(0x80));
+        const uint16x8_t middle = vorrq_u16(vandq_u16(vshrq_n_u16(u, 6), mask6), vdupq_n_u16(0x80));
+        const uint16x8_t second = vbslq_u16(isTwo, last, middle);
+
+        const uint16x8_t low = vorrq_u16(first, vshlq_n_u16(second, 8));
+        quint32 words[8];
+        vst1q_u32(words, vreinterpretq_u32_u16(vzip1q_u16(low, last)));
+        vst1q_u32(words + 4, vreinterpretq_u32_u16(vzip2q_u16(low, last)));
+
+        // the comparison results are all bits set, that is, -1
+        const uint16x8_t lengths16 = vaddq_u16(vdupq_n_u16(3), vaddq_u16(isAscii, isTwo));
+        uchar lengths[8];
+        vst1_u8(lengths, vmovn_u16(lengths16));
+
+        simdStoreUtf8Words(dst, words, lengths);
+    }
+}
+#endif
+
+static inline void simdDecodeNonAscii(ushort *&dst, const uchar *&src, const uchar *end)
+{
+#if QT_COMPILER_SUPPORTS_HERE(SSE4_1)
+    if (qCpuHasFeature(SSE4_1))
+        simdDecodeNonAsciiSse41(dst, src, end);
+#elif defined(QT_HAVE_SIMD_UTF8_BLOCKS)
+    simdDecodeNonAsciiNeon(dst, src, end);
+#else
+    Q_UNUSED(dst);
+    Q_UNUSED(src);
+    Q_UNUSED(end);
+#endif
+}
+
+static inline void simdEncodeNonAscii(uchar *&dst, const ushort *&src, const ushort *end)
+{
+#if QT_COMPILER_SUPPORTS_HERE(SSE4_1)
+    if (qCpuHasFeature(SSE4_1))
+        simdEncodeNonAsciiSse41(dst, src, end);
+#elif defined(QT_HAVE_SIMD_UTF8_BLOCKS)
+    simdEncodeNonAsciiNeon(dst, src, end);
+#else
+    Q_UNUSED(dst);
+    Q_UNUSED(src);
+    Q_UNUSED(end);
+#endif
+}
+
 QByteArray QUtf8::convertFromUnicode(const QChar *uc, int len)
 {
     // create a QByteArray with the worst case scenario size
@@ -383,14 +650,15 @@ QByteArray QUtf8::convertFromUnicode(const QChar *uc, int len)
         if (simdEncodeAscii(dst, nextAscii, src, end))
             break;
 
-        do {
+        simdEncodeNonAscii(dst, src, end);
+        while (src < nextAscii) {
             ushort uc = *src++;
             int res = QUtf8Functions::toUtf8<QUtf8BaseTraits>(uc, dst, src, end);
             if (res < 0) {
                 // encoding error - append '?'
                 *dst++ = '?';
             }
-        } while (src < nextAscii);
+        }
     }
 
     result.truncate(dst - reinterpret_cast<uchar *>(const_cast<char *>(result.constData())));
@@ -434,8 +702,11 @@ QByteArray QUtf8::convertFromUnicode(const QChar *uc, int len, QTextCodec::Conve
             surrogate_high = -1;
             res = QUtf8Functions::toUtf8<QUtf8BaseTraits>(uc, cursor, src, end);
         } else {
-            if (src >= nextAscii && simdEncodeAscii(cursor, nextAscii, src, end))
-                break;
+            if (src >= nextAscii) {
+                if (simdEncodeAscii(cursor, nextAscii, src, end))
+                    break;
+                simdEncodeNonAscii(cursor, src, end);
+            }
 
             uc = *src++;
             res = QUtf8Functions::toUtf8<QUtf8BaseTraits>(uc, cursor, src, end);
@@ -526,14 +797,15 @@ QChar *QUtf8::convertToUnicode(QChar *buffer, const char *chars, int len) noexce
             if (simdDecodeAscii(dst, nextAscii, src, end))
                 break;
 
-            do {
+            simdDecodeNonAscii(dst, src, end);
+            while (src < nextAscii) {
                 uchar b = *src++;
                 int res = QUtf8Functions::fromUtf8<QUtf8BaseTraits>(b, dst, src, end);
                 if (res < 0) {
                     // decoding error
                     *dst++ = QChar::ReplacementCharacter;
                 }
-            } while (src < nextAscii);
+            }
         }
     }
 
@@ -613,8 +885,16 @@ QString QUtf8::convertToUnicode(const char *chars, int len, QTextCodec::Converte
     const uchar *nextAscii = src;
     const uchar *start = src;
     while (res >= 0 && src < end) {
-        if (src >= nextAscii && simdDecodeAscii(dst, nextAscii, src, end))
-            break;
+        if (src >= nextAscii) {
+            if (simdDecodeAscii(dst, nextAscii, src, end))
+                break;
+            if (headerdone) {
+                // the BOM check below needs to see the first character
+                simdDecodeNonAscii(dst, src, end);
+                if (src == end)
+                    break;
+            }
+        }
 
         ch = *src++;
         res = QUtf8Functions::fromUtf8<QUtf8BaseTraits>(ch, dst, src, end);
@@ -1086,6 +1086,14 @@ struct QMessagePattern {
     QList<QString> timeArgs;   // timeFormats in sequence of %{time
 #ifndef QT_BOOTSTRAPPED
     QElapsedTimer timer;
+    // last wall clock time formatted for each %{time}; formats without
+    // milliseconds are only reformatted when the second changes
+    struct TimeCache {
+        qint64 seconds = -1;
+        QString text;
+        bool perSecond = false;
+    };
+    QVector<TimeCache> timeCache;
 #endif
 #ifdef QLOGGING_HAVE_BACKTRACE
     struct BacktraceParams {
@@ -1125,6 +1133,9 @@ QMessagePattern::~QMessagePattern()
 void QMessagePattern::setPattern(const QString &pattern)
 {
     timeArgs.clear();
+#ifndef QT_BOOTSTRAPPED
+    timeCache.clear();
+#endif
 #ifdef QLOGGING_HAVE_BACKTRACE
     backtraceArgs.clear();
 #endif
@@ -1201,6 +1212,11 @@ void QMessagePattern::setPattern(const QString &pattern)
                     timeArgs.append(lexeme.mid(spaceIdx + 1, lexeme.length() - spaceIdx - 2));
                 else
                     timeArgs.append(QString());
+#ifndef QT_BOOTSTRAPPED
+                TimeCache cache;
+                cache.perSecond = !timeArgs.constLast().contains(QLatin1Char('z'));
+                timeCache.append(cache);
+#endif
             } else if (lexeme.startsWith(QLatin1String(backtraceTokenC))) {
 #ifdef QLOGGING_HAVE_BACKTRACE
                 tokens[i] = backtraceTokenC;
@@ -1452,7 +1468,7 @@ QString qFormatLogMessage(QtMsgType type, const QMessageLogContext &context, con
             message.append(formatBacktraceForLogMessage(backtraceParams, context.function));
 #endif
         } else if (token == timeTokenC) {
-            QString timeFormat = pattern->timeArgs.at(timeArgsIdx);
+            const QString &timeFormat = pattern->timeArgs.at(timeArgsIdx);
             timeArgsIdx++;
             if (timeFormat == QLatin1String("process")) {
                     quint64 ms = pattern->timer.elapsed();
@@ -1465,10 +1481,16 @@ QString qFormatLogMessage(QtMsgType type, const QMessageLogContext &context, con
                 uint ms = now.msecsSinceReference();
                 message.append(QString::asprintf("%6d.%03d", uint(ms / 1000), uint(ms % 1000)));
 #if QT_CONFIG(datestring)
-            } else if (timeFormat.isEmpty()) {
-                    message.append(QDateTime::currentDateTime().toString(Qt::ISODate));
             } else {
-                message.append(QDateTime::currentDateTime().toString(timeFormat));
+                QMessagePattern::TimeCache &timeCache = pattern->timeCache[timeArgsIdx - 1];
+                const qint64 msecs = QDateTime::currentMSecsSinceEpoch();
+                if (!timeCache.perSecond || timeCache.seconds != msecs / 1000) {
+                    const QDateTime now = QDateTime::fromMSecsSinceEpoch(msecs);
+                    timeCache.text = timeFormat.isEmpty() ? now.toString(Qt::ISODate)
+                                                          : now.toString(timeFormat);
+                    timeCache.seconds = msecs / 1000;
+                }
+                message.append(timeCache.text);
 #endif // QT_CONFIG(datestring)
             }
 #endif // !QT_BOOTSTRAPPED
@@ -1746,7 +1768,10 @@ static void stderr_message_handler(QtMsgType type, const QMessageLogContext &con
     if (formattedMessage.isNull())
         return;
 
-    fprintf(stderr, "%s\n", formattedMessage.toLocal8Bit().constData());
+    // write the line with its terminator in a single call, without a format string
+    QByteArray line = formattedMessage.toLocal8Bit();
+    line.append('\n');
+    fwrite(line.constData(), 1, size_t(line.size()), stderr);
     fflush(stderr);
 }
 
@@ -107,6 +107,11 @@ qtConfig(filesystemwatcher) {
     }
 }
 
+qtConfig(thread) {
+    HEADERS += io/qdirwalker_p.h
+    SOURCES += io/qdirwalker.cpp
+}
+
 qtConfig(processenvironment) {
     SOURCES += \
         io/qprocess.cpp
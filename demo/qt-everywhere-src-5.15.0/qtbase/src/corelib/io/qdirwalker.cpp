@@ -0,0 +1,525 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qdirwalker_p.h"
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qset.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qvector.h>
+#include <QtCore/qwaitcondition.h>
+#if QT_CONFIG(regularexpression)
+#include <QtCore/qregularexpression.h>
+#endif
+
+#include <QtCore/private/qfilesystemiterator_p.h>
+#include <QtCore/private/qfilesystementry_p.h>
+#include <QtCore/private/qfilesystemmetadata_p.h>
+#include <QtCore/private/qfilesystemengine_p.h>
+#include <QtCore/private/qfileinfo_p.h>
+
+#ifndef QT_NO_FILESYSTEMITERATOR
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QDirWalker
+    \inmodule QtCore
+    \internal
+    \since 5.16
+
+    \brief The QDirWalker class traverses a directory tree on several
+    threads at once.
+
+    QDirWalker visits the same entries as a QDirIterator constructed with
+    the same path, filters and flags, but it scans the subdirectories it
+    finds in parallel on the threads of a QThreadPool and hands every
+    matching entry to a callback. The callback is invoked concurrently from
+    all the threads taking part in the walk, in no particular order, so it
+    must be thread-safe. The entries \c{.} and \c{..} are never reported.
+
+    Only the metadata named by fields() is fetched up front and cached in
+    the QFileInfo passed to the callback; the default is just the file type,
+    which on most platforms comes with the directory listing itself, so no
+    stat call is made for ordinary files and directories. On Linux, the
+    remaining fields are fetched with a single statx() call relative to the
+    open directory, asking the kernel only for what was requested. Anything
+    else the callback asks the QFileInfo for is fetched lazily, as usual.
+
+    \sa QDirIterator
+*/
+
+/*!
+    \enum QDirWalker::Field
+
+    This enum describes the metadata to fetch for each entry before it is
+    passed to the callback.
+
+    \value NoFields Nothing beyond what the directory listing provides.
+    \value TypeField Whether the entry is a file, a directory or a symbolic
+           link, following the link.
+    \value PermissionsField The permissions of the entry.
+    \value SizeField The size of the entry.
+    \value TimesField The access, birth, metadata change and modification times.
+    \value OwnerField The owner and group ids of the entry.
+    \value AllFields All of the above.
+*/
+
+/*!
+    \typedef QDirWalker::Callback
+
+    Synonym for \c{std::function<void (const QFileInfo &)>}.
+*/
+
+static QFileSystemMetaData::MetaDataFlags metaDataFlagsForFields(QDirWalker::Fields fields)
+{
+    // we always need the type to decide whether to descend and to filter
+    QFileSystemMetaData::MetaDataFlags flags = QFileSystemMetaData::LinkType
+            | QFileSystemMetaData::FileType
+            | QFileSystemMetaData::DirectoryType
+            | QFileSystemMetaData::SequentialType
+            | QFileSystemMetaData::ExistsAttribute;
+    if (fields & QDirWalker::PermissionsField)
+        flags |= QFileSystemMetaData::Permissions;
+    if (fields & QDirWalker::SizeField)
+        flags |= QFileSystemMetaData::SizeAttribute;
+    if (fields & QDirWalker::TimesField)
+        flags |= QFileSystemMetaData::Times;
+    if (fields & QDirWalker::OwnerField)
+        flags |= QFileSystemMetaData::OwnerIds;
+    return flags;
+}
+
+class QDirWalkerPrivate
+{
+public:
+    QDirWalkerPrivate(const QFileSystemEntry &entry, const QStringList &nameFilters,
+                      QDir::Filters filters, QDirIterator::IteratorFlags flags);
+
+    void work();
+    void scanDirectory(const QFileSystemEntry &directory);
+    void checkAndPushDirectory(const QFileSystemEntry &entry, const QFileInfo &fileInfo);
+    bool matchesFilters(const QString &fileName, const QFileInfo &fi) const;
+    void startHelper();
+
+    const QFileSystemEntry dirEntry;
+    const QStringList nameFilters;
+    const QDir::Filters filters;
+    const QDirIterator::IteratorFlags iteratorFlags;
+
+#if QT_CONFIG(regularexpression)
+    QVector<QRegularExpression> nameRegExps;
+#endif
+
+    QDirWalker::Fields fields;
+    QThreadPool *threadPool;
+
+    // State of the walk in progress, protected by mutex
+    QMutex mutex;
+    QWaitCondition workAvailable;
+    QWaitCondition helpersFinished;
+    QVector<QFileSystemEntry> pendingDirectories;
+    QSet<QString> visitedLinks;
+    const QDirWalker::Callback *callback;
+    QThreadPool *activePool;
+    QFileSystemMetaData::MetaDataFlags requiredFlags;
+    int busyWorkers;
+    int helpers;
+    int maxHelpers;
+
+    QAtomicInt canceled;
+};
+
+QDirWalkerPrivate::QDirWalkerPrivate(const QFileSystemEntry &entry, const QStringList &nameFilters,
+                                     QDir::Filters filters, QDirIterator::IteratorFlags flags)
+    : dirEntry(entry)
+      , nameFilters(nameFilters.contains(QLatin1String("*")) ? QStringList() : nameFilters)
+      , filters(QDir::NoFilter == filters ? QDir::AllEntries : filters)
+      , iteratorFlags(flags)
+      , fields(QDirWalker::TypeField)
+      , threadPool(nullptr)
+      , callback(nullptr)
+      , activePool(nullptr)
+      , busyWorkers(0)
+      , helpers(0)
+      , maxHelpers(0)
+{
+#if QT_CONFIG(regularexpression)
+    nameRegExps.reserve(nameFilters.size());
+    for (const auto &filter : nameFilters) {
+        QString re = QRegularExpression::wildcardToRegularExpression(filter);
+        nameRegExps.append(
+            QRegularExpression(re, (filters & QDir::CaseSensitive) ? QRegularExpression::NoPatternOption : QRegularExpression::CaseInsensitiveOption));
+    }
+#endif
+}
+
+/*!
+    \internal
+
+    Runs on every thread taking part in the walk: takes directories off the
+    shared list and scans them until there's nothing left to do and nobody
+    else can add to the list any more, or until the walk is canceled.
+*/
+void QDirWalkerPrivate::work()
+{
+    QMutexLocker locker(&mutex);
+    for (;;) {
+        while (pendingDirectories.isEmpty() && busyWorkers > 0 && !canceled.loadRelaxed())
+            workAvailable.wait(&mutex);
+        if (pendingDirectories.isEmpty() || canceled.loadRelaxed())
+            break;
+
+        // taking the most recent directory keeps the list short, like a
+        // depth-first walk would
+        const QFileSystemEntry directory = pendingDirectories.takeLast();
+        ++busyWorkers;
+        locker.unlock();
+        scanDirectory(directory);
+        locker.relock();
+        --busyWorkers;
+    }
+
+    // either we're done or canceled; let the others know
+    workAvailable.wakeAll();
+}
+
+/*!
+    \internal
+
+    Tries to get another thread from the pool to help. Called with the mutex
+    locked. Using tryStart() means we never queue behind other work in the
+    pool, nor do we depend on the pool having a free thread at all: the
+    thread that called walk() takes part too.
+*/
+void QDirWalkerPrivate::startHelper()
+{
+    if (helpers >= maxHelpers)
+        return;
+    ++helpers;
+    const bool started = activePool->tryStart([this]() {
+        work();
+        QMutexLocker locker(&mutex);
+        if (--helpers == 0)
+            helpersFinished.wakeAll();
+    });
+    if (!started)
+        --helpers;
+}
+
+void QDirWalkerPrivate::scanDirectory(const QFileSystemEntry &directory)
+{
+    QFileSystemIterator it(directory, filters, nameFilters, iteratorFlags);
+    QFileSystemEntry entry;
+    QFileSystemMetaData metaData;
+    while (!canceled.loadRelaxed() && it.advance(entry, metaData)) {
+        const QString fileName = entry.fileName();
+        if (fileName == QLatin1String(".") || fileName == QLatin1String(".."))
+            continue;
+
+        // Only stat what the directory listing didn't already tell us
+        const QFileSystemMetaData::MetaDataFlags missing = metaData.missingFlags(requiredFlags);
+        if (missing) {
+#if defined(Q_OS_WIN)
+            QFileSystemEngine::fillMetaData(entry, metaData, missing);
+#else
+            QFileSystemEngine::fillMetaDataAt(it.directoryFd(), entry, metaData, missing);
+#endif
+        }
+
+        const QFileInfo fileInfo(new QFileInfoPrivate(entry, metaData));
+        if (matchesFilters(fileName, fileInfo))
+            (*callback)(fileInfo);
+        checkAndPushDirectory(entry, fileInfo);
+    }
+}
+
+void QDirWalkerPrivate::checkAndPushDirectory(const QFileSystemEntry &entry, const QFileInfo &fileInfo)
+{
+    // If we're doing flat iteration, we're done.
+    if (!(iteratorFlags & QDirIterator::Subdirectories))
+        return;
+
+    // Never follow non-directory entries
+    if (!fileInfo.isDir())
+        return;
+
+    // Follow symlinks only when asked
+    if (!(iteratorFlags & QDirIterator::FollowSymlinks) && fileInfo.isSymLink())
+        return;
+
+    // No hidden directories unless requested
+    if (!(filters & QDir::AllDirs) && !(filters & QDir::Hidden) && fileInfo.isHidden())
+        return;
+
+    QFileSystemEntry directory = entry;
+#ifdef Q_OS_WIN
+    if (fileInfo.isSymLink())
+        directory = QFileSystemEntry(fileInfo.canonicalFilePath());
+#endif
+
+    QString canonicalPath;
+    if (iteratorFlags & QDirIterator::FollowSymlinks)
+        canonicalPath = fileInfo.canonicalFilePath();
+
+    QMutexLocker locker(&mutex);
+
+    // Stop link loops
+    if (iteratorFlags & QDirIterator::FollowSymlinks) {
+        if (visitedLinks.contains(canonicalPath))
+            return;
+        visitedLinks.insert(canonicalPath);
+    }
+
+    pendingDirectories.append(directory);
+    startHelper();
+    workAvailable.wakeOne();
+}
+
+bool QDirWalkerPrivate::matchesFilters(const QString &fileName, const QFileInfo &fi) const
+{
+    // name filter
+#if QT_CONFIG(regularexpression)
+    // Pass all entries through name filters, except dirs if the AllDirs
+    if (!nameFilters.isEmpty() && !((filters & QDir::AllDirs) && fi.isDir())) {
+        bool matched = false;
+        for (const auto &re : nameRegExps) {
+            if (re.match(fileName).hasMatch()) {
+                matched = true;
+                break;
+            }
+        }
+        if (!matched)
+            return false;
+    }
+#else
+    Q_UNUSED(fileName)
+#endif
+    // skip symlinks
+    const bool skipSymlinks = (filters & QDir::NoSymLinks);
+    const bool includeSystem = (filters & QDir::System);
+    if (skipSymlinks && fi.isSymLink()) {
+        // The only reason to save this file is if it is a broken link and we are requesting system files.
+        if (!includeSystem || fi.exists())
+            return false;
+    }
+
+    // filter hidden
+    const bool includeHidden = (filters & QDir::Hidden);
+    if (!includeHidden && fi.isHidden())
+        return false;
+
+    // filter system files
+    if (!includeSystem && (!(fi.isFile() || fi.isDir() || fi.isSymLink())
+                    || (!fi.exists() && fi.isSymLink())))
+        return false;
+
+    // skip directories
+    const bool skipDirs = !(filters & (QDir::Dirs | QDir::AllDirs));
+    if (skipDirs && fi.isDir())
+        return false;
+
+    // skip files
+    const bool skipFiles    = !(filters & QDir::Files);
+    if (skipFiles && fi.isFile())
+        // Basically we need a reason not to exclude this file otherwise we just eliminate it.
+        return false;
+
+    // filter permissions
+    const bool filterPermissions = ((filters & QDir::PermissionMask)
+                                    && (filters & QDir::PermissionMask) != QDir::PermissionMask);
+    const bool doWritable = !filterPermissions || (filters & QDir::Writable);
+    const bool doExecutable = !filterPermissions || (filters & QDir::Executable);
+    const bool doReadable = !filterPermissions || (filters & QDir::Readable);
+    if (filterPermissions
+        && ((doReadable && !fi.isReadable())
+            || (doWritable && !fi.isWritable())
+            || (doExecutable && !fi.isExecutable()))) {
+        return false;
+    }
+
+    return true;
+}
+
+/*!
+    Constructs a QDirWalker that walks \a path, reporting the entries that
+    match \a filters. The \a flags are interpreted as by QDirIterator:
+    QDirIterator::Subdirectories makes the walk recursive, and
+    QDirIterator::FollowSymlinks makes it descend into symbolic links to
+    directories.
+
+    \sa setFields(), walk()
+*/
+QDirWalker::QDirWalker(const QString &path, QDir::Filters filters, QDirIterator::IteratorFlags flags)
+    : d(new QDirWalkerPrivate(QFileSystemEntry(path), QStringList(), filters, flags))
+{
+}
+
+/*!
+    Constructs a QDirWalker that walks \a path, reporting the entries that
+    match \a filters and whose names match one of the wildcards in
+    \a nameFilters.
+
+    \sa QDirIterator::QDirIterator()
+*/
+QDirWalker::QDirWalker(const QString &path, const QStringList &nameFilters,
+                       QDir::Filters filters, QDirIterator::IteratorFlags flags)
+    : d(new QDirWalkerPrivate(QFileSystemEntry(path), nameFilters, filters, flags))
+{
+}
+
+/*!
+    Destroys the QDirWalker. It must not be destroyed while walk() is
+    running.
+*/
+QDirWalker::~QDirWalker()
+{
+}
+
+/*!
+    Returns the path of the directory this walker starts at.
+*/
+QString QDirWalker::path() const
+{
+    return d->dirEntry.filePath();
+}
+
+/*!
+    Sets the metadata fetched for each entry before it is passed to the
+    callback to \a fields. The default is TypeField.
+
+    Fetching fewer fields is cheaper: the entry type usually comes for free
+    with the directory listing, whereas any other field costs a stat call
+    per entry. Must not be called while walk() is running.
+*/
+void QDirWalker::setFields(Fields fields)
+{
+    d->fields = fields;
+}
+
+/*!
+    Returns the metadata fetched for each entry.
+
+    \sa setFields()
+*/
+QDirWalker::Fields QDirWalker::fields() const
+{
+    return d->fields;
+}
+
+/*!
+    Makes the walk use the threads of \a pool instead of those of
+    QThreadPool::globalInstance(). Passing \nullptr restores the default.
+    Must not be called while walk() is running.
+*/
+void QDirWalker::setThreadPool(QThreadPool *pool)
+{
+    d->threadPool = pool;
+}
+
+/*!
+    Returns the thread pool set with setThreadPool(), or \nullptr if the
+    global instance is used.
+*/
+QThreadPool *QDirWalker::threadPool() const
+{
+    return d->threadPool;
+}
+
+/*!
+    Walks the directory tree, calling \a callback for every matching entry,
+    and returns once the whole tree has been visited. Returns \c true if the
+    walk ran to completion and \c false if it was canceled.
+
+    The calling thread takes part in the walk, and so do as many threads of
+    the pool as are idle while there are directories waiting to be scanned;
+    \a callback is therefore called concurrently from several threads and
+    in no particular order. Directories that can't be read are skipped
+    silently, as QDirIterator does.
+
+    \sa cancel()
+*/
+bool QDirWalker::walk(const Callback &callback)
+{
+    QThreadPool *pool = d->threadPool ? d->threadPool : QThreadPool::globalInstance();
+
+    {
+        QMutexLocker locker(&d->mutex);
+        d->callback = &callback;
+        d->requiredFlags = metaDataFlagsForFields(d->fields);
+        d->maxHelpers = qMax(0, pool->maxThreadCount() - 1);
+        d->activePool = pool;
+        d->canceled.storeRelaxed(0);
+        d->visitedLinks.clear();
+        if (d->iteratorFlags & QDirIterator::FollowSymlinks)
+            d->visitedLinks.insert(QFileInfo(d->dirEntry.filePath()).canonicalFilePath());
+        d->pendingDirectories.clear();
+        d->pendingDirectories.append(d->dirEntry);
+    }
+
+    d->work();
+
+    QMutexLocker locker(&d->mutex);
+    while (d->helpers > 0)
+        d->helpersFinished.wait(&d->mutex);
+    d->activePool = nullptr;
+    d->callback = nullptr;
+    d->pendingDirectories.clear();
+    d->visitedLinks.clear();
+    return !d->canceled.loadRelaxed();
+}
+
+/*!
+    Stops the walk in progress as soon as possible: no further entries are
+    reported once the threads taking part have noticed. It is safe to call
+    this function from any thread, including from the callback.
+
+    \sa walk()
+*/
+void QDirWalker::cancel()
+{
+    QMutexLocker locker(&d->mutex);
+    d->canceled.storeRelaxed(1);
+    d->workAvailable.wakeAll();
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_FILESYSTEMITERATOR
@@ -0,0 +1,119 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QDIRWALKER_P_H
+#define QDIRWALKER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qdiriterator.h>
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qscopedpointer.h>
+#include <QtCore/qstringlist.h>
+
+#include <functional>
+
+QT_REQUIRE_CONFIG(thread);
+
+#ifndef QT_NO_FILESYSTEMITERATOR
+
+QT_BEGIN_NAMESPACE
+
+class QThreadPool;
+class QDirWalkerPrivate;
+
+class Q_CORE_EXPORT QDirWalker
+{
+public:
+    enum Field {
+        NoFields = 0x0,
+        TypeField = 0x1,
+        PermissionsField = 0x2,
+        SizeField = 0x4,
+        TimesField = 0x8,
+        OwnerField = 0x10,
+        AllFields = TypeField | PermissionsField | SizeField | TimesField | OwnerField
+    };
+    Q_DECLARE_FLAGS(Fields, Field)
+
+    typedef std::function<void (const QFileInfo &)> Callback;
+
+    explicit QDirWalker(const QString &path,
+                        QDir::Filters filters = QDir::NoFilter,
+                        QDirIterator::IteratorFlags flags = QDirIterator::Subdirectories);
+    QDirWalker(const QString &path, const QStringList &nameFilters,
+               QDir::Filters filters = QDir::NoFilter,
+               QDirIterator::IteratorFlags flags = QDirIterator::Subdirectories);
+    ~QDirWalker();
+
+    QString path() const;
+
+    void setFields(Fields fields);
+    Fields fields() const;
+
+    void setThreadPool(QThreadPool *pool);
+    QThreadPool *threadPool() const;
+
+    bool walk(const Callback &callback);
+    void cancel();
+
+private:
+    Q_DISABLE_COPY(QDirWalker)
+
+    QScopedPointer<QDirWalkerPrivate> d;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(QDirWalker::Fields)
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_FILESYSTEMITERATOR
+
+#endif // QDIRWALKER_P_H
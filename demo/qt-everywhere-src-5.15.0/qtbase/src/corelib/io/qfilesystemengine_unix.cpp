@@ -1052,6 +1052,106 @@ bool QFileSystemEngine::fillMetaData(const QFileSystemEntry &entry, QFileSystemM
     return true;
 }
 
+#ifdef STATX_BASIC_STATS
+static unsigned statxMaskForFlags(QFileSystemMetaData::MetaDataFlags what)
+{
+    // the mode and link count live in the inode itself and are always cheap
+    unsigned mask = STATX_TYPE | STATX_MODE | STATX_NLINK;
+    if (what & QFileSystemMetaData::SizeAttribute)
+        mask |= STATX_SIZE;
+    if (what & QFileSystemMetaData::Times)
+        mask |= STATX_ATIME | STATX_MTIME | STATX_CTIME | STATX_BTIME;
+    if (what & QFileSystemMetaData::OwnerIds)
+        mask |= STATX_UID | STATX_GID;
+    return mask;
+}
+
+static QFileSystemMetaData::MetaDataFlags flagsForStatxMask(unsigned mask)
+{
+    QFileSystemMetaData::MetaDataFlags flags = QFileSystemMetaData::ExistsAttribute;
+    if (mask & STATX_TYPE) {
+        flags |= QFileSystemMetaData::FileType
+                | QFileSystemMetaData::DirectoryType
+                | QFileSystemMetaData::SequentialType;
+    }
+    if (mask & STATX_MODE) {
+        flags |= QFileSystemMetaData::OtherPermissions
+                | QFileSystemMetaData::GroupPermissions
+                | QFileSystemMetaData::OwnerPermissions;
+    }
+    if (mask & STATX_NLINK)
+        flags |= QFileSystemMetaData::WasDeletedAttribute;
+    if (mask & STATX_SIZE)
+        flags |= QFileSystemMetaData::SizeAttribute;
+    if ((mask & (STATX_ATIME | STATX_MTIME | STATX_CTIME)) == (STATX_ATIME | STATX_MTIME | STATX_CTIME))
+        flags |= QFileSystemMetaData::Times;
+    if ((mask & (STATX_UID | STATX_GID)) == (STATX_UID | STATX_GID))
+        flags |= QFileSystemMetaData::OwnerIds;
+    return flags;
+}
+#endif
+
+//static
+bool QFileSystemEngine::fillMetaDataAt(int dirFd, const QFileSystemEntry &entry, QFileSystemMetaData &data,
+                                       QFileSystemMetaData::MetaDataFlags what)
+{
+    // Like fillMetaData() above, but for an entry of the open directory
+    // dirFd: the name is resolved relative to it, so the kernel does not walk
+    // the full path again, and statx(2) is only asked for the fields in what.
+    // Anything that fails or that we can't answer here goes the long way.
+#ifdef STATX_BASIC_STATS
+    Q_CHECK_FILE_NAME(entry, false);
+
+    const QFileSystemMetaData::MetaDataFlags statFlags = QFileSystemMetaData::PosixStatFlags
+            | QFileSystemMetaData::LinkType;
+    if (dirFd < 0 || !(what & statFlags))
+        return fillMetaData(entry, data, what);
+
+    const QByteArray nativeFilePath = entry.nativeFilePath();
+    const char *name = nativeFilePath.constData() + nativeFilePath.lastIndexOf('/') + 1;
+    const unsigned mask = statxMaskForFlags(what);
+
+    // if we know it's a symlink, we want the target; otherwise, find out first
+    const bool knownLink = data.hasFlags(QFileSystemMetaData::LinkType) && data.isLink();
+    int flags = AT_NO_AUTOMOUNT | (knownLink ? 0 : AT_SYMLINK_NOFOLLOW);
+    struct statx statxBuffer;
+    int ret = statx(dirFd, name, flags, mask, &statxBuffer);
+    if (ret == 0 && !knownLink) {
+        data.knownFlagsMask |= QFileSystemMetaData::LinkType;
+        if (S_ISLNK(statxBuffer.stx_mode)) {
+            data.entryFlags |= QFileSystemMetaData::LinkType;
+            ret = statx(dirFd, name, AT_NO_AUTOMOUNT, mask, &statxBuffer);
+        } else {
+            data.entryFlags &= ~QFileSystemMetaData::LinkType;
+        }
+    }
+    if (ret != 0)
+        return fillMetaData(entry, data, what);     // sort out the errors there
+
+    data.entryFlags &= ~QFileSystemMetaData::PosixStatFlags;
+    data.fillFromStatxBuf(statxBuffer);
+    data.knownFlagsMask |= flagsForStatxMask(statxBuffer.stx_mask);
+
+    if (what & QFileSystemMetaData::UserPermissions) {
+        auto checkAccess = [&](QFileSystemMetaData::MetaDataFlag flag, int mode) {
+            if ((what & flag) && faccessat(dirFd, name, mode, 0) == 0)
+                data.entryFlags |= flag;
+        };
+        data.entryFlags &= ~QFileSystemMetaData::UserPermissions;
+        checkAccess(QFileSystemMetaData::UserReadPermission, R_OK);
+        checkAccess(QFileSystemMetaData::UserWritePermission, W_OK);
+        checkAccess(QFileSystemMetaData::UserExecutePermission, X_OK);
+        data.knownFlagsMask |= what & QFileSystemMetaData::UserPermissions;
+    }
+
+    what &= ~(data.knownFlagsMask | QFileSystemMetaData::UserPermissions);
+    return !what || fillMetaData(entry, data, what);
+#else
+    Q_UNUSED(dirFd)
+    return fillMetaData(entry, data, what);
+#endif
+}
+
 // static
 bool QFileSystemEngine::cloneFile(int srcfd, int dstfd, const QFileSystemMetaData &knownData)
 {
@@ -115,6 +115,11 @@ QFileSystemIterator::~QFileSystemIterator()
         QT_CLOSEDIR(dir);
 }
 
+int QFileSystemIterator::directoryFd() const
+{
+    return dir ? dirfd(dir) : -1;
+}
+
 bool QFileSystemIterator::advance(QFileSystemEntry &fileEntry, QFileSystemMetaData &metaData)
 {
     if (!dir)
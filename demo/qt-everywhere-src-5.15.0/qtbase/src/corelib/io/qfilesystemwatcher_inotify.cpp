@@ -47,6 +47,7 @@
 #include <qfile.h>
 #include <qfileinfo.h>
 #include <qscopeguard.h>
+#include <qset.h>
 #include <qsocketnotifier.h>
 #include <qvarlengtharray.h>
 
@@ -274,13 +275,12 @@ QStringList QInotifyFileSystemWatcherEngine::addPaths(const QStringList &paths,
         QFileInfo fi(path);
         bool isDir = fi.isDir();
         auto sg = qScopeGuard([&]{ unhandled.push_back(path); });
-        if (isDir) {
-            if (directories->contains(path))
-                continue;
-        } else {
-            if (files->contains(path))
-                continue;
-        }
+        // pathToID mirrors *files and *directories, and unlike them it can
+        // be searched without a linear scan, which made adding many paths
+        // quadratic
+        const auto existing = pathToID.constFind(path);
+        if (existing != pathToID.constEnd() && (existing.value() < 0) == isDir)
+            continue;
 
         int wd = inotify_add_watch(inotifyFd,
                                    QFile::encodeName(path),
@@ -326,6 +326,8 @@ QStringList QInotifyFileSystemWatcherEngine::removePaths(const QStringList &path
                                                          QStringList *directories)
 {
     QStringList unhandled;
+    QSet<QString> removedFiles;
+    QSet<QString> removedDirectories;
     for (const QString &path : paths) {
         int id = pathToID.take(path);
 
@@ -351,13 +353,23 @@ QStringList QInotifyFileSystemWatcherEngine::removePaths(const QStringList &path
 
         sg.dismiss();
 
-        if (id < 0) {
-            directories->removeAll(path);
-        } else {
-            files->removeAll(path);
-        }
+        if (id < 0)
+            removedDirectories.insert(path);
+        else
+            removedFiles.insert(path);
     }
 
+    // prune the lists in one pass each instead of once per removed path
+    const auto prune = [](QStringList *list, const QSet<QString> &removed) {
+        if (!removed.isEmpty()) {
+            list->erase(std::remove_if(list->begin(), list->end(),
+                                       [&removed](const QString &p) { return removed.contains(p); }),
+                        list->end());
+        }
+    };
+    prune(directories, removedDirectories);
+    prune(files, removedFiles);
+
     return unhandled;
 }
 
@@ -1298,6 +1298,73 @@ QByteArray QIODevice::readAll()
     return result;
 }
 
+/*!
+    \since 5.16
+
+    Reads at most \a maxSize bytes from the device and returns them as a
+    list of byte arrays, or everything that is currently buffered if
+    \a maxSize is -1. Concatenating the returned arrays yields the data
+    that read() would have returned.
+
+    Whole chunks of the internal read buffer are handed out without being
+    copied, which makes this function cheaper than read() for consumers
+    that can process data piecewise, such as parsers or forwarding
+    proxies. Only the last element may be a copy, when \a maxSize ends in
+    the middle of a buffered chunk.
+
+    If the read buffer is empty, a transaction is in progress, or the
+    device was opened in \l Text mode, this function falls back to read()
+    or readAll() and returns at most one element.
+
+    An empty list means that no data was currently available for reading,
+    or that an error occurred.
+
+    \sa read(), readAll()
+*/
+QByteArrayList QIODevice::readChunks(qint64 maxSize)
+{
+    Q_D(QIODevice);
+    QByteArrayList result;
+
+#if defined QIODEVICE_DEBUG
+    printf("%p QIODevice::readChunks(%lld), d->pos = %lld, d->buffer.size() = %lld\n",
+           this, maxSize, d->pos, d->buffer.size());
+#endif
+
+    CHECK_READABLE(readChunks, result);
+
+    if (d->buffer.isEmpty() || d->transactionStarted
+        || (d->openMode & QIODevice::Text)) {
+        const QByteArray data = (maxSize < 0 ? readAll() : read(maxSize));
+        if (!data.isEmpty())
+            result.append(data);
+        return result;
+    }
+
+    if (maxSize < 0)
+        maxSize = d->buffer.size();
+
+    qint64 readSoFar = 0;
+    while (readSoFar < maxSize && !d->buffer.isEmpty()) {
+        const qint64 blockSize = d->buffer.nextDataBlockSize();
+        const qint64 bytesToRead = qMin(blockSize, maxSize - readSoFar);
+        if (bytesToRead == blockSize) {
+            // Hand out the whole chunk without copying it.
+            result.append(d->buffer.read());
+        } else {
+            result.append(QByteArray(d->buffer.readPointer(), int(bytesToRead)));
+            d->buffer.free(bytesToRead);
+        }
+        readSoFar += bytesToRead;
+    }
+
+    if (!d->isSequential())
+        d->pos += readSoFar;
+    if (d->buffer.isEmpty())
+        readData(nullptr, 0);
+    return result;
+}
+
 /*!
     This function reads a line of ASCII characters from the device, up
     to a maximum of \a maxSize - 1 bytes, stores the characters in \a
@@ -47,6 +47,7 @@
 #include <QtCore/qobjectdefs.h>
 #include <QtCore/qscopedpointer.h>
 #endif
+#include <QtCore/qbytearraylist.h>
 #include <QtCore/qstring.h>
 
 #ifdef open
@@ -122,6 +123,7 @@ public:
     qint64 read(char *data, qint64 maxlen);
     QByteArray read(qint64 maxlen);
     QByteArray readAll();
+    QByteArrayList readChunks(qint64 maxlen = -1);
     qint64 readLine(char *data, qint64 maxlen);
     QByteArray readLine(qint64 maxlen = 0);
     virtual bool canReadLine() const;
@@ -942,6 +942,31 @@ bool QProcessPrivate::startDetached(qint64 *pid)
         return false;
     }
 
+    // Build the argument list and the environment before forking: the
+    // children only dup2(), chdir() and exec, so they don't have to allocate
+    // (and touch copy-on-write pages of a possibly large parent) in between.
+    char **argv = new char *[arguments.size() + 2];
+    for (int i = 0; i < arguments.size(); ++i)
+        argv[i + 1] = ::strdup(QFile::encodeName(arguments.at(i)).constData());
+    argv[arguments.size() + 1] = nullptr;
+
+    // Duplicate the environment.
+    int envc = 0;
+    char **envp = nullptr;
+    if (environment.d.constData()) {
+        envp = _q_dupEnvironment(environment.d.constData()->vars, &envc);
+    }
+
+    QByteArray tmp;
+    if (!program.contains(QLatin1Char('/'))) {
+        const QString &exeFilePath = QStandardPaths::findExecutable(program);
+        if (!exeFilePath.isEmpty())
+            tmp = QFile::encodeName(exeFilePath);
+    }
+    if (tmp.isEmpty())
+        tmp = QFile::encodeName(program);
+    argv[0] = tmp.data();
+
     pid_t childPid = fork();
     if (childPid == 0) {
         struct sigaction noaction;
@@ -973,28 +998,6 @@ bool QProcessPrivate::startDetached(qint64 *pid)
                     qWarning("QProcessPrivate::startDetached: failed to chdir to %s", encodedWorkingDirectory.constData());
             }
 
-            char **argv = new char *[arguments.size() + 2];
-            for (int i = 0; i < arguments.size(); ++i)
-                argv[i + 1] = ::strdup(QFile::encodeName(arguments.at(i)).constData());
-            argv[arguments.size() + 1] = nullptr;
-
-            // Duplicate the environment.
-            int envc = 0;
-            char **envp = nullptr;
-            if (environment.d.constData()) {
-                envp = _q_dupEnvironment(environment.d.constData()->vars, &envc);
-            }
-
-            QByteArray tmp;
-            if (!program.contains(QLatin1Char('/'))) {
-                const QString &exeFilePath = QStandardPaths::findExecutable(program);
-                if (!exeFilePath.isEmpty())
-                    tmp = QFile::encodeName(exeFilePath);
-            }
-            if (tmp.isEmpty())
-                tmp = QFile::encodeName(program);
-            argv[0] = tmp.data();
-
             if (envp)
                 qt_safe_execve(argv[0], argv, envp);
             else
@@ -1028,6 +1031,14 @@ bool QProcessPrivate::startDetached(qint64 *pid)
         ::_exit(1);
     }
 
+    // Clean up duplicated memory.
+    for (int i = 1; i <= arguments.size(); ++i)
+        free(argv[i]);
+    for (int i = 0; i < envc; ++i)
+        free(envp[i]);
+    delete [] argv;
+    delete [] envp;
+
     closeChannel(&stdinChannel);
     closeChannel(&stdoutChannel);
     closeChannel(&stderrChannel);
@@ -95,6 +95,7 @@ RCC_FEATURE_SYMBOL(Zlib)
 #if QT_CONFIG(zstd)
 RCC_FEATURE_SYMBOL(Zstd)
 #endif
+RCC_FEATURE_SYMBOL(Chunked)
 
 #undef RCC_FEATURE_SYMBOL
 
@@ -135,7 +136,8 @@ public:
         // must match rcc.h
         Compressed = 0x01,
         Directory = 0x02,
-        CompressedZstd = 0x04
+        CompressedZstd = 0x04,
+        CompressedChunked = 0x08
     };
 private:
     const uchar *tree, *names, *payloads;
@@ -143,6 +145,7 @@ private:
     inline int findOffset(int node) const { return node * (14 + (version >= 0x02 ? 8 : 0)); } //sizeof each tree element
     uint hash(int node) const;
     QString name(int node) const;
+    bool nameEquals(int node, QStringView segment) const;
     short flags(int node) const;
 public:
     mutable QAtomicInt ref;
@@ -161,6 +164,7 @@ public:
             return QResource::ZstdCompression;
         return QResource::NoCompression;
     }
+    bool isChunked(int node) const { return flags(node) & CompressedChunked; }
     const uchar *data(int node, qint64 *size) const;
     quint64 lastModified(int node) const;
     QStringList children(int node) const;
@@ -298,6 +302,8 @@ public:
     void ensureChildren() const;
     qint64 uncompressedSize() const Q_DECL_PURE_FUNCTION;
     qsizetype decompress(char *buffer, qsizetype bufferSize) const;
+    qint64 readChunked(qint64 pos, char *buffer, qint64 len,
+                       QByteArray *chunkCache, int *cachedChunk) const;
 
     bool load(const QString &file);
     void clear();
@@ -311,7 +317,19 @@ public:
     mutable QStringList children;
     mutable quint8 compressionAlgo;
     bool container;
-    /* 2 or 6 padding bytes */
+    mutable bool chunked;
+    /* 1 or 5 padding bytes */
+
+    struct ChunkTable
+    {
+        qint64 uncompressedSize;
+        qint64 chunkSize;
+        int chunkCount;
+        const uchar *offsets;
+        const uchar *chunks;
+    };
+    bool chunkTable(ChunkTable *table) const;
+    qsizetype decompressChunk(const ChunkTable &table, int chunk, char *buffer) const;
 
     QResource *q_ptr;
     Q_DECLARE_PUBLIC(QResource)
@@ -327,6 +345,7 @@ QResourcePrivate::clear()
     children.clear();
     lastModified = 0;
     container = 0;
+    chunked = false;
     for(int i = 0; i < related.size(); ++i) {
         QResourceRoot *root = related.at(i);
         if(!root->ref.deref())
@@ -351,10 +370,12 @@ QResourcePrivate::load(const QString &file)
                 if(!container) {
                     data = res->data(node, &size);
                     compressionAlgo = res->compressionAlgo(node);
+                    chunked = res->isChunked(node);
                 } else {
                     data = nullptr;
                     size = 0;
                     compressionAlgo = QResource::NoCompression;
+                    chunked = false;
                 }
                 lastModified = res->lastModified(node);
             } else if(res->isContainer(node) != container) {
@@ -444,6 +465,11 @@ QResourcePrivate::ensureChildren() const
 
 qint64 QResourcePrivate::uncompressedSize() const
 {
+    if (chunked) {
+        ChunkTable table;
+        return chunkTable(&table) ? table.uncompressedSize : -1;
+    }
+
     switch (compressionAlgo) {
     case QResource::NoCompression:
         return size;
@@ -473,10 +499,9 @@ qint64 QResourcePrivate::uncompressedSize() const
     return -1;
 }
 
-qsizetype QResourcePrivate::decompress(char *buffer, qsizetype bufferSize) const
+static qsizetype decompressBlock(quint8 compressionAlgo, const uchar *source, qsizetype sourceSize,
+                                 char *buffer, qsizetype bufferSize)
 {
-    Q_ASSERT(data);
-
     switch (compressionAlgo) {
     case QResource::NoCompression:
         Q_UNREACHABLE();
@@ -486,7 +511,7 @@ qsizetype QResourcePrivate::decompress(char *buffer, qsizetype bufferSize) const
 #ifndef QT_NO_COMPRESS
         uLong len = uLong(bufferSize);
         int res = ::uncompress(reinterpret_cast<Bytef *>(buffer), &len,
-                               data + sizeof(quint32), uLong(size - sizeof(quint32)));
+                               source, uLong(sourceSize));
         if (res != Z_OK) {
             qWarning("QResource: error decompressing zlib content (%d)", res);
             return -1;
@@ -499,7 +524,7 @@ qsizetype QResourcePrivate::decompress(char *buffer, qsizetype bufferSize) const
 
     case QResource::ZstdCompression: {
 #if QT_CONFIG(zstd)
-        size_t usize = ZSTD_decompress(buffer, bufferSize, data, size);
+        size_t usize = ZSTD_decompress(buffer, bufferSize, source, sourceSize);
         if (ZSTD_isError(usize)) {
             qWarning("QResource: error decompressing zstd content: %s", ZSTD_getErrorName(usize));
             return -1;
@@ -514,6 +539,111 @@ qsizetype QResourcePrivate::decompress(char *buffer, qsizetype bufferSize) const
     return -1;
 }
 
+qsizetype QResourcePrivate::decompress(char *buffer, qsizetype bufferSize) const
+{
+    Q_ASSERT(data);
+
+    if (chunked) {
+        int cachedChunk = -1;
+        return readChunked(0, buffer, bufferSize, nullptr, &cachedChunk);
+    }
+
+    if (compressionAlgo == QResource::ZlibCompression) {
+        // qCompress() format: skip the uncompressed size
+        return decompressBlock(compressionAlgo, data + sizeof(quint32), size - sizeof(quint32),
+                               buffer, bufferSize);
+    }
+    return decompressBlock(compressionAlgo, data, size, buffer, bufferSize);
+}
+
+/*
+    Format version 4 may store large compressed files in independently
+    compressed chunks, so that they can be read in part. The payload of such
+    a file is, in big endian:
+
+        quint32 uncompressed size
+        quint32 uncompressed size of each chunk but the last
+        quint32 offsets[chunk count + 1], relative to the end of this table
+        the chunks, each a complete zlib stream or zstd frame
+*/
+bool QResourcePrivate::chunkTable(ChunkTable *table) const
+{
+    if (size < 8)
+        return false;
+    table->uncompressedSize = qFromBigEndian<quint32>(data);
+    table->chunkSize = qFromBigEndian<quint32>(data + 4);
+    if (table->chunkSize <= 0)
+        return false;
+    const qint64 chunkCount = (table->uncompressedSize + table->chunkSize - 1) / table->chunkSize;
+    const qint64 tableEnd = 8 + 4 * (chunkCount + 1);
+    if (tableEnd > size)
+        return false;
+    table->chunkCount = int(chunkCount);
+    table->offsets = data + 8;
+    table->chunks = data + tableEnd;
+    if (qFromBigEndian<quint32>(table->offsets + 4 * chunkCount) > quint64(size - tableEnd)) {
+        qWarning("QResource: corrupt chunk table");
+        return false;
+    }
+    return true;
+}
+
+qsizetype QResourcePrivate::decompressChunk(const ChunkTable &table, int chunk, char *buffer) const
+{
+    const quint32 begin = qFromBigEndian<quint32>(table.offsets + 4 * chunk);
+    const quint32 end = qFromBigEndian<quint32>(table.offsets + 4 * (chunk + 1));
+    const qint64 expected = qMin(table.chunkSize, table.uncompressedSize - chunk * table.chunkSize);
+    if (end < begin)
+        return -1;
+    const qsizetype n = decompressBlock(compressionAlgo, table.chunks + begin, end - begin,
+                                        buffer, expected);
+    return n == expected ? n : -1;
+}
+
+/*
+    Reads \a len bytes at \a pos of a chunked resource into \a buffer,
+    decompressing only the chunks that overlap. Chunks that are only partly
+    read are decompressed into \a chunkCache, which keeps the last one
+    around for the next sequential read; \a chunkCache may be null when the
+    reads are chunk aligned.
+*/
+qint64 QResourcePrivate::readChunked(qint64 pos, char *buffer, qint64 len,
+                                     QByteArray *chunkCache, int *cachedChunk) const
+{
+    ChunkTable table;
+    if (!chunkTable(&table))
+        return -1;
+    len = qBound(qint64(0), qMin(len, table.uncompressedSize - pos), table.uncompressedSize);
+
+    QByteArray scratch;
+    qint64 done = 0;
+    while (done < len) {
+        const int chunk = int((pos + done) / table.chunkSize);
+        const qint64 chunkBegin = chunk * table.chunkSize;
+        const qint64 chunkLength = qMin(table.chunkSize, table.uncompressedSize - chunkBegin);
+        const qint64 offsetInChunk = pos + done - chunkBegin;
+        const qint64 n = qMin(len - done, chunkLength - offsetInChunk);
+
+        if (offsetInChunk == 0 && n == chunkLength) {
+            // whole chunk, decompress in place
+            if (decompressChunk(table, chunk, buffer + done) < 0)
+                return -1;
+        } else {
+            QByteArray *cache = chunkCache ? chunkCache : &scratch;
+            if (!chunkCache || *cachedChunk != chunk) {
+                cache->resize(int(chunkLength));
+                *cachedChunk = -1;
+                if (decompressChunk(table, chunk, cache->data()) < 0)
+                    return -1;
+                *cachedChunk = chunk;
+            }
+            memcpy(buffer + done, cache->constData() + offsetInChunk, n);
+        }
+        done += n;
+    }
+    return done;
+}
+
 /*!
     Constructs a QResource pointing to \a file. \a locale is used to
     load a specific localization of a resource data.
@@ -664,6 +794,12 @@ bool QResource::isCompressed() const
 
     See \l{http://facebook.github.io/zstd/zstd_manual.html}{Zstandard manual}.
 
+    \note Since Qt 5.16, rcc can store large files in independently
+    compressed chunks when writing format version 4, so that QFile can read
+    them without decompressing the whole file. The data() of such resources
+    cannot be passed to qUncompress() or \c{ZSTD_decompress}; use
+    uncompressedData() or QFile to read them.
+
     \sa data(), isFile()
 */
 QResource::Compression QResource::compressionAlgorithm() const
@@ -870,6 +1006,24 @@ inline QString QResourceRoot::name(int node) const
     return ret;
 }
 
+inline bool QResourceRoot::nameEquals(int node, QStringView segment) const
+{
+    if (!node) // root
+        return segment.isEmpty();
+    qint32 name_offset = qFromBigEndian<qint32>(tree + findOffset(node));
+    const quint16 name_length = qFromBigEndian<qint16>(names + name_offset);
+    if (name_length != segment.size())
+        return false;
+    name_offset += 2 + 4; //jump past length and hash
+
+    const uchar *p = names + name_offset;
+    for (qsizetype i = 0; i < segment.size(); ++i, p += 2) {
+        if (qFromBigEndian<quint16>(p) != segment.at(i).unicode())
+            return false;
+    }
+    return true;
+}
+
 int QResourceRoot::findNode(const QString &_path, const QLocale &locale) const
 {
     QString path = _path;
@@ -935,7 +1089,7 @@ int QResourceRoot::findNode(const QString &_path, const QLocale &locale) const
             while(sub_node > child && hash(sub_node-1) == h) //backup for collisions
                 --sub_node;
             for(; sub_node < child+child_count && hash(sub_node) == h; ++sub_node) { //here we go...
-                if(name(sub_node) == segment) {
+                if (nameEquals(sub_node, segment)) {
                     found = true;
                     int offset = findOffset(sub_node);
 #ifdef DEBUG_RESOURCE_MATCH
@@ -1084,7 +1238,7 @@ Q_CORE_EXPORT bool qRegisterResourceData(int version, const unsigned char *tree,
         return false;
     const auto locker = qt_scoped_lock(resourceMutex());
     ResourceList *list = resourceList();
-    if (version >= 0x01 && version <= 0x3) {
+    if (version >= 0x01 && version <= 0x4) {
         bool found = false;
         QResourceRoot res(version, tree, name, data);
         for (int i = 0; i < list->size(); ++i) {
@@ -1110,7 +1264,7 @@ Q_CORE_EXPORT bool qUnregisterResourceData(int version, const unsigned char *tre
         return false;
 
     const auto locker = qt_scoped_lock(resourceMutex());
-    if (version >= 0x01 && version <= 0x3) {
+    if (version >= 0x01 && version <= 0x4) {
         QResourceRoot res(version, tree, name, data);
         ResourceList *list = resourceList();
         for (int i = 0; i < list->size(); ) {
@@ -1187,10 +1341,12 @@ public:
 #endif
         if (QT_CONFIG(zstd))
             acceptableFlags |= CompressedZstd;
+        if (version >= 4)
+            acceptableFlags |= CompressedChunked;
         if (file_flags & ~acceptableFlags)
             return false;
 
-        if (version >= 0x01 && version <= 0x03) {
+        if (version >= 0x01 && version <= 0x04) {
             buffer = b;
             setSource(version, b+tree_offset, b+name_offset, b+data_offset);
             return true;
@@ -1457,8 +1613,10 @@ private:
     qint64 offset;
     QResource resource;
     mutable QByteArray uncompressed;
+    QByteArray chunkCache;
+    int cachedChunk;
 protected:
-    QResourceFileEnginePrivate() : offset(0) { }
+    QResourceFileEnginePrivate() : offset(0), cachedChunk(-1) { }
 };
 
 bool QResourceFileEngine::mkdir(const QString &, bool) const
@@ -1512,7 +1670,13 @@ bool QResourceFileEngine::open(QIODevice::OpenMode flags)
     }
     if (flags & QIODevice::WriteOnly)
         return false;
-    if (d->resource.compressionAlgorithm() != QResource::NoCompression) {
+    if (d->resource.d_func()->chunked) {
+        // decompressed chunk by chunk as it is read
+        if (d->resource.uncompressedSize() < 0) {
+            d->errorString = QSystemError::stdString(EIO);
+            return false;
+        }
+    } else if (d->resource.compressionAlgorithm() != QResource::NoCompression) {
         d->uncompress();
         if (d->uncompressed.isNull()) {
             d->errorString = QSystemError::stdString(EIO);
@@ -1530,6 +1694,8 @@ bool QResourceFileEngine::close()
 {
     Q_D(QResourceFileEngine);
     d->offset = 0;
+    d->chunkCache.clear();
+    d->cachedChunk = -1;
     return true;
 }
 
@@ -1545,10 +1711,17 @@ qint64 QResourceFileEngine::read(char *data, qint64 len)
         len = size()-d->offset;
     if(len <= 0)
         return 0;
-    if (!d->uncompressed.isNull())
+    if (!d->uncompressed.isNull()) {
         memcpy(data, d->uncompressed.constData()+d->offset, len);
-    else
+    } else if (d->resource.d_func()->chunked) {
+        len = d->resource.d_func()->readChunked(d->offset, data, len, &d->chunkCache, &d->cachedChunk);
+        if (len < 0) {
+            setError(QFile::ReadError, QSystemError::stdString(EIO));
+            return -1;
+        }
+    } else {
         memcpy(data, d->resource.data()+d->offset, len);
+    }
     d->offset += len;
     return len;
 }
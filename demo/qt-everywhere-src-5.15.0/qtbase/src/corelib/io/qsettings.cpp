@@ -1399,9 +1399,12 @@ void QConfFileSettingsPrivate::syncConfFile(QConfFile *confFile)
 
     /*
         We can often optimize the read-only case, if the file on disk
-        hasn't changed.
+        hasn't changed. This includes files that did not exist when we
+        last looked: both sizes are 0 and both time stamps are invalid.
+        Most QSettings objects consult several fallback files that don't
+        exist, so this saves trying to open each of them every time.
     */
-    if (readOnly && confFile->size > 0) {
+    if (readOnly) {
         QFileInfo fileInfo(confFile->name);
         if (confFile->size == fileInfo.size() && confFile->timeStamp == fileInfo.lastModified())
             return;
@@ -51,6 +51,7 @@
 #include <qbitarray.h>
 #include <qdatetime.h>
 #include <qloggingcategory.h>
+#include <qvarlengtharray.h>
 
 #include <limits.h>
 
@@ -708,13 +709,12 @@ void QAbstractItemModelPrivate::itemsAboutToBeMoved(const QModelIndex &srcParent
 
     const bool sameParent = (srcParent == destinationParent);
     const bool movingUp = (srcFirst > destinationChild);
+    // nothing before both the moved block and the destination is affected
+    const int firstAffected = qMin(srcFirst, destinationChild);
 
     for ( it = begin; it != end; ++it) {
         QPersistentModelIndexData *data = *it;
         const QModelIndex &index = data->index;
-        const QModelIndex &parent = index.parent();
-        const bool isSourceIndex = (parent == srcParent);
-        const bool isDestinationIndex = (parent == destinationParent);
 
         int childPosition;
         if (orientation == Qt::Vertical)
@@ -722,7 +722,15 @@ void QAbstractItemModelPrivate::itemsAboutToBeMoved(const QModelIndex &srcParent
         else
             childPosition = index.column();
 
-        if (!index.isValid() || !(isSourceIndex || isDestinationIndex ) )
+        // check the position before asking the model for the parent
+        if (!index.isValid() || childPosition < firstAffected)
+            continue;
+
+        const QModelIndex &parent = index.parent();
+        const bool isSourceIndex = (parent == srcParent);
+        const bool isDestinationIndex = (parent == destinationParent);
+
+        if (!(isSourceIndex || isDestinationIndex ) )
             continue;
 
         if (!sameParent && isDestinationIndex) {
@@ -807,6 +815,42 @@ void QAbstractItemModelPrivate::itemsMoved(const QModelIndex &sourceParent, int
     movePersistentIndexes(moved_in_destination, destination_change, destinationParent, orientation);
 }
 
+/*!
+  \internal
+
+  Returns \c true if \a ancestor lies in the subtree of the rows or columns
+  \a first to \a last of \a parent that are about to be removed. Persistent
+  indexes deep in a tree share most of their ancestors, so the answer for
+  every ancestor visited is kept in \a memo, which saves calling parent()
+  over and over while scanning the persistent indexes.
+*/
+static bool isInRemovedSubtree(const QModelIndex &ancestor, const QModelIndex &parent,
+                               int first, int last, Qt::Orientation orientation,
+                               QHash<QModelIndex, bool> &memo)
+{
+    QVarLengthArray<QModelIndex, 16> path;
+    bool removed = false;
+    QModelIndex current = ancestor;
+    while (current.isValid()) {
+        const auto it = memo.constFind(current);
+        if (it != memo.constEnd()) {
+            removed = *it;
+            break;
+        }
+        path.append(current);
+        const QModelIndex current_parent = current.parent();
+        if (current_parent == parent) { // on the same level as the change
+            const int position = orientation == Qt::Vertical ? current.row() : current.column();
+            removed = position >= first && position <= last;
+            break;
+        }
+        current = current_parent;
+    }
+    for (const QModelIndex &index : qAsConst(path))
+        memo.insert(index, removed);
+    return removed;
+}
+
 void QAbstractItemModelPrivate::rowsAboutToBeRemoved(const QModelIndex &parent,
                                                      int first, int last)
 {
@@ -814,22 +858,21 @@ void QAbstractItemModelPrivate::rowsAboutToBeRemoved(const QModelIndex &parent,
     QVector<QPersistentModelIndexData *>  persistent_invalidated;
     // find the persistent indexes that are affected by the change, either by being in the removed subtree
     // or by being on the same level and below the removed rows
+    QHash<QModelIndex, bool> removedAncestors;
     for (QHash<QModelIndex, QPersistentModelIndexData *>::const_iterator it = persistent.indexes.constBegin();
          it != persistent.indexes.constEnd(); ++it) {
         QPersistentModelIndexData *data = *it;
-        bool level_changed = false;
-        QModelIndex current = data->index;
-        while (current.isValid()) {
-            QModelIndex current_parent = current.parent();
-            if (current_parent == parent) { // on the same level as the change
-                if (!level_changed && current.row() > last) // below the removed rows
-                    persistent_moved.append(data);
-                else if (current.row() <= last && current.row() >= first) // in the removed subtree
-                    persistent_invalidated.append(data);
-                break;
-            }
-            current = current_parent;
-            level_changed = true;
+        const QModelIndex &index = data->index;
+        if (!index.isValid())
+            continue;
+        const QModelIndex index_parent = index.parent();
+        if (index_parent == parent) { // on the same level as the change
+            if (index.row() > last) // below the removed rows
+                persistent_moved.append(data);
+            else if (index.row() >= first) // in the removed subtree
+                persistent_invalidated.append(data);
+        } else if (isInRemovedSubtree(index_parent, parent, first, last, Qt::Vertical, removedAncestors)) {
+            persistent_invalidated.append(data);
         }
     }
 
@@ -907,22 +950,21 @@ void QAbstractItemModelPrivate::columnsAboutToBeRemoved(const QModelIndex &paren
     QVector<QPersistentModelIndexData *> persistent_invalidated;
     // find the persistent indexes that are affected by the change, either by being in the removed subtree
     // or by being on the same level and to the right of the removed columns
+    QHash<QModelIndex, bool> removedAncestors;
     for (QHash<QModelIndex, QPersistentModelIndexData *>::const_iterator it = persistent.indexes.constBegin();
          it != persistent.indexes.constEnd(); ++it) {
         QPersistentModelIndexData *data = *it;
-        bool level_changed = false;
-        QModelIndex current = data->index;
-        while (current.isValid()) {
-            QModelIndex current_parent = current.parent();
-            if (current_parent == parent) { // on the same level as the change
-                if (!level_changed && current.column() > last) // right of the removed columns
-                    persistent_moved.append(data);
-                else if (current.column() <= last && current.column() >= first) // in the removed subtree
-                    persistent_invalidated.append(data);
-                break;
-            }
-            current = current_parent;
-            level_changed = true;
+        const QModelIndex &index = data->index;
+        if (!index.isValid())
+            continue;
+        const QModelIndex index_parent = index.parent();
+        if (index_parent == parent) { // on the same level as the change
+            if (index.column() > last) // right of the removed columns
+                persistent_moved.append(data);
+            else if (index.column() >= first) // in the removed subtree
+                persistent_invalidated.append(data);
+        } else if (isInRemovedSubtree(index_parent, parent, first, last, Qt::Horizontal, removedAncestors)) {
+            persistent_invalidated.append(data);
         }
     }
 
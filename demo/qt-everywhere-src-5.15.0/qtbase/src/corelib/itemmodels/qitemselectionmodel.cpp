@@ -1442,7 +1442,9 @@ bool QItemSelectionModel::isSelected(const QModelIndex &index) const
     //  search model ranges
     QList<QItemSelectionRange>::const_iterator it = d->ranges.begin();
     for (; it != d->ranges.end(); ++it) {
-        if ((*it).isValid() && (*it).contains(index)) {
+        // contains() rejects most ranges on their bounds alone, isValid()
+        // always has to look up the parents
+        if ((*it).contains(index) && (*it).isValid()) {
             selected = true;
             break;
         }
@@ -46,8 +46,13 @@
 #include <qstringlist.h>
 #include <private/qabstractitemmodel_p.h>
 #include <private/qabstractproxymodel_p.h>
+#if QT_CONFIG(thread)
+#include <qsemaphore.h>
+#include <qthreadpool.h>
+#endif
 
 #include <algorithm>
+#include <numeric>
 
 QT_BEGIN_NAMESPACE
 
@@ -113,6 +118,52 @@ private:
 };
 
 
+// Row counts below which the parallel mode isn't worth the overhead, and
+// the least number of rows handed to one task.
+enum {
+    ParallelSortFilterThreshold = 1024,
+    ParallelChunkSize = 4096
+};
+
+/*
+  Calls \a function for every task index in [0, taskCount), using the
+  global thread pool, and returns once all the tasks have finished. Tasks
+  that the pool has no thread for right away run on the calling thread, so
+  this doesn't deadlock when called from a pool thread.
+*/
+template <typename Function>
+static void parallelFor(int taskCount, const Function &function)
+{
+#if QT_CONFIG(thread)
+    QThreadPool *pool = QThreadPool::globalInstance();
+    QSemaphore finished;
+    int started = 0;
+    for (int task = 1; task < taskCount; ++task) {
+        if (pool->tryStart([&function, &finished, task] { function(task); finished.release(); }))
+            ++started;
+        else
+            function(task);
+    }
+    if (taskCount > 0)
+        function(0);
+    finished.acquire(started);
+#else
+    for (int task = 0; task < taskCount; ++task)
+        function(task);
+#endif
+}
+
+static int parallelChunkSize(int count)
+{
+#if QT_CONFIG(thread)
+    // a few chunks per thread, to even out the load
+    const int chunks = qMax(1, QThreadPool::globalInstance()->maxThreadCount() * 4);
+    return qMax(int(ParallelChunkSize), (count + chunks - 1) / chunks);
+#else
+    return qMax(count, 1);
+#endif
+}
+
 //this struct is used to store what are the rows that are removed
 //between a call to rowsAboutToBeRemoved and rowsRemoved
 //it avoids readding rows to the mapping that are currently being removed
@@ -300,6 +351,7 @@ public:
     bool filter_recursive;
     bool complete_insert;
     bool dynamic_sortfilter;
+    bool parallel_sortfilter;
     QRowsRemoval itemsBeingRemoved;
 
     QModelIndexPairList saved_persistent_indexes;
@@ -380,6 +432,11 @@ public:
     int find_source_sort_column() const;
     void sort_source_rows(QVector<int> &source_rows,
                           const QModelIndex &source_parent) const;
+    void sort_source_rows_parallel(QVector<int> &source_rows,
+                                   const QModelIndex &source_parent) const;
+    QVector<char> accepted_source_rows(int source_count, const QModelIndex &source_parent) const;
+    inline bool use_parallel_sortfilter(int count) const
+    { return parallel_sortfilter && count >= ParallelSortFilterThreshold; }
     QVector<QPair<int, QVector<int > > > proxy_intervals_for_source_items_to_add(
         const QVector<int> &proxy_to_source, const QVector<int> &source_items,
         const QModelIndex &source_parent, Qt::Orientation orient) const;
@@ -500,9 +557,17 @@ IndexMap::const_iterator QSortFilterProxyModelPrivate::create_mapping(
 
     int source_rows = model->rowCount(source_parent);
     m->source_rows.reserve(source_rows);
-    for (int i = 0; i < source_rows; ++i) {
-        if (filterAcceptsRowInternal(i, source_parent))
-            m->source_rows.append(i);
+    if (use_parallel_sortfilter(source_rows)) {
+        const QVector<char> accepted = accepted_source_rows(source_rows, source_parent);
+        for (int i = 0; i < source_rows; ++i) {
+            if (accepted.at(i))
+                m->source_rows.append(i);
+        }
+    } else {
+        for (int i = 0; i < source_rows; ++i) {
+            if (filterAcceptsRowInternal(i, source_parent))
+                m->source_rows.append(i);
+        }
     }
     int source_cols = model->columnCount(source_parent);
     m->source_columns.reserve(source_cols);
@@ -674,7 +739,9 @@ void QSortFilterProxyModelPrivate::sort_source_rows(
 {
     Q_Q(const QSortFilterProxyModel);
     if (source_sort_column >= 0) {
-        if (sort_order == Qt::AscendingOrder) {
+        if (use_parallel_sortfilter(source_rows.size())) {
+            sort_source_rows_parallel(source_rows, source_parent);
+        } else if (sort_order == Qt::AscendingOrder) {
             QSortFilterProxyModelLessThan lt(source_sort_column, source_parent, model, q);
             std::stable_sort(source_rows.begin(), source_rows.end(), lt);
         } else {
@@ -686,6 +753,84 @@ void QSortFilterProxyModelPrivate::sort_source_rows(
     }
 }
 
+/*!
+  \internal
+
+  Sorts \a source_rows like sort_source_rows(), but fetches the sort role
+  data of each row once and compares it the way the default lessThan()
+  does. The keys are fetched, and the rows sorted, in chunks on the global
+  thread pool; the sorted chunks are then merged pairwise.
+*/
+void QSortFilterProxyModelPrivate::sort_source_rows_parallel(
+    QVector<int> &source_rows, const QModelIndex &source_parent) const
+{
+    const int count = source_rows.size();
+    const int chunkSize = parallelChunkSize(count);
+    const int chunks = (count + chunkSize - 1) / chunkSize;
+
+    QVector<QVariant> keys(count);
+    QVariant *keyData = keys.data();
+    const int *rows = source_rows.constData();
+    parallelFor(chunks, [&](int chunk) {
+        const int end = qMin(count, (chunk + 1) * chunkSize);
+        for (int i = chunk * chunkSize; i < end; ++i)
+            keyData[i] = model->data(model->index(rows[i], source_sort_column, source_parent), sort_role);
+    });
+
+    // sort positions into keys, so equal keys keep the order of source_rows
+    const Qt::CaseSensitivity cs = sort_casesensitivity;
+    const bool localeAware = sort_localeaware;
+    const bool ascending = sort_order == Qt::AscendingOrder;
+    const auto lessThan = [keyData, cs, localeAware, ascending](int left, int right) {
+        return ascending
+            ? QAbstractItemModelPrivate::isVariantLessThan(keyData[left], keyData[right], cs, localeAware)
+            : QAbstractItemModelPrivate::isVariantLessThan(keyData[right], keyData[left], cs, localeAware);
+    };
+
+    QVector<int> order(count);
+    int *orderData = order.data();
+    std::iota(orderData, orderData + count, 0);
+    parallelFor(chunks, [&](int chunk) {
+        std::stable_sort(orderData + chunk * chunkSize,
+                         orderData + qMin(count, (chunk + 1) * chunkSize), lessThan);
+    });
+    for (int width = chunkSize; width < count; width *= 2) {
+        const int merges = (count + 2 * width - 1) / (2 * width);
+        parallelFor(merges, [&](int merge) {
+            const int begin = merge * 2 * width;
+            const int middle = qMin(count, begin + width);
+            const int end = qMin(count, begin + 2 * width);
+            std::inplace_merge(orderData + begin, orderData + middle, orderData + end, lessThan);
+        });
+    }
+
+    QVector<int> sorted(count);
+    for (int i = 0; i < count; ++i)
+        sorted[i] = rows[orderData[i]];
+    source_rows = std::move(sorted);
+}
+
+/*!
+  \internal
+
+  Evaluates the row filter for all the \a source_count rows under
+  \a source_parent, in chunks on the global thread pool. Returns a vector
+  holding a non-zero value for each accepted row.
+*/
+QVector<char> QSortFilterProxyModelPrivate::accepted_source_rows(
+    int source_count, const QModelIndex &source_parent) const
+{
+    QVector<char> accepted(source_count);
+    char *acceptedData = accepted.data();
+    const int chunkSize = parallelChunkSize(source_count);
+    parallelFor((source_count + chunkSize - 1) / chunkSize, [&](int chunk) {
+        const int end = qMin(source_count, (chunk + 1) * chunkSize);
+        for (int i = chunk * chunkSize; i < end; ++i)
+            acceptedData[i] = filterAcceptsRowInternal(i, source_parent);
+    });
+    return accepted;
+}
+
 /*!
   \internal
 
@@ -1315,25 +1460,33 @@ QSet<int> QSortFilterProxyModelPrivate::handle_filter_changed(
     const QModelIndex &source_parent, Qt::Orientation orient)
 {
     Q_Q(QSortFilterProxyModel);
+    // Every source item is checked by one of the two loops below, so in
+    // parallel mode evaluate the row filter for all of them up front
+    int source_count = source_to_proxy.size();
+    const QVector<char> accepted = (orient == Qt::Vertical && use_parallel_sortfilter(source_count))
+            ? accepted_source_rows(source_count, source_parent) : QVector<char>();
+    const auto acceptsItem = [&](int source_item) {
+        if (orient == Qt::Horizontal)
+            return q->filterAcceptsColumn(source_item, source_parent);
+        if (!accepted.isEmpty())
+            return accepted.at(source_item) != 0;
+        return filterAcceptsRowInternal(source_item, source_parent);
+    };
+
     // Figure out which mapped items to remove
     QVector<int> source_items_remove;
     for (int i = 0; i < proxy_to_source.count(); ++i) {
         const int source_item = proxy_to_source.at(i);
-        if ((orient == Qt::Vertical)
-            ? !filterAcceptsRowInternal(source_item, source_parent)
-            : !q->filterAcceptsColumn(source_item, source_parent)) {
+        if (!acceptsItem(source_item)) {
             // This source item does not satisfy the filter, so it must be removed
             source_items_remove.append(source_item);
         }
     }
     // Figure out which non-mapped items to insert
     QVector<int> source_items_insert;
-    int source_count = source_to_proxy.size();
     for (int source_item = 0; source_item < source_count; ++source_item) {
         if (source_to_proxy.at(source_item) == -1) {
-            if ((orient == Qt::Vertical)
-                ? filterAcceptsRowInternal(source_item, source_parent)
-                : q->filterAcceptsColumn(source_item, source_parent)) {
+            if (acceptsItem(source_item)) {
                 // This source item satisfies the filter, so it must be added
                 source_items_insert.append(source_item);
             }
@@ -2006,6 +2159,7 @@ QSortFilterProxyModel::QSortFilterProxyModel(QObject *parent)
     d->filter_role = Qt::DisplayRole;
     d->filter_recursive = false;
     d->dynamic_sortfilter = true;
+    d->parallel_sortfilter = false;
     d->complete_insert = false;
     connect(this, SIGNAL(modelReset()), this, SLOT(_q_clearMapping()));
 }
@@ -2958,6 +3112,55 @@ void QSortFilterProxyModel::setRecursiveFilteringEnabled(bool recursive)
     emit recursiveFilteringEnabledChanged(recursive);
 }
 
+/*!
+    \since 5.16
+    \property QSortFilterProxyModel::parallelSortFilterEnabled
+    \brief whether filtering and sorting large numbers of rows is spread
+    over the threads of QThreadPool::globalInstance().
+
+    When enabled, filterAcceptsRow() is evaluated for chunks of rows on the
+    thread pool whenever a whole level of the source model is filtered, for
+    instance after the filter changed. Sorting fetches the sortRole data of
+    each row once, sorts chunks of rows in parallel and merges them. The
+    calling thread waits for the result, which is published with the usual
+    layoutChanged() or row signals once it is complete.
+
+    Sorting in this mode compares the cached data the way the default
+    implementation of lessThan() does, without calling lessThan(). Rows
+    inserted in the source model are still merged into the sorted mapping
+    one by one using lessThan().
+
+    Only enable this if the source model's index() and data(), and any
+    reimplementation of filterAcceptsRow(), can be called from several
+    threads at once, and if lessThan() is not reimplemented. Levels with
+    fewer than a thousand rows are always handled on the calling thread.
+
+    The default value is false.
+
+    \sa filterAcceptsRow(), sortRole
+*/
+
+/*!
+    \since 5.16
+    \fn void QSortFilterProxyModel::parallelSortFilterEnabledChanged(bool parallelSortFilterEnabled)
+    \brief This signal is emitted when the parallel sort and filter setting is
+           changed to \a parallelSortFilterEnabled.
+*/
+bool QSortFilterProxyModel::isParallelSortFilterEnabled() const
+{
+    Q_D(const QSortFilterProxyModel);
+    return d->parallel_sortfilter;
+}
+
+void QSortFilterProxyModel::setParallelSortFilterEnabled(bool enable)
+{
+    Q_D(QSortFilterProxyModel);
+    if (d->parallel_sortfilter == enable)
+        return;
+    d->parallel_sortfilter = enable;
+    emit parallelSortFilterEnabledChanged(enable);
+}
+
 #if QT_DEPRECATED_SINCE(5, 11)
 /*!
     \obsolete
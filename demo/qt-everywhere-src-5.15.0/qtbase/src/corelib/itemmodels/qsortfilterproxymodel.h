@@ -74,6 +74,7 @@ class Q_CORE_EXPORT QSortFilterProxyModel : public QAbstractProxyModel
     Q_PROPERTY(int sortRole READ sortRole WRITE setSortRole NOTIFY sortRoleChanged)
     Q_PROPERTY(int filterRole READ filterRole WRITE setFilterRole NOTIFY filterRoleChanged)
     Q_PROPERTY(bool recursiveFilteringEnabled READ isRecursiveFilteringEnabled WRITE setRecursiveFilteringEnabled NOTIFY recursiveFilteringEnabledChanged)
+    Q_PROPERTY(bool parallelSortFilterEnabled READ isParallelSortFilterEnabled WRITE setParallelSortFilterEnabled NOTIFY parallelSortFilterEnabledChanged)
 
 public:
     explicit QSortFilterProxyModel(QObject *parent = nullptr);
@@ -120,6 +121,9 @@ public:
     bool isRecursiveFilteringEnabled() const;
     void setRecursiveFilteringEnabled(bool recursive);
 
+    bool isParallelSortFilterEnabled() const;
+    void setParallelSortFilterEnabled(bool enable);
+
 public Q_SLOTS:
     void setFilterRegExp(const QString &pattern);
     void setFilterRegExp(const QRegExp &regExp);
@@ -194,6 +198,7 @@ Q_SIGNALS:
     void sortRoleChanged(int sortRole);
     void filterRoleChanged(int filterRole);
     void recursiveFilteringEnabledChanged(bool recursiveFilteringEnabled);
+    void parallelSortFilterEnabledChanged(bool parallelSortFilterEnabled);
 
 private:
     Q_DECLARE_PRIVATE(QSortFilterProxyModel)
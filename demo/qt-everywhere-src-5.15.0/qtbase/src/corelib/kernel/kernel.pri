@@ -33,6 +33,7 @@ HEADERS += \
         kernel/qmetaobject_moc_p.h \
         kernel/qmetaobjectbuilder_p.h \
         kernel/qobject_p.h \
+        kernel/qobjectarena_p.h \
         kernel/qcoreglobaldata_p.h \
         kernel/qsharedmemory.h \
         kernel/qsharedmemory_p.h \
@@ -59,6 +60,7 @@ SOURCES += \
         kernel/qmetaobjectbuilder.cpp \
         kernel/qmimedata.cpp \
         kernel/qobject.cpp \
+        kernel/qobjectarena.cpp \
         kernel/qobjectcleanuphandler.cpp \
         kernel/qsignalmapper.cpp \
         kernel/qsocketnotifier.cpp \
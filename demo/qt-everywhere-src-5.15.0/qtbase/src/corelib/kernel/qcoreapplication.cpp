@@ -351,6 +351,8 @@ bool QCoreApplicationPrivate::is_app_closing = false;
 Q_CORE_EXPORT uint qGlobalPostedEventsCount()
 {
     QThreadData *currentThreadData = QThreadData::current();
+    const auto locker = qt_scoped_lock(currentThreadData->postEventList.mutex);
+    QCoreApplicationPrivate::drainLockFreePostedEvents(currentThreadData);
     return currentThreadData->postEventList.size() - currentThreadData->postEventList.startOffset;
 }
 
@@ -502,6 +504,7 @@ void QCoreApplicationPrivate::cleanupThreadData()
 
         // need to clear the state of the mainData, just in case a new QCoreApplication comes along.
         const auto locker = qt_scoped_lock(thisThreadData->postEventList.mutex);
+        QCoreApplicationPrivate::drainLockFreePostedEvents(thisThreadData);
         for (int i = 0; i < thisThreadData->postEventList.size(); ++i) {
             const QPostEvent &pe = thisThreadData->postEventList.at(i);
             if (pe.event) {
@@ -1477,6 +1480,7 @@ QCoreApplicationPrivate::QPostEventListLocker QCoreApplicationPrivate::lockThrea
     if (!object) {
         locker.threadData = QThreadData::current();
         locker.locker = qt_unique_lock(locker.threadData->postEventList.mutex);
+        drainLockFreePostedEvents(locker.threadData);
         return locker;
     }
 
@@ -1499,9 +1503,85 @@ QCoreApplicationPrivate::QPostEventListLocker QCoreApplicationPrivate::lockThrea
     }
 
     Q_ASSERT(locker.threadData);
+    drainLockFreePostedEvents(locker.threadData);
     return locker;
 }
 
+/*!
+    \internal
+
+    Posts \a event to \a receiver without taking the receiver thread's post
+    event list mutex. Only used for events that are never compressed and are
+    posted with Qt::NormalEventPriority, so the event can simply be appended
+    when the list is next drained. Returns \c false if the event could not
+    be posted this way.
+*/
+bool QCoreApplicationPrivate::postLockFreeEvent(QObject *receiver, QEvent *event)
+{
+    QObjectPrivate *d = QObjectPrivate::get(receiver);
+    QThreadData *data = d->threadData.loadAcquire();
+    if (!data)
+        return false;
+
+    event->posted = true;
+    d->lockFreePostedEvents.ref();
+    data->postEventList.lockFreeEvents.push(new QLockFreePostEventQueue::Node{receiver, event, nullptr});
+
+    // Pairs with the fence in QObject::moveToThread(): either the move sees
+    // our event when draining the old list, or we see that the receiver has
+    // moved and drain the old list ourselves, forwarding the event.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (Q_UNLIKELY(d->threadData.loadAcquire() != data)) {
+        const auto locker = qt_scoped_lock(data->postEventList.mutex);
+        drainLockFreePostedEvents(data);
+        return true;
+    }
+
+    QAbstractEventDispatcher *dispatcher = data->eventDispatcher.loadAcquire();
+    if (dispatcher)
+        dispatcher->wakeUp();
+    return true;
+}
+
+/*!
+    \internal
+
+    Merges the events posted by postLockFreeEvent() into the post event list
+    of \a data, in the order they were posted. Events whose receiver has
+    moved to another thread in the meantime are forwarded to that thread.
+    Must be called with the mutex of the post event list held.
+*/
+void QCoreApplicationPrivate::drainLockFreePostedEvents(QThreadData *data)
+{
+    QLockFreePostEventQueue::Node *node = data->postEventList.lockFreeEvents.takeAll();
+    while (node) {
+        QLockFreePostEventQueue::Node *next = node->next;
+        QObjectPrivate *d = QObjectPrivate::get(node->receiver);
+        // stable while we hold the mutex if the receiver lives in our thread
+        QThreadData *receiverData = d->threadData.loadAcquire();
+
+        if (Q_LIKELY(receiverData == data)) {
+            data->postEventList.addEvent(QPostEvent(node->receiver, node->event,
+                                                    Qt::NormalEventPriority));
+            ++d->postedEvents;
+            d->lockFreePostedEvents.deref();
+            data->canWait = false;
+            delete node;
+        } else if (receiverData) {
+            receiverData->postEventList.lockFreeEvents.push(node);
+            QAbstractEventDispatcher *dispatcher = receiverData->eventDispatcher.loadAcquire();
+            if (dispatcher)
+                dispatcher->wakeUp();
+        } else {
+            // receiver is being destroyed
+            d->lockFreePostedEvents.deref();
+            node->event->posted = false;
+            delete node->event;
+            delete node;
+        }
+        node = next;
+    }
+}
 /*!
     \since 4.3
 
@@ -1523,6 +1603,11 @@ QCoreApplicationPrivate::QPostEventListLocker QCoreApplicationPrivate::lockThrea
     details. Events with equal \a priority will be processed in the
     order posted.
 
+    Events of type QEvent::MetaCall posted with Qt::NormalEventPriority,
+    as used for queued signal-slot connections and
+    QMetaObject::invokeMethod(), are queued without locking the
+    receiver's event queue. They are never passed to compressEvent().
+
     \threadsafe
 
     \sa sendEvent(), notify(), sendPostedEvents(), Qt::EventPriority
@@ -1537,6 +1622,12 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
         return;
     }
 
+    if (event->type() == QEvent::MetaCall && priority == Qt::NormalEventPriority
+        && QCoreApplicationPrivate::postLockFreeEvent(receiver, event)) {
+        Q_TRACE(QCoreApplication_postEvent_event_posted, receiver, event, event->type());
+        return;
+    }
+
     auto locker = QCoreApplicationPrivate::lockThreadPostEventList(receiver);
     if (!locker.threadData) {
         // posting during destruction? just delete the event to prevent a leak
@@ -1691,6 +1782,7 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
     ++data->postEventList.recursion;
 
     auto locker = qt_unique_lock(data->postEventList.mutex);
+    drainLockFreePostedEvents(data);
 
     // by default, we assume that the event dispatcher can go to sleep after
     // processing all events. if any new events are posted while we send
@@ -1908,6 +2000,7 @@ void QCoreApplicationPrivate::removePostedEvent(QEvent * event)
     QThreadData *data = QThreadData::current();
 
     const auto locker = qt_scoped_lock(data->postEventList.mutex);
+    drainLockFreePostedEvents(data);
 
     if (data->postEventList.size() == 0) {
 #if defined(QT_DEBUG)
@@ -138,6 +138,8 @@ public:
     static bool threadRequiresCoreApplication();
 
     static void sendPostedEvents(QObject *receiver, int event_type, QThreadData *data);
+    static bool postLockFreeEvent(QObject *receiver, QEvent *event);
+    static void drainLockFreePostedEvents(QThreadData *data);
 
     static void checkReceiverThread(QObject *receiver);
     void cleanupThreadData();
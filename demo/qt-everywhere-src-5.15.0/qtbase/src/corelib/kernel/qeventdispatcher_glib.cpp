@@ -144,10 +144,8 @@ static gboolean timerSourceCheckHelper(GTimerSource *src)
         || (src->processEventsFlags & QEventLoop::X11ExcludeTimers))
         return false;
 
-    if (src->timerList.updateCurrentTime() < src->timerList.constFirst()->timeout)
-        return false;
-
-    return true;
+    timespec tv = { 0l, 0l };
+    return src->timerList.timerWait(tv) && !tv.tv_sec && !tv.tv_nsec;
 }
 
 static gboolean timerSourcePrepare(GSource *source, gint *timeout)
@@ -368,7 +366,6 @@ QEventDispatcherGlib::~QEventDispatcherGlib()
     Q_D(QEventDispatcherGlib);
 
     // destroy all timer sources
-    qDeleteAll(d->timerSource->timerList);
     d->timerSource->timerList.~QTimerInfoList();
     g_source_destroy(&d->timerSource->source);
     g_source_unref(&d->timerSource->source);
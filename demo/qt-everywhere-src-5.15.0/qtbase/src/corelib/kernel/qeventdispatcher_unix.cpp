@@ -55,10 +55,16 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <limits>
+
 #ifndef QT_NO_EVENTFD
 #  include <sys/eventfd.h>
 #endif
 
+#ifdef QT_EVENTDISPATCHER_EPOLL
+#  include <sys/epoll.h>
+#endif
+
 // VxWorks doesn't correctly set the _POSIX_... options
 #if defined(Q_OS_VXWORKS)
 #  if defined(_POSIX_MONOTONIC_CLOCK) && (_POSIX_MONOTONIC_CLOCK <= 0)
@@ -226,12 +232,33 @@ QEventDispatcherUNIXPrivate::QEventDispatcherUNIXPrivate()
 {
     if (Q_UNLIKELY(threadPipe.init() == false))
         qFatal("QEventDispatcherUNIXPrivate(): Cannot continue without a thread pipe");
+
+#ifdef QT_EVENTDISPATCHER_EPOLL
+    // fall back to poll(2) if we can't have epoll(7), or were asked not to
+    epollFd = -1;
+    if (qEnvironmentVariableIsEmpty("QT_NO_EPOLL"))
+        epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd != -1) {
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.fd = threadPipe.fds[0];
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, threadPipe.fds[0], &event) == -1) {
+            qt_safe_close(epollFd);
+            epollFd = -1;
+        }
+    }
+#endif
 }
 
 QEventDispatcherUNIXPrivate::~QEventDispatcherUNIXPrivate()
 {
+#ifdef QT_EVENTDISPATCHER_EPOLL
+    if (epollFd != -1)
+        qt_safe_close(epollFd);
+#endif
+
     // cleanup timers
-    qDeleteAll(timerList);
+    timerList.clear();
 }
 
 void QEventDispatcherUNIXPrivate::setSocketNotifierPending(QSocketNotifier *notifier)
@@ -289,6 +316,118 @@ void QEventDispatcherUNIXPrivate::markPendingSocketNotifiers()
     pollfds.clear();
 }
 
+#ifdef QT_EVENTDISPATCHER_EPOLL
+static uint toEpollEvents(short events)
+{
+    uint result = 0;
+    if (events & POLLIN)
+        result |= EPOLLIN;
+    if (events & POLLOUT)
+        result |= EPOLLOUT;
+    if (events & POLLPRI)
+        result |= EPOLLPRI;
+    return result;
+}
+
+static short fromEpollEvents(uint events)
+{
+    short result = 0;
+    if (events & EPOLLIN)
+        result |= POLLIN;
+    if (events & EPOLLOUT)
+        result |= POLLOUT;
+    if (events & EPOLLPRI)
+        result |= POLLPRI;
+    if (events & EPOLLERR)
+        result |= POLLERR;
+    if (events & EPOLLHUP)
+        result |= POLLHUP;
+    return result;
+}
+
+void QEventDispatcherUNIXPrivate::updateEpollInterest(int fd, short oldEvents, short newEvents)
+{
+    if (oldEvents == newEvents)
+        return;
+
+    const int pollOnlyIndex = pollOnlyFds.indexOf(fd);
+    if (pollOnlyIndex != -1) {
+        if (!newEvents)
+            pollOnlyFds.remove(pollOnlyIndex);
+        return;
+    }
+
+    epoll_event event = {};
+    event.events = toEpollEvents(newEvents);
+    event.data.fd = fd;
+
+    int op = !oldEvents ? EPOLL_CTL_ADD : newEvents ? EPOLL_CTL_MOD : EPOLL_CTL_DEL;
+    int ret = epoll_ctl(epollFd, op, fd, &event);
+    if (ret == -1 && op != EPOLL_CTL_DEL) {
+        // The kernel drops a registration when the file is closed and may
+        // keep one we thought was gone if the file lives on in a dup()ed
+        // descriptor, so our idea of what's registered can be stale
+        if (errno == EEXIST) {
+            op = EPOLL_CTL_MOD;
+            ret = epoll_ctl(epollFd, op, fd, &event);
+        } else if (errno == ENOENT) {
+            op = EPOLL_CTL_ADD;
+            ret = epoll_ctl(epollFd, op, fd, &event);
+        }
+    }
+
+    // epoll(7) refuses regular files and bad descriptors with EPERM and
+    // EBADF; let poll(2) report those the way it always has
+    if (ret == -1 && op == EPOLL_CTL_ADD)
+        pollOnlyFds.append(fd);
+}
+
+int QEventDispatcherUNIXPrivate::processEpollEvents(timespec *tm)
+{
+    timespec zero = { 0, 0 };
+
+    pollfds.clear();
+    if (!pollOnlyFds.isEmpty()) {
+        pollfds.reserve(pollOnlyFds.size());
+        for (int fd : qAsConst(pollOnlyFds))
+            pollfds.append(qt_make_pollfd(fd, socketNotifiers.value(fd).events()));
+        if (qt_safe_poll(pollfds.data(), pollfds.size(), &zero) > 0)
+            tm = &zero;
+    }
+
+    int timeout = -1;
+    if (tm) {
+        // round up, or we'd spin until a timer that's less than 1 ms away
+        const qint64 msecs = qint64(tm->tv_sec) * 1000 + (tm->tv_nsec + 999999) / 1000000;
+        timeout = int(qMin(msecs, qint64(std::numeric_limits<int>::max())));
+    }
+
+    epoll_event events[256];
+    int count = epoll_wait(epollFd, events, int(sizeof(events) / sizeof(events[0])), timeout);
+    if (count == -1) {
+        if (errno != EINTR)
+            perror("epoll_wait");
+        count = 0;
+    }
+
+    int nevents = 0;
+    for (int i = 0; i < count; ++i) {
+        pollfd pfd = qt_make_pollfd(events[i].data.fd, 0);
+        pfd.revents = fromEpollEvents(events[i].events);
+        if (pfd.fd == threadPipe.fds[0]) {
+            nevents += threadPipe.check(pfd);
+        } else if (socketNotifiers.contains(pfd.fd)) {
+            pollfds.append(pfd);
+        } else {
+            // a stale registration (see updateEpollInterest)
+            epoll_ctl(epollFd, EPOLL_CTL_DEL, pfd.fd, &events[i]);
+        }
+    }
+
+    return nevents + activateSocketNotifiers();
+}
+#endif
+
 int QEventDispatcherUNIXPrivate::activateSocketNotifiers()
 {
     markPendingSocketNotifiers();
@@ -411,7 +550,16 @@ void QEventDispatcherUNIX::registerSocketNotifier(QSocketNotifier *notifier)
         qWarning("%s: Multiple socket notifiers for same socket %d and type %s",
                  Q_FUNC_INFO, sockfd, socketType(type));
 
+#ifdef QT_EVENTDISPATCHER_EPOLL
+    const short oldEvents = sn_set.events();
+#endif
+
     sn_set.notifiers[type] = notifier;
+
+#ifdef QT_EVENTDISPATCHER_EPOLL
+    if (d->epollFd != -1)
+        d->updateEpollInterest(sockfd, oldEvents, sn_set.events());
+#endif
 }
 
 void QEventDispatcherUNIX::unregisterSocketNotifier(QSocketNotifier *notifier)
@@ -450,8 +598,17 @@ void QEventDispatcherUNIX::unregisterSocketNotifier(QSocketNotifier *notifier)
         return;
     }
 
+#ifdef QT_EVENTDISPATCHER_EPOLL
+    const short oldEvents = sn_set.events();
+#endif
+
     sn_set.notifiers[type] = nullptr;
 
+#ifdef QT_EVENTDISPATCHER_EPOLL
+    if (d->epollFd != -1)
+        d->updateEpollInterest(sockfd, oldEvents, sn_set.events());
+#endif
+
     if (sn_set.isEmpty())
         d->socketNotifiers.erase(i);
 }
@@ -487,6 +644,17 @@ bool QEventDispatcherUNIX::processEvents(QEventLoop::ProcessEventsFlags flags)
     if (!canWait || (include_timers && d->timerList.timerWait(wait_tm)))
         tm = &wait_tm;
 
+    int nevents = 0;
+
+#ifdef QT_EVENTDISPATCHER_EPOLL
+    if (include_notifiers && d->epollFd != -1) {
+        nevents += d->processEpollEvents(tm);
+        if (include_timers)
+            nevents += d->activateTimers();
+        return (nevents > 0);
+    }
+#endif
+
     d->pollfds.clear();
     d->pollfds.reserve(1 + (include_notifiers ? d->socketNotifiers.size() : 0));
 
@@ -497,8 +665,6 @@ bool QEventDispatcherUNIX::processEvents(QEventLoop::ProcessEventsFlags flags)
     // This must be last, as it's popped off the end below
     d->pollfds.append(d->threadPipe.prepare());
 
-    int nevents = 0;
-
     switch (qt_safe_poll(d->pollfds.data(), d->pollfds.size(), tm)) {
     case -1:
         perror("qt_safe_poll");
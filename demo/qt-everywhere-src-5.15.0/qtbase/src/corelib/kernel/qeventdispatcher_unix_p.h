@@ -58,6 +58,10 @@
 #include "QtCore/qvarlengtharray.h"
 #include "private/qtimerinfo_unix_p.h"
 
+#if defined(Q_OS_LINUX) && !defined(QT_NO_EPOLL)
+#  define QT_EVENTDISPATCHER_EPOLL
+#endif
+
 QT_BEGIN_NAMESPACE
 
 class QEventDispatcherUNIXPrivate;
@@ -140,9 +144,21 @@ public:
     int activateSocketNotifiers();
     void setSocketNotifierPending(QSocketNotifier *notifier);
 
+#ifdef QT_EVENTDISPATCHER_EPOLL
+    void updateEpollInterest(int fd, short oldEvents, short newEvents);
+    int processEpollEvents(timespec *tm);
+#endif
+
     QThreadPipe threadPipe;
     QVector<pollfd> pollfds;
 
+#ifdef QT_EVENTDISPATCHER_EPOLL
+    // The socket notifiers stay registered with epollFd across iterations;
+    // pollOnlyFds are the few that epoll(7) refuses, such as regular files
+    int epollFd;
+    QVector<int> pollOnlyFds;
+#endif
+
     QHash<int, QSocketNotifierSetUNIX> socketNotifiers;
     QVector<QSocketNotifier *> pendingNotifiers;
 
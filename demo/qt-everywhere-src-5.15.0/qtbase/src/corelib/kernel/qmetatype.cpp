@@ -577,6 +577,8 @@ public:
 
     bool contains(Key k) const
     {
+        if (isEmpty())
+            return false;
         const QReadLocker locker(&lock);
         return map.contains(k);
     }
@@ -588,11 +590,14 @@ public:
         if (fun)
             return false;
         fun = f;
+        count.storeRelease(map.size());
         return true;
     }
 
     const T *function(Key k) const
     {
+        if (isEmpty())
+            return nullptr;
         const QReadLocker locker(&lock);
         return map.value(k, nullptr);
     }
@@ -602,10 +607,17 @@ public:
         const Key k(from, to);
         const QWriteLocker locker(&lock);
         map.remove(k);
+        count.storeRelease(map.size());
     }
 private:
+    // QVariant asks for converters on every conversion involving a user
+    // type; most of those lookups fail, so skip the lock while nothing
+    // has been registered.
+    bool isEmpty() const { return count.loadAcquire() == 0; }
+
     mutable QReadWriteLock lock;
     QHash<Key, const T *> map;
+    QAtomicInt count;
 };
 
 typedef QMetaTypeFunctionRegistry<QtPrivate::AbstractConverterFunction,QPair<int,int> >
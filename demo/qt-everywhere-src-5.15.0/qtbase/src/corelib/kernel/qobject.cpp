@@ -68,6 +68,7 @@
 
 #include <private/qorderedmutexlocker_p.h>
 #include <private/qhooks_p.h>
+#include <private/qobjectarena_p.h>
 #include <qtcore_tracepoints_p.h>
 
 #include <new>
@@ -179,6 +180,28 @@ void (*QAbstractDeclarativeData::setWidgetParent)(QObject *, QObject *) = nullpt
 
 QObjectData::~QObjectData() {}
 
+/*!
+    \internal
+
+    Allocates the private of an object that QObjectArena is creating from
+    its arena, and from the heap otherwise.
+ */
+void *QObjectData::operator new(size_t size)
+{
+    if (void *ptr = QObjectArena::allocatePrivate(size))
+        return ptr;
+    return ::operator new(size);
+}
+
+/*!
+    \internal
+ */
+void QObjectData::operator delete(void *ptr)
+{
+    if (!QObjectArena::deallocate(ptr))
+        ::operator delete(ptr);
+}
+
 QMetaObject *QObjectData::dynamicMetaObject() const
 {
     return metaObject->toDynamicMetaObject(q_ptr);
@@ -222,7 +245,7 @@ QObjectPrivate::~QObjectPrivate()
         }
     }
 
-    if (postedEvents)
+    if (postedEvents || lockFreePostedEvents.loadAcquire())
         QCoreApplication::removePostedEvents(q_ptr, 0);
 
     thisThreadData->deref();
@@ -621,6 +644,149 @@ void QMetaCallEvent::placeMetaCall(QObject *object)
     }
 }
 
+/*!
+    \internal
+
+    Creates an empty batch for the queued connection \a c. The batch keeps
+    a reference on the connection, so that it can close itself when it is
+    delivered or destroyed, and on the slot object, if any.
+ */
+QBatchedMetaCallEvent::QBatchedMetaCallEvent(QObjectPrivate::Connection *c,
+                                             const QObject *sender, int signalId,
+                                             const int *argumentTypes, int nargs)
+    : QAbstractMetaCallEvent(sender, signalId),
+      connection_(c),
+      receiver_(c->receiver.loadRelaxed()),
+      slotObj_(c->isSlotObject ? c->slotObj : nullptr),
+      callFunction_(c->isSlotObject ? nullptr : c->callFunction),
+      types_(argumentTypes),
+      nargs_(nargs),
+      method_offset_(c->isSlotObject ? 0 : c->method_offset),
+      method_relative_(c->isSlotObject ? ushort(-1) : c->method_relative),
+      relocatable_(true),
+      tupleSize_(0),
+      storage_(nullptr),
+      count_(0),
+      capacity_(0)
+{
+    constexpr int align = int(alignof(std::max_align_t));
+    offsets_.resize(nargs_);
+    offsets_[0] = 0; // return value, not stored
+    for (int n = 1; n < nargs_; ++n) {
+        offsets_[n] = tupleSize_;
+        tupleSize_ += (QMetaType::sizeOf(types_[n - 1]) + align - 1) & ~(align - 1);
+        if (!(QMetaType::typeFlags(types_[n - 1]) & QMetaType::MovableType))
+            relocatable_ = false;
+    }
+
+    c->ref();
+    if (slotObj_)
+        slotObj_->ref();
+}
+
+/*!
+    \internal
+ */
+QBatchedMetaCallEvent::~QBatchedMetaCallEvent()
+{
+    detach();
+    for (int i = 0; i < count_; ++i) {
+        for (int n = 1; n < nargs_; ++n)
+            QMetaType::destruct(types_[n - 1], tuple(i) + offsets_[n]);
+    }
+    free(storage_);
+    if (slotObj_)
+        slotObj_->destroyIfLastRef();
+    connection_->deref();
+}
+
+/*!
+    \internal
+
+    Stops further emissions from being added to this batch.
+ */
+void QBatchedMetaCallEvent::detach()
+{
+    QBasicMutexLocker locker(signalSlotLock(receiver_));
+    if (connection_->pendingBatch == this)
+        connection_->pendingBatch = nullptr;
+}
+
+/*!
+    \internal
+ */
+void QBatchedMetaCallEvent::reserve(int capacity)
+{
+    if (capacity <= capacity_ || !tupleSize_) {
+        capacity_ = qMax(capacity, capacity_);
+        return;
+    }
+
+    char *memory = static_cast<char *>(malloc(size_t(capacity) * size_t(tupleSize_)));
+    Q_CHECK_PTR(memory);
+    if (relocatable_) {
+        if (count_)
+            memcpy(memory, storage_, size_t(count_) * size_t(tupleSize_));
+    } else {
+        for (int i = 0; i < count_; ++i) {
+            for (int n = 1; n < nargs_; ++n) {
+                void *from = tuple(i) + offsets_[n];
+                QMetaType::construct(types_[n - 1], memory + i * tupleSize_ + offsets_[n], from);
+                QMetaType::destruct(types_[n - 1], from);
+            }
+        }
+    }
+    free(storage_);
+    storage_ = memory;
+    capacity_ = capacity;
+}
+
+/*!
+    \internal
+
+    Copies the arguments of one emission, \a argv, to the end of the batch.
+ */
+void QBatchedMetaCallEvent::append(void **argv)
+{
+    if (count_ == capacity_)
+        reserve(qMax(4, capacity_ * 2));
+    for (int n = 1; n < nargs_; ++n)
+        QMetaType::construct(types_[n - 1], tuple(count_) + offsets_[n], argv[n]);
+    ++count_;
+}
+
+/*!
+    \internal
+
+    Invokes the slot once for each emission in the batch, in the order of
+    emission.
+ */
+void QBatchedMetaCallEvent::placeMetaCall(QObject *object)
+{
+    detach();
+    {
+        // wait for emitting threads that found the batch before detach()
+        QMutexLocker locker(&mutex);
+    }
+
+    QPointer<QObject> guard(object);
+    QVarLengthArray<void *, 8> args(nargs_);
+    args[0] = nullptr;
+    for (int i = 0; i < count_ && guard; ++i) {
+        for (int n = 1; n < nargs_; ++n)
+            args[n] = tuple(i) + offsets_[n];
+
+        if (slotObj_) {
+            slotObj_->call(object, args.data());
+        } else if (callFunction_ && method_offset_ <= object->metaObject()->methodOffset()) {
+            callFunction_(object, QMetaObject::InvokeMetaMethod, method_relative_, args.data());
+        } else {
+            QMetaObject::metacall(object, QMetaObject::InvokeMetaMethod,
+                                  method_offset_ + method_relative_, args.data());
+        }
+    }
+}
+
 /*!
     \class QSignalBlocker
     \brief Exception-safe wrapper around QObject::blockSignals().
@@ -969,6 +1135,17 @@ QObject::QObject(QObjectPrivate &dd, QObject *parent)
     \sa deleteLater()
 */
 
+/*!
+    \internal
+
+    Leaves the memory of objects created by QObjectArena to the arena.
+ */
+void QObject::operator delete(void *ptr)
+{
+    if (!QObjectArena::deallocate(ptr))
+        ::operator delete(ptr);
+}
+
 QObject::~QObject()
 {
     Q_D(QObject);
@@ -1580,9 +1757,18 @@ void QObject::moveToThread(QThread *targetThread)
     // keep currentData alive (since we've got it locked)
     currentData->ref();
 
+    // merge the events posted without the lock, so that they are moved below
+    QCoreApplicationPrivate::drainLockFreePostedEvents(currentData);
+
     // move the object
     d_func()->setThreadData_helper(currentData, targetData);
 
+    // Pairs with the fence in QCoreApplicationPrivate::postLockFreeEvent():
+    // an event pushed concurrently is either seen by this second drain, which
+    // forwards it to targetData, or its poster sees the new thread data.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    QCoreApplicationPrivate::drainLockFreePostedEvents(currentData);
+
     locker.unlock();
 
     // now currentData can commit suicide if it wants to
@@ -2881,7 +3067,7 @@ QMetaObject::Connection QObject::connect(const QObject *sender, const char *sign
     }
 
     int *types = nullptr;
-    if ((type == Qt::QueuedConnection)
+    if (((type & ~Qt::BatchedConnection) == Qt::QueuedConnection)
             && !(types = queuedConnectionTypes(signalTypes.constData(), signalTypes.size()))) {
         return QMetaObject::Connection(nullptr);
     }
@@ -2962,7 +3148,7 @@ QMetaObject::Connection QObject::connect(const QObject *sender, const QMetaMetho
     }
 
     int *types = nullptr;
-    if ((type == Qt::QueuedConnection)
+    if (((type & ~Qt::BatchedConnection) == Qt::QueuedConnection)
             && !(types = queuedConnectionTypes(signal.parameterTypes())))
         return QMetaObject::Connection(nullptr);
 
@@ -3403,6 +3589,9 @@ QObjectPrivate::Connection *QMetaObjectPrivate::connect(const QObject *sender,
     QOrderedMutexLocker locker(signalSlotLock(sender),
                                signalSlotLock(receiver));
 
+    const bool batched = type & Qt::BatchedConnection;
+    type &= ~Qt::BatchedConnection;
+
     QObjectPrivate::ConnectionData *scd  = QObjectPrivate::get(s)->connections.loadRelaxed();
     if (type & Qt::UniqueConnection && scd) {
         if (scd->signalVectorCount() > signal_index) {
@@ -3429,6 +3618,7 @@ QObjectPrivate::Connection *QMetaObjectPrivate::connect(const QObject *sender,
     c->method_relative = method_index;
     c->method_offset = method_offset;
     c->connectionType = type;
+    c->isBatched = batched;
     c->isSlotObject = false;
     c->argumentTypes.storeRelaxed(types);
     c->callFunction = callFunction;
@@ -3727,6 +3917,35 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
         // the connection has been disconnected before we got the lock
         return;
     }
+
+    if (c->isBatched) {
+        if (QBatchedMetaCallEvent *batch = c->pendingBatch) {
+            // the batch cannot be delivered before we release its mutex
+            QMutexLocker batchLocker(&batch->mutex);
+            locker.unlock();
+            batch->append(argv);
+            return;
+        }
+
+        QBatchedMetaCallEvent *batch = new QBatchedMetaCallEvent(c, sender, signal,
+                                                                 argumentTypes, nargs);
+        c->pendingBatch = batch;
+        {
+            QMutexLocker batchLocker(&batch->mutex);
+            locker.unlock();
+            batch->append(argv);
+        }
+
+        locker.relock();
+        if (!c->receiver.loadRelaxed()) {
+            // the connection has been disconnected while we were unlocked
+            locker.unlock();
+            delete batch;
+            return;
+        }
+        QCoreApplication::postEvent(c->receiver.loadRelaxed(), batch);
+        return;
+    }
     if (c->isSlotObject)
         c->slotObj->ref();
     locker.unlock();
@@ -5031,6 +5250,9 @@ QMetaObject::Connection QObjectPrivate::connectImpl(const QObject *sender, int s
     QOrderedMutexLocker locker(signalSlotLock(sender),
                                signalSlotLock(receiver));
 
+    const bool batched = type & Qt::BatchedConnection;
+    type = static_cast<Qt::ConnectionType>(type & ~Qt::BatchedConnection);
+
     if (type & Qt::UniqueConnection && slot && QObjectPrivate::get(s)->connections.loadRelaxed()) {
         QObjectPrivate::ConnectionData *connections = QObjectPrivate::get(s)->connections.loadRelaxed();
         if (connections->signalVectorCount() > signal_index) {
@@ -5056,6 +5278,7 @@ QMetaObject::Connection QObjectPrivate::connectImpl(const QObject *sender, int s
     c->receiver.storeRelaxed(r);
     c->slotObj = slotObj;
     c->connectionType = type;
+    c->isBatched = batched;
     c->isSlotObject = true;
     if (types) {
         c->argumentTypes.storeRelaxed(types);
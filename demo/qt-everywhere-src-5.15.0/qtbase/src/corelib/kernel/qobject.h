@@ -101,6 +101,10 @@ class Q_CORE_EXPORT QObjectData {
 public:
     QObjectData() = default;
     virtual ~QObjectData() = 0;
+    static void *operator new(size_t size);
+    static void *operator new(size_t, void *where) noexcept { return where; }
+    static void operator delete(void *ptr);
+    static void operator delete(void *, void *) noexcept {}
     QObject *q_ptr;
     QObject *parent;
     QObjectList children;
@@ -134,6 +138,7 @@ class Q_CORE_EXPORT QObject
 public:
     Q_INVOKABLE explicit QObject(QObject *parent=nullptr);
     virtual ~QObject();
+    static void operator delete(void *ptr);
 
     virtual bool event(QEvent *event);
     virtual bool eventFilter(QObject *watched, QEvent *event);
@@ -258,7 +263,7 @@ public:
                           "Return type of the slot is not compatible with the return type of the signal.");
 
         const int *types = nullptr;
-        if (type == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
+        if ((type & ~Qt::BatchedConnection) == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
             types = QtPrivate::ConnectionTypes<typename SignalType::Arguments>::types();
 
         return connectImpl(sender, reinterpret_cast<void **>(&signal),
@@ -298,7 +303,7 @@ public:
                           "Return type of the slot is not compatible with the return type of the signal.");
 
         const int *types = nullptr;
-        if (type == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
+        if ((type & ~Qt::BatchedConnection) == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
             types = QtPrivate::ConnectionTypes<typename SignalType::Arguments>::types();
 
         return connectImpl(sender, reinterpret_cast<void **>(&signal), context, nullptr,
@@ -337,7 +342,7 @@ public:
                           "No Q_OBJECT in the class with the signal");
 
         const int *types = nullptr;
-        if (type == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
+        if ((type & ~Qt::BatchedConnection) == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
             types = QtPrivate::ConnectionTypes<typename SignalType::Arguments>::types();
 
         return connectImpl(sender, reinterpret_cast<void **>(&signal), context, nullptr,
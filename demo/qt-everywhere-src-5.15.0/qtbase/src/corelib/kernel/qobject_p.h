@@ -61,12 +61,15 @@
 #include "QtCore/qvector.h"
 #include "QtCore/qvariant.h"
 #include "QtCore/qreadwritelock.h"
+#include "QtCore/qmutex.h"
+#include "QtCore/qvarlengtharray.h"
 
 QT_BEGIN_NAMESPACE
 
 class QVariant;
 class QThreadData;
 class QObjectConnectionListVector;
+class QBatchedMetaCallEvent;
 namespace QtSharedPointer { struct ExternalRefCountData; }
 
 /* for Qt Test */
@@ -169,7 +172,10 @@ public:
         ushort connectionType : 3; // 0 == auto, 1 == direct, 2 == queued, 4 == blocking
         ushort isSlotObject : 1;
         ushort ownArgumentTypes : 1;
-        Connection() : ref_(2), ownArgumentTypes(true) {
+        ushort isBatched : 1;
+        // open batch of queued emissions, protected by signalSlotLock(receiver)
+        QBatchedMetaCallEvent *pendingBatch = nullptr;
+        Connection() : ref_(2), ownArgumentTypes(true), isBatched(false) {
             //ref_ is 2 for the use in the internal lists, and for the use in QMetaObject::Connection
         }
         ~Connection();
@@ -394,6 +400,11 @@ public:
     // these objects are all used to indicate that a QObject was deleted
     // plus QPointer, which keeps a separate list
     QAtomicPointer<QtSharedPointer::ExternalRefCountData> sharedRefcount;
+
+    // events posted to this object that have not been merged into
+    // QThreadData::postEventList yet; they are counted in postedEvents
+    // once they are
+    QAtomicInt lockFreePostedEvents;
 };
 
 Q_DECLARE_TYPEINFO(QObjectPrivate::ConnectionList, Q_MOVABLE_TYPE);
@@ -581,6 +592,46 @@ private:
     char prealloc_[3*(sizeof(void*) + sizeof(int))];
 };
 
+// Collects the emissions of a signal over a Qt::BatchedConnection until
+// the event is delivered. The arguments of each emission are copied into
+// one contiguous buffer, one tuple after the other.
+class QBatchedMetaCallEvent : public QAbstractMetaCallEvent
+{
+public:
+    QBatchedMetaCallEvent(QObjectPrivate::Connection *c, const QObject *sender, int signalId,
+                          const int *argumentTypes, int nargs);
+    ~QBatchedMetaCallEvent() override;
+
+    // must be called with mutex locked, before the event is delivered
+    void append(void **argv);
+    inline int count() const { return count_; }
+
+    void placeMetaCall(QObject *object) override;
+
+    QMutex mutex;
+
+private:
+    Q_DISABLE_COPY_MOVE(QBatchedMetaCallEvent)
+    void detach();
+    void reserve(int capacity);
+    inline char *tuple(int i) const { return storage_ + i * tupleSize_; }
+
+    QObjectPrivate::Connection *connection_;
+    const QObject *receiver_; // only used to pick the signalSlotLock()
+    QtPrivate::QSlotObjectBase *slotObj_;
+    QObjectPrivate::StaticMetaCallFunction callFunction_;
+    const int *types_; // owned by connection_, without the return type
+    int nargs_;
+    ushort method_offset_;
+    ushort method_relative_;
+    bool relocatable_;
+    QVarLengthArray<int, 4> offsets_;
+    int tupleSize_;
+    char *storage_;
+    int count_;
+    int capacity_;
+};
+
 class QBoolBlocker
 {
     Q_DISABLE_COPY_MOVE(QBoolBlocker)
@@ -0,0 +1,320 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qobjectarena_p.h"
+
+#include <QtCore/qglobalstatic.h>
+#include <QtCore/qmap.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QObjectArena
+    \inmodule QtCore
+    \since 5.16
+
+    \brief The QObjectArena class allocates trees of QObjects from a bump arena.
+
+    Creating a QObject normally costs two heap allocations: one for the
+    object and one for its QObjectPrivate. create() carves both out of large
+    blocks owned by the arena instead. Destroying an arena object through
+    \c delete, deleteLater() or its parent runs its destructor as usual, but
+    leaves the memory in the arena. release() destroys the objects that are
+    still alive, newest first, and then frees all the blocks at once.
+
+    Arena objects follow the usual parent/child ownership rules, and they
+    may have parents or children that were allocated on the heap. Objects
+    must not be used by other threads when the arena is released.
+
+    Only the QObjectData allocated first while constructing an object comes
+    from the arena; containers inside the private and data created later,
+    like connection lists or dynamic properties, still use the heap. Types
+    that provide their own operator new or delete cannot be used with
+    create().
+*/
+
+namespace {
+struct ObjectHeader
+{
+    qsizetype index; // into QObjectArenaPrivate::objects, or -1 for a private
+};
+
+struct ArenaBlock
+{
+    quintptr begin;
+    QObjectArenaPrivate *arena;
+};
+
+struct QObjectArenaRegistry
+{
+    QMutex mutex;
+    QMap<quintptr, ArenaBlock> blocks; // keyed by the end of the block
+};
+}
+
+Q_GLOBAL_STATIC(QObjectArenaRegistry, arenaRegistry)
+static QBasicAtomicInt registeredBlocks = Q_BASIC_ATOMIC_INITIALIZER(0);
+static thread_local QObjectArenaPrivate *currentArena = nullptr;
+
+enum {
+    Alignment = alignof(std::max_align_t),
+    HeaderSize = (sizeof(ObjectHeader) + Alignment - 1) & ~(Alignment - 1)
+};
+
+class QObjectArenaPrivate
+{
+public:
+    explicit QObjectArenaPrivate(qsizetype blockSize) : blockSize(blockSize) {}
+
+    void *allocate(std::size_t size, qsizetype index);
+    void addBlock(qsizetype size);
+    void freeBlocks();
+
+    const qsizetype blockSize;
+    char *current = nullptr;
+    char *end = nullptr;
+    qsizetype allocated = 0;
+    QVector<char *> blocks;
+
+    // guarded by the registry's mutex, since objects can be destroyed
+    // in other threads
+    QVector<QObject *> objects;
+    qsizetype liveObjects = 0;
+};
+
+void *QObjectArenaPrivate::allocate(std::size_t size, qsizetype index)
+{
+    const qsizetype needed = HeaderSize + ((qsizetype(size) + Alignment - 1) & ~qsizetype(Alignment - 1));
+    if (end - current < needed)
+        addBlock(qMax(blockSize, needed));
+
+    new (current) ObjectHeader{index};
+    void *storage = current + HeaderSize;
+    current += needed;
+    allocated += needed;
+    return storage;
+}
+
+void QObjectArenaPrivate::addBlock(qsizetype size)
+{
+    char *block = static_cast<char *>(::operator new(size));
+    blocks.append(block);
+    current = block;
+    end = block + size;
+
+    QObjectArenaRegistry *registry = arenaRegistry();
+    QMutexLocker locker(&registry->mutex);
+    registry->blocks.insert(quintptr(end), ArenaBlock{quintptr(block), this});
+    registeredBlocks.ref();
+}
+
+void QObjectArenaPrivate::freeBlocks()
+{
+    if (blocks.isEmpty())
+        return;
+
+    if (QObjectArenaRegistry *registry = arenaRegistry()) {
+        QMutexLocker locker(&registry->mutex);
+        for (auto it = registry->blocks.begin(); it != registry->blocks.end(); ) {
+            if (it->arena == this) {
+                it = registry->blocks.erase(it);
+                registeredBlocks.deref();
+            } else {
+                ++it;
+            }
+        }
+        objects.clear();
+        liveObjects = 0;
+    }
+
+    for (char *block : qAsConst(blocks))
+        ::operator delete(block);
+    blocks.clear();
+    current = end = nullptr;
+    allocated = 0;
+}
+
+/*!
+    Constructs an arena that allocates memory in blocks of \a blockSize bytes.
+    Objects larger than a block get a block of their own.
+*/
+QObjectArena::QObjectArena(qsizetype blockSize)
+    : d(new QObjectArenaPrivate(qMax(blockSize, qsizetype(HeaderSize + Alignment))))
+{
+}
+
+/*!
+    Destroys the arena, calling release() first.
+*/
+QObjectArena::~QObjectArena()
+{
+    release();
+    delete d;
+}
+
+/*!
+    \fn template <typename T, typename... Args> T *QObjectArena::create(Args &&... args)
+
+    Constructs an object of type \c T, a QObject subclass, in the arena,
+    passing \a args to its constructor. Its QObjectPrivate is allocated from
+    the arena as well. The object can be destroyed like any other until the
+    arena is released.
+*/
+
+/*!
+    Destroys the objects created in this arena that are still alive, in the
+    reverse order of their creation, and frees all the arena's memory.
+
+    Children are usually created after their parents, so they are destroyed
+    first; children that were allocated on the heap are deleted by their
+    arena parent as usual.
+*/
+void QObjectArena::release()
+{
+    QObjectArenaRegistry *registry = arenaRegistry();
+    for (qsizetype i = d->objects.size() - 1; i >= 0; --i) {
+        QObject *object;
+        {
+            QMutexLocker locker(&registry->mutex);
+            if (i >= d->objects.size())
+                continue;
+            object = d->objects.at(i);
+        }
+        // clears its own slot, from QObject::operator delete
+        delete object;
+    }
+    d->freeBlocks();
+}
+
+/*!
+    Returns the number of objects created in this arena that have not been
+    destroyed yet.
+*/
+qsizetype QObjectArena::objectCount() const
+{
+    QObjectArenaRegistry *registry = arenaRegistry();
+    QMutexLocker locker(&registry->mutex);
+    return d->liveObjects;
+}
+
+/*!
+    Returns the number of bytes handed out by the arena since it was
+    constructed or last released, including headers and padding.
+*/
+qsizetype QObjectArena::bytesAllocated() const
+{
+    return d->allocated;
+}
+
+/*!
+    \internal
+
+    Returns memory for the QObjectData of the object currently being created
+    by create() on this thread, or \nullptr if there is none. The request is
+    answered only once per create(), so objects created on the heap by the
+    constructor keep heap allocated privates.
+*/
+void *QObjectArena::allocatePrivate(std::size_t size)
+{
+    QObjectArenaPrivate *arena = currentArena;
+    if (Q_LIKELY(!arena))
+        return nullptr;
+    currentArena = nullptr;
+    return arena->allocate(size, -1);
+}
+
+/*!
+    \internal
+
+    Returns \c true if \a ptr was allocated by an arena, after marking the
+    object it holds as destroyed; otherwise returns \c false and the caller
+    must free \a ptr itself.
+*/
+bool QObjectArena::deallocate(void *ptr)
+{
+    if (!ptr || Q_LIKELY(!registeredBlocks.loadAcquire()))
+        return false;
+    QObjectArenaRegistry *registry = arenaRegistry();
+    if (!registry)
+        return false;
+
+    QMutexLocker locker(&registry->mutex);
+    const auto it = registry->blocks.upperBound(quintptr(ptr));
+    if (it == registry->blocks.end() || it->begin > quintptr(ptr))
+        return false;
+
+    const ObjectHeader *header = reinterpret_cast<const ObjectHeader *>(static_cast<char *>(ptr) - HeaderSize);
+    if (header->index >= 0) {
+        QObjectArenaPrivate *arena = it->arena;
+        arena->objects[header->index] = nullptr;
+        --arena->liveObjects;
+    }
+    return true;
+}
+
+QObjectArena::ObjectScope::ObjectScope(QObjectArena *arena, std::size_t size)
+    : d(arena->d), previous(currentArena)
+{
+    QObjectArenaRegistry *registry = arenaRegistry();
+    {
+        QMutexLocker locker(&registry->mutex);
+        index = d->objects.size();
+        d->objects.append(nullptr);
+    }
+    storage = d->allocate(size, index);
+    currentArena = d;
+}
+
+QObjectArena::ObjectScope::~ObjectScope()
+{
+    currentArena = previous;
+}
+
+void QObjectArena::ObjectScope::commit(QObject *object)
+{
+    QObjectArenaRegistry *registry = arenaRegistry();
+    QMutexLocker locker(&registry->mutex);
+    d->objects[index] = object;
+    ++d->liveObjects;
+}
+
+QT_END_NAMESPACE
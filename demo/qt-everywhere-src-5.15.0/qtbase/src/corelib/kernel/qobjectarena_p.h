@@ -0,0 +1,115 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOBJECTARENA_P_H
+#define QOBJECTARENA_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail. This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qobject.h>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+class QObjectArenaPrivate;
+
+class Q_CORE_EXPORT QObjectArena
+{
+    Q_DISABLE_COPY_MOVE(QObjectArena)
+public:
+    enum { DefaultBlockSize = 64 * 1024 };
+
+    explicit QObjectArena(qsizetype blockSize = DefaultBlockSize);
+    ~QObjectArena();
+
+    template <typename T, typename... Args>
+    T *create(Args &&... args)
+    {
+        static_assert(std::is_base_of<QObject, T>::value,
+                      "QObjectArena::create() requires a QObject subclass");
+        static_assert(alignof(T) <= alignof(std::max_align_t),
+                      "QObjectArena::create() does not support over-aligned types");
+        ObjectScope scope(this, sizeof(T));
+        T *object = new (scope.storage) T(std::forward<Args>(args)...);
+        scope.commit(object);
+        return object;
+    }
+
+    void release();
+
+    qsizetype objectCount() const;
+    qsizetype bytesAllocated() const;
+
+    // used by QObject and QObjectData's operator new and delete
+    static void *allocatePrivate(std::size_t size);
+    static bool deallocate(void *ptr);
+
+private:
+    struct Q_CORE_EXPORT ObjectScope
+    {
+        ObjectScope(QObjectArena *arena, std::size_t size);
+        ~ObjectScope();
+        void commit(QObject *object);
+
+        QObjectArenaPrivate *d;
+        QObjectArenaPrivate *previous;
+        void *storage;
+        qsizetype index;
+    };
+
+    QObjectArenaPrivate *d;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOBJECTARENA_P_H
@@ -53,6 +53,8 @@
 
 #include <sys/times.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 Q_CORE_EXPORT bool qt_disable_lowpriority_timers=false;
@@ -62,6 +64,33 @@ Q_CORE_EXPORT bool qt_disable_lowpriority_timers=false;
  * timerBitVec array is used for keeping track of timer identifiers.
  */
 
+static inline qint64 timespecToTick(const timespec &t)
+{
+    return qint64(t.tv_sec) * 1000 + t.tv_nsec / (1000 * 1000);
+}
+
+static inline timespec tickToTimespec(qint64 tick)
+{
+    timespec t;
+    t.tv_sec = tick / 1000;
+    t.tv_nsec = (tick % 1000) * 1000 * 1000;
+    return t;
+}
+
+static inline qint64 timespecToNSecs(const timespec &t)
+{
+    return qint64(t.tv_sec) * 1000 * 1000 * 1000 + t.tv_nsec;
+}
+
+static inline bool timerLessThan(const QTimerInfo *t1, const QTimerInfo *t2)
+{
+    if (t1->timeout < t2->timeout)
+        return true;
+    if (t2->timeout < t1->timeout)
+        return false;
+    return t1->sequence < t2->sequence;
+}
+
 QTimerInfoList::QTimerInfoList()
 {
 #if (_POSIX_MONOTONIC_CLOCK-0 <= 0) && !defined(Q_OS_MAC) && !defined(Q_OS_NACL)
@@ -84,6 +113,33 @@ QTimerInfoList::QTimerInfoList()
 #endif
 
     firstTimerInfo = nullptr;
+
+    std::fill_n(wheel, WheelLevels * WheelSize, nullptr);
+    std::fill_n(occupiedSlots, WheelLevels, 0);
+    wheelTick = timespecToTick(updateCurrentTime());
+    insertSequence = 0;
+}
+
+QTimerInfoList::~QTimerInfoList()
+{
+    clear();
+}
+
+/*
+  delete all timers
+*/
+void QTimerInfoList::clear()
+{
+    for (QTimerInfo *t : qAsConst(timers)) {
+        if (t->activateRef)
+            *(t->activateRef) = nullptr;
+        delete t;
+    }
+    timers.clear();
+    expiredTimers.clear();
+    std::fill_n(wheel, WheelLevels * WheelSize, nullptr);
+    std::fill_n(occupiedSlots, WheelLevels, 0);
+    firstTimerInfo = nullptr;
 }
 
 timespec QTimerInfoList::updateCurrentTime()
@@ -151,10 +207,11 @@ bool QTimerInfoList::timeChanged(timespec *delta)
 void QTimerInfoList::timerRepair(const timespec &diff)
 {
     // repair all timers
-    for (int i = 0; i < size(); ++i) {
-        QTimerInfo *t = at(i);
+    for (QTimerInfo *t : qAsConst(timers)) {
         t->timeout = t->timeout + diff;
+        t->nominalTimeout = t->nominalTimeout + diff;
     }
+    rebuildWheel();
 }
 
 void QTimerInfoList::repairTimersIfNeeded()
@@ -175,17 +232,190 @@ void QTimerInfoList::repairTimersIfNeeded()
 #endif
 
 /*
-  insert timer info into list
+  insert timer info into the wheel, or into the list of expired timers if
+  its millisecond has already come
 */
 void QTimerInfoList::timerInsert(QTimerInfo *ti)
 {
-    int index = size();
+    ti->sequence = ++insertSequence;
+    if (timespecToTick(ti->timeout) > wheelTick) {
+        wheelInsert(ti);
+        return;
+    }
+
+    ti->slot = -1;
+    int index = expiredTimers.size();
     while (index--) {
-        const QTimerInfo * const t = at(index);
+        const QTimerInfo * const t = expiredTimers.at(index);
         if (!(ti->timeout < t->timeout))
             break;
     }
-    insert(index+1, ti);
+    expiredTimers.insert(index+1, ti);
+}
+
+/*
+  insert timer info into the wheel slot for its timeout; it must be later
+  than wheelTick
+*/
+void QTimerInfoList::wheelInsert(QTimerInfo *t)
+{
+    const quint64 tick = quint64(timespecToTick(t->timeout));
+    Q_ASSERT(qint64(tick) > wheelTick);
+
+    // the level is that of the most significant group of bits that differs
+    const uint bit = 63 - qCountLeadingZeroBits(tick ^ quint64(wheelTick));
+    const int level = qMin(int(bit) / WheelBits, int(WheelLevels) - 1);
+    const int index = int(tick >> (level * WheelBits)) & (WheelSize - 1);
+
+    // each slot is a circular list
+    t->slot = level * WheelSize + index;
+    QTimerInfo *&head = wheel[t->slot];
+    if (head) {
+        t->next = head;
+        t->prev = head->prev;
+        head->prev->next = t;
+        head->prev = t;
+    } else {
+        t->next = t->prev = t;
+        head = t;
+        occupiedSlots[level] |= Q_UINT64_C(1) << index;
+    }
+}
+
+/*
+  remove timer info from wherever it is, without deleting it
+*/
+void QTimerInfoList::timerRemove(QTimerInfo *t)
+{
+    if (t->slot < 0) {
+        expiredTimers.removeOne(t);
+        return;
+    }
+
+    QTimerInfo *&head = wheel[t->slot];
+    if (t->next == t) {
+        head = nullptr;
+        occupiedSlots[t->slot / WheelSize] &= ~(Q_UINT64_C(1) << (t->slot % WheelSize));
+    } else {
+        t->prev->next = t->next;
+        t->next->prev = t->prev;
+        if (head == t)
+            head = t->next;
+    }
+}
+
+/*
+  move the wheel forward to tick: the timers in the slots that have been
+  reached either expired or are cascaded down to a finer level
+*/
+void QTimerInfoList::advanceWheel(qint64 tick)
+{
+    if (tick <= wheelTick)
+        return;
+
+    QTimerInfo *reached = nullptr;
+    QTimerInfo **reachedTail = &reached;
+    for (int level = 0; level < WheelLevels; ++level) {
+        const int shift = level * WheelBits;
+        const quint64 current = quint64(wheelTick) >> shift;
+        const quint64 span = (quint64(tick) >> shift) - current;
+        if (span == 0)
+            break;      // nor will anything on the coarser levels
+
+        // the slots following the current one, wrapping around
+        quint64 passed = ~Q_UINT64_C(0);
+        if (span < WheelSize) {
+            const int first = int(current + 1) & (WheelSize - 1);
+            passed = (Q_UINT64_C(1) << span) - 1;
+            passed = (passed << first) | (first ? passed >> (WheelSize - first) : 0);
+        }
+
+        quint64 pending = occupiedSlots[level] & passed;
+        occupiedSlots[level] &= ~pending;
+        while (pending) {
+            const int index = qCountTrailingZeroBits(pending);
+            pending &= pending - 1;
+
+            QTimerInfo *&head = wheel[level * WheelSize + index];
+            QTimerInfo *tail = head->prev;
+            tail->next = nullptr;
+            *reachedTail = head;
+            reachedTail = &tail->next;
+            head = nullptr;
+        }
+    }
+
+    wheelTick = tick;
+
+    bool expired = false;
+    while (reached) {
+        QTimerInfo *t = reached;
+        reached = t->next;
+        if (timespecToTick(t->timeout) > wheelTick) {
+            wheelInsert(t);
+        } else {
+            t->slot = -1;
+            expiredTimers.append(t);
+            expired = true;
+        }
+    }
+    if (expired)
+        std::sort(expiredTimers.begin(), expiredTimers.end(), timerLessThan);
+}
+
+/*
+  find a lower bound for the earliest timeout in the wheel: exact for the
+  finest level, the start of the slot for the others
+*/
+bool QTimerInfoList::nextWheelTimeout(timespec *timeout) const
+{
+    for (int level = 0; level < WheelLevels; ++level) {
+        const quint64 occupied = occupiedSlots[level];
+        if (!occupied)
+            continue;
+
+        const int shift = level * WheelBits;
+        const quint64 current = quint64(wheelTick) >> shift;
+        const int first = int(current + 1) & (WheelSize - 1);
+        const quint64 rotated = (occupied >> first) | (first ? occupied << (WheelSize - first) : 0);
+        const uint distance = qCountTrailingZeroBits(rotated);
+        const qint64 slotStart = qint64((current + 1 + distance) << shift);
+        *timeout = tickToTimespec(slotStart);
+
+        if (level == 0) {
+            // all timers in this slot are in the same millisecond
+            const QTimerInfo *head = wheel[(first + distance) & (WheelSize - 1)];
+            const QTimerInfo *t = head;
+            *timeout = t->timeout;
+            while (timeout->tv_nsec % (1000 * 1000) && (t = t->next) != head) {
+                if (t->timeout < *timeout)
+                    *timeout = t->timeout;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+/*
+  redistribute all timers after their timeouts changed
+*/
+void QTimerInfoList::rebuildWheel()
+{
+    expiredTimers.clear();
+    std::fill_n(wheel, WheelLevels * WheelSize, nullptr);
+    std::fill_n(occupiedSlots, WheelLevels, 0);
+    wheelTick = timespecToTick(currentTime);
+
+    for (QTimerInfo *t : qAsConst(timers)) {
+        if (timespecToTick(t->timeout) > wheelTick) {
+            wheelInsert(t);
+        } else {
+            t->slot = -1;
+            expiredTimers.append(t);
+        }
+    }
+    std::sort(expiredTimers.begin(), expiredTimers.end(), timerLessThan);
 }
 
 inline timespec &operator+=(timespec &t1, int ms)
@@ -347,6 +577,11 @@ static void calculateNextTimeout(QTimerInfo *t, timespec currentTime)
             t->timeout = currentTime;
             t->timeout += t->interval;
         }
+        t->nominalTimeout += t->interval;
+        if (t->nominalTimeout < currentTime) {
+            t->nominalTimeout = currentTime;
+            t->nominalTimeout += t->interval;
+        }
 #ifdef QTIMERINFO_DEBUG
         t->expected += t->interval;
         if (t->expected < currentTime) {
@@ -363,6 +598,9 @@ static void calculateNextTimeout(QTimerInfo *t, timespec currentTime)
         t->timeout.tv_sec += t->interval;
         if (t->timeout.tv_sec <= currentTime.tv_sec)
             t->timeout.tv_sec = currentTime.tv_sec + t->interval;
+        t->nominalTimeout.tv_sec += t->interval;
+        if (t->nominalTimeout < currentTime)
+            t->nominalTimeout.tv_sec = currentTime.tv_sec + t->interval;
 #ifdef QTIMERINFO_DEBUG
         t->expected.tv_sec += t->interval;
         if (t->expected.tv_sec <= currentTime.tv_sec)
@@ -387,22 +625,26 @@ bool QTimerInfoList::timerWait(timespec &tm)
 {
     timespec currentTime = updateCurrentTime();
     repairTimersIfNeeded();
+    advanceWheel(timespecToTick(currentTime));
 
     // Find first waiting timer not already active
+    timespec timeout;
     QTimerInfo *t = nullptr;
-    for (QTimerInfoList::const_iterator it = constBegin(); it != constEnd(); ++it) {
-        if (!(*it)->activateRef) {
-            t = *it;
+    for (QTimerInfo *expired : qAsConst(expiredTimers)) {
+        if (!expired->activateRef) {
+            t = expired;
             break;
         }
     }
 
-    if (!t)
-      return false;
+    if (t)
+        timeout = t->timeout;
+    else if (!nextWheelTimeout(&timeout))
+        return false;
 
-    if (currentTime < t->timeout) {
+    if (currentTime < timeout) {
         // time to wait
-        tm = roundToMillisecond(t->timeout - currentTime);
+        tm = roundToMillisecond(timeout - currentTime);
     } else {
         // no time to wait
         tm.tv_sec  = 0;
@@ -423,16 +665,13 @@ int QTimerInfoList::timerRemainingTime(int timerId)
     repairTimersIfNeeded();
     timespec tm = {0, 0};
 
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
-        if (t->id == timerId) {
-            if (currentTime < t->timeout) {
-                // time to wait
-                tm = roundToMillisecond(t->timeout - currentTime);
-                return tm.tv_sec*1000 + tm.tv_nsec/1000/1000;
-            } else {
-                return 0;
-            }
+    if (const QTimerInfo *t = timers.value(timerId)) {
+        if (currentTime < t->timeout) {
+            // time to wait
+            tm = roundToMillisecond(t->timeout - currentTime);
+            return tm.tv_sec*1000 + tm.tv_nsec/1000/1000;
+        } else {
+            return 0;
         }
     }
 
@@ -453,6 +692,7 @@ void QTimerInfoList::registerTimer(int timerId, int interval, Qt::TimerType time
     t->activateRef = nullptr;
 
     timespec expected = updateCurrentTime() + interval;
+    t->nominalTimeout = expected;
 
     switch (timerType) {
     case Qt::PreciseTimer:
@@ -493,6 +733,7 @@ void QTimerInfoList::registerTimer(int timerId, int interval, Qt::TimerType time
             ++t->timeout.tv_sec;
     }
 
+    timers.insert(timerId, t);
     timerInsert(t);
 
 #ifdef QTIMERINFO_DEBUG
@@ -508,39 +749,38 @@ void QTimerInfoList::registerTimer(int timerId, int interval, Qt::TimerType time
 bool QTimerInfoList::unregisterTimer(int timerId)
 {
     // set timer inactive
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
-        if (t->id == timerId) {
-            // found it
-            removeAt(i);
-            if (t == firstTimerInfo)
-                firstTimerInfo = nullptr;
-            if (t->activateRef)
-                *(t->activateRef) = nullptr;
-            delete t;
-            return true;
-        }
+    QTimerInfo *t = timers.take(timerId);
+    if (!t) {
+        // id not found
+        return false;
     }
-    // id not found
-    return false;
+
+    timerRemove(t);
+    if (t == firstTimerInfo)
+        firstTimerInfo = nullptr;
+    if (t->activateRef)
+        *(t->activateRef) = nullptr;
+    delete t;
+    return true;
 }
 
 bool QTimerInfoList::unregisterTimers(QObject *object)
 {
     if (isEmpty())
         return false;
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
+    for (auto it = timers.begin(); it != timers.end(); ) {
+        QTimerInfo *t = it.value();
         if (t->obj == object) {
             // object found
-            removeAt(i);
+            it = timers.erase(it);
+            timerRemove(t);
             if (t == firstTimerInfo)
                 firstTimerInfo = nullptr;
             if (t->activateRef)
                 *(t->activateRef) = nullptr;
             delete t;
-            // move back one so that we don't skip the new current item
-            --i;
+        } else {
+            ++it;
         }
     }
     return true;
@@ -549,8 +789,7 @@ bool QTimerInfoList::unregisterTimers(QObject *object)
 QList<QAbstractEventDispatcher::TimerInfo> QTimerInfoList::registeredTimers(QObject *object) const
 {
     QList<QAbstractEventDispatcher::TimerInfo> list;
-    for (int i = 0; i < count(); ++i) {
-        const QTimerInfo * const t = at(i);
+    for (const QTimerInfo *t : timers) {
         if (t->obj == object) {
             list << QAbstractEventDispatcher::TimerInfo(t->id,
                                                         (t->timerType == Qt::VeryCoarseTimer
@@ -576,21 +815,21 @@ int QTimerInfoList::activateTimers()
     timespec currentTime = updateCurrentTime();
     // qDebug() << "Thread" << QThread::currentThreadId() << "woken up at" << currentTime;
     repairTimersIfNeeded();
-
+    advanceWheel(timespecToTick(currentTime));
 
     // Find out how many timer have expired
-    for (QTimerInfoList::const_iterator it = constBegin(); it != constEnd(); ++it) {
-        if (currentTime < (*it)->timeout)
+    for (const QTimerInfo *t : qAsConst(expiredTimers)) {
+        if (currentTime < t->timeout)
             break;
         maxCount++;
     }
 
     //fire the timers.
     while (maxCount--) {
-        if (isEmpty())
+        if (expiredTimers.isEmpty())
             break;
 
-        QTimerInfo *currentTimerInfo = constFirst();
+        QTimerInfo *currentTimerInfo = expiredTimers.constFirst();
         if (currentTime < currentTimerInfo->timeout)
             break; // no timer has expired
 
@@ -605,7 +844,16 @@ int QTimerInfoList::activateTimers()
         }
 
         // remove from list
-        removeFirst();
+        expiredTimers.removeFirst();
+
+        TimerStatistics &stat = stats[currentTimerInfo->timerType];
+        const qint64 slack = timespecToNSecs(currentTimerInfo->timeout - currentTimerInfo->nominalTimeout);
+        const qint64 latency = timespecToNSecs(currentTime - currentTimerInfo->timeout);
+        ++stat.activations;
+        stat.totalSlack += slack;
+        stat.maxSlack = qMax(stat.maxSlack, qAbs(slack));
+        stat.totalLatency += latency;
+        stat.maxLatency = qMax(stat.maxLatency, latency);
 
 #ifdef QTIMERINFO_DEBUG
         float diff;
@@ -652,4 +900,18 @@ int QTimerInfoList::activateTimers()
     return n_act;
 }
 
+/*
+  Returns how far timers of type timerType were moved from their nominal
+  timeout to coalesce wakeups, and how late they were activated.
+*/
+QTimerInfoList::TimerStatistics QTimerInfoList::statistics(Qt::TimerType timerType) const
+{
+    return stats[timerType];
+}
+
+void QTimerInfoList::resetStatistics()
+{
+    std::fill_n(stats, 3, TimerStatistics());
+}
+
 QT_END_NAMESPACE
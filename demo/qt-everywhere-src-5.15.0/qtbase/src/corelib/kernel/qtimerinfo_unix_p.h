@@ -56,6 +56,8 @@
 // #define QTIMERINFO_DEBUG
 
 #include "qabstracteventdispatcher.h"
+#include "qhash.h"
+#include "qlist.h"
 
 #include <sys/time.h> // struct timeval
 
@@ -70,6 +72,12 @@ struct QTimerInfo {
     QObject *obj;     // - object to receive event
     QTimerInfo **activateRef; // - ref from activateTimers
 
+    timespec nominalTimeout; // - when it would fire if it weren't coalesced
+    quint64 sequence; // - orders timers with the same timeout
+    QTimerInfo *next; // - neighbours in the wheel slot
+    QTimerInfo *prev;
+    int slot;         // - wheel slot, or -1 if in the expired list
+
 #ifdef QTIMERINFO_DEBUG
     timeval expected; // when timer is expected to fire
     float cumulativeError;
@@ -77,7 +85,7 @@ struct QTimerInfo {
 #endif
 };
 
-class Q_CORE_EXPORT QTimerInfoList : public QList<QTimerInfo*>
+class Q_CORE_EXPORT QTimerInfoList
 {
 #if ((_POSIX_MONOTONIC_CLOCK-0 <= 0) && !defined(Q_OS_MAC)) || defined(QT_BOOTSTRAPPED)
     timespec previousTime;
@@ -93,7 +101,17 @@ class Q_CORE_EXPORT QTimerInfoList : public QList<QTimerInfo*>
     QTimerInfo *firstTimerInfo;
 
 public:
+    struct TimerStatistics
+    {
+        quint64 activations = 0;
+        qint64 totalSlack = 0;      // ns the timeouts were moved to coalesce wakeups
+        qint64 maxSlack = 0;
+        qint64 totalLatency = 0;    // ns between the timeouts and the activations
+        qint64 maxLatency = 0;
+    };
+
     QTimerInfoList();
+    ~QTimerInfoList();
 
     timespec currentTime;
     timespec updateCurrentTime();
@@ -112,6 +130,37 @@ public:
     QList<QAbstractEventDispatcher::TimerInfo> registeredTimers(QObject *object) const;
 
     int activateTimers();
+
+    bool isEmpty() const { return timers.isEmpty(); }
+    int size() const { return timers.size(); }
+    void clear();
+
+    TimerStatistics statistics(Qt::TimerType timerType) const;
+    void resetStatistics();
+
+private:
+    Q_DISABLE_COPY(QTimerInfoList)
+
+    // A hierarchical timer wheel: level n has WheelSize slots that are
+    // WheelSize^n ms wide, and holds the timers whose timeout first differs
+    // from wheelTick in the n-th group of WheelBits bits. Timers whose
+    // millisecond has come are kept in expiredTimers, sorted, where their
+    // exact timeout is checked.
+    enum { WheelBits = 6, WheelSize = 1 << WheelBits, WheelLevels = 6 };
+
+    void wheelInsert(QTimerInfo *t);
+    void timerRemove(QTimerInfo *t);
+    void advanceWheel(qint64 tick);
+    bool nextWheelTimeout(timespec *timeout) const;
+    void rebuildWheel();
+
+    QTimerInfo *wheel[WheelLevels * WheelSize];
+    quint64 occupiedSlots[WheelLevels];
+    qint64 wheelTick;
+    quint64 insertSequence;
+    QList<QTimerInfo *> expiredTimers;
+    QHash<int, QTimerInfo *> timers;
+    TimerStatistics stats[3];
 };
 
 QT_END_NAMESPACE
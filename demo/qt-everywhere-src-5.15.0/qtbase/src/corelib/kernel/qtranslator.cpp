@@ -894,14 +894,13 @@ bool QTranslatorPrivate::do_load(const uchar *data, qsizetype len, const QString
     return ok;
 }
 
-static QString getMessage(const uchar *m, const uchar *end, const char *context,
-                          const char *sourceText, const char *comment, uint numerus)
+static QString getMessage(const uchar *m, const uchar *end,
+                          const char *context, uint contextLen,
+                          const char *sourceText, uint sourceTextLen,
+                          const char *comment, uint commentLen, uint numerus)
 {
     const uchar *tn = nullptr;
     uint tn_length = 0;
-    const uint sourceTextLen = uint(strlen(sourceText));
-    const uint contextLen = uint(strlen(context));
-    const uint commentLen = uint(strlen(comment));
 
     for (;;) {
         uchar tag = 0;
@@ -973,10 +972,16 @@ QString QTranslatorPrivate::do_translate(const char *context, const char *source
 
     uint numerus = 0;
     size_t numItems = 0;
+    uint contextLen = 0;
+    uint sourceTextLen = 0;
+    uint commentLen = 0;
+    uint sourceTextHash = 0;
 
     if (!offsetLength)
         goto searchDependencies;
 
+    contextLen = uint(strlen(context));
+
     /*
         Check if the context belongs to this QTranslator. If many
         translators are installed, this step is necessary.
@@ -991,7 +996,6 @@ QString QTranslatorPrivate::do_translate(const char *context, const char *source
             return QString();
         c = contextArray + (2 + (hTableSize << 1) + (off << 1));
 
-        const uint contextLen = uint(strlen(context));
         for (;;) {
             quint8 len = read8(c++);
             if (len == 0)
@@ -1009,9 +1013,14 @@ QString QTranslatorPrivate::do_translate(const char *context, const char *source
     if (n >= 0)
         numerus = numerusHelper(n, numerusRulesArray, numerusRulesLength);
 
+    // The lengths and the hash of the source text are the same for both
+    // passes of the loop below and for every candidate message
+    sourceTextLen = uint(strlen(sourceText));
+    commentLen = uint(strlen(comment));
+    elfHash_continue(sourceText, sourceTextHash);
+
     for (;;) {
-        quint32 h = 0;
-        elfHash_continue(sourceText, h);
+        quint32 h = sourceTextHash;
         elfHash_continue(comment, h);
         elfHash_finish(h);
 
@@ -1042,8 +1051,9 @@ QString QTranslatorPrivate::do_translate(const char *context, const char *source
                     break;
                 quint32 ro = read32(start);
                 start += 4;
-                QString tn = getMessage(messageArray + ro, messageArray + messageLength, context,
-                                        sourceText, comment, numerus);
+                QString tn = getMessage(messageArray + ro, messageArray + messageLength,
+                                        context, contextLen, sourceText, sourceTextLen,
+                                        comment, commentLen, numerus);
                 if (!tn.isNull())
                     return tn;
             }
@@ -1051,6 +1061,7 @@ QString QTranslatorPrivate::do_translate(const char *context, const char *source
         if (!comment[0])
             break;
         comment = "";
+        commentLen = 0;
     }
 
 searchDependencies:
@@ -61,6 +61,12 @@
 #include <qendian.h>
 #include <qjsondocument.h>
 #include <qjsonvalue.h>
+#include <qdatastream.h>
+#include <qdatetime.h>
+#include <qhash.h>
+#if QT_CONFIG(temporaryfile)
+#include <qsavefile.h>
+#endif
 #include "qelfparser_p.h"
 #include "qmachparser_p.h"
 
@@ -224,6 +230,129 @@ static qsizetype qt_find_pattern(const char *s, qsizetype s_len,
     return -1;
 }
 
+namespace {
+/*
+    Opt-in cache of plugin meta data, stored in the file named by the
+    QT_PLUGIN_METADATA_CACHE environment variable. An entry is reused as long
+    as the plugin's size and modification time are unchanged, which saves
+    opening, mapping and parsing every plugin on startup.
+*/
+class QLibraryMetaDataCache
+{
+public:
+    QLibraryMetaDataCache()
+        : cacheFileName(qEnvironmentVariable("QT_PLUGIN_METADATA_CACHE")), dirty(false)
+    {
+        if (!cacheFileName.isEmpty())
+            load();
+    }
+
+    ~QLibraryMetaDataCache()
+    {
+        if (dirty)
+            save();
+    }
+
+    bool isEnabled() const { return !cacheFileName.isEmpty(); }
+
+    bool lookup(const QString &library, QJsonObject *metaData)
+    {
+        const QFileInfo info(library);
+        QMutexLocker locker(&mutex);
+        const auto it = entries.constFind(library);
+        if (it == entries.constEnd() || it->size != info.size()
+                || it->lastModified != lastModified(info)) {
+            return false;
+        }
+        *metaData = it->metaData;
+        return true;
+    }
+
+    void insert(const QString &library, const QJsonObject &metaData)
+    {
+        const QFileInfo info(library);
+        Entry entry = { info.size(), lastModified(info), metaData };
+        QMutexLocker locker(&mutex);
+        entries.insert(library, entry);
+        dirty = true;
+    }
+
+private:
+    struct Entry {
+        qint64 size;
+        qint64 lastModified;
+        QJsonObject metaData;
+    };
+
+    enum {
+        Magic = 0x51504d43, // "QPMC"
+        FormatVersion = 1
+    };
+
+    static qint64 lastModified(const QFileInfo &info)
+    {
+        return info.lastModified().toMSecsSinceEpoch();
+    }
+
+    void load()
+    {
+        QFile file(cacheFileName);
+        if (!file.open(QIODevice::ReadOnly))
+            return;
+
+        QDataStream in(&file);
+        in.setVersion(QDataStream::Qt_5_12);
+        quint32 magic, formatVersion, qtVersion, count;
+        in >> magic >> formatVersion >> qtVersion >> count;
+        if (in.status() != QDataStream::Ok || magic != Magic
+                || formatVersion != FormatVersion || qtVersion != QT_VERSION) {
+            return;
+        }
+
+        for (quint32 i = 0; i < count; ++i) {
+            QString library;
+            Entry entry;
+            in >> library >> entry.size >> entry.lastModified >> entry.metaData;
+            if (in.status() != QDataStream::Ok) {
+                // truncated or corrupt, start over
+                entries.clear();
+                return;
+            }
+            entries.insert(library, entry);
+        }
+    }
+
+    void save()
+    {
+#if QT_CONFIG(temporaryfile)
+        QSaveFile file(cacheFileName);
+#else
+        QFile file(cacheFileName);
+#endif
+        if (!file.open(QIODevice::WriteOnly))
+            return;
+
+        QDataStream out(&file);
+        out.setVersion(QDataStream::Qt_5_12);
+        out << quint32(Magic) << quint32(FormatVersion) << quint32(QT_VERSION)
+            << quint32(entries.size());
+        for (auto it = entries.cbegin(), end = entries.cend(); it != end; ++it)
+            out << it.key() << it->size << it->lastModified << it->metaData;
+#if QT_CONFIG(temporaryfile)
+        if (out.status() == QDataStream::Ok)
+            file.commit();
+#endif
+    }
+
+    const QString cacheFileName;
+    QMutex mutex;
+    QHash<QString, Entry> entries;
+    bool dirty;
+};
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(QLibraryMetaDataCache, libraryMetaDataCache)
+
 /*
   This opens the specified library, mmaps it into memory, and searches
   for the QT_PLUGIN_VERIFICATION_DATA.  The advantage of this approach is that
@@ -236,6 +365,15 @@ static qsizetype qt_find_pattern(const char *s, qsizetype s_len,
 */
 static bool findPatternUnloaded(const QString &library, QLibraryPrivate *lib)
 {
+    QLibraryMetaDataCache *cache = libraryMetaDataCache();
+    if (cache && !cache->isEnabled())
+        cache = nullptr;
+    if (cache && lib && cache->lookup(library, &lib->metaData)) {
+        if (qt_debug_component())
+            qWarning("Using cached metadata for lib %ls", qUtf16Printable(library));
+        return true;
+    }
+
     QFile file(library);
     if (!file.open(QIODevice::ReadOnly)) {
         if (lib)
@@ -327,6 +465,8 @@ static bool findPatternUnloaded(const QString &library, QLibraryPrivate *lib)
                 qWarning("Found metadata in lib %s, metadata=\n%s\n",
                          library.toLocal8Bit().constData(), doc.toJson().constData());
             ret = !doc.isNull();
+            if (cache)
+                cache->insert(library, lib->metaData);
         }
     }
 
@@ -43,6 +43,7 @@
 #include <QtCore/qscopedpointer.h>
 #include <QtCore/qiodevice.h>
 #include <QtCore/qpair.h>
+#include <QtCore/qendian.h>
 
 #ifdef Status
 #error qdatastream.h must be included before any header file that defines Status
@@ -359,6 +360,121 @@ QDataStream &writeAssociativeContainer(QDataStream &s, const Container &c)
     return s;
 }
 
+// Element types whose operator<< writes exactly their in-memory bytes
+// (in the stream's byte order), so that arrays of them can be transferred
+// in bulk. float and double only qualify for the matching precision.
+template <typename T> struct IsRawStreamable : std::false_type {};
+template <> struct IsRawStreamable<qint8> : std::true_type {};
+template <> struct IsRawStreamable<quint8> : std::true_type {};
+template <> struct IsRawStreamable<qint16> : std::true_type {};
+template <> struct IsRawStreamable<quint16> : std::true_type {};
+template <> struct IsRawStreamable<qint32> : std::true_type {};
+template <> struct IsRawStreamable<quint32> : std::true_type {};
+template <> struct IsRawStreamable<qint64> : std::true_type {};
+template <> struct IsRawStreamable<quint64> : std::true_type {};
+template <> struct IsRawStreamable<float> : std::true_type {};
+template <> struct IsRawStreamable<double> : std::true_type {};
+
+template <typename T>
+inline bool canStreamRaw(const QDataStream &) { return true; }
+template <>
+inline bool canStreamRaw<float>(const QDataStream &s)
+{
+    return s.version() < QDataStream::Qt_4_6
+            || s.floatingPointPrecision() == QDataStream::SinglePrecision;
+}
+template <>
+inline bool canStreamRaw<double>(const QDataStream &s)
+{
+    return s.version() < QDataStream::Qt_4_6
+            || s.floatingPointPrecision() == QDataStream::DoublePrecision;
+}
+
+template <typename T>
+QDataStream &readVector(QDataStream &s, QVector<T> &v, std::false_type)
+{
+    return readArrayBasedContainer(s, v);
+}
+
+template <typename T>
+QDataStream &readVector(QDataStream &s, QVector<T> &v, std::true_type)
+{
+    if (!canStreamRaw<T>(s))
+        return readArrayBasedContainer(s, v);
+
+    StreamStateSaver stateSaver(&s);
+
+    v.clear();
+    quint32 n;
+    s >> n;
+    if (s.status() != QDataStream::Ok)
+        return s;
+    if (n > quint32(std::numeric_limits<int>::max() / int(sizeof(T)))) {
+        s.setStatus(QDataStream::ReadCorruptData);
+        return s;
+    }
+
+    // grow the vector as data actually arrives instead of trusting the count
+    const int chunkSize = (1 << 20) / int(sizeof(T));
+    const bool swap = s.byteOrder() != QDataStream::ByteOrder(QSysInfo::ByteOrder);
+    int size = 0;
+    while (size < int(n)) {
+        const int count = qMin(int(n) - size, chunkSize);
+        v.resize(size + count);
+        T *chunk = v.data() + size;
+        const int bytes = count * int(sizeof(T));
+        if (s.readRawData(reinterpret_cast<char *>(chunk), bytes) != bytes) {
+            if (s.status() == QDataStream::Ok)
+                s.setStatus(QDataStream::ReadPastEnd);
+            v.clear();
+            return s;
+        }
+        if (swap)
+            qbswap<sizeof(T)>(chunk, count, chunk);
+        size += count;
+    }
+
+    return s;
+}
+
+template <typename T>
+QDataStream &writeVector(QDataStream &s, const QVector<T> &v, std::false_type)
+{
+    return writeSequentialContainer(s, v);
+}
+
+template <typename T>
+QDataStream &writeVector(QDataStream &s, const QVector<T> &v, std::true_type)
+{
+    if (!canStreamRaw<T>(s))
+        return writeSequentialContainer(s, v);
+
+    s << quint32(v.size());
+
+    const T *data = v.constData();
+    const int size = v.size();
+    if (s.byteOrder() == QDataStream::ByteOrder(QSysInfo::ByteOrder)) {
+        const int chunkSize = (1 << 30) / int(sizeof(T));
+        for (int i = 0; i < size; i += chunkSize) {
+            const int bytes = qMin(size - i, chunkSize) * int(sizeof(T));
+            if (s.writeRawData(reinterpret_cast<const char *>(data + i), bytes) != bytes)
+                break;
+        }
+    } else {
+        T buffer[4096 / sizeof(T)];
+        const int chunkSize = int(sizeof(buffer) / sizeof(T));
+        for (int i = 0; i < size; i += chunkSize) {
+            const int count = qMin(size - i, chunkSize);
+            qbswap<sizeof(T)>(data + i, count, buffer);
+            const int bytes = count * int(sizeof(T));
+            if (s.writeRawData(reinterpret_cast<const char *>(buffer), bytes) != bytes)
+                break;
+        }
+    }
+
+    return s;
+}
+
 } // QtPrivate namespace
 
 /*****************************************************************************
@@ -434,13 +550,13 @@ inline QDataStream &operator<<(QDataStream &s, const QList<T> &l)
 template<typename T>
 inline QDataStream &operator>>(QDataStream &s, QVector<T> &v)
 {
-    return QtPrivate::readArrayBasedContainer(s, v);
+    return QtPrivate::readVector(s, v, QtPrivate::IsRawStreamable<T>());
 }
 
 template<typename T>
 inline QDataStream &operator<<(QDataStream &s, const QVector<T> &v)
 {
-    return QtPrivate::writeSequentialContainer(s, v);
+    return QtPrivate::writeVector(s, v, QtPrivate::IsRawStreamable<T>());
 }
 
 template <typename T>
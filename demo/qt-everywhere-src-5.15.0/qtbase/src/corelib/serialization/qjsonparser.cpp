@@ -797,7 +797,7 @@ static inline bool addHexDigit(char digit, uint *result)
     return true;
 }
 
-static inline bool scanEscapeSequence(const char *&json, const char *end, uint *ch)
+bool QJsonPrivate::scanEscapeSequence(const char *&json, const char *end, uint *ch)
 {
     ++json;
     if (json >= end)
@@ -842,7 +842,7 @@ static inline bool scanEscapeSequence(const char *&json, const char *end, uint *
     return true;
 }
 
-static inline bool scanUtf8Char(const char *&json, const char *end, uint *result)
+bool QJsonPrivate::scanUtf8Char(const char *&json, const char *end, uint *result)
 {
     const auto *usrc = reinterpret_cast<const uchar *>(json);
     const auto *uend = reinterpret_cast<const uchar *>(end);
@@ -940,4 +940,407 @@ bool Parser::parseString()
     return true;
 }
 
+TapeParser::TapeParser(const char *json, qint64 length)
+    : head(json), json(json), end(json + length)
+    , nestingLevel(0)
+    , lastError(QJsonParseError::NoError)
+    , tape(nullptr)
+{
+}
+
+void TapeParser::eatBOM()
+{
+    // eat UTF-8 byte order mark
+    uchar utf8bom[3] = { 0xef, 0xbb, 0xbf };
+    if (end - json > 3 &&
+        (uchar)json[0] == utf8bom[0] &&
+        (uchar)json[1] == utf8bom[1] &&
+        (uchar)json[2] == utf8bom[2])
+        json += 3;
+}
+
+bool TapeParser::eatSpace()
+{
+    while (json < end) {
+        if (*json > Space)
+            break;
+        if (*json != Space &&
+            *json != Tab &&
+            *json != LineFeed &&
+            *json != Return)
+            break;
+        ++json;
+    }
+    return (json < end);
+}
+
+char TapeParser::nextToken()
+{
+    if (!eatSpace())
+        return 0;
+    char token = *json++;
+    switch (token) {
+    case BeginArray:
+    case BeginObject:
+    case NameSeparator:
+    case ValueSeparator:
+    case EndArray:
+    case EndObject:
+    case Quote:
+        break;
+    default:
+        token = 0;
+        break;
+    }
+    return token;
+}
+
+int TapeParser::append(TapeEntry::Type type, qint64 offset, qint64 size, quint8 flags)
+{
+    const int index = tape->size();
+    TapeEntry entry;
+    entry.offset = offset;
+    entry.size = size;
+    entry.next = index + 1;
+    entry.type = type;
+    entry.flags = flags;
+    tape->append(entry);
+    return index;
+}
+
+void TapeParser::finishContainer(int index)
+{
+    TapeEntry &entry = (*tape)[index];
+    entry.next = tape->size();
+    entry.size = (json - head) - entry.offset;
+}
+
+/*
+    JSON-text = object / array
+*/
+bool TapeParser::parse(QVector<TapeEntry> *t, QJsonParseError *error)
+{
+    tape = t;
+    tape->clear();
+
+    eatBOM();
+    char token = nextToken();
+
+    bool ok = false;
+    if (token == BeginArray)
+        ok = parseArray();
+    else if (token == BeginObject)
+        ok = parseObject();
+    else
+        lastError = QJsonParseError::IllegalValue;
+
+    if (ok) {
+        eatSpace();
+        if (json < end) {
+            lastError = QJsonParseError::GarbageAtEnd;
+            ok = false;
+        }
+    }
+
+    if (ok) {
+        tape->squeeze();
+    } else {
+        tape->clear();
+    }
+
+    if (error) {
+        error->offset = ok ? 0 : int(json - head);
+        error->error = ok ? QJsonParseError::NoError : lastError;
+    }
+    return ok;
+}
+
+/*
+    object = begin-object [ member *( value-separator member ) ]
+    end-object
+*/
+bool TapeParser::parseObject()
+{
+    if (++nestingLevel > nestingLimit) {
+        lastError = QJsonParseError::DeepNesting;
+        return false;
+    }
+
+    const int index = append(TapeEntry::Object, json - head - 1, 0);
+
+    char token = nextToken();
+    while (token == Quote) {
+        if (!parseMember())
+            return false;
+        token = nextToken();
+        if (token != ValueSeparator)
+            break;
+        token = nextToken();
+        if (token == EndObject) {
+            lastError = QJsonParseError::MissingObject;
+            return false;
+        }
+    }
+
+    if (token != EndObject) {
+        lastError = QJsonParseError::UnterminatedObject;
+        return false;
+    }
+
+    --nestingLevel;
+    finishContainer(index);
+    return true;
+}
+
+/*
+    member = string name-separator value
+*/
+bool TapeParser::parseMember()
+{
+    if (!parseString())
+        return false;
+    char token = nextToken();
+    if (token != NameSeparator) {
+        lastError = QJsonParseError::MissingNameSeparator;
+        return false;
+    }
+    if (!eatSpace()) {
+        lastError = QJsonParseError::UnterminatedObject;
+        return false;
+    }
+    return parseValue();
+}
+
+/*
+    array = begin-array [ value *( value-separator value ) ] end-array
+*/
+bool TapeParser::parseArray()
+{
+    if (++nestingLevel > nestingLimit) {
+        lastError = QJsonParseError::DeepNesting;
+        return false;
+    }
+
+    const int index = append(TapeEntry::Array, json - head - 1, 0);
+
+    if (!eatSpace()) {
+        lastError = QJsonParseError::UnterminatedArray;
+        return false;
+    }
+    if (*json == EndArray) {
+        nextToken();
+    } else {
+        while (1) {
+            if (!eatSpace()) {
+                lastError = QJsonParseError::UnterminatedArray;
+                return false;
+            }
+            if (!parseValue())
+                return false;
+            char token = nextToken();
+            if (token == EndArray)
+                break;
+            else if (token != ValueSeparator) {
+                if (!eatSpace())
+                    lastError = QJsonParseError::UnterminatedArray;
+                else
+                    lastError = QJsonParseError::MissingValueSeparator;
+                return false;
+            }
+        }
+    }
+
+    --nestingLevel;
+    finishContainer(index);
+    return true;
+}
+
+/*
+value = false / null / true / object / array / number / string
+
+*/
+bool TapeParser::parseValue()
+{
+    switch (*json++) {
+    case 'n':
+        return parseLiteral("null", 4, TapeEntry::Null);
+    case 't':
+        return parseLiteral("true", 4, TapeEntry::True);
+    case 'f':
+        return parseLiteral("false", 5, TapeEntry::False);
+    case Quote:
+        return parseString();
+    case BeginArray:
+        return parseArray();
+    case BeginObject:
+        return parseObject();
+    case ValueSeparator:
+        // Essentially missing value, but after a colon, not after a comma
+        // like the other MissingObject errors.
+        lastError = QJsonParseError::IllegalValue;
+        return false;
+    case EndObject:
+    case EndArray:
+        lastError = QJsonParseError::MissingObject;
+        return false;
+    default:
+        --json;
+        return parseNumber();
+    }
+}
+
+// json points just past the first character of the literal
+bool TapeParser::parseLiteral(const char *literal, int length, TapeEntry::Type type)
+{
+    if (end - json < length) {
+        lastError = QJsonParseError::IllegalValue;
+        return false;
+    }
+    for (int i = 1; i < length; ++i) {
+        if (*json++ != literal[i]) {
+            lastError = QJsonParseError::IllegalValue;
+            return false;
+        }
+    }
+    append(type, json - head - length, length);
+    return true;
+}
+
+/*
+    See Parser::parseNumber() for the grammar. The number is not converted
+    here; instead of relying on QByteArray::toDouble() to reject malformed
+    numbers, the digit sequences required by the grammar are checked.
+*/
+bool TapeParser::parseNumber()
+{
+    const char *start = json;
+    quint8 flags = TapeEntry::NumberIsInteger;
+
+    // minus
+    if (json < end && *json == '-')
+        ++json;
+
+    // int = zero / ( digit1-9 *DIGIT )
+    const char *digits = json;
+    if (json < end && *json == '0') {
+        ++json;
+    } else {
+        while (json < end && *json >= '0' && *json <= '9')
+            ++json;
+    }
+    bool valid = json != digits;
+
+    // frac = decimal-point 1*DIGIT
+    if (json < end && *json == '.') {
+        flags = 0;
+        digits = ++json;
+        while (json < end && *json >= '0' && *json <= '9')
+            ++json;
+        valid = valid && json != digits;
+    }
+
+    // exp = e [ minus / plus ] 1*DIGIT
+    if (json < end && (*json == 'e' || *json == 'E')) {
+        flags = 0;
+        ++json;
+        if (json < end && (*json == '-' || *json == '+'))
+            ++json;
+        digits = json;
+        while (json < end && *json >= '0' && *json <= '9')
+            ++json;
+        valid = valid && json != digits;
+    }
+
+    if (json >= end) {
+        lastError = QJsonParseError::TerminationByNumber;
+        return false;
+    }
+
+    if (!valid) {
+        lastError = QJsonParseError::IllegalNumber;
+        return false;
+    }
+
+    append(TapeEntry::Number, start - head, json - start, flags);
+    return true;
+}
+
+// json points just past the opening quotation mark
+bool TapeParser::parseString()
+{
+    const char *start = json - 1;
+    quint8 flags = 0;
+
+    while (json < end) {
+        if (*json == '"')
+            break;
+        uint ch = 0;
+        if (*json == '\\') {
+            flags |= TapeEntry::StringHasEscapes;
+            if (!scanEscapeSequence(json, end, &ch)) {
+                lastError = QJsonParseError::IllegalEscapeSequence;
+                return false;
+            }
+        } else if (uchar(*json) < 0x80) {
+            ++json;
+        } else if (!scanUtf8Char(json, end, &ch)) {
+            lastError = QJsonParseError::IllegalUTF8String;
+            return false;
+        }
+    }
+    ++json;
+
+    if (json >= end) {
+        lastError = QJsonParseError::UnterminatedString;
+        return false;
+    }
+
+    append(TapeEntry::String, start - head, json - start, flags);
+    return true;
+}
+
+/*
+    Converts a number token the same way Parser::parseNumber() does.
+*/
+QJsonValue QJsonPrivate::numberValue(const char *json, int length, bool isInteger)
+{
+    const QByteArray number = QByteArray::fromRawData(json, length);
+    if (isInteger) {
+        bool ok;
+        qlonglong n = number.toLongLong(&ok);
+        if (ok)
+            return QJsonValue(qint64(n));
+    }
+
+    const double d = number.toDouble();
+    qint64 n;
+    if (convertDoubleTo(d, &n))
+        return QJsonValue(n);
+    return QJsonValue(d);
+}
+
+/*
+    Decodes the contents of a string token that TapeParser has already
+    validated, without the surrounding quotation marks.
+*/
+QString TapeParser::decodeString(const char *json, const char *end)
+{
+    QString result;
+    result.reserve(int(end - json));
+    while (json < end) {
+        uint ch = 0;
+        if (*json == '\\')
+            scanEscapeSequence(json, end, &ch);
+        else
+            scanUtf8Char(json, end, &ch);
+        if (QChar::requiresSurrogates(ch)) {
+            result.append(QChar::highSurrogate(ch));
+            result.append(QChar::lowSurrogate(ch));
+        } else {
+            result.append(QChar(ushort(ch)));
+        }
+    }
+    return result;
+}
+
 QT_END_NAMESPACE
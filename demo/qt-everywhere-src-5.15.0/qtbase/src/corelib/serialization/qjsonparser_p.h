@@ -54,6 +54,7 @@
 #include <QtCore/private/qglobal_p.h>
 #include <QtCore/private/qcborvalue_p.h>
 #include <QtCore/qjsondocument.h>
+#include <QtCore/qvector.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -86,8 +87,71 @@ private:
     QExplicitlySharedDataPointer<QCborContainerPrivate> container;
 };
 
+bool scanEscapeSequence(const char *&json, const char *end, uint *ch);
+bool scanUtf8Char(const char *&json, const char *end, uint *result);
+QJsonValue numberValue(const char *json, int length, bool isInteger);
+
+struct TapeEntry
+{
+    enum Type : quint8 {
+        Null,
+        False,
+        True,
+        Number,
+        String,
+        Array,
+        Object
+    };
+    enum Flag : quint8 {
+        NumberIsInteger = 0x1,
+        StringHasEscapes = 0x2
+    };
+
+    qint64 offset;      // first byte of the token in the document
+    qint64 size;        // token length, including quotes and brackets
+    int next;           // tape index just past this value and its children
+    Type type;
+    quint8 flags;
+};
+
+// Validates a document like Parser, but only records where each value
+// starts and ends instead of building the QCborValue tree.
+class TapeParser
+{
+public:
+    TapeParser(const char *json, qint64 length);
+
+    bool parse(QVector<TapeEntry> *tape, QJsonParseError *error);
+
+    static QString decodeString(const char *json, const char *end);
+
+private:
+    inline void eatBOM();
+    inline bool eatSpace();
+    inline char nextToken();
+    inline int append(TapeEntry::Type type, qint64 offset, qint64 size, quint8 flags = 0);
+    inline void finishContainer(int index);
+
+    bool parseObject();
+    bool parseArray();
+    bool parseMember();
+    bool parseString();
+    bool parseValue();
+    bool parseNumber();
+    bool parseLiteral(const char *literal, int length, TapeEntry::Type type);
+    const char *head;
+    const char *json;
+    const char *end;
+
+    int nestingLevel;
+    QJsonParseError::ParseError lastError;
+    QVector<TapeEntry> *tape;
+};
+
 }
 
+Q_DECLARE_TYPEINFO(QJsonPrivate::TapeEntry, Q_PRIMITIVE_TYPE);
+
 QT_END_NAMESPACE
 
 #endif
@@ -0,0 +1,831 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qjsonstreamreader.h"
+
+#include <qiodevice.h>
+#include <qvarlengtharray.h>
+#include <private/qjsonparser_p.h>
+#include <private/qnumeric_p.h>
+
+QT_BEGIN_NAMESPACE
+
+static const int nestingLimit = 1024;
+static const int readChunkSize = 16384;
+
+class QJsonStreamReaderPrivate
+{
+public:
+    enum Expect : quint8 {
+        ExpectDocument,
+        ExpectNameOrEnd,        // just after '{'
+        ExpectName,             // after ',' in an object
+        ExpectNameSeparator,
+        ExpectValueOrEnd,       // just after '['
+        ExpectValue,
+        ExpectSeparatorOrEnd
+    };
+    enum TokenFlag : quint8 {
+        StringHasEscapes = 0x1,
+        NumberIsInteger = 0x2,
+        BoolIsTrue = 0x4
+    };
+
+    void clear();
+    void compact();
+    bool fill();
+    QJsonStreamReader::TokenType readToken();
+    QJsonStreamReader::TokenType scanToken();
+    QJsonStreamReader::TokenType scanValue(char c);
+    QJsonStreamReader::TokenType scanString(QJsonStreamReader::TokenType type);
+    QJsonStreamReader::TokenType scanNumber();
+    QJsonStreamReader::TokenType scanLiteral(const char *literal, int length,
+                                             QJsonStreamReader::TokenType type, quint8 flags);
+    QJsonStreamReader::TokenType beginContainer(char c);
+    QJsonStreamReader::TokenType endContainer();
+    QJsonStreamReader::TokenType setToken(QJsonStreamReader::TokenType type,
+                                          int start, int end, quint8 flags = 0);
+    QJsonStreamReader::TokenType raiseError(QJsonParseError::ParseError code, int at);
+    void valueDone()
+    { expect = containers.isEmpty() ? ExpectDocument : ExpectSeparatorOrEnd; }
+
+    const char *tokenBegin() const { return buffer.constData() + tokenStart; }
+    int tokenLength() const { return tokenEnd - tokenStart; }
+
+    QIODevice *device = nullptr;
+    QByteArray buffer;
+    qint64 bufferOffset = 0;    // stream offset of buffer[0]
+    int pos = 0;                // first byte not consumed yet
+    int tokenStart = 0;
+    int tokenEnd = 0;
+    int resume = 0;             // bytes of an incomplete string already validated
+    int skipDepth = -1;
+    quint8 resumeFlags = 0;
+    quint8 tokenFlags = 0;
+    bool bomChecked = false;
+    Expect expect = ExpectDocument;
+    QJsonStreamReader::TokenType type = QJsonStreamReader::NoToken;
+    QJsonParseError::ParseError lastError = QJsonParseError::NoError;
+    QVarLengthArray<char, 64> containers;
+};
+
+void QJsonStreamReaderPrivate::clear()
+{
+    buffer.clear();
+    bufferOffset = 0;
+    pos = tokenStart = tokenEnd = resume = 0;
+    skipDepth = -1;
+    resumeFlags = tokenFlags = 0;
+    bomChecked = false;
+    expect = ExpectDocument;
+    type = QJsonStreamReader::NoToken;
+    lastError = QJsonParseError::NoError;
+    containers.clear();
+}
+
+// Drops the consumed part of the buffer. Only called before scanning the
+// next token, so the current token's data is no longer needed.
+void QJsonStreamReaderPrivate::compact()
+{
+    if (pos == 0)
+        return;
+    if (pos == buffer.size()) {
+        buffer.clear();
+    } else if (pos > buffer.size() / 2) {
+        buffer.remove(0, pos);
+    } else {
+        return;
+    }
+    bufferOffset += pos;
+    tokenStart -= pos;
+    tokenEnd -= pos;
+    pos = 0;
+}
+
+bool QJsonStreamReaderPrivate::fill()
+{
+    if (!device)
+        return false;
+    compact();
+    const int oldSize = buffer.size();
+    buffer.resize(oldSize + readChunkSize);
+    const qint64 bytesRead = device->read(buffer.data() + oldSize, readChunkSize);
+    buffer.resize(oldSize + int(qMax(bytesRead, Q_INT64_C(0))));
+    return bytesRead > 0;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::readToken()
+{
+    if (lastError != QJsonParseError::NoError)
+        return QJsonStreamReader::Invalid;
+
+    compact();
+    for (;;) {
+        const QJsonStreamReader::TokenType t = scanToken();
+        if (t != QJsonStreamReader::NoToken)
+            return t;
+        if (!fill())
+            break;
+    }
+
+    // A random-access device that is exhausted will not deliver the rest
+    // of the document. Sequential devices and addData() may still do so.
+    if (device && !device->isSequential() && device->atEnd()) {
+        if (pos < buffer.size()) {
+            const char c = buffer.at(pos);
+            if (c == '"')
+                return raiseError(QJsonParseError::UnterminatedString, buffer.size());
+            if (c == '-' || (c >= '0' && c <= '9'))
+                return raiseError(QJsonParseError::TerminationByNumber, buffer.size());
+            return raiseError(QJsonParseError::IllegalValue, buffer.size());
+        }
+        if (!containers.isEmpty()) {
+            return raiseError(containers.last() == '{' ? QJsonParseError::UnterminatedObject
+                                                       : QJsonParseError::UnterminatedArray,
+                              buffer.size());
+        }
+    }
+    return QJsonStreamReader::NoToken;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::setToken(QJsonStreamReader::TokenType t,
+                                                                int start, int end, quint8 flags)
+{
+    tokenStart = start;
+    tokenEnd = end;
+    tokenFlags = flags;
+    pos = end;
+    return t;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::raiseError(QJsonParseError::ParseError code,
+                                                                  int at)
+{
+    lastError = code;
+    tokenStart = tokenEnd = at;
+    return QJsonStreamReader::Invalid;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::scanToken()
+{
+    const char *begin = buffer.constData();
+    const char *end = begin + buffer.size();
+
+    if (!bomChecked) {
+        // eat UTF-8 byte order mark at the start of the stream
+        static const char utf8bom[] = "\xef\xbb\xbf";
+        const int available = qMin(int(end - begin) - pos, 3);
+        if (memcmp(begin + pos, utf8bom, size_t(available)) == 0) {
+            if (available < 3)
+                return QJsonStreamReader::NoToken;
+            pos += 3;
+        }
+        bomChecked = true;
+    }
+
+    for (;;) {
+        // ws = *( %x20 / %x09 / %x0A / %x0D )
+        while (pos < buffer.size()) {
+            const char c = begin[pos];
+            if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+                break;
+            ++pos;
+        }
+        if (pos == buffer.size())
+            return QJsonStreamReader::NoToken;
+
+        const char c = begin[pos];
+        switch (expect) {
+        case ExpectDocument:
+            if (c == '{' || c == '[')
+                return beginContainer(c);
+            return raiseError(QJsonParseError::IllegalValue, pos);
+
+        case ExpectNameOrEnd:
+            if (c == '}')
+                return endContainer();
+            Q_FALLTHROUGH();
+        case ExpectName:
+            if (c == '"')
+                return scanString(QJsonStreamReader::Name);
+            return raiseError(c == '}' ? QJsonParseError::MissingObject
+                                       : QJsonParseError::UnterminatedObject, pos);
+
+        case ExpectNameSeparator:
+            if (c != ':')
+                return raiseError(QJsonParseError::MissingNameSeparator, pos);
+            ++pos;
+            expect = ExpectValue;
+            continue;
+
+        case ExpectValueOrEnd:
+            if (c == ']')
+                return endContainer();
+            Q_FALLTHROUGH();
+        case ExpectValue:
+            return scanValue(c);
+
+        case ExpectSeparatorOrEnd: {
+            const bool inObject = containers.last() == '{';
+            if (c == (inObject ? '}' : ']'))
+                return endContainer();
+            if (c != ',')
+                return raiseError(inObject ? QJsonParseError::UnterminatedObject
+                                           : QJsonParseError::MissingValueSeparator, pos);
+            ++pos;
+            expect = inObject ? ExpectName : ExpectValue;
+            continue;
+        }
+        }
+        Q_UNREACHABLE();
+    }
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::scanValue(char c)
+{
+    switch (c) {
+    case 'n':
+        return scanLiteral("null", 4, QJsonStreamReader::Null, 0);
+    case 't':
+        return scanLiteral("true", 4, QJsonStreamReader::Bool, BoolIsTrue);
+    case 'f':
+        return scanLiteral("false", 5, QJsonStreamReader::Bool, 0);
+    case '"':
+        return scanString(QJsonStreamReader::String);
+    case '[':
+    case '{':
+        return beginContainer(c);
+    case ',':
+        return raiseError(QJsonParseError::IllegalValue, pos);
+    case ']':
+    case '}':
+        return raiseError(QJsonParseError::MissingObject, pos);
+    default:
+        return scanNumber();
+    }
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::beginContainer(char c)
+{
+    if (containers.size() >= nestingLimit)
+        return raiseError(QJsonParseError::DeepNesting, pos);
+    containers.append(c);
+    expect = (c == '{' ? ExpectNameOrEnd : ExpectValueOrEnd);
+    return setToken(c == '{' ? QJsonStreamReader::StartObject : QJsonStreamReader::StartArray,
+                    pos, pos + 1);
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::endContainer()
+{
+    const char c = containers.last();
+    containers.removeLast();
+    valueDone();
+    return setToken(c == '{' ? QJsonStreamReader::EndObject : QJsonStreamReader::EndArray,
+                    pos, pos + 1);
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::scanLiteral(const char *literal, int length,
+                                                                   QJsonStreamReader::TokenType t,
+                                                                   quint8 flags)
+{
+    for (int i = 1; i < length; ++i) {
+        if (pos + i == buffer.size())
+            return QJsonStreamReader::NoToken;
+        if (buffer.at(pos + i) != literal[i])
+            return raiseError(QJsonParseError::IllegalValue, pos + i);
+    }
+    valueDone();
+    return setToken(t, pos, pos + length, flags);
+}
+
+/*
+    Same grammar as QJsonPrivate::TapeParser::parseNumber(). A number is
+    only complete once a character that cannot continue it has arrived.
+*/
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::scanNumber()
+{
+    const char *begin = buffer.constData();
+    const char *end = begin + buffer.size();
+    const char *json = begin + pos;
+
+    const char *run = json;
+    while (run < end && ((*run >= '0' && *run <= '9') || *run == '-' || *run == '+'
+                         || *run == '.' || *run == 'e' || *run == 'E'))
+        ++run;
+    if (run == end)
+        return QJsonStreamReader::NoToken;
+
+    quint8 flags = NumberIsInteger;
+
+    // minus
+    if (json < run && *json == '-')
+        ++json;
+
+    // int = zero / ( digit1-9 *DIGIT )
+    const char *digits = json;
+    if (json < run && *json == '0') {
+        ++json;
+    } else {
+        while (json < run && *json >= '0' && *json <= '9')
+            ++json;
+    }
+    bool valid = json != digits;
+
+    // frac = decimal-point 1*DIGIT
+    if (json < run && *json == '.') {
+        flags = 0;
+        digits = ++json;
+        while (json < run && *json >= '0' && *json <= '9')
+            ++json;
+        valid = valid && json != digits;
+    }
+
+    // exp = e [ minus / plus ] 1*DIGIT
+    if (json < run && (*json == 'e' || *json == 'E')) {
+        flags = 0;
+        ++json;
+        if (json < run && (*json == '-' || *json == '+'))
+            ++json;
+        digits = json;
+        while (json < run && *json >= '0' && *json <= '9')
+            ++json;
+        valid = valid && json != digits;
+    }
+
+    if (!valid)
+        return raiseError(QJsonParseError::IllegalNumber, int(json - begin));
+
+    valueDone();
+    return setToken(QJsonStreamReader::Number, pos, int(json - begin), flags);
+}
+
+QJsonStreamReader::TokenType QJsonStreamReaderPrivate::scanString(QJsonStreamReader::TokenType t)
+{
+    const char *begin = buffer.constData();
+    const char *end = begin + buffer.size();
+    const char *json = begin + pos + 1 + resume;
+    quint8 flags = resumeFlags;
+
+    for (;;) {
+        if (json == end) {
+            // remember how far we got, so that more data does not
+            // make us validate the same bytes again
+            resume = int(json - begin) - pos - 1;
+            resumeFlags = flags;
+            return QJsonStreamReader::NoToken;
+        }
+
+        const char c = *json;
+        if (c == '"')
+            break;
+
+        uint ch = 0;
+        if (c == '\\') {
+            flags |= StringHasEscapes;
+            if (end - json < 2 || (json[1] == 'u' && end - json < 6)) {
+                resume = int(json - begin) - pos - 1;
+                resumeFlags = flags;
+                return QJsonStreamReader::NoToken;
+            }
+            if (!QJsonPrivate::scanEscapeSequence(json, end, &ch))
+                return raiseError(QJsonParseError::IllegalEscapeSequence, int(json - begin));
+        } else if (uchar(c) < 0x80) {
+            ++json;
+        } else {
+            const int needed = (uchar(c) & 0xe0) == 0xc0 ? 2
+                             : (uchar(c) & 0xf0) == 0xe0 ? 3
+                             : (uchar(c) & 0xf8) == 0xf0 ? 4 : 1;
+            if (end - json < needed) {
+                resume = int(json - begin) - pos - 1;
+                resumeFlags = flags;
+                return QJsonStreamReader::NoToken;
+            }
+            if (!QJsonPrivate::scanUtf8Char(json, end, &ch))
+                return raiseError(QJsonParseError::IllegalUTF8String, int(json - begin));
+        }
+    }
+
+    resume = 0;
+    resumeFlags = 0;
+    if (t == QJsonStreamReader::Name)
+        expect = ExpectNameSeparator;
+    else
+        valueDone();
+    return setToken(t, pos, int(json - begin) + 1, flags);
+}
+
+/*!
+    \class QJsonStreamReader
+    \inmodule QtCore
+    \ingroup json
+    \reentrant
+    \since 5.16
+
+    \brief The QJsonStreamReader class is a fast pull parser for JSON
+    text.
+
+    QJsonStreamReader reads JSON one token at a time, without building a
+    QJsonDocument. It keeps only the current token and a small amount of
+    state in memory, so it can process documents or streams much larger
+    than the available memory, such as newline-delimited JSON logs: one
+    top-level object or array follows another, separated by whitespace.
+
+    The reader is fed either from a QIODevice with setDevice(), or
+    incrementally with addData(). Call readNext() repeatedly and inspect
+    tokenType(): each object produces StartObject, a Name for each
+    member followed by the member's value, and EndObject; each array
+    produces StartArray, its elements and EndArray. Scalar values are
+    reported as String, Number, Bool or Null tokens, and converted with
+    text(), toInteger(), toDouble(), toBool() or value().
+
+    \snippet code/src_corelib_serialization_qjsonstreamreader.cpp 0
+
+    When readNext() needs more data than is available, it returns NoToken
+    and the reader resumes where it stopped once more data arrives, either
+    through addData() or on the device. Only a random-access device that
+    is at its end is taken to mean that the document is truncated, which
+    is reported as an error.
+
+    skipCurrentElement() skips an object or array without decoding any of
+    its contents.
+
+    The text is validated like QJsonDocument::fromJson() does and the
+    same QJsonParseError::ParseError codes are reported by error(). Once
+    an error has occurred, readNext() only returns Invalid until clear()
+    is called.
+
+    \sa QJsonDocument, QCborStreamReader, QXmlStreamReader
+*/
+
+/*!
+    \enum QJsonStreamReader::TokenType
+
+    This enum specifies the type of the token the reader just read.
+
+    \value NoToken      No token has been read yet, or more data is needed.
+    \value Invalid      An error has occurred; see error() and errorString().
+    \value StartObject  The start of an object.
+    \value EndObject    The end of an object.
+    \value StartArray   The start of an array.
+    \value EndArray     The end of an array.
+    \value Name         The name of an object member; text() returns it.
+                        The member's value is the next token.
+    \value String       A string value; text() returns it.
+    \value Number       A number; see toInteger(), toDouble() and isInteger().
+    \value Bool         \c true or \c false; see toBool().
+    \value Null         The \c null value.
+*/
+
+/*!
+    Constructs a stream reader without data. Use setDevice() or addData()
+    to provide it.
+*/
+QJsonStreamReader::QJsonStreamReader()
+    : d(new QJsonStreamReaderPrivate)
+{
+}
+
+/*!
+    Constructs a stream reader that reads from \a device.
+*/
+QJsonStreamReader::QJsonStreamReader(QIODevice *device)
+    : d(new QJsonStreamReaderPrivate)
+{
+    d->device = device;
+}
+
+/*!
+    Constructs a stream reader that reads from \a data.
+*/
+QJsonStreamReader::QJsonStreamReader(const QByteArray &data)
+    : d(new QJsonStreamReaderPrivate)
+{
+    d->buffer = data;
+}
+
+/*!
+    Destroys the stream reader.
+*/
+QJsonStreamReader::~QJsonStreamReader()
+{
+}
+
+/*!
+    Makes the reader read from \a device, after any data it still holds.
+    Passing \nullptr stops reading from the previous device.
+
+    \sa device(), clear()
+*/
+void QJsonStreamReader::setDevice(QIODevice *device)
+{
+    d->device = device;
+}
+
+/*!
+    Returns the device the reader reads from, or \nullptr.
+*/
+QIODevice *QJsonStreamReader::device() const
+{
+    return d->device;
+}
+
+/*!
+    Appends \a data to the text to be read, for instance when it arrives
+    in pieces from the network. Must not be used together with a device.
+*/
+void QJsonStreamReader::addData(const QByteArray &data)
+{
+    if (d->device) {
+        qWarning("QJsonStreamReader: addData() with a device set is not supported");
+        return;
+    }
+    d->compact();
+    d->buffer += data;
+}
+
+/*!
+    \overload
+
+    Appends \a len bytes from \a data.
+*/
+void QJsonStreamReader::addData(const char *data, int len)
+{
+    addData(QByteArray::fromRawData(data, len));
+}
+
+/*!
+    Discards all data, the device and any error, and returns the reader
+    to its initial state.
+*/
+void QJsonStreamReader::clear()
+{
+    d->clear();
+    d->device = nullptr;
+}
+
+/*!
+    Returns \c true if an error occurred or if all data currently
+    available has been read and the reader is between documents. With
+    addData() or a sequential device, more data can arrive later and
+    atEnd() returns \c false again.
+*/
+bool QJsonStreamReader::atEnd() const
+{
+    if (d->lastError != QJsonParseError::NoError)
+        return true;
+    if (!d->containers.isEmpty() || d->skipDepth >= 0)
+        return false;
+    if (d->pos < d->buffer.size())
+        return false;
+    return !d->device || d->device->atEnd();
+}
+
+/*!
+    Reads the next token and returns its type, which is also available
+    as tokenType() until the next call. Returns NoToken if more data is
+    needed.
+
+    If skipCurrentElement() ran out of data, this continues skipping and
+    returns the end token of the skipped object or array once it is found.
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::readNext()
+{
+    if (d->skipDepth >= 0) {
+        skipCurrentElement();
+        return d->type;
+    }
+    d->type = d->readToken();
+    return d->type;
+}
+
+/*!
+    If the current token is StartObject or StartArray, reads up to and
+    including the matching EndObject or EndArray, which becomes the
+    current token, and returns \c true. Strings inside the skipped
+    element are validated but never decoded.
+
+    Returns \c false if an error occurred or if the data ran out first;
+    in the latter case the next readNext() carries on skipping. For any
+    other current token, returns \c true without doing anything.
+*/
+bool QJsonStreamReader::skipCurrentElement()
+{
+    if (d->skipDepth < 0) {
+        if (d->type != StartObject && d->type != StartArray)
+            return true;
+        d->skipDepth = depth() - 1;
+    }
+
+    while (depth() > d->skipDepth) {
+        d->type = d->readToken();
+        if (d->type == NoToken)
+            return false;
+        if (d->type == Invalid) {
+            d->skipDepth = -1;
+            return false;
+        }
+    }
+    d->skipDepth = -1;
+    return true;
+}
+
+/*!
+    Returns the type of the current token.
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::tokenType() const
+{
+    return d->type;
+}
+
+/*!
+    Returns the name of the current token type, such as "StartObject".
+*/
+QString QJsonStreamReader::tokenString() const
+{
+    static const char names[][12] = {
+        "NoToken", "Invalid", "StartObject", "EndObject", "StartArray",
+        "EndArray", "Name", "String", "Number", "Bool", "Null"
+    };
+    return QLatin1String(names[d->type]);
+}
+
+/*!
+    Returns the number of objects and arrays the current token is nested
+    in. A StartObject or StartArray token counts itself; the matching end
+    token does not.
+*/
+int QJsonStreamReader::depth() const
+{
+    return d->containers.size();
+}
+
+/*!
+    Returns the offset in bytes of the current token from the start of the
+    data, or where the error was found if tokenType() is Invalid.
+*/
+qint64 QJsonStreamReader::currentOffset() const
+{
+    return d->bufferOffset + d->tokenStart;
+}
+
+/*!
+    Returns the current Name or String token decoded, or the text of the
+    current Number, Bool or Null token. For other tokens, returns a null
+    string.
+*/
+QString QJsonStreamReader::text() const
+{
+    switch (d->type) {
+    case Name:
+    case String:
+        if (d->tokenFlags & QJsonStreamReaderPrivate::StringHasEscapes)
+            return QJsonPrivate::TapeParser::decodeString(d->tokenBegin() + 1,
+                                                          d->tokenBegin() + d->tokenLength() - 1);
+        return QString::fromUtf8(d->tokenBegin() + 1, d->tokenLength() - 2);
+    case Number:
+    case Bool:
+    case Null:
+        return QString::fromLatin1(d->tokenBegin(), d->tokenLength());
+    default:
+        return QString();
+    }
+}
+
+/*!
+    Returns \c true if the current token is a Number written without a
+    fraction or exponent.
+*/
+bool QJsonStreamReader::isInteger() const
+{
+    return d->type == Number && (d->tokenFlags & QJsonStreamReaderPrivate::NumberIsInteger);
+}
+
+/*!
+    Returns the current Number token as a 64-bit integer, or
+    \a defaultValue if it is not a number or cannot be represented
+    exactly.
+*/
+qint64 QJsonStreamReader::toInteger(qint64 defaultValue) const
+{
+    if (d->type != Number)
+        return defaultValue;
+    const QByteArray number = QByteArray::fromRawData(d->tokenBegin(), d->tokenLength());
+    if (isInteger()) {
+        bool ok;
+        qlonglong n = number.toLongLong(&ok);
+        if (ok)
+            return n;
+    }
+    const double dbl = number.toDouble();
+    qint64 n;
+    return convertDoubleTo(dbl, &n) ? n : defaultValue;
+}
+
+/*!
+    Returns the current Number token as a double, or \a defaultValue if it
+    is not a number.
+*/
+double QJsonStreamReader::toDouble(double defaultValue) const
+{
+    if (d->type != Number)
+        return defaultValue;
+    return QByteArray::fromRawData(d->tokenBegin(), d->tokenLength()).toDouble();
+}
+
+/*!
+    Returns the current Bool token's value, or \a defaultValue if it is
+    not a Bool.
+*/
+bool QJsonStreamReader::toBool(bool defaultValue) const
+{
+    if (d->type != Bool)
+        return defaultValue;
+    return d->tokenFlags & QJsonStreamReaderPrivate::BoolIsTrue;
+}
+
+/*!
+    Returns the value of the current String, Number, Bool or Null token
+    as QJsonDocument::fromJson() would have stored it. For names and
+    structural tokens, returns an undefined value.
+*/
+QJsonValue QJsonStreamReader::value() const
+{
+    switch (d->type) {
+    case String:
+        return QJsonValue(text());
+    case Number:
+        return QJsonPrivate::numberValue(d->tokenBegin(), d->tokenLength(), isInteger());
+    case Bool:
+        return QJsonValue(toBool());
+    case Null:
+        return QJsonValue(QJsonValue::Null);
+    default:
+        return QJsonValue(QJsonValue::Undefined);
+    }
+}
+
+/*!
+    Returns \c true if an error occurred.
+*/
+bool QJsonStreamReader::hasError() const
+{
+    return d->lastError != QJsonParseError::NoError;
+}
+
+/*!
+    Returns the error that occurred, or QJsonParseError::NoError.
+*/
+QJsonParseError::ParseError QJsonStreamReader::error() const
+{
+    return d->lastError;
+}
+
+/*!
+    Returns a human-readable description of error().
+*/
+QString QJsonStreamReader::errorString() const
+{
+    QJsonParseError error;
+    error.offset = int(currentOffset());
+    error.error = d->lastError;
+    return error.errorString();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,468 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qjsontape_p.h"
+
+#include <qfile.h>
+#include <qjsondocument.h>
+
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+using QJsonPrivate::TapeEntry;
+
+/*!
+    \class QJsonTape
+    \inmodule QtCore
+    \internal
+    \since 5.16
+
+    \brief The QJsonTape class indexes a JSON document without building
+    the value tree.
+
+    QJsonDocument::fromJson() converts the whole document into QCborValue
+    elements before anything can be read from it. For large documents of
+    which only a few values are used, QJsonTape is cheaper: it validates
+    the document and records a flat structural index (the tape) with the
+    position of every value, but leaves the text itself untouched.
+    loadFile() memory-maps the file, so the document is never copied.
+
+    Values are accessed through root() and the QJsonTapeValue cursors it
+    returns. Objects and arrays are only converted to QJsonObject and
+    QJsonArray when QJsonTapeValue::toValue(), toObject() or toArray() is
+    called on them, and then only the requested subtree is parsed.
+
+    The tape must outlive the QJsonTapeValue cursors obtained from it and
+    any byte array returned by QJsonTapeValue::toUtf8().
+
+    \sa QJsonDocument
+*/
+
+QJsonTape::QJsonTape() = default;
+
+QJsonTape::~QJsonTape() = default;
+
+/*!
+    Indexes the JSON document in \a json, returning \c true on success.
+    The data is shared with \a json rather than copied. On failure, the
+    tape is empty and, if \a error is not null, the reason is stored in it
+    like QJsonDocument::fromJson() would.
+*/
+bool QJsonTape::load(const QByteArray &json, QJsonParseError *error)
+{
+    clear();
+    data = json;
+    this->json = data.constData();
+    length = data.size();
+    return parse(error);
+}
+
+/*!
+    Memory-maps the file \a fileName and indexes the JSON document it
+    contains, returning \c true on success. The file stays mapped until
+    the tape is cleared or destroyed. If the file cannot be mapped, its
+    contents are read into memory instead.
+
+    On failure, the tape is empty. If \a error is not null, the reason is
+    stored in it; a file that cannot be opened is reported as
+    QJsonParseError::IllegalValue at offset 0.
+*/
+bool QJsonTape::loadFile(const QString &fileName, QJsonParseError *error)
+{
+    clear();
+    file.reset(new QFile(fileName));
+    if (!file->open(QIODevice::ReadOnly)) {
+        file.reset();
+        if (error) {
+            error->offset = 0;
+            error->error = QJsonParseError::IllegalValue;
+        }
+        return false;
+    }
+
+    length = file->size();
+    if (uchar *mapped = length ? file->map(0, length) : nullptr) {
+        json = reinterpret_cast<const char *>(mapped);
+    } else {
+        data = file->readAll();
+        file.reset();
+        json = data.constData();
+        length = data.size();
+    }
+    return parse(error);
+}
+
+/*!
+    Releases the document and the index.
+*/
+void QJsonTape::clear()
+{
+    entries.clear();
+    file.reset();
+    data.clear();
+    json = nullptr;
+    length = 0;
+}
+
+bool QJsonTape::parse(QJsonParseError *error)
+{
+    QJsonPrivate::TapeParser parser(json, length);
+    if (parser.parse(&entries, error))
+        return true;
+    clear();
+    return false;
+}
+
+/*!
+    Returns the top-level object or array of the document, or an undefined
+    value if the tape is empty.
+*/
+QJsonTapeValue QJsonTape::root() const
+{
+    return entries.isEmpty() ? QJsonTapeValue() : QJsonTapeValue(this, 0);
+}
+
+/*!
+    \class QJsonTapeValue
+    \inmodule QtCore
+    \internal
+    \since 5.16
+
+    \brief The QJsonTapeValue class is a read-only cursor into a QJsonTape.
+
+    The accessors mirror QJsonValue, QJsonObject and QJsonArray, but
+    navigate the tape instead of a value tree. Unlike QJsonObject, an
+    object's keys() and iterators follow document order; when a key occurs
+    more than once, value() returns the last occurrence, just like the
+    parser behind QJsonDocument::fromJson() keeps it.
+
+    Looking up a key or an index is linear in the number of members of the
+    container, so use begin() and end() to visit all of them.
+*/
+
+static inline QByteArray tokenData(const char *json, const TapeEntry &e)
+{
+    return QByteArray::fromRawData(json + e.offset, int(e.size));
+}
+
+static QString decodeString(const char *json, const TapeEntry &e)
+{
+    // skip the quotation marks
+    const char *begin = json + e.offset + 1;
+    const char *end = json + e.offset + e.size - 1;
+    if (e.flags & TapeEntry::StringHasEscapes)
+        return QJsonPrivate::TapeParser::decodeString(begin, end);
+    return QString::fromUtf8(begin, int(end - begin));
+}
+
+static bool keyEquals(const char *json, const TapeEntry &e, QStringView key, const QByteArray &utf8Key)
+{
+    if (e.flags & TapeEntry::StringHasEscapes)
+        return decodeString(json, e) == key;
+    return e.size - 2 == utf8Key.size()
+            && std::memcmp(json + e.offset + 1, utf8Key.constData(), size_t(utf8Key.size())) == 0;
+}
+
+static inline QJsonValue numberValue(const char *json, const TapeEntry &e)
+{
+    return QJsonPrivate::numberValue(json + e.offset, int(e.size),
+                                     e.flags & TapeEntry::NumberIsInteger);
+}
+
+/*!
+    Returns the type of the value, or QJsonValue::Undefined for a
+    default-constructed cursor or a missing key or index.
+*/
+QJsonValue::Type QJsonTapeValue::type() const
+{
+    if (!tape)
+        return QJsonValue::Undefined;
+    switch (tape->entries.at(index).type) {
+    case TapeEntry::Null:
+        return QJsonValue::Null;
+    case TapeEntry::False:
+    case TapeEntry::True:
+        return QJsonValue::Bool;
+    case TapeEntry::Number:
+        return QJsonValue::Double;
+    case TapeEntry::String:
+        return QJsonValue::String;
+    case TapeEntry::Array:
+        return QJsonValue::Array;
+    case TapeEntry::Object:
+        return QJsonValue::Object;
+    }
+    Q_UNREACHABLE();
+    return QJsonValue::Undefined;
+}
+
+/*!
+    Returns the boolean value, or \a defaultValue if this is not a boolean.
+*/
+bool QJsonTapeValue::toBool(bool defaultValue) const
+{
+    if (!isBool())
+        return defaultValue;
+    return tape->entries.at(index).type == TapeEntry::True;
+}
+
+/*!
+    Returns the number as an int, or \a defaultValue if this is not a
+    number that can be represented exactly as an int.
+
+    \sa QJsonValue::toInt()
+*/
+int QJsonTapeValue::toInt(int defaultValue) const
+{
+    if (!isDouble())
+        return defaultValue;
+    return numberValue(tape->json, tape->entries.at(index)).toInt(defaultValue);
+}
+
+/*!
+    Returns the number as a double, or \a defaultValue if this is not a
+    number.
+*/
+double QJsonTapeValue::toDouble(double defaultValue) const
+{
+    if (!isDouble())
+        return defaultValue;
+    return numberValue(tape->json, tape->entries.at(index)).toDouble(defaultValue);
+}
+
+/*!
+    Returns the string value, or a null string if this is not a string.
+
+    \sa toUtf8()
+*/
+QString QJsonTapeValue::toString() const
+{
+    if (!isString())
+        return QString();
+    return decodeString(tape->json, tape->entries.at(index));
+}
+
+/*!
+    Returns the string value encoded as UTF-8, or a null byte array if
+    this is not a string.
+
+    Strings without escape sequences are returned without copying: the
+    byte array refers directly to the document, which may be a mapped
+    file, and only copies the data once it is modified. It must therefore
+    not be used after the tape is cleared or destroyed.
+*/
+QByteArray QJsonTapeValue::toUtf8() const
+{
+    if (!isString())
+        return QByteArray();
+    const TapeEntry &e = tape->entries.at(index);
+    if (e.flags & TapeEntry::StringHasEscapes)
+        return decodeString(tape->json, e).toUtf8();
+    return QByteArray::fromRawData(tape->json + e.offset + 1, int(e.size - 2));
+}
+
+/*!
+    Converts the value and, for objects and arrays, everything it contains
+    into a QJsonValue. Only the text of this value is parsed.
+*/
+QJsonValue QJsonTapeValue::toValue() const
+{
+    if (!tape)
+        return QJsonValue(QJsonValue::Undefined);
+    const TapeEntry &e = tape->entries.at(index);
+    switch (e.type) {
+    case TapeEntry::Null:
+        return QJsonValue(QJsonValue::Null);
+    case TapeEntry::False:
+        return QJsonValue(false);
+    case TapeEntry::True:
+        return QJsonValue(true);
+    case TapeEntry::Number:
+        return numberValue(tape->json, e);
+    case TapeEntry::String:
+        return QJsonValue(decodeString(tape->json, e));
+    case TapeEntry::Array:
+        return QJsonDocument::fromJson(tokenData(tape->json, e)).array();
+    case TapeEntry::Object:
+        return QJsonDocument::fromJson(tokenData(tape->json, e)).object();
+    }
+    Q_UNREACHABLE();
+    return QJsonValue(QJsonValue::Undefined);
+}
+
+/*!
+    Converts this array into a QJsonArray, or returns an empty array if
+    this is not an array.
+*/
+QJsonArray QJsonTapeValue::toArray() const
+{
+    if (!isArray())
+        return QJsonArray();
+    return QJsonDocument::fromJson(tokenData(tape->json, tape->entries.at(index))).array();
+}
+
+/*!
+    Converts this object into a QJsonObject, or returns an empty object if
+    this is not an object.
+*/
+QJsonObject QJsonTapeValue::toObject() const
+{
+    if (!isObject())
+        return QJsonObject();
+    return QJsonDocument::fromJson(tokenData(tape->json, tape->entries.at(index))).object();
+}
+
+/*!
+    Returns the number of elements of an array or members of an object,
+    counting repeated keys, or 0 for any other value.
+*/
+int QJsonTapeValue::size() const
+{
+    int count = 0;
+    for (const_iterator it = begin(), e = end(); it != e; ++it)
+        ++count;
+    return count;
+}
+
+/*!
+    Returns the element at index \a i of an array, or an undefined value
+    if this is not an array or \a i is out of range.
+*/
+QJsonTapeValue QJsonTapeValue::at(int i) const
+{
+    if (!isArray() || i < 0)
+        return QJsonTapeValue();
+    for (const_iterator it = begin(), e = end(); it != e; ++it) {
+        if (!i--)
+            return it.value();
+    }
+    return QJsonTapeValue();
+}
+
+/*!
+    Returns the value of the last member of an object named \a key, or an
+    undefined value if there is none or this is not an object.
+*/
+QJsonTapeValue QJsonTapeValue::value(QStringView key) const
+{
+    if (!isObject())
+        return QJsonTapeValue();
+
+    const QByteArray utf8Key = key.toUtf8();
+    int found = -1;
+    for (const_iterator it = begin(), e = end(); it != e; ++it) {
+        if (keyEquals(tape->json, tape->entries.at(it.index), key, utf8Key))
+            found = it.index + 1;
+    }
+    return found < 0 ? QJsonTapeValue() : QJsonTapeValue(tape, found);
+}
+
+/*!
+    Returns the keys of an object in document order, or an empty list if
+    this is not an object.
+*/
+QStringList QJsonTapeValue::keys() const
+{
+    QStringList result;
+    if (isObject()) {
+        for (const_iterator it = begin(), e = end(); it != e; ++it)
+            result.append(it.key());
+    }
+    return result;
+}
+
+/*!
+    Returns an iterator to the first element of an array or member of an
+    object. For other values, the result equals end().
+*/
+QJsonTapeValue::const_iterator QJsonTapeValue::begin() const
+{
+    if (!isArray() && !isObject())
+        return const_iterator();
+    return const_iterator(tape, index + 1, isObject());
+}
+
+/*!
+    Returns an iterator past the last element of an array or member of an
+    object.
+*/
+QJsonTapeValue::const_iterator QJsonTapeValue::end() const
+{
+    if (!isArray() && !isObject())
+        return const_iterator();
+    return const_iterator(tape, tape->entries.at(index).next, isObject());
+}
+
+/*!
+    \class QJsonTapeValue::const_iterator
+    \inmodule QtCore
+    \internal
+
+    Iterates over the elements of an array or the members of an object.
+*/
+
+/*!
+    Returns the key of the current object member, or a null string when
+    iterating over an array.
+*/
+QString QJsonTapeValue::const_iterator::key() const
+{
+    if (!isObject)
+        return QString();
+    return decodeString(tape->json, tape->entries.at(index));
+}
+
+/*!
+    Returns the current element or member value.
+*/
+QJsonTapeValue QJsonTapeValue::const_iterator::value() const
+{
+    return QJsonTapeValue(tape, isObject ? index + 1 : index);
+}
+
+QJsonTapeValue::const_iterator &QJsonTapeValue::const_iterator::operator++()
+{
+    // object members are a key entry followed by the value entry
+    index = tape->entries.at(isObject ? index + 1 : index).next;
+    return *this;
+}
+
+QT_END_NAMESPACE
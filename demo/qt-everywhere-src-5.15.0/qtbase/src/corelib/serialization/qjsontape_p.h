@@ -0,0 +1,172 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QJSONTAPE_P_H
+#define QJSONTAPE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/private/qjsonparser_p.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsonobject.h>
+#include <QtCore/qjsonvalue.h>
+#include <QtCore/qscopedpointer.h>
+#include <QtCore/qstringlist.h>
+
+#include <iterator>
+
+QT_BEGIN_NAMESPACE
+
+class QFile;
+class QJsonTape;
+
+class Q_CORE_EXPORT QJsonTapeValue
+{
+public:
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef QJsonTapeValue value_type;
+
+        const_iterator() = default;
+
+        QString key() const;
+        QJsonTapeValue value() const;
+        QJsonTapeValue operator*() const { return value(); }
+
+        const_iterator &operator++();
+        const_iterator operator++(int) { const_iterator r = *this; ++*this; return r; }
+
+        bool operator==(const const_iterator &other) const
+        { return tape == other.tape && index == other.index; }
+        bool operator!=(const const_iterator &other) const
+        { return !(*this == other); }
+
+    private:
+        friend class QJsonTapeValue;
+        const_iterator(const QJsonTape *tape, int index, bool isObject)
+            : tape(tape), index(index), isObject(isObject) {}
+
+        const QJsonTape *tape = nullptr;
+        int index = -1;
+        bool isObject = false;
+    };
+
+    QJsonTapeValue() = default;
+
+    QJsonValue::Type type() const;
+    bool isNull() const { return type() == QJsonValue::Null; }
+    bool isBool() const { return type() == QJsonValue::Bool; }
+    bool isDouble() const { return type() == QJsonValue::Double; }
+    bool isString() const { return type() == QJsonValue::String; }
+    bool isArray() const { return type() == QJsonValue::Array; }
+    bool isObject() const { return type() == QJsonValue::Object; }
+    bool isUndefined() const { return type() == QJsonValue::Undefined; }
+
+    bool toBool(bool defaultValue = false) const;
+    int toInt(int defaultValue = 0) const;
+    double toDouble(double defaultValue = 0) const;
+    QString toString() const;
+    QByteArray toUtf8() const;
+
+    QJsonValue toValue() const;
+    QJsonArray toArray() const;
+    QJsonObject toObject() const;
+
+    int size() const;
+    QJsonTapeValue at(int i) const;
+    QJsonTapeValue value(QStringView key) const;
+    QJsonTapeValue operator[](int i) const { return at(i); }
+    QJsonTapeValue operator[](QStringView key) const { return value(key); }
+    bool contains(QStringView key) const { return !value(key).isUndefined(); }
+    QStringList keys() const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+private:
+    friend class QJsonTape;
+    QJsonTapeValue(const QJsonTape *tape, int index) : tape(tape), index(index) {}
+
+    const QJsonTape *tape = nullptr;
+    int index = -1;
+};
+
+class Q_CORE_EXPORT QJsonTape
+{
+    Q_DISABLE_COPY_MOVE(QJsonTape)
+public:
+    QJsonTape();
+    ~QJsonTape();
+
+    bool load(const QByteArray &json, QJsonParseError *error = nullptr);
+    bool loadFile(const QString &fileName, QJsonParseError *error = nullptr);
+    void clear();
+
+    bool isEmpty() const { return entries.isEmpty(); }
+    QJsonTapeValue root() const;
+
+private:
+    friend class QJsonTapeValue;
+    bool parse(QJsonParseError *error);
+
+    QScopedPointer<QFile> file;
+    QByteArray data;
+    const char *json = nullptr;
+    qint64 length = 0;
+    QVector<QJsonPrivate::TapeEntry> entries;
+};
+
+QT_END_NAMESPACE
+
+#endif // QJSONTAPE_P_H
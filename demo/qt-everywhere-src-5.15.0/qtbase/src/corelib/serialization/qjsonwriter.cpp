@@ -58,60 +58,80 @@ static inline uchar hexdig(uint u)
     return (u < 0xa ? '0' + u : 'a' + u - 0xa);
 }
 
-static QByteArray escapedString(const QString &s)
+static inline bool isPlainAscii(uint u)
 {
-    QByteArray ba(s.length(), Qt::Uninitialized);
+    return u >= 0x20 && u < 0x80 && u != 0x22 && u != 0x5c;
+}
 
-    uchar *cursor = reinterpret_cast<uchar *>(const_cast<char *>(ba.constData()));
-    const uchar *ba_end = cursor + ba.length();
-    const ushort *src = reinterpret_cast<const ushort *>(s.constBegin());
-    const ushort *const end = reinterpret_cast<const ushort *>(s.constEnd());
+// writes the escape sequence for a control character, '"' or '\\'
+static inline uchar *escapeAscii(uchar *cursor, uint u)
+{
+    *cursor++ = '\\';
+    switch (u) {
+    case 0x22:
+        *cursor++ = '"';
+        break;
+    case 0x5c:
+        *cursor++ = '\\';
+        break;
+    case 0x8:
+        *cursor++ = 'b';
+        break;
+    case 0xc:
+        *cursor++ = 'f';
+        break;
+    case 0xa:
+        *cursor++ = 'n';
+        break;
+    case 0xd:
+        *cursor++ = 'r';
+        break;
+    case 0x9:
+        *cursor++ = 't';
+        break;
+    default:
+        *cursor++ = 'u';
+        *cursor++ = '0';
+        *cursor++ = '0';
+        *cursor++ = hexdig(u>>4);
+        *cursor++ = hexdig(u & 0xf);
+    }
+    return cursor;
+}
+
+static void escapedString(QByteArray &json, QStringView s)
+{
+    const ushort *src = reinterpret_cast<const ushort *>(s.utf16());
+    const ushort *const end = src + s.size();
+
+    // most strings need no escaping, so start out with room for all of s
+    int pos = json.size();
+    json.resize(pos + int(s.size()) + 6);
+    uchar *cursor = reinterpret_cast<uchar *>(json.data()) + pos;
+    const uchar *ba_end = reinterpret_cast<const uchar *>(json.constData()) + json.size();
 
     while (src != end) {
-        if (cursor >= ba_end - 6) {
-            // ensure we have enough space
-            int pos = cursor - (const uchar *)ba.constData();
-            ba.resize(ba.size()*2);
-            cursor = (uchar *)ba.data() + pos;
-            ba_end = (const uchar *)ba.constData() + ba.length();
+        const ushort *run = src;
+        while (run != end && isPlainAscii(*run))
+            ++run;
+
+        if (ba_end - cursor < (run - src) + 6) {
+            // ensure we have enough space for the run and one more character
+            pos = cursor - reinterpret_cast<const uchar *>(json.constData());
+            json.resize(pos + int(end - src) + 6);
+            cursor = reinterpret_cast<uchar *>(json.data()) + pos;
+            ba_end = reinterpret_cast<const uchar *>(json.constData()) + json.size();
         }
 
+        // copy the characters that need no escaping in one go
+        while (src != run)
+            *cursor++ = uchar(*src++);
+        if (src == end)
+            break;
+
         uint u = *src++;
         if (u < 0x80) {
-            if (u < 0x20 || u == 0x22 || u == 0x5c) {
-                *cursor++ = '\\';
-                switch (u) {
-                case 0x22:
-                    *cursor++ = '"';
-                    break;
-                case 0x5c:
-                    *cursor++ = '\\';
-                    break;
-                case 0x8:
-                    *cursor++ = 'b';
-                    break;
-                case 0xc:
-                    *cursor++ = 'f';
-                    break;
-                case 0xa:
-                    *cursor++ = 'n';
-                    break;
-                case 0xd:
-                    *cursor++ = 'r';
-                    break;
-                case 0x9:
-                    *cursor++ = 't';
-                    break;
-                default:
-                    *cursor++ = 'u';
-                    *cursor++ = '0';
-                    *cursor++ = '0';
-                    *cursor++ = hexdig(u>>4);
-                    *cursor++ = hexdig(u & 0xf);
-               }
-            } else {
-                *cursor++ = (uchar)u;
-            }
+            cursor = escapeAscii(cursor, u);
         } else if (QUtf8Functions::toUtf8<QUtf8BaseTraits>(u, cursor, src, end) < 0) {
             // failed to get valid utf8 use JSON escape sequence
             *cursor++ = '\\';
@@ -123,8 +143,51 @@ static QByteArray escapedString(const QString &s)
         }
     }
 
-    ba.resize(cursor - (const uchar *)ba.constData());
-    return ba;
+    json.resize(cursor - reinterpret_cast<const uchar *>(json.constData()));
+}
+
+static void escapedString(QByteArray &json, QLatin1String s)
+{
+    const char *src = s.data();
+    const char *const end = src + s.size();
+
+    while (src != end) {
+        const char *run = src;
+        while (run != end && isPlainAscii(uchar(*run)))
+            ++run;
+        json.append(src, int(run - src));
+        if (run == end)
+            break;
+
+        uchar buffer[6];
+        uchar *cursor = buffer;
+        const uint u = uchar(*run);
+        if (u < 0x80) {
+            cursor = escapeAscii(cursor, u);
+        } else {
+            *cursor++ = 0xc0 | uchar(u >> 6);
+            *cursor++ = 0x80 | uchar(u & 0x3f);
+        }
+        json.append(reinterpret_cast<const char *>(buffer), int(cursor - buffer));
+        src = run + 1;
+    }
+}
+
+// appends the string at index idx of the container, quoted and escaped,
+// reading it straight from the container's storage
+static void stringToJson(const QCborContainerPrivate *d, qsizetype idx, QByteArray &json)
+{
+    json += '"';
+    const QtCbor::Element &e = d->elements.at(idx);
+    if (const QtCbor::ByteData *b = d->byteData(e)) {
+        if (e.flags & QtCbor::Element::StringIsUtf16)
+            escapedString(json, b->asStringView());
+        else if (e.flags & QtCbor::Element::StringIsAscii)
+            escapedString(json, b->asLatin1());
+        else
+            escapedString(json, b->toUtf8String());
+    }
+    json += '"';
 }
 
 static void valueToJson(const QCborValue &v, QByteArray &json, int indent, bool compact)
@@ -151,21 +214,21 @@ static void valueToJson(const QCborValue &v, QByteArray &json, int indent, bool
     }
     case QCborValue::String:
         json += '"';
-        json += escapedString(v.toString());
+        escapedString(json, v.toString());
         json += '"';
         break;
     case QCborValue::Array:
         json += compact ? "[" : "[\n";
         arrayContentToJson(
                 QJsonPrivate::Value::container(v), json, indent + (compact ? 0 : 1), compact);
-        json += QByteArray(4*indent, ' ');
+        json.append(4*indent, ' ');
         json += ']';
         break;
     case QCborValue::Map:
         json += compact ? "{" : "{\n";
         objectContentToJson(
                 QJsonPrivate::Value::container(v), json, indent + (compact ? 0 : 1), compact);
-        json += QByteArray(4*indent, ' ');
+        json.append(4*indent, ' ');
         json += '}';
         break;
     case QCborValue::Null:
@@ -184,7 +247,10 @@ static void arrayContentToJson(const QCborContainerPrivate *a, QByteArray &json,
     qsizetype i = 0;
     while (true) {
         json += indentString;
-        valueToJson(a->valueAt(i), json, indent, compact);
+        if (a->elements.at(i).type == QCborValue::String)
+            stringToJson(a, i, json);
+        else
+            valueToJson(a->valueAt(i), json, indent, compact);
 
         if (++i == a->elements.size()) {
             if (!compact)
@@ -206,12 +272,13 @@ static void objectContentToJson(const QCborContainerPrivate *o, QByteArray &json
 
     qsizetype i = 0;
     while (true) {
-        QCborValue e = o->valueAt(i);
         json += indentString;
-        json += '"';
-        json += escapedString(o->valueAt(i).toString());
-        json += compact ? "\":" : "\": ";
-        valueToJson(o->valueAt(i + 1), json, indent, compact);
+        stringToJson(o, i, json);
+        json += compact ? ":" : ": ";
+        if (o->elements.at(i + 1).type == QCborValue::String)
+            stringToJson(o, i + 1, json);
+        else
+            valueToJson(o->valueAt(i + 1), json, indent, compact);
 
         if ((i += 2) == o->elements.size()) {
             if (!compact)
@@ -228,7 +295,7 @@ void Writer::objectToJson(const QCborContainerPrivate *o, QByteArray &json, int
     json.reserve(json.size() + (o ? (int)o->elements.size() : 16));
     json += compact ? "{" : "{\n";
     objectContentToJson(o, json, indent + (compact ? 0 : 1), compact);
-    json += QByteArray(4*indent, ' ');
+    json.append(4*indent, ' ');
     json += compact ? "}" : "}\n";
 }
 
@@ -237,7 +304,7 @@ void Writer::arrayToJson(const QCborContainerPrivate *a, QByteArray &json, int i
     json.reserve(json.size() + (a ? (int)a->elements.size() : 16));
     json += compact ? "[" : "[\n";
     arrayContentToJson(a, json, indent + (compact ? 0 : 1), compact);
-    json += QByteArray(4*indent, ' ');
+    json.append(4*indent, ' ');
     json += compact ? "]" : "]\n";
 }
 
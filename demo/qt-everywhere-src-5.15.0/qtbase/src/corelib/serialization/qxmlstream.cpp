@@ -1145,6 +1145,33 @@ bool QXmlStreamReaderPrivate::scanAttType()
     return false;
 }
 
+/*
+  Characters that need no special handling inside character data and
+  literals: not whitespace or a control character, not a noncharacter,
+  and not markup. Runs of them are appended to textBuffer in one go
+  instead of going through getChar() one at a time.
+*/
+static inline bool isPlainContentChar(ushort c)
+{
+    return c > ' ' && c < 0xfffe && c != '<' && c != '&' && c != ']';
+}
+
+static inline bool isPlainLiteralChar(ushort c)
+{
+    return c > ' ' && c < 0xfffe && c != '<' && c != '&' && c != '"' && c != '\'';
+}
+
+template <bool (*IsPlain)(ushort)>
+static inline int plainRunLength(const QString &buffer, int from)
+{
+    const ushort *begin = reinterpret_cast<const ushort *>(buffer.constData()) + from;
+    const ushort *end = reinterpret_cast<const ushort *>(buffer.constData()) + buffer.size();
+    const ushort *p = begin;
+    while (p < end && IsPlain(*p))
+        ++p;
+    return int(p - begin);
+}
+
 /*!
  \internal
 
@@ -1161,7 +1188,17 @@ inline int QXmlStreamReaderPrivate::fastScanLiteralContent()
 {
     int n = 0;
     uint c;
-    while ((c = getChar()) != StreamEOF) {
+    forever {
+        if (putStack.isEmpty()) {
+            const int run = plainRunLength<isPlainLiteralChar>(readBuffer, readBufferPos);
+            if (run) {
+                textBuffer.append(readBuffer.constData() + readBufferPos, run);
+                readBufferPos += run;
+                n += run;
+            }
+        }
+        if ((c = getChar()) == StreamEOF)
+            break;
         switch (ushort(c)) {
         case 0xfffe:
         case 0xffff:
@@ -1244,7 +1281,18 @@ inline int QXmlStreamReaderPrivate::fastScanContentCharList()
 {
     int n = 0;
     uint c;
-    while ((c = getChar()) != StreamEOF) {
+    forever {
+        if (putStack.isEmpty()) {
+            const int run = plainRunLength<isPlainContentChar>(readBuffer, readBufferPos);
+            if (run) {
+                isWhitespace = false;
+                textBuffer.append(readBuffer.constData() + readBufferPos, run);
+                readBufferPos += run;
+                n += run;
+            }
+        }
+        if ((c = getChar()) == StreamEOF)
+            break;
         switch (ushort(c)) {
         case 0xfffe:
         case 0xffff:
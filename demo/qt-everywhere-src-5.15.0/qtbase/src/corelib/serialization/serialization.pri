@@ -13,10 +13,12 @@ HEADERS += \
     serialization/qjson_p.h \
     serialization/qjsondocument.h \
     serialization/qjsonobject.h \
+    serialization/qjsonstreamreader.h \
     serialization/qjsonvalue.h \
     serialization/qjsonarray.h \
     serialization/qjsonwriter_p.h \
     serialization/qjsonparser_p.h \
+    serialization/qjsontape_p.h \
     serialization/qtextstream.h \
     serialization/qtextstream_p.h \
     serialization/qxmlstream.h \
@@ -31,10 +33,12 @@ SOURCES += \
     serialization/qjsoncbor.cpp \
     serialization/qjsondocument.cpp \
     serialization/qjsonobject.cpp \
+    serialization/qjsonstreamreader.cpp \
     serialization/qjsonarray.cpp \
     serialization/qjsonvalue.cpp \
     serialization/qjsonwriter.cpp \
     serialization/qjsonparser.cpp \
+    serialization/qjsontape.cpp \
     serialization/qtextstream.cpp \
     serialization/qxmlstream.cpp \
     serialization/qxmlutils.cpp
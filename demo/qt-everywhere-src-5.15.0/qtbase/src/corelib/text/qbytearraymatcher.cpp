@@ -39,6 +39,8 @@
 
 #include "qbytearraymatcher.h"
 
+#include <private/qsimd_p.h>
+
 #include <limits.h>
 
 QT_BEGIN_NAMESPACE
@@ -236,14 +238,50 @@ static int findChar(const char *str, int len, char ch, int from)
     if (from < 0)
         from = qMax(from + len, 0);
     if (from < len) {
-        const uchar *n = s + from - 1;
-        const uchar *e = s + len;
-        while (++n != e)
-            if (*n == c)
-                return  n - s;
+        const uchar *n = static_cast<const uchar *>(memchr(s + from, c, len - from));
+        if (n)
+            return n - s;
+    }
+    return -1;
+}
+
+#ifdef __SSE2__
+/*!
+    \internal
+
+    Compares the first and the last byte of the needle against 16
+    candidate positions at a time and only verifies the positions
+    where both match. \a needleLen must be at least 2.
+ */
+static int qFindByteArraySse2(
+    const char *haystack0, int haystackLen, int from,
+    const char *needle, int needleLen)
+{
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[needleLen - 1]);
+    const char *haystack = haystack0 + from;
+    const char *end = haystack0 + (haystackLen - needleLen);
+
+    for ( ; end - haystack >= 15; haystack += 16) {
+        const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack));
+        const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + needleLen - 1));
+        uint mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst),
+                                                    _mm_cmpeq_epi8(last, blockLast)));
+        while (mask) {
+            const int i = qCountTrailingZeroBits(mask);
+            if (memcmp(haystack + i + 1, needle + 1, needleLen - 2) == 0)
+                return haystack - haystack0 + i;
+            mask &= mask - 1;
+        }
+    }
+
+    for ( ; haystack <= end; ++haystack) {
+        if (*haystack == *needle && memcmp(haystack + 1, needle + 1, needleLen - 1) == 0)
+            return haystack - haystack0;
     }
     return -1;
 }
+#endif
 
 /*!
     \internal
@@ -295,6 +333,14 @@ int qFindByteArray(
         return qFindByteArrayBoyerMoore(haystack0, haystackLen, from,
                                         needle, needleLen);
 
+#ifdef __SSE2__
+    /*
+      Short haystacks or short needles keep the worst case of a
+      first/last byte filter bounded, so prefer it to hashing.
+    */
+    return qFindByteArraySse2(haystack0, haystackLen, from, needle, needleLen);
+#else
+
     /*
       We use some hashing for efficiency's sake. Instead of
       comparing strings, we compare the hash value of str with that
@@ -321,6 +367,7 @@ int qFindByteArray(
         ++haystack;
     }
     return -1;
+#endif
 }
 
 /*!
@@ -277,6 +277,94 @@ void qt_doubleToAscii(double d, QLocaleData::DoubleForm form, int precision, cha
         --length;
 }
 
+/*
+    Plain decimal numbers with at most 15 significant digits and a power of
+    ten of at most 22 (e.g. "12.5", "-0.0031", "6.02e3") are converted
+    directly: both the digits and the power of ten are exactly representable
+    as doubles, so a single IEEE 754 multiplication or division yields the
+    correctly rounded result (Clinger's fast path). Anything else falls back
+    to the full conversion.
+*/
+static bool qt_asciiToDoubleFastPath(const char *num, int numLen, double &d)
+{
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    static const double powersOfTen[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const int maxExponent = int(sizeof(powersOfTen) / sizeof(powersOfTen[0])) - 1;
+
+    const char *p = num;
+    const char *const end = num + numLen;
+
+    bool negative = false;
+    if (p != end && (*p == '-' || *p == '+'))
+        negative = (*p++ == '-');
+
+    quint64 mantissa = 0;
+    int significantDigits = 0;
+    int exponent = 0;
+
+    const char *digitsStart = p;
+    for (; p != end && *p >= '0' && *p <= '9'; ++p) {
+        if (mantissa == 0 && *p == '0')
+            continue;
+        if (++significantDigits > 15)
+            return false;
+        mantissa = mantissa * 10 + (*p - '0');
+    }
+    if (p == digitsStart)
+        return false;
+
+    if (p != end && *p == '.') {
+        digitsStart = ++p;
+        for (; p != end && *p >= '0' && *p <= '9'; ++p) {
+            --exponent;
+            if (mantissa == 0 && *p == '0')
+                continue;
+            if (++significantDigits > 15)
+                return false;
+            mantissa = mantissa * 10 + (*p - '0');
+        }
+        if (p == digitsStart)
+            return false;
+    }
+
+    if (p != end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        bool negativeExponent = false;
+        if (p != end && (*p == '-' || *p == '+'))
+            negativeExponent = (*p++ == '-');
+        digitsStart = p;
+        int explicitExponent = 0;
+        for (; p != end && *p >= '0' && *p <= '9'; ++p) {
+            if (p - digitsStart == 4)
+                return false;
+            explicitExponent = explicitExponent * 10 + (*p - '0');
+        }
+        if (p == digitsStart)
+            return false;
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+
+    if (p != end || exponent < -maxExponent || exponent > maxExponent)
+        return false;
+
+    double value = double(mantissa);
+    if (exponent < 0)
+        value /= powersOfTen[-exponent];
+    else
+        value *= powersOfTen[exponent];
+    d = negative ? -value : value;
+    return true;
+#else
+    Q_UNUSED(num);
+    Q_UNUSED(numLen);
+    Q_UNUSED(d);
+    return false;
+#endif
+}
+
 double qt_asciiToDouble(const char *num, int numLen, bool &ok, int &processed,
                         StrayCharacterMode strayCharMode)
 {
@@ -314,6 +402,11 @@ double qt_asciiToDouble(const char *num, int numLen, bool &ok, int &processed,
     }
 
     double d = 0.0;
+    if (qt_asciiToDoubleFastPath(num, numLen, d)) {
+        processed = numLen;
+        return d;
+    }
+
 #if !defined(QT_NO_DOUBLECONVERSION) && !defined(QT_BOOTSTRAPPED)
     int conv_flags = double_conversion::StringToDoubleConverter::NO_FLAGS;
     if (strayCharMode == TrailingJunkAllowed) {
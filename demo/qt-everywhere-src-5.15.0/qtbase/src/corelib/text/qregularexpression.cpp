@@ -51,6 +51,8 @@
 #include <QtCore/qglobal.h>
 #include <QtCore/qatomic.h>
 #include <QtCore/qdatastream.h>
+#include <QtCore/qcache.h>
+#include <QtCore/private/qlocking_p.h>
 
 #define PCRE2_CODE_UNIT_WIDTH 16
 
@@ -840,6 +842,51 @@ static int convertToPcreOptions(QRegularExpression::MatchOptions matchOptions)
     return options;
 }
 
+struct QRegularExpressionPatternKey
+{
+    QString pattern;
+    QRegularExpression::PatternOptions patternOptions;
+};
+
+static bool operator==(const QRegularExpressionPatternKey &key1, const QRegularExpressionPatternKey &key2)
+{
+    return key1.pattern == key2.pattern && key1.patternOptions == key2.patternOptions;
+}
+
+static uint qHash(const QRegularExpressionPatternKey &key, uint seed = 0) noexcept
+{
+    QtPrivate::QHashCombine hash;
+    seed = hash(seed, key.pattern);
+    seed = hash(seed, int(key.patternOptions));
+    return seed;
+}
+
+/*
+    A compiled (and possibly JIT-compiled) PCRE2 pattern, shared by all the
+    QRegularExpressionPrivate objects using the same pattern and options.
+    A compiled pattern is read-only, so it can be matched against from any
+    number of threads at the same time.
+*/
+struct QRegularExpressionCompiledPattern
+{
+    QRegularExpressionCompiledPattern(const QRegularExpressionPatternKey &key, pcre2_code_16 *code)
+        : ref(1), key(key), code(code)
+    {
+    }
+
+    ~QRegularExpressionCompiledPattern()
+    {
+        pcre2_code_free_16(code);
+    }
+
+    QAtomicInt ref;
+    const QRegularExpressionPatternKey key;
+    pcre2_code_16 * const code;
+
+private:
+    Q_DISABLE_COPY(QRegularExpressionCompiledPattern)
+};
+
 struct QRegularExpressionPrivate : QSharedData
 {
     QRegularExpressionPrivate();
@@ -880,6 +927,7 @@ struct QRegularExpressionPrivate : QSharedData
     // objects themselves; when the private is copied (i.e. a detach happened)
     // it is set to nullptr
     pcre2_code_16 *compiledPattern;
+    QRegularExpressionCompiledPattern *sharedPattern;
     int errorCode;
     int errorOffset;
     int capturingCount;
@@ -948,6 +996,7 @@ QRegularExpressionPrivate::QRegularExpressionPrivate()
       pattern(),
       mutex(),
       compiledPattern(nullptr),
+      sharedPattern(nullptr),
       errorCode(0),
       errorOffset(-1),
       capturingCount(0),
@@ -979,6 +1028,7 @@ QRegularExpressionPrivate::QRegularExpressionPrivate(const QRegularExpressionPri
       pattern(other.pattern),
       mutex(),
       compiledPattern(nullptr),
+      sharedPattern(nullptr),
       errorCode(0),
       errorOffset(-1),
       capturingCount(0),
@@ -987,12 +1037,82 @@ QRegularExpressionPrivate::QRegularExpressionPrivate(const QRegularExpressionPri
 {
 }
 
+/*
+    Compiled patterns that are in use are kept in usedPatterns; when the last
+    QRegularExpression using one goes away (or changes its pattern), the
+    compiled pattern is moved to the bounded unusedPatterns cache, so that
+    building the same regular expression again does not need to compile and
+    JIT-compile it again.
+*/
+struct QRegularExpressionPatternCache
+{
+    typedef QHash<QRegularExpressionPatternKey, QRegularExpressionCompiledPattern *> UsedPatterns;
+    typedef QCache<QRegularExpressionPatternKey, QRegularExpressionCompiledPattern> UnusedPatterns;
+    UsedPatterns usedPatterns;
+    UnusedPatterns unusedPatterns;
+};
+Q_GLOBAL_STATIC(QRegularExpressionPatternCache, patternCache)
+static QBasicMutex patternCacheMutex;
+
+/*!
+    \internal
+
+    Returns the shared compiled pattern for \a key, with its reference count
+    incremented. If there is none, and \a code is not null, a new shared
+    compiled pattern taking ownership of \a code is returned; if there is one
+    already, \a code is freed. Returns nullptr if \a code is null and the
+    pattern is not known.
+*/
+static QRegularExpressionCompiledPattern *acquireCompiledPattern(const QRegularExpressionPatternKey &key,
+                                                                 pcre2_code_16 *code)
+{
+    const auto locker = qt_scoped_lock(patternCacheMutex);
+    QRegularExpressionPatternCache *c = patternCache();
+    if (!c)
+        return code ? new QRegularExpressionCompiledPattern(key, code) : nullptr;
+
+    QRegularExpressionCompiledPattern *compiled = c->unusedPatterns.take(key);
+    if (!compiled)
+        compiled = c->usedPatterns.value(key);
+
+    if (compiled) {
+        compiled->ref.ref();
+        pcre2_code_free_16(code);
+    } else if (code) {
+        compiled = new QRegularExpressionCompiledPattern(key, code);
+    } else {
+        return nullptr;
+    }
+
+    c->usedPatterns.insert(key, compiled);
+    return compiled;
+}
+
+/*!
+    \internal
+*/
+static void releaseCompiledPattern(QRegularExpressionCompiledPattern *compiled)
+{
+    const auto locker = qt_scoped_lock(patternCacheMutex);
+    if (compiled->ref.deref())
+        return;
+
+    if (QRegularExpressionPatternCache *c = patternCache()) {
+        c->usedPatterns.remove(compiled->key);
+        c->unusedPatterns.insert(compiled->key, compiled, 4 + compiled->key.pattern.length() / 4);
+    } else {
+        delete compiled;
+    }
+}
+
 /*!
     \internal
 */
 void QRegularExpressionPrivate::cleanCompiledPattern()
 {
-    pcre2_code_free_16(compiledPattern);
+    if (sharedPattern)
+        releaseCompiledPattern(sharedPattern);
+    sharedPattern = nullptr;
     compiledPattern = nullptr;
     errorCode = 0;
     errorOffset = -1;
@@ -1013,26 +1133,36 @@ void QRegularExpressionPrivate::compilePattern()
     isDirty = false;
     cleanCompiledPattern();
 
-    int options = convertToPcreOptions(patternOptions);
-    options |= PCRE2_UTF;
+    const QRegularExpressionPatternKey key = { pattern, patternOptions };
+    sharedPattern = acquireCompiledPattern(key, nullptr);
 
-    PCRE2_SIZE patternErrorOffset;
-    compiledPattern = pcre2_compile_16(pattern.utf16(),
-                                       pattern.length(),
-                                       options,
-                                       &errorCode,
-                                       &patternErrorOffset,
-                                       nullptr);
+    if (!sharedPattern) {
+        int options = convertToPcreOptions(patternOptions);
+        options |= PCRE2_UTF;
 
-    if (!compiledPattern) {
-        errorOffset = static_cast<int>(patternErrorOffset);
-        return;
-    } else {
-        // ignore whatever PCRE2 wrote into errorCode -- leave it to 0 to mean "no error"
-        errorCode = 0;
+        PCRE2_SIZE patternErrorOffset;
+        compiledPattern = pcre2_compile_16(pattern.utf16(),
+                                           pattern.length(),
+                                           options,
+                                           &errorCode,
+                                           &patternErrorOffset,
+                                           nullptr);
+
+        if (!compiledPattern) {
+            errorOffset = static_cast<int>(patternErrorOffset);
+            return;
+        } else {
+            // ignore whatever PCRE2 wrote into errorCode -- leave it to 0 to mean "no error"
+            errorCode = 0;
+        }
+
+        // compiled and JIT-compiled without holding the cache lock; if another
+        // thread got there first, we end up using its pattern instead
+        optimizePattern();
+        sharedPattern = acquireCompiledPattern(key, compiledPattern);
     }
 
-    optimizePattern();
+    compiledPattern = sharedPattern->code;
     getPatternInfo();
 }
 
@@ -0,0 +1,184 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qstringpool_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QStringPool
+    \inmodule QtCore
+    \since 5.16
+
+    \brief The QStringPool class shares the storage of equal strings.
+
+    Data sets that hold many copies of the same few strings, like the
+    values of an enum-like column in a model or the keys of parsed
+    documents, pay for a separate allocation for each copy. intern()
+    returns a QString that shares its data with every other string of the
+    same contents interned in the pool, so each distinct string is stored
+    only once.
+
+    The pool is thread-safe. It is split into stripes, each with its own
+    mutex, which are selected by the hash of the string, so concurrent
+    lookups of different strings rarely contend.
+
+    Strings stay in the pool until removeUnused() or clear() is called, or
+    the pool is destroyed. The strings returned by intern() remain valid
+    regardless.
+*/
+
+/*!
+    Returns a string equal to \a str that shares its data with all strings
+    of the same contents previously returned by this pool.
+
+    If the pool does not yet contain such a string, \a str itself is
+    stored, unless it refers to raw or static data or has spare capacity,
+    in which case a compact deep copy is stored and returned instead.
+*/
+QString QStringPool::intern(const QString &str)
+{
+    if (str.isEmpty())
+        return str;
+
+    Stripe &stripe = m_stripes[stripeIndex(str)];
+    QMutexLocker locker(&stripe.mutex);
+    const auto it = stripe.strings.constFind(str);
+    if (it != stripe.strings.cend())
+        return *it;
+
+    // Raw and static data report no capacity, so this also avoids keeping
+    // references to foreign memory, besides dropping the slack of a string
+    // that was built by appending
+    if (str.capacity() != str.size())
+        return *stripe.strings.insert(QString(str.constData(), str.size()));
+    return *stripe.strings.insert(str);
+}
+
+/*!
+    \overload
+
+    Returns an interned string equal to \a str. Lookups of strings that are
+    already in the pool do not allocate.
+*/
+QString QStringPool::intern(QStringView str)
+{
+    if (str.isEmpty())
+        return str.toString();
+
+    const QString key = QString::fromRawData(str.data(), int(str.size()));
+    Stripe &stripe = m_stripes[stripeIndex(str)];
+    QMutexLocker locker(&stripe.mutex);
+    const auto it = stripe.strings.constFind(key);
+    if (it != stripe.strings.cend())
+        return *it;
+    return *stripe.strings.insert(str.toString());
+}
+
+/*!
+    \overload
+
+    Returns an interned string equal to \a str.
+*/
+QString QStringPool::intern(QLatin1String str)
+{
+    return intern(QString(str));
+}
+
+/*!
+    Returns \c true if a string equal to \a str has been interned in this
+    pool.
+*/
+bool QStringPool::contains(QStringView str) const
+{
+    const QString key = QString::fromRawData(str.data(), int(str.size()));
+    const Stripe &stripe = m_stripes[stripeIndex(str)];
+    QMutexLocker locker(&stripe.mutex);
+    return stripe.strings.contains(key);
+}
+
+/*!
+    Returns the number of distinct strings in the pool.
+*/
+qsizetype QStringPool::size() const
+{
+    qsizetype result = 0;
+    for (const Stripe &stripe : m_stripes) {
+        QMutexLocker locker(&stripe.mutex);
+        result += stripe.strings.size();
+    }
+    return result;
+}
+
+/*!
+    Removes the strings that are no longer referenced outside the pool and
+    returns how many were removed.
+*/
+qsizetype QStringPool::removeUnused()
+{
+    qsizetype removed = 0;
+    for (Stripe &stripe : m_stripes) {
+        QMutexLocker locker(&stripe.mutex);
+        for (auto it = stripe.strings.begin(); it != stripe.strings.end(); ) {
+            if (it->isDetached()) {
+                it = stripe.strings.erase(it);
+                ++removed;
+            } else {
+                ++it;
+            }
+        }
+    }
+    return removed;
+}
+
+/*!
+    Removes all strings from the pool. Strings previously returned by
+    intern() are not affected.
+*/
+void QStringPool::clear()
+{
+    for (Stripe &stripe : m_stripes) {
+        QMutexLocker locker(&stripe.mutex);
+        stripe.strings.clear();
+    }
+}
+
+QT_END_NAMESPACE
@@ -22,6 +22,7 @@ HEADERS +=  \
         text/qstringiterator_p.h \
         text/qstringlist.h \
         text/qstringliteral.h \
+        text/qstringpool_p.h \
         text/qstringmatcher.h \
         text/qstringview.h \
         text/qtextboundaryfinder.h \
@@ -40,6 +41,7 @@ SOURCES += \
         text/qstring.cpp \
         text/qstringbuilder.cpp \
         text/qstringlist.cpp \
+        text/qstringpool.cpp \
         text/qstringview.cpp \
         text/qtextboundaryfinder.cpp \
         text/qunicodetools.cpp \
@@ -45,6 +45,11 @@
 #include <QtCore/qfutureinterface.h>
 #include <QtCore/qstring.h>
 
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
 QT_REQUIRE_CONFIG(future);
 
 QT_BEGIN_NAMESPACE
@@ -55,6 +60,49 @@ class QFutureWatcher;
 template <>
 class QFutureWatcher<void>;
 
+namespace QtPrivate {
+
+template <typename Function, typename Argument, typename = void>
+struct ContinuationTakesArgument : std::false_type {};
+
+template <typename Function, typename Argument>
+struct ContinuationTakesArgument<Function, Argument,
+        decltype(void(std::declval<typename std::decay<Function>::type &>()(std::declval<Argument>())))>
+    : std::true_type {};
+
+// A continuation takes either the finished QFuture<T> or its result.
+template <typename T, typename Function>
+struct ContinuationResult
+{
+    typedef ContinuationTakesArgument<Function, QFuture<T>> TakesFuture;
+    typedef typename std::conditional<TakesFuture::value, QFuture<T>, const T &>::type Argument;
+    typedef decltype(std::declval<typename std::decay<Function>::type &>()(std::declval<Argument>())) Type;
+};
+
+template <typename Function, bool TakesFuture>
+struct VoidContinuationResult
+{
+    typedef decltype(std::declval<typename std::decay<Function>::type &>()(std::declval<QFuture<void>>())) Type;
+};
+
+template <typename Function>
+struct VoidContinuationResult<Function, false>
+{
+    typedef decltype(std::declval<typename std::decay<Function>::type &>()()) Type;
+};
+
+template <typename Function>
+struct ContinuationResult<void, Function>
+{
+    typedef ContinuationTakesArgument<Function, QFuture<void>> TakesFuture;
+    typedef typename VoidContinuationResult<Function, TakesFuture::value>::Type Type;
+};
+
+template <typename T, typename Function>
+class Continuation;
+
+} // namespace QtPrivate
+
 template <typename T>
 class QFuture
 {
@@ -101,6 +149,11 @@ public:
     operator T() const { return result(); }
     QList<T> results() const { return d.results(); }
 
+    template <typename Function>
+    QFuture<typename QtPrivate::ContinuationResult<T, Function>::Type> then(Function &&function) const;
+    template <typename Function>
+    QFuture<typename QtPrivate::ContinuationResult<T, Function>::Type> then(QThreadPool *pool, Function &&function) const;
+
     class const_iterator
     {
     public:
@@ -272,6 +325,11 @@ public:
     QString progressText() const { return d.progressText(); }
     void waitForFinished() { d.waitForFinished(); }
 
+    template <typename Function>
+    QFuture<typename QtPrivate::ContinuationResult<void, Function>::Type> then(Function &&function) const;
+    template <typename Function>
+    QFuture<typename QtPrivate::ContinuationResult<void, Function>::Type> then(QThreadPool *pool, Function &&function) const;
+
 private:
     friend class QFutureWatcher<void>;
 
@@ -292,6 +350,229 @@ QFuture<void> qToVoidFuture(const QFuture<T> &future)
     return QFuture<void>(future.d);
 }
 
+namespace QtPrivate {
+
+template <typename T>
+struct ContinuationInvoker
+{
+    template <typename Function>
+    static auto invoke(Function &function, const QFuture<T> &parent) -> decltype(function(parent.result()))
+    {
+        return function(parent.result());
+    }
+};
+
+template <>
+struct ContinuationInvoker<void>
+{
+    template <typename Function>
+    static auto invoke(Function &function, const QFuture<void> &) -> decltype(function())
+    {
+        return function();
+    }
+};
+
+template <typename T>
+struct ContinuationReporter
+{
+    template <typename Call>
+    static void report(QFutureInterface<T> &promise, Call &&call) { promise.reportResult(call()); }
+};
+
+template <>
+struct ContinuationReporter<void>
+{
+    template <typename Call>
+    static void report(QFutureInterface<void> &, Call &&call) { call(); }
+};
+
+template <typename T, typename Function>
+class Continuation
+{
+    typedef ContinuationResult<T, Function> Traits;
+    typedef typename Traits::Type ResultType;
+
+public:
+    static QFuture<ResultType> create(QFutureInterfaceBase &parent, QThreadPool *pool,
+                                      Function &&function)
+    {
+        QFutureInterface<ResultType> promise;
+        promise.reportStarted();
+        const QFuture<ResultType> future = promise.future();
+
+        const auto continuation = std::make_shared<Continuation>(std::forward<Function>(function),
+                                                                 promise);
+        parent.addContinuation([continuation](const QFutureInterfaceBase &finished) {
+            continuation->run(finished);
+        }, pool);
+        return future;
+    }
+
+    Continuation(Function &&function, const QFutureInterface<ResultType> &promise)
+        : function(std::forward<Function>(function)), promise(promise)
+    { }
+
+private:
+    void run(const QFutureInterfaceBase &finished)
+    {
+        QFutureInterface<T> parentInterface(finished);
+        const QFuture<T> parent(&parentInterface);
+
+        // A continuation that takes the result is skipped for a failed or
+        // canceled future; the failure is passed on instead.
+        if (!Traits::TakesFuture::value && parent.isCanceled()) {
+#ifndef QT_NO_EXCEPTIONS
+            if (parentInterface.exceptionStore().hasException())
+                promise.reportException(*parentInterface.exceptionStore().exception().exception());
+#endif
+            promise.reportCanceled();
+            promise.reportFinished();
+            return;
+        }
+
+#ifndef QT_NO_EXCEPTIONS
+        try {
+#endif
+            ContinuationReporter<ResultType>::report(promise, [this, &parent]() {
+                return invoke(parent, typename Traits::TakesFuture());
+            });
+#ifndef QT_NO_EXCEPTIONS
+        } catch (QException &e) {
+            promise.reportException(e);
+        } catch (...) {
+            promise.reportException(QUnhandledException());
+        }
+#endif
+        promise.reportFinished();
+    }
+
+    ResultType invoke(const QFuture<T> &parent, std::true_type)
+    {
+        return function(parent);
+    }
+
+    ResultType invoke(const QFuture<T> &parent, std::false_type)
+    {
+        return ContinuationInvoker<T>::invoke(function, parent);
+    }
+
+    typename std::decay<Function>::type function;
+    QFutureInterface<ResultType> promise;
+};
+
+template <typename Future>
+struct FutureValueType;
+
+template <typename T>
+struct FutureValueType<QFuture<T>>
+{
+    typedef T Type;
+};
+
+} // namespace QtPrivate
+
+template <typename T>
+template <typename Function>
+QFuture<typename QtPrivate::ContinuationResult<T, Function>::Type> QFuture<T>::then(Function &&function) const
+{
+    return QtPrivate::Continuation<T, Function>::create(d, nullptr, std::forward<Function>(function));
+}
+
+template <typename T>
+template <typename Function>
+QFuture<typename QtPrivate::ContinuationResult<T, Function>::Type> QFuture<T>::then(QThreadPool *pool, Function &&function) const
+{
+    return QtPrivate::Continuation<T, Function>::create(d, pool, std::forward<Function>(function));
+}
+
+template <typename Function>
+QFuture<typename QtPrivate::ContinuationResult<void, Function>::Type> QFuture<void>::then(Function &&function) const
+{
+    return QtPrivate::Continuation<void, Function>::create(d, nullptr, std::forward<Function>(function));
+}
+
+template <typename Function>
+QFuture<typename QtPrivate::ContinuationResult<void, Function>::Type> QFuture<void>::then(QThreadPool *pool, Function &&function) const
+{
+    return QtPrivate::Continuation<void, Function>::create(d, pool, std::forward<Function>(function));
+}
+
+namespace QtFuture {
+
+template <typename T>
+struct WhenAnyResult
+{
+    int index;
+    QFuture<T> future;
+};
+
+template <typename InputIt>
+QFuture<QList<typename std::iterator_traits<InputIt>::value_type>> whenAll(InputIt first, InputIt last)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type Future;
+    struct Context
+    {
+        QAtomicInt remaining;
+        QList<Future> futures;
+        QFutureInterface<QList<Future>> promise;
+    };
+
+    const auto context = std::make_shared<Context>();
+    for (; first != last; ++first)
+        context->futures.append(*first);
+    context->promise.reportStarted();
+    const QFuture<QList<Future>> result = context->promise.future();
+
+    if (context->futures.isEmpty()) {
+        context->promise.reportFinished(&context->futures);
+        return result;
+    }
+
+    context->remaining.storeRelaxed(context->futures.size());
+    for (const Future &future : qAsConst(context->futures)) {
+        future.then([context](const Future &) {
+            if (!context->remaining.deref())
+                context->promise.reportFinished(&context->futures);
+        });
+    }
+    return result;
+}
+
+template <typename InputIt>
+QFuture<WhenAnyResult<typename QtPrivate::FutureValueType<typename std::iterator_traits<InputIt>::value_type>::Type>>
+whenAny(InputIt first, InputIt last)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type Future;
+    typedef WhenAnyResult<typename QtPrivate::FutureValueType<Future>::Type> Result;
+    struct Context
+    {
+        QAtomicInt done;
+        QFutureInterface<Result> promise;
+    };
+
+    const auto context = std::make_shared<Context>();
+    context->promise.reportStarted();
+    const QFuture<Result> result = context->promise.future();
+
+    if (first == last) {
+        const Result none = { -1, Future() };
+        context->promise.reportFinished(&none);
+        return result;
+    }
+
+    for (int index = 0; first != last; ++first, ++index) {
+        first->then([context, index](const Future &future) {
+            if (context->done.testAndSetRelaxed(0, 1)) {
+                const Result any = { index, future };
+                context->promise.reportFinished(&any);
+            }
+        });
+    }
+    return result;
+}
+
+} // namespace QtFuture
+
 QT_END_NAMESPACE
 
 #endif // QFUTURE_H
@@ -290,7 +290,42 @@ void QFutureInterfaceBase::reportFinished()
         switch_from_to(d->state, Running, Finished);
         d->waitCondition.wakeAll();
         d->sendCallOut(QFutureCallOutEvent(QFutureCallOutEvent::Finished));
+
+        const auto continuations = std::move(d->continuations);
+        d->continuations.clear();
+        locker.unlock();
+        for (const auto &continuation : continuations)
+            continuation(*this);
+    }
+}
+
+/*!
+    \internal
+    \since 5.16
+
+    Calls \a continuation with this future once it has finished, or right
+    away if it has finished already. With a \a pool, the continuation is
+    started on that pool instead of being called in the thread that reports
+    the future as finished.
+*/
+void QFutureInterfaceBase::addContinuation(std::function<void(const QFutureInterfaceBase &)> continuation,
+                                           QThreadPool *pool)
+{
+    if (pool) {
+        addContinuation([continuation, pool](const QFutureInterfaceBase &parent) {
+            const QFutureInterfaceBase finished(parent);
+            pool->start([continuation, finished]() { continuation(finished); });
+        });
+        return;
+    }
+
+    QMutexLocker locker(&d->m_mutex);
+    if (!isFinished()) {
+        d->continuations.append(std::move(continuation));
+        return;
     }
+    locker.unlock();
+    continuation(*this);
 }
 
 void QFutureInterfaceBase::setExpectedResultCount(int resultCount)
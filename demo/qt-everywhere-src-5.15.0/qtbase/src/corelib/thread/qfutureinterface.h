@@ -45,6 +45,7 @@
 #include <QtCore/qexception.h>
 #include <QtCore/qresultstore.h>
 
+#include <functional>
 #include <mutex>
 
 QT_REQUIRE_CONFIG(future);
@@ -86,6 +87,8 @@ public:
 
     void setRunnable(QRunnable *runnable);
     void setThreadPool(QThreadPool *pool);
+    void addContinuation(std::function<void(const QFutureInterfaceBase &)> continuation,
+                         QThreadPool *pool = nullptr);
     void setFilterMode(bool enable);
     void setProgressRange(int minimum, int maximum);
     int progressMinimum() const;
@@ -158,6 +161,11 @@ public:
     {
         refT();
     }
+    explicit QFutureInterface(const QFutureInterfaceBase &other)
+        : QFutureInterfaceBase(other)
+    {
+        refT();
+    }
     ~QFutureInterface()
     {
         if (!derefT())
@@ -284,6 +292,9 @@ public:
     explicit QFutureInterface<void>(State initialState = NoState)
         : QFutureInterfaceBase(initialState)
     { }
+    explicit QFutureInterface<void>(const QFutureInterfaceBase &other)
+        : QFutureInterfaceBase(other)
+    { }
 
     static QFutureInterface<void> canceledResult()
     { return QFutureInterface(State(Started | Finished | Canceled)); }
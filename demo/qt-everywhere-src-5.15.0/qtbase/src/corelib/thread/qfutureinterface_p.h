@@ -58,6 +58,9 @@
 #include <QtCore/qwaitcondition.h>
 #include <QtCore/qrunnable.h>
 #include <QtCore/qthreadpool.h>
+#include <QtCore/qvector.h>
+
+#include <functional>
 
 QT_REQUIRE_CONFIG(future);
 
@@ -174,6 +177,8 @@ public:
     QString m_progressText;
     QRunnable *runnable;
     QThreadPool *m_pool;
+    // run once, after the future has finished
+    QVector<std::function<void(const QFutureInterfaceBase &)>> continuations;
 
     inline QThreadPool *pool() const
     { return m_pool ? m_pool : QThreadPool::globalInstance(); }
@@ -93,6 +93,9 @@ QThreadData::~QThreadData()
     thread.storeRelease(nullptr);
     delete t;
 
+#ifndef QT_NO_QOBJECT
+    QCoreApplicationPrivate::drainLockFreePostedEvents(this);
+#endif
     for (int i = 0; i < postEventList.size(); ++i) {
         const QPostEvent &pe = postEventList.at(i);
         if (pe.event) {
@@ -102,6 +102,48 @@ inline bool operator<(const QPostEvent &first, const QPostEvent &second)
     return first.priority > second.priority;
 }
 
+// This class holds normal priority QEvent::MetaCall events posted without
+// taking QPostEventList::mutex. Any thread may push; whoever holds the mutex
+// takes all pushed entries at once and merges them into the sorted list, see
+// QCoreApplicationPrivate::drainLockFreePostedEvents().
+class QLockFreePostEventQueue
+{
+public:
+    struct Node
+    {
+        QObject *receiver;
+        QEvent *event;
+        Node *next;
+    };
+
+    void push(Node *node)
+    {
+        Node *head = m_head.loadRelaxed();
+        do {
+            node->next = head;
+        } while (!m_head.testAndSetRelease(head, node, head));
+    }
+
+    // returns the nodes in the order they were pushed
+    Node *takeAll()
+    {
+        Node *head = m_head.fetchAndStoreAcquire(nullptr);
+        Node *ordered = nullptr;
+        while (head) {
+            Node *next = head->next;
+            head->next = ordered;
+            ordered = head;
+            head = next;
+        }
+        return ordered;
+    }
+
+    bool isEmpty() const { return !m_head.loadAcquire(); }
+
+private:
+    QAtomicPointer<Node> m_head;
+};
+
 // This class holds the list of posted events.
 //  The list has to be kept sorted by priority
 class QPostEventList : public QVector<QPostEvent>
@@ -117,6 +159,9 @@ public:
 
     QMutex mutex;
 
+    // events still to be merged into the list, see QCoreApplication::postEvent()
+    QLockFreePostEventQueue lockFreeEvents;
+
     inline QPostEventList()
         : QVector<QPostEvent>(), recursion(0), startOffset(0), insertionOffset(0)
     { }
@@ -270,7 +315,7 @@ public:
     bool canWaitLocked()
     {
         QMutexLocker locker(&postEventList.mutex);
-        return canWait;
+        return canWait && postEventList.lockFreeEvents.isEmpty();
     }
 
     // This class provides per-thread (by way of being a QThreadData
@@ -57,9 +57,26 @@ public:
     void run() override;
     void registerThreadInactive();
 
+    void pushLocalRunnable(QRunnable *r);
+    QRunnable *takeLocalRunnable();
+    void releaseFinishedRunnables();
+
     QWaitCondition runnableReady;
     QThreadPoolPrivate *manager;
     QRunnable *runnable;
+
+    // Work-stealing mode. The owner pops from the back of localQueue, idle
+    // workers steal from the front. Runnables are only pushed while the pool
+    // mutex is held, so a worker that sees an empty queue under the pool mutex
+    // can safely go to sleep.
+    QMutex localMutex;
+    QQueue<QRunnable *> localQueue;
+    // auto-deleting runnables that ran without the pool mutex being held;
+    // their references are dropped in one go the next time we take it
+    QVector<QRunnable *> finishedRunnables;
+    quint64 stealCount = 0;
+
+    enum { MaxFinishedRunnables = 256 };
 };
 
 /*
@@ -106,28 +123,38 @@ void QThreadPoolThread::run()
                     throw;
                 }
 #endif
-                locker.relock();
-
-                if (autoDelete && !--r->ref)
-                    delete r;
+                if (manager->workStealing.loadRelaxed()) {
+                    if (autoDelete)
+                        finishedRunnables.append(r);
+
+                    // keep draining our own queue without touching the pool
+                    // mutex, unless prioritized work is waiting in the shared queue
+                    if (!manager->hasQueuedRunnables.loadAcquire()
+                            && finishedRunnables.size() < MaxFinishedRunnables) {
+                        r = takeLocalRunnable();
+                        if (r)
+                            continue;
+                    }
+
+                    locker.relock();
+                    releaseFinishedRunnables();
+                } else {
+                    locker.relock();
+
+                    if (autoDelete && !--r->ref)
+                        delete r;
+                    if (!finishedRunnables.isEmpty())
+                        releaseFinishedRunnables();
+                }
             }
 
             // if too many threads are active, expire this thread
             if (manager->tooManyThreadsActive())
                 break;
 
-            if (manager->queue.isEmpty()) {
-                r = nullptr;
+            r = manager->takeNextRunnable(this);
+            if (!r)
                 break;
-            }
-
-            QueuePage *page = manager->queue.first();
-            r = page->pop();
-
-            if (page->isFinished()) {
-                manager->queue.removeFirst();
-                delete page;
-            }
         } while (true);
 
         // if too many threads are active, expire this thread
@@ -146,6 +173,7 @@ void QThreadPoolThread::run()
             }
         }
         if (expired) {
+            manager->requeueLocalRunnables(this);
             manager->expiredThreads.enqueue(this);
             registerThreadInactive();
             break;
@@ -159,6 +187,49 @@ void QThreadPoolThread::registerThreadInactive()
         manager->noActiveThreads.wakeAll();
 }
 
+/*
+    \internal
+
+    Appends \a r to this thread's local queue. Must be called with the pool
+    mutex held.
+*/
+void QThreadPoolThread::pushLocalRunnable(QRunnable *r)
+{
+    QMutexLocker locker(&localMutex);
+    localQueue.append(r);
+    manager->localQueuedRunnables.ref();
+}
+
+/*
+    \internal
+
+    Pops the most recently queued runnable off this thread's local queue.
+    Only the owning thread calls this; the pool mutex need not be held.
+*/
+QRunnable *QThreadPoolThread::takeLocalRunnable()
+{
+    QMutexLocker locker(&localMutex);
+    if (localQueue.isEmpty())
+        return nullptr;
+    manager->localQueuedRunnables.deref();
+    return localQueue.takeLast();
+}
+
+/*
+    \internal
+
+    Drops the references held on auto-deleting runnables that finished while
+    the pool mutex was not held. Must be called with the pool mutex held.
+*/
+void QThreadPoolThread::releaseFinishedRunnables()
+{
+    for (QRunnable *r : qAsConst(finishedRunnables)) {
+        if (!--r->ref)
+            delete r;
+    }
+    finishedRunnables.clear();
+}
+
 
 /*
     \internal
@@ -219,11 +290,13 @@ void QThreadPoolPrivate::enqueueTask(QRunnable *runnable, int priority)
     for (QueuePage *page : qAsConst(queue)) {
         if (page->priority() == priority && !page->isFull()) {
             page->push(runnable);
+            updateQueueState();
             return;
         }
     }
     auto it = std::upper_bound(queue.constBegin(), queue.constEnd(), priority, comparePriority);
     queue.insert(std::distance(queue.constBegin(), it), new QueuePage(runnable, priority));
+    updateQueueState();
 }
 
 int QThreadPoolPrivate::activeThreadCount() const
@@ -249,6 +322,125 @@ void QThreadPoolPrivate::tryToStartMoreThreads()
             delete page;
         }
     }
+    updateQueueState();
+}
+
+/*
+    \internal
+
+    Returns the next runnable \a thread should run, or \nullptr if there is
+    none. The shared priority queue is always served first, so prioritized
+    runnables keep their ordering in work-stealing mode. After that the
+    thread's own local queue is popped (LIFO) and, failing that, a runnable
+    is stolen (FIFO) from another worker. Must be called with the mutex held.
+*/
+QRunnable *QThreadPoolPrivate::takeNextRunnable(QThreadPoolThread *thread)
+{
+    if (!queue.isEmpty()) {
+        QueuePage *page = queue.first();
+        QRunnable *r = page->pop();
+
+        if (page->isFinished()) {
+            queue.removeFirst();
+            delete page;
+        }
+        updateQueueState();
+        return r;
+    }
+
+    if (!workStealing.loadRelaxed())
+        return nullptr;
+
+    if (QRunnable *r = thread->takeLocalRunnable())
+        return r;
+    return stealRunnable(thread);
+}
+
+/*
+    \internal
+
+    Queues \a runnable on a worker's local queue. A runnable started from
+    one of our own worker threads goes to that worker's queue, anything else
+    is distributed round-robin. Falls back to the shared queue if no running
+    worker is available. Must be called with the mutex held.
+*/
+void QThreadPoolPrivate::enqueueLocalTask(QRunnable *runnable)
+{
+    Q_ASSERT(runnable != nullptr);
+
+    QThreadPoolThread *target = nullptr;
+    const QThread *current = QThread::currentThread();
+    for (QThreadPoolThread *thread : qAsConst(workers)) {
+        if (thread == current) {
+            target = thread;
+            break;
+        }
+    }
+    for (int i = 0; !target && i < workers.size(); ++i) {
+        QThreadPoolThread *candidate = workers.at(nextWorker++ % workers.size());
+        if (!expiredThreads.contains(candidate))
+            target = candidate;
+    }
+
+    if (!target) {
+        enqueueTask(runnable);
+        return;
+    }
+
+    if (runnable->autoDelete())
+        ++runnable->ref;
+    target->pushLocalRunnable(runnable);
+
+    // an idle worker will pick it up, either from its own queue or by stealing
+    if (!waitingThreads.isEmpty())
+        waitingThreads.takeFirst()->runnableReady.wakeOne();
+}
+
+/*
+    \internal
+
+    Takes the oldest runnable from the first worker after \a thief that has
+    any queued. Must be called with the mutex held.
+*/
+QRunnable *QThreadPoolPrivate::stealRunnable(QThreadPoolThread *thief)
+{
+    if (localQueuedRunnables.loadAcquire() == 0)
+        return nullptr;
+
+    const int count = workers.size();
+    const int start = workers.indexOf(thief) + 1;
+    for (int i = 0; i < count; ++i) {
+        QThreadPoolThread *victim = workers.at((start + i) % count);
+        if (victim == thief)
+            continue;
+
+        QMutexLocker locker(&victim->localMutex);
+        if (!victim->localQueue.isEmpty()) {
+            localQueuedRunnables.deref();
+            ++thief->stealCount;
+            return victim->localQueue.takeFirst();
+        }
+    }
+    return nullptr;
+}
+
+/*
+    \internal
+
+    Moves any runnables left on the local queue of \a thread to the shared
+    queue, used when the thread expires or work stealing is turned off.
+    Must be called with the mutex held.
+*/
+void QThreadPoolPrivate::requeueLocalRunnables(QThreadPoolThread *thread)
+{
+    QMutexLocker locker(&thread->localMutex);
+    while (!thread->localQueue.isEmpty()) {
+        QRunnable *r = thread->localQueue.takeFirst();
+        localQueuedRunnables.deref();
+        if (r->autoDelete())
+            --r->ref; // enqueueTask() takes its own reference
+        enqueueTask(r);
+    }
 }
 
 bool QThreadPoolPrivate::tooManyThreadsActive() const
@@ -267,6 +459,7 @@ void QThreadPoolPrivate::startThread(QRunnable *runnable)
     thread->setObjectName(QLatin1String("Thread (pooled)"));
     Q_ASSERT(!allThreads.contains(thread.data())); // if this assert hits, we have an ABA problem (deleted threads don't get removed here)
     allThreads.insert(thread.data());
+    workers.append(thread.data());
     ++activeThreads;
 
     if (runnable->autoDelete())
@@ -285,6 +478,7 @@ void QThreadPoolPrivate::reset()
     // move the contents of the set out so that we can iterate without the lock
     QSet<QThreadPoolThread *> allThreadsCopy;
     allThreadsCopy.swap(allThreads);
+    workers.clear();
     expiredThreads.clear();
     waitingThreads.clear();
     mutex.unlock();
@@ -307,10 +501,10 @@ void QThreadPoolPrivate::reset()
 */
 bool QThreadPoolPrivate::waitForDone(const QDeadlineTimer &timer)
 {
-    while (!(queue.isEmpty() && activeThreads == 0) && !timer.hasExpired())
+    while (!isIdle() && !timer.hasExpired())
         noActiveThreads.wait(&mutex, timer);
 
-    return queue.isEmpty() && activeThreads == 0;
+    return isIdle();
 }
 
 bool QThreadPoolPrivate::waitForDone(int msecs)
@@ -323,9 +517,9 @@ bool QThreadPoolPrivate::waitForDone(int msecs)
         reset();
         // More threads can be started during reset(), in that case continue
         // waiting if we still have time left.
-    } while ((!queue.isEmpty() || activeThreads) && !timer.hasExpired());
+    } while (!isIdle() && !timer.hasExpired());
 
-    return queue.isEmpty() && activeThreads == 0;
+    return isIdle();
 }
 
 void QThreadPoolPrivate::clear()
@@ -340,6 +534,17 @@ void QThreadPoolPrivate::clear()
     }
     qDeleteAll(queue);
     queue.clear();
+    updateQueueState();
+
+    for (QThreadPoolThread *thread : qAsConst(workers)) {
+        QMutexLocker localLocker(&thread->localMutex);
+        while (!thread->localQueue.isEmpty()) {
+            QRunnable *r = thread->localQueue.takeFirst();
+            localQueuedRunnables.deref();
+            if (r->autoDelete() && !--r->ref)
+                delete r;
+        }
+    }
 }
 
 /*!
@@ -374,6 +579,17 @@ bool QThreadPool::tryTake(QRunnable *runnable)
                     d->queue.removeOne(page);
                     delete page;
                 }
+                d->updateQueueState();
+                if (runnable->autoDelete())
+                    --runnable->ref; // undo ++ref in start()
+                return true;
+            }
+        }
+
+        for (QThreadPoolThread *thread : qAsConst(d->workers)) {
+            QMutexLocker localLocker(&thread->localMutex);
+            if (thread->localQueue.removeOne(runnable)) {
+                d->localQueuedRunnables.deref();
                 if (runnable->autoDelete())
                     --runnable->ref; // undo ++ref in start()
                 return true;
@@ -451,6 +667,12 @@ void QThreadPoolPrivate::stealAndRunRunnable(QRunnable *runnable)
     implementing time-consuming operations that are not visible to the
     QThreadPool.
 
+    By default all queued runnables are kept in a single queue shared by
+    every thread in the pool. When many small runnables are started on a
+    pool with many threads, that queue can become a point of contention.
+    In that case, setWorkStealingEnabled() gives each thread a queue of its
+    own; see the workStealingEnabled property for details.
+
     Note that QThreadPool is a low-level class for managing threads, see
     the Qt Concurrent module for higher level alternatives.
 
@@ -504,6 +726,11 @@ void QThreadPool::start(QRunnable *runnable, int priority)
     Q_D(QThreadPool);
     QMutexLocker locker(&d->mutex);
     if (!d->tryStart(runnable)) {
+        if (priority == 0 && d->workStealing.loadRelaxed()) {
+            d->enqueueLocalTask(runnable);
+            return;
+        }
+
         d->enqueueTask(runnable, priority);
 
         if (!d->waitingThreads.isEmpty())
@@ -698,6 +925,75 @@ uint QThreadPool::stackSize() const
     return d->stackSize;
 }
 
+/*! \property QThreadPool::workStealingEnabled
+    \since 5.16
+
+    This property holds whether the thread pool schedules runnables using
+    work stealing.
+
+    When enabled, runnables started with the default priority while all
+    threads are busy are not put on the pool's shared queue. Instead, each
+    worker thread keeps a queue of its own. A runnable started from inside
+    one of the pool's threads goes to that thread's queue, other runnables
+    are distributed across the threads. A thread runs the most recently
+    queued runnable from its own queue first and, once that queue is empty,
+    takes the oldest runnable from the queue of another thread.
+
+    Runnables started with a non-default priority are still kept in the
+    shared queue, and threads always run those before touching their own
+    queue, so the relative order of prioritized runnables is unchanged.
+    For runnables started with the default priority, the order of execution
+    is no longer first-in first-out.
+
+    Auto-deleting runnables executed from a thread's own queue may be
+    deleted a little later than in the default mode, since their deletion
+    is batched.
+
+    The default value is \c false.
+
+    \sa stealCounts()
+*/
+void QThreadPool::setWorkStealingEnabled(bool enabled)
+{
+    Q_D(QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    if (bool(d->workStealing.loadRelaxed()) == enabled)
+        return;
+
+    d->workStealing.storeRelaxed(enabled);
+    if (!enabled) {
+        for (QThreadPoolThread *thread : qAsConst(d->workers))
+            d->requeueLocalRunnables(thread);
+        d->tryToStartMoreThreads();
+    }
+}
+
+bool QThreadPool::isWorkStealingEnabled() const
+{
+    Q_D(const QThreadPool);
+    return d->workStealing.loadRelaxed();
+}
+
+/*!
+    \since 5.16
+
+    Returns, for each thread currently owned by the thread pool, the number
+    of runnables that thread has taken from the queue of another thread.
+    The counters are only updated while work stealing is enabled.
+
+    \sa workStealingEnabled
+*/
+QVector<quint64> QThreadPool::stealCounts() const
+{
+    Q_D(const QThreadPool);
+    QMutexLocker locker(&d->mutex);
+    QVector<quint64> counts;
+    counts.reserve(d->workers.size());
+    for (const QThreadPoolThread *thread : d->workers)
+        counts.append(thread->stealCount);
+    return counts;
+}
+
 /*!
     Releases a thread previously reserved by a call to reserveThread().
 
@@ -44,6 +44,7 @@
 
 #include <QtCore/qthread.h>
 #include <QtCore/qrunnable.h>
+#include <QtCore/qvector.h>
 
 #include <functional>
 
@@ -61,6 +62,7 @@ class Q_CORE_EXPORT QThreadPool : public QObject
     Q_PROPERTY(int maxThreadCount READ maxThreadCount WRITE setMaxThreadCount)
     Q_PROPERTY(int activeThreadCount READ activeThreadCount)
     Q_PROPERTY(uint stackSize READ stackSize WRITE setStackSize)
+    Q_PROPERTY(bool workStealingEnabled READ isWorkStealingEnabled WRITE setWorkStealingEnabled)
     friend class QFutureInterfaceBase;
 
 public:
@@ -86,6 +88,10 @@ public:
     void setStackSize(uint stackSize);
     uint stackSize() const;
 
+    void setWorkStealingEnabled(bool enabled);
+    bool isWorkStealingEnabled() const;
+    QVector<quint64> stealCounts() const;
+
     void reserveThread();
     void releaseThread();
 
@@ -57,6 +57,8 @@
 #include "QtCore/qwaitcondition.h"
 #include "QtCore/qset.h"
 #include "QtCore/qqueue.h"
+#include "QtCore/qvector.h"
+#include "QtCore/qatomic.h"
 #include "private/qobject_p.h"
 
 QT_REQUIRE_CONFIG(thread);
@@ -170,6 +172,17 @@ public:
     void stealAndRunRunnable(QRunnable *runnable);
     void deletePageIfFinished(QueuePage *page);
 
+    QRunnable *takeNextRunnable(QThreadPoolThread *thread);
+    void enqueueLocalTask(QRunnable *runnable);
+    QRunnable *stealRunnable(QThreadPoolThread *thief);
+    void requeueLocalRunnables(QThreadPoolThread *thread);
+    bool isIdle() const
+    {
+        return queue.isEmpty() && activeThreads == 0
+                && localQueuedRunnables.loadAcquire() == 0;
+    }
+    void updateQueueState() { hasQueuedRunnables.storeRelease(!queue.isEmpty()); }
+
     mutable QMutex mutex;
     QSet<QThreadPoolThread *> allThreads;
     QQueue<QThreadPoolThread *> waitingThreads;
@@ -177,6 +190,13 @@ public:
     QVector<QueuePage*> queue;
     QWaitCondition noActiveThreads;
 
+    // work-stealing mode: every worker owns a local queue, see QThreadPoolThread
+    QVector<QThreadPoolThread *> workers;
+    QAtomicInt hasQueuedRunnables;
+    QAtomicInt localQueuedRunnables;
+    QAtomicInt workStealing;
+    int nextWorker = 0;
+
     int expiryTimeout = 30000;
     int maxThreadCount = QThread::idealThreadCount();
     int reservedThreads = 0;
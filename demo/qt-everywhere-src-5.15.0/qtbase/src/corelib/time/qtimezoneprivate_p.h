@@ -298,6 +298,10 @@ struct QTzTimeZoneCacheEntry
     QVector<QTzTransitionRule> m_tranRules;
     QList<QByteArray> m_abbreviations;
     QByteArray m_posixRule;
+    // m_posixRule expanded once; covers every time in [from, to)
+    QVector<QTimeZonePrivate::Data> m_posixTransitions;
+    qint64 m_posixFromMSecs = 0;
+    qint64 m_posixToMSecs = 0;
 };
 
 class Q_AUTOTEST_EXPORT QTzTimeZonePrivate final : public QTimeZonePrivate
@@ -832,6 +832,25 @@ QTzTimeZoneCacheEntry QTzTimeZoneCache::findEntry(const QByteArray &ianaId)
         ret.m_tranTimes.append(tran);
     }
 
+    // Expand the POSIX rule once for the years after the last transition, so
+    // that converting recent times does not parse and expand it every time.
+    if (!ret.m_posixRule.isEmpty() && !ret.m_tranTimes.isEmpty()) {
+        const qint64 lastTranMSecs = ret.m_tranTimes.last().atMSecsSinceEpoch;
+        const int firstYear = qMax(1970, QDateTime::fromMSecsSinceEpoch(lastTranMSecs,
+                                                                        Qt::UTC).date().year());
+        const int lastYear = 2100;
+        if (firstYear + 1 < lastYear) {
+            ret.m_posixTransitions = calculatePosixTransitions(ret.m_posixRule, firstYear, lastYear,
+                                                               lastTranMSecs);
+            // getPosixTransitions() looks at the year before and after, so
+            // only times with both of those in range can use the expansion
+            ret.m_posixFromMSecs = QDateTime(QDate(firstYear + 1, 1, 1), QTime(0, 0),
+                                             Qt::UTC).toMSecsSinceEpoch();
+            ret.m_posixToMSecs = QDateTime(QDate(lastYear, 1, 1), QTime(0, 0),
+                                           Qt::UTC).toMSecsSinceEpoch();
+        }
+    }
+
     return ret;
 }
 
@@ -1008,6 +1027,11 @@ QTimeZonePrivate::Data QTzTimeZonePrivate::dataForTzTransition(QTzTransitionTime
 
 QVector<QTimeZonePrivate::Data> QTzTimeZonePrivate::getPosixTransitions(qint64 msNear) const
 {
+    // Each year of the expansion holds all transitions of that year, so the
+    // search around msNear finds the same transition in it as in the window
+    if (cached_data.m_posixFromMSecs <= msNear && msNear < cached_data.m_posixToMSecs)
+        return cached_data.m_posixTransitions;
+
     const int year = QDateTime::fromMSecsSinceEpoch(msNear, Qt::UTC).date().year();
     // The Data::atMSecsSinceEpoch of the single entry if zone is constant:
     qint64 atTime = tranCache().isEmpty() ? msNear : tranCache().last().atMSecsSinceEpoch;
@@ -40,6 +40,9 @@
 
 #include <qcryptographichash.h>
 #include <qiodevice.h>
+#ifndef QT_BOOTSTRAPPED
+#include <qfiledevice.h>
+#endif
 
 #include "../../3rdparty/sha1/sha1.cpp"
 
@@ -431,7 +434,31 @@ bool QCryptographicHash::addData(QIODevice* device)
     if (!device->isOpen())
         return false;
 
-    char buffer[1024];
+#ifndef QT_BOOTSTRAPPED
+    // Hash large files through memory mappings instead of copying them
+    // through the read buffer. Whatever could not be mapped is read below.
+    QFileDevice *file = qobject_cast<QFileDevice *>(device);
+    if (file && !file->isSequential() && !file->isTextModeEnabled()) {
+        const qint64 minimumMappedSize = 1024 * 1024;
+        // Bounded so that 32-bit address spaces are not exhausted
+        const qint64 maximumMappedSize = 64 * 1024 * 1024;
+        const qint64 size = file->size();
+        qint64 pos = file->pos();
+        while (size - pos >= minimumMappedSize) {
+            const qint64 length = qMin(size - pos, maximumMappedSize);
+            uchar *mapped = file->map(pos, length);
+            if (!mapped)
+                break;
+            addData(reinterpret_cast<const char *>(mapped), int(length));
+            file->unmap(mapped);
+            pos += length;
+        }
+        if (pos != file->pos() && !file->seek(pos))
+            return false;
+    }
+#endif
+
+    char buffer[16384];
     int length;
 
     while ((length = device->read(buffer,sizeof(buffer))) > 0)
@@ -0,0 +1,663 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QFLATHASH_P_H
+#define QFLATHASH_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qglobal.h>
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qhashfunctions.h>
+#include <QtCore/private/qsimd_p.h>
+
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include <stdlib.h>
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QFlatHashPrivate {
+
+// Each slot of the table has a control byte: Empty, Deleted, or 7 bits of
+// the hash of the key stored in it. Lookups compare a whole group
+// of control bytes at once and only look at the keys of the slots that
+// match.
+enum : signed char {
+    Empty = -128,
+    Deleted = -2
+};
+
+enum : size_t {
+    GroupSize = 16,
+    MinimumCapacity = GroupSize
+};
+
+// One bit per control byte, bit 0 for the first byte of the group.
+// The groups are unaligned: the control bytes of the first slots are
+// repeated after the last slot so a group never wraps around.
+#if defined(__SSE2__)
+inline uint matchGroup(const signed char *group, signed char h2) noexcept
+{
+    const __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2)));
+}
+
+inline uint matchGroupEmpty(const signed char *group) noexcept
+{
+    return matchGroup(group, Empty);
+}
+
+inline uint matchGroupEmptyOrDeleted(const signed char *group) noexcept
+{
+    // Empty and Deleted are the only values less than -1
+    const __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl));
+}
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+inline uint movemaskGroup(uint8x16_t v) noexcept
+{
+    const uint8x16_t bits = { 1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7,
+                              1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7 };
+    const uint8x16_t masked = vandq_u8(v, bits);
+    return vaddv_u8(vget_low_u8(masked)) | (uint(vaddv_u8(vget_high_u8(masked))) << 8);
+}
+
+inline uint matchGroup(const signed char *group, signed char h2) noexcept
+{
+    const int8x16_t ctrl = vld1q_s8(group);
+    return movemaskGroup(vceqq_s8(ctrl, vdupq_n_s8(h2)));
+}
+
+inline uint matchGroupEmpty(const signed char *group) noexcept
+{
+    return matchGroup(group, Empty);
+}
+
+inline uint matchGroupEmptyOrDeleted(const signed char *group) noexcept
+{
+    const int8x16_t ctrl = vld1q_s8(group);
+    return movemaskGroup(vcltq_s8(ctrl, vdupq_n_s8(-1)));
+}
+#else
+inline uint matchGroup(const signed char *group, signed char h2) noexcept
+{
+    uint result = 0;
+    for (size_t i = 0; i < GroupSize; ++i)
+        result |= uint(group[i] == h2) << i;
+    return result;
+}
+
+inline uint matchGroupEmpty(const signed char *group) noexcept
+{
+    return matchGroup(group, Empty);
+}
+
+inline uint matchGroupEmptyOrDeleted(const signed char *group) noexcept
+{
+    uint result = 0;
+    for (size_t i = 0; i < GroupSize; ++i)
+        result |= uint(group[i] < -1) << i;
+    return result;
+}
+#endif
+
+// qHash() for integers is the identity, so spread the bits before using
+// them: the high bits of the product select the slot and the control byte.
+inline quint64 mixHash(uint h) noexcept
+{
+    return quint64(h) * Q_UINT64_C(0x9e3779b97f4a7c15);
+}
+
+inline signed char h2(quint64 hash) noexcept
+{
+    return static_cast<signed char>(hash >> 57);
+}
+
+inline size_t h1(quint64 hash) noexcept
+{
+    return size_t(hash >> 25);
+}
+
+inline size_t maxLoad(size_t capacity) noexcept
+{
+    // 7/8 of the slots
+    return capacity - capacity / 8;
+}
+
+inline size_t capacityForSize(size_t size) noexcept
+{
+    size_t capacity = MinimumCapacity;
+    while (maxLoad(capacity) < size)
+        capacity *= 2;
+    return capacity;
+}
+
+} // namespace QFlatHashPrivate
+
+// QFlatHash is an open-addressing hash table that stores its keys and
+// values inline, in a single allocation, next to an array of one control
+// byte per slot (the "Swiss table" layout). Compared to QHash, it avoids an
+// allocation and a pointer chase per element and has about one byte of
+// overhead per slot.
+//
+// Unlike QHash it is not implicitly shared, and inserting into it
+// invalidates all iterators and references. Removing an element only
+// invalidates iterators and references to that element. It does not
+// support multiple values per key.
+template <typename Key, typename T>
+class QFlatHash
+{
+    struct Node
+    {
+        Key key;
+        T value;
+    };
+
+    signed char *m_ctrl = nullptr;
+    Node *m_nodes = nullptr;
+    size_t m_capacity = 0;
+    size_t m_size = 0;
+    size_t m_growthLeft = 0;
+    uint m_seed = 0;
+
+    enum : size_t { NotFound = ~size_t(0) };
+
+public:
+    typedef Key key_type;
+    typedef T mapped_type;
+    typedef T value_type;
+    typedef qptrdiff difference_type;
+    typedef int size_type;
+
+    QFlatHash() noexcept = default;
+    QFlatHash(std::initializer_list<std::pair<Key, T> > list)
+    {
+        reserve(int(list.size()));
+        for (const auto &entry : list)
+            insert(entry.first, entry.second);
+    }
+    QFlatHash(const QFlatHash &other)
+    {
+        copyFrom(other);
+    }
+    QFlatHash(QFlatHash &&other) noexcept
+        : m_ctrl(qExchange(other.m_ctrl, nullptr)),
+          m_nodes(qExchange(other.m_nodes, nullptr)),
+          m_capacity(qExchange(other.m_capacity, 0)),
+          m_size(qExchange(other.m_size, 0)),
+          m_growthLeft(qExchange(other.m_growthLeft, 0)),
+          m_seed(other.m_seed)
+    {
+    }
+    ~QFlatHash()
+    {
+        destroy();
+    }
+
+    QFlatHash &operator=(const QFlatHash &other)
+    {
+        if (this != &other) {
+            QFlatHash copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+    QFlatHash &operator=(QFlatHash &&other) noexcept
+    {
+        QFlatHash moved(std::move(other));
+        swap(moved);
+        return *this;
+    }
+
+    void swap(QFlatHash &other) noexcept
+    {
+        qSwap(m_ctrl, other.m_ctrl);
+        qSwap(m_nodes, other.m_nodes);
+        qSwap(m_capacity, other.m_capacity);
+        qSwap(m_size, other.m_size);
+        qSwap(m_growthLeft, other.m_growthLeft);
+        qSwap(m_seed, other.m_seed);
+    }
+
+    int size() const noexcept { return int(m_size); }
+    int count() const noexcept { return int(m_size); }
+    bool isEmpty() const noexcept { return m_size == 0; }
+    bool empty() const noexcept { return m_size == 0; }
+    int capacity() const noexcept { return int(QFlatHashPrivate::maxLoad(m_capacity)); }
+
+    void reserve(int size)
+    {
+        const size_t capacity = QFlatHashPrivate::capacityForSize(qMax(size_t(qMax(size, 0)), m_size));
+        if (capacity > m_capacity)
+            rehash(capacity);
+    }
+    void squeeze()
+    {
+        if (!m_size)
+            clear();
+        else if (QFlatHashPrivate::capacityForSize(m_size) < m_capacity)
+            rehash(QFlatHashPrivate::capacityForSize(m_size));
+    }
+    void clear()
+    {
+        destroy();
+        m_ctrl = nullptr;
+        m_nodes = nullptr;
+        m_capacity = m_size = m_growthLeft = 0;
+    }
+
+    bool contains(const Key &key) const
+    {
+        return findIndex(key) != NotFound;
+    }
+    T value(const Key &key) const
+    {
+        const size_t i = findIndex(key);
+        return i == NotFound ? T() : m_nodes[i].value;
+    }
+    T value(const Key &key, const T &defaultValue) const
+    {
+        const size_t i = findIndex(key);
+        return i == NotFound ? defaultValue : m_nodes[i].value;
+    }
+    const T operator[](const Key &key) const
+    {
+        return value(key);
+    }
+    T &operator[](const Key &key)
+    {
+        const auto result = findOrInsert(key);
+        if (!result.second)
+            new (&m_nodes[result.first]) Node{ key, T() };
+        return m_nodes[result.first].value;
+    }
+
+    class const_iterator;
+
+    class iterator
+    {
+        friend class QFlatHash;
+        friend class const_iterator;
+        QFlatHash *h = nullptr;
+        size_t i = 0;
+
+        iterator(QFlatHash *hash, size_t index) : h(hash), i(index) {}
+        void skipEmpty()
+        {
+            while (i < h->m_capacity && h->m_ctrl[i] < 0)
+                ++i;
+        }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef T *pointer;
+        typedef T &reference;
+
+        iterator() = default;
+
+        const Key &key() const { return h->m_nodes[i].key; }
+        T &value() const { return h->m_nodes[i].value; }
+        T &operator*() const { return h->m_nodes[i].value; }
+        T *operator->() const { return &h->m_nodes[i].value; }
+        bool operator==(const iterator &o) const { return i == o.i; }
+        bool operator!=(const iterator &o) const { return i != o.i; }
+
+        iterator &operator++()
+        {
+            ++i;
+            skipEmpty();
+            return *this;
+        }
+        iterator operator++(int)
+        {
+            iterator r = *this;
+            ++*this;
+            return r;
+        }
+    };
+
+    class const_iterator
+    {
+        friend class QFlatHash;
+        const QFlatHash *h = nullptr;
+        size_t i = 0;
+
+        const_iterator(const QFlatHash *hash, size_t index) : h(hash), i(index) {}
+        void skipEmpty()
+        {
+            while (i < h->m_capacity && h->m_ctrl[i] < 0)
+                ++i;
+        }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        const_iterator() = default;
+        const_iterator(const iterator &o) : h(o.h), i(o.i) {}
+
+        const Key &key() const { return h->m_nodes[i].key; }
+        const T &value() const { return h->m_nodes[i].value; }
+        const T &operator*() const { return h->m_nodes[i].value; }
+        const T *operator->() const { return &h->m_nodes[i].value; }
+        bool operator==(const const_iterator &o) const { return i == o.i; }
+        bool operator!=(const const_iterator &o) const { return i != o.i; }
+
+        const_iterator &operator++()
+        {
+            ++i;
+            skipEmpty();
+            return *this;
+        }
+        const_iterator operator++(int)
+        {
+            const_iterator r = *this;
+            ++*this;
+            return r;
+        }
+    };
+
+    iterator begin() { iterator it(this, 0); if (m_capacity) it.skipEmpty(); return it; }
+    iterator end() { return iterator(this, m_capacity); }
+    const_iterator begin() const { return constBegin(); }
+    const_iterator end() const { return constEnd(); }
+    const_iterator cbegin() const { return constBegin(); }
+    const_iterator cend() const { return constEnd(); }
+    const_iterator constBegin() const
+    {
+        const_iterator it(this, 0);
+        if (m_capacity)
+            it.skipEmpty();
+        return it;
+    }
+    const_iterator constEnd() const { return const_iterator(this, m_capacity); }
+
+    iterator find(const Key &key)
+    {
+        const size_t i = findIndex(key);
+        return i == NotFound ? end() : iterator(this, i);
+    }
+    const_iterator find(const Key &key) const { return constFind(key); }
+    const_iterator constFind(const Key &key) const
+    {
+        const size_t i = findIndex(key);
+        return i == NotFound ? constEnd() : const_iterator(this, i);
+    }
+
+    iterator insert(const Key &key, const T &value)
+    {
+        const auto result = findOrInsert(key);
+        if (result.second)
+            m_nodes[result.first].value = value;
+        else
+            new (&m_nodes[result.first]) Node{ key, value };
+        return iterator(this, result.first);
+    }
+    iterator insert(const Key &key, T &&value)
+    {
+        const auto result = findOrInsert(key);
+        if (result.second)
+            m_nodes[result.first].value = std::move(value);
+        else
+            new (&m_nodes[result.first]) Node{ key, std::move(value) };
+        return iterator(this, result.first);
+    }
+
+    iterator erase(const_iterator it)
+    {
+        Q_ASSERT(it.h == this && it.i < m_capacity && m_ctrl[it.i] >= 0);
+        eraseIndex(it.i);
+        iterator next(this, it.i);
+        ++next;
+        return next;
+    }
+    int remove(const Key &key)
+    {
+        const size_t i = findIndex(key);
+        if (i == NotFound)
+            return 0;
+        eraseIndex(i);
+        return 1;
+    }
+    T take(const Key &key)
+    {
+        const size_t i = findIndex(key);
+        if (i == NotFound)
+            return T();
+        T result = std::move(m_nodes[i].value);
+        eraseIndex(i);
+        return result;
+    }
+
+private:
+    quint64 hash(const Key &key) const
+    {
+        return QFlatHashPrivate::mixHash(qHash(key, m_seed));
+    }
+
+    void setCtrl(size_t i, signed char value) noexcept
+    {
+        m_ctrl[i] = value;
+        // keep the copy of the control bytes of the first slots in sync
+        if (i < QFlatHashPrivate::GroupSize - 1)
+            m_ctrl[m_capacity + i] = value;
+    }
+
+    size_t findIndex(const Key &key) const
+    {
+        using namespace QFlatHashPrivate;
+        if (!m_size)
+            return NotFound;
+
+        const quint64 h = hash(key);
+        const signed char tag = h2(h);
+        const size_t mask = m_capacity - 1;
+        size_t pos = h1(h) & mask;
+        for (size_t step = GroupSize; ; step += GroupSize) {
+            const signed char *group = m_ctrl + pos;
+            for (uint match = matchGroup(group, tag); match; match &= match - 1) {
+                const size_t i = (pos + qCountTrailingZeroBits(match)) & mask;
+                if (m_nodes[i].key == key)
+                    return i;
+            }
+            // the table always has empty slots, so this ends
+            if (matchGroupEmpty(group))
+                return NotFound;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    size_t findFreeSlot(quint64 h) const noexcept
+    {
+        using namespace QFlatHashPrivate;
+        const size_t mask = m_capacity - 1;
+        size_t pos = h1(h) & mask;
+        for (size_t step = GroupSize; ; step += GroupSize) {
+            if (const uint free = matchGroupEmptyOrDeleted(m_ctrl + pos))
+                return (pos + qCountTrailingZeroBits(free)) & mask;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    // Returns the slot of the key and whether it was already there. If it
+    // wasn't, the slot is marked as used but the node is not constructed.
+    std::pair<size_t, bool> findOrInsert(const Key &key)
+    {
+        const size_t i = findIndex(key);
+        if (i != NotFound)
+            return std::make_pair(i, true);
+
+        if (!m_growthLeft) {
+            // grow, unless most of the used slots are tombstones
+            using QFlatHashPrivate::maxLoad;
+            if (!m_capacity)
+                rehash(QFlatHashPrivate::MinimumCapacity);
+            else if (m_size + 1 > maxLoad(m_capacity) / 2)
+                rehash(m_capacity * 2);
+            else
+                rehash(m_capacity);
+        }
+
+        const quint64 h = hash(key);
+        const size_t slot = findFreeSlot(h);
+        if (m_ctrl[slot] == QFlatHashPrivate::Empty)
+            --m_growthLeft;
+        setCtrl(slot, QFlatHashPrivate::h2(h));
+        ++m_size;
+        return std::make_pair(slot, false);
+    }
+
+    void eraseIndex(size_t i)
+    {
+        using namespace QFlatHashPrivate;
+        m_nodes[i].~Node();
+        --m_size;
+
+        // If every group containing this slot also contains an empty slot,
+        // no lookup ever went past it and it can become empty again.
+        // Otherwise, leave a tombstone so that lookups continue probing.
+        const size_t mask = m_capacity - 1;
+        const uint emptyBefore = matchGroupEmpty(m_ctrl + ((i - GroupSize) & mask));
+        const uint emptyAfter = matchGroupEmpty(m_ctrl + i);
+        if (emptyBefore && emptyAfter
+                && qCountLeadingZeroBits(quint16(emptyBefore)) + qCountTrailingZeroBits(emptyAfter) < GroupSize) {
+            setCtrl(i, Empty);
+            ++m_growthLeft;
+        } else {
+            setCtrl(i, Deleted);
+        }
+    }
+
+    static size_t ctrlBytes(size_t capacity) noexcept
+    {
+        return (capacity + QFlatHashPrivate::GroupSize + alignof(Node) - 1) & ~(alignof(Node) - 1);
+    }
+
+    void allocate(size_t capacity)
+    {
+        char *memory = static_cast<char *>(::malloc(ctrlBytes(capacity) + capacity * sizeof(Node)));
+        Q_CHECK_PTR(memory);
+        m_ctrl = reinterpret_cast<signed char *>(memory);
+        m_nodes = reinterpret_cast<Node *>(memory + ctrlBytes(capacity));
+        memset(m_ctrl, QFlatHashPrivate::Empty, capacity + QFlatHashPrivate::GroupSize);
+        m_capacity = capacity;
+        m_growthLeft = QFlatHashPrivate::maxLoad(capacity);
+    }
+
+    void destroy() noexcept
+    {
+        if (!m_ctrl)
+            return;
+        if (QTypeInfo<Node>::isComplex) {
+            for (size_t i = 0; i < m_capacity; ++i) {
+                if (m_ctrl[i] >= 0)
+                    m_nodes[i].~Node();
+            }
+        }
+        ::free(m_ctrl);
+    }
+
+    void rehash(size_t capacity)
+    {
+        signed char *oldCtrl = m_ctrl;
+        Node *oldNodes = m_nodes;
+        const size_t oldCapacity = m_capacity;
+
+        if (!oldCapacity)
+            m_seed = uint(qGlobalQHashSeed());
+        allocate(capacity);
+        m_growthLeft -= m_size;
+
+        for (size_t i = 0; i < oldCapacity; ++i) {
+            if (oldCtrl[i] < 0)
+                continue;
+            Node &node = oldNodes[i];
+            const quint64 h = hash(node.key);
+            const size_t slot = findFreeSlot(h);
+            setCtrl(slot, QFlatHashPrivate::h2(h));
+            new (&m_nodes[slot]) Node(std::move(node));
+            node.~Node();
+        }
+        ::free(oldCtrl);
+    }
+
+    void copyFrom(const QFlatHash &other)
+    {
+        if (!other.m_size)
+            return;
+        m_seed = other.m_seed;
+        m_size = other.m_size;
+        allocate(other.m_capacity);
+        m_growthLeft = other.m_growthLeft;
+        memcpy(m_ctrl, other.m_ctrl, m_capacity + QFlatHashPrivate::GroupSize);
+        for (size_t i = 0; i < m_capacity; ++i) {
+            if (m_ctrl[i] >= 0)
+                new (&m_nodes[i]) Node(other.m_nodes[i]);
+        }
+    }
+};
+
+template <typename Key, typename T>
+inline void swap(QFlatHash<Key, T> &lhs, QFlatHash<Key, T> &rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+QT_END_NAMESPACE
+
+#endif // QFLATHASH_P_H
@@ -65,6 +65,17 @@
 
 QT_BEGIN_NAMESPACE
 
+// D-Bus codes of the basic types whose arrays can be copied in one go.
+// bool is missing on purpose: dbus_bool_t is 32 bits wide.
+template <typename T> struct QDBusFixedType;
+template <> struct QDBusFixedType<short> { enum { Code = DBUS_TYPE_INT16 }; };
+template <> struct QDBusFixedType<ushort> { enum { Code = DBUS_TYPE_UINT16 }; };
+template <> struct QDBusFixedType<int> { enum { Code = DBUS_TYPE_INT32 }; };
+template <> struct QDBusFixedType<uint> { enum { Code = DBUS_TYPE_UINT32 }; };
+template <> struct QDBusFixedType<qlonglong> { enum { Code = DBUS_TYPE_INT64 }; };
+template <> struct QDBusFixedType<qulonglong> { enum { Code = DBUS_TYPE_UINT64 }; };
+template <> struct QDBusFixedType<double> { enum { Code = DBUS_TYPE_DOUBLE }; };
+
 class QDBusMarshaller;
 class QDBusDemarshaller;
 class QDBusArgumentPrivate
@@ -143,6 +154,9 @@ public:
 
     bool appendVariantInternal(const QVariant &arg);
     bool appendRegisteredType(const QVariant &arg);
+    bool appendFixedTypeArray(const QVariant &arg);
+    template <typename T> bool appendFixedTypeArray(const QVariant &arg);
+    template <typename T> void appendFixedArray(const T *data, int count);
     bool appendCrossMarshalling(QDBusDemarshaller *arg);
 
 public:
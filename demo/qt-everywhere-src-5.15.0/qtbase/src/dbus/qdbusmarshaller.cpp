@@ -381,6 +381,63 @@ void QDBusMarshaller::error(const QString &msg)
         errorString = msg;
 }
 
+template <typename T>
+void QDBusMarshaller::appendFixedArray(const T *data, int count)
+{
+    const char signature[2] = { char(QDBusFixedType<T>::Code), 0 };
+    if (ba) {
+        if (!skipSignature) {
+            *ba += char(DBUS_TYPE_ARRAY);
+            *ba += signature;
+        }
+        return;
+    }
+
+    DBusMessageIter subiterator;
+    q_dbus_message_iter_open_container(&iterator, DBUS_TYPE_ARRAY, signature, &subiterator);
+    q_dbus_message_iter_append_fixed_array(&subiterator, QDBusFixedType<T>::Code, &data, count);
+    q_dbus_message_iter_close_container(&iterator, &subiterator);
+}
+
+template <typename T>
+bool QDBusMarshaller::appendFixedTypeArray(const QVariant &arg)
+{
+    const int id = arg.userType();
+    if (id == qMetaTypeId<QVector<T> >()) {
+        const QVector<T> &vector = *static_cast<const QVector<T> *>(arg.constData());
+        appendFixedArray(vector.constData(), vector.size());
+        return true;
+    }
+    if (id == qMetaTypeId<QList<T> >()) {
+        if (ba) {
+            appendFixedArray<T>(nullptr, 0);
+            return true;
+        }
+        // QList pads items smaller than a pointer, so copy them together first
+        const QVector<T> vector = static_cast<const QList<T> *>(arg.constData())->toVector();
+        appendFixedArray(vector.constData(), vector.size());
+        return true;
+    }
+    return false;
+}
+
+/*!
+    \internal
+    Appends \a arg in a single call to libdbus if it is a QList or QVector
+    of a fixed-size basic type, instead of marshalling every item through
+    the registered streaming operator. Returns \c false for other types.
+*/
+bool QDBusMarshaller::appendFixedTypeArray(const QVariant &arg)
+{
+    return appendFixedTypeArray<int>(arg)
+            || appendFixedTypeArray<uint>(arg)
+            || appendFixedTypeArray<double>(arg)
+            || appendFixedTypeArray<qlonglong>(arg)
+            || appendFixedTypeArray<qulonglong>(arg)
+            || appendFixedTypeArray<short>(arg)
+            || appendFixedTypeArray<ushort>(arg);
+}
+
 bool QDBusMarshaller::appendVariantInternal(const QVariant &arg)
 {
     int id = arg.userType();
@@ -495,7 +552,8 @@ bool QDBusMarshaller::appendVariantInternal(const QVariant &arg)
             return true;
 
         default:
-            ;
+            if (appendFixedTypeArray(arg))
+                return true;
         }
         Q_FALLTHROUGH();
 
@@ -269,6 +269,52 @@ bool QDBusMetaType::marshall(QDBusArgument &arg, int id, const void *data)
     return true;
 }
 
+#ifndef QT_BOOTSTRAPPED
+template <typename T>
+static bool demarshallFixedArray(const QDBusArgument &arg, int id, void *data)
+{
+    const bool isVector = id == qMetaTypeId<QVector<T> >();
+    if (!isVector && id != qMetaTypeId<QList<T> >())
+        return false;
+
+    QDBusArgument copy = arg;
+    QDBusArgumentPrivate *d = QDBusArgumentPrivate::d(copy);
+    if (!d || d->direction != QDBusArgumentPrivate::Demarshalling)
+        return false;
+
+    // read from a copy of the iterator, like the detached copy in demarshall()
+    DBusMessageIter iterator = d->demarshaller()->iterator;
+    if (q_dbus_message_iter_get_arg_type(&iterator) != DBUS_TYPE_ARRAY
+            || q_dbus_message_iter_get_element_type(&iterator) != QDBusFixedType<T>::Code)
+        return false;
+
+    DBusMessageIter sub;
+    q_dbus_message_iter_recurse(&iterator, &sub);
+    const T *values = nullptr;
+    int count = 0;
+    q_dbus_message_iter_get_fixed_array(&sub, &values, &count);
+
+    if (isVector)
+        *static_cast<QVector<T> *>(data) = QVector<T>(values, values + count);
+    else
+        *static_cast<QList<T> *>(data) = QList<T>(values, values + count);
+    return true;
+}
+
+// Reads arrays of fixed-size basic types with a single call to libdbus
+// instead of going through the streaming operators item by item.
+static bool demarshallFixedTypeArray(const QDBusArgument &arg, int id, void *data)
+{
+    return demarshallFixedArray<int>(arg, id, data)
+            || demarshallFixedArray<uint>(arg, id, data)
+            || demarshallFixedArray<double>(arg, id, data)
+            || demarshallFixedArray<qlonglong>(arg, id, data)
+            || demarshallFixedArray<qulonglong>(arg, id, data)
+            || demarshallFixedArray<short>(arg, id, data)
+            || demarshallFixedArray<ushort>(arg, id, data);
+}
+#endif
+
 /*!
     \internal
     Executes the demarshalling of type \a id (whose data will be placed in
@@ -294,6 +340,8 @@ bool QDBusMetaType::demarshall(const QDBusArgument &arg, int id, void *data)
             df = info.demarshall;
     }
 #ifndef QT_BOOTSTRAPPED
+    if (demarshallFixedTypeArray(arg, id, data))
+        return true;
     QDBusArgument copy = arg;
     df(copy, data);
 #else
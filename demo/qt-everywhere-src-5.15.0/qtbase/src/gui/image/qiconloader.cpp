@@ -50,6 +50,7 @@
 #include <QtCore/qmath.h>
 #include <QtCore/QList>
 #include <QtCore/QDir>
+#include <QtCore/QDirIterator>
 #if QT_CONFIG(settings)
 #include <QtCore/QSettings>
 #endif
@@ -328,6 +329,50 @@ QVector<const char *> QIconCacheGtkReader::lookup(const QStringRef &name)
     return ret;
 }
 
+/*
+    Index of the png and svg files in the sub directories of one theme
+    directory, used when there is no usable GTK+ cache. Listing every
+    sub directory once is far cheaper than stat-ing each candidate file
+    for every icon that is looked up.
+*/
+class QIconDirIndex
+{
+public:
+    QIconDirIndex(const QString &contentDir, const QVector<QIconDirInfo> &subDirs);
+
+    // Returns the sub directories containing iconName, encoded as
+    // (index << 1) | isSvg and sorted so that png comes before svg.
+    QVector<int> lookup(const QStringRef &iconName) const
+    { return m_files.value(iconName.toString()); }
+
+private:
+    QHash<QString, QVector<int>> m_files;
+};
+
+QIconDirIndex::QIconDirIndex(const QString &contentDir, const QVector<QIconDirInfo> &subDirs)
+{
+    const QLatin1String png(".png");
+    const QLatin1String svg(".svg");
+    for (int j = 0; j < subDirs.size(); ++j) {
+        QDirIterator it(contentDir + subDirs.at(j).path, QDir::Files);
+        while (it.hasNext()) {
+            it.next();
+            const QString fileName = it.fileName();
+            int isSvg;
+            if (fileName.endsWith(png))
+                isSvg = 0;
+            else if (fileName.endsWith(svg))
+                isSvg = 1;
+            else
+                continue;
+            m_files[fileName.left(fileName.size() - 4)].append(j << 1 | isSvg);
+        }
+    }
+    // only the png/svg pair within one directory can be out of order
+    for (auto it = m_files.begin(), end = m_files.end(); it != end; ++it)
+        std::sort(it->begin(), it->end());
+}
+
 QIconTheme::QIconTheme(const QString &themeName)
         : m_valid(false)
 {
@@ -342,6 +387,7 @@ QIconTheme::QIconTheme(const QString &themeName)
         if (themeDirInfo.isDir()) {
             m_contentDirs << themeDir;
             m_gtkCaches << QSharedPointer<QIconCacheGtkReader>::create(themeDir);
+            m_dirIndexes << QSharedPointer<QIconDirIndex>();
         }
 
         if (!m_valid) {
@@ -464,6 +510,38 @@ QThemeIconInfo QIconLoader::findIconHelper(const QString &themeName,
             }
 
             QString contentDir = contentDirs.at(i) + QLatin1Char('/');
+
+            if (!cache->isValid()) {
+                // No GTK+ cache, answer from the directory index instead of
+                // checking every sub directory on disk
+                QSharedPointer<QIconDirIndex> &index = theme.m_dirIndexes[i];
+                if (!index)
+                    index = QSharedPointer<QIconDirIndex>::create(contentDir, subDirs);
+                const QVector<int> found = index->lookup(iconNameFallback);
+                for (int k = 0; k < found.size(); ++k) {
+                    const int j = found.at(k) >> 1;
+                    const QIconDirInfo &dirInfo = subDirs.at(j);
+                    const QString subDir = contentDir + dirInfo.path + QLatin1Char('/');
+                    if (!(found.at(k) & 1)) {
+                        PixmapEntry *iconEntry = new PixmapEntry;
+                        iconEntry->dir = dirInfo;
+                        iconEntry->filename = subDir + pngIconName;
+                        // Notice we ensure that pixmap entries always come before
+                        // scalable to preserve search order afterwards
+                        info.entries.prepend(iconEntry);
+                        // a png shadows an svg of the same name
+                        if (k + 1 < found.size() && (found.at(k + 1) >> 1) == j)
+                            ++k;
+                    } else if (m_supportsSvg) {
+                        ScalableEntry *iconEntry = new ScalableEntry;
+                        iconEntry->dir = dirInfo;
+                        iconEntry->filename = subDir + svgIconName;
+                        info.entries.append(iconEntry);
+                    }
+                }
+                continue;
+            }
+
             for (int j = 0; j < subDirs.size() ; ++j) {
                 const QIconDirInfo &dirInfo = subDirs.at(j);
                 const QString subDir = contentDir + dirInfo.path + QLatin1Char('/');
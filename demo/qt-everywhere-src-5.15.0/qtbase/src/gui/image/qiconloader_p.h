@@ -149,6 +149,7 @@ private:
 };
 
 class QIconCacheGtkReader;
+class QIconDirIndex;
 
 class QIconTheme
 {
@@ -166,6 +167,7 @@ private:
     bool m_valid;
 public:
     QVector<QSharedPointer<QIconCacheGtkReader>> m_gtkCaches;
+    QVector<QSharedPointer<QIconDirIndex>> m_dirIndexes;
 };
 
 class Q_GUI_EXPORT QIconLoader
@@ -111,7 +111,8 @@ QImageData::QImageData()
       dpmx(qt_defaultDpiX() * 100 / qreal(2.54)),
       dpmy(qt_defaultDpiY() * 100 / qreal(2.54)),
       offset(0, 0), own_data(true), ro_data(false), has_alpha_clut(false),
-      is_cached(false), is_locked(false), cleanupFunction(nullptr), cleanupInfo(nullptr),
+      is_cached(false), is_locked(false), parallel_painting(false),
+      cleanupFunction(nullptr), cleanupInfo(nullptr),
       paintEngine(nullptr)
 {
 }
@@ -1114,6 +1115,7 @@ static void copyMetadata(QImageData *dst, const QImageData *src)
     copyPhysicalMetadata(dst, src);
     dst->text = src->text;
     dst->colorSpace = src->colorSpace;
+    dst->parallel_painting = src->parallel_painting;
 }
 
 static void copyMetadata(QImage *dst, const QImage &src)
@@ -1477,6 +1479,47 @@ void QImage::setDevicePixelRatio(qreal scaleFactor)
         d->devicePixelRatio = scaleFactor;
 }
 
+/*!
+    \since 5.16
+
+    Returns \c true if QPainter blends the primitives drawn onto this image
+    on several threads; otherwise returns \c false.
+
+    The default is false.
+
+    \sa setParallelPaintingEnabled()
+*/
+bool QImage::isParallelPaintingEnabled() const
+{
+    return d && d->parallel_painting;
+}
+
+/*!
+    \since 5.16
+
+    Sets whether QPainter blends the primitives drawn onto this image on
+    several threads to \a enabled.
+
+    When enabled, the raster paint engine collects the spans of each filled
+    or stroked primitive in horizontal tiles and blends the tiles in parallel
+    on QThreadPool::globalInstance(). The result is identical to painting on
+    a single thread. Only large primitives are split up, so this mainly pays
+    off for big images.
+
+    The setting takes effect the next time a QPainter is begun on the image.
+
+    \sa isParallelPaintingEnabled()
+*/
+void QImage::setParallelPaintingEnabled(bool enabled)
+{
+    if (!d || bool(d->parallel_painting) == enabled)
+        return;
+
+    detach();
+    if (d)
+        d->parallel_painting = enabled;
+}
+
 #if QT_DEPRECATED_SINCE(5, 10)
 /*!
     \since 4.6
@@ -4655,6 +4698,7 @@ QImage QImage::smoothScaled(int w, int h) const {
     case QImage::Format_RGBX8888:
 #endif
     case QImage::Format_RGBA8888_Premultiplied:
+    case QImage::Format_Grayscale8:
 #if QT_CONFIG(raster_64bit)
     case QImage::Format_RGBX64:
     case QImage::Format_RGBA64_Premultiplied:
@@ -259,6 +259,9 @@ public:
     qreal devicePixelRatio() const;
     void setDevicePixelRatio(qreal scaleFactor);
 
+    bool isParallelPaintingEnabled() const;
+    void setParallelPaintingEnabled(bool enabled);
+
     void fill(uint pixel);
     void fill(const QColor &color);
     void fill(Qt::GlobalColor color);
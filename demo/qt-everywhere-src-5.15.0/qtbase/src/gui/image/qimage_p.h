@@ -92,6 +92,7 @@ struct Q_GUI_EXPORT QImageData {        // internal image data
     uint has_alpha_clut : 1;
     uint is_cached : 1;
     uint is_locked : 1;
+    uint parallel_painting : 1;
 
     QImageCleanupFunction cleanupFunction;
     void* cleanupInfo;
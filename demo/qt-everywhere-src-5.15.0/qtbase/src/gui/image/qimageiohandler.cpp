@@ -172,6 +172,15 @@
 
     \value TransformedByDefault. A handler that reports support for this feature
     will have image transformation metadata applied by default on read.
+
+    \value ParallelWrite. A handler which supports this option is expected
+    to encode the image on several threads when writing. This option was
+    introduced in Qt 5.16.
+
+    \value ScanlineFilter. The filter a handler which supports this option
+    should apply to the scanlines before compressing them (QByteArray). For
+    PNG, this is one of "none", "sub", "up", "average", "paeth" or "adaptive".
+    This option was introduced in Qt 5.16.
 */
 
 /*! \enum QImageIOHandler::Transformation
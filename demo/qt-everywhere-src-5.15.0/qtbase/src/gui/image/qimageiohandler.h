@@ -99,6 +99,8 @@ public:
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
         , TransformedByDefault
 #endif
+        , ParallelWrite
+        , ScanlineFilter
     };
 
     enum Transformation {
@@ -146,6 +146,11 @@
 #include <qsize.h>
 #include <qcolor.h>
 #include <qvariant.h>
+#if QT_CONFIG(future)
+#include <qbuffer.h>
+#include <qfutureinterface.h>
+#include <qthreadpool.h>
+#endif
 
 // factory loader
 #include <qcoreapplication.h>
@@ -173,6 +178,12 @@ QT_BEGIN_NAMESPACE
 
 using namespace QImageReaderWriterHelpers;
 
+#if QT_CONFIG(future)
+// Kept apart from the global pool, so that decoding a large batch of images
+// does not hold up other work and small algorithms started from it
+Q_GLOBAL_STATIC(QThreadPool, imageDecodePool)
+#endif
+
 static QImageIOHandler *createReadHandlerHelper(QIODevice *device,
                                                 const QByteArray &format,
                                                 bool autoDetectImageFormat,
@@ -1361,6 +1372,99 @@ bool QImageReader::read(QImage *image)
     return true;
 }
 
+#if QT_CONFIG(future)
+/*!
+    \since 5.16
+
+    Starts reading an image on a thread pool dedicated to decoding images,
+    and returns a future that gets the image once it has been read. On
+    failure, the result is a null QImage.
+
+    The clip rect, scaled size, scaled clip rect, quality, auto transform
+    and format settings of this reader at the time of the call are used,
+    so that handlers which support it, like the JPEG handler, decode only
+    the requested region at the requested size. The reader can be changed
+    or destroyed afterwards without affecting the result.
+
+    If the reader was constructed with a file name, the file is opened and
+    read on the decoding thread. Otherwise, the remaining data of the device
+    is read on the calling thread, before this function returns; call it
+    before any other function that might read from the device.
+
+    Canceling the future before decoding has started skips the image.
+
+    \sa read(), QFuture
+*/
+QFuture<QImage> QImageReader::readAsync()
+{
+    struct Settings {
+        QString fileName;
+        QByteArray data;
+        QByteArray format;
+        bool autoDetectImageFormat;
+        bool ignoresFormatAndExtension;
+        QRect clipRect;
+        QSize scaledSize;
+        QRect scaledClipRect;
+        int quality;
+        QColor backgroundColor;
+        decltype(QImageReaderPrivate::autoTransform) autoTransform;
+    };
+
+    Settings settings;
+    settings.fileName = d->deleteDevice ? fileName() : QString();
+    if (settings.fileName.isEmpty() && d->device
+        && (d->device->isOpen() || d->device->open(QIODevice::ReadOnly))) {
+        settings.data = d->device->readAll();
+    }
+    settings.format = d->format;
+    settings.autoDetectImageFormat = d->autoDetectImageFormat;
+    settings.ignoresFormatAndExtension = d->ignoresFormatAndExtension;
+    settings.clipRect = d->clipRect;
+    settings.scaledSize = d->scaledSize;
+    settings.scaledClipRect = d->scaledClipRect;
+    settings.quality = d->quality;
+    // Only pass on what an existing handler knows, creating one would read
+    // from the device on this thread
+    if (d->handler && d->handler->supportsOption(QImageIOHandler::BackgroundColor))
+        settings.backgroundColor = qvariant_cast<QColor>(d->handler->option(QImageIOHandler::BackgroundColor));
+    settings.autoTransform = d->autoTransform;
+
+    QFutureInterface<QImage> futureInterface;
+    futureInterface.reportStarted();
+    QFuture<QImage> future = futureInterface.future();
+
+    imageDecodePool()->start([futureInterface, settings]() mutable {
+        if (!futureInterface.isCanceled()) {
+            QBuffer buffer;
+            QImageReader reader;
+            if (!settings.fileName.isEmpty()) {
+                reader.setFileName(settings.fileName);
+            } else {
+                buffer.setData(settings.data);
+                reader.setDevice(&buffer);
+            }
+            reader.d->format = settings.format;
+            reader.d->autoDetectImageFormat = settings.autoDetectImageFormat;
+            reader.d->ignoresFormatAndExtension = settings.ignoresFormatAndExtension;
+            reader.d->clipRect = settings.clipRect;
+            reader.d->scaledSize = settings.scaledSize;
+            reader.d->scaledClipRect = settings.scaledClipRect;
+            reader.d->quality = settings.quality;
+            reader.d->autoTransform = settings.autoTransform;
+            if (settings.backgroundColor.isValid())
+                reader.setBackgroundColor(settings.backgroundColor);
+
+            const QImage image = reader.read();
+            futureInterface.reportResult(image);
+        }
+        futureInterface.reportFinished();
+    });
+
+    return future;
+}
+#endif // QT_CONFIG(future)
+
 /*!
    For image formats that support animation, this function steps over the
    current image, returning true if successful or false if there is no
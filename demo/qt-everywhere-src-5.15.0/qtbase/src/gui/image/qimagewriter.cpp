@@ -255,6 +255,8 @@ public:
     QByteArray subType;
     bool optimizedWrite;
     bool progressiveScanWrite;
+    bool parallelWrite;
+    QByteArray scanlineFilter;
     QImageIOHandler::Transformations transformation;
 
     // error
@@ -277,6 +279,7 @@ QImageWriterPrivate::QImageWriterPrivate(QImageWriter *qq)
     gamma = 0.0;
     optimizedWrite = false;
     progressiveScanWrite = false;
+    parallelWrite = false;
     imageWriterError = QImageWriter::UnknownError;
     errorString = QImageWriter::tr("Unknown error");
     transformation = QImageIOHandler::TransformationNone;
@@ -626,6 +629,66 @@ bool QImageWriter::progressiveScanWrite() const
     return d->progressiveScanWrite;
 }
 
+/*!
+    \since 5.16
+
+    This is an image format-specific function which lets the handler encode
+    the image on several threads when \a parallel is true. For PNG, the image
+    data is then compressed in strips that are independent of each other,
+    which makes the file slightly larger. For image formats that do not
+    support parallel writing, this value is ignored.
+
+    The default is false.
+
+    \sa parallelWrite()
+*/
+void QImageWriter::setParallelWrite(bool parallel)
+{
+    d->parallelWrite = parallel;
+}
+
+/*!
+    \since 5.16
+
+    Returns whether the image may be encoded on several threads.
+
+    \sa setParallelWrite()
+*/
+bool QImageWriter::parallelWrite() const
+{
+    return d->parallelWrite;
+}
+
+/*!
+    \since 5.16
+
+    This is an image format-specific function which sets the \a filter that
+    is applied to the scanlines before they are compressed. For PNG, this is
+    one of "none", "sub", "up", "average", "paeth" or "adaptive", which picks
+    the best of them for every scanline. For image formats that do not
+    support scanline filters, this value is ignored.
+
+    The default is an empty byte array, which leaves the choice to the handler.
+
+    \sa scanlineFilter()
+*/
+void QImageWriter::setScanlineFilter(const QByteArray &filter)
+{
+    d->scanlineFilter = filter;
+}
+
+/*!
+    \since 5.16
+
+    Returns the scanline filter that is applied when writing the image.
+
+    \sa setScanlineFilter()
+*/
+QByteArray QImageWriter::scanlineFilter() const
+{
+    return d->scanlineFilter;
+}
+
 /*!
     \since 5.5
 
@@ -777,6 +840,10 @@ bool QImageWriter::write(const QImage &image)
         d->handler->setOption(QImageIOHandler::OptimizedWrite, d->optimizedWrite);
     if (d->handler->supportsOption(QImageIOHandler::ProgressiveScanWrite))
         d->handler->setOption(QImageIOHandler::ProgressiveScanWrite, d->progressiveScanWrite);
+    if (d->handler->supportsOption(QImageIOHandler::ParallelWrite))
+        d->handler->setOption(QImageIOHandler::ParallelWrite, d->parallelWrite);
+    if (d->handler->supportsOption(QImageIOHandler::ScanlineFilter) && !d->scanlineFilter.isEmpty())
+        d->handler->setOption(QImageIOHandler::ScanlineFilter, d->scanlineFilter);
     if (d->handler->supportsOption(QImageIOHandler::ImageTransformation))
         d->handler->setOption(QImageIOHandler::ImageTransformation, int(d->transformation));
     else
@@ -101,6 +101,12 @@ public:
     void setProgressiveScanWrite(bool progressive);
     bool progressiveScanWrite() const;
 
+    void setParallelWrite(bool parallel);
+    bool parallelWrite() const;
+
+    void setScanlineFilter(const QByteArray &filter);
+    QByteArray scanlineFilter() const;
+
     QImageIOHandler::Transformations transformation() const;
     void setTransformation(QImageIOHandler::Transformations orientation);
 
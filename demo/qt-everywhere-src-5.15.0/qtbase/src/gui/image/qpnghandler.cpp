@@ -50,6 +50,19 @@
 #include <qvector.h>
 
 #include <private/qimage_p.h> // for qt_getImageText
+#include <private/qdrawhelper_p.h>
+#include <qendian.h>
+#include <qrgba64.h>
+
+#if QT_CONFIG(thread) && !defined(QT_NO_COMPRESS)
+#include <qatomic.h>
+#include <qsemaphore.h>
+#include <qthread.h>
+#include <qthreadpool.h>
+#include <zlib.h>
+#include <limits>
+#define QT_PNG_PARALLEL_WRITE
+#endif
 
 #include <qcolorspace.h>
 #include <private/qcolorspace_p.h>
@@ -109,13 +122,15 @@ public:
     };
 
     QPngHandlerPrivate(QPngHandler *qq)
-        : gamma(0.0), fileGamma(0.0), quality(50), compression(50), colorSpaceState(Undefined), png_ptr(nullptr), info_ptr(nullptr), end_info(nullptr), state(Ready), q(qq)
+        : gamma(0.0), fileGamma(0.0), quality(50), compression(50), parallelWrite(false), colorSpaceState(Undefined), png_ptr(nullptr), info_ptr(nullptr), end_info(nullptr), state(Ready), q(qq)
     { }
 
     float gamma;
     float fileGamma;
     int quality; // quality is used for backward compatibility, maps to compression
     int compression;
+    bool parallelWrite;
+    QByteArray scanlineFilter;
     QString description;
     QSize scaledSize;
     QStringList readTexts;
@@ -172,6 +187,8 @@ public:
     void setLooping(int loops=0); // 0 == infinity
     void setFrameDelay(int msecs);
     void setGamma(float);
+    void setParallelWrite(bool parallel);
+    void setFilters(int filters); // PNG_FILTER_* mask, 0 == libpng's default
 
     bool writeImage(const QImage& img, int x, int y);
     bool writeImage(const QImage& img, int compression_in, const QString &description, int x, int y);
@@ -189,6 +206,13 @@ private:
     int looping;
     int ms_delay;
     float gamma;
+    bool parallel;
+    int filters;
+
+#ifdef QT_PNG_PARALLEL_WRITE
+    bool writeImageDataParallel(png_structp png_ptr, const QImage &image, int color_type, int bpc,
+                                int compression);
+#endif
 };
 
 extern "C" {
@@ -809,7 +833,9 @@ QPNGImageWriter::QPNGImageWriter(QIODevice* iod) :
     disposal(Unspecified),
     looping(-1),
     ms_delay(-1),
-    gamma(0.0)
+    gamma(0.0),
+    parallel(false),
+    filters(0)
 {
 }
 
@@ -837,6 +863,16 @@ void QPNGImageWriter::setGamma(float g)
     gamma = g;
 }
 
+void QPNGImageWriter::setParallelWrite(bool p)
+{
+    parallel = p;
+}
+
+void QPNGImageWriter::setFilters(int f)
+{
+    filters = f;
+}
+
 static void set_text(const QImage &image, png_structp png_ptr, png_infop info_ptr,
                      const QString &description)
 {
@@ -895,6 +931,306 @@ static void set_text(const QImage &image, png_structp png_ptr, png_infop info_pt
     delete [] text_ptr;
 }
 
+#ifdef QT_PNG_PARALLEL_WRITE
+// Converts the scanline y of image into the PNG row layout that writeImage()
+// selects for it. This follows the libpng transformations and QImage
+// conversions of the row by row path, so both write the same pixels.
+// buffer must hold image.width() uints.
+static void convertToPngRow(const QImage &image, int y, uchar *out, uint *buffer)
+{
+    const int width = image.width();
+    const uchar *src = image.constScanLine(y);
+    const QRgb *pixels = reinterpret_cast<const QRgb *>(src);
+
+    switch (image.format()) {
+    case QImage::Format_Grayscale8:
+        memcpy(out, src, width);
+        return;
+    case QImage::Format_Grayscale16: {
+        const quint16 *gray = reinterpret_cast<const quint16 *>(src);
+        for (int x = 0; x < width; ++x)
+            qToBigEndian<quint16>(gray[x], out + 2 * x);
+        return;
+    }
+    case QImage::Format_RGB888:
+        memcpy(out, src, 3 * width);
+        return;
+    case QImage::Format_BGR888:
+        for (int x = 0; x < width; ++x) {
+            out[3 * x] = src[3 * x + 2];
+            out[3 * x + 1] = src[3 * x + 1];
+            out[3 * x + 2] = src[3 * x];
+        }
+        return;
+    case QImage::Format_RGBX8888:
+        for (int x = 0; x < width; ++x)
+            memcpy(out + 3 * x, src + 4 * x, 3);
+        return;
+    case QImage::Format_RGBA8888:
+        memcpy(out, src, 4 * width);
+        return;
+    case QImage::Format_RGBX64:
+    case QImage::Format_RGBA64:
+    case QImage::Format_RGBA64_Premultiplied: {
+        const QRgba64 *rgba64 = reinterpret_cast<const QRgba64 *>(src);
+        const bool premultiplied = image.format() == QImage::Format_RGBA64_Premultiplied;
+        const bool alpha = image.format() != QImage::Format_RGBX64;
+        for (int x = 0; x < width; ++x) {
+            const QRgba64 c = premultiplied ? rgba64[x].unpremultiplied() : rgba64[x];
+            qToBigEndian<quint16>(c.red(), out);
+            qToBigEndian<quint16>(c.green(), out + 2);
+            qToBigEndian<quint16>(c.blue(), out + 4);
+            out += 6;
+            if (alpha) {
+                qToBigEndian<quint16>(c.alpha(), out);
+                out += 2;
+            }
+        }
+        return;
+    }
+    case QImage::Format_RGB32:
+    case QImage::Format_ARGB32:
+        break;
+    default: {
+        // The same conversion as QImage::convertToFormat() to (A)RGB32 does.
+        const QImage::Format format = image.hasAlphaChannel() ? QImage::Format_ARGB32 : QImage::Format_RGB32;
+        const QVector<QRgb> colorTable = image.colorTable();
+        const uint *premultiplied = qPixelLayouts[image.format()].fetchToARGB32PM(buffer, src, 0, width, &colorTable, nullptr);
+        qPixelLayouts[format].storeFromARGB32PM(reinterpret_cast<uchar *>(buffer), premultiplied, 0, width, nullptr, nullptr);
+        pixels = buffer;
+        break;
+    }
+    }
+
+    if (image.hasAlphaChannel()) {
+        for (int x = 0; x < width; ++x) {
+            out[0] = qRed(pixels[x]);
+            out[1] = qGreen(pixels[x]);
+            out[2] = qBlue(pixels[x]);
+            out[3] = qAlpha(pixels[x]);
+            out += 4;
+        }
+    } else {
+        for (int x = 0; x < width; ++x) {
+            out[0] = qRed(pixels[x]);
+            out[1] = qGreen(pixels[x]);
+            out[2] = qBlue(pixels[x]);
+            out += 3;
+        }
+    }
+}
+
+static inline uchar pngPaethPredictor(int a, int b, int c)
+{
+    const int p = a + b - c;
+    const int pa = qAbs(p - a);
+    const int pb = qAbs(p - b);
+    const int pc = qAbs(p - c);
+    if (pa <= pb && pa <= pc)
+        return a;
+    return pb <= pc ? b : c;
+}
+
+// Writes the filter type byte and the row filtered with it to out. prev is
+// the unfiltered previous row, all zeros for the first row of the image.
+static void filterPngRow(int type, const uchar *row, const uchar *prev, int rowBytes, int bpp, uchar *out)
+{
+    *out++ = type;
+    switch (type) {
+    case PNG_FILTER_VALUE_NONE:
+        memcpy(out, row, rowBytes);
+        break;
+    case PNG_FILTER_VALUE_SUB:
+        for (int i = 0; i < rowBytes; ++i)
+            out[i] = row[i] - (i >= bpp ? row[i - bpp] : 0);
+        break;
+    case PNG_FILTER_VALUE_UP:
+        for (int i = 0; i < rowBytes; ++i)
+            out[i] = row[i] - prev[i];
+        break;
+    case PNG_FILTER_VALUE_AVG:
+        for (int i = 0; i < rowBytes; ++i)
+            out[i] = row[i] - (((i >= bpp ? row[i - bpp] : 0) + prev[i]) >> 1);
+        break;
+    case PNG_FILTER_VALUE_PAETH:
+        for (int i = 0; i < rowBytes; ++i) {
+            const int left = i >= bpp ? row[i - bpp] : 0;
+            const int upperLeft = i >= bpp ? prev[i - bpp] : 0;
+            out[i] = row[i] - pngPaethPredictor(left, prev[i], upperLeft);
+        }
+        break;
+    }
+}
+
+// Filters row with the filter from the filters mask that gives the smallest
+// sum of absolute values, the heuristic libpng uses. scratch must hold
+// rowBytes + 1 bytes.
+static void filterPngRowAdaptive(int filters, const uchar *row, const uchar *prev, int rowBytes, int bpp,
+                                 uchar *out, uchar *scratch)
+{
+    static const int filterMasks[] = {
+        PNG_FILTER_NONE, PNG_FILTER_SUB, PNG_FILTER_UP, PNG_FILTER_AVG, PNG_FILTER_PAETH
+    };
+
+    quint64 bestSum = std::numeric_limits<quint64>::max();
+    for (int type = PNG_FILTER_VALUE_NONE; type < PNG_FILTER_VALUE_LAST; ++type) {
+        if (!(filters & filterMasks[type]))
+            continue;
+        uchar *target = bestSum == std::numeric_limits<quint64>::max() ? out : scratch;
+        filterPngRow(type, row, prev, rowBytes, bpp, target);
+        quint64 sum = 0;
+        for (int i = 1; i <= rowBytes; ++i)
+            sum += target[i] < 128 ? target[i] : 256 - target[i];
+        if (sum < bestSum) {
+            bestSum = sum;
+            if (target != out)
+                memcpy(out, target, rowBytes + 1);
+        }
+    }
+}
+
+/*
+    Writes the image data in strips that are filtered and compressed on the
+    global thread pool, in the same way as pigz: every strip is an independent
+    raw deflate stream that ends on a byte boundary with a sync flush, so the
+    concatenation of the strips, between a zlib header and the combined
+    Adler-32 checksum, is the single zlib stream PNG expects.
+
+    Returns false if the image is too small for it to pay off, in which
+    case nothing has been written.
+*/
+bool QPNGImageWriter::writeImageDataParallel(png_structp png_ptr, const QImage &image, int color_type,
+                                             int bpc, int compression)
+{
+    const int width = image.width();
+    const int height = image.height();
+    const int channels = color_type == PNG_COLOR_TYPE_RGB_ALPHA ? 4
+                       : color_type == PNG_COLOR_TYPE_RGB ? 3 : 1;
+    const int bpp = channels * bpc / 8;
+    const qsizetype rowBytes = qsizetype(width) * bpp;
+
+    const int stripHeight = int(qBound(qsizetype(1), qsizetype(1 << 18) / rowBytes, qsizetype(height)));
+    const int stripCount = (height + stripHeight - 1) / stripHeight;
+    if (stripCount < 2)
+        return false;
+
+    const int allowedFilters = filters ? filters : PNG_ALL_FILTERS;
+    const int level = compression >= 0 ? compression : Z_DEFAULT_COMPRESSION;
+
+    struct Strip {
+        QByteArray data;
+        uLong adler;
+        uLong length;
+        bool ok;
+    };
+    QVector<Strip> strips(stripCount);
+
+    const auto compressStrip = [&](int index) {
+        Strip &strip = strips[index];
+        const int y0 = index * stripHeight;
+        const int y1 = qMin(y0 + stripHeight, height);
+
+        QByteArray filtered((y1 - y0) * (rowBytes + 1), Qt::Uninitialized);
+        QByteArray rows(2 * rowBytes, '\0');
+        QByteArray scratch(rowBytes + 1, Qt::Uninitialized);
+        QVector<uint> buffer(width);
+        uchar *row = reinterpret_cast<uchar *>(rows.data());
+        uchar *prev = row + rowBytes;
+        if (y0 > 0)
+            convertToPngRow(image, y0 - 1, prev, buffer.data());
+
+        uchar *out = reinterpret_cast<uchar *>(filtered.data());
+        for (int y = y0; y < y1; ++y) {
+            convertToPngRow(image, y, row, buffer.data());
+            filterPngRowAdaptive(allowedFilters, row, prev, rowBytes, bpp, out,
+                                 reinterpret_cast<uchar *>(scratch.data()));
+            out += rowBytes + 1;
+            qSwap(row, prev);
+        }
+
+        strip.length = filtered.size();
+        strip.adler = adler32(adler32(0, nullptr, 0), reinterpret_cast<const Bytef *>(filtered.constData()),
+                              strip.length);
+
+        z_stream stream;
+        memset(&stream, 0, sizeof(stream));
+        strip.ok = deflateInit2(&stream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+        if (!strip.ok)
+            return;
+
+        // Leave room for the sync flush marker that deflateBound() does not count
+        strip.data.resize(int(deflateBound(&stream, strip.length)) + 16);
+        stream.next_in = reinterpret_cast<Bytef *>(filtered.data());
+        stream.avail_in = strip.length;
+        stream.next_out = reinterpret_cast<Bytef *>(strip.data.data());
+        stream.avail_out = strip.data.size();
+        const int flush = index == stripCount - 1 ? Z_FINISH : Z_SYNC_FLUSH;
+        int result = deflate(&stream, flush);
+        while (result == Z_OK && (stream.avail_in || stream.avail_out == 0)) {
+            const int written = strip.data.size() - stream.avail_out;
+            strip.data.resize(strip.data.size() * 2);
+            stream.next_out = reinterpret_cast<Bytef *>(strip.data.data()) + written;
+            stream.avail_out = strip.data.size() - written;
+            result = deflate(&stream, flush);
+        }
+        strip.ok = flush == Z_FINISH ? result == Z_STREAM_END : result == Z_OK || result == Z_BUF_ERROR;
+        strip.data.resize(strip.data.size() - stream.avail_out);
+        deflateEnd(&stream);
+    };
+
+    // Only wait for the helpers that actually started, so that writing from
+    // a thread of the global pool cannot deadlock when the pool is exhausted.
+    QAtomicInt nextStrip(0);
+    const auto compressStrips = [&]() {
+        for (int i = nextStrip.fetchAndAddRelaxed(1); i < stripCount; i = nextStrip.fetchAndAddRelaxed(1))
+            compressStrip(i);
+    };
+    QSemaphore semaphore;
+    QThreadPool *threadPool = QThreadPool::globalInstance();
+    const int maxHelpers = qMin(QThread::idealThreadCount(), stripCount) - 1;
+    int helpers = 0;
+    while (helpers < maxHelpers && threadPool->tryStart([&]() {
+                compressStrips();
+                semaphore.release(1);
+            })) {
+        ++helpers;
+    }
+    compressStrips();
+    semaphore.acquire(helpers);
+
+    uLong adler = adler32(0, nullptr, 0);
+    for (const Strip &strip : qAsConst(strips)) {
+        if (!strip.ok)
+            png_error(png_ptr, "Compression Error");
+        adler = adler32_combine(adler, strip.adler, strip.length);
+    }
+
+    // zlib header for a 32K window, with the level hint zlib itself would write
+    const int levelHint = level == Z_DEFAULT_COMPRESSION || level == 6 ? 2
+                        : level < 2 ? 0 : level < 6 ? 1 : 3;
+    uchar header[2] = { 0x78, uchar(levelHint << 6) };
+    header[1] += 31 - (header[0] * 256 + header[1]) % 31;
+
+    for (int i = 0; i < stripCount; ++i) {
+        QByteArray chunk = strips.at(i).data;
+        if (i == 0)
+            chunk.prepend(reinterpret_cast<const char *>(header), 2);
+        if (i == stripCount - 1) {
+            uchar trailer[4];
+            qToBigEndian<quint32>(quint32(adler), trailer);
+            chunk.append(reinterpret_cast<const char *>(trailer), 4);
+        }
+        png_write_chunk(png_ptr, const_cast<png_bytep>((const png_byte *)"IDAT"),
+                        reinterpret_cast<png_bytep>(chunk.data()), chunk.size());
+    }
+
+    // png_write_end() refuses to run without IDATs written by libpng itself,
+    // and there is nothing left for it to write but the end marker.
+    png_write_chunk(png_ptr, const_cast<png_bytep>((const png_byte *)"IEND"), nullptr, 0);
+    return true;
+}
+#endif // QT_PNG_PARALLEL_WRITE
+
 bool QPNGImageWriter::writeImage(const QImage& image, int off_x, int off_y)
 {
     return writeImage(image, -1, QString(), off_x, off_y);
@@ -1124,9 +1460,18 @@ bool QPNGImageWriter::writeImage(const QImage& image, int compression_in, const
         png_write_chunk(png_ptr, const_cast<png_bytep>((const png_byte *)"gIFg"), data, 4);
     }
 
+    if (filters)
+        png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, filters);
+
+    bool wroteImageData = false;
+#ifdef QT_PNG_PARALLEL_WRITE
+    if (parallel && image.depth() != 1 && image.format() != QImage::Format_Indexed8)
+        wroteImageData = writeImageDataParallel(png_ptr, image, color_type, bpc, compression);
+#endif
+
     int height = image.height();
     int width = image.width();
-    switch (image.format()) {
+    if (!wroteImageData) switch (image.format()) {
     case QImage::Format_Mono:
     case QImage::Format_MonoLSB:
     case QImage::Format_Indexed8:
@@ -1161,19 +1506,27 @@ bool QPNGImageWriter::writeImage(const QImage& image, int compression_in, const
         break;
     default:
         {
+            // Convert each row straight into one buffer, rather than through
+            // a temporary QImage per row
             QImage::Format fmt = image.hasAlphaChannel() ? QImage::Format_ARGB32 : QImage::Format_RGB32;
-            QImage row;
-            png_bytep row_pointers[1];
+            const QPixelLayout &srcLayout = qPixelLayouts[image.format()];
+            const QPixelLayout &destLayout = qPixelLayouts[fmt];
+            const QVector<QRgb> colorTable = image.colorTable();
+            QVector<uint> fetchBuffer(width);
+            QVector<uint> row(width);
+            png_bytep row_pointers[1] = { reinterpret_cast<png_bytep>(row.data()) };
             for (int y=0; y<height; y++) {
-                row = image.copy(0, y, width, 1).convertToFormat(fmt);
-                row_pointers[0] = const_cast<png_bytep>(row.constScanLine(0));
+                const uint *premultiplied = srcLayout.fetchToARGB32PM(fetchBuffer.data(), image.constScanLine(y),
+                                                                      0, width, &colorTable, nullptr);
+                destLayout.storeFromARGB32PM(row_pointers[0], premultiplied, 0, width, nullptr, nullptr);
                 png_write_rows(png_ptr, row_pointers, 1);
             }
         }
         break;
     }
 
-    png_write_end(png_ptr, info_ptr);
+    if (!wroteImageData)
+        png_write_end(png_ptr, info_ptr);
     frames_written++;
 
     png_destroy_write_struct(&png_ptr, &info_ptr);
@@ -1182,7 +1535,8 @@ bool QPNGImageWriter::writeImage(const QImage& image, int compression_in, const
 }
 
 static bool write_png_image(const QImage &image, QIODevice *device,
-                            int compression, int quality, float gamma, const QString &description)
+                            int compression, int quality, float gamma, const QString &description,
+                            bool parallelWrite, const QByteArray &scanlineFilter)
 {
     // quality is used for backward compatibility, maps to compression
 
@@ -1196,6 +1550,26 @@ static bool write_png_image(const QImage &image, QIODevice *device,
         compression = (compression * 9) / 91; // map [0,100] -> [0,9]
 
     writer.setGamma(gamma);
+    writer.setParallelWrite(parallelWrite);
+
+    if (!scanlineFilter.isEmpty()) {
+        const QByteArray filter = scanlineFilter.toLower();
+        if (filter == "none")
+            writer.setFilters(PNG_FILTER_NONE);
+        else if (filter == "sub")
+            writer.setFilters(PNG_FILTER_SUB);
+        else if (filter == "up")
+            writer.setFilters(PNG_FILTER_UP);
+        else if (filter == "average")
+            writer.setFilters(PNG_FILTER_AVG);
+        else if (filter == "paeth")
+            writer.setFilters(PNG_FILTER_PAETH);
+        else if (filter == "adaptive")
+            writer.setFilters(PNG_ALL_FILTERS);
+        else
+            qWarning("PNG: Unknown scanline filter %s", filter.constData());
+    }
+
     return writer.writeImage(image, compression, description);
 }
 
@@ -1243,7 +1617,8 @@ bool QPngHandler::read(QImage *image)
 
 bool QPngHandler::write(const QImage &image)
 {
-    return write_png_image(image, device(), d->compression, d->quality, d->gamma, d->description);
+    return write_png_image(image, device(), d->compression, d->quality, d->gamma, d->description,
+                           d->parallelWrite, d->scanlineFilter);
 }
 
 bool QPngHandler::supportsOption(ImageOption option) const
@@ -1254,7 +1629,9 @@ bool QPngHandler::supportsOption(ImageOption option) const
         || option == Quality
         || option == CompressionRatio
         || option == Size
-        || option == ScaledSize;
+        || option == ScaledSize
+        || option == ParallelWrite
+        || option == ScanlineFilter;
 }
 
 QVariant QPngHandler::option(ImageOption option) const
@@ -1279,6 +1656,10 @@ QVariant QPngHandler::option(ImageOption option) const
         return d->scaledSize;
     else if (option == ImageFormat)
         return d->readImageFormat();
+    else if (option == ParallelWrite)
+        return d->parallelWrite;
+    else if (option == ScanlineFilter)
+        return d->scanlineFilter;
     return QVariant();
 }
 
@@ -1294,6 +1675,10 @@ void QPngHandler::setOption(ImageOption option, const QVariant &value)
         d->description = value.toString();
     else if (option == ScaledSize)
         d->scaledSize = value.toSize();
+    else if (option == ParallelWrite)
+        d->parallelWrite = value.toBool();
+    else if (option == ScanlineFilter)
+        d->scanlineFilter = value.toByteArray();
 }
 
 QT_END_NAMESPACE
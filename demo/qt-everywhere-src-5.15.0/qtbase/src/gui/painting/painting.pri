@@ -58,6 +58,7 @@ HEADERS += \
         painting/qrgba64.h \
         painting/qrgba64_p.h \
         painting/qstroker_p.h \
+        painting/qsharedglyphcache_p.h \
         painting/qtextureglyphcache_p.h \
         painting/qtransform.h \
         painting/qtriangulatingstroker_p.h \
@@ -104,6 +105,7 @@ SOURCES += \
         painting/qrasterizer.cpp \
         painting/qregion.cpp \
         painting/qstroker.cpp \
+        painting/qsharedglyphcache.cpp \
         painting/qtextureglyphcache.cpp \
         painting/qtransform.cpp \
         painting/qtriangulatingstroker.cpp \
@@ -136,6 +138,7 @@ gcc:equals(QT_GCC_MAJOR_VERSION, 5) {
     SSE4_1_SOURCES += painting/qdrawhelper_sse4.cpp \
                       painting/qimagescale_sse4.cpp
     ARCH_HASWELL_SOURCES += painting/qdrawhelper_avx2.cpp
+    AVX512BW_SOURCES += painting/qdrawhelper_avx512.cpp
 
     NEON_SOURCES += painting/qdrawhelper_neon.cpp painting/qimagescale_neon.cpp
     NEON_HEADERS += painting/qdrawhelper_neon_p.h
@@ -590,24 +590,61 @@ static void storePremultiplied(QRgba64 *dst, const QRgba64 *src, const QColorVec
 static void storeUnpremultiplied(QRgba64 *dst, const QRgba64 *src, const QColorVector *buffer, const qsizetype len,
                                  const QColorTransformPrivate *d_ptr)
 {
+#if defined(__SSE2__)
+    const __m128 v4080 = _mm_set1_ps(4080.f);
+    for (qsizetype i = 0; i < len; ++i) {
+        const int a = src[i].alpha();
+        __m128 vf = _mm_loadu_ps(&buffer[i].x);
+        __m128i v = _mm_cvtps_epi32(_mm_mul_ps(vf, v4080));
+        const int ridx = _mm_extract_epi16(v, 0);
+        const int gidx = _mm_extract_epi16(v, 2);
+        const int bidx = _mm_extract_epi16(v, 4);
+        v = _mm_setzero_si128();
+        v = _mm_insert_epi16(v, d_ptr->colorSpaceOut->lut[0]->m_fromLinear[ridx], 0);
+        v = _mm_insert_epi16(v, d_ptr->colorSpaceOut->lut[1]->m_fromLinear[gidx], 1);
+        v = _mm_insert_epi16(v, d_ptr->colorSpaceOut->lut[2]->m_fromLinear[bidx], 2);
+        v = _mm_add_epi16(v, _mm_srli_epi16(v, 8));
+        v = _mm_insert_epi16(v, a, 3);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + i), v);
+    }
+#else
     for (qsizetype i = 0; i < len; ++i) {
          const int r = d_ptr->colorSpaceOut->lut[0]->u16FromLinearF32(buffer[i].x);
          const int g = d_ptr->colorSpaceOut->lut[1]->u16FromLinearF32(buffer[i].y);
          const int b = d_ptr->colorSpaceOut->lut[2]->u16FromLinearF32(buffer[i].z);
          dst[i] = qRgba64(r, g, b, src[i].alpha());
     }
+#endif
 }
 
 static void storeOpaque(QRgba64 *dst, const QRgba64 *src, const QColorVector *buffer, const qsizetype len,
                         const QColorTransformPrivate *d_ptr)
 {
     Q_UNUSED(src);
+#if defined(__SSE2__)
+    const __m128 v4080 = _mm_set1_ps(4080.f);
+    for (qsizetype i = 0; i < len; ++i) {
+        __m128 vf = _mm_loadu_ps(&buffer[i].x);
+        __m128i v = _mm_cvtps_epi32(_mm_mul_ps(vf, v4080));
+        const int ridx = _mm_extract_epi16(v, 0);
+        const int gidx = _mm_extract_epi16(v, 2);
+        const int bidx = _mm_extract_epi16(v, 4);
+        v = _mm_setzero_si128();
+        v = _mm_insert_epi16(v, d_ptr->colorSpaceOut->lut[0]->m_fromLinear[ridx], 0);
+        v = _mm_insert_epi16(v, d_ptr->colorSpaceOut->lut[1]->m_fromLinear[gidx], 1);
+        v = _mm_insert_epi16(v, d_ptr->colorSpaceOut->lut[2]->m_fromLinear[bidx], 2);
+        v = _mm_add_epi16(v, _mm_srli_epi16(v, 8));
+        v = _mm_insert_epi16(v, 0xFFFF, 3);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + i), v);
+    }
+#else
     for (qsizetype i = 0; i < len; ++i) {
         const int r = d_ptr->colorSpaceOut->lut[0]->u16FromLinearF32(buffer[i].x);
         const int g = d_ptr->colorSpaceOut->lut[1]->u16FromLinearF32(buffer[i].y);
         const int b = d_ptr->colorSpaceOut->lut[2]->u16FromLinearF32(buffer[i].z);
         dst[i] = qRgba64(r, g, b, 0xFFFF);
     }
+#endif
 }
 
 static constexpr qsizetype WorkBlockSize = 256;
@@ -0,0 +1,554 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qdrawhelper_p.h"
+#include "qdrawhelper_x86_p.h"
+#include "qrgba64_p.h"
+
+#if defined(QT_COMPILER_SUPPORTS_AVX512BW)
+
+QT_BEGIN_NAMESPACE
+
+// The functions in here follow their AVX2 counterparts, but work on 16 ARGB32
+// or 8 RGBA64 pixels at a time. Instead of scalar prologues and epilogues the
+// unaligned head and the tail of a span are handled with masked loads and
+// stores.
+
+// Calls op(x, mask) for consecutive blocks of a span of pixels of type T. All
+// blocks but the first one start at a 64-byte aligned destination, and only
+// the first and the last one may be partial.
+template <typename T, typename Mask, typename Op>
+static inline void forEachBlock_avx512(const T *dst, int length, Op op)
+{
+    constexpr int BlockSize = 64 / sizeof(T);
+    const auto maskFor = [](int count) { return Mask((1u << count) - 1); };
+
+    int x = 0;
+    const int misalignment = int((reinterpret_cast<quintptr>(dst) / sizeof(T)) & (BlockSize - 1));
+    if (misalignment && length > 0) {
+        x = qMin(BlockSize - misalignment, length);
+        op(0, maskFor(x));
+    }
+    for (; x <= length - BlockSize; x += BlockSize)
+        op(x, Mask(~0u));
+    if (x < length)
+        op(x, maskFor(length - x));
+}
+
+// See BYTE_MUL_SSE2 for details.
+inline static void Q_DECL_VECTORCALL
+BYTE_MUL_AVX512(__m512i &pixelVector, __m512i alphaChannel, __m512i colorMask, __m512i half)
+{
+    __m512i pixelVectorAG = _mm512_srli_epi16(pixelVector, 8);
+    __m512i pixelVectorRB = _mm512_and_si512(pixelVector, colorMask);
+
+    pixelVectorAG = _mm512_mullo_epi16(pixelVectorAG, alphaChannel);
+    pixelVectorRB = _mm512_mullo_epi16(pixelVectorRB, alphaChannel);
+
+    pixelVectorRB = _mm512_add_epi16(pixelVectorRB, _mm512_srli_epi16(pixelVectorRB, 8));
+    pixelVectorAG = _mm512_add_epi16(pixelVectorAG, _mm512_srli_epi16(pixelVectorAG, 8));
+    pixelVectorRB = _mm512_add_epi16(pixelVectorRB, half);
+    pixelVectorAG = _mm512_add_epi16(pixelVectorAG, half);
+
+    pixelVectorRB = _mm512_srli_epi16(pixelVectorRB, 8);
+    pixelVectorAG = _mm512_andnot_si512(colorMask, pixelVectorAG);
+
+    pixelVector = _mm512_or_si512(pixelVectorAG, pixelVectorRB);
+}
+
+inline static void Q_DECL_VECTORCALL
+BYTE_MUL_RGB64_AVX512(__m512i &pixelVector, __m512i alphaChannel, __m512i colorMask, __m512i half)
+{
+    __m512i pixelVectorAG = _mm512_srli_epi32(pixelVector, 16);
+    __m512i pixelVectorRB = _mm512_and_si512(pixelVector, colorMask);
+
+    pixelVectorAG = _mm512_mullo_epi32(pixelVectorAG, alphaChannel);
+    pixelVectorRB = _mm512_mullo_epi32(pixelVectorRB, alphaChannel);
+
+    pixelVectorRB = _mm512_add_epi32(pixelVectorRB, _mm512_srli_epi32(pixelVectorRB, 16));
+    pixelVectorAG = _mm512_add_epi32(pixelVectorAG, _mm512_srli_epi32(pixelVectorAG, 16));
+    pixelVectorRB = _mm512_add_epi32(pixelVectorRB, half);
+    pixelVectorAG = _mm512_add_epi32(pixelVectorAG, half);
+
+    pixelVectorRB = _mm512_srli_epi32(pixelVectorRB, 16);
+    pixelVectorAG = _mm512_andnot_si512(colorMask, pixelVectorAG);
+
+    pixelVector = _mm512_or_si512(pixelVectorAG, pixelVectorRB);
+}
+
+// See INTERPOLATE_PIXEL_255_SSE2 for details.
+inline static void Q_DECL_VECTORCALL
+INTERPOLATE_PIXEL_255_AVX512(__m512i srcVector, __m512i &dstVector, __m512i alphaChannel, __m512i oneMinusAlphaChannel, __m512i colorMask, __m512i half)
+{
+    const __m512i srcVectorAG = _mm512_srli_epi16(srcVector, 8);
+    const __m512i dstVectorAG = _mm512_srli_epi16(dstVector, 8);
+    const __m512i srcVectorRB = _mm512_and_si512(srcVector, colorMask);
+    const __m512i dstVectorRB = _mm512_and_si512(dstVector, colorMask);
+    const __m512i srcVectorAGalpha = _mm512_mullo_epi16(srcVectorAG, alphaChannel);
+    const __m512i srcVectorRBalpha = _mm512_mullo_epi16(srcVectorRB, alphaChannel);
+    const __m512i dstVectorAGoneMinusAlpha = _mm512_mullo_epi16(dstVectorAG, oneMinusAlphaChannel);
+    const __m512i dstVectorRBoneMinusAlpha = _mm512_mullo_epi16(dstVectorRB, oneMinusAlphaChannel);
+    __m512i finalAG = _mm512_add_epi16(srcVectorAGalpha, dstVectorAGoneMinusAlpha);
+    __m512i finalRB = _mm512_add_epi16(srcVectorRBalpha, dstVectorRBoneMinusAlpha);
+    finalAG = _mm512_add_epi16(finalAG, _mm512_srli_epi16(finalAG, 8));
+    finalRB = _mm512_add_epi16(finalRB, _mm512_srli_epi16(finalRB, 8));
+    finalAG = _mm512_add_epi16(finalAG, half);
+    finalRB = _mm512_add_epi16(finalRB, half);
+    finalAG = _mm512_andnot_si512(colorMask, finalAG);
+    finalRB = _mm512_srli_epi16(finalRB, 8);
+
+    dstVector = _mm512_or_si512(finalAG, finalRB);
+}
+
+inline static void Q_DECL_VECTORCALL
+INTERPOLATE_PIXEL_RGB64_AVX512(__m512i srcVector, __m512i &dstVector, __m512i alphaChannel, __m512i oneMinusAlphaChannel, __m512i colorMask, __m512i half)
+{
+    const __m512i srcVectorAG = _mm512_srli_epi32(srcVector, 16);
+    const __m512i dstVectorAG = _mm512_srli_epi32(dstVector, 16);
+    const __m512i srcVectorRB = _mm512_and_si512(srcVector, colorMask);
+    const __m512i dstVectorRB = _mm512_and_si512(dstVector, colorMask);
+    const __m512i srcVectorAGalpha = _mm512_mullo_epi32(srcVectorAG, alphaChannel);
+    const __m512i srcVectorRBalpha = _mm512_mullo_epi32(srcVectorRB, alphaChannel);
+    const __m512i dstVectorAGoneMinusAlpha = _mm512_mullo_epi32(dstVectorAG, oneMinusAlphaChannel);
+    const __m512i dstVectorRBoneMinusAlpha = _mm512_mullo_epi32(dstVectorRB, oneMinusAlphaChannel);
+    __m512i finalAG = _mm512_add_epi32(srcVectorAGalpha, dstVectorAGoneMinusAlpha);
+    __m512i finalRB = _mm512_add_epi32(srcVectorRBalpha, dstVectorRBoneMinusAlpha);
+    finalAG = _mm512_add_epi32(finalAG, _mm512_srli_epi32(finalAG, 16));
+    finalRB = _mm512_add_epi32(finalRB, _mm512_srli_epi32(finalRB, 16));
+    finalAG = _mm512_add_epi32(finalAG, half);
+    finalRB = _mm512_add_epi32(finalRB, half);
+    finalAG = _mm512_andnot_si512(colorMask, finalAG);
+    finalRB = _mm512_srli_epi32(finalRB, 16);
+
+    dstVector = _mm512_or_si512(finalAG, finalRB);
+}
+
+// Spreads the alpha of each ARGB32 pixel over the two 16-bit halves of the pixel.
+inline static __m512i Q_DECL_VECTORCALL alphaChannel_avx512(__m512i srcVector)
+{
+    const __m512i alphaShuffleMask = _mm512_broadcast_i32x4(
+            _mm_setr_epi8(3, char(0xff), 3, char(0xff), 7, char(0xff), 7, char(0xff),
+                          11, char(0xff), 11, char(0xff), 15, char(0xff), 15, char(0xff)));
+    return _mm512_shuffle_epi8(srcVector, alphaShuffleMask);
+}
+
+// Spreads the alpha of each RGBA64 pixel over the two 32-bit halves of the pixel.
+inline static __m512i Q_DECL_VECTORCALL alphaChannel_rgb64_avx512(__m512i srcVector)
+{
+    const __m512i alphaShuffleMask = _mm512_broadcast_i32x4(
+            _mm_setr_epi8(6, 7, char(0xff), char(0xff), 6, 7, char(0xff), char(0xff),
+                          14, 15, char(0xff), char(0xff), 14, 15, char(0xff), char(0xff)));
+    return _mm512_shuffle_epi8(srcVector, alphaShuffleMask);
+}
+
+// See BLEND_SOURCE_OVER_ARGB32_SSE2 for details.
+inline static void Q_DECL_VECTORCALL BLEND_SOURCE_OVER_ARGB32_AVX512(quint32 *dst, const quint32 *src, const int length)
+{
+    const __m512i half = _mm512_set1_epi16(0x80);
+    const __m512i one = _mm512_set1_epi16(0xff);
+    const __m512i colorMask = _mm512_set1_epi32(0x00ff00ff);
+    const __m512i alphaMask = _mm512_set1_epi32(0xff000000);
+
+    forEachBlock_avx512<quint32, __mmask16>(dst, length, [&](int x, __mmask16 mask) {
+        const __m512i srcVector = _mm512_maskz_loadu_epi32(mask, &src[x]);
+        if (!_mm512_test_epi32_mask(srcVector, alphaMask))
+            return;
+        const __mmask16 opaque = _mm512_cmpeq_epi32_mask(_mm512_and_si512(srcVector, alphaMask), alphaMask);
+        if ((opaque & mask) == mask) {
+            _mm512_mask_storeu_epi32(&dst[x], mask, srcVector);
+        } else {
+            const __m512i alphaChannel = _mm512_sub_epi16(one, alphaChannel_avx512(srcVector));
+            __m512i dstVector = _mm512_maskz_loadu_epi32(mask, &dst[x]);
+            BYTE_MUL_AVX512(dstVector, alphaChannel, colorMask, half);
+            dstVector = _mm512_add_epi8(dstVector, srcVector);
+            _mm512_mask_storeu_epi32(&dst[x], mask, dstVector);
+        }
+    });
+}
+
+// See BLEND_SOURCE_OVER_ARGB32_WITH_CONST_ALPHA_SSE2 for details.
+inline static void Q_DECL_VECTORCALL
+BLEND_SOURCE_OVER_ARGB32_WITH_CONST_ALPHA_AVX512(quint32 *dst, const quint32 *src, const int length, const int const_alpha)
+{
+    const __m512i half = _mm512_set1_epi16(0x80);
+    const __m512i one = _mm512_set1_epi16(0xff);
+    const __m512i colorMask = _mm512_set1_epi32(0x00ff00ff);
+    const __m512i alphaMask = _mm512_set1_epi32(0xff000000);
+    const __m512i constAlphaVector = _mm512_set1_epi16(const_alpha);
+
+    forEachBlock_avx512<quint32, __mmask16>(dst, length, [&](int x, __mmask16 mask) {
+        __m512i srcVector = _mm512_maskz_loadu_epi32(mask, &src[x]);
+        if (!_mm512_test_epi32_mask(srcVector, alphaMask))
+            return;
+        BYTE_MUL_AVX512(srcVector, constAlphaVector, colorMask, half);
+
+        const __m512i alphaChannel = _mm512_sub_epi16(one, alphaChannel_avx512(srcVector));
+        __m512i dstVector = _mm512_maskz_loadu_epi32(mask, &dst[x]);
+        BYTE_MUL_AVX512(dstVector, alphaChannel, colorMask, half);
+        dstVector = _mm512_add_epi8(dstVector, srcVector);
+        _mm512_mask_storeu_epi32(&dst[x], mask, dstVector);
+    });
+}
+
+inline static void Q_DECL_VECTORCALL
+INTERPOLATE_SPAN_ARGB32_AVX512(quint32 *dst, const quint32 *src, const int length, const int const_alpha)
+{
+    const __m512i half = _mm512_set1_epi16(0x80);
+    const __m512i colorMask = _mm512_set1_epi32(0x00ff00ff);
+    const __m512i constAlphaVector = _mm512_set1_epi16(const_alpha);
+    const __m512i oneMinusConstAlpha = _mm512_set1_epi16(255 - const_alpha);
+
+    forEachBlock_avx512<quint32, __mmask16>(dst, length, [&](int x, __mmask16 mask) {
+        const __m512i srcVector = _mm512_maskz_loadu_epi32(mask, &src[x]);
+        __m512i dstVector = _mm512_maskz_loadu_epi32(mask, &dst[x]);
+        INTERPOLATE_PIXEL_255_AVX512(srcVector, dstVector, constAlphaVector, oneMinusConstAlpha, colorMask, half);
+        _mm512_mask_storeu_epi32(&dst[x], mask, dstVector);
+    });
+}
+
+void qt_blend_argb32_on_argb32_avx512(uchar *destPixels, int dbpl,
+                                      const uchar *srcPixels, int sbpl,
+                                      int w, int h,
+                                      int const_alpha)
+{
+    if (const_alpha == 256) {
+        for (int y = 0; y < h; ++y) {
+            const quint32 *src = reinterpret_cast<const quint32 *>(srcPixels);
+            quint32 *dst = reinterpret_cast<quint32 *>(destPixels);
+            BLEND_SOURCE_OVER_ARGB32_AVX512(dst, src, w);
+            destPixels += dbpl;
+            srcPixels += sbpl;
+        }
+    } else if (const_alpha != 0) {
+        const_alpha = (const_alpha * 255) >> 8;
+        for (int y = 0; y < h; ++y) {
+            const quint32 *src = reinterpret_cast<const quint32 *>(srcPixels);
+            quint32 *dst = reinterpret_cast<quint32 *>(destPixels);
+            BLEND_SOURCE_OVER_ARGB32_WITH_CONST_ALPHA_AVX512(dst, src, w, const_alpha);
+            destPixels += dbpl;
+            srcPixels += sbpl;
+        }
+    }
+}
+
+void qt_blend_rgb32_on_rgb32_avx512(uchar *destPixels, int dbpl,
+                                    const uchar *srcPixels, int sbpl,
+                                    int w, int h,
+                                    int const_alpha)
+{
+    if (const_alpha == 256) {
+        for (int y = 0; y < h; ++y) {
+            const quint32 *src = reinterpret_cast<const quint32 *>(srcPixels);
+            quint32 *dst = reinterpret_cast<quint32 *>(destPixels);
+            ::memcpy(dst, src, w * sizeof(uint));
+            srcPixels += sbpl;
+            destPixels += dbpl;
+        }
+        return;
+    }
+    if (const_alpha == 0)
+        return;
+
+    const_alpha = (const_alpha * 255) >> 8;
+    for (int y = 0; y < h; ++y) {
+        const quint32 *src = reinterpret_cast<const quint32 *>(srcPixels);
+        quint32 *dst = reinterpret_cast<quint32 *>(destPixels);
+        INTERPOLATE_SPAN_ARGB32_AVX512(dst, src, w, const_alpha);
+        srcPixels += sbpl;
+        destPixels += dbpl;
+    }
+}
+
+void QT_FASTCALL comp_func_SourceOver_avx512(uint *destPixels, const uint *srcPixels, int length, uint const_alpha)
+{
+    Q_ASSERT(const_alpha < 256);
+
+    const quint32 *src = (const quint32 *) srcPixels;
+    quint32 *dst = (quint32 *) destPixels;
+
+    if (const_alpha == 255)
+        BLEND_SOURCE_OVER_ARGB32_AVX512(dst, src, length);
+    else
+        BLEND_SOURCE_OVER_ARGB32_WITH_CONST_ALPHA_AVX512(dst, src, length, const_alpha);
+}
+
+void QT_FASTCALL comp_func_Source_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    if (const_alpha == 255)
+        ::memcpy(dst, src, length * sizeof(uint));
+    else
+        INTERPOLATE_SPAN_ARGB32_AVX512(dst, src, length, const_alpha);
+}
+
+void QT_FASTCALL comp_func_solid_SourceOver_avx512(uint *destPixels, int length, uint color, uint const_alpha)
+{
+    if ((const_alpha & qAlpha(color)) == 255) {
+        qt_memfill32(destPixels, color, length);
+    } else {
+        if (const_alpha != 255)
+            color = BYTE_MUL(color, const_alpha);
+
+        const __m512i colorVector = _mm512_set1_epi32(color);
+        const __m512i colorMask = _mm512_set1_epi32(0x00ff00ff);
+        const __m512i half = _mm512_set1_epi16(0x80);
+        const __m512i minusAlphaOfColorVector = _mm512_set1_epi16(qAlpha(~color));
+
+        forEachBlock_avx512<quint32, __mmask16>(destPixels, length, [&](int x, __mmask16 mask) {
+            __m512i dstVector = _mm512_maskz_loadu_epi32(mask, &destPixels[x]);
+            BYTE_MUL_AVX512(dstVector, minusAlphaOfColorVector, colorMask, half);
+            dstVector = _mm512_add_epi8(colorVector, dstVector);
+            _mm512_mask_storeu_epi32(&destPixels[x], mask, dstVector);
+        });
+    }
+}
+
+void QT_FASTCALL comp_func_Plus_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    const __m512i half = _mm512_set1_epi16(0x80);
+    const __m512i colorMask = _mm512_set1_epi32(0x00ff00ff);
+    const __m512i constAlphaVector = _mm512_set1_epi16(const_alpha);
+    const __m512i oneMinusConstAlpha = _mm512_set1_epi16(255 - const_alpha);
+
+    forEachBlock_avx512<quint32, __mmask16>(dst, length, [&](int x, __mmask16 mask) {
+        const __m512i srcVector = _mm512_maskz_loadu_epi32(mask, &src[x]);
+        __m512i dstVector = _mm512_maskz_loadu_epi32(mask, &dst[x]);
+        const __m512i result = _mm512_adds_epu8(srcVector, dstVector);
+        if (const_alpha == 255)
+            dstVector = result;
+        else
+            INTERPOLATE_PIXEL_255_AVX512(result, dstVector, constAlphaVector, oneMinusConstAlpha, colorMask, half);
+        _mm512_mask_storeu_epi32(&dst[x], mask, dstVector);
+    });
+}
+
+// The Porter-Duff modes besides SourceOver all compute
+//   result = s * srcFactor + d * dstFactor
+// where the factors are 0, 1, the alpha of either pixel or one minus that. For
+// const_alpha != 255 every mode rounds its intermediate results differently,
+// so those spans use the generic implementations.
+enum PorterDuffFactor {
+    Zero,
+    One,
+    SrcAlpha,
+    InvSrcAlpha,
+    DstAlpha,
+    InvDstAlpha
+};
+
+template <PorterDuffFactor Factor>
+inline static __m512i Q_DECL_VECTORCALL porterDuffFactor_avx512(__m512i srcVector, __m512i dstVector)
+{
+    const __m512i one = _mm512_set1_epi16(0xff);
+    switch (Factor) {
+    case Zero:
+        return _mm512_setzero_si512();
+    case One:
+        return one;
+    case SrcAlpha:
+        return alphaChannel_avx512(srcVector);
+    case InvSrcAlpha:
+        return _mm512_sub_epi16(one, alphaChannel_avx512(srcVector));
+    case DstAlpha:
+        return alphaChannel_avx512(dstVector);
+    case InvDstAlpha:
+        return _mm512_sub_epi16(one, alphaChannel_avx512(dstVector));
+    }
+    Q_UNREACHABLE();
+}
+
+template <PorterDuffFactor SrcFactor, PorterDuffFactor DstFactor>
+inline static void comp_func_PorterDuff_avx512(uint *dst, const uint *src, int length,
+                                               CompositionFunction fallback, uint const_alpha)
+{
+    if (const_alpha != 255)
+        return fallback(dst, src, length, const_alpha);
+
+    const __m512i half = _mm512_set1_epi16(0x80);
+    const __m512i colorMask = _mm512_set1_epi32(0x00ff00ff);
+
+    forEachBlock_avx512<quint32, __mmask16>(dst, length, [&](int x, __mmask16 mask) {
+        const __m512i srcVector = _mm512_maskz_loadu_epi32(mask, &src[x]);
+        __m512i dstVector = _mm512_maskz_loadu_epi32(mask, &dst[x]);
+        const __m512i srcFactor = porterDuffFactor_avx512<SrcFactor>(srcVector, dstVector);
+        const __m512i dstFactor = porterDuffFactor_avx512<DstFactor>(srcVector, dstVector);
+        if (SrcFactor == Zero) {
+            BYTE_MUL_AVX512(dstVector, dstFactor, colorMask, half);
+        } else if (DstFactor == Zero) {
+            dstVector = srcVector;
+            BYTE_MUL_AVX512(dstVector, srcFactor, colorMask, half);
+        } else if (DstFactor == One) {
+            __m512i srcTerm = srcVector;
+            BYTE_MUL_AVX512(srcTerm, srcFactor, colorMask, half);
+            dstVector = _mm512_add_epi8(dstVector, srcTerm);
+        } else {
+            INTERPOLATE_PIXEL_255_AVX512(srcVector, dstVector, srcFactor, dstFactor, colorMask, half);
+        }
+        _mm512_mask_storeu_epi32(&dst[x], mask, dstVector);
+    });
+}
+
+extern void QT_FASTCALL comp_func_DestinationOver(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_SourceIn(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_DestinationIn(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_SourceOut(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_DestinationOut(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_SourceAtop(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_DestinationAtop(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_XOR(uint *dest, const uint *src, int length, uint const_alpha);
+
+void QT_FASTCALL comp_func_DestinationOver_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_PorterDuff_avx512<InvDstAlpha, One>(dst, src, length, comp_func_DestinationOver, const_alpha);
+}
+
+void QT_FASTCALL comp_func_SourceIn_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_PorterDuff_avx512<DstAlpha, Zero>(dst, src, length, comp_func_SourceIn, const_alpha);
+}
+
+void QT_FASTCALL comp_func_DestinationIn_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_PorterDuff_avx512<Zero, SrcAlpha>(dst, src, length, comp_func_DestinationIn, const_alpha);
+}
+
+void QT_FASTCALL comp_func_SourceOut_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_PorterDuff_avx512<InvDstAlpha, Zero>(dst, src, length, comp_func_SourceOut, const_alpha);
+}
+
+void QT_FASTCALL comp_func_DestinationOut_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_PorterDuff_avx512<Zero, InvSrcAlpha>(dst, src, length, comp_func_DestinationOut, const_alpha);
+}
+
+void QT_FASTCALL comp_func_SourceAtop_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_PorterDuff_avx512<DstAlpha, InvSrcAlpha>(dst, src, length, comp_func_SourceAtop, const_alpha);
+}
+
+void QT_FASTCALL comp_func_DestinationAtop_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_PorterDuff_avx512<InvDstAlpha, SrcAlpha>(dst, src, length, comp_func_DestinationAtop, const_alpha);
+}
+
+void QT_FASTCALL comp_func_XOR_avx512(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_PorterDuff_avx512<InvDstAlpha, InvSrcAlpha>(dst, src, length, comp_func_XOR, const_alpha);
+}
+
+#if QT_CONFIG(raster_64bit)
+void QT_FASTCALL comp_func_SourceOver_rgb64_avx512(QRgba64 *dst, const QRgba64 *src, int length, uint const_alpha)
+{
+    Q_ASSERT(const_alpha < 256); // const_alpha is in [0-255]
+    const __m512i half = _mm512_set1_epi32(0x8000);
+    const __m512i one  = _mm512_set1_epi32(0xffff);
+    const __m512i colorMask = _mm512_set1_epi32(0x0000ffff);
+    const __m512i alphaMask = _mm512_set1_epi64(qint64(Q_UINT64_C(0xffff000000000000)));
+    const __m512i constAlphaVector = _mm512_set1_epi32(const_alpha | (const_alpha << 8));
+
+    forEachBlock_avx512<QRgba64, __mmask8>(dst, length, [&](int x, __mmask8 mask) {
+        __m512i srcVector = _mm512_maskz_loadu_epi64(mask, &src[x]);
+        if (!_mm512_test_epi64_mask(srcVector, alphaMask))
+            return;
+        if (const_alpha == 255) {
+            const __mmask8 opaque = _mm512_cmpeq_epi64_mask(_mm512_and_si512(srcVector, alphaMask), alphaMask);
+            if ((opaque & mask) == mask) {
+                _mm512_mask_storeu_epi64(&dst[x], mask, srcVector);
+                return;
+            }
+        } else {
+            BYTE_MUL_RGB64_AVX512(srcVector, constAlphaVector, colorMask, half);
+        }
+
+        const __m512i alphaChannel = _mm512_sub_epi32(one, alphaChannel_rgb64_avx512(srcVector));
+        __m512i dstVector = _mm512_maskz_loadu_epi64(mask, &dst[x]);
+        BYTE_MUL_RGB64_AVX512(dstVector, alphaChannel, colorMask, half);
+        dstVector = _mm512_add_epi16(dstVector, srcVector);
+        _mm512_mask_storeu_epi64(&dst[x], mask, dstVector);
+    });
+}
+
+void QT_FASTCALL comp_func_Source_rgb64_avx512(QRgba64 *dst, const QRgba64 *src, int length, uint const_alpha)
+{
+    Q_ASSERT(const_alpha < 256); // const_alpha is in [0-255]
+    if (const_alpha == 255) {
+        ::memcpy(dst, src, length * sizeof(QRgba64));
+    } else {
+        const uint ca = const_alpha | (const_alpha << 8); // adjust to [0-65535]
+        const __m512i half = _mm512_set1_epi32(0x8000);
+        const __m512i colorMask = _mm512_set1_epi32(0x0000ffff);
+        const __m512i constAlphaVector = _mm512_set1_epi32(ca);
+        const __m512i oneMinusConstAlpha = _mm512_set1_epi32(65535 - ca);
+
+        forEachBlock_avx512<QRgba64, __mmask8>(dst, length, [&](int x, __mmask8 mask) {
+            const __m512i srcVector = _mm512_maskz_loadu_epi64(mask, &src[x]);
+            __m512i dstVector = _mm512_maskz_loadu_epi64(mask, &dst[x]);
+            INTERPOLATE_PIXEL_RGB64_AVX512(srcVector, dstVector, constAlphaVector, oneMinusConstAlpha, colorMask, half);
+            _mm512_mask_storeu_epi64(&dst[x], mask, dstVector);
+        });
+    }
+}
+
+void QT_FASTCALL comp_func_solid_SourceOver_rgb64_avx512(QRgba64 *destPixels, int length, QRgba64 color, uint const_alpha)
+{
+    Q_ASSERT(const_alpha < 256); // const_alpha is in [0-255]
+    if (const_alpha == 255 && color.isOpaque()) {
+        qt_memfill64((quint64*)destPixels, color, length);
+    } else {
+        if (const_alpha != 255)
+            color = multiplyAlpha255(color, const_alpha);
+
+        const __m512i colorVector = _mm512_set1_epi64(qint64(quint64(color)));
+        const __m512i colorMask = _mm512_set1_epi32(0x0000ffff);
+        const __m512i half = _mm512_set1_epi32(0x8000);
+        const __m512i minusAlphaOfColorVector = _mm512_set1_epi32(65535 - color.alpha());
+
+        forEachBlock_avx512<QRgba64, __mmask8>(destPixels, length, [&](int x, __mmask8 mask) {
+            __m512i dstVector = _mm512_maskz_loadu_epi64(mask, &destPixels[x]);
+            BYTE_MUL_RGB64_AVX512(dstVector, minusAlphaOfColorVector, colorMask, half);
+            dstVector = _mm512_add_epi16(colorVector, dstVector);
+            _mm512_mask_storeu_epi64(&destPixels[x], mask, dstVector);
+        });
+    }
+}
+#endif
+
+QT_END_NAMESPACE
+
+#endif
@@ -894,6 +894,143 @@ void QT_FASTCALL comp_func_Plus_neon(uint *dst, const uint *src, int length, uin
     }
 }
 
+// Spreads the alpha of the two pixels in x over all their channels.
+static inline uint16x8_t qvalpha_u16(uint16x8_t x)
+{
+    const uint16x4_t alpha16_low = vdup_lane_u16(vget_low_u16(x), 3);
+    const uint16x4_t alpha16_high = vdup_lane_u16(vget_high_u16(x), 3);
+    return vcombine_u16(alpha16_low, alpha16_high);
+}
+
+// The Porter-Duff modes besides SourceOver all compute
+//   result = s * srcFactor + d * dstFactor
+// where the factors are 0, 1, the alpha of either pixel or one minus that. With
+// const_alpha != 255 every mode rounds its intermediate results differently, so
+// those spans, like the tails of shorter than 8 pixels, use the generic
+// implementations.
+enum QPorterDuffFactor {
+    PorterDuffZero,
+    PorterDuffOne,
+    PorterDuffSrcAlpha,
+    PorterDuffInvSrcAlpha,
+    PorterDuffDstAlpha,
+    PorterDuffInvDstAlpha
+};
+
+template <QPorterDuffFactor Factor>
+static inline uint16x8_t qvporter_duff_factor_u16(uint16x8_t src16, uint16x8_t dst16, uint16x8_t full)
+{
+    switch (Factor) {
+    case PorterDuffZero:
+        return vdupq_n_u16(0);
+    case PorterDuffOne:
+        return full;
+    case PorterDuffSrcAlpha:
+        return qvalpha_u16(src16);
+    case PorterDuffInvSrcAlpha:
+        return vsubq_u16(full, qvalpha_u16(src16));
+    case PorterDuffDstAlpha:
+        return qvalpha_u16(dst16);
+    case PorterDuffInvDstAlpha:
+        return vsubq_u16(full, qvalpha_u16(dst16));
+    }
+    Q_UNREACHABLE();
+}
+
+template <QPorterDuffFactor SrcFactor, QPorterDuffFactor DstFactor>
+static inline uint16x8_t qvporter_duff_u16(uint16x8_t src16, uint16x8_t dst16, uint16x8_t half, uint16x8_t full)
+{
+    const uint16x8_t srcFactor = qvporter_duff_factor_u16<SrcFactor>(src16, dst16, full);
+    const uint16x8_t dstFactor = qvporter_duff_factor_u16<DstFactor>(src16, dst16, full);
+
+    if (SrcFactor == PorterDuffZero)
+        return qvbyte_mul_u16(dst16, dstFactor, half);
+    if (DstFactor == PorterDuffZero)
+        return qvbyte_mul_u16(src16, srcFactor, half);
+    if (DstFactor == PorterDuffOne)
+        return vaddq_u16(dst16, qvbyte_mul_u16(src16, srcFactor, half));
+    return qvinterpolate_pixel_255(src16, srcFactor, dst16, dstFactor, half);
+}
+
+template <QPorterDuffFactor SrcFactor, QPorterDuffFactor DstFactor>
+static inline void comp_func_porter_duff_neon(uint *dst, const uint *src, int length,
+                                              CompositionFunction fallback, uint const_alpha)
+{
+    if (const_alpha != 255)
+        return fallback(dst, src, length, const_alpha);
+
+    const uint16x8_t half = vdupq_n_u16(0x80);
+    const uint16x8_t full = vdupq_n_u16(0xff);
+
+    int x = 0;
+    for (; x < length - 7; x += 8) {
+        const uint8x16_t src8_0 = vld1q_u8((const uint8_t *)&src[x]);
+        const uint8x16_t src8_1 = vld1q_u8((const uint8_t *)&src[x + 4]);
+        const uint8x16_t dst8_0 = vld1q_u8((const uint8_t *)&dst[x]);
+        const uint8x16_t dst8_1 = vld1q_u8((const uint8_t *)&dst[x + 4]);
+
+        const uint16x8_t result16_0 = qvporter_duff_u16<SrcFactor, DstFactor>(vmovl_u8(vget_low_u8(src8_0)), vmovl_u8(vget_low_u8(dst8_0)), half, full);
+        const uint16x8_t result16_1 = qvporter_duff_u16<SrcFactor, DstFactor>(vmovl_u8(vget_high_u8(src8_0)), vmovl_u8(vget_high_u8(dst8_0)), half, full);
+        const uint16x8_t result16_2 = qvporter_duff_u16<SrcFactor, DstFactor>(vmovl_u8(vget_low_u8(src8_1)), vmovl_u8(vget_low_u8(dst8_1)), half, full);
+        const uint16x8_t result16_3 = qvporter_duff_u16<SrcFactor, DstFactor>(vmovl_u8(vget_high_u8(src8_1)), vmovl_u8(vget_high_u8(dst8_1)), half, full);
+
+        vst1q_u8((uint8_t *)&dst[x], vcombine_u8(vmovn_u16(result16_0), vmovn_u16(result16_1)));
+        vst1q_u8((uint8_t *)&dst[x + 4], vcombine_u8(vmovn_u16(result16_2), vmovn_u16(result16_3)));
+    }
+
+    if (x < length)
+        fallback(dst + x, src + x, length - x, const_alpha);
+}
+
+extern void QT_FASTCALL comp_func_DestinationOver(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_SourceIn(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_DestinationIn(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_SourceOut(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_DestinationOut(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_SourceAtop(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_DestinationAtop(uint *dest, const uint *src, int length, uint const_alpha);
+extern void QT_FASTCALL comp_func_XOR(uint *dest, const uint *src, int length, uint const_alpha);
+
+void QT_FASTCALL comp_func_DestinationOver_neon(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_porter_duff_neon<PorterDuffInvDstAlpha, PorterDuffOne>(dst, src, length, comp_func_DestinationOver, const_alpha);
+}
+
+void QT_FASTCALL comp_func_SourceIn_neon(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_porter_duff_neon<PorterDuffDstAlpha, PorterDuffZero>(dst, src, length, comp_func_SourceIn, const_alpha);
+}
+
+void QT_FASTCALL comp_func_DestinationIn_neon(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_porter_duff_neon<PorterDuffZero, PorterDuffSrcAlpha>(dst, src, length, comp_func_DestinationIn, const_alpha);
+}
+
+void QT_FASTCALL comp_func_SourceOut_neon(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_porter_duff_neon<PorterDuffInvDstAlpha, PorterDuffZero>(dst, src, length, comp_func_SourceOut, const_alpha);
+}
+
+void QT_FASTCALL comp_func_DestinationOut_neon(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_porter_duff_neon<PorterDuffZero, PorterDuffInvSrcAlpha>(dst, src, length, comp_func_DestinationOut, const_alpha);
+}
+
+void QT_FASTCALL comp_func_SourceAtop_neon(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_porter_duff_neon<PorterDuffDstAlpha, PorterDuffInvSrcAlpha>(dst, src, length, comp_func_SourceAtop, const_alpha);
+}
+
+void QT_FASTCALL comp_func_DestinationAtop_neon(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_porter_duff_neon<PorterDuffInvDstAlpha, PorterDuffSrcAlpha>(dst, src, length, comp_func_DestinationAtop, const_alpha);
+}
+
+void QT_FASTCALL comp_func_XOR_neon(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    comp_func_porter_duff_neon<PorterDuffInvDstAlpha, PorterDuffInvSrcAlpha>(dst, src, length, comp_func_XOR, const_alpha);
+}
+
 #if defined(ENABLE_PIXMAN_DRAWHELPERS)
 static const int tileSize = 32;
 
@@ -136,6 +136,14 @@ void QT_FASTCALL qt_destStoreRGB16_neon(QRasterBuffer *rasterBuffer,
 
 void QT_FASTCALL comp_func_solid_SourceOver_neon(uint *destPixels, int length, uint color, uint const_alpha);
 void QT_FASTCALL comp_func_Plus_neon(uint *dst, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_DestinationOver_neon(uint *dst, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_SourceIn_neon(uint *dst, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_DestinationIn_neon(uint *dst, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_SourceOut_neon(uint *dst, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_DestinationOut_neon(uint *dst, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_SourceAtop_neon(uint *dst, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_DestinationAtop_neon(uint *dst, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_XOR_neon(uint *dst, const uint *src, int length, uint const_alpha);
 
 const uint * QT_FASTCALL qt_fetchUntransformed_888_neon(uint *buffer, const Operator *, const QSpanData *data,
                                                        int y, int x, int length);
@@ -991,6 +991,178 @@ static void qt_qimageScaleAARGB_down_xy(QImageScaleInfo *isi, unsigned int *dest
     multithread_pixels_function(isi, dh, scaleSection);
 }
 
+inline static void qt_qimageScaleGray8_helper(const uchar *pix, int xyap, int Cxy, int step, int &v)
+{
+    v = *pix * xyap;
+    int j;
+    for (j = (1 << 14) - xyap; j > Cxy; j -= Cxy) {
+        pix += step;
+        v += *pix * Cxy;
+    }
+    pix += step;
+    v += *pix * j;
+}
+
+static void qt_qimageScaleGray8_up_xy(QImageScaleInfo *isi, uchar *dest,
+                                      int dw, int dh, int dow, int sow)
+{
+    const uchar **ypoints = (const uchar **)isi->ypoints;
+    int *xpoints = isi->xpoints;
+    int *xapoints = isi->xapoints;
+    int *yapoints = isi->yapoints;
+
+    auto scaleSection = [&] (int yStart, int yEnd) {
+        for (int y = yStart; y < yEnd; ++y) {
+            const uchar *sptr = ypoints[y];
+            uchar *dptr = dest + (y * dow);
+            const int yap = yapoints[y];
+            if (yap > 0) {
+                for (int x = 0; x < dw; x++) {
+                    const uchar *pix = sptr + xpoints[x];
+                    const int xap = xapoints[x];
+                    if (xap > 0) {
+                        const int top = (pix[0] * (256 - xap) + pix[1] * xap) >> 8;
+                        const int bottom = (pix[sow] * (256 - xap) + pix[sow + 1] * xap) >> 8;
+                        *dptr = (top * (256 - yap) + bottom * yap) >> 8;
+                    } else {
+                        *dptr = (pix[0] * (256 - yap) + pix[sow] * yap) >> 8;
+                    }
+                    dptr++;
+                }
+            } else {
+                for (int x = 0; x < dw; x++) {
+                    const uchar *pix = sptr + xpoints[x];
+                    const int xap = xapoints[x];
+                    if (xap > 0)
+                        *dptr = (pix[0] * (256 - xap) + pix[1] * xap) >> 8;
+                    else
+                        *dptr = pix[0];
+                    dptr++;
+                }
+            }
+        }
+    };
+    multithread_pixels_function(isi, dh, scaleSection);
+}
+
+static void qt_qimageScaleGray8_up_x_down_y(QImageScaleInfo *isi, uchar *dest,
+                                            int dw, int dh, int dow, int sow)
+{
+    const uchar **ypoints = (const uchar **)isi->ypoints;
+    int *xpoints = isi->xpoints;
+    int *xapoints = isi->xapoints;
+    int *yapoints = isi->yapoints;
+
+    auto scaleSection = [&] (int yStart, int yEnd) {
+        for (int y = yStart; y < yEnd; ++y) {
+            int Cy = yapoints[y] >> 16;
+            int yap = yapoints[y] & 0xffff;
+
+            uchar *dptr = dest + (y * dow);
+            for (int x = 0; x < dw; x++) {
+                const uchar *sptr = ypoints[y] + xpoints[x];
+                int v;
+                qt_qimageScaleGray8_helper(sptr, yap, Cy, sow, v);
+
+                int xap = xapoints[x];
+                if (xap > 0) {
+                    int vv;
+                    qt_qimageScaleGray8_helper(sptr + 1, yap, Cy, sow, vv);
+                    v = (v * (256 - xap) + vv * xap) >> 8;
+                }
+                *dptr++ = v >> 14;
+            }
+        }
+    };
+    multithread_pixels_function(isi, dh, scaleSection);
+}
+
+static void qt_qimageScaleGray8_down_x_up_y(QImageScaleInfo *isi, uchar *dest,
+                                            int dw, int dh, int dow, int sow)
+{
+    const uchar **ypoints = (const uchar **)isi->ypoints;
+    int *xpoints = isi->xpoints;
+    int *xapoints = isi->xapoints;
+    int *yapoints = isi->yapoints;
+
+    auto scaleSection = [&] (int yStart, int yEnd) {
+        for (int y = yStart; y < yEnd; ++y) {
+            uchar *dptr = dest + (y * dow);
+            for (int x = 0; x < dw; x++) {
+                int Cx = xapoints[x] >> 16;
+                int xap = xapoints[x] & 0xffff;
+
+                const uchar *sptr = ypoints[y] + xpoints[x];
+                int v;
+                qt_qimageScaleGray8_helper(sptr, xap, Cx, 1, v);
+
+                int yap = yapoints[y];
+                if (yap > 0) {
+                    int vv;
+                    qt_qimageScaleGray8_helper(sptr + sow, xap, Cx, 1, vv);
+                    v = (v * (256 - yap) + vv * yap) >> 8;
+                }
+                *dptr++ = v >> 14;
+            }
+        }
+    };
+    multithread_pixels_function(isi, dh, scaleSection);
+}
+
+static void qt_qimageScaleGray8_down_xy(QImageScaleInfo *isi, uchar *dest,
+                                        int dw, int dh, int dow, int sow)
+{
+    const uchar **ypoints = (const uchar **)isi->ypoints;
+    int *xpoints = isi->xpoints;
+    int *xapoints = isi->xapoints;
+    int *yapoints = isi->yapoints;
+
+    auto scaleSection = [&] (int yStart, int yEnd) {
+        for (int y = yStart; y < yEnd; ++y) {
+            int Cy = yapoints[y] >> 16;
+            int yap = yapoints[y] & 0xffff;
+
+            uchar *dptr = dest + (y * dow);
+            for (int x = 0; x < dw; x++) {
+                int Cx = xapoints[x] >> 16;
+                int xap = xapoints[x] & 0xffff;
+
+                const uchar *sptr = ypoints[y] + xpoints[x];
+                int vx;
+                qt_qimageScaleGray8_helper(sptr, xap, Cx, 1, vx);
+                int v = (vx >> 4) * yap;
+
+                int j;
+                for (j = (1 << 14) - yap; j > Cy; j -= Cy) {
+                    sptr += sow;
+                    qt_qimageScaleGray8_helper(sptr, xap, Cx, 1, vx);
+                    v += (vx >> 4) * Cy;
+                }
+                sptr += sow;
+                qt_qimageScaleGray8_helper(sptr, xap, Cx, 1, vx);
+                v += (vx >> 4) * j;
+
+                *dptr++ = v >> 24;
+            }
+        }
+    };
+    multithread_pixels_function(isi, dh, scaleSection);
+}
+
+/* scale by area sampling - single 8-bit channel */
+static void qt_qimageScaleGray8(QImageScaleInfo *isi, uchar *dest,
+                                int dw, int dh, int dow, int sow)
+{
+    if (isi->xup_yup == 3)
+        qt_qimageScaleGray8_up_xy(isi, dest, dw, dh, dow, sow);
+    else if (isi->xup_yup == 1)
+        qt_qimageScaleGray8_up_x_down_y(isi, dest, dw, dh, dow, sow);
+    else if (isi->xup_yup == 2)
+        qt_qimageScaleGray8_down_x_up_y(isi, dest, dw, dh, dow, sow);
+    else
+        qt_qimageScaleGray8_down_xy(isi, dest, dw, dh, dow, sow);
+}
+
 QImage qSmoothScaleImage(const QImage &src, int dw, int dh)
 {
     QImage buffer;
@@ -1011,6 +1183,10 @@ QImage qSmoothScaleImage(const QImage &src, int dw, int dh)
         return QImage();
     }
 
+    if (src.format() == QImage::Format_Grayscale8)
+        qt_qimageScaleGray8(scaleinfo, buffer.scanLine(0),
+                            dw, dh, buffer.bytesPerLine(), src.bytesPerLine());
+    else
 #if QT_CONFIG(raster_64bit)
     if (src.depth() > 32)
         qt_qimageScaleRgba64(scaleinfo, (QRgba64 *)buffer.scanLine(0),
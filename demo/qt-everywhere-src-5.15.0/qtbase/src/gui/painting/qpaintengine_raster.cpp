@@ -39,6 +39,12 @@
 
 #include <QtCore/qglobal.h>
 #include <QtCore/qmutex.h>
+#if QT_CONFIG(thread)
+#include <QtCore/qsemaphore.h>
+#include <QtCore/qthreadpool.h>
+#endif
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qthread.h>
 
 #define QT_FT_BEGIN_HEADER
 #define QT_FT_END_HEADER
@@ -420,6 +426,7 @@ void QRasterPaintEngine::init()
     d->deviceDepth = d->device->depth();
 
     d->mono_surface = false;
+    d->tiled_blending = false;
     gccaps &= ~PorterDuff;
 
     QImage::Format format = QImage::Format_Invalid;
@@ -457,6 +464,14 @@ QRasterPaintEngine::~QRasterPaintEngine()
 {
     Q_D(QRasterPaintEngine);
 
+    // The cached outlines live in the paths and may outlive us, so detach them
+    while (!d->strokeCaches.isEmpty()) {
+        QVectorPath::CacheEntry *e = *d->strokeCaches.constBegin();
+        e->cleanup(e->engine, e->data);
+        e->data = nullptr;
+        e->engine = nullptr;
+    }
+
     qt_ft_grays_raster.raster_done(*d->grayRaster.data());
 }
 
@@ -505,6 +520,9 @@ bool QRasterPaintEngine::begin(QPaintDevice *device)
 
     d->rasterBuffer->compositionMode = QPainter::CompositionMode_SourceOver;
 
+    d->tiled_blending = d->device->devType() == QInternal::Image
+                        && static_cast<QImage *>(d->device)->isParallelPaintingEnabled();
+
     setDirty(DirtyBrushOrigin);
 
 #ifdef QT_DEBUG_DRAW
@@ -1474,6 +1492,127 @@ void QRasterPaintEngine::fillPath(const QPainterPath &path, QSpanData *fillData)
     d->rasterize(d->outlineMapper->convertPath(path), blend, fillData, d->rasterBuffer.data());
 }
 
+#if QT_CONFIG(thread)
+/*!
+    \internal
+
+    Collects the spans of a single primitive in tiles of TileHeight scanlines
+    and blends the tiles on the global thread pool when it is destroyed. The
+    spans of a tile are passed on in the order and in the batches in which
+    they were recorded, and no two tiles share a scanline, so the result is
+    identical to blending the spans directly.
+*/
+class QRasterTileBlender
+{
+public:
+    QRasterTileBlender(ProcessSpans blend, QSpanData *data, const QRect &deviceRect)
+        : m_blend(blend)
+        , m_data(data)
+        , m_top(deviceRect.top())
+        , m_batch(0)
+        , m_pixelCount(0)
+        , m_tiles(qMax(1, (deviceRect.height() + TileHeight - 1) / TileHeight))
+    {
+    }
+
+    ~QRasterTileBlender()
+    {
+        flush();
+    }
+
+    static void recordSpans(int count, const QT_FT_Span *spans, void *userData);
+
+private:
+    enum {
+        TileHeight = 64,
+        MinimumPixelCount = 1 << 16
+    };
+
+    struct Tile {
+        QVector<QT_FT_Span> spans;
+        QVector<int> batchStarts;
+        int lastBatch = -1;
+    };
+
+    void blendTile(const Tile &tile) const;
+    void flush();
+
+    ProcessSpans m_blend;
+    QSpanData *m_data;
+    int m_top;
+    int m_batch;
+    qint64 m_pixelCount;
+    QVector<Tile> m_tiles;
+};
+
+void QRasterTileBlender::recordSpans(int count, const QT_FT_Span *spans, void *userData)
+{
+    QRasterTileBlender *blender = static_cast<QRasterTileBlender *>(userData);
+    const int batch = blender->m_batch++;
+    const int lastTile = blender->m_tiles.size() - 1;
+    Tile *tiles = blender->m_tiles.data();
+
+    for (int i = 0; i < count; ++i) {
+        const QT_FT_Span &span = spans[i];
+        Tile &tile = tiles[qBound(0, (span.y - blender->m_top) / TileHeight, lastTile)];
+        if (tile.lastBatch != batch) {
+            tile.batchStarts.append(tile.spans.size());
+            tile.lastBatch = batch;
+        }
+        tile.spans.append(span);
+        blender->m_pixelCount += span.len;
+    }
+}
+
+void QRasterTileBlender::blendTile(const Tile &tile) const
+{
+    const int batchCount = tile.batchStarts.size();
+    for (int i = 0; i < batchCount; ++i) {
+        const int start = tile.batchStarts.at(i);
+        const int end = i + 1 < batchCount ? tile.batchStarts.at(i + 1) : tile.spans.size();
+        m_blend(end - start, tile.spans.constData() + start, m_data);
+    }
+}
+
+void QRasterTileBlender::flush()
+{
+    const Tile *tiles = m_tiles.constData();
+    const int tileCount = m_tiles.size();
+
+    if (m_pixelCount < MinimumPixelCount) {
+        for (int i = 0; i < tileCount; ++i)
+            blendTile(tiles[i]);
+        return;
+    }
+
+    // The clip spans are built on first use, which must not happen on
+    // several threads at once.
+    if (m_data->clip)
+        const_cast<QClipData *>(m_data->clip)->initialize();
+
+    QAtomicInt nextTile(0);
+    const auto blendTiles = [&]() {
+        for (int i = nextTile.fetchAndAddRelaxed(1); i < tileCount; i = nextTile.fetchAndAddRelaxed(1))
+            blendTile(tiles[i]);
+    };
+
+    // Only wait for helpers that actually started, so that painting from a
+    // thread of the global pool cannot deadlock when the pool is exhausted.
+    QSemaphore semaphore;
+    QThreadPool *threadPool = QThreadPool::globalInstance();
+    const int maxHelpers = qMin(QThread::idealThreadCount(), tileCount) - 1;
+    int helpers = 0;
+    while (helpers < maxHelpers && threadPool->tryStart([&]() {
+                blendTiles();
+                semaphore.release(1);
+            })) {
+        ++helpers;
+    }
+    blendTiles();
+    semaphore.acquire(helpers);
+}
+#endif // QT_CONFIG(thread)
+
 static void fillRect_normalized(const QRect &r, QSpanData *data,
                                 QRasterPaintEnginePrivate *pe)
 {
@@ -1522,6 +1661,16 @@ static void fillRect_normalized(const QRect &r, QSpanData *data,
     }
 
     ProcessSpans blend = isUnclipped ? data->unclipped_blend : data->blend;
+    void *userData = data;
+
+#if QT_CONFIG(thread)
+    QScopedPointer<QRasterTileBlender> tileBlender;
+    if (pe && pe->tiled_blending) {
+        tileBlender.reset(new QRasterTileBlender(blend, data, pe->deviceRect));
+        blend = QRasterTileBlender::recordSpans;
+        userData = tileBlender.data();
+    }
+#endif
 
     const int nspans = 256;
     QT_FT_Span spans[nspans];
@@ -1539,7 +1688,7 @@ static void fillRect_normalized(const QRect &r, QSpanData *data,
             ++i;
         }
 
-        blend(n, spans, data);
+        blend(n, spans, userData);
         y += n;
     }
 }
@@ -1655,6 +1804,167 @@ void QRasterPaintEngine::drawRects(const QRectF *rects, int rectCount)
 /*!
     \internal
 */
+namespace {
+struct QRasterStrokeCache
+{
+    QVectorPath::CacheEntry *entry;
+    QPen pen;
+    QVector<qreal> points;
+    QVector<QPainterPath::ElementType> types;
+    uint flags;
+};
+}
+
+static void qt_stroke_cache_move_to(qfixed x, qfixed y, void *data)
+{
+    QRasterStrokeCache *cache = static_cast<QRasterStrokeCache *>(data);
+    cache->points << qt_fixed_to_real(x) << qt_fixed_to_real(y);
+    cache->types << QPainterPath::MoveToElement;
+}
+
+static void qt_stroke_cache_line_to(qfixed x, qfixed y, void *data)
+{
+    QRasterStrokeCache *cache = static_cast<QRasterStrokeCache *>(data);
+    cache->points << qt_fixed_to_real(x) << qt_fixed_to_real(y);
+    cache->types << QPainterPath::LineToElement;
+}
+
+static void qt_stroke_cache_cubic_to(qfixed c1x, qfixed c1y,
+                                     qfixed c2x, qfixed c2y,
+                                     qfixed ex, qfixed ey,
+                                     void *data)
+{
+    QRasterStrokeCache *cache = static_cast<QRasterStrokeCache *>(data);
+    cache->points << qt_fixed_to_real(c1x) << qt_fixed_to_real(c1y)
+                  << qt_fixed_to_real(c2x) << qt_fixed_to_real(c2y)
+                  << qt_fixed_to_real(ex) << qt_fixed_to_real(ey);
+    cache->types << QPainterPath::CurveToElement
+                 << QPainterPath::CurveToDataElement
+                 << QPainterPath::CurveToDataElement;
+}
+
+void QRasterPaintEnginePrivate::cleanupStrokeCache(QPaintEngineEx *engine, void *data)
+{
+    QRasterStrokeCache *cache = static_cast<QRasterStrokeCache *>(data);
+    static_cast<QRasterPaintEngine *>(engine)->d_func()->strokeCaches.remove(cache->entry);
+    delete cache;
+}
+
+/*!
+    \internal
+
+    Strokes \a path with the solid, non-cosmetic \a pen using an outline
+    cached in the path. Such outlines are generated in logical coordinates
+    and do not depend on the transform, so repeated draws of an unchanged
+    QPainterPath, e.g. while panning or zooming, only need to be filled.
+
+    Like the GL engines, a path is only cached once it has been drawn
+    twice. Returns \c false if the path was not stroked.
+*/
+bool QRasterPaintEnginePrivate::strokeFromCache(const QVectorPath &path, const QPen &pen)
+{
+    Q_Q(QRasterPaintEngine);
+
+    if (qpen_style(pen) != Qt::SolidLine || qt_pen_is_cosmetic(pen, q->state()->renderHints))
+        return false;
+
+    // The cache entries of a path are not synchronized, and QPainterPaths
+    // are implicitly shared, so only cache in the GUI thread.
+    if (!QCoreApplication::instance() || QThread::currentThread() != QCoreApplication::instance()->thread())
+        return false;
+
+    if (!path.isCacheable()) {
+        path.makeCacheable();
+        return false;
+    }
+
+    QVectorPath::CacheEntry *entry = path.lookupCacheData(q);
+    QRasterStrokeCache *cache;
+    bool updateCache = false;
+    if (entry) {
+        cache = static_cast<QRasterStrokeCache *>(entry->data);
+        updateCache = !qpen_fast_equals(cache->pen, pen);
+    } else {
+        cache = new QRasterStrokeCache;
+        cache->entry = path.addCacheData(q, cache, cleanupStrokeCache);
+        strokeCaches.insert(cache->entry);
+        updateCache = true;
+    }
+
+    if (updateCache) {
+        cache->pen = pen;
+        cache->points.clear();
+        cache->types.clear();
+        cache->flags = QVectorPath::WindingFill;
+        if (path.elementCount() > 2)
+            cache->flags |= QVectorPath::NonConvexShapeMask;
+        if (pen.capStyle() == Qt::RoundCap || pen.joinStyle() == Qt::RoundJoin)
+            cache->flags |= QVectorPath::CurvedShapeMask;
+
+        QStroker stroker;
+        stroker.setMoveToHook(qt_stroke_cache_move_to);
+        stroker.setLineToHook(qt_stroke_cache_line_to);
+        stroker.setCubicToHook(qt_stroke_cache_cubic_to);
+        stroker.setJoinStyle(pen.joinStyle());
+        stroker.setCapStyle(pen.capStyle());
+        stroker.setMiterLimit(pen.miterLimit());
+        stroker.setStrokeWidth(qt_real_to_fixed(pen.widthF()));
+        stroker.setForceOpen(path.hasExplicitOpen());
+
+        const QPainterPath::ElementType *types = path.elements();
+        const qreal *points = path.points();
+        const qreal *lastPoint = points + (path.elementCount() << 1);
+
+        stroker.begin(cache);
+        if (types) {
+            while (points < lastPoint) {
+                switch (*types) {
+                case QPainterPath::MoveToElement:
+                    stroker.moveTo(qt_real_to_fixed(points[0]), qt_real_to_fixed(points[1]));
+                    points += 2;
+                    ++types;
+                    break;
+                case QPainterPath::LineToElement:
+                    stroker.lineTo(qt_real_to_fixed(points[0]), qt_real_to_fixed(points[1]));
+                    points += 2;
+                    ++types;
+                    break;
+                case QPainterPath::CurveToElement:
+                    stroker.cubicTo(qt_real_to_fixed(points[0]), qt_real_to_fixed(points[1]),
+                                    qt_real_to_fixed(points[2]), qt_real_to_fixed(points[3]),
+                                    qt_real_to_fixed(points[4]), qt_real_to_fixed(points[5]));
+                    points += 6;
+                    types += 3;
+                    cache->flags |= QVectorPath::CurvedShapeMask;
+                    break;
+                default:
+                    // Only reached on malformed element lists; avoid looping forever
+                    points += 2;
+                    ++types;
+                    break;
+                }
+            }
+        } else {
+            stroker.moveTo(qt_real_to_fixed(points[0]), qt_real_to_fixed(points[1]));
+            points += 2;
+            while (points < lastPoint) {
+                stroker.lineTo(qt_real_to_fixed(points[0]), qt_real_to_fixed(points[1]));
+                points += 2;
+            }
+        }
+        if (path.hasImplicitClose())
+            stroker.lineTo(qt_real_to_fixed(path.points()[0]), qt_real_to_fixed(path.points()[1]));
+        stroker.end();
+    }
+
+    if (!cache->types.isEmpty()) {
+        QVectorPath strokePath(cache->points.constData(), cache->types.size(),
+                               cache->types.constData(), cache->flags);
+        q->fill(strokePath, pen.brush());
+    }
+    return true;
+}
+
 void QRasterPaintEngine::stroke(const QVectorPath &path, const QPen &pen)
 {
     Q_D(QRasterPaintEngine);
@@ -1720,9 +2030,9 @@ void QRasterPaintEngine::stroke(const QVectorPath &path, const QPen &pen)
                 d->rasterizeLine_dashed(line, width, &dIndex, &dOffset, &inD);
             }
         }
-    }
-    else
+    } else if (!d->strokeFromCache(path, pen)) {
         QPaintEngineEx::stroke(path, pen);
+    }
 }
 
 QRect QRasterPaintEngine::toNormalizedFillRect(const QRectF &rect)
@@ -3646,7 +3956,7 @@ static inline uchar *alignAddress(uchar *address, quintptr alignmentMask)
 
 void QRasterPaintEnginePrivate::rasterize(QT_FT_Outline *outline,
                                           ProcessSpans callback,
-                                          void *userData, QRasterBuffer *)
+                                          void *userData, QRasterBuffer *rasterBuffer)
 {
     if (!callback || !outline)
         return;
@@ -3654,6 +3964,19 @@ void QRasterPaintEnginePrivate::rasterize(QT_FT_Outline *outline,
     Q_Q(QRasterPaintEngine);
     QRasterPaintEngineState *s = q->state();
 
+#if QT_CONFIG(thread)
+    // Callers that blend into the device pass its raster buffer, and their
+    // user data is the QSpanData; clip construction passes no buffer.
+    QScopedPointer<QRasterTileBlender> tileBlender;
+    if (rasterBuffer && tiled_blending) {
+        tileBlender.reset(new QRasterTileBlender(callback, static_cast<QSpanData *>(userData), deviceRect));
+        callback = QRasterTileBlender::recordSpans;
+        userData = tileBlender.data();
+    }
+#else
+    Q_UNUSED(rasterBuffer);
+#endif
+
     if (!s->flags.antialiased) {
         rasterizer->setAntialiased(s->flags.antialiased);
         rasterizer->setLegacyRoundingEnabled(s->flags.legacy_rounding);
@@ -62,6 +62,9 @@
 #include "private/qpainter_p.h"
 #include "private/qtextureglyphcache_p.h"
 #include "private/qoutlinemapper_p.h"
+#include "private/qvectorpath_p.h"
+
+#include <QtCore/qset.h>
 
 #include <stdlib.h>
 
@@ -308,6 +311,9 @@ public:
     bool canUseFastImageBlending(QPainter::CompositionMode mode, const QImage &image) const;
     bool canUseImageBlitting(QPainter::CompositionMode mode, const QImage &image, const QPointF &pt, const QRectF &sr) const;
 
+    bool strokeFromCache(const QVectorPath &path, const QPen &pen);
+    static void cleanupStrokeCache(QPaintEngineEx *engine, void *data);
+
     QPaintDevice *device;
     QScopedPointer<QOutlineMapper> outlineMapper;
     QScopedPointer<QRasterBuffer>  rasterBuffer;
@@ -338,8 +344,11 @@ public:
 
     uint mono_surface : 1;
     uint outlinemapper_xform_dirty : 1;
+    uint tiled_blending : 1;
 
     QScopedPointer<QRasterizer> rasterizer;
+
+    QSet<QVectorPath::CacheEntry *> strokeCaches;
 };
 
 
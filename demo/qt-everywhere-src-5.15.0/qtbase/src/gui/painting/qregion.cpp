@@ -49,6 +49,7 @@
 #include "qtransform.h"
 
 #include <private/qdebug_p.h>
+#include <private/qsimd_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -1178,9 +1179,15 @@ Q_GUI_EXPORT QPainterPath qt_regionToPath(const QRegion &region)
  */
 
 struct QRegionPrivate {
+    // Most regions produced while painting and repainting consist of only a
+    // handful of rectangles; keep those inline to avoid a heap allocation
+    // on every region operation.
+    enum { InlineRectCount = 4 };
+    typedef QVarLengthArray<QRect, InlineRectCount> RectArray;
+
     int numRects;
     int innerArea;
-    QVector<QRect> rects;
+    RectArray rects;
     QRect extents;
     QRect innerRect;
 
@@ -2078,6 +2085,28 @@ static void miIntersectO(QRegionPrivate &dest, const QRect *r1, const QRect *r1E
  *
  *-----------------------------------------------------------------------
  */
+static inline bool miBandsLineUp(const QRect *prevBox, const QRect *curBox, int numRects)
+{
+#ifdef __SSE2__
+    // QRect stores x1, y1, x2, y2; compare a whole rectangle at once and
+    // only look at the bytes of x1 and x2.
+    Q_STATIC_ASSERT(sizeof(QRect) == sizeof(__m128i));
+    const QRect *prevEnd = prevBox + numRects;
+    for (; prevBox != prevEnd; ++prevBox, ++curBox) {
+        const __m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i *>(prevBox));
+        const __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i *>(curBox));
+        if ((_mm_movemask_epi8(_mm_cmpeq_epi32(prev, cur)) & 0x0f0f) != 0x0f0f)
+            return false;
+    }
+#else
+    for (int i = 0; i < numRects; ++i) {
+        if (prevBox[i].left() != curBox[i].left() || prevBox[i].right() != curBox[i].right())
+            return false;
+    }
+#endif
+    return true;
+}
+
 static int miCoalesce(QRegionPrivate &dest, int prevStart, int curStart)
 {
     QRect *pPrevBox;   /* Current box in previous band */
@@ -2131,19 +2160,12 @@ static int miCoalesce(QRegionPrivate &dest, int prevStart, int curStart)
              * cover the most area possible. I.e. two boxes in a band must
              * have some horizontal space between them.
              */
-            do {
-                if (pPrevBox->left() != pCurBox->left() || pPrevBox->right() != pCurBox->right()) {
-                     // The bands don't line up so they can't be coalesced.
-                    return curStart;
-                }
-                ++pPrevBox;
-                ++pCurBox;
-                --prevNumRects;
-            } while (prevNumRects != 0);
+            if (!miBandsLineUp(pPrevBox, pCurBox, curNumRects)) {
+                // The bands don't line up so they can't be coalesced.
+                return curStart;
+            }
 
             dest.numRects -= curNumRects;
-            pCurBox -= curNumRects;
-            pPrevBox -= curNumRects;
 
             /*
              * The bands may be merged, so set the bottom y of each box
@@ -2241,19 +2263,23 @@ static void miRegionOp(QRegionPrivate &dest,
     else
         r2 = reg2->rects.constData();
 
-    r1End = r1 + reg1->numRects;
-    r2End = r2 + reg2->numRects;
-
-    dest.vectorize();
-
     /*
-     * The following calls are going to detach dest.rects. Since dest might be
-     * aliasing *reg1 and/or *reg2, and we could have active iterators on
+     * The following calls are going to overwrite dest.rects. Since dest might
+     * be aliasing *reg1 and/or *reg2, and we could have active iterators on
      * reg1->rects and reg2->rects (if the regions have more than 1 rectangle),
-     * take a copy of dest.rects to keep those iteractors valid.
+     * take a copy of the aliased rectangles and iterate over that instead.
      */
-    const QVector<QRect> destRectsCopy = dest.rects;
-    Q_UNUSED(destRectsCopy);
+    QRegionPrivate::RectArray srcRectsCopy;
+    if (dest.numRects > 1 && (&dest == reg1 || &dest == reg2)) {
+        srcRectsCopy.append(dest.rects.constData(), dest.numRects);
+        if (&dest == reg1)
+            r1 = srcRectsCopy.constData();
+        if (&dest == reg2)
+            r2 = srcRectsCopy.constData();
+    }
+
+    r1End = r1 + reg1->numRects;
+    r2End = r2 + reg2->numRects;
 
     dest.numRects = 0;
 
@@ -2263,7 +2289,10 @@ static void miRegionOp(QRegionPrivate &dest,
      * reallocate and copy the array, which is time consuming, yet we don't
      * have to worry about using too much memory. I hope to be able to
      * nuke the realloc() at the end of this function eventually.
+     * The old contents are dropped first, so that growing the array does
+     * not copy rectangles that are going to be overwritten anyway.
      */
+    dest.rects.clear();
     dest.rects.resize(qMax(reg1->numRects,reg2->numRects) * 2);
 
     /*
@@ -2405,8 +2434,10 @@ static void miRegionOp(QRegionPrivate &dest,
      * Only do this stuff if the number of rectangles allocated is more than
      * twice the number of rectangles in the region (a simple optimization).
      */
-    if (qMax(4, dest.numRects) < (dest.rects.size() >> 1))
+    if (qMax(4, dest.numRects) < (dest.rects.size() >> 1)) {
         dest.rects.resize(dest.numRects);
+        dest.rects.squeeze();
+    }
 }
 
 /*======================================================================
@@ -4316,10 +4347,7 @@ bool qt_region_strictContains(const QRegion &region, const QRect &rect)
 QVector<QRect> QRegion::rects() const
 {
     if (d->qt_rgn) {
-        d->qt_rgn->vectorize();
-        d->qt_rgn->rects.reserve(d->qt_rgn->numRects);
-        d->qt_rgn->rects.resize(d->qt_rgn->numRects);
-        return d->qt_rgn->rects;
+        return QVector<QRect>(d->qt_rgn->begin(), d->qt_rgn->end());
     } else {
         return QVector<QRect>();
     }
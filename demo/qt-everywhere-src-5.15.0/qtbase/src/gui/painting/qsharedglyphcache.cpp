@@ -0,0 +1,379 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qsharedglyphcache_p.h"
+
+#ifdef QT_SHARED_GLYPH_CACHE
+
+#include <qcolor.h>
+#include <qcryptographichash.h>
+#include <qdatetime.h>
+#include <qfile.h>
+#include <qfileinfo.h>
+#include <qtransform.h>
+
+#include <private/qimage_p.h>
+
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+enum {
+    SharedGlyphCacheMagic = 0x51474300, // "QGC"
+    SharedGlyphCacheVersion = 1,
+    MaxSharedGlyphCacheProbes = 32,
+    MaxSharedGlyphSize = 4096
+};
+
+enum SlotKind : quint32 {
+    EmptySlot,
+    MetricsSlot,
+    ImageSlot
+};
+
+struct QSharedGlyphCache::Header
+{
+    quint32 magic;
+    quint32 version;
+    quint32 slotCount;
+    quint32 reserved;
+    quint64 dataUsed;
+};
+
+// Metrics slots keep x, y, width, height, xoff and yoff in values, image
+// slots the width and height, with the pixels at dataOffset.
+struct QSharedGlyphCache::Slot
+{
+    quint64 fontKey;
+    quint32 glyph;
+    qint32 subPixelPosition;
+    quint32 kind;
+    quint32 format;
+    qint32 values[6];
+    quint32 bytesPerLine;
+    quint32 reserved;
+    quint64 dataOffset;
+};
+
+Q_GLOBAL_STATIC(QSharedGlyphCache, sharedGlyphCache)
+
+static inline quint64 slotHash(quint64 fontKey, glyph_t glyph, QFixed subPixelPosition, quint32 kind)
+{
+    quint64 h = fontKey ^ ((quint64(glyph) << 32 | quint32(subPixelPosition.value())) * Q_UINT64_C(0x9e3779b97f4a7c15));
+    h ^= kind;
+    h ^= h >> 33;
+    h *= Q_UINT64_C(0xff51afd7ed558ccd);
+    h ^= h >> 33;
+    return h;
+}
+
+static inline bool isShareableImageFormat(QImage::Format format)
+{
+    switch (format) {
+    case QImage::Format_Alpha8:
+    case QImage::Format_Grayscale8:
+    case QImage::Format_RGB32:
+    case QImage::Format_ARGB32:
+    case QImage::Format_ARGB32_Premultiplied:
+        return true;
+    default:
+        return false;
+    }
+}
+
+QSharedGlyphCache::QSharedGlyphCache()
+    : m_memory(QStringLiteral("qt-shared-glyph-cache-" QT_VERSION_STR)),
+      m_header(nullptr),
+      m_size(0)
+{
+    const int megabytes = qEnvironmentVariableIntValue("QT_SHARED_GLYPH_CACHE");
+    if (megabytes > 0 && !attach(qMin(megabytes, 1024) * 1024 * 1024))
+        qWarning("QSharedGlyphCache: Cannot use the shared glyph cache: %s", qPrintable(m_memory.errorString()));
+}
+
+QSharedGlyphCache::~QSharedGlyphCache()
+{
+}
+
+/*!
+    \internal
+
+    Returns the process wide shared glyph cache, or \nullptr if it is not
+    enabled or cannot be attached to.
+*/
+QSharedGlyphCache *QSharedGlyphCache::instance()
+{
+    static const bool enabled = qEnvironmentVariableIntValue("QT_SHARED_GLYPH_CACHE") > 0;
+    if (!enabled)
+        return nullptr;
+    QSharedGlyphCache *cache = sharedGlyphCache();
+    return cache && cache->m_header ? cache : nullptr;
+}
+
+bool QSharedGlyphCache::attach(int size)
+{
+    if (!m_memory.create(size)) {
+        if (m_memory.error() != QSharedMemory::AlreadyExists || !m_memory.attach())
+            return false;
+    }
+
+    const quint32 memorySize = quint32(m_memory.size());
+    if (memorySize < sizeof(Header) + 64 * sizeof(Slot) || !m_memory.lock()) {
+        m_memory.detach();
+        return false;
+    }
+
+    // The memory is zero initialized by whoever created it, so the first
+    // process to lock it sets up the slot table.
+    Header *header = static_cast<Header *>(m_memory.data());
+    if (header->magic == 0) {
+        quint32 slotCount = 64;
+        while (slotCount * 2 * sizeof(Slot) <= memorySize / 8 && slotCount * 2 <= memorySize / 1024)
+            slotCount *= 2;
+        header->version = SharedGlyphCacheVersion;
+        header->slotCount = slotCount;
+        header->dataUsed = sizeof(Header) + slotCount * sizeof(Slot);
+        header->magic = SharedGlyphCacheMagic;
+    }
+
+    const quint32 slotCount = header->slotCount;
+    const bool valid = header->magic == SharedGlyphCacheMagic
+            && header->version == SharedGlyphCacheVersion
+            && slotCount >= 64 && (slotCount & (slotCount - 1)) == 0
+            && sizeof(Header) + quint64(slotCount) * sizeof(Slot) <= memorySize;
+    m_memory.unlock();
+
+    if (!valid) {
+        m_memory.detach();
+        return false;
+    }
+
+    m_header = header;
+    m_size = memorySize;
+    return true;
+}
+
+/*!
+    \internal
+
+    Returns a key that identifies the glyphs rendered by \a fontEngine in
+    \a format with \a transform and \a color across processes.
+*/
+quint64 QSharedGlyphCache::fontKey(QFontEngine *fontEngine, QFontEngine::GlyphFormat format,
+                                   const QTransform &transform, const QColor &color)
+{
+    const QFontEngine::FaceId faceId = fontEngine->faceId();
+    if (faceId.filename.isEmpty())
+        return 0;
+
+    // Another process may have another version of the font file loaded
+    const QFileInfo fileInfo(QFile::decodeName(faceId.filename));
+    if (!fileInfo.exists())
+        return 0;
+
+    const QFontDef &fontDef = fontEngine->fontDef;
+    const qreal values[] = {
+        qreal(fileInfo.size()),
+        qreal(fileInfo.lastModified().toMSecsSinceEpoch()),
+        qreal(faceId.index),
+        qreal(faceId.encoding),
+        qreal(fontEngine->type()),
+        qreal(fontEngine->synthesized()),
+        fontDef.pixelSize,
+        qreal(fontDef.weight),
+        qreal(fontDef.style),
+        qreal(fontDef.stretch),
+        qreal(fontDef.styleStrategy),
+        qreal(fontDef.hintingPreference),
+        qreal(format),
+        transform.m11(),
+        transform.m12(),
+        transform.m21(),
+        transform.m22(),
+        format == QFontEngine::Format_ARGB ? qreal(color.rgba()) : qreal(0)
+    };
+
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    hash.addData(faceId.filename);
+    hash.addData(faceId.uuid);
+    hash.addData(reinterpret_cast<const char *>(values), sizeof(values));
+    const QByteArray result = hash.result();
+
+    quint64 key;
+    memcpy(&key, result.constData(), sizeof(key));
+    return key ? key : 1;
+}
+
+QSharedGlyphCache::Slot *QSharedGlyphCache::findSlot(quint64 fontKey, glyph_t glyph, QFixed subPixelPosition,
+                                                     quint32 kind, bool insert)
+{
+    const quint32 slotCount = m_header->slotCount;
+    if (slotCount < 64 || (slotCount & (slotCount - 1)) != 0
+        || sizeof(Header) + quint64(slotCount) * sizeof(Slot) > m_size) {
+        return nullptr;
+    }
+
+    Slot *slotTable = reinterpret_cast<Slot *>(m_header + 1);
+    const quint64 h = slotHash(fontKey, glyph, subPixelPosition, kind);
+    for (quint32 i = 0; i < MaxSharedGlyphCacheProbes; ++i) {
+        Slot *slot = slotTable + ((h + i) & (slotCount - 1));
+        if (slot->kind == EmptySlot)
+            return insert ? slot : nullptr;
+        if (slot->kind == kind && slot->fontKey == fontKey && slot->glyph == glyph
+            && slot->subPixelPosition == subPixelPosition.value()) {
+            return insert ? nullptr : slot;
+        }
+    }
+    return nullptr;
+}
+
+bool QSharedGlyphCache::findMetrics(quint64 fontKey, glyph_t glyph, QFixed subPixelPosition,
+                                    glyph_metrics_t *metrics)
+{
+    QMutexLocker locker(&m_mutex);
+    if (!m_memory.lock())
+        return false;
+
+    const Slot *slot = findSlot(fontKey, glyph, subPixelPosition, MetricsSlot, false);
+    if (slot) {
+        metrics->x = QFixed::fromFixed(slot->values[0]);
+        metrics->y = QFixed::fromFixed(slot->values[1]);
+        metrics->width = QFixed::fromFixed(slot->values[2]);
+        metrics->height = QFixed::fromFixed(slot->values[3]);
+        metrics->xoff = QFixed::fromFixed(slot->values[4]);
+        metrics->yoff = QFixed::fromFixed(slot->values[5]);
+    }
+
+    m_memory.unlock();
+    return slot != nullptr;
+}
+
+void QSharedGlyphCache::insertMetrics(quint64 fontKey, glyph_t glyph, QFixed subPixelPosition,
+                                      const glyph_metrics_t &metrics)
+{
+    QMutexLocker locker(&m_mutex);
+    if (!m_memory.lock())
+        return;
+
+    Slot *slot = findSlot(fontKey, glyph, subPixelPosition, MetricsSlot, true);
+    if (slot) {
+        slot->fontKey = fontKey;
+        slot->glyph = glyph;
+        slot->subPixelPosition = subPixelPosition.value();
+        slot->values[0] = metrics.x.value();
+        slot->values[1] = metrics.y.value();
+        slot->values[2] = metrics.width.value();
+        slot->values[3] = metrics.height.value();
+        slot->values[4] = metrics.xoff.value();
+        slot->values[5] = metrics.yoff.value();
+        slot->kind = MetricsSlot;
+    }
+
+    m_memory.unlock();
+}
+
+QImage QSharedGlyphCache::findImage(quint64 fontKey, glyph_t glyph, QFixed subPixelPosition)
+{
+    QMutexLocker locker(&m_mutex);
+    if (!m_memory.lock())
+        return QImage();
+
+    QImage image;
+    const Slot *slot = findSlot(fontKey, glyph, subPixelPosition, ImageSlot, false);
+    if (slot) {
+        const QImage::Format format = QImage::Format(slot->format);
+        const int width = slot->values[0];
+        const int height = slot->values[1];
+        const quint32 bytesPerLine = slot->bytesPerLine;
+        if (isShareableImageFormat(format)
+            && width > 0 && width <= MaxSharedGlyphSize && height > 0 && height <= MaxSharedGlyphSize
+            && bytesPerLine >= quint32(width) * (qt_depthForFormat(format) / 8)
+            && slot->dataOffset <= m_size && quint64(bytesPerLine) * height <= m_size - slot->dataOffset) {
+            image = QImage(width, height, format);
+            const uchar *data = static_cast<const uchar *>(m_memory.constData()) + slot->dataOffset;
+            const int lineSize = qMin(int(bytesPerLine), image.bytesPerLine());
+            for (int y = 0; y < height; ++y)
+                memcpy(image.scanLine(y), data + y * bytesPerLine, lineSize);
+        }
+    }
+
+    m_memory.unlock();
+    return image;
+}
+
+void QSharedGlyphCache::insertImage(quint64 fontKey, glyph_t glyph, QFixed subPixelPosition, const QImage &image)
+{
+    if (!isShareableImageFormat(image.format()) || image.width() <= 0 || image.width() > MaxSharedGlyphSize
+        || image.height() <= 0 || image.height() > MaxSharedGlyphSize) {
+        return;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    if (!m_memory.lock())
+        return;
+
+    const quint32 bytesPerLine = (image.width() * (image.depth() / 8) + 3) & ~3;
+    const quint64 size = quint64(bytesPerLine) * image.height();
+    const quint64 dataUsed = m_header->dataUsed;
+    Slot *slot = dataUsed <= m_size && size <= m_size - dataUsed
+            ? findSlot(fontKey, glyph, subPixelPosition, ImageSlot, true)
+            : nullptr;
+    if (slot) {
+        uchar *data = static_cast<uchar *>(m_memory.data()) + dataUsed;
+        for (int y = 0; y < image.height(); ++y)
+            memcpy(data + y * bytesPerLine, image.constScanLine(y), image.width() * (image.depth() / 8));
+        m_header->dataUsed = dataUsed + size;
+
+        slot->fontKey = fontKey;
+        slot->glyph = glyph;
+        slot->subPixelPosition = subPixelPosition.value();
+        slot->format = image.format();
+        slot->values[0] = image.width();
+        slot->values[1] = image.height();
+        slot->bytesPerLine = bytesPerLine;
+        slot->dataOffset = dataUsed;
+        slot->kind = ImageSlot;
+    }
+
+    m_memory.unlock();
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_SHARED_GLYPH_CACHE
@@ -0,0 +1,118 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QSHAREDGLYPHCACHE_P_H
+#define QSHAREDGLYPHCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtGui/private/qtguiglobal_p.h>
+#include <qimage.h>
+#include <qmutex.h>
+#include <qsharedmemory.h>
+
+#include <private/qfontengine_p.h>
+
+#if !defined(QT_NO_SHAREDMEMORY) && !defined(QT_NO_SYSTEMSEMAPHORE)
+#define QT_SHARED_GLYPH_CACHE
+#endif
+
+QT_BEGIN_NAMESPACE
+
+#ifdef QT_SHARED_GLYPH_CACHE
+
+class QColor;
+class QTransform;
+
+/*
+    Glyph metrics and glyph images rasterized by any process of the same
+    user, kept in one shared memory segment. The segment is only used when
+    QT_SHARED_GLYPH_CACHE is set to its size in megabytes, and lives for as
+    long as one process is attached to it.
+
+    Entries are never removed, once the segment is full new glyphs are no
+    longer added. All data read from the segment is bounds checked, as any
+    process of the user can write to it.
+*/
+class Q_GUI_EXPORT QSharedGlyphCache
+{
+public:
+    static QSharedGlyphCache *instance();
+
+    // Returns 0 if glyphs of this font engine cannot be shared, e.g. for
+    // fonts loaded from memory
+    static quint64 fontKey(QFontEngine *fontEngine, QFontEngine::GlyphFormat format,
+                           const QTransform &transform, const QColor &color);
+
+    bool findMetrics(quint64 fontKey, glyph_t glyph, QFixed subPixelPosition, glyph_metrics_t *metrics);
+    void insertMetrics(quint64 fontKey, glyph_t glyph, QFixed subPixelPosition, const glyph_metrics_t &metrics);
+
+    QImage findImage(quint64 fontKey, glyph_t glyph, QFixed subPixelPosition);
+    void insertImage(quint64 fontKey, glyph_t glyph, QFixed subPixelPosition, const QImage &image);
+
+    QSharedGlyphCache();
+    ~QSharedGlyphCache();
+
+private:
+    struct Header;
+    struct Slot;
+
+    bool attach(int size);
+    Slot *findSlot(quint64 fontKey, glyph_t glyph, QFixed subPixelPosition, quint32 kind, bool insert);
+
+    QMutex m_mutex;
+    QSharedMemory m_memory;
+    Header *m_header;
+    quint32 m_size;
+};
+
+#endif // QT_SHARED_GLYPH_CACHE
+
+QT_END_NAMESPACE
+
+#endif // QSHAREDGLYPHCACHE_P_H
@@ -42,6 +42,7 @@
 #include "qtextureglyphcache_p.h"
 #include "private/qfontengine_p.h"
 #include "private/qnumeric_p.h"
+#include "private/qsharedglyphcache_p.h"
 
 #include <QtGui/qpainterpath.h>
 
@@ -138,7 +139,7 @@ bool QTextureGlyphCache::populate(QFontEngine *fontEngine, int numGlyphs, const
         if (listItemCoordinates.contains(GlyphAndSubPixelPosition(glyph, subPixelPosition)))
             continue;
 
-        glyph_metrics_t metrics = fontEngine->alphaMapBoundingBox(glyph, subPixelPosition, m_transform, m_format);
+        glyph_metrics_t metrics = alphaMapBoundingBox(glyph, subPixelPosition);
 
 #ifdef CACHE_DEBUG
         printf("(%4x): w=%.2f, h=%.2f, xoff=%.2f, yoff=%.2f, x=%.2f, y=%.2f\n",
@@ -263,16 +264,68 @@ void QTextureGlyphCache::fillInPendingGlyphs()
     m_pendingGlyphs.clear();
 }
 
+quint64 QTextureGlyphCache::sharedFontKey() const
+{
+#ifdef QT_SHARED_GLYPH_CACHE
+    if (m_sharedKeyFontEngine != m_current_fontengine) {
+        m_sharedKeyFontEngine = m_current_fontengine;
+        m_sharedFontKey = QSharedGlyphCache::fontKey(m_current_fontengine, m_format, m_transform, color());
+    }
+#endif
+    return m_sharedFontKey;
+}
+
+glyph_metrics_t QTextureGlyphCache::alphaMapBoundingBox(glyph_t glyph, QFixed subPixelPosition) const
+{
+    glyph_metrics_t metrics;
+#ifdef QT_SHARED_GLYPH_CACHE
+    // Getting the bounding box usually means rasterizing the glyph, so
+    // take it from another window or process when possible
+    QSharedGlyphCache *sharedCache = QSharedGlyphCache::instance();
+    const quint64 fontKey = sharedCache ? sharedFontKey() : 0;
+    if (fontKey && sharedCache->findMetrics(fontKey, glyph, subPixelPosition, &metrics))
+        return metrics;
+#endif
+
+    metrics = m_current_fontengine->alphaMapBoundingBox(glyph, subPixelPosition, m_transform, m_format);
+
+#ifdef QT_SHARED_GLYPH_CACHE
+    if (fontKey)
+        sharedCache->insertMetrics(fontKey, glyph, subPixelPosition, metrics);
+#endif
+    return metrics;
+}
+
 QImage QTextureGlyphCache::textureMapForGlyph(glyph_t g, QFixed subPixelPosition) const
 {
+#ifdef QT_SHARED_GLYPH_CACHE
+    QSharedGlyphCache *sharedCache = QSharedGlyphCache::instance();
+    const quint64 fontKey = sharedCache ? sharedFontKey() : 0;
+    if (fontKey) {
+        QImage image = sharedCache->findImage(fontKey, g, subPixelPosition);
+        if (!image.isNull())
+            return image;
+    }
+#endif
+
+    QImage image;
     switch (m_format) {
     case QFontEngine::Format_A32:
-        return m_current_fontengine->alphaRGBMapForGlyph(g, subPixelPosition, m_transform);
+        image = m_current_fontengine->alphaRGBMapForGlyph(g, subPixelPosition, m_transform);
+        break;
     case QFontEngine::Format_ARGB:
-        return m_current_fontengine->bitmapForGlyph(g, subPixelPosition, m_transform, color());
+        image = m_current_fontengine->bitmapForGlyph(g, subPixelPosition, m_transform, color());
+        break;
     default:
-        return m_current_fontengine->alphaMapForGlyph(g, subPixelPosition, m_transform);
+        image = m_current_fontengine->alphaMapForGlyph(g, subPixelPosition, m_transform);
+        break;
     }
+
+#ifdef QT_SHARED_GLYPH_CACHE
+    if (fontKey)
+        sharedCache->insertImage(fontKey, g, subPixelPosition, image);
+#endif
+    return image;
 }
 
 /************************************************************************
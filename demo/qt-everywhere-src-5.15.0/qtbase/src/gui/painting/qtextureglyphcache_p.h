@@ -76,7 +76,8 @@ class Q_GUI_EXPORT QTextureGlyphCache : public QFontEngineGlyphCache
 public:
     QTextureGlyphCache(QFontEngine::GlyphFormat format, const QTransform &matrix, const QColor &color = QColor())
         : QFontEngineGlyphCache(format, matrix, color), m_current_fontengine(nullptr),
-                                               m_w(0), m_h(0), m_cx(0), m_cy(0), m_currentRowHeight(0)
+                                               m_w(0), m_h(0), m_cx(0), m_cy(0), m_currentRowHeight(0),
+                                               m_sharedKeyFontEngine(nullptr), m_sharedFontKey(0)
         { }
 
     ~QTextureGlyphCache();
@@ -145,6 +146,8 @@ public:
 
 protected:
     int calculateSubPixelPositionCount(glyph_t) const;
+    glyph_metrics_t alphaMapBoundingBox(glyph_t glyph, QFixed subPixelPosition) const;
+    quint64 sharedFontKey() const;
 
     QFontEngine *m_current_fontengine;
     QHash<GlyphAndSubPixelPosition, Coord> m_pendingGlyphs;
@@ -154,6 +157,10 @@ protected:
     int m_cx; // current x
     int m_cy; // current y
     int m_currentRowHeight; // Height of last row
+
+private:
+    mutable QFontEngine *m_sharedKeyFontEngine;
+    mutable quint64 m_sharedFontKey; // for the QSharedGlyphCache
 };
 
 inline uint qHash(const QTextureGlyphCache::GlyphAndSubPixelPosition &g)
@@ -582,6 +582,14 @@ Q_LOGGING_CATEGORY(QRHI_LOG_INFO, "qt.rhi.general")
     practice this will be reported as unsupported with OpenGL ES 2.0 and OpenGL
     2.x contexts, because GLSL 100 es and versions before 130 do not support
     this function.
+
+    \value PipelineCache Indicates that the backend can serialize the results
+    of its pipeline and shader compilation through pipelineCacheData(), and
+    restore them with setPipelineCacheData(). In practice this is supported
+    with Vulkan, where the data is the contents of the VkPipelineCache, and
+    with Direct3D 11, where it is the bytecode compiled from HLSL source. With
+    OpenGL this is reported as unsupported, because program binaries are
+    already cached on disk by QOpenGLShaderProgram's program binary cache.
  */
 
 /*!
@@ -3732,6 +3740,37 @@ QRhiResource::Type QRhiSwapChain::resourceType() const
     \sa surfacePixelSize()
   */
 
+/*!
+    \fn QVector<QRect> QRhiSwapChain::presentDamage() const
+
+    \return the damage rectangles set for the current frame, or an empty list
+    when the whole surface is considered changed.
+
+    \since 5.16
+    \sa setPresentDamage()
+  */
+
+/*!
+    \fn void QRhiSwapChain::setPresentDamage(const QVector<QRect> &rects)
+
+    Sets the list of rectangles, in pixels with the top-left corner of the
+    surface as the origin, that changed in the frame that is going to be
+    presented by the next endFrame(). The list is reset in endFrame(). When a
+    frame is ended with QRhi::SkipPresent, the next presented frame is treated
+    as fully changed, regardless of its damage.
+
+    This is only a hint for the presentation engine, which may then do less
+    work when compositing or scanning out the frame. The application is still
+    expected to render the full frame, and must make sure that nothing outside
+    \a rects is different from the previously presented frame. An empty list,
+    which is the default, means the whole surface is damaged.
+
+    \note Only the Vulkan backend makes use of this at the moment, when
+    \c{VK_KHR_incremental_present} is supported. Other backends ignore it.
+
+    \since 5.16
+  */
+
 /*!
     \fn QSize QRhiSwapChain::surfacePixelSize()
 
@@ -5423,6 +5462,47 @@ bool QRhi::isDeviceLost() const
     return d->isDeviceLost();
 }
 
+/*!
+    \return a binary blob with the contents of the backend's pipeline cache,
+    or an empty QByteArray when the PipelineCache feature is not supported.
+
+    The data can be written to disk and passed to setPipelineCacheData() in
+    the next run of the application, so that pipelines that were created
+    before do not need to be compiled again. The data starts with a header
+    that identifies the backend and, where it matters, the device and driver
+    it was generated with.
+
+    \note Call this before destroying the QRhi, typically when the
+    application exits, so that it contains all the pipelines created.
+
+    \sa setPipelineCacheData(), isFeatureSupported()
+ */
+QByteArray QRhi::pipelineCacheData()
+{
+    return d->pipelineCacheData();
+}
+
+/*!
+    Seeds the backend's pipeline cache with \a data, as returned by
+    pipelineCacheData() earlier, typically in a previous run of the
+    application.
+
+    Data that was generated by a different backend, device, driver or Qt
+    version is ignored with a debug message. This is expected when, for
+    example, the graphics driver gets upgraded. In that case the cache is
+    rebuilt as pipelines get created.
+
+    \note Call this right after creating the QRhi, before creating any
+    graphics or compute pipelines. Otherwise the pipelines created before will
+    not benefit from the data.
+
+    \sa pipelineCacheData(), isFeatureSupported()
+ */
+void QRhi::setPipelineCacheData(const QByteArray &data)
+{
+    d->setPipelineCacheData(data);
+}
+
 /*!
     \return a new graphics pipeline resource.
 
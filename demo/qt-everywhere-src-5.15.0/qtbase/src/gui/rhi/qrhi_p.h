@@ -1258,6 +1258,9 @@ public:
 
     QSize currentPixelSize() const { return m_currentPixelSize; }
 
+    QVector<QRect> presentDamage() const { return m_presentDamage; }
+    void setPresentDamage(const QVector<QRect> &rects) { m_presentDamage = rects; }
+
     virtual QRhiCommandBuffer *currentFrameCommandBuffer() = 0;
     virtual QRhiRenderTarget *currentFrameRenderTarget() = 0;
     virtual QSize surfacePixelSize() = 0;
@@ -1272,6 +1275,7 @@ protected:
     int m_sampleCount = 1;
     QRhiRenderPassDescriptor *m_renderPassDesc = nullptr;
     QSize m_currentPixelSize;
+    QVector<QRect> m_presentDamage;
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(QRhiSwapChain::Flags)
@@ -1446,7 +1450,8 @@ public:
         TriangleFanTopology,
         ReadBackNonUniformBuffer,
         ReadBackNonBaseMipLevel,
-        TexelFetch
+        TexelFetch,
+        PipelineCache
     };
 
     enum BeginFrameFlag {
@@ -1552,6 +1557,9 @@ public:
 
     bool isDeviceLost() const;
 
+    QByteArray pipelineCacheData();
+    void setPipelineCacheData(const QByteArray &data);
+
 protected:
     QRhi();
 
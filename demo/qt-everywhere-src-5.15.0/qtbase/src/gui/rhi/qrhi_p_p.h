@@ -163,6 +163,9 @@ public:
     virtual void releaseCachedResources() = 0;
     virtual bool isDeviceLost() const = 0;
 
+    virtual QByteArray pipelineCacheData() = 0;
+    virtual void setPipelineCacheData(const QByteArray &data) = 0;
+
     bool isCompressedFormat(QRhiTexture::Format format) const;
     void compressedFormatInfo(QRhiTexture::Format format, const QSize &size,
                               quint32 *bpl, quint32 *byteSize,
@@ -40,6 +40,8 @@
 #include <QWindow>
 #include <QOperatingSystemVersion>
 #include <qmath.h>
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdatastream.h>
 #include <private/qsystemlibrary_p.h>
 
 #include <d3dcompiler.h>
@@ -470,6 +472,8 @@ bool QRhiD3D11::isFeatureSupported(QRhi::Feature feature) const
         return true;
     case QRhi::TexelFetch:
         return true;
+    case QRhi::PipelineCache:
+        return true;
     default:
         Q_UNREACHABLE();
         return false;
@@ -525,6 +529,53 @@ bool QRhiD3D11::isDeviceLost() const
     return deviceLost;
 }
 
+static const quint32 QD3D11_PIPELINE_CACHE_DATA_ID = 0x31445251; // "QRD1"
+static const quint32 QD3D11_PIPELINE_CACHE_DATA_VERSION = 1;
+
+QByteArray QRhiD3D11::pipelineCacheData()
+{
+    // DXBC does not depend on the adapter or driver, so there is nothing
+    // else to check when restoring it.
+    QByteArray data;
+    if (m_bytecodeCache.isEmpty())
+        return data;
+
+    QDataStream ds(&data, QIODevice::WriteOnly);
+    ds.setVersion(QDataStream::Qt_5_15);
+    ds << QD3D11_PIPELINE_CACHE_DATA_ID << QD3D11_PIPELINE_CACHE_DATA_VERSION
+       << quint32(sizeof(void*)) << m_bytecodeCache;
+    return data;
+}
+
+void QRhiD3D11::setPipelineCacheData(const QByteArray &data)
+{
+    if (data.isEmpty())
+        return;
+
+    QDataStream ds(data);
+    ds.setVersion(QDataStream::Qt_5_15);
+    quint32 id = 0;
+    quint32 version = 0;
+    quint32 arch = 0;
+    ds >> id >> version >> arch;
+    if (id != QD3D11_PIPELINE_CACHE_DATA_ID || version != QD3D11_PIPELINE_CACHE_DATA_VERSION) {
+        qCDebug(QRHI_LOG_INFO, "setPipelineCacheData: The data was produced by a different backend or version");
+        return;
+    }
+    if (arch != quint32(sizeof(void*))) {
+        qCDebug(QRHI_LOG_INFO, "setPipelineCacheData: Architecture does not match");
+        return;
+    }
+    QHash<QByteArray, QByteArray> bytecodeCache;
+    ds >> bytecodeCache;
+    if (ds.status() != QDataStream::Ok) {
+        qCDebug(QRHI_LOG_INFO, "setPipelineCacheData: Invalid data");
+        return;
+    }
+    m_bytecodeCache = bytecodeCache;
+    qCDebug(QRHI_LOG_INFO, "Restored %d compiled HLSL shaders", m_bytecodeCache.count());
+}
+
 QRhiRenderBuffer *QRhiD3D11::createRenderBuffer(QRhiRenderBuffer::Type type, const QSize &pixelSize,
                                                 int sampleCount, QRhiRenderBuffer::Flags flags)
 {
@@ -3599,7 +3650,8 @@ static pD3DCompile resolveD3DCompile()
     return nullptr;
 }
 
-static QByteArray compileHlslShaderSource(const QShader &shader, QShader::Variant shaderVariant, QString *error, QShaderKey *usedShaderKey)
+static QByteArray compileHlslShaderSource(const QShader &shader, QShader::Variant shaderVariant, QString *error, QShaderKey *usedShaderKey,
+                                          QHash<QByteArray, QByteArray> *bytecodeCache)
 {
     QShaderKey key = { QShader::DxbcShader, 50, shaderVariant };
     QShaderCode dxbc = shader.shader(key);
@@ -3641,6 +3693,17 @@ static QByteArray compileHlslShaderSource(const QShader &shader, QShader::Varian
         return QByteArray();
     }
 
+    // Results of earlier runs can be restored with setPipelineCacheData()
+    QByteArray cacheKey = QCryptographicHash::hash(hlslSource.shader(), QCryptographicHash::Sha1);
+    cacheKey += hlslSource.entryPoint();
+    cacheKey += target;
+    const auto cacheIt = bytecodeCache->constFind(cacheKey);
+    if (cacheIt != bytecodeCache->constEnd()) {
+        if (usedShaderKey)
+            *usedShaderKey = key;
+        return cacheIt.value();
+    }
+
     static const pD3DCompile d3dCompile = resolveD3DCompile();
     if (d3dCompile == nullptr) {
         qWarning("Unable to resolve function D3DCompile()");
@@ -3669,6 +3732,7 @@ static QByteArray compileHlslShaderSource(const QShader &shader, QShader::Varian
     result.resize(int(bytecode->GetBufferSize()));
     memcpy(result.data(), bytecode->GetBufferPointer(), size_t(result.size()));
     bytecode->Release();
+    bytecodeCache->insert(cacheKey, result);
     return result;
 }
 
@@ -3772,7 +3836,8 @@ bool QD3D11GraphicsPipeline::build()
         } else {
             QString error;
             QShaderKey shaderKey;
-            const QByteArray bytecode = compileHlslShaderSource(shaderStage.shader(), shaderStage.shaderVariant(), &error, &shaderKey);
+            const QByteArray bytecode = compileHlslShaderSource(shaderStage.shader(), shaderStage.shaderVariant(), &error, &shaderKey,
+                                                                &rhiD->m_bytecodeCache);
             if (bytecode.isEmpty()) {
                 qWarning("HLSL shader compilation failed: %s", qPrintable(error));
                 return false;
@@ -3888,7 +3953,8 @@ bool QD3D11ComputePipeline::build()
     } else {
         QString error;
         QShaderKey shaderKey;
-        const QByteArray bytecode = compileHlslShaderSource(m_shaderStage.shader(), m_shaderStage.shaderVariant(), &error, &shaderKey);
+        const QByteArray bytecode = compileHlslShaderSource(m_shaderStage.shader(), m_shaderStage.shaderVariant(), &error, &shaderKey,
+                                                            &rhiD->m_bytecodeCache);
         if (bytecode.isEmpty()) {
             qWarning("HLSL compute shader compilation failed: %s", qPrintable(error));
             return false;
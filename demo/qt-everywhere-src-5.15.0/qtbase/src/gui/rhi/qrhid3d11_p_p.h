@@ -651,6 +651,9 @@ public:
     void releaseCachedResources() override;
     bool isDeviceLost() const override;
 
+    QByteArray pipelineCacheData() override;
+    void setPipelineCacheData(const QByteArray &data) override;
+
     void enqueueSubresUpload(QD3D11Texture *texD, QD3D11CommandBuffer *cbD,
                              int layer, int level, const QRhiTextureSubresourceUploadDescription &subresDesc);
     void enqueueResourceUpdates(QRhiCommandBuffer *cb, QRhiResourceUpdateBatch *resourceUpdates);
@@ -721,6 +724,8 @@ public:
         QShader::NativeResourceBindingMap nativeResourceBindingMap;
     };
     QHash<QRhiShaderStage, Shader> m_shaderCache;
+    // DXBC compiled from HLSL source, keyed by a hash of the source, entry point and target
+    QHash<QByteArray, QByteArray> m_bytecodeCache;
 
     struct DeviceCurse {
         DeviceCurse(QRhiD3D11 *impl) : q(impl) { }
@@ -771,6 +771,8 @@ bool QRhiGles2::isFeatureSupported(QRhi::Feature feature) const
         return caps.nonBaseLevelFramebufferTexture;
     case QRhi::TexelFetch:
         return caps.texelFetch;
+    case QRhi::PipelineCache:
+        return false;
     default:
         Q_UNREACHABLE();
         return false;
@@ -832,6 +834,17 @@ bool QRhiGles2::isDeviceLost() const
     return contextLost;
 }
 
+QByteArray QRhiGles2::pipelineCacheData()
+{
+    // program binaries are persisted by the QOpenGLProgramBinaryCache instead
+    return QByteArray();
+}
+
+void QRhiGles2::setPipelineCacheData(const QByteArray &data)
+{
+    Q_UNUSED(data);
+}
+
 QRhiRenderBuffer *QRhiGles2::createRenderBuffer(QRhiRenderBuffer::Type type, const QSize &pixelSize,
                                                 int sampleCount, QRhiRenderBuffer::Flags flags)
 {
@@ -564,6 +564,8 @@ bool QRhiMetal::isFeatureSupported(QRhi::Feature feature) const
         return true;
     case QRhi::TexelFetch:
         return true;
+    case QRhi::PipelineCache:
+        return false;
     default:
         Q_UNREACHABLE();
         return false;
@@ -618,6 +620,16 @@ bool QRhiMetal::isDeviceLost() const
     return false;
 }
 
+QByteArray QRhiMetal::pipelineCacheData()
+{
+    return QByteArray();
+}
+
+void QRhiMetal::setPipelineCacheData(const QByteArray &data)
+{
+    Q_UNUSED(data);
+}
+
 QRhiRenderBuffer *QRhiMetal::createRenderBuffer(QRhiRenderBuffer::Type type, const QSize &pixelSize,
                                                 int sampleCount, QRhiRenderBuffer::Flags flags)
 {
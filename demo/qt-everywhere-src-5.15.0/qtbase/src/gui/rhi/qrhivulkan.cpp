@@ -47,6 +47,8 @@
 #include "vk_mem_alloc.h"
 
 #include <qmath.h>
+#include <QThread>
+#include <QThreadPool>
 #include <QVulkanFunctions>
 #include <QtGui/qwindow.h>
 
@@ -505,6 +507,12 @@ bool QRhiVulkan::create(QRhi::Flags flags)
             }
         }
 
+        incrementalPresentAvailable = false;
+        if (devExts.contains(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME)) {
+            requestedDevExts.append(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME);
+            incrementalPresentAvailable = true;
+        }
+
         for (const QByteArray &ext : requestedDeviceExtensions) {
             if (!ext.isEmpty()) {
                 if (devExts.contains(ext))
@@ -646,6 +654,24 @@ bool QRhiVulkan::create(QRhi::Flags flags)
         vkDebugMarkerSetObjectName = reinterpret_cast<PFN_vkDebugMarkerSetObjectNameEXT>(f->vkGetDeviceProcAddr(dev, "vkDebugMarkerSetObjectNameEXT"));
     }
 
+    // Render passes with lots of draw calls get replayed into secondary
+    // command buffers on worker threads in endFrame(). A QRhi is still
+    // single-threaded from the application's point of view; it is only the
+    // translation of the recorded commands into Vulkan commands that is
+    // spread out. 0 disables this.
+    parallelRecordingJobs = qMin(MAX_PARALLEL_RECORDING_JOBS, QThread::idealThreadCount());
+    parallelRecordingThreshold = 1024;
+    if (qEnvironmentVariableIsSet("QT_VK_PARALLEL_RECORDING_THRESHOLD"))
+        parallelRecordingThreshold = qMax(0, qEnvironmentVariableIntValue("QT_VK_PARALLEL_RECORDING_THRESHOLD"));
+    if (parallelRecordingJobs < 2 || gfxQueueFamilyIdx < 0)
+        parallelRecordingThreshold = 0;
+    if (parallelRecordingThreshold > 0) {
+        qCDebug(QRHI_LOG_INFO, "Recording render passes with at least %d draw calls on %d threads",
+                parallelRecordingThreshold, parallelRecordingJobs);
+        parallelRecordingThreadPool = new QThreadPool;
+        parallelRecordingThreadPool->setMaxThreadCount(parallelRecordingJobs - 1);
+    }
+
     deviceLost = false;
 
     nativeHandlesStruct.physDev = physDev;
@@ -684,6 +710,22 @@ void QRhiVulkan::destroy()
         pipelineCache = VK_NULL_HANDLE;
     }
 
+    delete parallelRecordingThreadPool;
+    parallelRecordingThreadPool = nullptr;
+
+    for (int i = 0; i < QVK_FRAMES_IN_FLIGHT; ++i) {
+        for (int j = 0; j < MAX_PARALLEL_RECORDING_JOBS; ++j) {
+            ParallelRecordingPool &p(parallelRecordingPools[i][j]);
+            if (p.pool) {
+                // destroying the pool frees the command buffers as well
+                df->vkDestroyCommandPool(dev, p.pool, nullptr);
+                p.pool = VK_NULL_HANDLE;
+            }
+            p.cbs.clear();
+            p.used = 0;
+        }
+    }
+
     for (const DescriptorPoolData &pool : descriptorPools)
         df->vkDestroyDescriptorPool(dev, pool.pool, nullptr);
 
@@ -1607,6 +1649,9 @@ QRhi::FrameOpResult QRhiVulkan::beginFrame(QRhiSwapChain *swapChain, QRhi::Begin
     // mess up A's in-flight commands (as they are not in flight anymore).
     waitCommandCompletion(frameResIndex);
 
+    // The secondary command buffers recorded for this slot are not in use anymore.
+    resetParallelRecordingPools(frameResIndex);
+
     // Now is the time to read the timestamps for the previous frame for this slot.
     if (frame.timestampQueryIndex >= 0) {
         quint64 timestamp[2] = { 0, 0 };
@@ -1659,6 +1704,8 @@ QRhi::FrameOpResult QRhiVulkan::beginFrame(QRhiSwapChain *swapChain, QRhi::Begin
 
     swapChainD->cbWrapper.cb = frame.cmdBuf;
     swapChainD->cbWrapper.useSecondaryCb = flags.testFlag(QRhi::ExternalContentsInPass);
+    swapChainD->cbWrapper.useParallelRecording = !swapChainD->cbWrapper.useSecondaryCb && parallelRecordingThreshold > 0;
+    swapChainD->cbWrapper.parallelRecordingSlot = frameResIndex;
 
     QVkSwapChain::ImageResources &image(swapChainD->imageRes[swapChainD->currentImageIndex]);
     swapChainD->rtWrapper.d.fb = image.fb;
@@ -1750,6 +1797,42 @@ QRhi::FrameOpResult QRhiVulkan::endFrame(QRhiSwapChain *swapChain, QRhi::EndFram
         presInfo.waitSemaphoreCount = 1;
         presInfo.pWaitSemaphores = &frame.drawSem; // gfxQueueFamilyIdx == presQueueFamilyIdx ? &frame.drawSem : &frame.presTransSem;
 
+        // Pass on the damage hint, if any, in a form the presentation engine
+        // can use. The rectangles must be within the swapchain image. When
+        // the previous frame was not presented, the hint does not cover the
+        // changes made in that frame and so is not usable.
+        VkPresentRegionsKHR presRegions;
+        VkPresentRegionKHR presRegion;
+        QVarLengthArray<VkRectLayerKHR, 8> presRects;
+        if (incrementalPresentAvailable && !swapChainD->presentDamageIncomplete
+                && !swapChainD->m_presentDamage.isEmpty())
+        {
+            const QRect bounds(QPoint(0, 0), swapChainD->pixelSize);
+            for (const QRect &r : qAsConst(swapChainD->m_presentDamage)) {
+                const QRect rect = r & bounds;
+                if (rect.isEmpty())
+                    continue;
+                VkRectLayerKHR rectLayer;
+                rectLayer.offset.x = rect.x();
+                rectLayer.offset.y = rect.y();
+                rectLayer.extent.width = uint32_t(rect.width());
+                rectLayer.extent.height = uint32_t(rect.height());
+                rectLayer.layer = 0;
+                presRects.append(rectLayer);
+            }
+            if (!presRects.isEmpty()) {
+                presRegion.rectangleCount = uint32_t(presRects.count());
+                presRegion.pRectangles = presRects.constData();
+                memset(&presRegions, 0, sizeof(presRegions));
+                presRegions.sType = VkStructureType(1000084000); // VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR
+                presRegions.swapchainCount = 1;
+                presRegions.pRegions = &presRegion;
+                presInfo.pNext = &presRegions;
+            }
+        }
+        swapChainD->m_presentDamage.clear();
+        swapChainD->presentDamageIncomplete = false;
+
         // Do platform-specific WM notification. F.ex. essential on Wayland in
         // order to circumvent driver frame callbacks
         inst->presentAboutToBeQueued(swapChainD->window);
@@ -1777,6 +1860,9 @@ QRhi::FrameOpResult QRhiVulkan::endFrame(QRhiSwapChain *swapChain, QRhi::EndFram
         frame.imageAcquired = false;
         // and move on to the next buffer
         swapChainD->currentFrameSlot = (swapChainD->currentFrameSlot + 1) % QVK_FRAMES_IN_FLIGHT;
+    } else {
+        swapChainD->m_presentDamage.clear();
+        swapChainD->presentDamageIncomplete = true;
     }
 
     swapChainD->frameCount += 1;
@@ -1925,6 +2011,8 @@ QRhi::FrameOpResult QRhiVulkan::beginOffscreenFrame(QRhiCommandBuffer **cb, QRhi
         waitCommandCompletion(currentFrameSlot);
 
     ofr.cbWrapper.useSecondaryCb = flags.testFlag(QRhi::ExternalContentsInPass);
+    // offscreen frames are synchronous, keep them simple
+    ofr.cbWrapper.useParallelRecording = false;
 
     prepareNewFrame(&ofr.cbWrapper);
     ofr.active = true;
@@ -3585,125 +3673,388 @@ void QRhiVulkan::recordPrimaryCommandBuffer(QVkCommandBuffer *cbD)
 {
     Q_ASSERT(cbD->recordingPass == QVkCommandBuffer::NoPass);
 
-    for (QVkCommandBuffer::Command &cmd : cbD->commands) {
-        switch (cmd.cmd) {
-        case QVkCommandBuffer::Command::CopyBuffer:
-            df->vkCmdCopyBuffer(cbD->cb, cmd.args.copyBuffer.src, cmd.args.copyBuffer.dst,
-                                1, &cmd.args.copyBuffer.desc);
-            break;
-        case QVkCommandBuffer::Command::CopyBufferToImage:
-            df->vkCmdCopyBufferToImage(cbD->cb, cmd.args.copyBufferToImage.src, cmd.args.copyBufferToImage.dst,
-                                       cmd.args.copyBufferToImage.dstLayout,
-                                       uint32_t(cmd.args.copyBufferToImage.count),
-                                       cbD->pools.bufferImageCopy.constData() + cmd.args.copyBufferToImage.bufferImageCopyIndex);
-            break;
-        case QVkCommandBuffer::Command::CopyImage:
-            df->vkCmdCopyImage(cbD->cb, cmd.args.copyImage.src, cmd.args.copyImage.srcLayout,
-                               cmd.args.copyImage.dst, cmd.args.copyImage.dstLayout,
-                               1, &cmd.args.copyImage.desc);
-            break;
-        case QVkCommandBuffer::Command::CopyImageToBuffer:
-            df->vkCmdCopyImageToBuffer(cbD->cb, cmd.args.copyImageToBuffer.src, cmd.args.copyImageToBuffer.srcLayout,
-                                       cmd.args.copyImageToBuffer.dst,
-                                       1, &cmd.args.copyImageToBuffer.desc);
-            break;
-        case QVkCommandBuffer::Command::ImageBarrier:
-            df->vkCmdPipelineBarrier(cbD->cb, cmd.args.imageBarrier.srcStageMask, cmd.args.imageBarrier.dstStageMask,
-                                     0, 0, nullptr, 0, nullptr,
-                                     cmd.args.imageBarrier.count, cbD->pools.imageBarrier.constData() + cmd.args.imageBarrier.index);
-            break;
-        case QVkCommandBuffer::Command::BufferBarrier:
-            df->vkCmdPipelineBarrier(cbD->cb, cmd.args.bufferBarrier.srcStageMask, cmd.args.bufferBarrier.dstStageMask,
-                                     0, 0, nullptr,
-                                     cmd.args.bufferBarrier.count, cbD->pools.bufferBarrier.constData() + cmd.args.bufferBarrier.index,
-                                     0, nullptr);
-            break;
-        case QVkCommandBuffer::Command::BlitImage:
-            df->vkCmdBlitImage(cbD->cb, cmd.args.blitImage.src, cmd.args.blitImage.srcLayout,
-                               cmd.args.blitImage.dst, cmd.args.blitImage.dstLayout,
-                               1, &cmd.args.blitImage.desc,
-                               cmd.args.blitImage.filter);
-            break;
-        case QVkCommandBuffer::Command::BeginRenderPass:
-            cmd.args.beginRenderPass.desc.pClearValues = cbD->pools.clearValue.constData() + cmd.args.beginRenderPass.clearValueIndex;
-            df->vkCmdBeginRenderPass(cbD->cb, &cmd.args.beginRenderPass.desc,
-                                     cbD->useSecondaryCb ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
-            break;
-        case QVkCommandBuffer::Command::EndRenderPass:
-            df->vkCmdEndRenderPass(cbD->cb);
-            break;
+    const int count = cbD->commands.count();
+    QVkCommandBuffer::Command *cmds = cbD->commands.data();
+    for (int i = 0; i < count; ++i) {
+        if (cbD->useParallelRecording && cmds[i].cmd == QVkCommandBuffer::Command::BeginRenderPass) {
+            const int endIndex = recordRenderPassInParallel(cbD, i);
+            if (endIndex >= 0) {
+                i = endIndex;
+                continue;
+            }
+        }
+        recordCommand(cbD, cbD->cb, cmds[i]);
+    }
+}
+
+void QRhiVulkan::recordCommand(QVkCommandBuffer *cbD, VkCommandBuffer cb, QVkCommandBuffer::Command &cmd)
+{
+    switch (cmd.cmd) {
+    case QVkCommandBuffer::Command::CopyBuffer:
+        df->vkCmdCopyBuffer(cb, cmd.args.copyBuffer.src, cmd.args.copyBuffer.dst,
+                            1, &cmd.args.copyBuffer.desc);
+        break;
+    case QVkCommandBuffer::Command::CopyBufferToImage:
+        df->vkCmdCopyBufferToImage(cb, cmd.args.copyBufferToImage.src, cmd.args.copyBufferToImage.dst,
+                                   cmd.args.copyBufferToImage.dstLayout,
+                                   uint32_t(cmd.args.copyBufferToImage.count),
+                                   cbD->pools.bufferImageCopy.constData() + cmd.args.copyBufferToImage.bufferImageCopyIndex);
+        break;
+    case QVkCommandBuffer::Command::CopyImage:
+        df->vkCmdCopyImage(cb, cmd.args.copyImage.src, cmd.args.copyImage.srcLayout,
+                           cmd.args.copyImage.dst, cmd.args.copyImage.dstLayout,
+                           1, &cmd.args.copyImage.desc);
+        break;
+    case QVkCommandBuffer::Command::CopyImageToBuffer:
+        df->vkCmdCopyImageToBuffer(cb, cmd.args.copyImageToBuffer.src, cmd.args.copyImageToBuffer.srcLayout,
+                                   cmd.args.copyImageToBuffer.dst,
+                                   1, &cmd.args.copyImageToBuffer.desc);
+        break;
+    case QVkCommandBuffer::Command::ImageBarrier:
+        df->vkCmdPipelineBarrier(cb, cmd.args.imageBarrier.srcStageMask, cmd.args.imageBarrier.dstStageMask,
+                                 0, 0, nullptr, 0, nullptr,
+                                 cmd.args.imageBarrier.count, cbD->pools.imageBarrier.constData() + cmd.args.imageBarrier.index);
+        break;
+    case QVkCommandBuffer::Command::BufferBarrier:
+        df->vkCmdPipelineBarrier(cb, cmd.args.bufferBarrier.srcStageMask, cmd.args.bufferBarrier.dstStageMask,
+                                 0, 0, nullptr,
+                                 cmd.args.bufferBarrier.count, cbD->pools.bufferBarrier.constData() + cmd.args.bufferBarrier.index,
+                                 0, nullptr);
+        break;
+    case QVkCommandBuffer::Command::BlitImage:
+        df->vkCmdBlitImage(cb, cmd.args.blitImage.src, cmd.args.blitImage.srcLayout,
+                           cmd.args.blitImage.dst, cmd.args.blitImage.dstLayout,
+                           1, &cmd.args.blitImage.desc,
+                           cmd.args.blitImage.filter);
+        break;
+    case QVkCommandBuffer::Command::BeginRenderPass:
+        cmd.args.beginRenderPass.desc.pClearValues = cbD->pools.clearValue.constData() + cmd.args.beginRenderPass.clearValueIndex;
+        df->vkCmdBeginRenderPass(cb, &cmd.args.beginRenderPass.desc,
+                                 cbD->useSecondaryCb ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE);
+        break;
+    case QVkCommandBuffer::Command::EndRenderPass:
+        df->vkCmdEndRenderPass(cb);
+        break;
+    case QVkCommandBuffer::Command::BindPipeline:
+        df->vkCmdBindPipeline(cb, cmd.args.bindPipeline.bindPoint, cmd.args.bindPipeline.pipeline);
+        break;
+    case QVkCommandBuffer::Command::BindDescriptorSet:
+    {
+        const uint32_t *offsets = nullptr;
+        if (cmd.args.bindDescriptorSet.dynamicOffsetCount > 0)
+            offsets = cbD->pools.dynamicOffset.constData() + cmd.args.bindDescriptorSet.dynamicOffsetIndex;
+        df->vkCmdBindDescriptorSets(cb, cmd.args.bindDescriptorSet.bindPoint,
+                                    cmd.args.bindDescriptorSet.pipelineLayout,
+                                    0, 1, &cmd.args.bindDescriptorSet.descSet,
+                                    uint32_t(cmd.args.bindDescriptorSet.dynamicOffsetCount),
+                                    offsets);
+    }
+        break;
+    case QVkCommandBuffer::Command::BindVertexBuffer:
+        df->vkCmdBindVertexBuffers(cb, uint32_t(cmd.args.bindVertexBuffer.startBinding),
+                                   uint32_t(cmd.args.bindVertexBuffer.count),
+                                   cbD->pools.vertexBuffer.constData() + cmd.args.bindVertexBuffer.vertexBufferIndex,
+                                   cbD->pools.vertexBufferOffset.constData() + cmd.args.bindVertexBuffer.vertexBufferOffsetIndex);
+        break;
+    case QVkCommandBuffer::Command::BindIndexBuffer:
+        df->vkCmdBindIndexBuffer(cb, cmd.args.bindIndexBuffer.buf,
+                                 cmd.args.bindIndexBuffer.ofs, cmd.args.bindIndexBuffer.type);
+        break;
+    case QVkCommandBuffer::Command::SetViewport:
+        df->vkCmdSetViewport(cb, 0, 1, &cmd.args.setViewport.viewport);
+        break;
+    case QVkCommandBuffer::Command::SetScissor:
+        df->vkCmdSetScissor(cb, 0, 1, &cmd.args.setScissor.scissor);
+        break;
+    case QVkCommandBuffer::Command::SetBlendConstants:
+        df->vkCmdSetBlendConstants(cb, cmd.args.setBlendConstants.c);
+        break;
+    case QVkCommandBuffer::Command::SetStencilRef:
+        df->vkCmdSetStencilReference(cb, VK_STENCIL_FRONT_AND_BACK, cmd.args.setStencilRef.ref);
+        break;
+    case QVkCommandBuffer::Command::Draw:
+        df->vkCmdDraw(cb, cmd.args.draw.vertexCount, cmd.args.draw.instanceCount,
+                      cmd.args.draw.firstVertex, cmd.args.draw.firstInstance);
+        break;
+    case QVkCommandBuffer::Command::DrawIndexed:
+        df->vkCmdDrawIndexed(cb, cmd.args.drawIndexed.indexCount, cmd.args.drawIndexed.instanceCount,
+                             cmd.args.drawIndexed.firstIndex, cmd.args.drawIndexed.vertexOffset,
+                             cmd.args.drawIndexed.firstInstance);
+        break;
+    case QVkCommandBuffer::Command::DebugMarkerBegin:
+        cmd.args.debugMarkerBegin.marker.pMarkerName =
+                cbD->pools.debugMarkerData[cmd.args.debugMarkerBegin.markerNameIndex].constData();
+        vkCmdDebugMarkerBegin(cb, &cmd.args.debugMarkerBegin.marker);
+        break;
+    case QVkCommandBuffer::Command::DebugMarkerEnd:
+        vkCmdDebugMarkerEnd(cb);
+        break;
+    case QVkCommandBuffer::Command::DebugMarkerInsert:
+        cmd.args.debugMarkerInsert.marker.pMarkerName =
+                cbD->pools.debugMarkerData[cmd.args.debugMarkerInsert.markerNameIndex].constData();
+        vkCmdDebugMarkerInsert(cb, &cmd.args.debugMarkerInsert.marker);
+        break;
+    case QVkCommandBuffer::Command::TransitionPassResources:
+        recordTransitionPassResources(cbD, cbD->passResTrackers[cmd.args.transitionResources.trackerIndex]);
+        break;
+    case QVkCommandBuffer::Command::Dispatch:
+        df->vkCmdDispatch(cb, uint32_t(cmd.args.dispatch.x), uint32_t(cmd.args.dispatch.y), uint32_t(cmd.args.dispatch.z));
+        break;
+    case QVkCommandBuffer::Command::ExecuteSecondary:
+        df->vkCmdExecuteCommands(cb, 1, &cmd.args.executeSecondary.cb);
+        break;
+    default:
+        break;
+    }
+}
+
+VkCommandBuffer QRhiVulkan::parallelRecordingCommandBuffer(int slot, int job)
+{
+    ParallelRecordingPool &p(parallelRecordingPools[slot][job]);
+    if (!p.pool) {
+        VkCommandPoolCreateInfo poolInfo;
+        memset(&poolInfo, 0, sizeof(poolInfo));
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex = uint32_t(gfxQueueFamilyIdx);
+        VkResult err = df->vkCreateCommandPool(dev, &poolInfo, nullptr, &p.pool);
+        if (err != VK_SUCCESS) {
+            qWarning("Failed to create command pool for parallel recording: %d", err);
+            p.pool = VK_NULL_HANDLE;
+            return VK_NULL_HANDLE;
+        }
+    }
+
+    if (p.used < p.cbs.count())
+        return p.cbs[p.used++];
+
+    VkCommandBufferAllocateInfo cmdBufInfo;
+    memset(&cmdBufInfo, 0, sizeof(cmdBufInfo));
+    cmdBufInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cmdBufInfo.commandPool = p.pool;
+    cmdBufInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+    cmdBufInfo.commandBufferCount = 1;
+
+    VkCommandBuffer cb = VK_NULL_HANDLE;
+    VkResult err = df->vkAllocateCommandBuffers(dev, &cmdBufInfo, &cb);
+    if (err != VK_SUCCESS) {
+        qWarning("Failed to allocate secondary command buffer for parallel recording: %d", err);
+        return VK_NULL_HANDLE;
+    }
+
+    p.cbs.append(cb);
+    p.used = p.cbs.count();
+    return cb;
+}
+
+void QRhiVulkan::resetParallelRecordingPools(int slot)
+{
+    for (int job = 0; job < MAX_PARALLEL_RECORDING_JOBS; ++job) {
+        ParallelRecordingPool &p(parallelRecordingPools[slot][job]);
+        if (p.pool && p.used > 0) {
+            df->vkResetCommandPool(dev, p.pool, 0);
+            p.used = 0;
+        }
+    }
+}
+
+namespace {
+struct QVkParallelRecordingChunk
+{
+    int first = 0;
+    int last = 0;
+    // Indices of the commands establishing the state the chunk starts with.
+    // None of this is inherited by a secondary command buffer.
+    QVarLengthArray<int, 16> stateCommands;
+    VkCommandBuffer cb = VK_NULL_HANDLE;
+};
+
+struct QVkParallelRecordingState
+{
+    int pipeline = -1;
+    int descSet = -1;
+    int indexBuffer = -1;
+    int viewport = -1;
+    int scissor = -1;
+    int blendConstants = -1;
+    int stencilRef = -1;
+    QVarLengthArray<int, 4> vertexBuffers;
+
+    void track(const QVkCommandBuffer::Command *cmds, int i)
+    {
+        switch (cmds[i].cmd) {
         case QVkCommandBuffer::Command::BindPipeline:
-            df->vkCmdBindPipeline(cbD->cb, cmd.args.bindPipeline.bindPoint, cmd.args.bindPipeline.pipeline);
+            pipeline = i;
             break;
         case QVkCommandBuffer::Command::BindDescriptorSet:
-        {
-            const uint32_t *offsets = nullptr;
-            if (cmd.args.bindDescriptorSet.dynamicOffsetCount > 0)
-                offsets = cbD->pools.dynamicOffset.constData() + cmd.args.bindDescriptorSet.dynamicOffsetIndex;
-            df->vkCmdBindDescriptorSets(cbD->cb, cmd.args.bindDescriptorSet.bindPoint,
-                                        cmd.args.bindDescriptorSet.pipelineLayout,
-                                        0, 1, &cmd.args.bindDescriptorSet.descSet,
-                                        uint32_t(cmd.args.bindDescriptorSet.dynamicOffsetCount),
-                                        offsets);
-        }
-            break;
-        case QVkCommandBuffer::Command::BindVertexBuffer:
-            df->vkCmdBindVertexBuffers(cbD->cb, uint32_t(cmd.args.bindVertexBuffer.startBinding),
-                                       uint32_t(cmd.args.bindVertexBuffer.count),
-                                       cbD->pools.vertexBuffer.constData() + cmd.args.bindVertexBuffer.vertexBufferIndex,
-                                       cbD->pools.vertexBufferOffset.constData() + cmd.args.bindVertexBuffer.vertexBufferOffsetIndex);
+            descSet = i;
             break;
         case QVkCommandBuffer::Command::BindIndexBuffer:
-            df->vkCmdBindIndexBuffer(cbD->cb, cmd.args.bindIndexBuffer.buf,
-                                     cmd.args.bindIndexBuffer.ofs, cmd.args.bindIndexBuffer.type);
+            indexBuffer = i;
             break;
         case QVkCommandBuffer::Command::SetViewport:
-            df->vkCmdSetViewport(cbD->cb, 0, 1, &cmd.args.setViewport.viewport);
+            viewport = i;
             break;
         case QVkCommandBuffer::Command::SetScissor:
-            df->vkCmdSetScissor(cbD->cb, 0, 1, &cmd.args.setScissor.scissor);
+            scissor = i;
             break;
         case QVkCommandBuffer::Command::SetBlendConstants:
-            df->vkCmdSetBlendConstants(cbD->cb, cmd.args.setBlendConstants.c);
+            blendConstants = i;
             break;
         case QVkCommandBuffer::Command::SetStencilRef:
-            df->vkCmdSetStencilReference(cbD->cb, VK_STENCIL_FRONT_AND_BACK, cmd.args.setStencilRef.ref);
-            break;
-        case QVkCommandBuffer::Command::Draw:
-            df->vkCmdDraw(cbD->cb, cmd.args.draw.vertexCount, cmd.args.draw.instanceCount,
-                          cmd.args.draw.firstVertex, cmd.args.draw.firstInstance);
-            break;
-        case QVkCommandBuffer::Command::DrawIndexed:
-            df->vkCmdDrawIndexed(cbD->cb, cmd.args.drawIndexed.indexCount, cmd.args.drawIndexed.instanceCount,
-                                 cmd.args.drawIndexed.firstIndex, cmd.args.drawIndexed.vertexOffset,
-                                 cmd.args.drawIndexed.firstInstance);
-            break;
-        case QVkCommandBuffer::Command::DebugMarkerBegin:
-            cmd.args.debugMarkerBegin.marker.pMarkerName =
-                    cbD->pools.debugMarkerData[cmd.args.debugMarkerBegin.markerNameIndex].constData();
-            vkCmdDebugMarkerBegin(cbD->cb, &cmd.args.debugMarkerBegin.marker);
-            break;
-        case QVkCommandBuffer::Command::DebugMarkerEnd:
-            vkCmdDebugMarkerEnd(cbD->cb);
-            break;
-        case QVkCommandBuffer::Command::DebugMarkerInsert:
-            cmd.args.debugMarkerInsert.marker.pMarkerName =
-                    cbD->pools.debugMarkerData[cmd.args.debugMarkerInsert.markerNameIndex].constData();
-            vkCmdDebugMarkerInsert(cbD->cb, &cmd.args.debugMarkerInsert.marker);
-            break;
-        case QVkCommandBuffer::Command::TransitionPassResources:
-            recordTransitionPassResources(cbD, cbD->passResTrackers[cmd.args.transitionResources.trackerIndex]);
+            stencilRef = i;
             break;
-        case QVkCommandBuffer::Command::Dispatch:
-            df->vkCmdDispatch(cbD->cb, uint32_t(cmd.args.dispatch.x), uint32_t(cmd.args.dispatch.y), uint32_t(cmd.args.dispatch.z));
-            break;
-        case QVkCommandBuffer::Command::ExecuteSecondary:
-            df->vkCmdExecuteCommands(cbD->cb, 1, &cmd.args.executeSecondary.cb);
+        case QVkCommandBuffer::Command::BindVertexBuffer:
+        {
+            // a bind with the same range replaces the earlier one, keep the
+            // rest in the original order since ranges may overlap
+            const int startBinding = cmds[i].args.bindVertexBuffer.startBinding;
+            const int count = cmds[i].args.bindVertexBuffer.count;
+            for (int j = 0; j < vertexBuffers.count(); ++j) {
+                const QVkCommandBuffer::Command &prev(cmds[vertexBuffers[j]]);
+                if (prev.args.bindVertexBuffer.startBinding == startBinding
+                        && prev.args.bindVertexBuffer.count == count)
+                {
+                    vertexBuffers.remove(j);
+                    break;
+                }
+            }
+            vertexBuffers.append(i);
+        }
             break;
         default:
             break;
         }
     }
+
+    void snapshot(QVarLengthArray<int, 16> *dst) const
+    {
+        for (int i : { pipeline, descSet, indexBuffer, viewport, scissor, blendConstants, stencilRef }) {
+            if (i >= 0)
+                dst->append(i);
+        }
+        for (int i : vertexBuffers)
+            dst->append(i);
+        std::sort(dst->begin(), dst->end());
+    }
+};
+}
+
+// Replays the render pass starting at beginIndex into a number of secondary
+// command buffers, recorded concurrently, and executes those from the
+// primary. Returns the index of the EndRenderPass command, or -1 when the
+// pass is not worth spreading out (or cannot be) and should be recorded
+// inline as usual.
+int QRhiVulkan::recordRenderPassInParallel(QVkCommandBuffer *cbD, int beginIndex)
+{
+    QVkCommandBuffer::Command *cmds = cbD->commands.data();
+    const int count = cbD->commands.count();
+
+    int endIndex = -1;
+    int drawCount = 0;
+    for (int i = beginIndex + 1; i < count; ++i) {
+        const QVkCommandBuffer::Command::Cmd c = cmds[i].cmd;
+        if (c == QVkCommandBuffer::Command::EndRenderPass) {
+            endIndex = i;
+            break;
+        }
+        if (c == QVkCommandBuffer::Command::Draw || c == QVkCommandBuffer::Command::DrawIndexed) {
+            ++drawCount;
+        } else if (c == QVkCommandBuffer::Command::DebugMarkerBegin
+                   || c == QVkCommandBuffer::Command::DebugMarkerEnd
+                   || c == QVkCommandBuffer::Command::DebugMarkerInsert
+                   || c == QVkCommandBuffer::Command::ExecuteSecondary)
+        {
+            // debug groups cannot straddle command buffers
+            return -1;
+        }
+    }
+    if (endIndex < 0 || drawCount < parallelRecordingThreshold)
+        return -1;
+
+    static const int MIN_DRAWS_PER_JOB = 128;
+    const int jobCount = qMin(parallelRecordingJobs, drawCount / MIN_DRAWS_PER_JOB);
+    if (jobCount < 2)
+        return -1;
+
+    QVarLengthArray<QVkParallelRecordingChunk, MAX_PARALLEL_RECORDING_JOBS> chunks(jobCount);
+    const int drawsPerChunk = (drawCount + jobCount - 1) / jobCount;
+    QVkParallelRecordingState state;
+    int chunkIndex = 0;
+    int drawsInChunk = 0;
+    chunks[0].first = beginIndex + 1;
+    for (int i = beginIndex + 1; i < endIndex; ++i) {
+        state.track(cmds, i);
+        const QVkCommandBuffer::Command::Cmd c = cmds[i].cmd;
+        if (c != QVkCommandBuffer::Command::Draw && c != QVkCommandBuffer::Command::DrawIndexed)
+            continue;
+        if (++drawsInChunk == drawsPerChunk && chunkIndex < jobCount - 1 && i + 1 < endIndex) {
+            chunks[chunkIndex].last = i + 1;
+            ++chunkIndex;
+            chunks[chunkIndex].first = i + 1;
+            state.snapshot(&chunks[chunkIndex].stateCommands);
+            drawsInChunk = 0;
+        }
+    }
+    chunks[chunkIndex].last = endIndex;
+    const int usedChunks = chunkIndex + 1;
+
+    for (int j = 0; j < usedChunks; ++j) {
+        chunks[j].cb = parallelRecordingCommandBuffer(cbD->parallelRecordingSlot, j);
+        if (!chunks[j].cb)
+            return -1;
+    }
+
+    QVkCommandBuffer::Command &beginCmd(cmds[beginIndex]);
+
+    VkCommandBufferInheritanceInfo inheritInfo;
+    memset(&inheritInfo, 0, sizeof(inheritInfo));
+    inheritInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritInfo.renderPass = beginCmd.args.beginRenderPass.desc.renderPass;
+    inheritInfo.subpass = 0;
+    inheritInfo.framebuffer = beginCmd.args.beginRenderPass.desc.framebuffer;
+
+    VkCommandBufferBeginInfo cmdBufBeginInfo;
+    memset(&cmdBufBeginInfo, 0, sizeof(cmdBufBeginInfo));
+    cmdBufBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    cmdBufBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+            | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    cmdBufBeginInfo.pInheritanceInfo = &inheritInfo;
+
+    // Each chunk only reads the command list and the pools, and records into
+    // a command buffer from its own pool, so no locking is needed. The
+    // first chunk is recorded on this thread.
+    auto recordChunk = [this, cbD, cmds, &chunks, &cmdBufBeginInfo](int j) {
+        QVkParallelRecordingChunk &chunk(chunks[j]);
+        VkResult err = df->vkBeginCommandBuffer(chunk.cb, &cmdBufBeginInfo);
+        if (err != VK_SUCCESS) {
+            qWarning("Failed to begin secondary command buffer: %d", err);
+            return;
+        }
+        for (int i : chunk.stateCommands)
+            recordCommand(cbD, chunk.cb, cmds[i]);
+        for (int i = chunk.first; i < chunk.last; ++i)
+            recordCommand(cbD, chunk.cb, cmds[i]);
+        err = df->vkEndCommandBuffer(chunk.cb);
+        if (err != VK_SUCCESS)
+            qWarning("Failed to end secondary command buffer: %d", err);
+    };
+
+    for (int j = 1; j < usedChunks; ++j)
+        parallelRecordingThreadPool->start(QRunnable::create([&recordChunk, j] { recordChunk(j); }));
+    recordChunk(0);
+    parallelRecordingThreadPool->waitForDone();
+
+    QVarLengthArray<VkCommandBuffer, MAX_PARALLEL_RECORDING_JOBS> secondaryCbs;
+    for (int j = 0; j < usedChunks; ++j)
+        secondaryCbs.append(chunks[j].cb);
+
+    beginCmd.args.beginRenderPass.desc.pClearValues = cbD->pools.clearValue.constData() + beginCmd.args.beginRenderPass.clearValueIndex;
+    df->vkCmdBeginRenderPass(cbD->cb, &beginCmd.args.beginRenderPass.desc, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+    df->vkCmdExecuteCommands(cbD->cb, uint32_t(secondaryCbs.count()), secondaryCbs.constData());
+    df->vkCmdEndRenderPass(cbD->cb);
+
+    return endIndex;
 }
 
 static inline VkAccessFlags toVkAccess(QRhiPassResourceTracker::BufferAccess access)
@@ -4031,6 +4382,8 @@ bool QRhiVulkan::isFeatureSupported(QRhi::Feature feature) const
         return true;
     case QRhi::TexelFetch:
         return true;
+    case QRhi::PipelineCache:
+        return true;
     default:
         Q_UNREACHABLE();
         return false;
@@ -4089,6 +4442,116 @@ bool QRhiVulkan::isDeviceLost() const
     return deviceLost;
 }
 
+// Precedes the VkPipelineCache data returned from pipelineCacheData(). The
+// cache data has its own header too, but checking it requires knowing the
+// layout, so check the device and driver identity ourselves.
+struct QVkPipelineCacheDataHeader
+{
+    quint32 rhiId;
+    quint32 arch;
+    quint32 driverVersion;
+    quint32 vendorId;
+    quint32 deviceId;
+    quint32 dataSize;
+    quint32 uuidSize;
+    quint32 reserved;
+};
+
+static const quint32 QVK_PIPELINE_CACHE_DATA_ID = 0x4b565251; // "QRVK"
+
+QByteArray QRhiVulkan::pipelineCacheData()
+{
+    QByteArray data;
+    if (!pipelineCache)
+        return data;
+
+    size_t dataSize = 0;
+    VkResult err = df->vkGetPipelineCacheData(dev, pipelineCache, &dataSize, nullptr);
+    if (err != VK_SUCCESS) {
+        qWarning("Failed to get pipeline cache data size: %d", err);
+        return QByteArray();
+    }
+    const size_t headerSize = sizeof(QVkPipelineCacheDataHeader);
+    const size_t dataOffset = headerSize + VK_UUID_SIZE;
+    data.resize(int(dataOffset + dataSize));
+    err = df->vkGetPipelineCacheData(dev, pipelineCache, &dataSize, data.data() + dataOffset);
+    if (err != VK_SUCCESS) {
+        qWarning("Failed to get pipeline cache data of %d bytes: %d", int(dataSize), err);
+        return QByteArray();
+    }
+
+    QVkPipelineCacheDataHeader header;
+    header.rhiId = QVK_PIPELINE_CACHE_DATA_ID;
+    header.arch = quint32(sizeof(void*));
+    header.driverVersion = physDevProperties.driverVersion;
+    header.vendorId = physDevProperties.vendorID;
+    header.deviceId = physDevProperties.deviceID;
+    header.dataSize = quint32(dataSize);
+    header.uuidSize = VK_UUID_SIZE;
+    header.reserved = 0;
+    memcpy(data.data(), &header, headerSize);
+    memcpy(data.data() + headerSize, physDevProperties.pipelineCacheUUID, VK_UUID_SIZE);
+
+    return data;
+}
+
+void QRhiVulkan::setPipelineCacheData(const QByteArray &data)
+{
+    if (data.isEmpty())
+        return;
+
+    const size_t headerSize = sizeof(QVkPipelineCacheDataHeader);
+    if (data.size() < int(headerSize)) {
+        qCDebug(QRHI_LOG_INFO, "setPipelineCacheData: Invalid blob size (header incomplete)");
+        return;
+    }
+    QVkPipelineCacheDataHeader header;
+    memcpy(&header, data.constData(), headerSize);
+    if (header.rhiId != QVK_PIPELINE_CACHE_DATA_ID) {
+        qCDebug(QRHI_LOG_INFO, "setPipelineCacheData: The data was produced by a different backend");
+        return;
+    }
+    if (header.arch != quint32(sizeof(void*))) {
+        qCDebug(QRHI_LOG_INFO, "setPipelineCacheData: Architecture does not match");
+        return;
+    }
+    if (header.driverVersion != physDevProperties.driverVersion
+            || header.vendorId != physDevProperties.vendorID
+            || header.deviceId != physDevProperties.deviceID)
+    {
+        qCDebug(QRHI_LOG_INFO, "setPipelineCacheData: Physical device or driver does not match");
+        return;
+    }
+    const size_t dataOffset = headerSize + VK_UUID_SIZE;
+    if (header.uuidSize != VK_UUID_SIZE || size_t(data.size()) != dataOffset + header.dataSize) {
+        qCDebug(QRHI_LOG_INFO, "setPipelineCacheData: Invalid blob size");
+        return;
+    }
+    if (memcmp(data.constData() + headerSize, physDevProperties.pipelineCacheUUID, VK_UUID_SIZE)) {
+        qCDebug(QRHI_LOG_INFO, "setPipelineCacheData: Pipeline cache UUID does not match");
+        return;
+    }
+
+    // Pipelines created from the previous cache object stay valid.
+    if (pipelineCache) {
+        df->vkDestroyPipelineCache(dev, pipelineCache, nullptr);
+        pipelineCache = VK_NULL_HANDLE;
+    }
+
+    VkPipelineCacheCreateInfo pipelineCacheInfo;
+    memset(&pipelineCacheInfo, 0, sizeof(pipelineCacheInfo));
+    pipelineCacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheInfo.initialDataSize = header.dataSize;
+    pipelineCacheInfo.pInitialData = data.constData() + dataOffset;
+    VkResult err = df->vkCreatePipelineCache(dev, &pipelineCacheInfo, nullptr, &pipelineCache);
+    if (err != VK_SUCCESS) {
+        qWarning("Failed to create pipeline cache with initial data of %d bytes: %d", int(header.dataSize), err);
+        pipelineCache = VK_NULL_HANDLE;
+        return;
+    }
+    qCDebug(QRHI_LOG_INFO, "Created pipeline cache with initial data of %d bytes", int(header.dataSize));
+}
+
 QRhiRenderBuffer *QRhiVulkan::createRenderBuffer(QRhiRenderBuffer::Type type, const QSize &pixelSize,
                                                  int sampleCount, QRhiRenderBuffer::Flags flags)
 {
@@ -55,6 +55,7 @@ QT_BEGIN_NAMESPACE
 
 class QVulkanFunctions;
 class QVulkanDeviceFunctions;
+class QThreadPool;
 
 static const int QVK_FRAMES_IN_FLIGHT = 2;
 
@@ -323,6 +324,8 @@ struct QVkCommandBuffer : public QRhiCommandBuffer
 
     VkCommandBuffer cb = VK_NULL_HANDLE; // primary
     bool useSecondaryCb = false;
+    bool useParallelRecording = false;
+    int parallelRecordingSlot = 0;
     QRhiVulkanCommandBufferNativeHandles nativeHandlesStruct;
 
     enum PassType {
@@ -635,6 +638,7 @@ struct QVkSwapChain : public QRhiSwapChain
 
     quint32 currentImageIndex = 0; // index in imageRes
     quint32 currentFrameSlot = 0; // index in frameRes
+    bool presentDamageIncomplete = false; // a frame was ended without presenting
     int frameCount = 0;
 
     friend class QRhiVulkan;
@@ -741,6 +745,9 @@ public:
     void releaseCachedResources() override;
     bool isDeviceLost() const override;
 
+    QByteArray pipelineCacheData() override;
+    void setPipelineCacheData(const QByteArray &data) override;
+
     VkResult createDescriptorPool(VkDescriptorPool *pool);
     bool allocateDescriptorSet(VkDescriptorSetAllocateInfo *allocInfo, VkDescriptorSet *result, int *resultPoolIndex);
     uint32_t chooseTransientImageMemType(VkImage img, uint32_t startIndex);
@@ -785,6 +792,10 @@ public:
     void executeBufferHostWritesForSlot(QVkBuffer *bufD, int slot);
     void enqueueTransitionPassResources(QVkCommandBuffer *cbD);
     void recordPrimaryCommandBuffer(QVkCommandBuffer *cbD);
+    void recordCommand(QVkCommandBuffer *cbD, VkCommandBuffer cb, QVkCommandBuffer::Command &cmd);
+    int recordRenderPassInParallel(QVkCommandBuffer *cbD, int beginIndex);
+    VkCommandBuffer parallelRecordingCommandBuffer(int slot, int job);
+    void resetParallelRecordingPools(int slot);
     void trackedRegisterBuffer(QRhiPassResourceTracker *passResTracker,
                                QVkBuffer *bufD,
                                int slot,
@@ -837,6 +848,7 @@ public:
 
     bool debugMarkersAvailable = false;
     bool vertexAttribDivisorAvailable = false;
+    bool incrementalPresentAvailable = false;
     PFN_vkCmdDebugMarkerBeginEXT vkCmdDebugMarkerBegin = nullptr;
     PFN_vkCmdDebugMarkerEndEXT vkCmdDebugMarkerEnd = nullptr;
     PFN_vkCmdDebugMarkerInsertEXT vkCmdDebugMarkerInsert = nullptr;
@@ -866,6 +878,17 @@ public:
     VkQueryPool timestampQueryPool = VK_NULL_HANDLE;
     QBitArray timestampQueryPoolMap;
 
+    static const int MAX_PARALLEL_RECORDING_JOBS = 8;
+    struct ParallelRecordingPool {
+        VkCommandPool pool = VK_NULL_HANDLE;
+        QVarLengthArray<VkCommandBuffer, 4> cbs;
+        int used = 0;
+    };
+    ParallelRecordingPool parallelRecordingPools[QVK_FRAMES_IN_FLIGHT][MAX_PARALLEL_RECORDING_JOBS];
+    QThreadPool *parallelRecordingThreadPool = nullptr;
+    int parallelRecordingJobs = 0;
+    int parallelRecordingThreshold = 0;
+
     VkFormat optimalDsFormat = VK_FORMAT_UNDEFINED;
     QMatrix4x4 clipCorrectMatrix;
 
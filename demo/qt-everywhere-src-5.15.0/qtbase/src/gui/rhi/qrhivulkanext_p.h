@@ -76,6 +76,30 @@ typedef struct VkPipelineVertexInputDivisorStateCreateInfoEXT {
 } VkPipelineVertexInputDivisorStateCreateInfoEXT;
 #endif // VK_EXT_vertex_attribute_divisor
 
+#ifndef VK_KHR_incremental_present
+#define VK_KHR_incremental_present 1
+#define VK_KHR_INCREMENTAL_PRESENT_SPEC_VERSION 1
+#define VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME "VK_KHR_incremental_present"
+
+typedef struct VkRectLayerKHR {
+    VkOffset2D    offset;
+    VkExtent2D    extent;
+    uint32_t      layer;
+} VkRectLayerKHR;
+
+typedef struct VkPresentRegionKHR {
+    uint32_t                 rectangleCount;
+    const VkRectLayerKHR*    pRectangles;
+} VkPresentRegionKHR;
+
+typedef struct VkPresentRegionsKHR {
+    VkStructureType              sType;
+    const void*                  pNext;
+    uint32_t                     swapchainCount;
+    const VkPresentRegionKHR*    pRegions;
+} VkPresentRegionsKHR;
+#endif // VK_KHR_incremental_present
+
 QT_END_NAMESPACE
 
 #endif
@@ -2815,7 +2815,8 @@ void QFontCache::cleanup()
 static QBasicAtomicInt font_cache_id = Q_BASIC_ATOMIC_INITIALIZER(0);
 
 QFontCache::QFontCache()
-    : QObject(), total_cost(0), max_cost(min_cost),
+    : QObject(), shapedTextCache(nullptr),
+      total_cost(0), max_cost(min_cost),
       current_timestamp(0), fast(false), timer_id(-1),
       m_id(font_cache_id.fetchAndAddRelaxed(1) + 1)
 {
@@ -2828,6 +2829,10 @@ QFontCache::~QFontCache()
 
 void QFontCache::clear()
 {
+    // the shaped text holds references to font engines, release them first
+    delete shapedTextCache;
+    shapedTextCache = nullptr;
+
     {
         EngineDataCache::Iterator it = engineDataCache.begin(),
                                  end = engineDataCache.end();
@@ -65,6 +65,7 @@ QT_BEGIN_NAMESPACE
 // forwards
 class QFontCache;
 class QFontEngine;
+class QShapedTextCache;
 
 struct QFontDef
 {
@@ -280,6 +281,9 @@ public:
     void updateHitCountAndTimeStamp(Engine &value);
     void insertEngine(const Key &key, QFontEngine *engine, bool insertMulti = false);
 
+    // shaped text cache, created on demand by QShapedTextCache::instance()
+    QShapedTextCache *shapedTextCache;
+
 private:
     void increaseCost(uint cost);
     void decreaseCost(uint cost);
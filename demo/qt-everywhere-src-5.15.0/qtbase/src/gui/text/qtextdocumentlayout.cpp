@@ -530,6 +530,8 @@ public:
     mutable QBasicTimer sizeChangedTimer;
     uint showLayoutProgress : 1;
     uint insideDocumentChange : 1;
+    uint resyncCheckPoints : 1;
+    int documentChangeDelta;
 
     int lastPageCount;
     qreal idealWidth;
@@ -606,10 +608,12 @@ QTextDocumentLayoutPrivate::QTextDocumentLayoutPrivate()
       cursorWidth(1),
       currentLazyLayoutPosition(-1),
       lazyLayoutStepSize(1000),
+      documentChangeDelta(0),
       lastPageCount(-1)
 {
     showLayoutProgress = true;
     insideDocumentChange = false;
+    resyncCheckPoints = false;
     idealWidth = 0;
     contentHasAlignment = false;
 }
@@ -3087,6 +3091,13 @@ void QTextDocumentLayoutPrivate::layoutFlow(QTextFrame::Iterator it, QTextLayout
 
     QTextFrame::Iterator previousIt;
 
+    // check points of the previous layout run behind the changed range. Once the
+    // flow reaches one of them in the same state as before, the remaining content
+    // is laid out exactly as it was, and there is no need to walk through it again.
+    QVector<QCheckPoint> previousCheckPoints;
+    int previousCheckPointIndex = 0;
+    int previousDocPos = -1;
+
     const bool inRootFrame = (it.parentFrame() == document->rootFrame());
     if (inRootFrame) {
         bool redoCheckPoints = layoutStruct->fullLayout || checkPoints.isEmpty();
@@ -3109,7 +3120,12 @@ void QTextDocumentLayoutPrivate::layoutFlow(QTextFrame::Iterator it, QTextLayout
                 }
 
                 it = frameIteratorForTextPosition(checkPoint->positionInFrame);
-                checkPoints.resize(checkPoint - checkPoints.begin() + 1);
+                const int checkPointIndex = checkPoint - checkPoints.begin();
+                if (resyncCheckPoints && currentLazyLayoutPosition == -1
+                    && layoutStruct->pageHeight == QFIXED_MAX && data(layoutStruct->frame)->floats.isEmpty()) {
+                    previousCheckPoints = checkPoints.mid(checkPointIndex + 1);
+                }
+                checkPoints.resize(checkPointIndex + 1);
 
                 if (checkPoint != checkPoints.begin()) {
                     previousIt = it;
@@ -3163,8 +3179,37 @@ void QTextDocumentLayoutPrivate::layoutFlow(QTextFrame::Iterator it, QTextLayout
                         && docPos > currentLazyLayoutPosition + lazyLayoutStepSize)
                         break;
 
+                    if (previousDocPos > layoutTo && previousCheckPointIndex < previousCheckPoints.size() - 1) {
+                        // the last previous check point marks the end of the document, skip it here
+                        const int previousPos = docPos - documentChangeDelta;
+                        while (previousCheckPointIndex < previousCheckPoints.size() - 1
+                               && previousCheckPoints.at(previousCheckPointIndex).positionInFrame < previousPos)
+                            ++previousCheckPointIndex;
+                        const QCheckPoint &cp = previousCheckPoints.at(previousCheckPointIndex);
+                        if (cp.positionInFrame == previousPos && cp.y == p.y && cp.frameY == p.frameY
+                            && cp.minimumWidth == p.minimumWidth && cp.maximumWidth == p.maximumWidth
+                            && cp.contentsWidth == p.contentsWidth) {
+                            qCDebug(lcLayout) << "layout matches the previous run from" << docPos;
+                            for (int i = previousCheckPointIndex + 1; i < previousCheckPoints.size() - 1; ++i) {
+                                QCheckPoint moved = previousCheckPoints.at(i);
+                                moved.positionInFrame += documentChangeDelta;
+                                checkPoints.append(moved);
+                            }
+                            const QCheckPoint &last = previousCheckPoints.constLast();
+                            layoutStruct->y = last.y;
+                            layoutStruct->minimumWidth = last.minimumWidth;
+                            layoutStruct->maximumWidth = last.maximumWidth;
+                            layoutStruct->contentsWidth = last.contentsWidth;
+                            // nothing below this point moves
+                            if (layoutStruct->updateRect.isValid())
+                                layoutStruct->updateRect.setBottom(qMin(layoutStruct->updateRect.bottom(), p.y.toReal()));
+                            it = layoutStruct->frame->end();
+                            break;
+                        }
+                    }
                 }
             }
+            previousDocPos = docPos;
         }
 
         if (c) {
@@ -3810,8 +3855,13 @@ void QTextDocumentLayout::documentChanged(int from, int oldLength, int length)
         d->checkPoints.clear();
         d->layoutStep();
     } else {
+        // the check points behind the change can only be reused if they
+        // describe a complete layout of the document before this change
+        d->resyncCheckPoints = (d->currentLazyLayoutPosition == -1);
+        d->documentChangeDelta = length - oldLength;
         d->ensureLayoutedByPosition(from);
         updateRect = doLayout(from, oldLength, length);
+        d->resyncCheckPoints = false;
     }
 
     if (!d->layoutTimer.isActive() && d->currentLazyLayoutPosition != -1)
@@ -1389,6 +1389,48 @@ static void applyVisibilityRules(ushort ucs, QGlyphLayout *glyphs, uint glyphPos
     }
 }
 
+static int shapedTextCacheSize()
+{
+    // in kilobytes, per thread; 0 disables the cache
+    static const int size = qEnvironmentVariableIsSet("QT_SHAPED_TEXT_CACHE_SIZE")
+            ? qMax(0, qEnvironmentVariableIntValue("QT_SHAPED_TEXT_CACHE_SIZE"))
+            : 1024;
+    return size;
+}
+
+QShapedTextCache::Entry::Entry(QFontEngine *engine, int numGlyphs, int numChars)
+    : fontEngine(engine),
+      glyphData(numGlyphs * QGlyphLayout::SpaceNeeded, Qt::Uninitialized),
+      logClusters(numChars),
+      numGlyphs(numGlyphs)
+{
+    fontEngine->ref.ref();
+}
+
+QShapedTextCache::Entry::~Entry()
+{
+    if (!fontEngine->ref.deref())
+        delete fontEngine;
+}
+
+QShapedTextCache *QShapedTextCache::instance()
+{
+    const int size = shapedTextCacheSize();
+    if (size == 0)
+        return nullptr;
+    QFontCache *fontCache = QFontCache::instance();
+    if (!fontCache->shapedTextCache)
+        fontCache->shapedTextCache = new QShapedTextCache(size * 1024);
+    return fontCache->shapedTextCache;
+}
+
+void QShapedTextCache::insert(const Key &key, Entry *entry)
+{
+    const int cost = int(sizeof(Entry)) + entry->glyphData.size()
+            + int(sizeof(ushort)) * (entry->logClusters.size() + key.text.size());
+    cache.insert(key, entry, cost);
+}
+
 void QTextEngine::shapeText(int item) const
 {
     Q_ASSERT(item < layoutData->items.size());
@@ -1464,6 +1506,51 @@ void QTextEngine::shapeText(int item) const
             letterSpacing *= font.d->dpi / qt_defaultDpiY();
     }
 
+    // Shaping only depends on the text of the item and the parameters below, so
+    // strings that get laid out over and over again, like the ones in item views,
+    // can reuse the result of a previous run.
+    QShapedTextCache *shapedTextCache = nullptr;
+    QShapedTextCache::Key cacheKey;
+    if (itemLength <= QShapedTextCache::MaximumTextLength)
+        shapedTextCache = QShapedTextCache::instance();
+    if (shapedTextCache) {
+        cacheKey.text = QString(reinterpret_cast<const QChar *>(string), itemLength);
+        cacheKey.fontEngine = fontEngine;
+        cacheKey.letterSpacing = letterSpacing;
+        cacheKey.wordSpacing = wordSpacing;
+        cacheKey.script = si.analysis.script;
+        cacheKey.flags = si.analysis.flags;
+        cacheKey.rightToLeft = si.analysis.bidiLevel % 2;
+        cacheKey.kerningEnabled = kerningEnabled;
+        cacheKey.shapingEnabled = shapingEnabled;
+        cacheKey.letterSpacingIsAbsolute = letterSpacingIsAbsolute;
+        cacheKey.designMetrics = option.useDesignMetrics();
+
+        if (QShapedTextCache::Entry *entry = shapedTextCache->object(cacheKey)) {
+            if (Q_UNLIKELY(!ensureSpace(entry->numGlyphs))) {
+                Q_UNREACHABLE(); // ### report OOM error somehow
+                return;
+            }
+            const QGlyphLayout cached = entry->glyphs();
+            QGlyphLayout glyphs = availableGlyphs(&si);
+            const int n = entry->numGlyphs;
+            memcpy(static_cast<void *>(glyphs.offsets), cached.offsets, n * sizeof(QFixedPoint));
+            memcpy(glyphs.glyphs, cached.glyphs, n * sizeof(glyph_t));
+            memcpy(static_cast<void *>(glyphs.advances), cached.advances, n * sizeof(QFixed));
+            memcpy(static_cast<void *>(glyphs.justifications), cached.justifications, n * sizeof(QGlyphJustification));
+            memcpy(glyphs.attributes, cached.attributes, n * sizeof(QGlyphAttributes));
+            memcpy(logClusters(&si), entry->logClusters.constData(), itemLength * sizeof(ushort));
+
+            si.num_glyphs = n;
+            si.ascent = qMax(si.ascent, entry->ascent);
+            si.descent = qMax(si.descent, entry->descent);
+            si.leading = qMax(si.leading, entry->leading);
+            si.width = entry->width;
+            layoutData->used += n;
+            return;
+        }
+    }
+
     // split up the item into parts that come from different font engines
     // k * 3 entries, array[k] == index in string, array[k + 1] == index in glyphs, array[k + 2] == engine index
     QVector<uint> itemBoundaries;
@@ -1595,6 +1682,23 @@ void QTextEngine::shapeText(int item) const
 
     for (int i = 0; i < si.num_glyphs; ++i)
         si.width += glyphs.advances[i] * !glyphs.attributes[i].dontPrint;
+
+    if (shapedTextCache) {
+        QShapedTextCache::Entry *entry = new QShapedTextCache::Entry(fontEngine, si.num_glyphs, itemLength);
+        QGlyphLayout cached = entry->glyphs();
+        const int n = si.num_glyphs;
+        memcpy(static_cast<void *>(cached.offsets), glyphs.offsets, n * sizeof(QFixedPoint));
+        memcpy(cached.glyphs, glyphs.glyphs, n * sizeof(glyph_t));
+        memcpy(static_cast<void *>(cached.advances), glyphs.advances, n * sizeof(QFixed));
+        memcpy(static_cast<void *>(cached.justifications), glyphs.justifications, n * sizeof(QGlyphJustification));
+        memcpy(cached.attributes, glyphs.attributes, n * sizeof(QGlyphAttributes));
+        memcpy(entry->logClusters.data(), logClusters(&si), itemLength * sizeof(ushort));
+        entry->ascent = si.ascent;
+        entry->descent = si.descent;
+        entry->leading = si.leading;
+        entry->width = si.width;
+        shapedTextCache->insert(cacheKey, entry);
+    }
 }
 
 #if QT_CONFIG(harfbuzz)
@@ -64,6 +64,7 @@
 #include "QtGui/qtextoption.h"
 #include "QtGui/qtextcursor.h"
 #include "QtCore/qset.h"
+#include "QtCore/qcache.h"
 #include "QtCore/qdebug.h"
 #ifndef QT_BUILD_COMPAT_LIB
 #include "private/qtextdocument_p.h"
@@ -669,6 +670,80 @@ private:
     int getClusterLength(unsigned short *logClusters, const QCharAttributes *attributes, int from, int to, int glyph_pos, int *start);
 };
 
+/// Per-thread cache of shaped text items, owned by QFontCache
+class QShapedTextCache
+{
+public:
+    enum { MaximumTextLength = 256 };
+
+    struct Key {
+        QString text;
+        QFontEngine *fontEngine;
+        QFixed letterSpacing;
+        QFixed wordSpacing;
+        ushort script;
+        ushort flags;
+        uint rightToLeft : 1;
+        uint kerningEnabled : 1;
+        uint shapingEnabled : 1;
+        uint letterSpacingIsAbsolute : 1;
+        uint designMetrics : 1;
+
+        bool operator==(const Key &other) const
+        {
+            return fontEngine == other.fontEngine
+                    && script == other.script && flags == other.flags
+                    && rightToLeft == other.rightToLeft
+                    && kerningEnabled == other.kerningEnabled
+                    && shapingEnabled == other.shapingEnabled
+                    && letterSpacingIsAbsolute == other.letterSpacingIsAbsolute
+                    && designMetrics == other.designMetrics
+                    && letterSpacing == other.letterSpacing
+                    && wordSpacing == other.wordSpacing
+                    && text == other.text;
+        }
+    };
+
+    struct Entry {
+        Entry(QFontEngine *engine, int numGlyphs, int numChars);
+        ~Entry();
+
+        QFontEngine *fontEngine; // holds a reference
+        QByteArray glyphData;
+        QVarLengthArray<ushort, 32> logClusters;
+        int numGlyphs;
+        QFixed ascent;
+        QFixed descent;
+        QFixed leading;
+        QFixed width;
+
+        QGlyphLayout glyphs() { return QGlyphLayout(glyphData.data(), numGlyphs); }
+
+    private:
+        Q_DISABLE_COPY_MOVE(Entry)
+    };
+
+    static QShapedTextCache *instance();
+
+    explicit QShapedTextCache(int maxCost) : cache(maxCost) { }
+
+    Entry *object(const Key &key) const { return cache.object(key); }
+    void insert(const Key &key, Entry *entry);
+
+private:
+    QCache<Key, Entry> cache;
+};
+
+inline uint qHash(const QShapedTextCache::Key &key, uint seed = 0) noexcept
+{
+    QtPrivate::QHashCombine hash;
+    seed = hash(seed, key.text);
+    seed = hash(seed, key.fontEngine);
+    seed = hash(seed, key.script);
+    seed = hash(seed, key.letterSpacing.value());
+    return seed;
+}
+
 class Q_GUI_EXPORT QStackTextEngine : public QTextEngine {
 public:
     enum { MemSize = 256*40/sizeof(void *) };
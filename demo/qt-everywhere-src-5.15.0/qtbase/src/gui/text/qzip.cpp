@@ -47,6 +47,7 @@
 #include <qendian.h>
 #include <qdebug.h>
 #include <qdir.h>
+#include <private/qtools_p.h>
 
 #include <zlib.h>
 
@@ -161,17 +162,11 @@ static int inflate(Bytef *dest, ulong *destLen, const Bytef *source, ulong sourc
     return err;
 }
 
-static int deflate (Bytef *dest, ulong *destLen, const Bytef *source, ulong sourceLen)
+static int deflate(QByteArray *dest, const QByteArray &source)
 {
     z_stream stream;
     int err;
 
-    stream.next_in = const_cast<Bytef*>(source);
-    stream.avail_in = (uInt)sourceLen;
-    stream.next_out = dest;
-    stream.avail_out = (uInt)*destLen;
-    if ((uLong)stream.avail_out != *destLen) return Z_BUF_ERROR;
-
     stream.zalloc = (alloc_func)nullptr;
     stream.zfree = (free_func)nullptr;
     stream.opaque = (voidpf)nullptr;
@@ -179,12 +174,26 @@ static int deflate (Bytef *dest, ulong *destLen, const Bytef *source, ulong sour
     err = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
     if (err != Z_OK) return err;
 
+    // deflateBound() is exact for the parameters above, so a single
+    // pass always fits and we never have to compress the data twice
+    const uLong bound = deflateBound(&stream, source.size());
+    if (bound >= uLong(MaxAllocSize - sizeof(QByteArrayData))) {
+        deflateEnd(&stream);
+        return Z_MEM_ERROR;
+    }
+    dest->resize(int(bound));
+
+    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(source.constData()));
+    stream.avail_in = (uInt)source.size();
+    stream.next_out = reinterpret_cast<Bytef *>(dest->data());
+    stream.avail_out = (uInt)bound;
+
     err = deflate(&stream, Z_FINISH);
     if (err != Z_STREAM_END) {
         deflateEnd(&stream);
         return err == Z_OK ? Z_BUF_ERROR : err;
     }
-    *destLen = stream.total_out;
+    dest->resize(int(stream.total_out));
 
     err = deflateEnd(&stream);
     return err;
@@ -677,33 +686,28 @@ void QZipWriterPrivate::addEntry(EntryType type, const QString &fileName, const
     writeUShort(header.h.version_needed, ZIP_VERSION);
     writeUInt(header.h.uncompressed_size, contents.length());
     writeMSDosDate(header.h.last_mod_file, QDateTime::currentDateTime());
-    QByteArray data = contents;
+    QByteArray data;
     if (compression == QZipWriter::AlwaysCompress) {
-        writeUShort(header.h.compression_method, CompressionMethodDeflated);
-
-       ulong len = contents.length();
-        // shamelessly copied form zlib
-        len += (len >> 12) + (len >> 14) + 11;
-        int res;
-        do {
-            data.resize(len);
-            res = deflate((uchar*)data.data(), &len, (const uchar*)contents.constData(), contents.length());
-
-            switch (res) {
-            case Z_OK:
-                data.resize(len);
-                break;
-            case Z_MEM_ERROR:
-                qWarning("QZip: Z_MEM_ERROR: Not enough memory to compress file, skipping");
-                data.resize(0);
-                break;
-            case Z_BUF_ERROR:
-                len *= 2;
-                break;
-            }
-        } while (res == Z_BUF_ERROR);
+        switch (deflate(&data, contents)) {
+        case Z_OK:
+            break;
+        case Z_MEM_ERROR:
+            qWarning("QZip: Z_MEM_ERROR: Not enough memory to compress file, skipping");
+            data.clear();
+            break;
+        default:
+            qWarning("QZip: Failed to compress file, skipping");
+            data.clear();
+            break;
+        }
+        // incompressible input can grow; store it instead unless the caller insisted
+        if (compressionPolicy == QZipWriter::AutoCompress && data.length() >= contents.length())
+            compression = QZipWriter::NeverCompress;
+        else
+            writeUShort(header.h.compression_method, CompressionMethodDeflated);
     }
-// TODO add a check if data.length() > contents.length().  Then try to store the original and revert the compression method to be uncompressed
+    if (compression == QZipWriter::NeverCompress)
+        data = contents;
     writeUInt(header.h.compressed_size, data.length());
     uint crc_32 = ::crc32(0, nullptr, 0);
     crc_32 = ::crc32(crc_32, (const uchar *)contents.constData(), contents.length());
@@ -0,0 +1,302 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qktx2handler_p.h"
+#include "qtexturefiledata_p.h"
+#include <QtGui/private/qtguiglobal_p.h>
+#include <QtEndian>
+#include <QSize>
+#include <QVarLengthArray>
+
+#include <limits>
+
+#if QT_CONFIG(zstd)
+#include <zstd.h>
+#endif
+
+QT_BEGIN_NAMESPACE
+
+#define KTX2_IDENTIFIER_LENGTH 12
+static const char ktx2Identifier[KTX2_IDENTIFIER_LENGTH] = { '\xAB', 'K', 'T', 'X', ' ', '2', '0', '\xBB', '\r', '\n', '\x1A', '\n' };
+
+// All fields are little endian
+struct KTX2Header {
+    quint8 identifier[KTX2_IDENTIFIER_LENGTH]; // Must match ktx2Identifier
+    quint32 vkFormat;
+    quint32 typeSize;
+    quint32 pixelWidth;
+    quint32 pixelHeight;
+    quint32 pixelDepth;
+    quint32 layerCount;
+    quint32 faceCount;
+    quint32 levelCount;
+    quint32 supercompressionScheme;
+    quint32 dfdByteOffset;
+    quint32 dfdByteLength;
+    quint32 kvdByteOffset;
+    quint32 kvdByteLength;
+    quint64 sgdByteOffset;
+    quint64 sgdByteLength;
+};
+
+struct KTX2LevelIndexEntry {
+    quint64 byteOffset;
+    quint64 byteLength;
+    quint64 uncompressedByteLength;
+};
+
+enum KTX2SupercompressionScheme {
+    SupercompressionNone = 0,
+    SupercompressionBasisLZ = 1,
+    SupercompressionZstandard = 2,
+    SupercompressionZLIB = 3
+};
+
+static const quint32 headerSize = sizeof(KTX2Header);
+
+// Maps the VkFormat of a block compressed image to the equivalent GL
+// internal format, which is what QTextureFileData and its users speak.
+static quint32 glInternalFormatForVkFormat(quint32 vkFormat)
+{
+    switch (vkFormat) {
+    case 131: return 0x83F0; // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+    case 132: return 0x8C4C; // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+    case 133: return 0x83F1; // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+    case 134: return 0x8C4D; // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+    case 135: return 0x83F2; // VK_FORMAT_BC2_UNORM_BLOCK
+    case 136: return 0x8C4E; // VK_FORMAT_BC2_SRGB_BLOCK
+    case 137: return 0x83F3; // VK_FORMAT_BC3_UNORM_BLOCK
+    case 138: return 0x8C4F; // VK_FORMAT_BC3_SRGB_BLOCK
+    case 139: return 0x8DBB; // VK_FORMAT_BC4_UNORM_BLOCK
+    case 140: return 0x8DBC; // VK_FORMAT_BC4_SNORM_BLOCK
+    case 141: return 0x8DBD; // VK_FORMAT_BC5_UNORM_BLOCK
+    case 142: return 0x8DBE; // VK_FORMAT_BC5_SNORM_BLOCK
+    case 143: return 0x8E8F; // VK_FORMAT_BC6H_UFLOAT_BLOCK
+    case 144: return 0x8E8E; // VK_FORMAT_BC6H_SFLOAT_BLOCK
+    case 145: return 0x8E8C; // VK_FORMAT_BC7_UNORM_BLOCK
+    case 146: return 0x8E8D; // VK_FORMAT_BC7_SRGB_BLOCK
+    case 147: return 0x9274; // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+    case 148: return 0x9275; // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+    case 149: return 0x9276; // VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK
+    case 150: return 0x9277; // VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK
+    case 151: return 0x9278; // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+    case 152: return 0x9279; // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+    case 153: return 0x9270; // VK_FORMAT_EAC_R11_UNORM_BLOCK
+    case 154: return 0x9271; // VK_FORMAT_EAC_R11_SNORM_BLOCK
+    case 155: return 0x9272; // VK_FORMAT_EAC_R11G11_UNORM_BLOCK
+    case 156: return 0x9273; // VK_FORMAT_EAC_R11G11_SNORM_BLOCK
+    default:
+        break;
+    }
+
+    // VK_FORMAT_ASTC_4x4_UNORM_BLOCK .. VK_FORMAT_ASTC_12x12_SRGB_BLOCK, in
+    // UNORM/SRGB pairs and in the same block size order as the GL enums.
+    if (vkFormat >= 157 && vkFormat <= 184) {
+        const quint32 blockSizeIndex = (vkFormat - 157) / 2;
+        const bool srgb = (vkFormat - 157) % 2;
+        return (srgb ? 0x93D0 : 0x93B0) + blockSizeIndex;
+    }
+
+    return 0;
+}
+
+static QByteArray supercompressionSchemeName(quint32 scheme)
+{
+    switch (scheme) {
+    case SupercompressionBasisLZ:
+        return QByteArrayLiteral("BasisLZ");
+    case SupercompressionZstandard:
+        return QByteArrayLiteral("Zstandard");
+    case SupercompressionZLIB:
+        return QByteArrayLiteral("ZLIB");
+    default:
+        return QByteArray::number(scheme);
+    }
+}
+
+static bool inflateLevel(quint32 scheme, const char *src, quint64 srcSize, char *dst, quint64 dstSize)
+{
+    switch (scheme) {
+#if QT_CONFIG(zstd)
+    case SupercompressionZstandard:
+    {
+        const size_t result = ZSTD_decompress(dst, size_t(dstSize), src, size_t(srcSize));
+        return !ZSTD_isError(result) && result == dstSize;
+    }
+#endif
+    case SupercompressionZLIB:
+    {
+        // qUncompress() wants the expected size up front, in big endian
+        QByteArray compressed;
+        compressed.reserve(int(srcSize) + 4);
+        const quint32 expectedSize = qToBigEndian(quint32(dstSize));
+        compressed.append(reinterpret_cast<const char *>(&expectedSize), 4);
+        compressed.append(src, int(srcSize));
+        const QByteArray uncompressed = qUncompress(compressed);
+        if (quint64(uncompressed.size()) != dstSize)
+            return false;
+        memcpy(dst, uncompressed.constData(), size_t(dstSize));
+        return true;
+    }
+    default:
+        break;
+    }
+    return false;
+}
+
+bool QKtx2Handler::canRead(const QByteArray &suffix, const QByteArray &block)
+{
+    Q_UNUSED(suffix)
+
+    return (qstrncmp(block.constData(), ktx2Identifier, KTX2_IDENTIFIER_LENGTH) == 0);
+}
+
+QTextureFileData QKtx2Handler::read()
+{
+    if (!device())
+        return QTextureFileData();
+
+    QByteArray buf = device()->readAll();
+    const quint64 dataSize = quint64(buf.size());
+    if (dataSize < headerSize || !canRead(QByteArray(), buf)) {
+        qCDebug(lcQtGuiTextureIO, "Invalid KTX2 file %s", logName().constData());
+        return QTextureFileData();
+    }
+
+    KTX2Header header;
+    memcpy(&header, buf.constData(), headerSize);
+    const quint32 vkFormat = qFromLittleEndian(header.vkFormat);
+    const quint32 pixelWidth = qFromLittleEndian(header.pixelWidth);
+    const quint32 pixelHeight = qFromLittleEndian(header.pixelHeight);
+    const quint32 pixelDepth = qFromLittleEndian(header.pixelDepth);
+    const quint32 layerCount = qFromLittleEndian(header.layerCount);
+    const quint32 faceCount = qFromLittleEndian(header.faceCount);
+    const quint32 levelCount = qMax(1u, qFromLittleEndian(header.levelCount));
+    const quint32 scheme = qFromLittleEndian(header.supercompressionScheme);
+
+    // Only plain 2D images are supported, like with KTX 1.1.
+    if (pixelDepth > 1 || layerCount > 1 || faceCount != 1 || levelCount > 32) {
+        qCDebug(lcQtGuiTextureIO, "Unsupported KTX2 file layout in %s", logName().constData());
+        return QTextureFileData();
+    }
+
+    const quint32 glInternalFormat = glInternalFormatForVkFormat(vkFormat);
+    if (!glInternalFormat) {
+        qCDebug(lcQtGuiTextureIO, "Unsupported VkFormat %u in KTX2 file %s", vkFormat, logName().constData());
+        return QTextureFileData();
+    }
+
+    if (scheme != SupercompressionNone && scheme != SupercompressionZLIB
+#if QT_CONFIG(zstd)
+            && scheme != SupercompressionZstandard
+#endif
+            ) {
+        qCDebug(lcQtGuiTextureIO, "Unsupported KTX2 supercompression scheme %s in %s",
+                supercompressionSchemeName(scheme).constData(), logName().constData());
+        return QTextureFileData();
+    }
+
+    if (headerSize + levelCount * sizeof(KTX2LevelIndexEntry) > dataSize) {
+        qCDebug(lcQtGuiTextureIO, "Invalid level index in KTX2 file %s", logName().constData());
+        return QTextureFileData();
+    }
+
+    const int numLevels = int(levelCount);
+    QVarLengthArray<KTX2LevelIndexEntry, 16> levels(numLevels);
+    memcpy(levels.data(), buf.constData() + headerSize, levelCount * sizeof(KTX2LevelIndexEntry));
+    quint64 totalUncompressedSize = 0;
+    for (KTX2LevelIndexEntry &level : levels) {
+        level.byteOffset = qFromLittleEndian(level.byteOffset);
+        level.byteLength = qFromLittleEndian(level.byteLength);
+        level.uncompressedByteLength = qFromLittleEndian(level.uncompressedByteLength);
+        if (level.byteOffset > dataSize || level.byteLength > dataSize - level.byteOffset) {
+            qCDebug(lcQtGuiTextureIO, "Invalid level data in KTX2 file %s", logName().constData());
+            return QTextureFileData();
+        }
+        totalUncompressedSize += scheme == SupercompressionNone ? level.byteLength : level.uncompressedByteLength;
+    }
+
+    if (totalUncompressedSize > quint64(std::numeric_limits<int>::max())) {
+        qCDebug(lcQtGuiTextureIO, "KTX2 file %s is too large", logName().constData());
+        return QTextureFileData();
+    }
+
+    QTextureFileData texData;
+    texData.setSize(QSize(int(pixelWidth), int(pixelHeight)));
+    texData.setGLInternalFormat(glInternalFormat);
+    texData.setNumLevels(numLevels);
+
+    if (scheme == SupercompressionNone) {
+        texData.setData(buf);
+        for (int i = 0; i < levels.count(); ++i) {
+            texData.setDataOffset(int(levels[i].byteOffset), i);
+            texData.setDataLength(int(levels[i].byteLength), i);
+        }
+    } else {
+        // Inflate into one contiguous block, in level order. This happens on
+        // whichever thread reads the file, typically a QQuickPixmap loader
+        // thread, so the render thread only ever sees GPU ready data.
+        QByteArray inflated(int(totalUncompressedSize), Qt::Uninitialized);
+        int offset = 0;
+        for (int i = 0; i < levels.count(); ++i) {
+            const KTX2LevelIndexEntry &level(levels[i]);
+            if (!inflateLevel(scheme, buf.constData() + level.byteOffset, level.byteLength,
+                              inflated.data() + offset, level.uncompressedByteLength)) {
+                qCDebug(lcQtGuiTextureIO, "Failed to inflate level %d of KTX2 file %s (%s)",
+                        i, logName().constData(), supercompressionSchemeName(scheme).constData());
+                return QTextureFileData();
+            }
+            texData.setDataOffset(offset, i);
+            texData.setDataLength(int(level.uncompressedByteLength), i);
+            offset += int(level.uncompressedByteLength);
+        }
+        texData.setData(inflated);
+    }
+
+    if (!texData.isValid()) {
+        qCDebug(lcQtGuiTextureIO, "Invalid values in header of KTX2 file %s", logName().constData());
+        return QTextureFileData();
+    }
+
+    texData.setLogName(logName());
+
+    return texData;
+}
+
+QT_END_NAMESPACE
@@ -41,6 +41,7 @@
 
 #include "qpkmhandler_p.h"
 #include "qktxhandler_p.h"
+#include "qktx2handler_p.h"
 #include "qastchandler_p.h"
 
 #include <QFileInfo>
@@ -81,6 +82,8 @@ bool QTextureFileReader::canRead()
             m_handler = new QPkmHandler(m_device, logName);
         } else if (QKtxHandler::canRead(suffix, headerBlock)) {
             m_handler = new QKtxHandler(m_device, logName);
+        } else if (QKtx2Handler::canRead(suffix, headerBlock)) {
+            m_handler = new QKtx2Handler(m_device, logName);
         } else if (QAstcHandler::canRead(suffix, headerBlock)) {
             m_handler = new QAstcHandler(m_device, logName);
         }
@@ -92,7 +95,7 @@ bool QTextureFileReader::canRead()
 QList<QByteArray> QTextureFileReader::supportedFileFormats()
 {
     // Hardcoded for now
-    return {QByteArrayLiteral("pkm"), QByteArrayLiteral("ktx"), QByteArrayLiteral("astc")};
+    return {QByteArrayLiteral("pkm"), QByteArrayLiteral("ktx"), QByteArrayLiteral("ktx2"), QByteArrayLiteral("astc")};
 }
 
 bool QTextureFileReader::init()
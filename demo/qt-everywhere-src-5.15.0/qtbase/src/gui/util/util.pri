@@ -19,6 +19,7 @@ HEADERS += \
         util/qtexturefilehandler_p.h \
         util/qpkmhandler_p.h \
         util/qktxhandler_p.h \
+        util/qktx2handler_p.h \
         util/qastchandler_p.h
 
 SOURCES += \
@@ -38,8 +39,11 @@ SOURCES += \
         util/qtexturefilereader.cpp \
         util/qpkmhandler.cpp \
         util/qktxhandler.cpp \
+        util/qktx2handler.cpp \
         util/qastchandler.cpp
 
+qtConfig(zstd): QMAKE_USE_PRIVATE += zstd
+
 qtConfig(regularexpression) {
     HEADERS += \
         util/qshadergenerator_p.h
@@ -133,6 +133,37 @@ bool is_request_pseudo_header(const QByteArray &name)
            name == ":authority" || name == ":path";
 }
 
+// Fields whose values are rarely repeated: indexing them would only evict
+// entries that are (auth tokens, user agents, tracing headers and so on).
+bool is_seldom_repeated(const QByteArray &name)
+{
+    return name == ":path" || name == "content-length" || name == "range"
+           || name == "if-match" || name == "if-none-match" || name == "if-range"
+           || name == "if-modified-since" || name == "if-unmodified-since";
+}
+
+const BitPattern &literal_field_type(const HeaderField &field, quint32 tableCapacity)
+{
+    // HPACK, 7.1.3: short values of sensitive fields are easy to guess
+    // and must not be exposed to compression-based attacks, never index them.
+    if (field.value.size() < 20 && (field.name == "authorization"
+                                    || field.name == "proxy-authorization"
+                                    || field.name == "cookie")) {
+        return LiteralNeverIndexing;
+    }
+
+    if (is_seldom_repeated(field.name))
+        return LiteralNoIndexing;
+
+    // An entry taking most of the table would flush it for
+    // little gain, unless we see exactly the same header again.
+    const HeaderSize size = entry_size(field);
+    if (!size.first || size.second > tableCapacity / 4 * 3)
+        return LiteralNoIndexing;
+
+    return LiteralIncrementalIndexing;
+}
+
 } // unnamed namespace
 
 Encoder::Encoder(quint32 size, bool compress)
@@ -153,6 +184,9 @@ bool Encoder::encodeRequest(BitOStream &outputStream, const HttpHeader &header)
         return false;
     }
 
+    if (!encodePendingSizeUpdates(outputStream))
+        return false;
+
     if (!encodeRequestPseudoHeaders(outputStream, header))
         return false;
 
@@ -174,6 +208,9 @@ bool Encoder::encodeResponse(BitOStream &outputStream, const HttpHeader &header)
         return false;
     }
 
+    if (!encodePendingSizeUpdates(outputStream))
+        return false;
+
     if (!encodeResponsePseudoHeaders(outputStream, header))
         return false;
 
@@ -205,6 +242,19 @@ void Encoder::setMaxDynamicTableSize(quint32 size)
 {
     // Up to a caller (HTTP2 protocol handler)
     // to validate this size first.
+    if (!sizeUpdatePending && size == lookupTable.dynamicTableCapacity()) {
+        lookupTable.setMaxDynamicTableSize(size);
+        return;
+    }
+
+    // HPACK, 4.2: the change must be signalled at the beginning of the
+    // next header block; if the size was reduced in between, the smallest
+    // value must be signalled first (our table was already shrunk to it,
+    // the decoder's table has to evict the same entries).
+    if (!sizeUpdatePending || size < minPendingSize)
+        minPendingSize = size;
+    sizeUpdatePending = true;
+
     lookupTable.setMaxDynamicTableSize(size);
 }
 
@@ -213,6 +263,24 @@ void Encoder::setCompressStrings(bool compress)
     compressStrings = compress;
 }
 
+bool Encoder::encodePendingSizeUpdates(BitOStream &outputStream)
+{
+    if (!sizeUpdatePending)
+        return true;
+
+    sizeUpdatePending = false;
+    const quint32 newSize = lookupTable.dynamicTableCapacity();
+    if (minPendingSize < newSize) {
+        write_bit_pattern(SizeUpdate, outputStream);
+        outputStream.write(minPendingSize);
+    }
+
+    write_bit_pattern(SizeUpdate, outputStream);
+    outputStream.write(newSize);
+
+    return true;
+}
+
 bool Encoder::encodeRequestPseudoHeaders(BitOStream &outputStream,
                                          const HttpHeader &header)
 {
@@ -286,21 +354,22 @@ bool Encoder::encodeRequestPseudoHeaders(BitOStream &outputStream,
 
 bool Encoder::encodeHeaderField(BitOStream &outputStream, const HeaderField &field)
 {
-    // TODO: at the moment we never use LiteralNo/Never Indexing ...
-
     // Here we try:
     // 1. indexed
-    // 2. literal indexed with indexed name/literal value
-    // 3. literal indexed with literal name/literal value
+    // 2. literal with indexed name/literal value
+    // 3. literal with literal name/literal value
+    // Literals are added to the dynamic table unless they are unlikely
+    // to be sent again (or must not be indexed at all), see literal_field_type.
     if (const auto index = lookupTable.indexOf(field.name, field.value))
         return encodeIndexedField(outputStream, index);
 
+    const BitPattern &fieldType = literal_field_type(field, lookupTable.dynamicTableCapacity());
     if (const auto index = lookupTable.indexOf(field.name)) {
-        return encodeLiteralField(outputStream, LiteralIncrementalIndexing,
+        return encodeLiteralField(outputStream, fieldType,
                                   index, field.value, compressStrings);
     }
 
-    return encodeLiteralField(outputStream, LiteralIncrementalIndexing,
+    return encodeLiteralField(outputStream, fieldType,
                               field.name, field.value, compressStrings);
 }
 
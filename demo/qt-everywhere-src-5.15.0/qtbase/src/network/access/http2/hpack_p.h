@@ -82,10 +82,14 @@ public:
     bool encodeSizeUpdate(BitOStream &outputStream,
                           quint32 newSize);
 
+    // The peer's SETTINGS_HEADER_TABLE_SIZE. The table is resized at once,
+    // the decoder is informed at the start of the next header block.
     void setMaxDynamicTableSize(quint32 size);
     void setCompressStrings(bool compress);
 
 private:
+    bool encodePendingSizeUpdates(BitOStream &outputStream);
+
     bool encodeRequestPseudoHeaders(BitOStream &outputStream,
                                     const HttpHeader &header);
     bool encodeHeaderField(BitOStream &outputStream,
@@ -113,6 +117,9 @@ private:
 
     FieldLookupTable lookupTable;
     bool compressStrings;
+
+    bool sizeUpdatePending = false;
+    quint32 minPendingSize = 0;
 };
 
 class Q_AUTOTEST_EXPORT Decoder
@@ -239,6 +239,11 @@ quint32 FieldLookupTable::dynamicDataSize() const
     return dataSize;
 }
 
+quint32 FieldLookupTable::dynamicTableCapacity() const
+{
+    return tableCapacity;
+}
+
 void FieldLookupTable::clearDynamicTable()
 {
     searchIndex.clear();
@@ -418,6 +423,7 @@ bool FieldLookupTable::updateDynamicTableSize(quint32 size)
 {
     if (!size) {
         clearDynamicTable();
+        tableCapacity = 0;
         return true;
     }
 
@@ -95,8 +95,8 @@ uchar Frame::padding() const
     case FrameType::DATA:
     case FrameType::PUSH_PROMISE:
     case FrameType::HEADERS:
-        Q_ASSERT(buffer.size() > frameHeaderSize);
-        return buffer[frameHeaderSize];
+        Q_ASSERT(storedPayloadSize() > 0);
+        return payloadBegin()[0];
     default:
         return 0;
     }
@@ -106,10 +106,10 @@ bool Frame::priority(quint32 *streamID, uchar *weight) const
 {
     Q_ASSERT(validatePayload() == FrameStatus::goodFrame);
 
-    if (buffer.size() <= frameHeaderSize)
+    if (!storedPayloadSize())
         return false;
 
-    const uchar *src = &buffer[0] + frameHeaderSize;
+    const uchar *src = payloadBegin();
     if (type() == FrameType::HEADERS && flags().testFlag(FrameFlag::PADDED))
         ++src;
 
@@ -191,9 +191,9 @@ FrameStatus Frame::validatePayload() const
         return FrameStatus::goodFrame;
 
     auto size = payloadSize();
-    Q_ASSERT(buffer.size() >= frameHeaderSize && size == buffer.size() - frameHeaderSize);
+    Q_ASSERT(buffer.size() >= frameHeaderSize && size == storedPayloadSize());
 
-    const uchar *src = size ? &buffer[0] + frameHeaderSize : nullptr;
+    const uchar *src = size ? payloadBegin() : nullptr;
     const auto frameFlags = flags();
     switch (type()) {
     // 6.1 DATA, 6.2 HEADERS
@@ -265,10 +265,10 @@ quint32 Frame::hpackBlockSize() const
 const uchar *Frame::dataBegin() const
 {
     Q_ASSERT(validatePayload() == FrameStatus::goodFrame);
-    if (buffer.size() <= frameHeaderSize)
+    if (!storedPayloadSize())
         return nullptr;
 
-    const uchar *src = &buffer[0] + frameHeaderSize;
+    const uchar *src = payloadBegin();
     if (padding())
         ++src;
 
@@ -293,6 +293,45 @@ const uchar *Frame::hpackBlockBegin() const
     return begin;
 }
 
+QByteArray Frame::dataPayload() const
+{
+    Q_ASSERT(validatePayload() == FrameStatus::goodFrame);
+    Q_ASSERT(type() == FrameType::DATA);
+
+    const quint32 size = dataSize();
+    if (!size)
+        return QByteArray();
+
+    if (!data.isEmpty()) {
+        // Unpadded - the payload is the data itself, no copy:
+        if (quint32(data.size()) == size)
+            return data;
+        return data.mid(1, int(size));
+    }
+
+    return QByteArray(reinterpret_cast<const char *>(dataBegin()), int(size));
+}
+
+const uchar *Frame::payloadBegin() const
+{
+    if (!data.isEmpty())
+        return reinterpret_cast<const uchar *>(data.constData());
+
+    if (buffer.size() <= frameHeaderSize)
+        return nullptr;
+
+    return &buffer[0] + frameHeaderSize;
+}
+
+quint32 Frame::storedPayloadSize() const
+{
+    if (!data.isEmpty())
+        return quint32(data.size());
+
+    Q_ASSERT(buffer.size() >= frameHeaderSize);
+    return quint32(buffer.size() - frameHeaderSize);
+}
+
 FrameStatus FrameReader::read(QAbstractSocket &socket)
 {
     if (offset < frameHeaderSize) {
@@ -308,11 +347,19 @@ FrameStatus FrameReader::read(QAbstractSocket &socket)
         if (Http2PredefinedParameters::maxPayloadSize < frame.payloadSize())
             return FrameStatus::sizeError;
 
-        frame.buffer.resize(frame.payloadSize() + frameHeaderSize);
+        frame.data.clear();
+        if (frame.type() == FrameType::DATA)
+            frame.buffer.resize(frameHeaderSize);
+        else
+            frame.buffer.resize(frame.payloadSize() + frameHeaderSize);
     }
 
-    if (offset < frame.buffer.size() && !readPayload(socket))
-        return FrameStatus::incompleteFrame;
+    if (offset < frame.payloadSize() + frameHeaderSize) {
+        const bool done = frame.type() == FrameType::DATA ? readDataPayload(socket)
+                                                         : readPayload(socket);
+        if (!done)
+            return FrameStatus::incompleteFrame;
+    }
 
     // Reset the offset, our frame can be re-used
     // now (re-read):
@@ -352,6 +399,38 @@ bool FrameReader::readPayload(QAbstractSocket &socket)
     return offset == buffer.size();
 }
 
+bool FrameReader::readDataPayload(QAbstractSocket &socket)
+{
+    Q_ASSERT(frame.type() == FrameType::DATA);
+
+    const quint32 size = frame.payloadSize();
+    const quint32 received = offset - frameHeaderSize;
+    Q_ASSERT(received < size);
+
+    if (!received && socket.bytesAvailable() >= qint64(size)) {
+        // The whole payload is buffered by the socket already: read it in one
+        // go into the byte array we hand out later. If the payload happens to
+        // fill the socket's next read buffer chunk, QIODevice returns that very
+        // chunk and nothing is copied at all.
+        frame.data = socket.read(qint64(size));
+        offset += quint32(frame.data.size());
+        if (offset == size + frameHeaderSize)
+            return true;
+        // Should not happen, but continue as with a partial read.
+        frame.data.resize(int(size));
+        return false;
+    }
+
+    if (!received)
+        frame.data.resize(int(size));
+
+    const auto chunkSize = socket.read(frame.data.data() + received, qint64(size - received));
+    if (chunkSize > 0)
+        offset += quint32(chunkSize);
+
+    return offset == size + frameHeaderSize;
+}
+
 FrameWriter::FrameWriter()
 {
 }
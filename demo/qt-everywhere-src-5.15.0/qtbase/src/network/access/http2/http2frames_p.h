@@ -54,6 +54,7 @@
 #include "http2protocol_p.h"
 #include "hpack_p.h"
 
+#include <QtCore/qbytearray.h>
 #include <QtCore/qendian.h>
 #include <QtCore/qglobal.h>
 
@@ -94,8 +95,19 @@ struct Q_AUTOTEST_EXPORT Frame
     const uchar *dataBegin() const;
     // HEADERS data beginning for HEADERS, PUSH_PROMISE and CONTINUATION streams:
     const uchar *hpackBlockBegin() const;
+    // DATA payload without padding, as a byte array sharing the frame's
+    // storage (for frames read by FrameReader no copy is made):
+    QByteArray dataPayload() const;
 
     std::vector<uchar> buffer;
+    // FrameReader keeps the payload of DATA frames in 'data' instead of
+    // 'buffer', so that it can be passed on to a reply without copying;
+    // 'buffer' then contains the frame header only.
+    QByteArray data;
+
+private:
+    const uchar *payloadBegin() const;
+    quint32 storedPayloadSize() const;
 };
 
 class Q_AUTOTEST_EXPORT FrameReader
@@ -110,6 +122,7 @@ public:
 private:
     bool readHeader(QAbstractSocket &socket);
     bool readPayload(QAbstractSocket &socket);
+    bool readDataPayload(QAbstractSocket &socket);
 
     quint32 offset = 0;
     Frame frame;
@@ -44,6 +44,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
@@ -60,32 +61,16 @@ namespace HPack
     code length. All codes were left-aligned - for implementation
     convenience.
 
-    Using binary trees to implement decoding would be prohibitively
-    expensive (both memory and time-wise). Instead we use a table-based
-    approach and any given code itself works as an index into such table(s).
-    We have 256 possible byte values and code lengths in
-    a range [5, 26]. This would require a huge table (and most of entries
-    would be 'wasted', since we only have to encode 256 elements).
-    Instead we use multi-level tables. The first level table
-    is using 9-bit length index; some entries in this table are 'terminal',
-    some reference the next level table(s).
-
-    For example, bytes with values 48 and 49 (ASCII codes for '0' and '1')
-    both have code length 5, Huffman codes are: 00000 and 00001. They
-    both are placed in the 'root' table,
-    the 'root' table has index length == 9:
-    [00000 | 4 remaining bits]
-     ...
-    [00001 | 4 remaining bits]
-
-    All entires with indices between these two will 'point' to value 48
-    with bitLength == 5 so that bit stream (for example) 000001010 will be
-    decoded as: 48 + "put 1010 back into bitstream".
-
-    A good description can be found here:
-    http://commandlinefanatic.com/cgi-bin/showarticle.cgi?article=art007
-    or just google "Efficient Huffman Decoding".
-    Also see comments below about 'filling holes'.
+    Decoding is done by a finite state machine, consuming four bits at
+    a time. Every state corresponds to an internal node of the code tree,
+    that is to a (proper) prefix of some code; as the tree has 257 leaves
+    (256 byte values + EOS), there are exactly 256 states, the root being
+    state 0. For every state and every 4-bit input we precompute the state
+    we end up in, the symbol decoded on the way (the shortest code is 5 bits
+    long, so a nibble completes at most one code), and whether the input
+    seen so far can legally end there (HPACK, 5.2: remaining bits must be a
+    prefix of EOS, strictly shorter than 8 bits). Decoding a byte thus takes
+    two table lookups instead of a lookup (or several) per symbol.
 */
 
 namespace
@@ -352,29 +337,6 @@ const CodeEntry staticHuffmanCodeTable[]
     {256, 0xfffffffcul, 30}   // EOS 11111111|11111111|11111111|111111
 };
 
-void write_huffman_code(BitOStream &outputStream, const CodeEntry &code)
-{
-    // Append octet by octet.
-    auto bitLength = code.bitLength;
-    const auto hc = code.huffmanCode >> (32 - bitLength);
-
-    if (bitLength > 24) {
-        outputStream.writeBits(uchar(hc >> 24), bitLength - 24);
-        bitLength = 24;
-    }
-
-    if (bitLength > 16) {
-        outputStream.writeBits(uchar(hc >> 16), bitLength - 16);
-        bitLength = 16;
-    }
-
-    if (bitLength > 8) {
-        outputStream.writeBits(uchar(hc >> 8), bitLength - 8);
-        bitLength = 8;
-    }
-
-    outputStream.writeBits(uchar(hc), bitLength);
-}
 
 }
 
@@ -385,181 +347,144 @@ quint64 huffman_encoded_bit_length(const QByteArray &inputData)
 {
     quint64 bitLength = 0;
     for (int i = 0, e = inputData.size(); i < e; ++i)
-        bitLength += staticHuffmanCodeTable[int(inputData[i])].bitLength;
+        bitLength += staticHuffmanCodeTable[uchar(inputData[i])].bitLength;
 
     return bitLength;
 }
 
 void huffman_encode_string(const QByteArray &inputData, BitOStream &outputStream)
 {
-    for (int i = 0, e = inputData.size(); i < e; ++i)
-        write_huffman_code(outputStream, staticHuffmanCodeTable[int(inputData[i])]);
-
-    // Pad bits ...
-    if (outputStream.bitLength() % 8)
-        outputStream.writeBits(0xff, 8 - outputStream.bitLength() % 8);
-}
+    // Codes are collected in a 64-bit accumulator and written out
+    // as whole octets. The longest code is 30 bits, so there are
+    // never more than 7 + 30 pending bits.
+    quint64 pending = 0;
+    quint32 nPending = 0;
+    for (int i = 0, e = inputData.size(); i < e; ++i) {
+        const CodeEntry &code = staticHuffmanCodeTable[uchar(inputData[i])];
+        pending = pending << code.bitLength | code.huffmanCode >> (32 - code.bitLength);
+        nPending += code.bitLength;
+        while (nPending >= 8) {
+            nPending -= 8;
+            outputStream.writeBits(uchar(pending >> nPending), 8);
+        }
+    }
 
-bool padding_is_valid(quint32 chunk, quint32 nBits)
-{
-    Q_ASSERT(nBits);
-
-    // HPACK, 5.2: "A padding strictly longer than 7 bits MUST be
-    // treated as a decoding error."
-    if (nBits > 7)
-        return false;
-    // HPACK, 5.2:
-    // "A padding not corresponding to the most significant bits
-    // of the code for the EOS symbol MUST be treated as a decoding error."
-    return (chunk >> (32 - nBits)) == quint32((1 << nBits) - 1);
+    // Pad bits (the most significant bits of EOS, all set) ...
+    if (nPending)
+        outputStream.writeBits(uchar(pending << (8 - nPending) | 0xff >> nPending), 8);
 }
 
 HuffmanDecoder::HuffmanDecoder()
-    : minCodeLength()
 {
-    const auto nCodes = sizeof staticHuffmanCodeTable / sizeof staticHuffmanCodeTable[0];
-
-    std::vector<CodeEntry> symbols(staticHuffmanCodeTable, staticHuffmanCodeTable + nCodes);
-    // Now we sort: by bit length first (in the descending order) and by the symbol
-    // value (descending). Descending order: to make sure we do not create prefix tables with
-    // short 'indexLength' first and having longer codes that do not fit into such tables later.
-    std::sort(symbols.begin(), symbols.end(), [](const CodeEntry &code1, const CodeEntry &code2) {
-        if (code1.bitLength == code2.bitLength)
-            return code1.byteValue > code2.byteValue;
-        return code1.bitLength > code2.bitLength;
-    });
-
-    minCodeLength = symbols.back().bitLength; // The shortest one, currently it's 5.
-
-    // TODO: add a verification - Huffman codes
-    // within a given bit length range also
-    // should be in descending order.
-
-    // Initialize 'prefixTables' and 'tableData'.
-    addTable(0, quint32(BitConstants::rootPrefix)); // 'root' table.
-
-    for (const auto &s : symbols) {
-        quint32 tableIndex = 0;
-        while (true) {
-            Q_ASSERT(tableIndex < prefixTables.size());
-            // Note, by value - since prefixTables will be updated in between.
-            const auto table = prefixTables[tableIndex];
-            // We skip prefixed bits (if any) and use indexed bits only:
-            const auto entryIndex = s.huffmanCode << table.prefixLength >> (32 - table.indexLength);
-            // Again, by value.
-            PrefixTableEntry entry = tableEntry(table, entryIndex);
-            // How many bits were coded by previous tables and this table:
-            const auto codedLength = table.prefixLength + table.indexLength;
-            if (codedLength < s.bitLength) {
-                // We have to add a new prefix table ... (if it's not done yet).
-                if (!entry.bitLength) {
-                    entry.nextTable = addTable(codedLength, std::min<quint32>(quint32(BitConstants::childPrefix),
-                                                                              s.bitLength - codedLength));
-                    entry.bitLength = s.bitLength;
-                    entry.byteValue = s.byteValue;
-                    setTableEntry(table, entryIndex, entry);
-                }
-                tableIndex = entry.nextTable;
-            } else {
-                // We found the slot for our code (terminal entry):
-                entry.byteValue = s.byteValue;
-                entry.bitLength = s.bitLength;
-                // Refer to our own table as 'nextTable':
-                entry.nextTable = tableIndex;
-                setTableEntry(table, entryIndex, entry);
-                break;
+    // Build the code tree first. Codes are left-aligned in 'huffmanCode'.
+    struct Node
+    {
+        int children[2] = {-1, -1};
+        int symbol = -1;  // -1 for internal nodes.
+        quint32 depth = 0;
+        bool allOnes = true; // The path from the root consists of 1s only.
+    };
+
+    std::vector<Node> tree(1);
+    for (const CodeEntry &code : staticHuffmanCodeTable) {
+        int node = 0;
+        for (quint32 i = 0; i < code.bitLength; ++i) {
+            const int bit = (code.huffmanCode >> (31 - i)) & 1;
+            if (tree[node].children[bit] == -1) {
+                Node child;
+                child.depth = tree[node].depth + 1;
+                child.allOnes = tree[node].allOnes && bit;
+                tree[node].children[bit] = int(tree.size());
+                tree.push_back(child);
             }
+            node = tree[node].children[bit];
         }
+        tree[node].symbol = int(code.byteValue);
     }
 
-    // Now, we have a table(s) and have to fill 'holes' to
-    // 'fix' terminal entries.
-    for (const auto &table : prefixTables) {
-        const quint32 codedLength = table.prefixLength + table.indexLength;
-        for (quint32 j = 0; j < table.size();) {
-            const PrefixTableEntry &entry = tableEntry(table, j);
-            if (entry.bitLength && entry.bitLength < codedLength) {
-                const quint32 range = 1 << (codedLength - entry.bitLength);
-                for (quint32 k = 1; k < range; ++k)
-                    setTableEntry(table, j + k, entry);
-                j += range;
-            } else {
-                ++j;
+    // Number internal nodes, the root is state 0:
+    std::vector<int> nodeToState(tree.size(), -1);
+    std::vector<int> stateToNode;
+    for (int i = 0, e = int(tree.size()); i < e; ++i) {
+        if (tree[i].symbol == -1) {
+            nodeToState[i] = int(stateToNode.size());
+            stateToNode.push_back(i);
+        }
+    }
+    Q_ASSERT(stateToNode.size() == nStates);
+
+    for (quint32 state = 0; state < nStates; ++state) {
+        for (quint32 nibble = 0; nibble < 16; ++nibble) {
+            Transition &transition = transitions[state][nibble];
+            int node = stateToNode[state];
+            for (int i = 3; i >= 0; --i) {
+                node = tree[node].children[(nibble >> i) & 1];
+                Q_ASSERT(node != -1); // The code is complete.
+                if (tree[node].symbol == -1)
+                    continue;
+
+                if (tree[node].symbol == 256) {
+                    // EOS (256) == compression error (HPACK).
+                    transition.flags = Fail;
+                    break;
+                }
+
+                Q_ASSERT(!(transition.flags & Emit));
+                transition.flags |= Emit;
+                transition.symbol = uchar(tree[node].symbol);
+                node = 0;
             }
+
+            if (transition.flags & Fail)
+                continue;
+
+            transition.nextState = uchar(nodeToState[node]);
+            // HPACK, 5.2: "A padding strictly longer than 7 bits MUST be
+            // treated as a decoding error." and "A padding not corresponding
+            // to the most significant bits of the code for the EOS symbol
+            // MUST be treated as a decoding error."
+            if (tree[node].allOnes && tree[node].depth < 8)
+                transition.flags |= Accept;
         }
     }
 }
 
 bool HuffmanDecoder::decodeStream(BitIStream &inputStream, QByteArray &outputBuffer)
 {
+    // Huffman-encoded strings always occupy whole octets:
+    Q_ASSERT(!(inputStream.streamOffset() % 8));
+
+    // Every symbol takes at least 5 bits:
+    const quint64 bitsLeft = inputStream.bitLength() - inputStream.streamOffset();
+    outputBuffer.reserve(outputBuffer.size() + int(bitsLeft / 5));
+
+    quint32 state = 0;
+    bool accept = true; // An empty string is fine.
     while (true) {
         quint32 chunk = 0;
-        const quint32 readBits = inputStream.peekBits(inputStream.streamOffset(), 32, &chunk);
+        const quint64 readBits = inputStream.peekBits(inputStream.streamOffset(), 32, &chunk);
         if (!readBits)
-            return !inputStream.hasMoreBits();
-
-        if (readBits < minCodeLength) {
-            inputStream.skipBits(readBits);
-            return padding_is_valid(chunk, readBits);
-        }
-
-        quint32 tableIndex = 0;
-        const PrefixTable *table = &prefixTables[tableIndex];
-        quint32 entryIndex = chunk >> (32 - table->indexLength);
-        PrefixTableEntry entry = tableEntry(*table, entryIndex);
-
-        while (true) {
-            if (entry.nextTable == tableIndex)
-                break;
-
-            tableIndex = entry.nextTable;
-            table = &prefixTables[tableIndex];
-            entryIndex = chunk << table->prefixLength >> (32 - table->indexLength);
-            entry = tableEntry(*table, entryIndex);
-        }
-
-        if (entry.bitLength > readBits) {
-            inputStream.skipBits(readBits);
-            return padding_is_valid(chunk, readBits);
-        }
-
-        if (!entry.bitLength || entry.byteValue == 256) {
-            //EOS (256) == compression error (HPACK).
-            inputStream.skipBits(readBits);
-            return false;
+            return accept;
+
+        for (quint64 i = 0; i < readBits; i += 4) {
+            const Transition &transition = transitions[state][chunk >> 28];
+            chunk <<= 4;
+            if (transition.flags & Fail) {
+                inputStream.skipBits(readBits);
+                return false;
+            }
+            if (transition.flags & Emit)
+                outputBuffer.append(char(transition.symbol));
+            state = transition.nextState;
+            accept = transition.flags & Accept;
         }
 
-        outputBuffer.append(entry.byteValue);
-        inputStream.skipBits(entry.bitLength);
+        inputStream.skipBits(readBits);
     }
 
     return false;
 }
 
-quint32 HuffmanDecoder::addTable(quint32 prefix, quint32 index)
-{
-    PrefixTable newTable{prefix, index};
-    newTable.offset = quint32(tableData.size());
-    prefixTables.push_back(newTable);
-    // Add entries for this table:
-    tableData.resize(tableData.size() + newTable.size());
-
-    return quint32(prefixTables.size() - 1);
-}
-
-PrefixTableEntry HuffmanDecoder::tableEntry(const PrefixTable &table, quint32 index)
-{
-    Q_ASSERT(index < table.size());
-    return tableData[table.offset + index];
-}
-
-void HuffmanDecoder::setTableEntry(const PrefixTable &table, quint32 index,
-                                   const PrefixTableEntry &entry)
-{
-    Q_ASSERT(index < table.size());
-    tableData[table.offset + index] = entry;
-}
-
 bool huffman_decode_string(BitIStream &inputStream, QByteArray *outputBuffer)
 {
     Q_ASSERT(outputBuffer);
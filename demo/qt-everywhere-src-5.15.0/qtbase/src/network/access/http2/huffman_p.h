@@ -72,91 +72,38 @@ class BitOStream;
 quint64 huffman_encoded_bit_length(const QByteArray &inputData);
 void huffman_encode_string(const QByteArray &inputData, BitOStream &outputStream);
 
-// PrefixTable:
-// Huffman codes with a small bit length
-// fit into a table (these are 'terminal' symbols),
-// codes with longer codes require additional
-// tables, so several symbols will have the same index
-// in a table - pointing into the next table.
-// Every table has an 'indexLength' - that's
-// how many bits can fit in table's indices +
-// 'prefixLength' - how many bits were addressed
-// by its 'parent' table(s).
-// All PrefixTables are kept in 'prefixTables' array.
-// PrefixTable itself does not have any entries,
-// it just holds table's prefix/index + 'offset' -
-// there table's data starts in an array of all
-// possible entries ('tableData').
-
-struct PrefixTable
-{
-    PrefixTable()
-        : prefixLength(),
-          indexLength(),
-          offset()
-    {
-    }
-
-    PrefixTable(quint32 prefix, quint32 index)
-        : prefixLength(prefix),
-          indexLength(index),
-          offset()
-    {
-    }
-
-    quint32 size()const
-    {
-        // Number of entries table contains:
-        return 1 << indexLength;
-    }
-
-    quint32 prefixLength;
-    quint32 indexLength;
-    quint32 offset;
-};
-
-// Table entry is either a terminal entry (thus probably the code found)
-// or points into another table ('nextTable' - index into
-// 'prefixTables' array). If it's a terminal, 'nextTable' index
-// refers to the same table.
-
-struct PrefixTableEntry
-{
-    PrefixTableEntry()
-        : bitLength(),
-          nextTable(),
-          byteValue()
-    {
-    }
-
-    quint32 bitLength;
-    quint32 nextTable;
-    quint32 byteValue;
-};
-
 class BitIStream;
 
+// HuffmanDecoder is a finite state machine consuming 4 bits per step,
+// see the comments in huffman.cpp.
+
 class HuffmanDecoder
 {
 public:
-    enum class BitConstants
-    {
-        rootPrefix = 9,
-        childPrefix = 6
-    };
-
     HuffmanDecoder();
 
     bool decodeStream(BitIStream &inputStream, QByteArray &outputBuffer);
 
 private:
-    quint32 addTable(quint32 prefixLength, quint32 indexLength);
-    PrefixTableEntry tableEntry(const PrefixTable &table, quint32 index);
-    void setTableEntry(const PrefixTable &table, quint32 index, const PrefixTableEntry &entry);
+    enum TransitionFlag : uchar
+    {
+        Emit = 0x1,   // 'symbol' was decoded.
+        Accept = 0x2, // The input can end after this transition.
+        Fail = 0x4    // EOS was found in the input.
+    };
+
+    struct Transition
+    {
+        uchar nextState = 0;
+        uchar flags = 0;
+        uchar symbol = 0;
+    };
+
+    // One state per internal node of the code tree, the
+    // tree has 257 leaves (256 byte values + EOS):
+    static const quint32 nStates = 256;
 
-    std::vector<PrefixTable> prefixTables;
-    std::vector<PrefixTableEntry> tableData;
-    quint32 minCodeLength;
+    Transition transitions[nStates][16];
 };
 
 bool huffman_decode_string(BitIStream &inputStream, QByteArray *outputBuffer);
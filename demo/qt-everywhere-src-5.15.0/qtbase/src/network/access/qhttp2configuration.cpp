@@ -77,8 +77,14 @@ QT_BEGIN_NAMESPACE
       \li The server push. Allows to enable or disable server push. Sent
          as 'SETTINGS_ENABLE_PUSH' parameter in the initial 'SETTINGS'
          frame.
+      \li The maximum number of concurrent streams QNetworkAccessManager
+         opens on one connection, in addition to the limit the remote
+         peer sets with 'SETTINGS_MAX_CONCURRENT_STREAMS'.
     \endlist
 
+    Connections can also be shared by all QNetworkAccessManager instances
+    of the application, see setConnectionSharingEnabled().
+
     The QHttp2Configuration class also controls if the header compression
     algorithm (HPACK) is additionally using Huffman coding for string
     compression.
@@ -105,9 +111,13 @@ public:
 
     unsigned maxFrameSize = Http2::minPayloadLimit; // Initial (default) value of 16Kb.
 
+    // 0 means no limit besides the one from the server's SETTINGS.
+    unsigned maxConcurrentStreams = 0;
+
     bool pushEnabled = false;
     // TODO: for now those two below are noop.
     bool huffmanCompressionEnabled = true;
+    bool connectionSharingEnabled = false;
 };
 
 /*!
@@ -120,6 +130,8 @@ public:
         \li Window size for connection-level flow control is 65535 octets
         \li Window size for stream-level flow control is 65535 octets
         \li Frame size is 16384 octets
+        \li The number of concurrent streams is only limited by the server
+        \li Connections are not shared between QNetworkAccessManager instances
     \endlist
 */
 QHttp2Configuration::QHttp2Configuration()
@@ -286,6 +298,70 @@ unsigned QHttp2Configuration::maxFrameSize() const
     return d->maxFrameSize;
 }
 
+/*!
+    \since 5.16
+
+    Limits the number of streams that QNetworkAccessManager opens
+    concurrently on one connection to \a count. Further requests wait until
+    a stream is closed. The remote peer's 'SETTINGS_MAX_CONCURRENT_STREAMS'
+    always applies as well. A \a count of 0 removes the limit.
+
+    With connection sharing enabled, this is the limit per origin for the
+    whole application.
+
+    \sa maxConcurrentStreams(), setConnectionSharingEnabled()
+*/
+void QHttp2Configuration::setMaxConcurrentStreams(unsigned count)
+{
+    d->maxConcurrentStreams = count;
+}
+
+/*!
+    \since 5.16
+
+    Returns the maximum number of concurrent streams on one connection, or 0
+    if only the remote peer limits it. The default value is 0.
+*/
+unsigned QHttp2Configuration::maxConcurrentStreams() const
+{
+    return d->maxConcurrentStreams;
+}
+
+/*!
+    \since 5.16
+
+    If \a enable is \c true, the requests are sent over HTTP/2 connections
+    that all QNetworkAccessManager instances of the application share, so
+    that requests from managers living in different threads are multiplexed
+    over one connection per origin instead of each manager opening its own.
+
+    Requests only share a connection if they agree on the proxy, the peer
+    verify name and the local certificate, private key, protocol and peer
+    verification mode of the SSL configuration. The HTTP/2 parameters of the
+    request that opened a connection are used for all streams on it.
+
+    Synchronous requests never share connections.
+
+    \sa connectionSharingEnabled()
+*/
+void QHttp2Configuration::setConnectionSharingEnabled(bool enable)
+{
+    d->connectionSharingEnabled = enable;
+}
+
+/*!
+    \since 5.16
+
+    Returns \c true if HTTP/2 connections are shared between all
+    QNetworkAccessManager instances. The default value is \c false.
+
+    \sa setConnectionSharingEnabled()
+*/
+bool QHttp2Configuration::connectionSharingEnabled() const
+{
+    return d->connectionSharingEnabled;
+}
+
 /*!
     Swaps this configuration with the \a other configuration.
 */
@@ -306,7 +382,9 @@ bool operator==(const QHttp2Configuration &lhs, const QHttp2Configuration &rhs)
     return lhs.d->pushEnabled == rhs.d->pushEnabled
            && lhs.d->huffmanCompressionEnabled == rhs.d->huffmanCompressionEnabled
            && lhs.d->sessionWindowSize == rhs.d->sessionWindowSize
-           && lhs.d->streamWindowSize == rhs.d->streamWindowSize;
+           && lhs.d->streamWindowSize == rhs.d->streamWindowSize
+           && lhs.d->maxConcurrentStreams == rhs.d->maxConcurrentStreams
+           && lhs.d->connectionSharingEnabled == rhs.d->connectionSharingEnabled;
 }
 
 QT_END_NAMESPACE
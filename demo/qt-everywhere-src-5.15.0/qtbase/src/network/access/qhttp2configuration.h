@@ -79,6 +79,12 @@ public:
     bool setMaxFrameSize(unsigned size);
     unsigned maxFrameSize() const;
 
+    void setMaxConcurrentStreams(unsigned count);
+    unsigned maxConcurrentStreams() const;
+
+    void setConnectionSharingEnabled(bool enable);
+    bool connectionSharingEnabled() const;
+
     void swap(QHttp2Configuration &other) noexcept;
 
 private:
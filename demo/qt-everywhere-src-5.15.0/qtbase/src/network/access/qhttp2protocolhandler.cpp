@@ -181,6 +181,7 @@ QHttp2ProtocolHandler::QHttp2ProtocolHandler(QHttpNetworkConnectionChannel *chan
     maxSessionReceiveWindowSize = h2Config.sessionReceiveWindowSize();
     pushPromiseEnabled = h2Config.serverPushEnabled();
     streamInitialReceiveWindowSize = h2Config.streamReceiveWindowSize();
+    maxLocalConcurrentStreams = h2Config.maxConcurrentStreams();
     encoder.setCompressStrings(h2Config.huffmanCompressionEnabled());
 
     if (!channel->ssl && m_connection->connectionType() != QHttpNetworkConnection::ConnectionTypeHTTP2Direct) {
@@ -387,8 +388,13 @@ bool QHttp2ProtocolHandler::sendRequest()
         initReplyFromPushPromise(message, key);
     }
 
-    const auto streamsToUse = std::min<quint32>(maxConcurrentStreams - activeStreams.size(),
-                                                requests.size());
+    quint32 streamLimit = maxConcurrentStreams;
+    if (maxLocalConcurrentStreams)
+        streamLimit = std::min(streamLimit, maxLocalConcurrentStreams);
+    const quint32 activeStreamCount = activeStreams.size();
+    const auto streamsToUse = activeStreamCount < streamLimit
+                              ? std::min<quint32>(streamLimit - activeStreamCount, requests.size())
+                              : 0;
     auto it = requests.begin();
     for (quint32 i = 0; i < streamsToUse; ++i) {
         const qint32 newStreamID = createNewStream(*it);
@@ -401,6 +407,7 @@ bool QHttp2ProtocolHandler::sendRequest()
         it = requests.erase(it);
 
         Stream &newStream = activeStreams[newStreamID];
+        m_channel->recordRequestStart(newStream.reply());
         if (!sendHEADERS(newStream)) {
             finishStreamWithError(newStream, QNetworkReply::UnknownNetworkError,
                                   QLatin1String("failed to send HEADERS frame(s)"));
@@ -1176,6 +1183,9 @@ void QHttp2ProtocolHandler::updateStream(Stream &stream, const HPack::HttpHeader
             stream.data()->reset();
     }
 
+    if (httpReplyPrivate->timings.responseStart < 0)
+        httpReplyPrivate->timings.responseStart = QHttpNetworkTimings::timestamp();
+
     if (connectionType == Qt::DirectConnection)
         emit httpReply->headerChanged();
     else
@@ -1192,19 +1202,22 @@ void QHttp2ProtocolHandler::updateStream(Stream &stream, const Frame &frame,
     if (!httpReply) {
         Q_ASSERT(promisedData.contains(stream.key));
         PushPromise &promise = promisedData[stream.key];
-        // TODO: refactor this to use std::move.
+        // Cheap: the DATA payload is implicitly shared, only the header
+        // is copied.
         promise.dataFrames.push_back(frame);
         return;
     }
 
     if (const auto length = frame.dataSize()) {
-        const char *data = reinterpret_cast<const char *>(frame.dataBegin());
         auto &httpRequest = stream.request();
         auto replyPrivate = httpReply->d_func();
 
         replyPrivate->totalProgress += length;
 
-        const QByteArray wrapped(data, length);
+        // Shares the payload FrameReader has read from the socket, so the
+        // body reaches the reply (and, via readAny(), QNetworkReply's buffer)
+        // without being copied again:
+        const QByteArray wrapped(frame.dataPayload());
         if (httpRequest.d->autoDecompress && replyPrivate->isCompressed()) {
             QByteDataBuffer inDataBuffer;
             inDataBuffer.append(wrapped);
@@ -185,6 +185,8 @@ private:
     // This is how many concurrent streams our peer allows us, 100 is the
     // initial value, can be updated by the server's SETTINGS frame(s):
     quint32 maxConcurrentStreams = Http2::maxConcurrentStreams;
+    // Our own limit from QHttp2Configuration, 0 if there is none:
+    quint32 maxLocalConcurrentStreams = 0;
     // While we allow sending SETTTINGS_MAX_CONCURRENT_STREAMS to limit our peer,
     // it's just a hint and we do not actually enforce it (and we can continue
     // sending requests and creating streams while maxConcurrentStreams allows).
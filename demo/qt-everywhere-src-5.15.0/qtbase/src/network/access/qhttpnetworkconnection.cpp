@@ -624,6 +624,7 @@ QHttpNetworkReply* QHttpNetworkConnectionPrivate::queueRequest(const QHttpNetwor
     reply->setRequest(request);
     reply->d_func()->connection = q;
     reply->d_func()->connectionChannel = &channels[0]; // will have the correct one set later
+    reply->d_func()->timings.requestQueued = QHttpNetworkTimings::timestamp();
     HttpMessagePair pair = qMakePair(request, reply);
 
     if (request.isPreConnect())
@@ -1184,6 +1185,8 @@ void QHttpNetworkConnectionPrivate::startHostInfoLookup()
     } else {
         int hostLookupId;
         bool immediateResultValid = false;
+        hostLookupStartTime = QHttpNetworkTimings::timestamp();
+        hostLookupEndTime = -1;
         QHostInfo hostInfo = qt_qhostinfo_lookup(lookupHost,
                                                  this->q_func(),
                                                  SLOT(_q_hostLookupFinished(QHostInfo)),
@@ -1203,6 +1206,7 @@ void QHttpNetworkConnectionPrivate::_q_hostLookupFinished(const QHostInfo &info)
     bool foundAddress = false;
     if (networkLayerState == IPv4 || networkLayerState == IPv6 || networkLayerState == IPv4or6)
         return;
+    hostLookupEndTime = QHttpNetworkTimings::timestamp();
 
     const auto addresses = info.addresses();
     for (const QHostAddress &address : addresses) {
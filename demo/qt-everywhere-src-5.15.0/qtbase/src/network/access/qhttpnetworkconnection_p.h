@@ -258,6 +258,9 @@ public:
     quint16 port;
     bool encrypt;
     bool delayIpv4;
+    // see QHttpNetworkTimings
+    qint64 hostLookupStartTime = -1;
+    qint64 hostLookupEndTime = -1;
 
     // Number of channels we are trying to use at the moment:
     int activeChannelCount;
@@ -340,6 +340,10 @@ bool QHttpNetworkConnectionChannel::ensureConnection()
         // connect to the host if not already connected.
         state = QHttpNetworkConnectionChannel::ConnectingState;
         pendingEncrypt = ssl;
+        connectStartTime = QHttpNetworkTimings::timestamp();
+        connectEndTime = -1;
+        secureConnectEndTime = -1;
+        requestCount = 0;
 
         // reset state
         pipeliningSupported = PipeliningSupportUnknown;
@@ -756,6 +760,7 @@ void QHttpNetworkConnectionChannel::pipelineInto(HttpMessagePair &pair)
     reply->d_func()->connectionChannel = this;
     reply->d_func()->autoDecompress = request.d->autoDecompress;
     reply->d_func()->pipeliningUsed = true;
+    recordRequestStart(reply);
 
 #ifndef QT_NO_NETWORKPROXY
     pipeline.append(QHttpNetworkRequestPrivate::header(request,
@@ -769,6 +774,29 @@ void QHttpNetworkConnectionChannel::pipelineInto(HttpMessagePair &pair)
     // pipelineFlush() needs to be called at some point afterwards
 }
 
+/*
+    Fills in the connection phases of \a reply's timings when its request is
+    about to be written to the socket.
+*/
+void QHttpNetworkConnectionChannel::recordRequestStart(QHttpNetworkReply *reply)
+{
+    if (!reply)
+        return;
+    QHttpNetworkTimings &timings = reply->d_func()->timings;
+    if (connection) {
+        timings.hostLookupStart = connection->d_func()->hostLookupStartTime;
+        timings.hostLookupEnd = connection->d_func()->hostLookupEndTime;
+    }
+    timings.connectStart = connectStartTime;
+    timings.connectEnd = connectEndTime;
+    timings.secureConnectEnd = secureConnectEndTime;
+    timings.connectionReused = requestCount > 0;
+    timings.connectionRequestCount = ++requestCount;
+    timings.requestStart = QHttpNetworkTimings::timestamp();
+    // a resent request gets a new response
+    timings.responseStart = -1;
+}
+
 void QHttpNetworkConnectionChannel::pipelineFlush()
 {
     if (pipeline.isEmpty())
@@ -894,6 +922,7 @@ void QHttpNetworkConnectionChannel::_q_connected()
         }
         //The connections networkLayerState had already been decided.
     }
+    connectEndTime = QHttpNetworkTimings::timestamp();
 
     // improve performance since we get the request sent by the kernel ASAP
     //socket->setSocketOption(QAbstractSocket::LowDelayOption, 1);
@@ -1188,6 +1217,7 @@ void QHttpNetworkConnectionChannel::_q_encrypted()
 {
     QSslSocket *sslSocket = qobject_cast<QSslSocket *>(socket);
     Q_ASSERT(sslSocket);
+    secureConnectEndTime = QHttpNetworkTimings::timestamp();
 
     if (!protocolHandler && connection->connectionType() != QHttpNetworkConnection::ConnectionTypeHTTP2Direct) {
         // ConnectionTypeHTTP2Direct does not rely on ALPN/NPN to negotiate HTTP/2,
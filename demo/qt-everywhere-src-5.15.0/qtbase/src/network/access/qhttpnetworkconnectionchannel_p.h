@@ -128,6 +128,11 @@ public:
     // outside of QT_NO_SSL section. Sorted by priority:
     QMultiMap<int, HttpMessagePair> spdyRequestsToSend;
     bool switchedToHttp2 = false;
+    // timing of the current connection, see QHttpNetworkTimings
+    qint64 connectStartTime = -1;
+    qint64 connectEndTime = -1;
+    qint64 secureConnectEndTime = -1;
+    int requestCount = 0;
 #ifndef QT_NO_SSL
     bool ignoreAllSslErrors;
     QList<QSslError> ignoreSslErrorsList;
@@ -154,6 +159,7 @@ public:
     QByteArray pipeline; // temporary buffer that gets sent to socket in pipelineFlush
     void pipelineInto(HttpMessagePair &pair);
     void pipelineFlush();
+    void recordRequestStart(QHttpNetworkReply *reply);
     void requeueCurrentlyPipelinedRequests();
     void detectPipeliningSupport();
 
@@ -302,6 +302,11 @@ void QHttpNetworkReply::setSpdyWasUsed(bool spdy)
     d_func()->spdyUsed = spdy;
 }
 
+QHttpNetworkTimings QHttpNetworkReply::timings() const
+{
+    return d_func()->timings;
+}
+
 qint64 QHttpNetworkReply::removedContentLength() const
 {
     return d_func()->removedContentLength;
@@ -459,6 +464,9 @@ QAuthenticatorPrivate::Method QHttpNetworkReplyPrivate::authenticationMethod(boo
 
 qint64 QHttpNetworkReplyPrivate::readStatus(QAbstractSocket *socket)
 {
+    if (timings.responseStart < 0)
+        timings.responseStart = QHttpNetworkTimings::timestamp();
+
     if (fragment.isEmpty()) {
         // reserve bytes for the status line. This is better than always append() which reallocs the byte array
         fragment.reserve(32);
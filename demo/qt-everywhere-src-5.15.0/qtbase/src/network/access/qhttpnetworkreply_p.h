@@ -67,6 +67,7 @@ struct z_stream_s;
 #include <QtNetwork/qnetworkrequest.h>
 #include <QtNetwork/qnetworkreply.h>
 #include <qbuffer.h>
+#include <qdeadlinetimer.h>
 
 #include <private/qobject_p.h>
 #include <private/qhttpnetworkheader_p.h>
@@ -84,6 +85,29 @@ class QHttpNetworkConnectionChannel;
 class QHttpNetworkRequest;
 class QHttpNetworkConnectionPrivate;
 class QHttpNetworkReplyPrivate;
+
+// Timestamps of the phases of a request, in nanoseconds on the monotonic
+// clock QElapsedTimer and QDeadlineTimer use; -1 for phases that didn't happen.
+// The host lookup and connect phases are those of the connection the request
+// was sent on, and so precede requestQueued if the connection was reused.
+struct QHttpNetworkTimings
+{
+    qint64 requestQueued = -1;
+    qint64 hostLookupStart = -1;
+    qint64 hostLookupEnd = -1;
+    qint64 connectStart = -1;
+    qint64 connectEnd = -1;
+    qint64 secureConnectEnd = -1;
+    qint64 requestStart = -1;
+    qint64 responseStart = -1;
+    qint64 responseEnd = -1;
+    int connectionRequestCount = 0; // requests sent on the connection so far, this one included
+    bool connectionReused = false;
+
+    static qint64 timestamp() { return QDeadlineTimer::current().deadlineNSecs(); }
+};
+Q_DECLARE_TYPEINFO(QHttpNetworkTimings, Q_PRIMITIVE_TYPE);
+
 class Q_AUTOTEST_EXPORT QHttpNetworkReply : public QObject, public QHttpNetworkHeader
 {
     Q_OBJECT
@@ -141,6 +165,7 @@ public:
     bool isPipeliningUsed() const;
     bool isSpdyUsed() const;
     void setSpdyWasUsed(bool spdy);
+    QHttpNetworkTimings timings() const;
     qint64 removedContentLength() const;
 
     bool isRedirecting() const;
@@ -272,6 +297,7 @@ public:
     bool pipeliningUsed;
     bool spdyUsed;
     bool downstreamLimited;
+    QHttpNetworkTimings timings;
 
     char* userProvidedDownloadBuffer;
     QUrl redirectUrl;
@@ -288,4 +314,6 @@ public:
 
 QT_END_NAMESPACE
 
+Q_DECLARE_METATYPE(QHttpNetworkTimings)
+
 #endif // QHTTPNETWORKREPLY_H
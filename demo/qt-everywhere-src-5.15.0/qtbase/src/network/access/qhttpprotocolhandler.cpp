@@ -318,6 +318,7 @@ bool QHttpProtocolHandler::sendRequest()
 #else
         QByteArray header = QHttpNetworkRequestPrivate::header(m_channel->request, false);
 #endif
+        m_channel->recordRequestStart(m_reply);
         m_socket->write(header);
         // flushing is dangerous (QSslSocket calls transmit which might read or error)
 //        m_socket->flush();
@@ -45,6 +45,9 @@
 #include <QAuthenticator>
 #include <QEventLoop>
 #include <QCryptographicHash>
+#ifndef QT_NO_SSL
+#include <QSslKey>
+#endif
 
 #include "private/qhttpnetworkreply_p.h"
 #include "private/qnetworkaccesscache_p.h"
@@ -176,6 +179,26 @@ static QByteArray makeCacheKey(QUrl &url, QNetworkProxy *proxy, const QString &p
     return "http-connection:" + std::move(result).toLatin1();
 }
 
+#ifndef QT_NO_SSL
+// Connections shared by several managers must not send one manager's
+// requests with another one's client certificate, the configurations
+// have to agree on what identifies the client and verifies the server.
+static QByteArray makeSharedConnectionKey(const QSslConfiguration &configuration)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(configuration.localCertificate().toDer());
+    hash.addData(configuration.privateKey().toDer());
+    const int values[] = {
+        int(configuration.protocol()),
+        int(configuration.peerVerifyMode()),
+        configuration.peerVerifyDepth(),
+        configuration.caCertificates().size()
+    };
+    hash.addData(reinterpret_cast<const char *>(values), sizeof(values));
+    return hash.result().toHex();
+}
+#endif
+
 class QNetworkAccessCachedHttpConnection: public QHttpNetworkConnection,
                                       public QNetworkAccessCache::CacheableObject
 {
@@ -340,6 +363,14 @@ void QHttpThreadDelegate::startRequest()
 #endif
         cacheKey = makeCacheKey(urlCopy, nullptr, httpRequest.peerVerifyName());
 
+    if (isH2 && http2Parameters.connectionSharingEnabled()) {
+        cacheKey += ":shared";
+#ifndef QT_NO_SSL
+        if (ssl)
+            cacheKey += ':' + makeSharedConnectionKey(*incomingSslConfiguration);
+#endif
+    }
+
     // the http object is actually a QHttpNetworkConnection
     httpConnection = static_cast<QNetworkAccessCachedHttpConnection *>(connections.localData()->requestEntryNow(cacheKey));
     if (!httpConnection) {
@@ -547,6 +578,8 @@ void QHttpThreadDelegate::finishedSlot()
     if (httpRequest.isFollowRedirects() && httpReply->isRedirecting())
         emit redirected(httpReply->redirectUrl(), httpReply->statusCode(), httpReply->request().redirectCount() - 1);
 
+    updateTimings(true);
+    emit timingsChanged(incomingTimings);
     emit downloadFinished();
 
     QMetaObject::invokeMethod(httpReply, "deleteLater", Qt::QueuedConnection);
@@ -571,6 +604,7 @@ void QHttpThreadDelegate::synchronousFinishedSlot()
     }
 
     synchronousDownloadData = httpReply->readAll();
+    updateTimings(true);
 
     QMetaObject::invokeMethod(httpReply, "deleteLater", Qt::QueuedConnection);
     QMetaObject::invokeMethod(synchronousRequestLoop, "quit", Qt::QueuedConnection);
@@ -590,6 +624,8 @@ void QHttpThreadDelegate::finishedWithErrorSlot(QNetworkReply::NetworkError erro
     if (ssl)
         emit sslConfigurationChanged(httpReply->sslConfiguration());
 #endif
+    updateTimings(true);
+    emit timingsChanged(incomingTimings);
     emit error(errorCode,detail);
     emit downloadFinished();
 
@@ -612,6 +648,7 @@ void QHttpThreadDelegate::synchronousFinishedWithErrorSlot(QNetworkReply::Networ
     incomingErrorDetail = detail;
 
     synchronousDownloadData = httpReply->readAll();
+    updateTimings(true);
 
     QMetaObject::invokeMethod(httpReply, "deleteLater", Qt::QueuedConnection);
     QMetaObject::invokeMethod(synchronousRequestLoop, "quit", Qt::QueuedConnection);
@@ -659,6 +696,8 @@ void QHttpThreadDelegate::headerChangedSlot()
     incomingContentLength = httpReply->contentLength();
     removedContentLength = httpReply->removedContentLength();
     isSpdyUsed = httpReply->isSpdyUsed();
+    updateTimings(false);
+    emit timingsChanged(incomingTimings);
 
     emit downloadMetaData(incomingHeaders,
                           incomingStatusCode,
@@ -685,6 +724,14 @@ void QHttpThreadDelegate::synchronousHeaderChangedSlot()
     isPipeliningUsed = httpReply->isPipeliningUsed();
     isSpdyUsed = httpReply->isSpdyUsed();
     incomingContentLength = httpReply->contentLength();
+    updateTimings(false);
+}
+
+void QHttpThreadDelegate::updateTimings(bool finished)
+{
+    incomingTimings = httpReply->timings();
+    if (finished)
+        incomingTimings.responseEnd = QHttpNetworkTimings::timestamp();
 }
 
 
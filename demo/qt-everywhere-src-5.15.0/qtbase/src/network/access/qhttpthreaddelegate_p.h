@@ -117,12 +117,15 @@ public:
     qint64 removedContentLength;
     QNetworkReply::NetworkError incomingErrorCode;
     QString incomingErrorDetail;
+    QHttpNetworkTimings incomingTimings;
     QHttp2Configuration http2Parameters;
 #ifndef QT_NO_BEARERMANAGEMENT // ### Qt6: Remove section
     QSharedPointer<QNetworkSession> networkSession;
 #endif
 
 protected:
+    void updateTimings(bool finished);
+
     // The zerocopy download buffer, if used:
     QSharedPointer<char> downloadBuffer;
     // The QHttpNetworkConnection that is used
@@ -151,6 +154,7 @@ signals:
     void error(QNetworkReply::NetworkError, const QString &);
     void downloadFinished();
     void redirected(const QUrl &url, int httpStatus, int maxRedirectsRemainig);
+    void timingsChanged(const QHttpNetworkTimings &timings);
 
 public slots:
     // This are called via QueuedConnection from user thread
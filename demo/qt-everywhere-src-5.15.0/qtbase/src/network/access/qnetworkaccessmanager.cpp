@@ -470,6 +470,7 @@ QNetworkAccessManager::QNetworkAccessManager(QObject *parent)
     qRegisterMetaType<QList<QPair<QByteArray,QByteArray> > >();
 #if QT_CONFIG(http)
     qRegisterMetaType<QHttpNetworkRequest>();
+    qRegisterMetaType<QHttpNetworkTimings>();
 #endif
     qRegisterMetaType<QNetworkReply::NetworkError>();
     qRegisterMetaType<QSharedPointer<char> >();
@@ -1970,6 +1971,36 @@ QThread * QNetworkAccessManagerPrivate::createThread()
     return thread;
 }
 
+namespace {
+class QSharedHttp2Thread : public QThread
+{
+public:
+    QSharedHttp2Thread()
+    {
+        setObjectName(QStringLiteral("QNetworkAccessManager shared HTTP/2 thread"));
+        start();
+    }
+    ~QSharedHttp2Thread()
+    {
+        quit();
+        wait(QDeadlineTimer(5000));
+    }
+};
+}
+
+Q_GLOBAL_STATIC(QSharedHttp2Thread, sharedHttp2ThreadInstance)
+
+/*!
+    \internal
+
+    Returns the thread that runs the HTTP/2 connections all managers share,
+    see QHttp2Configuration::setConnectionSharingEnabled().
+*/
+QThread *QNetworkAccessManagerPrivate::sharedHttp2Thread()
+{
+    return sharedHttp2ThreadInstance();
+}
+
 void QNetworkAccessManagerPrivate::destroyThread()
 {
     if (thread) {
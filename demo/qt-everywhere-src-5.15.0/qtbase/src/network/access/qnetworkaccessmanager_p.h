@@ -119,6 +119,7 @@ public:
 
     QThread * createThread();
     void destroyThread();
+    static QThread *sharedHttp2Thread();
 
     void _q_replyFinished(QNetworkReply *reply);
     void _q_replyEncrypted(QNetworkReply *reply);
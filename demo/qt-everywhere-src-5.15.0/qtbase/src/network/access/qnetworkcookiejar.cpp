@@ -45,6 +45,8 @@
 #include "QtCore/qdatetime.h"
 #if QT_CONFIG(topleveldomain)
 #include "private/qtldurl_p.h"
+
+#include <algorithm>
 #else
 QT_BEGIN_NAMESPACE
 static bool qIsEffectiveTLD(QString domain)
@@ -128,7 +130,7 @@ QNetworkCookieJar::~QNetworkCookieJar()
 */
 QList<QNetworkCookie> QNetworkCookieJar::allCookies() const
 {
-    return d_func()->allCookies;
+    return d_func()->cookies();
 }
 
 /*!
@@ -143,7 +145,61 @@ QList<QNetworkCookie> QNetworkCookieJar::allCookies() const
 void QNetworkCookieJar::setAllCookies(const QList<QNetworkCookie> &cookieList)
 {
     Q_D(QNetworkCookieJar);
-    d->allCookies = cookieList;
+    d->setCookies(cookieList);
+}
+
+void QNetworkCookieJarPrivate::setCookies(const QList<QNetworkCookie> &cookieList)
+{
+    cookiesByDomain.clear();
+    nextSequence = 0;
+    for (const QNetworkCookie &cookie : cookieList)
+        cookiesByDomain[cookie.domain()].append({ nextSequence++, cookie });
+    allCookies = cookieList;
+    allCookiesDirty = false;
+}
+
+void QNetworkCookieJarPrivate::append(const QNetworkCookie &cookie)
+{
+    cookiesByDomain[cookie.domain()].append({ nextSequence++, cookie });
+    allCookiesDirty = true;
+}
+
+bool QNetworkCookieJarPrivate::remove(const QNetworkCookie &cookie)
+{
+    // cookies with the same identifier have the same domain
+    const auto bucket = cookiesByDomain.find(cookie.domain());
+    if (bucket == cookiesByDomain.end())
+        return false;
+    for (auto it = bucket->begin(), end = bucket->end(); it != end; ++it) {
+        if (it->cookie.hasSameIdentifier(cookie)) {
+            bucket->erase(it);
+            if (bucket->isEmpty())
+                cookiesByDomain.erase(bucket);
+            allCookiesDirty = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+const QList<QNetworkCookie> &QNetworkCookieJarPrivate::cookies() const
+{
+    if (allCookiesDirty) {
+        QVector<const Entry *> entries;
+        for (const QVector<Entry> &bucket : cookiesByDomain) {
+            for (const Entry &entry : bucket)
+                entries.append(&entry);
+        }
+        std::sort(entries.begin(), entries.end(), [](const Entry *lhs, const Entry *rhs) {
+            return lhs->sequence < rhs->sequence;
+        });
+        allCookies.clear();
+        allCookies.reserve(entries.size());
+        for (const Entry *entry : qAsConst(entries))
+            allCookies.append(entry->cookie);
+        allCookiesDirty = false;
+    }
+    return allCookies;
 }
 
 static inline bool isParentPath(const QString &path, const QString &reference)
@@ -233,50 +289,62 @@ QList<QNetworkCookie> QNetworkCookieJar::cookiesForUrl(const QUrl &url) const
 
     Q_D(const QNetworkCookieJar);
     const QDateTime now = QDateTime::currentDateTimeUtc();
-    QList<QNetworkCookie> result;
+    const QString host = url.host();
+    const QString path = url.path();
     bool isEncrypted = url.scheme() == QLatin1String("https");
 
-    // scan our cookies for something that matches
-    QList<QNetworkCookie>::ConstIterator it = d->allCookies.constBegin(),
-                                        end = d->allCookies.constEnd();
-    for ( ; it != end; ++it) {
-        if (!isParentDomain(url.host(), it->domain()))
-            continue;
-        if (!isParentPath(url.path(), it->path()))
-            continue;
-        if (!(*it).isSessionCookie() && (*it).expirationDate() < now)
-            continue;
-        if ((*it).isSecure() && !isEncrypted)
-            continue;
-
-        QString domain = it->domain();
-        if (domain.startsWith(QLatin1Char('.'))) /// Qt6?: remove when compliant with RFC6265
-            domain = domain.mid(1);
+    using Entry = QNetworkCookieJarPrivate::Entry;
+    QVector<const Entry *> matches;
+    const auto collect = [&](const QString &domain) {
+        const auto bucket = d->cookiesByDomain.constFind(domain);
+        if (bucket == d->cookiesByDomain.constEnd())
+            return;
+        for (const Entry &entry : *bucket) {
+            const QNetworkCookie &cookie = entry.cookie;
+            if (!isParentPath(path, cookie.path()))
+                continue;
+            if (!cookie.isSessionCookie() && cookie.expirationDate() < now)
+                continue;
+            if (cookie.isSecure() && !isEncrypted)
+                continue;
+
+            QString cookieDomain = cookie.domain();
+            if (cookieDomain.startsWith(QLatin1Char('.'))) /// Qt6?: remove when compliant with RFC6265
+                cookieDomain = cookieDomain.mid(1);
 #if QT_CONFIG(topleveldomain)
-        if (qIsEffectiveTLD(domain) && url.host() != domain)
-            continue;
+            if (qIsEffectiveTLD(cookieDomain) && host != cookieDomain)
+                continue;
 #else
-        if (!domain.contains(QLatin1Char('.')) && url.host() != domain)
-            continue;
+            if (!cookieDomain.contains(QLatin1Char('.')) && host != cookieDomain)
+                continue;
 #endif // topleveldomain
 
-        // insert this cookie into result, sorted by path
-        QList<QNetworkCookie>::Iterator insertIt = result.begin();
-        while (insertIt != result.end()) {
-            if (insertIt->path().length() < it->path().length()) {
-                // insert here
-                insertIt = result.insert(insertIt, *it);
-                break;
-            } else {
-                ++insertIt;
-            }
+            matches.append(&entry);
         }
-
-        // this is the shortest path yet, just append
-        if (insertIt == result.end())
-            result += *it;
+    };
+
+    // only cookies whose domain is a parent domain of the host can match:
+    // the host itself, the host with a leading dot, and every dotted suffix
+    collect(host);
+    collect(QLatin1Char('.') + host);
+    for (int dot = host.indexOf(QLatin1Char('.'), 1); dot != -1;
+         dot = host.indexOf(QLatin1Char('.'), dot + 1)) {
+        collect(host.mid(dot));
     }
 
+    // longer paths first, otherwise in insertion order
+    std::sort(matches.begin(), matches.end(), [](const Entry *lhs, const Entry *rhs) {
+        const int lhsLength = lhs->cookie.path().length();
+        const int rhsLength = rhs->cookie.path().length();
+        if (lhsLength != rhsLength)
+            return lhsLength > rhsLength;
+        return lhs->sequence < rhs->sequence;
+    });
+
+    QList<QNetworkCookie> result;
+    result.reserve(matches.size());
+    for (const Entry *entry : qAsConst(matches))
+        result.append(entry->cookie);
     return result;
 }
 
@@ -299,7 +367,7 @@ bool QNetworkCookieJar::insertCookie(const QNetworkCookie &cookie)
     deleteCookie(cookie);
 
     if (!isDeletion) {
-        d->allCookies += cookie;
+        d->append(cookie);
         return true;
     }
     return false;
@@ -333,14 +401,7 @@ bool QNetworkCookieJar::updateCookie(const QNetworkCookie &cookie)
 bool QNetworkCookieJar::deleteCookie(const QNetworkCookie &cookie)
 {
     Q_D(QNetworkCookieJar);
-    QList<QNetworkCookie>::Iterator it;
-    for (it = d->allCookies.begin(); it != d->allCookies.end(); ++it) {
-        if (it->hasSameIdentifier(cookie)) {
-            d->allCookies.erase(it);
-            return true;
-        }
-    }
-    return false;
+    return d->remove(cookie);
 }
 
 /*!
@@ -55,12 +55,30 @@
 #include "private/qobject_p.h"
 #include "qnetworkcookie.h"
 
+#include <QtCore/qhash.h>
+#include <QtCore/qvector.h>
+
 QT_BEGIN_NAMESPACE
 
 class QNetworkCookieJarPrivate: public QObjectPrivate
 {
 public:
-    QList<QNetworkCookie> allCookies;
+    struct Entry {
+        quint64 sequence; // insertion order, allCookies() is sorted by it
+        QNetworkCookie cookie;
+    };
+
+    void setCookies(const QList<QNetworkCookie> &cookieList);
+    void append(const QNetworkCookie &cookie);
+    bool remove(const QNetworkCookie &cookie);
+    const QList<QNetworkCookie> &cookies() const;
+
+    // keyed by QNetworkCookie::domain(), leading dot included
+    QHash<QString, QVector<Entry>> cookiesByDomain;
+    quint64 nextSequence = 0;
+
+    mutable QList<QNetworkCookie> allCookies;
+    mutable bool allCookiesDirty = false;
 
     Q_DECLARE_PUBLIC(QNetworkCookieJar)
 };
@@ -49,14 +49,22 @@
 #include <qdatastream.h>
 #include <qdatetime.h>
 #include <qdiriterator.h>
+#include <qsavefile.h>
 #include <qurl.h>
 #include <qcryptographichash.h>
 #include <qdebug.h>
+#include <qvector.h>
+#if QT_CONFIG(thread)
+#include <qthreadpool.h>
+#endif
+
+#include <algorithm>
 
 #define CACHE_POSTFIX QLatin1String(".d")
 #define PREPARED_SLASH QLatin1String("prepared/")
 #define CACHE_VERSION 8
 #define DATA_DIR QLatin1String("data")
+#define INDEX_FILE QLatin1String("index")
 
 #define MAX_COMPRESSION_SIZE (1024 * 1024 * 3)
 
@@ -80,6 +88,11 @@ QT_BEGIN_NAMESPACE
     QNetworkDiskCache by default limits the amount of space that the cache will
     use on the system to 50MB.
 
+    The size and the last access of each entry are kept in an index, which is
+    written to the cache directory when the cache is destroyed and read back
+    the next time the directory is used. Evicted files are removed from a
+    worker thread.
+
     Note you have to set the cache directory before it will work.
 
     A network disk cache can be enabled by:
@@ -113,6 +126,7 @@ QNetworkDiskCache::~QNetworkDiskCache()
 {
     Q_D(QNetworkDiskCache);
     qDeleteAll(d->inserting);
+    d->closeIndex();
 }
 
 /*!
@@ -142,6 +156,7 @@ void QNetworkDiskCache::setCacheDirectory(const QString &cacheDir)
     Q_D(QNetworkDiskCache);
     if (cacheDir.isEmpty())
         return;
+    d->closeIndex();
     d->cacheDirectory = cacheDir;
     QDir dir(d->cacheDirectory);
     d->cacheDirectory = dir.absolutePath();
@@ -269,13 +284,18 @@ void QNetworkDiskCachePrivate::storeItem(QCacheItem *cacheItem)
 
     QString fileName = cacheFileName(cacheItem->metaData.url());
     Q_ASSERT(!fileName.isEmpty());
+    const QString key = fileName.mid(dataDirectory.size());
 
+    loadIndex();
+    // an evicted file of the same name must not be removed after the rename
+    removals->cancel(fileName);
     if (QFile::exists(fileName)) {
         if (!QFile::remove(fileName)) {
             qWarning() << "QNetworkDiskCache: couldn't remove the cache file " << fileName;
             return;
         }
     }
+    takeIndexEntry(key);
 
     if (currentCacheSize > 0)
         currentCacheSize += 1024 + cacheItem->size();
@@ -294,10 +314,18 @@ void QNetworkDiskCachePrivate::storeItem(QCacheItem *cacheItem)
         && cacheItem->file->error() == QFile::NoError) {
         cacheItem->file->setAutoRemove(false);
         // ### use atomic rename rather then remove & rename
-        if (cacheItem->file->rename(fileName))
-            currentCacheSize += cacheItem->file->size();
-        else
+        if (cacheItem->file->rename(fileName)) {
+            const qint64 size = cacheItem->file->size();
+            const QDateTime expirationDate = cacheItem->metaData.expirationDate();
+            QCacheIndexEntry &entry = index[key];
+            entry.size = size;
+            entry.lastAccessed = ++accessCounter;
+            entry.expirationDate = expirationDate.isValid() ? expirationDate.toMSecsSinceEpoch() : 0;
+            indexedSize += size;
+            currentCacheSize += size;
+        } else {
             cacheItem->file->setAutoRemove(true);
+        }
     }
     if (cacheItem->metaData.url() == lastItem.metaData.url())
         lastItem.reset();
@@ -342,7 +370,10 @@ bool QNetworkDiskCachePrivate::removeFile(const QString &file)
     QString fileName = info.fileName();
     if (!fileName.endsWith(CACHE_POSTFIX))
         return false;
-    qint64 size = info.size();
+    loadIndex();
+    qint64 size = file.startsWith(dataDirectory) ? takeIndexEntry(file.mid(dataDirectory.size())) : -1;
+    if (size < 0)
+        size = info.size();
     if (QFile::remove(file)) {
         currentCacheSize -= size;
         return true;
@@ -361,7 +392,14 @@ QNetworkCacheMetaData QNetworkDiskCache::metaData(const QUrl &url)
     Q_D(QNetworkDiskCache);
     if (d->lastItem.metaData.url() == url)
         return d->lastItem.metaData;
-    return fileMetaData(d->cacheFileName(url));
+    if (!url.isValid())
+        return QNetworkCacheMetaData();
+    // entries missing from the index were evicted, no need to look at the disk
+    d->loadIndex();
+    const QString key = QNetworkDiskCachePrivate::uniqueFileName(url);
+    if (!d->index.contains(key))
+        return QNetworkCacheMetaData();
+    return fileMetaData(d->dataDirectory + key);
 }
 
 /*!
@@ -398,11 +436,16 @@ QIODevice *QNetworkDiskCache::data(const QUrl &url)
     QScopedPointer<QBuffer> buffer;
     if (!url.isValid())
         return nullptr;
+    d->loadIndex();
+    const QString key = QNetworkDiskCachePrivate::uniqueFileName(url);
+    const auto entry = d->index.find(key);
+    if (entry == d->index.end())
+        return nullptr;
     if (d->lastItem.metaData.url() == url && d->lastItem.data.isOpen()) {
         buffer.reset(new QBuffer);
         buffer->setData(d->lastItem.data.data());
     } else {
-        QScopedPointer<QFile> file(new QFile(d->cacheFileName(url)));
+        QScopedPointer<QFile> file(new QFile(d->dataDirectory + key));
         if (!file->open(QFile::ReadOnly | QIODevice::Unbuffered))
             return nullptr;
 
@@ -424,13 +467,15 @@ QIODevice *QNetworkDiskCache::data(const QUrl &url)
             p = file->map(file->pos(), size);
 #endif
             if (p) {
-                buffer->setData((const char *)p, size);
+                // the mapping lives as long as the file, which the buffer owns
+                buffer->setData(QByteArray::fromRawData(reinterpret_cast<const char *>(p), size));
                 file.take()->setParent(buffer.data());
             } else {
                 buffer->setData(file->readAll());
             }
         }
     }
+    entry->lastAccessed = ++d->accessCounter;
     buffer->open(QBuffer::ReadOnly);
     return buffer.take();
 }
@@ -500,9 +545,11 @@ void QNetworkDiskCache::setMaximumCacheSize(qint64 size)
     Returns the current size of the cache.
 
     When the current size of the cache is greater than the maximumCacheSize()
-    older cache files are removed until the total size is less then 90% of
-    maximumCacheSize() starting with the oldest ones first using the file
-    creation date to determine how old a cache file is.
+    cache entries are removed until the total size is less then 90% of
+    maximumCacheSize(), starting with the ones whose expiration date has
+    passed and then with the ones that were least recently used. The files
+    are removed from a worker thread; the entries are gone from the cache
+    when this function returns.
 
     Subclasses can reimplement this function to change the order that cache
     files are removed taking into account information in the application
@@ -526,54 +573,36 @@ qint64 QNetworkDiskCache::expire()
 
     // close file handle to prevent "in use" error when QFile::remove() is called
     d->lastItem.reset();
-
-    QDir::Filters filters = QDir::AllDirs | QDir:: Files | QDir::NoDotAndDotDot;
-    QDirIterator it(cacheDirectory(), filters, QDirIterator::Subdirectories);
-
-    QMultiMap<QDateTime, QString> cacheItems;
-    qint64 totalSize = 0;
-    while (it.hasNext()) {
-        QString path = it.next();
-        QFileInfo info = it.fileInfo();
-        QString fileName = info.fileName();
-        if (fileName.endsWith(CACHE_POSTFIX)) {
-            const QDateTime birthTime = info.fileTime(QFile::FileBirthTime);
-            cacheItems.insert(birthTime.isValid() ? birthTime
-                              : info.fileTime(QFile::FileMetadataChangeTime), path);
-            totalSize += info.size();
-        }
+    d->loadIndex();
+
+    qint64 totalSize = d->indexedSize;
+    const qint64 goal = (maximumCacheSize() * 9) / 10;
+    if (totalSize < goal)
+        return totalSize;
+
+    // expired entries sort first, then the least recently used ones
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    QVector<QPair<quint64, QString>> order;
+    order.reserve(d->index.size());
+    for (auto it = d->index.cbegin(), end = d->index.cend(); it != end; ++it) {
+        const bool expired = it->expirationDate > 0 && it->expirationDate < now;
+        order.append(qMakePair(expired ? 0 : it->lastAccessed, it.key()));
     }
+    std::sort(order.begin(), order.end());
 
-    int removedFiles = 0;
-    qint64 goal = (maximumCacheSize() * 9) / 10;
-    QMultiMap<QDateTime, QString>::const_iterator i = cacheItems.constBegin();
-    while (i != cacheItems.constEnd()) {
+    QStringList removedFiles;
+    for (const auto &item : qAsConst(order)) {
         if (totalSize < goal)
             break;
-        QString name = i.value();
-        QFile file(name);
-
-        if (name.contains(PREPARED_SLASH)) {
-            for (QCacheItem *item : qAsConst(d->inserting)) {
-                if (item && item->file && item->file->fileName() == name) {
-                    delete item->file;
-                    item->file = nullptr;
-                    break;
-                }
-            }
-        }
-
-        qint64 size = file.size();
-        file.remove();
-        totalSize -= size;
-        ++removedFiles;
-        ++i;
+        totalSize -= d->takeIndexEntry(item.second);
+        removedFiles.append(d->dataDirectory + item.second);
     }
+    d->removeInBackground(removedFiles);
 #if defined(QNETWORKDISKCACHE_DEBUG)
-    if (removedFiles > 0) {
+    if (!removedFiles.isEmpty()) {
         qDebug() << "QNetworkDiskCache::expire()"
-                << "Removed:" << removedFiles
-                << "Kept:" << cacheItems.count() - removedFiles;
+                << "Removed:" << removedFiles.count()
+                << "Kept:" << d->index.count();
     }
 #endif
     return totalSize;
@@ -592,6 +621,215 @@ void QNetworkDiskCache::clear()
     d->maximumCacheSize = 0;
     d->currentCacheSize = expire();
     d->maximumCacheSize = size;
+    // don't leave the files behind for the worker thread
+    d->removals->flush();
+}
+
+void QCacheFileRemovals::removeIfPending(const QString &fileName)
+{
+    QMutexLocker locker(&mutex);
+    if (pending.remove(fileName))
+        QFile::remove(fileName);
+}
+
+void QCacheFileRemovals::flush()
+{
+    QMutexLocker locker(&mutex);
+    for (const QString &fileName : qAsConst(pending))
+        QFile::remove(fileName);
+    pending.clear();
+}
+
+/*!
+    Removes \a fileNames from a worker thread, unless a new cache file of the
+    same name is stored first.
+ */
+void QNetworkDiskCachePrivate::removeInBackground(const QStringList &fileNames)
+{
+    if (fileNames.isEmpty())
+        return;
+#if QT_CONFIG(thread)
+    {
+        QMutexLocker locker(&removals->mutex);
+        for (const QString &fileName : fileNames)
+            removals->pending.insert(fileName);
+    }
+    // the worker keeps the removals alive should the cache be destroyed first
+    QSharedPointer<QCacheFileRemovals> pending = removals;
+    QThreadPool::globalInstance()->start([pending, fileNames]() {
+        for (const QString &fileName : fileNames)
+            pending->removeIfPending(fileName);
+    });
+#else
+    for (const QString &fileName : fileNames)
+        QFile::remove(fileName);
+#endif
+}
+
+enum
+{
+    IndexMagic = 0xe9
+};
+
+QString QNetworkDiskCachePrivate::indexFileName() const
+{
+    return dataDirectory + INDEX_FILE;
+}
+
+/*!
+    Reads the index saved by the previous cache using this directory, or
+    scans the directory if there is none.
+
+    The index file is removed once read and only written back by
+    closeIndex(), so a process that doesn't exit cleanly leads to a scan
+    rather than to an index that misses files.
+ */
+void QNetworkDiskCachePrivate::loadIndex()
+{
+    if (indexLoaded || cacheDirectory.isEmpty())
+        return;
+    indexLoaded = true;
+
+    bool ok = false;
+    QFile file(indexFileName());
+    if (file.open(QFile::ReadOnly)) {
+        ok = readIndex(&file);
+        file.close();
+        file.remove();
+    }
+    if (!ok)
+        rebuildIndex();
+#if defined(QNETWORKDISKCACHE_DEBUG)
+    qDebug() << "QNetworkDiskCache::loadIndex()" << (ok ? "read" : "scanned")
+             << index.count() << "entries," << indexedSize << "bytes";
+#endif
+}
+
+bool QNetworkDiskCachePrivate::readIndex(QFile *device)
+{
+    QDataStream in(device);
+
+    qint32 marker;
+    qint32 v;
+    qint32 streamVersion;
+    in >> marker >> v >> streamVersion;
+    if (marker != IndexMagic || v != CACHE_VERSION || streamVersion > in.version())
+        return false;
+    in.setVersion(streamVersion);
+
+    qint32 count;
+    in >> count;
+    while (count-- > 0 && in.status() == QDataStream::Ok) {
+        QString key;
+        QCacheIndexEntry entry;
+        in >> key >> entry.size >> entry.lastAccessed >> entry.expirationDate;
+        index.insert(key, entry);
+        indexedSize += entry.size;
+        accessCounter = qMax(accessCounter, entry.lastAccessed);
+    }
+    if (in.status() == QDataStream::Ok)
+        return true;
+
+    index.clear();
+    indexedSize = 0;
+    accessCounter = 0;
+    return false;
+}
+
+/*!
+    Builds the index from the files in the cache directory, ordering them by
+    their creation time. Cache files outside of the data directory, left from
+    older cache versions or interrupted insertions, are removed.
+ */
+void QNetworkDiskCachePrivate::rebuildIndex()
+{
+    struct ScannedFile {
+        QDateTime time;
+        QString key;
+        qint64 size;
+    };
+    QVector<ScannedFile> files;
+    QStringList staleFiles;
+
+    QDir::Filters filters = QDir::AllDirs | QDir:: Files | QDir::NoDotAndDotDot;
+    QDirIterator it(cacheDirectory, filters, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        const QString path = QDir::cleanPath(it.next());
+        QFileInfo info = it.fileInfo();
+        if (!info.fileName().endsWith(CACHE_POSTFIX))
+            continue;
+        if (path.startsWith(dataDirectory)) {
+            const QDateTime birthTime = info.fileTime(QFile::FileBirthTime);
+            files.append({ birthTime.isValid() ? birthTime
+                                               : info.fileTime(QFile::FileMetadataChangeTime),
+                           path.mid(dataDirectory.size()), info.size() });
+            continue;
+        }
+        const bool inserting = std::any_of(this->inserting.cbegin(), this->inserting.cend(),
+                                           [&path](const QCacheItem *item) {
+            return item && item->file && item->file->fileName() == path;
+        });
+        if (!inserting)
+            staleFiles.append(path);
+    }
+
+    std::sort(files.begin(), files.end(), [](const ScannedFile &lhs, const ScannedFile &rhs) {
+        return lhs.time < rhs.time;
+    });
+    index.reserve(files.size());
+    for (const ScannedFile &file : qAsConst(files)) {
+        QCacheIndexEntry &entry = index[file.key];
+        entry.size = file.size;
+        entry.lastAccessed = ++accessCounter;
+        indexedSize += file.size;
+    }
+    removeInBackground(staleFiles);
+}
+
+void QNetworkDiskCachePrivate::saveIndex() const
+{
+    if (!indexLoaded || cacheDirectory.isEmpty())
+        return;
+
+    QSaveFile file(indexFileName());
+    if (!file.open(QIODevice::WriteOnly))
+        return;
+    QDataStream out(&file);
+    out << qint32(IndexMagic);
+    out << qint32(CACHE_VERSION);
+    out << static_cast<qint32>(out.version());
+    out << qint32(index.size());
+    for (auto it = index.cbegin(), end = index.cend(); it != end; ++it)
+        out << it.key() << it->size << it->lastAccessed << it->expirationDate;
+    if (!file.commit())
+        qWarning() << "QNetworkDiskCache: couldn't write the cache index" << file.fileName();
+}
+
+/*!
+    Writes the index back to the cache directory and forgets it.
+ */
+void QNetworkDiskCachePrivate::closeIndex()
+{
+    saveIndex();
+    index.clear();
+    indexedSize = 0;
+    accessCounter = 0;
+    indexLoaded = false;
+}
+
+/*!
+    Removes the index entry for \a key and returns its size, or -1 if there
+    was none.
+ */
+qint64 QNetworkDiskCachePrivate::takeIndexEntry(const QString &key)
+{
+    const auto it = index.find(key);
+    if (it == index.end())
+        return -1;
+    const qint64 size = it->size;
+    indexedSize -= size;
+    index.erase(it);
+    return size;
 }
 
 /*!
@@ -56,6 +56,9 @@
 
 #include <qbuffer.h>
 #include <qhash.h>
+#include <qmutex.h>
+#include <qset.h>
+#include <qsharedpointer.h>
 #include <qtemporaryfile.h>
 
 QT_REQUIRE_CONFIG(networkdiskcache);
@@ -94,6 +97,31 @@ public:
     bool canCompress() const;
 };
 
+struct QCacheIndexEntry
+{
+    qint64 size = 0;
+    quint64 lastAccessed = 0;   // position in the least recently used order
+    qint64 expirationDate = 0;  // msecs since epoch, 0 if unknown
+};
+Q_DECLARE_TYPEINFO(QCacheIndexEntry, Q_PRIMITIVE_TYPE);
+
+// Cache files waiting to be removed by a worker thread. A file is only
+// removed while it is still pending, so that storing a new entry under the
+// same name can cancel the removal of the evicted one.
+struct QCacheFileRemovals
+{
+    QMutex mutex;
+    QSet<QString> pending;
+
+    bool cancel(const QString &fileName)
+    {
+        QMutexLocker locker(&mutex);
+        return pending.remove(fileName);
+    }
+    void removeIfPending(const QString &fileName);
+    void flush();
+};
+
 class QNetworkDiskCachePrivate : public QAbstractNetworkCachePrivate
 {
 public:
@@ -101,6 +129,7 @@ public:
         : QAbstractNetworkCachePrivate()
         , maximumCacheSize(1024 * 1024 * 50)
         , currentCacheSize(-1)
+        , removals(new QCacheFileRemovals)
         {}
 
     static QString uniqueFileName(const QUrl &url);
@@ -111,12 +140,28 @@ public:
     void prepareLayout();
     static quint32 crc32(const char *data, uint len);
 
+    QString indexFileName() const;
+    void loadIndex();
+    bool readIndex(QFile *device);
+    void rebuildIndex();
+    void saveIndex() const;
+    void closeIndex();
+    qint64 takeIndexEntry(const QString &key);
+    void removeInBackground(const QStringList &fileNames);
+
     mutable QCacheItem lastItem;
     QString cacheDirectory;
     QString dataDirectory;
     qint64 maximumCacheSize;
     qint64 currentCacheSize;
 
+    // keyed by the file name relative to dataDirectory
+    QHash<QString, QCacheIndexEntry> index;
+    qint64 indexedSize = 0;
+    quint64 accessCounter = 0;
+    bool indexLoaded = false;
+    QSharedPointer<QCacheFileRemovals> removals;
+
     QHash<QIODevice*, QCacheItem*> inserting;
     Q_DECLARE_PUBLIC(QNetworkDiskCache)
 };
@@ -61,10 +61,14 @@
 #include "qnetworkcookiejar.h"
 #include "qnetconmonitor_p.h"
 
+#include <QtCore/qloggingcategory.h>
+
 #include <string.h>             // for strchr
 
 QT_BEGIN_NAMESPACE
 
+Q_LOGGING_CATEGORY(lcNetworkTimings, "qt.network.access.timings")
+
 class QNetworkProxy;
 
 static inline bool isSeparator(char c)
@@ -634,6 +638,12 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
         thread->setObjectName(QStringLiteral("Qt HTTP synchronous thread"));
         QObject::connect(thread, SIGNAL(finished()), thread, SLOT(deleteLater()));
         thread->start();
+    } else if (request.http2Configuration().connectionSharingEnabled()
+               && (request.attribute(QNetworkRequest::Http2AllowedAttribute).toBool()
+                   || request.attribute(QNetworkRequest::Http2DirectAttribute).toBool())) {
+        // HTTP/2 connections shared by all managers live in one thread, so
+        // that its connection cache can hand them to any of them.
+        thread = QNetworkAccessManagerPrivate::sharedHttp2Thread();
     } else {
         // We use the manager-global thread.
         // At some point we could switch to having multiple threads if it makes sense.
@@ -870,6 +880,9 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
         QObject::connect(delegate, SIGNAL(redirected(QUrl,int,int)),
                 q, SLOT(onRedirected(QUrl,int,int)),
                 Qt::QueuedConnection);
+        QObject::connect(delegate, SIGNAL(timingsChanged(QHttpNetworkTimings)),
+                q, SLOT(replyTimingsChanged(QHttpNetworkTimings)),
+                Qt::QueuedConnection);
 
         QObject::connect(q, SIGNAL(redirectAllowed()), q, SLOT(followRedirect()),
                          Qt::QueuedConnection);
@@ -960,6 +973,7 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
     if (synchronous) {
         emit q->startHttpRequestSynchronously(); // This one is BlockingQueuedConnection, so it will return when all work is done
 
+        replyTimingsChanged(delegate->incomingTimings);
         if (delegate->incomingErrorCode != QNetworkReply::NoError) {
             replyDownloadMetaData
                     (delegate->incomingHeaders,
@@ -1099,6 +1113,43 @@ void QNetworkReplyHttpImplPrivate::replyDownloadData(QByteArray d)
 
 }
 
+void QNetworkReplyHttpImplPrivate::replyTimingsChanged(const QHttpNetworkTimings &timings)
+{
+    Q_Q(QNetworkReplyHttpImpl);
+    const auto setTime = [q](QNetworkRequest::Attribute code, qint64 time) {
+        q->setAttribute(code, time >= 0 ? QVariant(time) : QVariant());
+    };
+    setTime(QNetworkRequest::RequestQueuedTimeAttribute, timings.requestQueued);
+    setTime(QNetworkRequest::HostLookupStartTimeAttribute, timings.hostLookupStart);
+    setTime(QNetworkRequest::HostLookupEndTimeAttribute, timings.hostLookupEnd);
+    setTime(QNetworkRequest::ConnectStartTimeAttribute, timings.connectStart);
+    setTime(QNetworkRequest::ConnectEndTimeAttribute, timings.connectEnd);
+    setTime(QNetworkRequest::SecureConnectEndTimeAttribute, timings.secureConnectEnd);
+    setTime(QNetworkRequest::RequestStartTimeAttribute, timings.requestStart);
+    setTime(QNetworkRequest::ResponseStartTimeAttribute, timings.responseStart);
+    setTime(QNetworkRequest::ResponseEndTimeAttribute, timings.responseEnd);
+    q->setAttribute(QNetworkRequest::ConnectionReusedAttribute, timings.connectionReused);
+    q->setAttribute(QNetworkRequest::ConnectionRequestCountAttribute, timings.connectionRequestCount);
+
+    if (timings.responseEnd < 0 || !lcNetworkTimings().isDebugEnabled())
+        return;
+    // durations of the phases in milliseconds, -1 for those that didn't happen
+    const auto span = [](qint64 start, qint64 end) {
+        return start >= 0 && end >= start ? double(end - start) / 1000000 : -1.0;
+    };
+    qCDebug(lcNetworkTimings).nospace()
+            << q->url().toDisplayString()
+            << ": lookup " << span(timings.hostLookupStart, timings.hostLookupEnd)
+            << " ms, connect " << span(timings.connectStart, timings.connectEnd)
+            << " ms, tls " << span(timings.connectEnd, timings.secureConnectEnd)
+            << " ms, queued " << span(timings.requestQueued, timings.requestStart)
+            << " ms, first byte " << span(timings.requestStart, timings.responseStart)
+            << " ms, download " << span(timings.responseStart, timings.responseEnd)
+            << " ms, total " << span(timings.requestQueued, timings.responseEnd)
+            << " ms, request " << timings.connectionRequestCount << " on "
+            << (timings.connectionReused ? "reused" : "new") << " connection";
+}
+
 void QNetworkReplyHttpImplPrivate::replyFinished()
 {
     // We are already loading from cache, we still however
@@ -64,6 +64,7 @@
 
 #include <QtNetwork/QNetworkCacheMetaData>
 #include <private/qhttpnetworkrequest_p.h>
+#include <private/qhttpnetworkreply_p.h>
 #include <private/qnetworkreply_p.h>
 #include <QtNetwork/QNetworkProxy>
 #include <QtNetwork/QNetworkSession> // ### Qt6: Remove include
@@ -118,6 +119,7 @@ public:
                                                         int, QString, bool, QSharedPointer<char>,
                                                         qint64, qint64, bool))
     Q_PRIVATE_SLOT(d_func(), void replyDownloadProgressSlot(qint64,qint64))
+    Q_PRIVATE_SLOT(d_func(), void replyTimingsChanged(const QHttpNetworkTimings &))
     Q_PRIVATE_SLOT(d_func(), void httpAuthenticationRequired(const QHttpNetworkRequest &, QAuthenticator *))
     Q_PRIVATE_SLOT(d_func(), void httpError(QNetworkReply::NetworkError, const QString &))
 #ifndef QT_NO_SSL
@@ -295,6 +297,7 @@ public:
     void replyDownloadMetaData(const QList<QPair<QByteArray,QByteArray> > &, int, const QString &,
                                bool, QSharedPointer<char>, qint64, qint64, bool);
     void replyDownloadProgressSlot(qint64,qint64);
+    void replyTimingsChanged(const QHttpNetworkTimings &timings);
     void httpAuthenticationRequired(const QHttpNetworkRequest &request, QAuthenticator *auth);
     void httpError(QNetworkReply::NetworkError error, const QString &errorString);
 #ifndef QT_NO_SSL
@@ -348,6 +348,78 @@ QT_BEGIN_NAMESPACE
         the QNetworkReply after having emitted "finished".
         (This value was introduced in 5.14.)
 
+    \value RequestQueuedTimeAttribute
+        Replies only, type: QMetaType::LongLong (no default)
+        The time at which the request was queued on its HTTP connection.
+        This and the other timing attributes are in nanoseconds on the
+        monotonic clock used by QElapsedTimer and QDeadlineTimer, as
+        returned by QDeadlineTimer::deadlineNSecs() for
+        QDeadlineTimer::current(). They are set by HTTP replies when their
+        headers are received, and updated when the reply finishes.
+        (This value was introduced in 5.16.)
+
+    \value HostLookupStartTimeAttribute
+        Replies only, type: QMetaType::LongLong (no default)
+        The time at which the host name lookup for the connection the request
+        was sent on started. Not set if no lookup was needed, for example
+        because the host is given as an IP address.
+        (This value was introduced in 5.16.)
+
+    \value HostLookupEndTimeAttribute
+        Replies only, type: QMetaType::LongLong (no default)
+        The time at which the host name lookup for the connection the request
+        was sent on finished.
+        (This value was introduced in 5.16.)
+
+    \value ConnectStartTimeAttribute
+        Replies only, type: QMetaType::LongLong (no default)
+        The time at which the connection the request was sent on started
+        connecting to the server or proxy. If an existing connection was
+        reused, this precedes RequestQueuedTimeAttribute.
+        (This value was introduced in 5.16.)
+
+    \value ConnectEndTimeAttribute
+        Replies only, type: QMetaType::LongLong (no default)
+        The time at which the TCP connection was established. For encrypted
+        connections, this is also when the TLS handshake started.
+        (This value was introduced in 5.16.)
+
+    \value SecureConnectEndTimeAttribute
+        Replies only, type: QMetaType::LongLong (no default)
+        The time at which the TLS handshake of the connection finished. Only
+        set for encrypted connections.
+        (This value was introduced in 5.16.)
+
+    \value RequestStartTimeAttribute
+        Replies only, type: QMetaType::LongLong (no default)
+        The time at which the request started being written to the connection.
+        (This value was introduced in 5.16.)
+
+    \value ResponseStartTimeAttribute
+        Replies only, type: QMetaType::LongLong (no default)
+        The time at which the first byte of the response was read, or for
+        HTTP/2 its headers were received.
+        (This value was introduced in 5.16.)
+
+    \value ResponseEndTimeAttribute
+        Replies only, type: QMetaType::LongLong (no default)
+        The time at which the reply finished in the HTTP thread. Set when the
+        reply emits finished().
+        (This value was introduced in 5.16.)
+
+    \value ConnectionReusedAttribute
+        Replies only, type: QMetaType::Bool
+        Indicates whether the request was sent on a connection that had
+        already carried other requests. For HTTP/2 this is the case for all
+        but the first stream of a connection.
+        (This value was introduced in 5.16.)
+
+    \value ConnectionRequestCountAttribute
+        Replies only, type: QMetaType::Int
+        The number of requests sent on the connection so far, including this
+        one. For HTTP/2 this is the number of streams opened on it.
+        (This value was introduced in 5.16.)
+
     \value User
         Special type. Additional information can be passed in
         QVariants with types ranging from User to UserMax. The default
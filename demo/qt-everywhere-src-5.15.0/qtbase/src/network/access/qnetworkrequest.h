@@ -106,6 +106,17 @@ public:
         Http2DirectAttribute,
         ResourceTypeAttribute, // internal
         AutoDeleteReplyOnFinishAttribute,
+        RequestQueuedTimeAttribute,
+        HostLookupStartTimeAttribute,
+        HostLookupEndTimeAttribute,
+        ConnectStartTimeAttribute,
+        ConnectEndTimeAttribute,
+        SecureConnectEndTimeAttribute,
+        RequestStartTimeAttribute,
+        ResponseStartTimeAttribute,
+        ResponseEndTimeAttribute,
+        ConnectionReusedAttribute,
+        ConnectionRequestCountAttribute,
 
         User = 1000,
         UserMax = 32767
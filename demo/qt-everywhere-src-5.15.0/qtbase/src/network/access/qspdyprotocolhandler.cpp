@@ -946,6 +946,8 @@ void QSpdyProtocolHandler::parseHttpHeaders(char flags, const QByteArray &frameD
             httpReply->setHeaderField(name, value);
         }
     }
+    if (httpReply->d_func()->timings.responseStart < 0)
+        httpReply->d_func()->timings.responseStart = QHttpNetworkTimings::timestamp();
     emit httpReply->headerChanged();
 
     if (flag_fin) {
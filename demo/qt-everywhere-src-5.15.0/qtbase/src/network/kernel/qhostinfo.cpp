@@ -812,7 +812,10 @@ int QHostInfoPrivate::lookupHostImpl(const QString &name,
         if (manager->cache.isEnabled()) {
             // check cache first
             bool valid = false;
-            QHostInfo info = manager->cache.get(name, &valid);
+            bool needsRefresh = false;
+            QHostInfo info = manager->cache.get(name, &valid, &needsRefresh);
+            if (needsRefresh)
+                manager->refreshLookup(name);
             if (valid) {
                 info.setLookupId(id);
                 QHostInfoResult result(receiver, slotObj);
@@ -858,7 +861,8 @@ void QHostInfoRunnable::run()
     if (manager->cache.isEnabled()) {
         // check the cache first
         bool valid = false;
-        hostInfo = manager->cache.get(toBeLookedUp, &valid);
+        if (!refresh)
+            hostInfo = manager->cache.get(toBeLookedUp, &valid);
         if (!valid) {
             // not in cache, we need to do the lookup and store the result in the cache
             hostInfo = QHostInfoAgent::fromName(toBeLookedUp);
@@ -1038,6 +1042,20 @@ void QHostInfoLookupManager::abortLookup(int id)
         abortedLookups.append(id);
 }
 
+// called from QHostInfo, looks up a cached host again while the cached
+// result is still being used, so that frequent lookups for the same host
+// don't all wait for the resolver once it expired
+void QHostInfoLookupManager::refreshLookup(const QString &name)
+{
+#if QT_CONFIG(thread)
+    QHostInfoRunnable *runnable = new QHostInfoRunnable(name, nextId(), nullptr, nullptr);
+    runnable->refresh = true;
+    scheduleLookup(runnable);
+#else
+    Q_UNUSED(name);
+#endif
+}
+
 // called from QHostInfoRunnable
 bool QHostInfoLookupManager::wasAborted(int id)
 {
@@ -1073,7 +1091,10 @@ QHostInfo qt_qhostinfo_lookup(const QString &name, QObject *receiver, const char
     // check cache
     QHostInfoLookupManager* manager = theHostInfoLookupManager();
     if (manager && manager->cache.isEnabled()) {
-        QHostInfo info = manager->cache.get(name, valid);
+        bool needsRefresh = false;
+        QHostInfo info = manager->cache.get(name, valid, &needsRefresh);
+        if (needsRefresh)
+            manager->refreshLookup(name);
         if (*valid) {
             return info;
         }
@@ -1122,19 +1143,25 @@ QHostInfoCache::QHostInfoCache() : max_age(60), enabled(true), cache(128)
 #endif
 }
 
-QHostInfo QHostInfoCache::get(const QString &name, bool *valid)
+QHostInfo QHostInfoCache::get(const QString &name, bool *valid, bool *needsRefresh)
 {
     QMutexLocker locker(&this->mutex);
 
     *valid = false;
+    if (needsRefresh)
+        *needsRefresh = false;
     if (QHostInfoCacheElement *element = cache.object(name)) {
-        if (element->age.elapsed() < max_age*1000)
+        const qint64 age = element->age.elapsed();
+        if (age < max_age*1000) {
             *valid = true;
+            // Too old but not expired yet: ask the caller (once) to
+            // trigger a new lookup to freshen our cache.
+            if (needsRefresh && !element->refreshing && age >= max_age*750) {
+                element->refreshing = true;
+                *needsRefresh = true;
+            }
+        }
         return element->info;
-
-        // FIXME idea:
-        // if too old but not expired, trigger a new lookup
-        // to freshen our cache
     }
 
     return QHostInfo();
@@ -158,7 +158,7 @@ public:
     QHostInfoCache();
     const int max_age; // seconds
 
-    QHostInfo get(const QString &name, bool *valid);
+    QHostInfo get(const QString &name, bool *valid, bool *needsRefresh = nullptr);
     void put(const QString &name, const QHostInfo &info);
     void clear();
 
@@ -171,6 +171,7 @@ private:
     struct QHostInfoCacheElement {
         QHostInfo info;
         QElapsedTimer age;
+        bool refreshing = false;
     };
     QCache<QString,QHostInfoCacheElement> cache;
     QMutex mutex;
@@ -187,6 +188,7 @@ public:
 
     QString toBeLookedUp;
     int id;
+    bool refresh = false; // ignore the cached result, it's about to expire
     QHostInfoResult resultEmitter;
 };
 
@@ -202,6 +204,7 @@ public:
     // called from QHostInfo
     void scheduleLookup(QHostInfoRunnable *r);
     void abortLookup(int id);
+    void refreshLookup(const QString &name);
 
     // called from QHostInfoRunnable
     void lookupFinished(QHostInfoRunnable *r);
@@ -502,6 +502,9 @@
 
 #include <time.h>
 
+#include <algorithm>
+#include <utility>
+
 #define Q_CHECK_SOCKETENGINE(returnValue) do { \
     if (!d->socketEngine) { \
         return returnValue; \
@@ -510,6 +513,9 @@
 #ifndef QABSTRACTSOCKET_BUFFERSIZE
 #define QABSTRACTSOCKET_BUFFERSIZE 32768
 #endif
+#ifndef QABSTRACTSOCKET_MAX_WRITE_BLOCKS
+#define QABSTRACTSOCKET_MAX_WRITE_BLOCKS 16
+#endif
 #define QT_TRANSFER_TIMEOUT 120000
 
 QT_BEGIN_NAMESPACE
@@ -588,7 +594,8 @@ QAbstractSocketPrivate::QAbstractSocketPrivate()
       socketType(QAbstractSocket::UnknownSocketType),
       state(QAbstractSocket::UnconnectedState),
       socketError(QAbstractSocket::UnknownSocketError),
-      preferredNetworkLayerProtocol(QAbstractSocket::UnknownNetworkLayerProtocol)
+      preferredNetworkLayerProtocol(QAbstractSocket::UnknownNetworkLayerProtocol),
+      racingAttemptReceiver(this)
 {
     writeBufferChunkSize = QABSTRACTSOCKET_BUFFERSIZE;
 }
@@ -622,6 +629,7 @@ void QAbstractSocketPrivate::resetSocketLayer()
     }
     if (connectTimer)
         connectTimer->stop();
+    discardRacingAttempt();
 }
 
 /*! \internal
@@ -861,11 +869,28 @@ bool QAbstractSocketPrivate::writeToSocket()
         return false;
     }
 
-    qint64 nextSize = writeBuffer.nextDataBlockSize();
-    const char *ptr = writeBuffer.readPointer();
+    // Gather several chunks of the write buffer, so that the engine can
+    // hand them to the operating system in a single call.
+    const char *blocks[QABSTRACTSOCKET_MAX_WRITE_BLOCKS];
+    qint64 sizes[QABSTRACTSOCKET_MAX_WRITE_BLOCKS];
+    int blockCount = 0;
+    qint64 pos = 0;
+    while (blockCount < QABSTRACTSOCKET_MAX_WRITE_BLOCKS) {
+        qint64 blockSize;
+        const char *ptr = writeBuffer.readPointerAtPosition(pos, blockSize);
+        if (!blockSize)
+            break;
+        blocks[blockCount] = ptr;
+        sizes[blockCount] = blockSize;
+        ++blockCount;
+        pos += blockSize;
+    }
 
-    // Attempt to write it all in one chunk.
-    qint64 written = nextSize ? socketEngine->write(ptr, nextSize) : Q_INT64_C(0);
+    qint64 written = Q_INT64_C(0);
+    if (blockCount == 1)
+        written = socketEngine->write(blocks[0], sizes[0]);
+    else if (blockCount > 1)
+        written = socketEngine->writeBlocks(blocks, sizes, blockCount);
     if (written < 0) {
 #if defined (QABSTRACTSOCKET_DEBUG)
         qDebug() << "QAbstractSocketPrivate::writeToSocket() write error, aborting."
@@ -1046,6 +1071,23 @@ void QAbstractSocketPrivate::_q_startConnecting(const QHostInfo &hostInfo)
     qDebug("QAbstractSocketPrivate::_q_startConnecting(hostInfo == %s)", s.toLatin1().constData());
 #endif
 
+    raceConnectionAttempts = canRaceConnectionAttempts();
+    if (raceConnectionAttempts) {
+        // Alternate between address families, starting with the one
+        // the resolver preferred (RFC 8305, section 4).
+        const QAbstractSocket::NetworkLayerProtocol first = addresses.constFirst().protocol();
+        QList<QHostAddress> preferred, other;
+        for (const QHostAddress &address : qAsConst(addresses))
+            (address.protocol() == first ? preferred : other) << address;
+        addresses.clear();
+        for (int i = 0; i < qMax(preferred.size(), other.size()); ++i) {
+            if (i < preferred.size())
+                addresses << preferred.at(i);
+            if (i < other.size())
+                addresses << other.at(i);
+        }
+    }
+
     // Try all addresses twice.
     addresses += addresses;
 
@@ -1089,6 +1131,11 @@ void QAbstractSocketPrivate::_q_connectToNextAddress()
     Q_Q(QAbstractSocket);
     do {
         // Check for more pending addresses
+        if (addresses.isEmpty() && racingEngine) {
+            // The racing attempt is the last one left, keep waiting for it
+            adoptRacingAttempt();
+            return;
+        }
         if (addresses.isEmpty()) {
 #if defined(QABSTRACTSOCKET_DEBUG)
             qDebug("QAbstractSocketPrivate::_q_connectToNextAddress(), all addresses failed.");
@@ -1123,7 +1170,11 @@ void QAbstractSocketPrivate::_q_connectToNextAddress()
                host.toString().toLatin1().constData(), port, addresses.count());
 #endif
 
-        if (cachedSocketDescriptor == -1 && !initSocketLayer(host.protocol())) {
+        // Creating the next socket engine must not abort the racing attempt
+        QAbstractSocketEngine *racer = std::exchange(racingEngine, nullptr);
+        const bool initialized = cachedSocketDescriptor != -1 || initSocketLayer(host.protocol());
+        racingEngine = racer;
+        if (!initialized) {
             // hope that the next address is better
 #if defined(QABSTRACTSOCKET_DEBUG)
             qDebug("QAbstractSocketPrivate::_q_connectToNextAddress(), failed to initialize sock layer");
@@ -1137,6 +1188,7 @@ void QAbstractSocketPrivate::_q_connectToNextAddress()
         if (
             socketEngine->connectToHost(host, port)) {
                 //_q_testConnection();
+                discardRacingAttempt();
                 fetchConnectionParameters();
                 return;
         }
@@ -1168,6 +1220,17 @@ void QAbstractSocketPrivate::_q_connectToNextAddress()
             }
 #endif
             connectTimer->start(connectTimeout);
+
+            if (raceConnectionAttempts && !racingEngine && !addresses.isEmpty()) {
+                if (!racingTimer) {
+                    racingTimer = new QTimer(q);
+                    racingTimer->setSingleShot(true);
+                    QObject::connect(racingTimer, &QTimer::timeout,
+                                     q, [this]() { startRacingAttempt(); },
+                                     Qt::DirectConnection);
+                }
+                racingTimer->start(connectionAttemptDelay);
+            }
         }
 
         // Wait for a write notification that will eventually call
@@ -1191,6 +1254,7 @@ void QAbstractSocketPrivate::_q_testConnection()
         if (socketEngine->state() == QAbstractSocket::ConnectedState) {
             // Fetch the parameters if our connection is completed;
             // otherwise, fall out and try the next address.
+            discardRacingAttempt();
             fetchConnectionParameters();
             if (pendingClose) {
                 q_func()->disconnectFromHost();
@@ -1229,7 +1293,7 @@ void QAbstractSocketPrivate::_q_abortConnectionAttempt()
 
     connectTimer->stop();
 
-    if (addresses.isEmpty()) {
+    if (addresses.isEmpty() && !racingEngine) {
         state = QAbstractSocket::UnconnectedState;
         setError(QAbstractSocket::SocketTimeoutError,
                  QAbstractSocket::tr("Connection timed out"));
@@ -1240,6 +1304,150 @@ void QAbstractSocketPrivate::_q_abortConnectionAttempt()
     }
 }
 
+/*! \internal
+
+    Returns \c true if connection attempts to the addresses of the looked
+    up host can be raced: this is only done for TCP sockets connecting
+    directly (without a proxy or a descriptor bound beforehand) to a host
+    having both IPv6 and IPv4 addresses.
+*/
+bool QAbstractSocketPrivate::canRaceConnectionAttempts() const
+{
+    Q_Q(const QAbstractSocket);
+    if (q->socketType() != QAbstractSocket::TcpSocket || cachedSocketDescriptor != -1)
+        return false;
+    if (!threadData.loadRelaxed()->hasEventDispatcher())
+        return false;
+#ifndef QT_NO_NETWORKPROXY
+    if (proxyInUse.type() != QNetworkProxy::NoProxy)
+        return false;
+#endif
+    const auto hasFamily = [this](QAbstractSocket::NetworkLayerProtocol protocol) {
+        return std::any_of(addresses.cbegin(), addresses.cend(), [protocol](const QHostAddress &a) {
+            return a.protocol() == protocol;
+        });
+    };
+    return hasFamily(QAbstractSocket::IPv6Protocol) && hasFamily(QAbstractSocket::IPv4Protocol);
+}
+
+/*! \internal
+
+    Called connectionAttemptDelay ms after a connection attempt started
+    and did not complete yet: starts connecting to the next address
+    using a second socket engine.
+*/
+void QAbstractSocketPrivate::startRacingAttempt()
+{
+    Q_Q(QAbstractSocket);
+    if (state != QAbstractSocket::ConnectingState || racingEngine || addresses.isEmpty())
+        return;
+
+#ifdef QT_NO_NETWORKPROXY
+    static const QNetworkProxy &proxyInUse = *(QNetworkProxy *)0;
+#endif
+    racingHost = addresses.takeFirst();
+    racingEngine = QAbstractSocketEngine::createSocketEngine(q->socketType(), proxyInUse, q);
+    if (!racingEngine)
+        return;
+#ifndef QT_NO_BEARERMANAGEMENT // ### Qt6: Remove section
+    racingEngine->setProperty("_q_networksession", q->property("_q_networksession"));
+#endif
+    if (!racingEngine->initialize(q->socketType(), racingHost.protocol())) {
+        discardRacingAttempt();
+        return;
+    }
+
+#if defined(QABSTRACTSOCKET_DEBUG)
+    qDebug("QAbstractSocketPrivate::startRacingAttempt(), connecting to %s:%i",
+           racingHost.toString().toLatin1().constData(), port);
+#endif
+    racingEngine->setReceiver(&racingAttemptReceiver);
+    if (racingEngine->connectToHost(racingHost, port)) {
+        testRacingAttempt();
+        return;
+    }
+    if (racingEngine->state() != QAbstractSocket::ConnectingState) {
+        discardRacingAttempt();
+        return;
+    }
+    racingEngine->setWriteNotificationEnabled(true);
+}
+
+/*! \internal
+
+    Checks the racing connection attempt: if it succeeded, it replaces
+    the current one. If it failed, it is dropped.
+*/
+void QAbstractSocketPrivate::testRacingAttempt()
+{
+    if (!racingEngine || state != QAbstractSocket::ConnectingState)
+        return;
+
+    if (racingEngine->state() != QAbstractSocket::ConnectedState) {
+#if defined(QABSTRACTSOCKET_DEBUG)
+        qDebug("QAbstractSocketPrivate::testRacingAttempt(), connection to %s failed",
+               racingHost.toString().toLatin1().constData());
+#endif
+        discardRacingAttempt();
+        // Race the next address against the current attempt instead
+        if (!addresses.isEmpty())
+            racingTimer->start(0);
+        return;
+    }
+
+    adoptRacingAttempt();
+}
+
+/*! \internal
+
+    Makes the racing connection attempt the current one, dropping the
+    attempt it raced against.
+*/
+void QAbstractSocketPrivate::adoptRacingAttempt()
+{
+    Q_Q(QAbstractSocket);
+    QAbstractSocketEngine *engine = std::exchange(racingEngine, nullptr);
+    if (racingTimer)
+        racingTimer->stop();
+    if (connectTimer)
+        connectTimer->stop();
+
+    if (socketEngine) {
+        socketEngine->close();
+        socketEngine->disconnect();
+        delete socketEngine;
+    }
+    socketEngine = engine;
+    host = racingHost;
+    socketEngine->setReceiver(this);
+
+    if (socketEngine->state() == QAbstractSocket::ConnectedState) {
+        fetchConnectionParameters();
+        if (pendingClose) {
+            q->disconnectFromHost();
+            pendingClose = false;
+        }
+        return;
+    }
+
+    // Still connecting (we ran out of other addresses), just wait
+    if (connectTimer)
+        connectTimer->start(QNetworkConfigurationPrivate::DefaultTimeout);
+}
+
+/*! \internal
+*/
+void QAbstractSocketPrivate::discardRacingAttempt()
+{
+    if (racingTimer)
+        racingTimer->stop();
+    if (!racingEngine)
+        return;
+    racingEngine->close();
+    racingEngine->disconnect();
+    delete std::exchange(racingEngine, nullptr);
+}
+
 /*! \internal
 
     Reads data from the socket layer into the read buffer. Returns
@@ -1668,6 +1876,12 @@ bool QAbstractSocket::isValid() const
     established, QAbstractSocket enters ConnectedState and
     emits connected().
 
+    If the lookup returns both IPv6 and IPv4 addresses, a TCP socket not
+    using a proxy tries them alternately, and starts connecting to the
+    next address if the previous attempt did not succeed within 250
+    milliseconds, without aborting it ("Happy Eyeballs", RFC 8305). The
+    socket uses the first connection that is established.
+
     At any point, the socket can emit errorOccurred() to signal that an error
     occurred.
 
@@ -99,6 +99,38 @@ public:
     void _q_testConnection();
     void _q_abortConnectionAttempt();
 
+    // "Happy Eyeballs" (RFC 8305): when the host has both IPv6 and IPv4
+    // addresses, a second connection attempt is started if the current
+    // one did not succeed within connectionAttemptDelay ms. The first
+    // attempt to connect wins.
+    struct RacingAttemptReceiver : public QAbstractSocketEngineReceiver
+    {
+        explicit RacingAttemptReceiver(QAbstractSocketPrivate *d) : d(d) {}
+        void readNotification() override {}
+        void writeNotification() override {}
+        void closeNotification() override {}
+        void exceptionNotification() override {}
+        void connectionNotification() override { d->testRacingAttempt(); }
+#ifndef QT_NO_NETWORKPROXY
+        void proxyAuthenticationRequired(const QNetworkProxy &, QAuthenticator *) override {}
+#endif
+        QAbstractSocketPrivate *d;
+    };
+
+    enum { connectionAttemptDelay = 250 };
+
+    bool canRaceConnectionAttempts() const;
+    void startRacingAttempt();
+    void testRacingAttempt();
+    void adoptRacingAttempt();
+    void discardRacingAttempt();
+
+    RacingAttemptReceiver racingAttemptReceiver;
+    QAbstractSocketEngine *racingEngine = nullptr;
+    QHostAddress racingHost;
+    QTimer *racingTimer = nullptr;
+    bool raceConnectionAttempts = false;
+
     bool emittedReadyRead;
     bool emittedBytesWritten;
 
@@ -47,6 +47,7 @@
 
 #include "qmutex.h"
 #include "qnetworkproxy.h"
+#include "private/qnetworkdatagram_p.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -149,6 +150,88 @@ void QAbstractSocketEngine::setError(QAbstractSocket::SocketError error, const Q
     d->socketErrorString = errorString;
 }
 
+/*!
+    Writes \a count blocks, where block \e i starts at \a blocks[i] and
+    is \a sizes[i] bytes long, to the socket in order. Returns the total
+    number of bytes written, or -1 if an error occurred before anything
+    was written.
+
+    The default implementation calls write() for each block, stopping at
+    the first partial write. Engines that can hand several buffers to the
+    operating system at once reimplement this to gather them into a
+    single system call.
+*/
+qint64 QAbstractSocketEngine::writeBlocks(const char *const *blocks, const qint64 *sizes, int count)
+{
+    qint64 totalWritten = 0;
+    for (int i = 0; i < count; ++i) {
+        const qint64 written = write(blocks[i], sizes[i]);
+        if (written < 0)
+            return totalWritten ? totalWritten : written;
+        totalWritten += written;
+        if (written < sizes[i])
+            break;
+    }
+    return totalWritten;
+}
+
+/*!
+    Reads up to \a maxCount datagrams, each of them into the data and
+    header of the corresponding entry of \a datagrams. Datagrams larger
+    than \a maxSize bytes are truncated; if \a maxSize is -1, each
+    datagram is read entirely. Returns the number of datagrams read,
+    which is 0 if none is pending, or -1 if an error occurred before
+    anything was read.
+
+    The default implementation calls readDatagram() for each datagram.
+    Engines that can receive several datagrams in one system call
+    reimplement this.
+*/
+int QAbstractSocketEngine::readDatagrams(QNetworkDatagramPrivate *const *datagrams, int maxCount,
+                                         qint64 maxSize, PacketHeaderOptions options)
+{
+    int count = 0;
+    while (count < maxCount && hasPendingDatagrams()) {
+        const qint64 size = maxSize < 0 ? pendingDatagramSize() : maxSize;
+        if (size < 0)
+            break;
+        QNetworkDatagramPrivate *datagram = datagrams[count];
+        datagram->data.resize(int(size));
+        const qint64 readBytes = readDatagram(datagram->data.data(), size, &datagram->header, options);
+        if (readBytes < 0) {
+            datagram->data.clear();
+            if (readBytes == -2) // nothing to read after all
+                break;
+            return count ? count : -1;
+        }
+        datagram->data.truncate(int(readBytes));
+        ++count;
+    }
+    return count;
+}
+
+/*!
+    Sends the \a count datagrams in \a datagrams in order, each to the
+    destination in its header. Returns the number of datagrams sent,
+    which is 0 if the socket could not take any (without an error), or
+    -1 if an error occurred before anything was sent.
+
+    The default implementation calls writeDatagram() for each datagram.
+    Engines that can send several datagrams in one system call
+    reimplement this.
+*/
+int QAbstractSocketEngine::writeDatagrams(const QNetworkDatagramPrivate *const *datagrams, int count)
+{
+    for (int i = 0; i < count; ++i) {
+        const QNetworkDatagramPrivate *datagram = datagrams[i];
+        const qint64 sent = writeDatagram(datagram->data.constData(), datagram->data.size(),
+                                          datagram->header);
+        if (sent < 0)
+            return (i || sent == -2) ? i : -1;
+    }
+    return count;
+}
+
 void QAbstractSocketEngine::setReceiver(QAbstractSocketEngineReceiver *receiver)
 {
     d_func()->receiver = receiver;
@@ -66,6 +66,7 @@ class QAbstractSocketEnginePrivate;
 class QNetworkInterface;
 #endif
 class QNetworkProxy;
+class QNetworkDatagramPrivate;
 
 class QAbstractSocketEngineReceiver {
 public:
@@ -140,6 +141,7 @@ public:
 
     virtual qint64 read(char *data, qint64 maxlen) = 0;
     virtual qint64 write(const char *data, qint64 len) = 0;
+    virtual qint64 writeBlocks(const char *const *blocks, const qint64 *sizes, int count);
 
 #ifndef QT_NO_UDPSOCKET
 #ifndef QT_NO_NETWORKINTERFACE
@@ -158,6 +160,9 @@ public:
     virtual qint64 readDatagram(char *data, qint64 maxlen, QIpPacketHeader *header = nullptr,
                                 PacketHeaderOptions = WantNone) = 0;
     virtual qint64 writeDatagram(const char *data, qint64 len, const QIpPacketHeader &header) = 0;
+    virtual int readDatagrams(QNetworkDatagramPrivate *const *datagrams, int maxCount, qint64 maxSize,
+                              PacketHeaderOptions options = WantNone);
+    virtual int writeDatagrams(const QNetworkDatagramPrivate *const *datagrams, int count);
     virtual qint64 bytesToWrite() const = 0;
 
     virtual int option(SocketOption option) const = 0;
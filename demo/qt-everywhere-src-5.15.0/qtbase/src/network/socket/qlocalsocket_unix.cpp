@@ -362,7 +362,8 @@ bool QLocalSocket::setSocketDescriptor(qintptr socketDescriptor,
         newSocketState = QAbstractSocket::UnconnectedState;
         break;
     }
-    QIODevice::open(openMode);
+    // The data is buffered by unixSocket already, as when connecting to a server
+    QIODevice::open(openMode | QIODevice::Unbuffered);
     d->state = socketState;
     return d->unixSocket.setSocketDescriptor(socketDescriptor,
                                              newSocketState, openMode);
@@ -902,6 +902,45 @@ qint64 QNativeSocketEngine::writeDatagram(const char *data, qint64 size, const Q
     return d->nativeSendDatagram(data, size, header);
 }
 
+/*!
+    Reads up to \a maxCount datagrams into \a datagrams, see
+    QAbstractSocketEngine::readDatagrams(). On Linux, UDP datagrams are
+    received with a single recvmmsg() call.
+*/
+int QNativeSocketEngine::readDatagrams(QNetworkDatagramPrivate *const *datagrams, int maxCount,
+                                       qint64 maxSize, PacketHeaderOptions options)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::readDatagrams(), -1);
+    Q_CHECK_STATES(QNativeSocketEngine::readDatagrams(), QAbstractSocket::BoundState,
+                   QAbstractSocket::ConnectedState, -1);
+#ifdef Q_OS_LINUX
+    if (d->socketType == QAbstractSocket::UdpSocket)
+        return d->nativeReceiveDatagrams(datagrams, maxCount, maxSize, options);
+#endif
+    return QAbstractSocketEngine::readDatagrams(datagrams, maxCount, maxSize, options);
+}
+
+/*!
+    Sends the \a count datagrams in \a datagrams, see
+    QAbstractSocketEngine::writeDatagrams(). On Linux, UDP datagrams are
+    sent with a single sendmmsg() call, and consecutive datagrams of the
+    same size to the same destination are handed to the kernel as one
+    segmented (UDP_SEGMENT) message where supported.
+*/
+int QNativeSocketEngine::writeDatagrams(const QNetworkDatagramPrivate *const *datagrams, int count)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::writeDatagrams(), -1);
+    Q_CHECK_STATES(QNativeSocketEngine::writeDatagrams(), QAbstractSocket::BoundState,
+                   QAbstractSocket::ConnectedState, -1);
+#ifdef Q_OS_LINUX
+    if (d->socketType == QAbstractSocket::UdpSocket && count > 1)
+        return d->nativeSendDatagrams(datagrams, count);
+#endif
+    return QAbstractSocketEngine::writeDatagrams(datagrams, count);
+}
+
 /*!
     Writes a block of \a size bytes from \a data to the socket.
     Returns the number of bytes written, or -1 if an error occurred.
@@ -918,6 +957,24 @@ qint64 QNativeSocketEngine::write(const char *data, qint64 size)
     return d->nativeWrite(data, size);
 }
 
+/*!
+    Writes \a count blocks described by \a blocks and \a sizes to the
+    socket using a single gathering system call. Returns the number of
+    bytes written, or -1 if an error occurred.
+
+    Only TCP sockets are gathered; for other socket types each block would
+    form its own datagram, so this falls back to write().
+*/
+qint64 QNativeSocketEngine::writeBlocks(const char *const *blocks, const qint64 *sizes, int count)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::writeBlocks(), -1);
+    Q_CHECK_STATE(QNativeSocketEngine::writeBlocks(), QAbstractSocket::ConnectedState, -1);
+    if (count == 1 || d->socketType != QAbstractSocket::TcpSocket)
+        return QAbstractSocketEngine::writeBlocks(blocks, sizes, count);
+    return d->nativeWriteBlocks(blocks, sizes, count);
+}
+
 
 qint64 QNativeSocketEngine::bytesToWrite() const
 {
@@ -146,6 +146,7 @@ public:
 
     qint64 read(char *data, qint64 maxlen) override;
     qint64 write(const char *data, qint64 len) override;
+    qint64 writeBlocks(const char *const *blocks, const qint64 *sizes, int count) override;
 
 #ifndef QT_NO_UDPSOCKET
 #ifndef QT_NO_NETWORKINTERFACE
@@ -164,6 +165,9 @@ public:
     qint64 readDatagram(char *data, qint64 maxlen, QIpPacketHeader * = nullptr,
                         PacketHeaderOptions = WantNone) override;
     qint64 writeDatagram(const char *data, qint64 len, const QIpPacketHeader &) override;
+    int readDatagrams(QNetworkDatagramPrivate *const *datagrams, int maxCount, qint64 maxSize,
+                      PacketHeaderOptions = WantNone) override;
+    int writeDatagrams(const QNetworkDatagramPrivate *const *datagrams, int count) override;
     qint64 bytesToWrite() const override;
 
 #if 0   // currently unused
@@ -277,8 +281,21 @@ public:
     qint64 nativeReceiveDatagram(char *data, qint64 maxLength, QIpPacketHeader *header,
                                  QAbstractSocketEngine::PacketHeaderOptions options);
     qint64 nativeSendDatagram(const char *data, qint64 length, const QIpPacketHeader &header);
+#ifndef Q_OS_WIN
+    cmsghdr *prepareDatagramMessage(msghdr *msg, qt_sockaddr *aa, quintptr *cbuf,
+                                    const QIpPacketHeader &header);
+#endif
+#ifdef Q_OS_LINUX
+    int nativeReceiveDatagrams(QNetworkDatagramPrivate *const *datagrams, int maxCount, qint64 maxSize,
+                               QAbstractSocketEngine::PacketHeaderOptions options);
+    int nativeSendDatagrams(const QNetworkDatagramPrivate *const *datagrams, int count);
+
+    QByteArray datagramPool; // receive buffers of nativeReceiveDatagrams(), reused
+    int udpSegmentationSupport = -1; // UDP_SEGMENT: -1 until probed, then 0 or 1
+#endif
     qint64 nativeRead(char *data, qint64 maxLength);
     qint64 nativeWrite(const char *data, qint64 length);
+    qint64 nativeWriteBlocks(const char *const *blocks, const qint64 *sizes, int count);
     int nativeSelect(int timeout, bool selectForRead) const;
     int nativeSelect(int timeout, bool checkRead, bool checkWrite,
                      bool *selectForRead, bool *selectForWrite) const;
@@ -68,6 +68,10 @@
 #endif
 
 #include <netinet/tcp.h>
+#ifdef Q_OS_LINUX
+#include <netinet/udp.h>
+#include "private/qnetworkdatagram_p.h"
+#endif
 #ifndef QT_NO_SCTP
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -935,6 +939,78 @@ qint64 QNativeSocketEnginePrivate::nativePendingDatagramSize() const
     return qint64(recvResult);
 }
 
+/*
+    Fills \a header with the sender address \a aa and what the ancillary
+    data of the received message \a msg tells about the datagram.
+*/
+static void qt_socket_getPacketHeader(msghdr *msg, const qt_sockaddr *aa, quint16 localPort,
+                                      QIpPacketHeader *header)
+{
+    qt_socket_getPortAndAddress(aa, &header->senderPort, &header->senderAddress);
+    header->destinationPort = localPort;
+    header->endOfRecord = (msg->msg_flags & MSG_EOR) != 0;
+
+    // parse the ancillary data
+    struct cmsghdr *cmsgptr;
+    QT_WARNING_PUSH
+    QT_WARNING_DISABLE_CLANG("-Wsign-compare")
+    for (cmsgptr = CMSG_FIRSTHDR(msg); cmsgptr != nullptr;
+         cmsgptr = CMSG_NXTHDR(msg, cmsgptr)) {
+        QT_WARNING_POP
+        if (cmsgptr->cmsg_level == IPPROTO_IPV6 && cmsgptr->cmsg_type == IPV6_PKTINFO
+                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in6_pktinfo))) {
+            in6_pktinfo *info = reinterpret_cast<in6_pktinfo *>(CMSG_DATA(cmsgptr));
+
+            header->destinationAddress.setAddress(reinterpret_cast<quint8 *>(&info->ipi6_addr));
+            header->ifindex = info->ipi6_ifindex;
+            if (header->ifindex)
+                header->destinationAddress.setScopeId(QString::number(info->ipi6_ifindex));
+        }
+
+#ifdef IP_PKTINFO
+        if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_PKTINFO
+                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in_pktinfo))) {
+            in_pktinfo *info = reinterpret_cast<in_pktinfo *>(CMSG_DATA(cmsgptr));
+
+            header->destinationAddress.setAddress(ntohl(info->ipi_addr.s_addr));
+            header->ifindex = info->ipi_ifindex;
+        }
+#else
+#  ifdef IP_RECVDSTADDR
+        if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_RECVDSTADDR
+                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in_addr))) {
+            in_addr *addr = reinterpret_cast<in_addr *>(CMSG_DATA(cmsgptr));
+
+            header->destinationAddress.setAddress(ntohl(addr->s_addr));
+        }
+#  endif
+#  if defined(IP_RECVIF) && defined(Q_OS_BSD4)
+        if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_RECVIF
+                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(sockaddr_dl))) {
+            sockaddr_dl *sdl = reinterpret_cast<sockaddr_dl *>(CMSG_DATA(cmsgptr));
+            header->ifindex = sdl->sdl_index;
+        }
+#  endif
+#endif
+
+        if (cmsgptr->cmsg_len == CMSG_LEN(sizeof(int))
+                && ((cmsgptr->cmsg_level == IPPROTO_IPV6 && cmsgptr->cmsg_type == IPV6_HOPLIMIT)
+                    || (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_TTL))) {
+            Q_STATIC_ASSERT(sizeof(header->hopLimit) == sizeof(int));
+            memcpy(&header->hopLimit, CMSG_DATA(cmsgptr), sizeof(header->hopLimit));
+        }
+
+#ifndef QT_NO_SCTP
+        if (cmsgptr->cmsg_level == IPPROTO_SCTP && cmsgptr->cmsg_type == SCTP_SNDRCV
+            && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(sctp_sndrcvinfo))) {
+            sctp_sndrcvinfo *rcvInfo = reinterpret_cast<sctp_sndrcvinfo *>(CMSG_DATA(cmsgptr));
+
+            header->streamNumber = int(rcvInfo->sinfo_stream);
+        }
+#endif
+    }
+}
+
 qint64 QNativeSocketEnginePrivate::nativeReceiveDatagram(char *data, qint64 maxSize, QIpPacketHeader *header,
                                                          QAbstractSocketEngine::PacketHeaderOptions options)
 {
@@ -994,69 +1070,7 @@ qint64 QNativeSocketEnginePrivate::nativeReceiveDatagram(char *data, qint64 maxS
             header->clear();
     } else if (options != QAbstractSocketEngine::WantNone) {
         Q_ASSERT(header);
-        qt_socket_getPortAndAddress(&aa, &header->senderPort, &header->senderAddress);
-        header->destinationPort = localPort;
-        header->endOfRecord = (msg.msg_flags & MSG_EOR) != 0;
-
-        // parse the ancillary data
-        struct cmsghdr *cmsgptr;
-        QT_WARNING_PUSH
-        QT_WARNING_DISABLE_CLANG("-Wsign-compare")
-        for (cmsgptr = CMSG_FIRSTHDR(&msg); cmsgptr != nullptr;
-             cmsgptr = CMSG_NXTHDR(&msg, cmsgptr)) {
-            QT_WARNING_POP
-            if (cmsgptr->cmsg_level == IPPROTO_IPV6 && cmsgptr->cmsg_type == IPV6_PKTINFO
-                    && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in6_pktinfo))) {
-                in6_pktinfo *info = reinterpret_cast<in6_pktinfo *>(CMSG_DATA(cmsgptr));
-
-                header->destinationAddress.setAddress(reinterpret_cast<quint8 *>(&info->ipi6_addr));
-                header->ifindex = info->ipi6_ifindex;
-                if (header->ifindex)
-                    header->destinationAddress.setScopeId(QString::number(info->ipi6_ifindex));
-            }
-
-#ifdef IP_PKTINFO
-            if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_PKTINFO
-                    && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in_pktinfo))) {
-                in_pktinfo *info = reinterpret_cast<in_pktinfo *>(CMSG_DATA(cmsgptr));
-
-                header->destinationAddress.setAddress(ntohl(info->ipi_addr.s_addr));
-                header->ifindex = info->ipi_ifindex;
-            }
-#else
-#  ifdef IP_RECVDSTADDR
-            if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_RECVDSTADDR
-                    && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in_addr))) {
-                in_addr *addr = reinterpret_cast<in_addr *>(CMSG_DATA(cmsgptr));
-
-                header->destinationAddress.setAddress(ntohl(addr->s_addr));
-            }
-#  endif
-#  if defined(IP_RECVIF) && defined(Q_OS_BSD4)
-            if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_RECVIF
-                    && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(sockaddr_dl))) {
-                sockaddr_dl *sdl = reinterpret_cast<sockaddr_dl *>(CMSG_DATA(cmsgptr));
-                header->ifindex = sdl->sdl_index;
-            }
-#  endif
-#endif
-
-            if (cmsgptr->cmsg_len == CMSG_LEN(sizeof(int))
-                    && ((cmsgptr->cmsg_level == IPPROTO_IPV6 && cmsgptr->cmsg_type == IPV6_HOPLIMIT)
-                        || (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_TTL))) {
-                Q_STATIC_ASSERT(sizeof(header->hopLimit) == sizeof(int));
-                memcpy(&header->hopLimit, CMSG_DATA(cmsgptr), sizeof(header->hopLimit));
-            }
-
-#ifndef QT_NO_SCTP
-            if (cmsgptr->cmsg_level == IPPROTO_SCTP && cmsgptr->cmsg_type == SCTP_SNDRCV
-                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(sctp_sndrcvinfo))) {
-                sctp_sndrcvinfo *rcvInfo = reinterpret_cast<sctp_sndrcvinfo *>(CMSG_DATA(cmsgptr));
-
-                header->streamNumber = int(rcvInfo->sinfo_stream);
-            }
-#endif
-        }
+        qt_socket_getPacketHeader(&msg, &aa, localPort, header);
     }
 
 #if defined (QNATIVESOCKETENGINE_DEBUG)
@@ -1071,37 +1085,39 @@ qint64 QNativeSocketEnginePrivate::nativeReceiveDatagram(char *data, qint64 maxS
     return qint64((maxSize || recvResult < 0) ? recvResult : Q_INT64_C(0));
 }
 
-qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 len, const QIpPacketHeader &header)
-{
-    // we use quintptr to force the alignment
-    quintptr cbuf[(CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))
+// Space for the ancillary data of a datagram we send (in quintptr to
+// force the alignment)
+enum {
+    DatagramControlBufferSize = (CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))
 #ifndef QT_NO_SCTP
-                   + CMSG_SPACE(sizeof(struct sctp_sndrcvinfo))
+                                 + CMSG_SPACE(sizeof(struct sctp_sndrcvinfo))
 #endif
-                   + sizeof(quintptr) - 1) / sizeof(quintptr)];
+#ifdef UDP_SEGMENT
+                                 + CMSG_SPACE(sizeof(quint16))
+#endif
+                                 + sizeof(quintptr) - 1) / sizeof(quintptr)
+};
 
+/*
+    Sets the destination of \a msg (stored in \a aa) and the ancillary
+    data (in \a cbuf) for sending a datagram with \a header. Returns where
+    further ancillary data can be appended.
+*/
+cmsghdr *QNativeSocketEnginePrivate::prepareDatagramMessage(msghdr *msg, qt_sockaddr *aa, quintptr *cbuf,
+                                                            const QIpPacketHeader &header)
+{
     struct cmsghdr *cmsgptr = reinterpret_cast<struct cmsghdr *>(cbuf);
-    struct msghdr msg;
-    struct iovec vec;
-    qt_sockaddr aa;
-
-    memset(&msg, 0, sizeof(msg));
-    memset(&aa, 0, sizeof(aa));
-    vec.iov_base = const_cast<char *>(data);
-    vec.iov_len = len;
-    msg.msg_iov = &vec;
-    msg.msg_iovlen = 1;
-    msg.msg_control = &cbuf;
+    msg->msg_control = cbuf;
 
     if (header.destinationPort != 0) {
-        msg.msg_name = &aa.a;
+        msg->msg_name = &aa->a;
         setPortAndAddress(header.destinationPort, header.destinationAddress,
-                          &aa, &msg.msg_namelen);
+                          aa, &msg->msg_namelen);
     }
 
-    if (msg.msg_namelen == sizeof(aa.a6)) {
+    if (msg->msg_namelen == sizeof(aa->a6)) {
         if (header.hopLimit != -1) {
-            msg.msg_controllen += CMSG_SPACE(sizeof(int));
+            msg->msg_controllen += CMSG_SPACE(sizeof(int));
             cmsgptr->cmsg_len = CMSG_LEN(sizeof(int));
             cmsgptr->cmsg_level = IPPROTO_IPV6;
             cmsgptr->cmsg_type = IPV6_HOPLIMIT;
@@ -1111,7 +1127,7 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
         if (header.ifindex != 0 || !header.senderAddress.isNull()) {
             struct in6_pktinfo *data = reinterpret_cast<in6_pktinfo *>(CMSG_DATA(cmsgptr));
             memset(data, 0, sizeof(*data));
-            msg.msg_controllen += CMSG_SPACE(sizeof(*data));
+            msg->msg_controllen += CMSG_SPACE(sizeof(*data));
             cmsgptr->cmsg_len = CMSG_LEN(sizeof(*data));
             cmsgptr->cmsg_level = IPPROTO_IPV6;
             cmsgptr->cmsg_type = IPV6_PKTINFO;
@@ -1123,7 +1139,7 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
         }
     } else {
         if (header.hopLimit != -1) {
-            msg.msg_controllen += CMSG_SPACE(sizeof(int));
+            msg->msg_controllen += CMSG_SPACE(sizeof(int));
             cmsgptr->cmsg_len = CMSG_LEN(sizeof(int));
             cmsgptr->cmsg_level = IPPROTO_IP;
             cmsgptr->cmsg_type = IP_TTL;
@@ -1145,7 +1161,7 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
             data->s_addr = htonl(header.senderAddress.toIPv4Address());
 #  endif
             cmsgptr->cmsg_level = IPPROTO_IP;
-            msg.msg_controllen += CMSG_SPACE(sizeof(*data));
+            msg->msg_controllen += CMSG_SPACE(sizeof(*data));
             cmsgptr->cmsg_len = CMSG_LEN(sizeof(*data));
             cmsgptr = reinterpret_cast<cmsghdr *>(reinterpret_cast<char *>(cmsgptr) + CMSG_SPACE(sizeof(*data)));
         }
@@ -1156,7 +1172,7 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
     if (header.streamNumber != -1) {
         struct sctp_sndrcvinfo *data = reinterpret_cast<sctp_sndrcvinfo *>(CMSG_DATA(cmsgptr));
         memset(data, 0, sizeof(*data));
-        msg.msg_controllen += CMSG_SPACE(sizeof(sctp_sndrcvinfo));
+        msg->msg_controllen += CMSG_SPACE(sizeof(sctp_sndrcvinfo));
         cmsgptr->cmsg_len = CMSG_LEN(sizeof(sctp_sndrcvinfo));
         cmsgptr->cmsg_level = IPPROTO_SCTP;
         cmsgptr->cmsg_type =  SCTP_SNDRCV;
@@ -1165,6 +1181,26 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
     }
 #endif
 
+    return cmsgptr;
+}
+
+qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 len, const QIpPacketHeader &header)
+{
+    // we use quintptr to force the alignment
+    quintptr cbuf[DatagramControlBufferSize];
+
+    struct msghdr msg;
+    struct iovec vec;
+    qt_sockaddr aa;
+
+    memset(&msg, 0, sizeof(msg));
+    memset(&aa, 0, sizeof(aa));
+    vec.iov_base = const_cast<char *>(data);
+    vec.iov_len = len;
+    msg.msg_iov = &vec;
+    msg.msg_iovlen = 1;
+    prepareDatagramMessage(&msg, &aa, cbuf, header);
+
     if (msg.msg_controllen == 0)
         msg.msg_control = nullptr;
     ssize_t sentBytes = qt_safe_sendmsg(socketDescriptor, &msg, 0);
@@ -1198,6 +1234,233 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
     return qint64(sentBytes);
 }
 
+#ifdef Q_OS_LINUX
+namespace {
+// recvmmsg() and sendmmsg() take up to UIO_MAXIOV messages, we use
+// smaller batches to bound the memory used
+const int MaxDatagramBatch = 64;
+// Enough for any UDP datagram (IPv6 jumbograms aside)
+const int MaxDatagramSize = 65536;
+#ifdef UDP_SEGMENT
+const int MaxUdpSegments = 64; // UDP_MAX_SEGMENTS
+const qint64 MaxSegmentedPayload = 65535 - 40 - 8; // IPv6 and UDP headers
+#endif
+}
+
+static inline bool qt_sameDatagramRoute(const QIpPacketHeader &lhs, const QIpPacketHeader &rhs)
+{
+    return lhs.destinationPort == rhs.destinationPort && lhs.hopLimit == rhs.hopLimit
+            && lhs.ifindex == rhs.ifindex && lhs.destinationAddress == rhs.destinationAddress
+            && lhs.senderAddress == rhs.senderAddress;
+}
+
+int QNativeSocketEnginePrivate::nativeReceiveDatagrams(QNetworkDatagramPrivate *const *datagrams, int maxCount,
+                                                       qint64 maxSize,
+                                                       QAbstractSocketEngine::PacketHeaderOptions options)
+{
+    // we use quintptr to force the alignment
+    enum { ControlBufferSize = (CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))
+                                + sizeof(quintptr) - 1) / sizeof(quintptr) };
+
+    const int count = qMin(maxCount, MaxDatagramBatch);
+    if (count <= 0)
+        return 0;
+
+    // we need to receive at least one byte, even if our user isn't interested in it
+    const int slotSize = int(maxSize < 0 ? MaxDatagramSize : qBound<qint64>(1, maxSize, MaxDatagramSize));
+    if (datagramPool.size() < count * slotSize)
+        datagramPool.resize(count * slotSize);
+    char *pool = datagramPool.data();
+
+    mmsghdr msgs[MaxDatagramBatch];
+    iovec vecs[MaxDatagramBatch];
+    qt_sockaddr addresses[MaxDatagramBatch];
+    quintptr cbufs[MaxDatagramBatch][ControlBufferSize];
+    memset(msgs, 0, count * sizeof(mmsghdr));
+    memset(addresses, 0, count * sizeof(qt_sockaddr));
+
+    const bool wantControl = options & (QAbstractSocketEngine::WantDatagramHopLimit
+                                        | QAbstractSocketEngine::WantDatagramDestination
+                                        | QAbstractSocketEngine::WantStreamNumber);
+    for (int i = 0; i < count; ++i) {
+        vecs[i].iov_base = pool + i * slotSize;
+        vecs[i].iov_len = slotSize;
+        msghdr &msg = msgs[i].msg_hdr;
+        msg.msg_iov = &vecs[i];
+        msg.msg_iovlen = 1;
+        if (options & QAbstractSocketEngine::WantDatagramSender) {
+            msg.msg_name = &addresses[i];
+            msg.msg_namelen = sizeof(qt_sockaddr);
+        }
+        if (wantControl) {
+            msg.msg_control = cbufs[i];
+            msg.msg_controllen = sizeof(cbufs[i]);
+        }
+    }
+
+    int received;
+    EINTR_LOOP(received, ::recvmmsg(socketDescriptor, msgs, count, 0, nullptr));
+
+    if (received == -1) {
+        switch (errno) {
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+        case EWOULDBLOCK:
+#endif
+        case EAGAIN:
+            // No datagram was available for reading
+            return 0;
+        case ECONNREFUSED:
+            setError(QAbstractSocket::ConnectionRefusedError, ConnectionRefusedErrorString);
+            break;
+        default:
+            setError(QAbstractSocket::NetworkError, ReceiveDatagramErrorString);
+        }
+        return -1;
+    }
+
+    for (int i = 0; i < received; ++i) {
+        QNetworkDatagramPrivate *datagram = datagrams[i];
+        const int size = maxSize ? int(qMin(msgs[i].msg_len, uint(slotSize))) : 0;
+        datagram->data = QByteArray(pool + i * slotSize, size);
+        if (options != QAbstractSocketEngine::WantNone)
+            qt_socket_getPacketHeader(&msgs[i].msg_hdr, &addresses[i], localPort, &datagram->header);
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeReceiveDatagrams(%p, %d, %lli) == %d",
+           datagrams, maxCount, maxSize, received);
+#endif
+
+    return received;
+}
+
+int QNativeSocketEnginePrivate::nativeSendDatagrams(const QNetworkDatagramPrivate *const *datagrams, int count)
+{
+    count = qMin(count, MaxDatagramBatch);
+
+    mmsghdr msgs[MaxDatagramBatch];
+    iovec vecs[MaxDatagramBatch];
+    qt_sockaddr addresses[MaxDatagramBatch];
+    quintptr cbufs[MaxDatagramBatch][DatagramControlBufferSize];
+    int segments[MaxDatagramBatch]; // datagrams per message
+
+#ifdef UDP_SEGMENT
+    if (udpSegmentationSupport == -1) {
+        // Older kernels silently ignore the UDP_SEGMENT message option,
+        // only use it if the socket option is known
+        int value = 0;
+        QT_SOCKOPTLEN_T valueSize = sizeof(value);
+        udpSegmentationSupport = ::getsockopt(socketDescriptor, SOL_UDP, UDP_SEGMENT,
+                                              &value, &valueSize) == 0;
+    }
+    bool segment = udpSegmentationSupport == 1;
+#else
+    const bool segment = false;
+#endif
+
+    for (;;) {
+        memset(msgs, 0, count * sizeof(mmsghdr));
+        memset(addresses, 0, count * sizeof(qt_sockaddr));
+
+        int messages = 0;
+        for (int i = 0; i < count; ) {
+            const QNetworkDatagramPrivate *first = datagrams[i];
+
+            // Consecutive datagrams of the same size (the last one may be
+            // shorter) to the same destination are sent as one message
+            // the kernel segments.
+            int n = 1;
+#ifdef UDP_SEGMENT
+            const int segmentSize = first->data.size();
+            qint64 payload = segmentSize;
+            while (segment && segmentSize > 0 && i + n < count && n < MaxUdpSegments) {
+                const QNetworkDatagramPrivate *next = datagrams[i + n];
+                const int size = next->data.size();
+                if (size == 0 || size > segmentSize || payload + size > MaxSegmentedPayload
+                    || !qt_sameDatagramRoute(first->header, next->header)) {
+                    break;
+                }
+                payload += size;
+                ++n;
+                if (size < segmentSize)
+                    break;
+            }
+#endif
+
+            for (int k = i; k < i + n; ++k) {
+                vecs[k].iov_base = const_cast<char *>(datagrams[k]->data.constData());
+                vecs[k].iov_len = datagrams[k]->data.size();
+            }
+            msghdr &msg = msgs[messages].msg_hdr;
+            msg.msg_iov = &vecs[i];
+            msg.msg_iovlen = n;
+            cmsghdr *cmsgptr = prepareDatagramMessage(&msg, &addresses[messages], cbufs[messages],
+                                                      first->header);
+#ifdef UDP_SEGMENT
+            if (n > 1) {
+                const quint16 size = quint16(segmentSize);
+                msg.msg_controllen += CMSG_SPACE(sizeof(size));
+                cmsgptr->cmsg_len = CMSG_LEN(sizeof(size));
+                cmsgptr->cmsg_level = SOL_UDP;
+                cmsgptr->cmsg_type = UDP_SEGMENT;
+                memcpy(CMSG_DATA(cmsgptr), &size, sizeof(size));
+            }
+#else
+            Q_UNUSED(cmsgptr);
+#endif
+            if (msg.msg_controllen == 0)
+                msg.msg_control = nullptr;
+
+            segments[messages++] = n;
+            i += n;
+        }
+
+        int sent;
+        EINTR_LOOP(sent, ::sendmmsg(socketDescriptor, msgs, messages, MSG_NOSIGNAL));
+
+        if (sent == -1) {
+#ifdef UDP_SEGMENT
+            if (segments[0] > 1 && (errno == EIO || errno == EINVAL)) {
+                // EIO: the device can't segment (no checksum offload),
+                // EINVAL: probably a segment larger than the MTU.
+                // Send them one by one.
+                if (errno == EIO)
+                    udpSegmentationSupport = 0;
+                segment = false;
+                continue;
+            }
+#endif
+            switch (errno) {
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+            case EWOULDBLOCK:
+#endif
+            case EAGAIN:
+                return 0;
+            case EMSGSIZE:
+                setError(QAbstractSocket::DatagramTooLargeError, DatagramTooLargeErrorString);
+                break;
+            case ECONNRESET:
+                setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+                break;
+            default:
+                setError(QAbstractSocket::NetworkError, SendDatagramErrorString);
+            }
+            return -1;
+        }
+
+        int datagramsSent = 0;
+        for (int m = 0; m < sent; ++m)
+            datagramsSent += segments[m];
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+        qDebug("QNativeSocketEnginePrivate::nativeSendDatagrams(%p, %d) == %d (%d messages)",
+               datagrams, count, datagramsSent, sent);
+#endif
+        return datagramsSent;
+    }
+}
+#endif // Q_OS_LINUX
+
 bool QNativeSocketEnginePrivate::fetchConnectionParameters()
 {
     localPort = 0;
@@ -1363,6 +1626,47 @@ qint64 QNativeSocketEnginePrivate::nativeWrite(const char *data, qint64 len)
 
     return qint64(writtenBytes);
 }
+
+qint64 QNativeSocketEnginePrivate::nativeWriteBlocks(const char *const *blocks, const qint64 *sizes, int count)
+{
+    Q_Q(QNativeSocketEngine);
+
+    QVarLengthArray<struct iovec, 16> vec(count);
+    for (int i = 0; i < count; ++i) {
+        vec[i].iov_base = const_cast<char *>(blocks[i]);
+        vec[i].iov_len = size_t(sizes[i]);
+    }
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = vec.data();
+    msg.msg_iovlen = count;
+
+    ssize_t writtenBytes = qt_safe_sendmsg(socketDescriptor, &msg, 0);
+
+    if (writtenBytes < 0) {
+        switch (errno) {
+        case EPIPE:
+        case ECONNRESET:
+            writtenBytes = -1;
+            setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+            q->close();
+            break;
+        case EAGAIN:
+            writtenBytes = 0;
+            break;
+        default:
+            break;
+        }
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeWriteBlocks(%d blocks) == %i",
+           count, (int) writtenBytes);
+#endif
+
+    return qint64(writtenBytes);
+}
 /*
 */
 qint64 QNativeSocketEnginePrivate::nativeRead(char *data, qint64 maxSize)
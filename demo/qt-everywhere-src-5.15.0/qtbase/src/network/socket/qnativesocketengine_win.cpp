@@ -1483,6 +1483,48 @@ qint64 QNativeSocketEnginePrivate::nativeWrite(const char *data, qint64 len)
     return ret;
 }
 
+qint64 QNativeSocketEnginePrivate::nativeWriteBlocks(const char *const *blocks, const qint64 *sizes, int count)
+{
+    Q_Q(QNativeSocketEngine);
+
+    QVarLengthArray<WSABUF, 16> bufs(count);
+    for (int i = 0; i < count; ++i) {
+        bufs[i].buf = const_cast<char *>(blocks[i]);
+        bufs[i].len = ULONG(sizes[i]);
+    }
+
+    DWORD flags = 0;
+    DWORD bytesWritten = 0;
+    qint64 ret = 0;
+    if (::WSASend(socketDescriptor, bufs.data(), DWORD(count), &bytesWritten, flags, 0, 0) != SOCKET_ERROR) {
+        ret = qint64(bytesWritten);
+    } else {
+        int err = WSAGetLastError();
+        // a full send buffer is not an error, the caller retries on the
+        // next write notification
+        if (err != WSAEWOULDBLOCK && err != WSAENOBUFS) {
+            WS_ERROR_DEBUG(err);
+            switch (err) {
+            case WSAECONNRESET:
+            case WSAECONNABORTED:
+                ret = -1;
+                setError(QAbstractSocket::NetworkError, WriteErrorString);
+                q->close();
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeWriteBlocks(%d blocks) == %lli",
+           count, ret);
+#endif
+
+    return ret;
+}
+
 qint64 QNativeSocketEnginePrivate::nativeRead(char *data, qint64 maxLength)
 {
     qint64 ret = -1;
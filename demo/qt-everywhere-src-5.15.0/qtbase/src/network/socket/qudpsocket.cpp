@@ -102,6 +102,9 @@
 #include "qnetworkdatagram.h"
 #include "qnetworkinterface.h"
 #include "qabstractsocket_p.h"
+#include "private/qnetworkdatagram_p.h"
+
+#include <qvarlengtharray.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -431,6 +434,119 @@ qint64 QUdpSocket::writeDatagram(const QNetworkDatagram &datagram)
     return sent;
 }
 
+/*!
+    \since 5.16
+
+    Sends the datagrams in \a datagrams, in order, like writeDatagram() does
+    for each of them. Where the operating system supports it (Linux), several
+    datagrams are passed to it in a single call, and consecutive datagrams of
+    the same size to the same destination may be handed to the kernel as one
+    message it segments.
+
+    Returns the number of datagrams sent, which is less than the size of \a
+    datagrams if the socket's send buffer is full, or -1 if an error occurred
+    before any datagram was sent. bytesWritten() is emitted once with the
+    total size of the datagrams sent.
+
+    \sa writeDatagram(), receiveDatagrams()
+*/
+int QUdpSocket::writeDatagrams(const QVector<QNetworkDatagram> &datagrams)
+{
+    Q_D(QUdpSocket);
+#if defined QUDPSOCKET_DEBUG
+    qDebug("QUdpSocket::writeDatagrams(%d datagrams)", datagrams.size());
+#endif
+    if (datagrams.isEmpty())
+        return 0;
+    if (!d->doEnsureInitialized(QHostAddress::Any, 0, datagrams.constFirst().destinationAddress()))
+        return -1;
+    if (state() == UnconnectedState)
+        bind();
+
+    QVarLengthArray<const QNetworkDatagramPrivate *, 64> privates(datagrams.size());
+    for (int i = 0; i < datagrams.size(); ++i)
+        privates[i] = datagrams.at(i).d;
+
+    int sent = 0;
+    while (sent < privates.size()) {
+        const int written = d->socketEngine->writeDatagrams(privates.constData() + sent,
+                                                            privates.size() - sent);
+        if (written < 0) {
+            d->setErrorAndEmit(d->socketEngine->error(), d->socketEngine->errorString());
+            if (!sent)
+                return -1;
+            break;
+        }
+        if (written == 0)
+            break;
+        sent += written;
+    }
+    d->cachedSocketDescriptor = d->socketEngine->socketDescriptor();
+
+    if (sent > 0) {
+        qint64 bytes = 0;
+        for (int i = 0; i < sent; ++i)
+            bytes += privates.at(i)->data.size();
+        emit bytesWritten(bytes);
+    }
+    return sent;
+}
+
+/*!
+    \since 5.16
+
+    Receives up to \a maxCount datagrams, each of them no larger than \a
+    maxSize bytes, and returns them along with their sender's host addresses
+    and ports, like receiveDatagram() does. Returns an empty vector if no
+    datagram is pending or an error occurred.
+
+    Where the operating system supports it (Linux), several datagrams are
+    received in a single call into buffers kept by the socket. As these
+    buffers are \a maxSize bytes per datagram (64 kB if \a maxSize is -1, the
+    default), pass the largest size you expect to bound their memory.
+
+    If a datagram is larger than \a maxSize, the rest of it is lost.
+
+    \sa receiveDatagram(), writeDatagrams(), hasPendingDatagrams()
+*/
+QVector<QNetworkDatagram> QUdpSocket::receiveDatagrams(int maxCount, qint64 maxSize)
+{
+    Q_D(QUdpSocket);
+
+#if defined QUDPSOCKET_DEBUG
+    qDebug("QUdpSocket::receiveDatagrams(%d, %lld)", maxCount, maxSize);
+#endif
+    QT_CHECK_BOUND("QUdpSocket::receiveDatagrams()", QVector<QNetworkDatagram>());
+
+    QVector<QNetworkDatagram> result;
+    if (maxCount <= 0)
+        return result;
+
+    result.resize(maxCount);
+    QVarLengthArray<QNetworkDatagramPrivate *, 64> privates(maxCount);
+    for (int i = 0; i < maxCount; ++i)
+        privates[i] = result[i].d;
+
+    int count = 0;
+    while (count < maxCount) {
+        const int readCount = d->socketEngine->readDatagrams(privates.constData() + count,
+                                                             maxCount - count, maxSize,
+                                                             QAbstractSocketEngine::WantAll);
+        if (readCount < 0) {
+            d->setErrorAndEmit(d->socketEngine->error(), d->socketEngine->errorString());
+            break;
+        }
+        if (readCount == 0)
+            break;
+        count += readCount;
+    }
+    d->hasPendingData = false;
+    d->socketEngine->setReadNotificationEnabled(true);
+
+    result.resize(count);
+    return result;
+}
+
 /*!
     \since 5.8
 
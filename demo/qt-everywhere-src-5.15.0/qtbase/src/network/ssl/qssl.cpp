@@ -176,6 +176,12 @@ Q_LOGGING_CATEGORY(lcSsl, "qt.network.ssl");
     chosen based on the servers preferences rather than the order ciphers were
     sent by the client. This option is only relevant to server sockets, and is
     only honored by the OpenSSL backend.
+    \value SslOptionEnableEarlyData When resuming a TLS 1.3 session with a
+    server accepting early data, sends data written before the handshake is
+    complete together with the first handshake message ("0-RTT"). Such data
+    can be replayed by an attacker, only enable this option for idempotent
+    requests. This option is only relevant to client sockets, and is only
+    honored by the OpenSSL backend. (Since Qt 5.16)
 
     By default, SslOptionDisableEmptyFragments is turned on since this causes
     problems with a large number of servers. SslOptionDisableLegacyRenegotiation
@@ -116,7 +116,8 @@ namespace QSsl {
         SslOptionDisableLegacyRenegotiation = 0x10,
         SslOptionDisableSessionSharing = 0x20,
         SslOptionDisableSessionPersistence = 0x40,
-        SslOptionDisableServerCipherPreference = 0x80
+        SslOptionDisableServerCipherPreference = 0x80,
+        SslOptionEnableEarlyData = 0x100
     };
     Q_DECLARE_FLAGS(SslOptions, SslOption)
 }
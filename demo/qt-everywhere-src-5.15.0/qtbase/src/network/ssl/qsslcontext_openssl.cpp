@@ -50,6 +50,7 @@
 #include "private/qsslsocket_openssl_symbols_p.h"
 #include "private/qssldiffiehellmanparameters_p.h"
 
+#include <algorithm>
 #include <vector>
 
 QT_BEGIN_NAMESPACE
@@ -87,10 +88,40 @@ static inline QString msgErrorSettingEllipticCurves(const QString &why)
     return QSslSocket::tr("Error when setting the elliptic curves (%1)").arg(why);
 }
 
+namespace {
+
+// Creating a client context is expensive, mostly because of the CA store;
+// keep a few recently used ones to share them between sockets:
+struct QSslContextPool
+{
+    struct Entry
+    {
+        bool allowRootCertOnDemandLoading;
+        QSslConfiguration configuration;
+        QSharedPointer<QSslContext> context;
+    };
+
+    QMutex mutex;
+    std::vector<Entry> entries; // Most recently used first.
+};
+
+Q_GLOBAL_STATIC(QSslContextPool, sslContextPool)
+
+const std::size_t maxPooledContexts = 16;
+const int maxCachedSessions = 64; // Per context.
+
+} // unnamed namespace
+
+QSslContext::CachedSession::~CachedSession()
+{
+    q_SSL_SESSION_free(session);
+}
+
 QSslContext::QSslContext()
     : ctx(nullptr),
     pkey(nullptr),
     session(nullptr),
+    peerSessions(maxCachedSessions),
     m_sessionTicketLifeTimeHint(-1)
 {
 }
@@ -122,6 +153,69 @@ QSharedPointer<QSslContext> QSslContext::sharedFromConfiguration(QSslSocket::Ssl
     return sslContext;
 }
 
+// Compares what goes into an SSL_CTX, ignoring the state of a connection
+// (peer certificates, negotiated protocol etc.) also kept in configurations.
+static bool isSameContextConfiguration(const QSslConfigurationPrivate &lhs,
+                                       const QSslConfigurationPrivate &rhs)
+{
+    return lhs.protocol == rhs.protocol
+           && lhs.sslOptions == rhs.sslOptions
+           && lhs.peerVerifyMode == rhs.peerVerifyMode
+           && lhs.peerVerifyDepth == rhs.peerVerifyDepth
+           && lhs.ciphers == rhs.ciphers
+           && lhs.ellipticCurves == rhs.ellipticCurves
+           && lhs.dhParams == rhs.dhParams
+           && lhs.caCertificates == rhs.caCertificates
+           && lhs.localCertificateChain == rhs.localCertificateChain
+           && lhs.privateKey == rhs.privateKey
+           && lhs.preSharedKeyIdentityHint == rhs.preSharedKeyIdentityHint
+           && lhs.nextAllowedProtocols == rhs.nextAllowedProtocols
+           && lhs.backendConfig == rhs.backendConfig
+           && lhs.ocspStaplingEnabled == rhs.ocspStaplingEnabled;
+}
+
+QSharedPointer<QSslContext> QSslContext::sharedFromPool(QSslSocket::SslMode mode, const QSslConfiguration &configuration, bool allowRootCertOnDemandLoading)
+{
+    // Server contexts are not shared, neither are contexts resuming a
+    // session the application explicitly set, or if sharing sessions
+    // was disabled.
+    if (mode != QSslSocket::SslClientMode || !configuration.sessionTicket().isEmpty()
+        || configuration.testSslOption(QSsl::SslOptionDisableSessionSharing)) {
+        return sharedFromConfiguration(mode, configuration, allowRootCertOnDemandLoading);
+    }
+
+    QSslContextPool *pool = sslContextPool();
+    if (!pool)
+        return sharedFromConfiguration(mode, configuration, allowRootCertOnDemandLoading);
+
+    {
+        const QMutexLocker locker(&pool->mutex);
+        auto &entries = pool->entries;
+        for (auto it = entries.begin(), end = entries.end(); it != end; ++it) {
+            if (it->allowRootCertOnDemandLoading == allowRootCertOnDemandLoading
+                && isSameContextConfiguration(*it->configuration.d, *configuration.d)) {
+                std::rotate(entries.begin(), it, it + 1);
+                return entries.front().context;
+            }
+        }
+    }
+
+    // Not under the lock, this is the expensive part:
+    QSharedPointer<QSslContext> sslContext = sharedFromConfiguration(mode, configuration, allowRootCertOnDemandLoading);
+    if (sslContext->error() != QSslError::NoError)
+        return sslContext;
+
+    sslContext->pooled = true;
+
+    const QMutexLocker locker(&pool->mutex);
+    auto &entries = pool->entries;
+    entries.insert(entries.begin(), {allowRootCertOnDemandLoading, configuration, sslContext});
+    if (entries.size() > maxPooledContexts)
+        entries.pop_back();
+
+    return sslContext;
+}
+
 #ifndef OPENSSL_NO_NEXTPROTONEG
 
 static int next_proto_cb(SSL *, unsigned char **out, unsigned char *outlen,
@@ -157,6 +251,7 @@ static int next_proto_cb(SSL *, unsigned char **out, unsigned char *outlen,
 
 QSslContext::NPNContext QSslContext::npnContext() const
 {
+    const QMutexLocker locker(&mutex);
     return m_npnContext;
 }
 #endif // !OPENSSL_NO_NEXTPROTONEG
@@ -164,19 +259,32 @@ QSslContext::NPNContext QSslContext::npnContext() const
 
 
 // Needs to be deleted by caller
-SSL* QSslContext::createSsl()
+SSL* QSslContext::createSsl(const QByteArray &peerKey)
 {
+    const QMutexLocker locker(&mutex);
+
     SSL* ssl = q_SSL_new(ctx);
     q_SSL_clear(ssl);
 
-    if (!session && !sessionASN1().isEmpty()
+    if (pooled) {
+        // Shared by connections to different peers, try a session
+        // we have for this one:
+        if (peerKey.size()) {
+            if (CachedSession *cached = peerSessions.object(peerKey)) {
+                if (!q_SSL_set_session(ssl, cached->session)) {
+                    qCWarning(lcSsl, "could not set SSL session");
+                    peerSessions.remove(peerKey);
+                }
+            }
+        }
+    } else if (!session && !m_sessionASN1.isEmpty()
             && !sslConfiguration.testSslOption(QSsl::SslOptionDisableSessionPersistence)) {
         const unsigned char *data = reinterpret_cast<const unsigned char *>(m_sessionASN1.constData());
         session = q_d2i_SSL_SESSION(nullptr, &data, m_sessionASN1.size());
         // 'session' has refcount 1 already, set by the function above
     }
 
-    if (session) {
+    if (session && !pooled) {
         // Try to resume the last session we cached
         if (!q_SSL_set_session(ssl, session)) {
             qCWarning(lcSsl, "could not set SSL session");
@@ -187,7 +295,9 @@ SSL* QSslContext::createSsl()
 
 #ifndef OPENSSL_NO_NEXTPROTONEG
     QList<QByteArray> protocols = sslConfiguration.d->nextAllowedProtocols;
-    if (!protocols.isEmpty()) {
+    // A pooled context can be in use by handshakes on other threads,
+    // its protocol list (never changing) is built only once.
+    if (!protocols.isEmpty() && (!pooled || m_supportedNPNVersions.isEmpty())) {
         m_supportedNPNVersions.clear();
         for (int a = 0; a < protocols.count(); ++a) {
             if (protocols.at(a).size() > 255) {
@@ -223,9 +333,25 @@ SSL* QSslContext::createSsl()
     return ssl;
 }
 
-// We cache exactly one session here
-bool QSslContext::cacheSession(SSL* ssl)
+// We cache exactly one session here (plus, for pooled
+// contexts, the last session per peer)
+bool QSslContext::cacheSession(SSL* ssl, const QByteArray &peerKey)
 {
+    const QMutexLocker locker(&mutex);
+
+    if (pooled && peerKey.size()) {
+        if (SSL_SESSION *peerSession = q_SSL_get1_session(ssl)) {
+#ifdef TLS1_3_VERSION
+            // With TLS 1.3 the session becomes resumable only when
+            // a NewSessionTicket arrives (and we're called again).
+            if (!q_SSL_SESSION_is_resumable(peerSession))
+                q_SSL_SESSION_free(peerSession);
+            else
+#endif // TLS1_3_VERSION
+                peerSessions.insert(peerKey, new CachedSession(peerSession));
+        }
+    }
+
     // don't cache the same session again
     if (session && session == q_SSL_get_session(ssl))
         return true;
@@ -254,16 +380,19 @@ bool QSslContext::cacheSession(SSL* ssl)
 
 QByteArray QSslContext::sessionASN1() const
 {
+    const QMutexLocker locker(&mutex);
     return m_sessionASN1;
 }
 
 void QSslContext::setSessionASN1(const QByteArray &session)
 {
+    const QMutexLocker locker(&mutex);
     m_sessionASN1 = session;
 }
 
 int QSslContext::sessionTicketLifeTimeHint() const
 {
+    const QMutexLocker locker(&mutex);
     return m_sessionTicketLifeTimeHint;
 }
 
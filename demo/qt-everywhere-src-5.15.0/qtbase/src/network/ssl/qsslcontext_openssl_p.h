@@ -54,6 +54,8 @@
 //
 
 #include <QtNetwork/private/qtnetworkglobal_p.h>
+#include <QtCore/qcache.h>
+#include <QtCore/qmutex.h>
 #include <QtCore/qvariant.h>
 #include <QtNetwork/qsslcertificate.h>
 #include <QtNetwork/qsslconfiguration.h>
@@ -75,12 +77,19 @@ public:
                                           bool allowRootCertOnDemandLoading);
     static QSharedPointer<QSslContext> sharedFromConfiguration(QSslSocket::SslMode mode, const QSslConfiguration &configuration,
                                                                bool allowRootCertOnDemandLoading);
+    // Same as above, but client contexts are taken from (and added to) a
+    // process-wide cache, so that QSslSockets with equal configurations
+    // share one SSL_CTX (and thus its CA store and its session cache):
+    static QSharedPointer<QSslContext> sharedFromPool(QSslSocket::SslMode mode, const QSslConfiguration &configuration,
+                                                      bool allowRootCertOnDemandLoading);
 
     QSslError::SslError error() const;
     QString errorString() const;
 
-    SSL* createSsl();
-    bool cacheSession(SSL*); // should be called when handshake completed
+    // 'peerKey' identifies the peer (host and port) sessions are
+    // cached for, see QSslContext::cacheSession.
+    SSL* createSsl(const QByteArray &peerKey = QByteArray());
+    bool cacheSession(SSL*, const QByteArray &peerKey = QByteArray()); // should be called when handshake completed
 
     QByteArray sessionASN1() const;
     void setSessionASN1(const QByteArray &sessionASN1);
@@ -109,10 +118,21 @@ private:
                                bool allowRootCertOnDemandLoading);
     static void applyBackendConfig(QSslContext *sslContext);
 
+    struct CachedSession
+    {
+        explicit CachedSession(SSL_SESSION *s) : session(s) {}
+        ~CachedSession();
+        SSL_SESSION *session;
+    };
+
 private:
     SSL_CTX* ctx;
     EVP_PKEY *pkey;
     SSL_SESSION *session;
+    // Sessions by peer, for contexts shared between sockets:
+    QCache<QByteArray, CachedSession> peerSessions;
+    bool pooled = false;
+    mutable QMutex mutex;
     QByteArray m_sessionASN1;
     int m_sessionTicketLifeTimeHint;
     QSslError::SslError errorCode;
@@ -530,7 +530,7 @@ bool QSslSocketBackendPrivate::initSslContext()
         // create a deep copy of our configuration
         QSslConfigurationPrivate *configurationCopy = new QSslConfigurationPrivate(configuration);
         configurationCopy->ref.storeRelaxed(0);              // the QSslConfiguration constructor refs up
-        sslContextPointer = QSslContext::sharedFromConfiguration(mode, configurationCopy, allowRootCertOnDemandLoading);
+        sslContextPointer = QSslContext::sharedFromPool(mode, configurationCopy, allowRootCertOnDemandLoading);
     }
 
     if (sslContextPointer->error() != QSslError::NoError) {
@@ -539,8 +539,17 @@ bool QSslSocketBackendPrivate::initSslContext()
         return false;
     }
 
+    sessionCacheKey.clear();
+    if (mode == QSslSocket::SslClientMode) {
+        QString peer = verificationPeerName.isEmpty() ? q->peerName() : verificationPeerName;
+        if (peer.isEmpty())
+            peer = hostName;
+        if (!peer.isEmpty())
+            sessionCacheKey = QUrl::toAce(peer) + ':' + QByteArray::number(q->peerPort());
+    }
+
     // Create and initialize SSL session
-    if (!(ssl = sslContextPointer->createSsl())) {
+    if (!(ssl = sslContextPointer->createSsl(sessionCacheKey))) {
         // ### Bad error code
         setErrorAndEmit(QAbstractSocket::SslInternalError,
                         QSslSocket::tr("Error creating SSL session, %1").arg(getErrorsFromOpenSsl()));
@@ -663,6 +672,7 @@ void QSslSocketBackendPrivate::destroySslContext()
         ssl = nullptr;
     }
     sslContextPointer.clear();
+    earlyDataSize = 0;
 }
 
 /*!
@@ -821,9 +831,28 @@ void QSslSocketPrivate::resetDefaultEllipticCurves()
 }
 
 #ifndef Q_OS_DARWIN // Apple implementation in qsslsocket_mac_shared.cpp
+namespace {
+// The system store is read and parsed once per process; every caller after
+// that gets a shallow copy of the same list.
+struct QSystemCaCertificateCache
+{
+    QMutex mutex;
+    QList<QSslCertificate> certificates;
+    bool loaded = false;
+};
+}
+
+Q_GLOBAL_STATIC(QSystemCaCertificateCache, systemCaCertificateCache)
+
 QList<QSslCertificate> QSslSocketPrivate::systemCaCertificates()
 {
     ensureInitialized();
+
+    QSystemCaCertificateCache *cache = systemCaCertificateCache();
+    const QMutexLocker locker(&cache->mutex);
+    if (cache->loaded)
+        return cache->certificates;
+
 #ifdef QSSLSOCKET_DEBUG
     QElapsedTimer timer;
     timer.start();
@@ -894,6 +923,8 @@ QList<QSslCertificate> QSslSocketPrivate::systemCaCertificates()
     qCDebug(lcSsl) << "imported " << systemCerts.count() << " certificates";
 #endif
 
+    cache->certificates = systemCerts;
+    cache->loaded = true;
     return systemCerts;
 }
 #endif // Q_OS_DARWIN
@@ -906,6 +937,11 @@ void QSslSocketBackendPrivate::startClientEncryption()
         return;
     }
 
+#ifdef TLS1_3_VERSION
+    if (configuration.sslOptions & QSsl::SslOptionEnableEarlyData)
+        writeEarlyData();
+#endif
+
     // Start connecting. This will place outgoing data in the BIO, so we
     // follow up with calling transmit().
     startHandshake();
@@ -1086,8 +1122,11 @@ void QSslSocketBackendPrivate::transmit()
         // We always read everything from the SSL decryption buffers, even if
         // we have a readBufferMaxSize. There's no point in leaving data there
         // just so that readBuffer.size() == readBufferMaxSize.
+        // Read up to a whole TLS record (16 KB of plain text) per call so that
+        // bulk transfers need a quarter of the SSL_read() calls and readyRead()
+        // emissions they did with 4 KB reads.
         int readBytes = 0;
-        const int bytesToRead = 4096;
+        const int bytesToRead = 16384;
         do {
             if (readChannelCount == 0) {
                 // The read buffer is deallocated, don't try resize or write to it.
@@ -1424,6 +1463,11 @@ int QSslSocketBackendPrivate::handleNewSessionTicket(SSL *connection)
 
     Q_ASSERT(connection);
 
+    // With TLS 1.3 a session can be resumed only after this ticket,
+    // give it to our context to (maybe) share it:
+    if (sslContextPointer && !(configuration.sslOptions & QSsl::SslOptionDisableSessionSharing))
+        sslContextPointer->cacheSession(connection, sessionCacheKey);
+
     if (q->sslConfiguration().testSslOption(QSsl::SslOptionDisableSessionPersistence)) {
         // We silently ignore, do nothing, remove from cache.
         return 0;
@@ -1889,7 +1933,7 @@ void QSslSocketBackendPrivate::continueHandshake()
 
     // Cache this SSL session inside the QSslContext
     if (!(configuration.sslOptions & QSsl::SslOptionDisableSessionSharing)) {
-        if (!sslContextPointer->cacheSession(ssl)) {
+        if (!sslContextPointer->cacheSession(ssl, sessionCacheKey)) {
             sslContextPointer.clear(); // we could not cache the session
         } else {
             // Cache the session for permanent usage as well
@@ -1934,14 +1978,70 @@ void QSslSocketBackendPrivate::continueHandshake()
             configuration.ephemeralServerKey = QSslKey(key, QSsl::PublicKey);
     }
 
+#ifdef TLS1_3_VERSION
+    const qint64 earlyDataWritten = settleEarlyData();
+#endif
+
     connectionEncrypted = true;
     emit q->encrypted();
+#ifdef TLS1_3_VERSION
+    if (earlyDataWritten > 0) {
+        if (!emittedBytesWritten) {
+            emittedBytesWritten = true;
+            emit q->bytesWritten(earlyDataWritten);
+            emittedBytesWritten = false;
+        }
+        emit q->channelBytesWritten(0, earlyDataWritten);
+    }
+#endif
     if (autoStartHandshake && pendingClose) {
         pendingClose = false;
         q->disconnectFromHost();
     }
 }
 
+#ifdef TLS1_3_VERSION
+// Sends the beginning of writeBuffer together with the ClientHello
+// if we are resuming a session whose server accepts early data.
+void QSslSocketBackendPrivate::writeEarlyData()
+{
+    Q_ASSERT(ssl);
+
+    SSL_SESSION *resumed = q_SSL_get_session(ssl);
+    if (!resumed || writeBuffer.isEmpty())
+        return;
+
+    const qint64 maxEarlyData = q_SSL_SESSION_get_max_early_data(resumed);
+    if (!maxEarlyData)
+        return;
+
+    QByteArray data(int(qMin(maxEarlyData, writeBuffer.size())), Qt::Uninitialized);
+    writeBuffer.peek(data.data(), data.size());
+    size_t written = 0;
+    if (q_SSL_write_early_data(ssl, data.constData(), size_t(data.size()), &written) != 1) {
+        // Not fatal, everything gets written once we are encrypted.
+        qCDebug(lcSsl) << "could not write early data:" << getErrorsFromOpenSsl();
+        return;
+    }
+
+    earlyDataSize = qint64(written);
+}
+
+// Returns the number of bytes the server accepted as early data (and
+// removes them from writeBuffer); rejected data is sent again by
+// transmit() as normal application data.
+qint64 QSslSocketBackendPrivate::settleEarlyData()
+{
+    const qint64 size = earlyDataSize;
+    earlyDataSize = 0;
+    if (!size || q_SSL_get_early_data_status(ssl) != SSL_EARLY_DATA_ACCEPTED)
+        return 0;
+
+    writeBuffer.free(size);
+    return size;
+}
+#endif // TLS1_3_VERSION
+
 bool QSslSocketPrivate::ensureLibraryLoaded()
 {
     if (!q_resolveOpenSslSymbols())
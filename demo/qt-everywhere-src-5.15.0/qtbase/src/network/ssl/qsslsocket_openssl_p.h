@@ -134,6 +134,11 @@ public:
 
     bool inSetAndEmitError = false;
 
+    // Client sessions are cached per peer ("host:port") in a shared context
+    QByteArray sessionCacheKey;
+    // Bytes from writeBuffer sent as TLS 1.3 early data
+    qint64 earlyDataSize = 0;
+
     // Platform specific functions
     void startClientEncryption() override;
     void startServerEncryption() override;
@@ -147,6 +152,10 @@ public:
     bool checkSslErrors();
     void storePeerCertificates();
     int handleNewSessionTicket(SSL *context);
+#ifdef TLS1_3_VERSION
+    void writeEarlyData();
+    qint64 settleEarlyData();
+#endif
     unsigned int tlsPskClientCallback(const char *hint, char *identity, unsigned int max_identity_len, unsigned char *psk, unsigned int max_psk_len);
     unsigned int tlsPskServerCallback(const char *identity, unsigned char *psk, unsigned int max_psk_len);
 #ifdef Q_OS_WIN
@@ -161,6 +161,9 @@ DEFINEFUNC2(int, SSL_CTX_set_ciphersuites, SSL_CTX *ctx, ctx, const char *str, s
 DEFINEFUNC2(void, SSL_set_psk_use_session_callback, SSL *ssl, ssl, q_SSL_psk_use_session_cb_func_t callback, callback, return, DUMMYARG)
 DEFINEFUNC2(void, SSL_CTX_sess_set_new_cb, SSL_CTX *ctx, ctx, NewSessionCallback cb, cb, return, return)
 DEFINEFUNC(int, SSL_SESSION_is_resumable, const SSL_SESSION *s, s, return 0, return)
+DEFINEFUNC(uint32_t, SSL_SESSION_get_max_early_data, const SSL_SESSION *s, s, return 0, return)
+DEFINEFUNC4(int, SSL_write_early_data, SSL *ssl, ssl, const void *buf, buf, size_t num, num, size_t *written, written, return 0, return)
+DEFINEFUNC(int, SSL_get_early_data_status, const SSL *ssl, ssl, return 0, return)
 #endif
 DEFINEFUNC3(size_t, SSL_get_client_random, SSL *a, a, unsigned char *out, out, size_t outlen, outlen, return 0, return)
 DEFINEFUNC3(size_t, SSL_SESSION_get_master_key, const SSL_SESSION *ses, ses, unsigned char *out, out, size_t outlen, outlen, return 0, return)
@@ -848,6 +851,9 @@ bool q_resolveOpenSslSymbols()
     RESOLVEFUNC(SSL_set_psk_use_session_callback)
     RESOLVEFUNC(SSL_CTX_sess_set_new_cb)
     RESOLVEFUNC(SSL_SESSION_is_resumable)
+    RESOLVEFUNC(SSL_SESSION_get_max_early_data)
+    RESOLVEFUNC(SSL_write_early_data)
+    RESOLVEFUNC(SSL_get_early_data_status)
 #endif // TLS 1.3 or OpenSSL > 1.1.1
 
     RESOLVEFUNC(SSL_get_client_random)
@@ -300,6 +300,11 @@ using NewSessionCallback = int (*)(SSL *, SSL_SESSION *);
 void q_SSL_CTX_sess_set_new_cb(SSL_CTX *ctx, NewSessionCallback cb);
 int q_SSL_SESSION_is_resumable(const SSL_SESSION *s);
 
+// TLS 1.3 early data ("0-RTT"), OpenSSL 1.1.1:
+uint32_t q_SSL_SESSION_get_max_early_data(const SSL_SESSION *s);
+int q_SSL_write_early_data(SSL *ssl, const void *buf, size_t num, size_t *written);
+int q_SSL_get_early_data_status(const SSL *ssl);
+
 #define q_SSL_CTX_set_session_cache_mode(ctx,m) \
     q_SSL_CTX_ctrl(ctx,SSL_CTRL_SET_SESS_CACHE_MODE,m,NULL)
 
@@ -396,7 +396,65 @@ static inline bool requiresOpenType(int writingSystem)
             || writingSystem == QFontDatabase::Khmer || writingSystem == QFontDatabase::Nko);
 }
 
-static void populateFromPattern(FcPattern *pattern)
+// Extra family names can be aliases or subfamilies. Returns whether the
+// family name at index \a k is a subfamily, which gets registered as a
+// separate font so that only its members are matched when it is requested.
+static bool isSubfamily(FcPattern *pattern, int k, const QString &styleName,
+                        const QString &familyNameLang, QString *altStyleName)
+{
+    FcChar8 *value = nullptr;
+    if (FcPatternGetString(pattern, FC_STYLE, k, &value) == FcResultMatch)
+        *altStyleName = QString::fromUtf8((const char *)value);
+    else
+        *altStyleName = styleName;
+
+    QString altFamilyNameLang;
+    if (FcPatternGetString(pattern, FC_FAMILYLANG, k, &value) == FcResultMatch)
+        altFamilyNameLang = QString::fromUtf8((const char *)value);
+    else
+        altFamilyNameLang = familyNameLang;
+
+    return familyNameLang == altFamilyNameLang && *altStyleName != styleName;
+}
+
+// Registers the families and aliases named by \a pattern without any of
+// their fonts, and remembers the pattern for when a family gets populated.
+static void registerFamiliesFromPattern(FcPattern *pattern, QHash<QString, QVector<FcPattern *> > *pendingFamilies)
+{
+    FcChar8 *value = nullptr;
+    if (FcPatternGetString(pattern, FC_FAMILY, 0, &value) != FcResultMatch)
+        return;
+
+    const QString familyName = QString::fromUtf8((const char *)value);
+    QString familyNameLang;
+    if (FcPatternGetString(pattern, FC_FAMILYLANG, 0, &value) == FcResultMatch)
+        familyNameLang = QString::fromUtf8((const char *)value);
+    QString styleName;
+    if (FcPatternGetString(pattern, FC_STYLE, 0, &value) == FcResultMatch)
+        styleName = QString::fromUtf8((const char *)value);
+
+    const auto addPattern = [pattern, pendingFamilies](const QString &family) {
+        QVector<FcPattern *> &patterns = (*pendingFamilies)[family];
+        if (patterns.isEmpty())
+            QPlatformFontDatabase::registerFontFamily(family);
+        patterns.append(pattern);
+    };
+
+    addPattern(familyName);
+    for (int k = 1; FcPatternGetString(pattern, FC_FAMILY, k, &value) == FcResultMatch; ++k) {
+        const QString altFamilyName = QString::fromUtf8((const char *)value);
+        QString altStyleName;
+        if (isSubfamily(pattern, k, styleName, familyNameLang, &altStyleName))
+            addPattern(altFamilyName);
+        else
+            QPlatformFontDatabase::registerAliasToFontFamily(familyName, altFamilyName);
+    }
+}
+
+// Registers the font described by \a pattern. If \a requestedFamily is not
+// empty, only registers it for that family; aliases have been registered
+// when the families were listed.
+static void populateFromPattern(FcPattern *pattern, const QString &requestedFamily = QString())
 {
     QString familyName;
     QString familyNameLang;
@@ -506,39 +564,46 @@ static void populateFromPattern(FcPattern *pattern)
     // Note: stretch should really be an int but registerFont incorrectly uses an enum
     QFont::Stretch stretch = QFont::Stretch(stretchFromFcWidth(width_value));
     QString styleName = style_value ? QString::fromUtf8((const char *) style_value) : QString();
-    QPlatformFontDatabase::registerFont(familyName,styleName,QLatin1String((const char *)foundry_value),weight,style,stretch,antialias,scalable,pixel_size,fixedPitch,writingSystems,fontFile);
+    const bool registerPrimary = requestedFamily.isEmpty() || requestedFamily == familyName;
+    if (registerPrimary)
+        QPlatformFontDatabase::registerFont(familyName,styleName,QLatin1String((const char *)foundry_value),weight,style,stretch,antialias,scalable,pixel_size,fixedPitch,writingSystems,fontFile);
 //        qDebug() << familyName << (const char *)foundry_value << weight << style << &writingSystems << scalable << true << pixel_size;
 
     for (int k = 1; FcPatternGetString(pattern, FC_FAMILY, k, &value) == FcResultMatch; ++k) {
         const QString altFamilyName = QString::fromUtf8((const char *)value);
-        // Extra family names can be aliases or subfamilies.
-        // If it is a subfamily, register it as a separate font, so only members of the subfamily are
-        // matched when the subfamily is requested.
         QString altStyleName;
-        if (FcPatternGetString(pattern, FC_STYLE, k, &value) == FcResultMatch)
-            altStyleName = QString::fromUtf8((const char *)value);
-        else
-            altStyleName = styleName;
-
-        QString altFamilyNameLang;
-        if (FcPatternGetString(pattern, FC_FAMILYLANG, k, &value) == FcResultMatch)
-            altFamilyNameLang = QString::fromUtf8((const char *)value);
-        else
-            altFamilyNameLang = familyNameLang;
-
-        if (familyNameLang == altFamilyNameLang && altStyleName != styleName) {
+        if (isSubfamily(pattern, k, styleName, familyNameLang, &altStyleName)) {
+            if (!requestedFamily.isEmpty() && requestedFamily != altFamilyName)
+                continue;
             FontFile *altFontFile = new FontFile(*fontFile);
             QPlatformFontDatabase::registerFont(altFamilyName, altStyleName, QLatin1String((const char *)foundry_value),weight,style,stretch,antialias,scalable,pixel_size,fixedPitch,writingSystems,altFontFile);
-        } else {
+        } else if (requestedFamily.isEmpty()) {
             QPlatformFontDatabase::registerAliasToFontFamily(familyName, altFamilyName);
         }
     }
 
+    if (!registerPrimary)
+        delete fontFile;
+}
+
+QFontconfigDatabase::~QFontconfigDatabase()
+{
+    releasePendingFamilies();
+}
+
+void QFontconfigDatabase::releasePendingFamilies()
+{
+    m_pendingFamilies.clear();
+    if (m_fontSet) {
+        FcFontSetDestroy(m_fontSet);
+        m_fontSet = nullptr;
+    }
 }
 
 void QFontconfigDatabase::populateFontDatabase()
 {
     FcInit();
+    releasePendingFamilies();
     FcFontSet  *fonts;
 
     {
@@ -564,10 +629,12 @@ void QFontconfigDatabase::populateFontDatabase()
         FcPatternDestroy(pattern);
     }
 
+    // Only register the family names for now. Going through the writing
+    // systems and styles of every installed font is what makes populating
+    // slow, and most applications only ever use a few families.
     for (int i = 0; i < fonts->nfont; i++)
-        populateFromPattern(fonts->fonts[i]);
-
-    FcFontSetDestroy (fonts);
+        registerFamiliesFromPattern(fonts->fonts[i], &m_pendingFamilies);
+    m_fontSet = fonts;
 
     struct FcDefaultFont {
         const char *qtname;
@@ -602,10 +669,23 @@ void QFontconfigDatabase::populateFontDatabase()
 //    QApplication::setFont(font);
 }
 
+void QFontconfigDatabase::populateFamily(const QString &familyName)
+{
+    const auto it = m_pendingFamilies.find(familyName);
+    if (it == m_pendingFamilies.end())
+        return;
+
+    const QVector<FcPattern *> patterns = it.value();
+    m_pendingFamilies.erase(it);
+    for (FcPattern *pattern : patterns)
+        populateFromPattern(pattern, familyName);
+}
+
 void QFontconfigDatabase::invalidate()
 {
     // Clear app fonts.
     FcConfigAppFontClear(nullptr);
+    releasePendingFamilies();
 }
 
 QFontEngineMulti *QFontconfigDatabase::fontEngineMulti(QFontEngine *fontEngine, QChar::Script script)
@@ -859,6 +939,10 @@ QStringList QFontconfigDatabase::addApplicationFont(const QByteArray &fontData,
             QString family = QString::fromUtf8(reinterpret_cast<const char *>(fam));
             families << family;
         }
+        // Populate the system fonts of the families first, registering the
+        // application font would mark them as populated.
+        for (int k = 0; FcPatternGetString(pattern, FC_FAMILY, k, &fam) == FcResultMatch; ++k)
+            populateFamily(QString::fromUtf8(reinterpret_cast<const char *>(fam)));
         populateFromPattern(pattern);
 
         FcFontSetAdd(set, pattern);
@@ -54,6 +54,12 @@
 #include <qpa/qplatformfontdatabase.h>
 #include <QtFontDatabaseSupport/private/qfreetypefontdatabase_p.h>
 
+#include <QtCore/qhash.h>
+#include <QtCore/qvector.h>
+
+typedef struct _FcPattern FcPattern;
+typedef struct _FcFontSet FcFontSet;
+
 QT_BEGIN_NAMESPACE
 
 class QFontEngineFT;
@@ -61,7 +67,9 @@ class QFontEngineFT;
 class QFontconfigDatabase : public QFreeTypeFontDatabase
 {
 public:
+    ~QFontconfigDatabase();
     void populateFontDatabase() override;
+    void populateFamily(const QString &familyName) override;
     void invalidate() override;
     QFontEngineMulti *fontEngineMulti(QFontEngine *fontEngine, QChar::Script script) override;
     QFontEngine *fontEngine(const QFontDef &fontDef, void *handle) override;
@@ -73,6 +81,11 @@ public:
 
 private:
     void setupFontEngine(QFontEngineFT *engine, const QFontDef &fontDef) const;
+    void releasePendingFamilies();
+
+    // The listed system fonts, and the ones of each family that is not populated yet
+    FcFontSet *m_fontSet = nullptr;
+    QHash<QString, QVector<FcPattern *> > m_pendingFamilies;
 };
 
 QT_END_NAMESPACE
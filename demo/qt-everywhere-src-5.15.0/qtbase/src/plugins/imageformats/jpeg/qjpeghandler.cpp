@@ -377,6 +377,26 @@ static bool read_jpeg_image(QImage *outImage,
 
             (void) jpeg_start_decompress(info);
 
+            int clipX = clip.x();
+#if defined(LIBJPEG_TURBO_VERSION_NUMBER) && LIBJPEG_TURBO_VERSION_NUMBER >= 2001000
+            // Only decompress the columns of the iMCUs covering the clip
+            // region, and skip the rows above it without running the IDCT.
+            // Fancy upsampling interpolates chroma from the neighbouring
+            // samples, so keep a margin for the clipped pixels to come out
+            // the same as when decompressing the whole width.
+            if (clip != imageRect) {
+                const int margin = info->do_fancy_upsampling ? 16 : 0;
+                const int left = qMax(0, clip.x() - margin);
+                const int right = qMin(imageRect.width(), clip.x() + clip.width() + margin);
+                JDIMENSION xoffset = left;
+                JDIMENSION width = right - left;
+                jpeg_crop_scanline(info, &xoffset, &width);
+                clipX -= int(xoffset);
+                if (clip.y() > 0)
+                    (void) jpeg_skip_scanlines(info, clip.y());
+            }
+#endif
+
             while (info->output_scanline < info->output_height) {
                 int y = int(info->output_scanline) - clip.y();
                 if (y >= clip.height())
@@ -388,12 +408,12 @@ static bool read_jpeg_image(QImage *outImage,
                     continue;   // Haven't reached the starting line yet.
 
                 if (info->output_components == 3) {
-                    uchar *in = rows[0] + clip.x() * 3;
+                    uchar *in = rows[0] + clipX * 3;
                     QRgb *out = (QRgb*)outImage->scanLine(y);
                     converter(out, in, clip.width());
                 } else if (info->out_color_space == JCS_CMYK) {
                     // Convert CMYK->RGB.
-                    uchar *in = rows[0] + clip.x() * 4;
+                    uchar *in = rows[0] + clipX * 4;
                     QRgb *out = (QRgb*)outImage->scanLine(y);
                     for (int i = 0; i < clip.width(); ++i) {
                         int k = in[3];
@@ -404,7 +424,7 @@ static bool read_jpeg_image(QImage *outImage,
                 } else if (info->output_components == 1) {
                     // Grayscale.
                     memcpy(outImage->scanLine(y),
-                           rows[0] + clip.x(), clip.width());
+                           rows[0] + clipX, clip.width());
                 }
             }
         } else {
@@ -43,6 +43,7 @@
 #include <qvariant.h>
 #include <qdatetime.h>
 #include <qregularexpression.h>
+#include <qsqlcolumnbatch.h>
 #include <qsqlerror.h>
 #include <qsqlfield.h>
 #include <qsqlindex.h>
@@ -143,6 +144,7 @@ protected:
     QVariant lastInsertId() const override;
     bool prepare(const QString &query) override;
     bool exec() override;
+    bool execBatch(bool arrayBind = false) override;
 };
 
 class QPSQLDriverPrivate final : public QSqlDriverPrivate
@@ -302,6 +304,11 @@ public:
     bool preparedQueriesEnabled = false;
 
     bool processResults();
+    bool fetchColumnBatch(QSqlColumnBatch &batch, int maxRows);
+#ifdef LIBPQ_HAS_PIPELINING
+    bool execPipelinedBatch(const QVector<QVariantList> &columns, int rowCount);
+    bool drainPipeline(int sentQueries, PGresult **lastResult, PGresult **errorResult);
+#endif
 };
 
 static QSqlError qMakeError(const QString &err, QSqlError::ErrorType type,
@@ -623,6 +630,23 @@ bool QPSQLResult::nextResult()
     return d->processResults();
 }
 
+static bool qParseDouble(const char *val, double *dbl)
+{
+    bool ok;
+    *dbl = qstrtod(val, nullptr, &ok);
+    if (!ok) {
+        if (qstricmp(val, "NaN") == 0)
+            *dbl = qQNaN();
+        else if (qstricmp(val, "Infinity") == 0)
+            *dbl = qInf();
+        else if (qstricmp(val, "-Infinity") == 0)
+            *dbl = -qInf();
+        else
+            return false;
+    }
+    return true;
+}
+
 QVariant QPSQLResult::data(int i)
 {
     Q_D(const QPSQLResult);
@@ -653,18 +677,9 @@ QVariant QPSQLResult::data(int i)
             if (numericalPrecisionPolicy() == QSql::HighPrecision)
                 return QString::fromLatin1(val);
         }
-        bool ok;
-        double dbl = qstrtod(val, nullptr, &ok);
-        if (!ok) {
-            if (qstricmp(val, "NaN") == 0)
-                dbl = qQNaN();
-            else if (qstricmp(val, "Infinity") == 0)
-                dbl = qInf();
-            else if (qstricmp(val, "-Infinity") == 0)
-                dbl = -qInf();
-            else
-                return QVariant();
-        }
+        double dbl;
+        if (!qParseDouble(val, &dbl))
+            return QVariant();
         if (ptype == QNUMERICOID) {
             if (numericalPrecisionPolicy() == QSql::LowPrecisionInt64)
                 return QVariant((qlonglong)dbl);
@@ -842,9 +857,71 @@ QSqlRecord QPSQLResult::record() const
     return info;
 }
 
+bool QPSQLResultPrivate::fetchColumnBatch(QSqlColumnBatch &batch, int maxRows)
+{
+    Q_Q(QPSQLResult);
+    const int columnCount = PQnfields(result);
+    QVector<QSqlColumnBatch::ColumnType> types(columnCount);
+    for (int i = 0; i < columnCount; ++i)
+        types[i] = QSqlColumnBatch::columnTypeFor(qDecodePSQLType(PQftype(result, i)));
+    batch.reset(types);
+
+    const bool isUtf8 = drv_d_func()->isUtf8;
+    while (batch.rowCount() < maxRows) {
+        if (!q->fetchNext()) {
+            q->setAt(QSql::AfterLastRow);
+            break;
+        }
+        // in forward-only mode each row comes in a result of its own
+        const int row = q->isForwardOnly() ? 0 : q->at();
+        for (int i = 0; i < columnCount; ++i) {
+            if (PQgetisnull(result, row, i)) {
+                batch.appendValue(i, QVariant(qDecodePSQLType(PQftype(result, i))));
+                continue;
+            }
+            const char *val = PQgetvalue(result, row, i);
+            switch (types.at(i)) {
+            case QSqlColumnBatch::Int64Column:
+                if (PQftype(result, i) == QBOOLOID) {
+                    batch.appendInt64(i, val[0] == 't');
+                } else {
+                    bool ok;
+                    const qint64 value = qstrtoll(val, nullptr, 10, &ok);
+                    if (ok)
+                        batch.appendInt64(i, value);
+                    else
+                        batch.appendNull(i);
+                }
+                break;
+            case QSqlColumnBatch::DoubleColumn: {
+                double dbl;
+                if (qParseDouble(val, &dbl))
+                    batch.appendDouble(i, dbl);
+                else
+                    batch.appendNull(i);
+                break;
+            }
+            case QSqlColumnBatch::StringColumn:
+                batch.appendString(i, isUtf8 ? QString::fromUtf8(val) : QString::fromLatin1(val));
+                break;
+            case QSqlColumnBatch::VariantColumn:
+                batch.appendValue(i, q->data(i));
+                break;
+            }
+        }
+    }
+    return true;
+}
+
 void QPSQLResult::virtual_hook(int id, void *data)
 {
     Q_ASSERT(data);
+    Q_D(QPSQLResult);
+    if (id == FetchColumnBatch) {
+        auto fetch = static_cast<QSqlColumnBatchFetch *>(data);
+        fetch->handled = d->fetchColumnBatch(*fetch->batch, fetch->maxRows);
+        return;
+    }
     QSqlResult::virtual_hook(id, data);
 }
 
@@ -938,6 +1015,173 @@ bool QPSQLResult::exec()
     return d->processResults();
 }
 
+bool QPSQLResult::execBatch(bool arrayBind)
+{
+#ifdef LIBPQ_HAS_PIPELINING
+    Q_D(QPSQLResult);
+    if (!d->preparedQueriesEnabled || d->preparedStmtId.isEmpty())
+        return QSqlResult::execBatch(arrayBind);
+
+    const QVector<QVariant> values = boundValues();
+    if (values.isEmpty())
+        return false;
+
+    QVector<QVariantList> columns;
+    columns.reserve(values.size());
+    for (const QVariant &value : values)
+        columns.append(value.toList());
+    const int rowCount = columns.constFirst().size();
+    if (rowCount == 0)
+        return true;
+
+    return d->execPipelinedBatch(columns, rowCount);
+#else
+    return QSqlResult::execBatch(arrayBind);
+#endif
+}
+
+#ifdef LIBPQ_HAS_PIPELINING
+// Number of EXECUTE statements sent before each pipeline sync point. The
+// connection stays in blocking mode, so this also bounds how much the server
+// can queue up for us while we are still writing.
+static const int BatchChunkSize = 256;
+
+bool QPSQLResultPrivate::execPipelinedBatch(const QVector<QVariantList> &columns, int rowCount)
+{
+    Q_Q(QPSQLResult);
+    QPSQLDriverPrivate *drv = drv_d_func();
+    q->cleanup();
+
+    // Statements between two sync points run in one implicit transaction, so
+    // a batch that needs several of them is wrapped in an explicit one to
+    // keep the whole batch atomic.
+    const bool ownTransaction = rowCount > BatchChunkSize
+            && PQtransactionStatus(drv->connection) == PQTRANS_IDLE;
+    if (ownTransaction) {
+        PGresult *res = drv->exec("BEGIN");
+        const bool ok = PQresultStatus(res) == PGRES_COMMAND_OK;
+        if (!ok) {
+            q->setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                            "Unable to begin batch transaction"), QSqlError::TransactionError, drv, res));
+        }
+        PQclear(res);
+        if (!ok)
+            return false;
+    }
+
+    // Like sendQuery(), this discards the results of any other forward-only
+    // query still running on this connection.
+    drv->discardResults();
+    drv->currentStmtId = InvalidStatementId;
+    if (PQenterPipelineMode(drv->connection) != 1) {
+        if (ownTransaction)
+            PQclear(drv->exec("ROLLBACK"));
+        return q->QSqlResult::execBatch();
+    }
+
+    PGresult *lastResult = nullptr;
+    PGresult *errorResult = nullptr;
+    bool ok = true;
+    QVector<QVariant> row(columns.size());
+    int sentQueries = 0;
+    for (int i = 0; i < rowCount && ok; ++i) {
+        for (int j = 0; j < columns.size(); ++j)
+            row[j] = columns.at(j).value(i);
+        const QString params = qCreateParamString(row, q->driver());
+        const QString stmt = params.isEmpty()
+                ? QStringLiteral("EXECUTE %1").arg(preparedStmtId)
+                : QStringLiteral("EXECUTE %1 (%2)").arg(preparedStmtId, params);
+        const QByteArray encoded = drv->isUtf8 ? stmt.toUtf8() : stmt.toLocal8Bit();
+        if (!PQsendQueryParams(drv->connection, encoded.constData(), 0,
+                               nullptr, nullptr, nullptr, nullptr, 0)) {
+            ok = false;
+            break;
+        }
+        ++sentQueries;
+        if (sentQueries == BatchChunkSize || i == rowCount - 1) {
+            ok = PQpipelineSync(drv->connection) == 1
+                    && drainPipeline(sentQueries, &lastResult, &errorResult);
+            sentQueries = 0;
+        }
+    }
+    if (!ok && sentQueries > 0) {
+        // Flush what was queued before the failure so that we can leave
+        // pipeline mode cleanly.
+        if (PQpipelineSync(drv->connection) == 1)
+            drainPipeline(sentQueries, &lastResult, &errorResult);
+    }
+    PQexitPipelineMode(drv->connection);
+    drv->checkPendingNotifications();
+
+    if (ownTransaction) {
+        PGresult *res = drv->exec(ok ? "COMMIT" : "ROLLBACK");
+        if (ok && PQresultStatus(res) != PGRES_COMMAND_OK) {
+            ok = false;
+            if (!errorResult) {
+                errorResult = res;
+                res = nullptr;
+            }
+        }
+        PQclear(res);
+    }
+
+    if (!ok) {
+        PQclear(lastResult);
+        q->setSelect(false);
+        q->setActive(false);
+        q->setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                        "Unable to execute batch statement"), QSqlError::StatementError, drv, errorResult));
+        PQclear(errorResult);
+        return false;
+    }
+
+    result = lastResult;
+    return processResults();
+}
+
+// Reads the results of sentQueries queries up to and including the
+// pipeline sync point that follows them. The result of the last successful
+// query is kept in lastResult, the first error in errorResult.
+bool QPSQLResultPrivate::drainPipeline(int sentQueries, PGresult **lastResult, PGresult **errorResult)
+{
+    QPSQLDriverPrivate *drv = drv_d_func();
+    bool ok = true;
+    // Every query's results are terminated by a null result, the sync point
+    // is not; anything beyond that means the connection went away.
+    int remainingQueries = sentQueries;
+    forever {
+        PGresult *res = PQgetResult(drv->connection);
+        if (!res) {
+            if (--remainingQueries < 0)
+                return false;
+            continue;
+        }
+        switch (PQresultStatus(res)) {
+        case PGRES_PIPELINE_SYNC:
+            PQclear(res);
+            return ok;
+        case PGRES_COMMAND_OK:
+        case PGRES_TUPLES_OK:
+            PQclear(*lastResult);
+            *lastResult = res;
+            break;
+        case PGRES_PIPELINE_ABORTED:
+            // Skipped because an earlier statement of this batch failed
+            PQclear(res);
+            ok = false;
+            break;
+        default:
+            if (!*errorResult)
+                *errorResult = res;
+            else
+                PQclear(res);
+            ok = false;
+            break;
+        }
+    }
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////
 
 bool QPSQLDriverPrivate::setEncodingUtf8()
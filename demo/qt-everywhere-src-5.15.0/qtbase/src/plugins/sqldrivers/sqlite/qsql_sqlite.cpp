@@ -46,13 +46,14 @@
 #include <qsqlfield.h>
 #include <qsqlindex.h>
 #include <qsqlquery.h>
+#include <qsqlcolumnbatch.h>
 #include <QtSql/private/qsqlcachedresult_p.h>
 #include <QtSql/private/qsqldriver_p.h>
 #include <qstringlist.h>
 #include <qvector.h>
 #include <qdebug.h>
-#if QT_CONFIG(regularexpression)
 #include <qcache.h>
+#if QT_CONFIG(regularexpression)
 #include <qregularexpression.h>
 #endif
 #include <QScopedValueRollback>
@@ -139,6 +140,19 @@ protected:
     void virtual_hook(int id, void *data) override;
 };
 
+// Owns a prepared statement while it is kept in the driver's statement cache
+class QSQLiteStatement
+{
+public:
+    explicit QSQLiteStatement(sqlite3_stmt *stmt) : stmt(stmt) {}
+    ~QSQLiteStatement() { sqlite3_finalize(stmt); }
+    sqlite3_stmt *take() { return qExchange(stmt, nullptr); }
+
+private:
+    Q_DISABLE_COPY(QSQLiteStatement)
+    sqlite3_stmt *stmt;
+};
+
 class QSQLiteDriverPrivate : public QSqlDriverPrivate
 {
     Q_DECLARE_PUBLIC(QSQLiteDriver)
@@ -148,6 +162,9 @@ public:
     sqlite3 *access = nullptr;
     QVector<QSQLiteResult *> results;
     QStringList notificationid;
+    // statements of finished queries, keyed by their SQL; disabled unless
+    // QSQLITE_STATEMENT_CACHE_SIZE is set
+    QCache<QString, QSQLiteStatement> statementCache{0};
 };
 
 
@@ -160,11 +177,15 @@ public:
     using QSqlCachedResultPrivate::QSqlCachedResultPrivate;
     void cleanup();
     bool fetchNext(QSqlCachedResult::ValueCache &values, int idx, bool initialFetch);
+    QVariant columnValue(int column) const;
+    bool fetchColumnBatch(QSqlColumnBatch &batch, int maxRows);
     // initializes the recordInfo and the cache
     void initColumns(bool emptyResultset);
     void finalize();
+    void releaseStatement();
 
     sqlite3_stmt *stmt = nullptr;
+    QString stmtQuery;
     QSqlRecord rInf;
     QVector<QVariant> firstRow;
     bool skippedStatus = false; // the status of the fetchNext() that's skipped
@@ -174,7 +195,7 @@ public:
 void QSQLiteResultPrivate::cleanup()
 {
     Q_Q(QSQLiteResult);
-    finalize();
+    releaseStatement();
     rInf.clear();
     skippedStatus = false;
     skipRow = false;
@@ -192,6 +213,24 @@ void QSQLiteResultPrivate::finalize()
     stmt = 0;
 }
 
+void QSQLiteResultPrivate::releaseStatement()
+{
+    if (!stmt)
+        return;
+
+    QSQLiteDriverPrivate *drv = drv_d_func();
+    if (drv && drv->statementCache.maxCost() > 0) {
+        // Keep the compiled statement around for the next query with the
+        // same SQL on this connection
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+        drv->statementCache.insert(stmtQuery, new QSQLiteStatement(stmt));
+        stmt = nullptr;
+        return;
+    }
+    finalize();
+}
+
 void QSQLiteResultPrivate::initColumns(bool emptyResultset)
 {
     Q_Q(QSQLiteResult);
@@ -283,41 +322,8 @@ bool QSQLiteResultPrivate::fetchNext(QSqlCachedResult::ValueCache &values, int i
             initColumns(false);
         if (idx < 0 && !initialFetch)
             return true;
-        for (i = 0; i < rInf.count(); ++i) {
-            switch (sqlite3_column_type(stmt, i)) {
-            case SQLITE_BLOB:
-                values[i + idx] = QByteArray(static_cast<const char *>(
-                            sqlite3_column_blob(stmt, i)),
-                            sqlite3_column_bytes(stmt, i));
-                break;
-            case SQLITE_INTEGER:
-                values[i + idx] = sqlite3_column_int64(stmt, i);
-                break;
-            case SQLITE_FLOAT:
-                switch(q->numericalPrecisionPolicy()) {
-                    case QSql::LowPrecisionInt32:
-                        values[i + idx] = sqlite3_column_int(stmt, i);
-                        break;
-                    case QSql::LowPrecisionInt64:
-                        values[i + idx] = sqlite3_column_int64(stmt, i);
-                        break;
-                    case QSql::LowPrecisionDouble:
-                    case QSql::HighPrecision:
-                    default:
-                        values[i + idx] = sqlite3_column_double(stmt, i);
-                        break;
-                };
-                break;
-            case SQLITE_NULL:
-                values[i + idx] = QVariant(QVariant::String);
-                break;
-            default:
-                values[i + idx] = QString(reinterpret_cast<const QChar *>(
-                            sqlite3_column_text16(stmt, i)),
-                            sqlite3_column_bytes16(stmt, i) / sizeof(QChar));
-                break;
-            }
-        }
+        for (i = 0; i < rInf.count(); ++i)
+            values[i + idx] = columnValue(i);
         return true;
     case SQLITE_DONE:
         if (rInf.isEmpty())
@@ -348,6 +354,88 @@ bool QSQLiteResultPrivate::fetchNext(QSqlCachedResult::ValueCache &values, int i
     return false;
 }
 
+QVariant QSQLiteResultPrivate::columnValue(int column) const
+{
+    Q_Q(const QSQLiteResult);
+    switch (sqlite3_column_type(stmt, column)) {
+    case SQLITE_BLOB:
+        return QByteArray(static_cast<const char *>(
+                    sqlite3_column_blob(stmt, column)),
+                    sqlite3_column_bytes(stmt, column));
+    case SQLITE_INTEGER:
+        return sqlite3_column_int64(stmt, column);
+    case SQLITE_FLOAT:
+        switch(q->numericalPrecisionPolicy()) {
+            case QSql::LowPrecisionInt32:
+                return sqlite3_column_int(stmt, column);
+            case QSql::LowPrecisionInt64:
+                return sqlite3_column_int64(stmt, column);
+            case QSql::LowPrecisionDouble:
+            case QSql::HighPrecision:
+            default:
+                return sqlite3_column_double(stmt, column);
+        }
+    case SQLITE_NULL:
+        return QVariant(QVariant::String);
+    default:
+        return QString(reinterpret_cast<const QChar *>(
+                    sqlite3_column_text16(stmt, column)),
+                    sqlite3_column_bytes16(stmt, column) / sizeof(QChar));
+    }
+}
+
+bool QSQLiteResultPrivate::fetchColumnBatch(QSqlColumnBatch &batch, int maxRows)
+{
+    Q_Q(QSQLiteResult);
+    // Scrollable results need every row in the cache, only forward-only
+    // ones can be read straight from the statement.
+    if (!q->isForwardOnly())
+        return false;
+
+    batch.reset(rInf);
+    while (batch.rowCount() < maxRows) {
+        // Steps the statement without converting the row, see
+        // QSqlCachedResult::fetch(). The first row was already stepped to
+        // by exec(), in which case this just consumes skipRow.
+        if (atEnd || q->at() == QSql::AfterLastRow || !fetchNext(cache, -1, false)) {
+            atEnd = true;
+            q->setAt(QSql::AfterLastRow);
+            break;
+        }
+        q->setAt(q->at() + 1);
+        for (int i = 0; i < rInf.count(); ++i) {
+            const QSqlColumnBatch::ColumnType type = batch.columnType(i);
+            if (type != QSqlColumnBatch::VariantColumn
+                    && sqlite3_column_type(stmt, i) == SQLITE_NULL) {
+                batch.appendNull(i);
+                continue;
+            }
+            switch (type) {
+            case QSqlColumnBatch::Int64Column:
+                batch.appendInt64(i, sqlite3_column_int64(stmt, i));
+                break;
+            case QSqlColumnBatch::DoubleColumn:
+                batch.appendDouble(i, sqlite3_column_double(stmt, i));
+                break;
+            case QSqlColumnBatch::StringColumn:
+                batch.appendString(i, QStringView(reinterpret_cast<const QChar *>(
+                                   sqlite3_column_text16(stmt, i)),
+                                   sqlite3_column_bytes16(stmt, i) / int(sizeof(QChar))));
+                break;
+            case QSqlColumnBatch::VariantColumn:
+                batch.appendValue(i, columnValue(i));
+                break;
+            }
+        }
+    }
+    // Keep value() working for the row the query is now positioned on
+    if (!atEnd && batch.rowCount() > 0) {
+        for (int i = 0; i < rInf.count(); ++i)
+            cache[i] = columnValue(i);
+    }
+    return true;
+}
+
 QSQLiteResult::QSQLiteResult(const QSQLiteDriver* db)
     : QSqlCachedResult(*new QSQLiteResultPrivate(this, db))
 {
@@ -365,6 +453,13 @@ QSQLiteResult::~QSQLiteResult()
 
 void QSQLiteResult::virtual_hook(int id, void *data)
 {
+    Q_D(QSQLiteResult);
+    if (id == FetchColumnBatch) {
+        auto fetch = static_cast<QSqlColumnBatchFetch *>(data);
+        fetch->handled = d->fetchColumnBatch(*fetch->batch, fetch->maxRows);
+        if (fetch->handled)
+            return;
+    }
     QSqlCachedResult::virtual_hook(id, data);
 }
 
@@ -385,6 +480,13 @@ bool QSQLiteResult::prepare(const QString &query)
 
     setSelect(false);
 
+    d->stmtQuery = query;
+    if (QSQLiteStatement *cached = d->drv_d_func()->statementCache.take(query)) {
+        d->stmt = cached->take();
+        delete cached;
+        return true;
+    }
+
     const void *pzTail = NULL;
 
 #if (SQLITE_VERSION_NUMBER >= 3003011)
@@ -711,6 +813,9 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
 
 
     int timeOut = 5000;
+    int statementCacheSize = 0;
+    qint64 mmapSize = -1;
+    QString journalMode;
     bool sharedCache = false;
     bool openReadOnlyOption = false;
     bool openUriOption = false;
@@ -737,6 +842,34 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
             openUriOption = true;
         } else if (option == QLatin1String("QSQLITE_ENABLE_SHARED_CACHE")) {
             sharedCache = true;
+        } else if (option.startsWith(QLatin1String("QSQLITE_STATEMENT_CACHE_SIZE"))) {
+            option = option.mid(28).trimmed();
+            if (option.startsWith(QLatin1Char('='))) {
+                bool ok;
+                const int size = option.mid(1).trimmed().toInt(&ok);
+                if (ok && size >= 0)
+                    statementCacheSize = size;
+            }
+        } else if (option.startsWith(QLatin1String("QSQLITE_MMAP_SIZE"))) {
+            option = option.mid(17).trimmed();
+            if (option.startsWith(QLatin1Char('='))) {
+                bool ok;
+                const qint64 size = option.mid(1).trimmed().toLongLong(&ok);
+                if (ok && size >= 0)
+                    mmapSize = size;
+            }
+        } else if (option.startsWith(QLatin1String("QSQLITE_JOURNAL_MODE"))) {
+            option = option.mid(20).trimmed();
+            if (option.startsWith(QLatin1Char('='))) {
+                static const char *const journalModes[] = {
+                    "DELETE", "TRUNCATE", "PERSIST", "MEMORY", "WAL", "OFF"
+                };
+                const auto mode = option.mid(1).trimmed();
+                for (const char *m : journalModes) {
+                    if (mode.compare(QLatin1String(m), Qt::CaseInsensitive) == 0)
+                        journalMode = QLatin1String(m);
+                }
+            }
         }
 #if QT_CONFIG(regularexpression)
         else if (option.startsWith(regexpConnectOption)) {
@@ -756,6 +889,12 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
 #endif
     }
 
+    QString pragmas;
+    if (!journalMode.isEmpty())
+        pragmas += QLatin1String("PRAGMA journal_mode=") + journalMode + QLatin1Char(';');
+    if (mmapSize >= 0)
+        pragmas += QLatin1String("PRAGMA mmap_size=") + QString::number(mmapSize) + QLatin1Char(';');
+
     int openMode = (openReadOnlyOption ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE));
     openMode |= (sharedCache ? SQLITE_OPEN_SHAREDCACHE : SQLITE_OPEN_PRIVATECACHE);
     if (openUriOption)
@@ -767,6 +906,19 @@ bool QSQLiteDriver::open(const QString & db, const QString &, const QString &, c
 
     if (res == SQLITE_OK) {
         sqlite3_busy_timeout(d->access, timeOut);
+        if (!pragmas.isEmpty()) {
+            const int pragmaRes = sqlite3_exec(d->access, pragmas.toUtf8().constData(),
+                                               nullptr, nullptr, nullptr);
+            if (pragmaRes != SQLITE_OK) {
+                setLastError(qMakeError(d->access, tr("Error setting database options"),
+                             QSqlError::ConnectionError, pragmaRes));
+                setOpenError(true);
+                sqlite3_close(d->access);
+                d->access = 0;
+                return false;
+            }
+        }
+        d->statementCache.setMaxCost(statementCacheSize);
         setOpen(true);
         setOpenError(false);
 #if QT_CONFIG(regularexpression)
@@ -797,6 +949,7 @@ void QSQLiteDriver::close()
     if (isOpen()) {
         for (QSQLiteResult *result : qAsConst(d->results))
             result->d_func()->finalize();
+        d->statementCache.clear();
 
         if (d->access && (d->notificationid.count() > 0)) {
             d->notificationid.clear();
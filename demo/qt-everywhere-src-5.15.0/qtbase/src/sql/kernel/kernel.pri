@@ -12,6 +12,7 @@ HEADERS +=      kernel/qtsqlglobal.h \
                 kernel/qsqlresult.h \
                 kernel/qsqlresult_p.h \
                 kernel/qsqlcachedresult_p.h \
+                kernel/qsqlcolumnbatch.h \
                 kernel/qsqlindex.h
 
 SOURCES +=      kernel/qsqlquery.cpp \
@@ -23,5 +24,6 @@ SOURCES +=      kernel/qsqlquery.cpp \
                 kernel/qsqlerror.cpp \
                 kernel/qsqlresult.cpp \
                 kernel/qsqlindex.cpp \
-                kernel/qsqlcachedresult.cpp
+                kernel/qsqlcachedresult.cpp \
+                kernel/qsqlcolumnbatch.cpp
 
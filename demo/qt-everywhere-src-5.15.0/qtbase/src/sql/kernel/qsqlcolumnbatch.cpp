@@ -0,0 +1,466 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtSql module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qsqlcolumnbatch.h"
+
+#include "qbitarray.h"
+#include "qsqlfield.h"
+#include "qsqlrecord.h"
+#include "qstring.h"
+
+QT_BEGIN_NAMESPACE
+
+class QSqlColumnBatchPrivate : public QSharedData
+{
+public:
+    struct Column
+    {
+        void reset(QSqlColumnBatch::ColumnType t);
+        void appendNull();
+        void appendNotNull() { nulls.resize(size + 1); ++size; }
+
+        QSqlColumnBatch::ColumnType type = QSqlColumnBatch::VariantColumn;
+        int size = 0;
+        QBitArray nulls;
+        QVector<qint64> ints;
+        QVector<double> doubles;
+        // all strings of the column back to back; offsets holds the start
+        // of each of them, followed by the end of the last one
+        QString chars;
+        QVector<int> offsets;
+        QVector<QVariant> variants;
+    };
+
+    QVector<Column> columns;
+};
+
+void QSqlColumnBatchPrivate::Column::reset(QSqlColumnBatch::ColumnType t)
+{
+    // resize() keeps the capacity, so that refilling a batch of the same
+    // shape does not allocate again
+    type = t;
+    size = 0;
+    nulls.clear();
+    ints.resize(0);
+    doubles.resize(0);
+    chars.resize(0);
+    offsets.resize(0);
+    variants.resize(0);
+    if (type == QSqlColumnBatch::StringColumn)
+        offsets.append(0);
+}
+
+void QSqlColumnBatchPrivate::Column::appendNull()
+{
+    switch (type) {
+    case QSqlColumnBatch::Int64Column:
+        ints.append(0);
+        break;
+    case QSqlColumnBatch::DoubleColumn:
+        doubles.append(0);
+        break;
+    case QSqlColumnBatch::StringColumn:
+        offsets.append(chars.size());
+        break;
+    case QSqlColumnBatch::VariantColumn:
+        variants.append(QVariant());
+        break;
+    }
+    nulls.resize(size + 1);
+    nulls.setBit(size);
+    ++size;
+}
+
+/*!
+    \class QSqlColumnBatch
+    \brief The QSqlColumnBatch class holds a block of rows of a query
+    result, stored column by column.
+
+    \ingroup database
+    \ingroup shared
+    \inmodule QtSql
+    \since 5.16
+
+    QSqlQuery::value() returns every cell of a result as a QVariant.
+    When a large result is processed in bulk, constructing all those
+    variants can dominate the cost of the query. QSqlQuery::nextBatch()
+    instead fills a QSqlColumnBatch with up to a given number of rows at
+    a time, keeping the values of each column in a typed array that
+    drivers can fill directly from their native row buffers.
+
+    The type of each column is derived from the type of the
+    corresponding field of QSqlQuery::record(), see columnTypeFor().
+    Integer and boolean columns are available through int64Data(),
+    floating point ones through doubleData() and text through string();
+    value() works for every column type. The numerical precision policy
+    of the query is not applied to the typed columns. For each column,
+    nulls() holds a bit per row that is set if the value is null; the
+    typed arrays hold \c 0 or an empty string for such rows.
+
+    \code
+    QSqlQuery query("SELECT id, price FROM items");
+    QSqlColumnBatch batch;
+    double total = 0;
+    while (query.nextBatch(batch, 1024)) {
+        const double *prices = batch.doubleData(1);
+        for (int row = 0; row < batch.rowCount(); ++row)
+            total += prices[row];
+    }
+    \endcode
+
+    The pointers and string views returned by a batch stay valid until
+    it is modified, which includes passing it to QSqlQuery::nextBatch()
+    again. The storage of a batch is reused when it is refilled with
+    rows of the same query.
+
+    \section1 Filling a Batch
+
+    A driver that can produce column batches natively starts by calling
+    reset() with the column types, then appends exactly one value to
+    each column for every row using appendNull(), appendInt64(),
+    appendDouble(), appendString() or appendValue().
+
+    \sa QSqlQuery::nextBatch()
+*/
+
+/*!
+    \enum QSqlColumnBatch::ColumnType
+
+    This enum describes how the values of a column are stored.
+
+    \value Int64Column The values are stored as 64-bit integers,
+        see int64Data().
+    \value DoubleColumn The values are stored as doubles, see
+        doubleData().
+    \value StringColumn The values are stored as text, see string().
+    \value VariantColumn The values are stored as QVariant, see value().
+*/
+
+/*!
+    Constructs an empty batch without any columns.
+*/
+QSqlColumnBatch::QSqlColumnBatch()
+    : d(new QSqlColumnBatchPrivate)
+{
+}
+
+/*!
+    Constructs a copy of \a other.
+*/
+QSqlColumnBatch::QSqlColumnBatch(const QSqlColumnBatch &other) = default;
+
+/*!
+    Destroys the batch.
+*/
+QSqlColumnBatch::~QSqlColumnBatch() = default;
+
+/*!
+    \fn QSqlColumnBatch &QSqlColumnBatch::operator=(QSqlColumnBatch &&other)
+
+    Move-assigns \a other to this batch.
+*/
+
+/*!
+    Assigns \a other to this batch.
+*/
+QSqlColumnBatch &QSqlColumnBatch::operator=(const QSqlColumnBatch &other) = default;
+
+/*!
+    \fn void QSqlColumnBatch::swap(QSqlColumnBatch &other)
+
+    Swaps this batch with \a other. This function is very fast and
+    never fails.
+*/
+
+/*!
+    Returns the number of rows in the batch.
+*/
+int QSqlColumnBatch::rowCount() const
+{
+    return d->columns.isEmpty() ? 0 : d->columns.constFirst().size;
+}
+
+/*!
+    Returns the number of columns in the batch.
+*/
+int QSqlColumnBatch::columnCount() const
+{
+    return d->columns.size();
+}
+
+/*!
+    Returns how the values of \a column are stored. \a column must be a
+    valid column index.
+*/
+QSqlColumnBatch::ColumnType QSqlColumnBatch::columnType(int column) const
+{
+    Q_ASSERT_X(column >= 0 && column < d->columns.size(), "QSqlColumnBatch::columnType",
+               "column out of range");
+    return d->columns.at(column).type;
+}
+
+/*!
+    Returns \c true if the value of \a column in \a row is null. \a row
+    and \a column must be valid indexes.
+*/
+bool QSqlColumnBatch::isNull(int row, int column) const
+{
+    Q_ASSERT_X(column >= 0 && column < d->columns.size(), "QSqlColumnBatch::isNull",
+               "column out of range");
+    return d->columns.at(column).nulls.testBit(row);
+}
+
+/*!
+    Returns a bit array with one bit per row, which is set for the rows
+    where the value of \a column is null. \a column must be a valid
+    column index.
+*/
+const QBitArray &QSqlColumnBatch::nulls(int column) const
+{
+    Q_ASSERT_X(column >= 0 && column < d->columns.size(), "QSqlColumnBatch::nulls",
+               "column out of range");
+    return d->columns.at(column).nulls;
+}
+
+/*!
+    Returns a pointer to the rowCount() values of \a column, or \c nullptr
+    if the column is not an \l Int64Column.
+*/
+const qint64 *QSqlColumnBatch::int64Data(int column) const
+{
+    Q_ASSERT_X(column >= 0 && column < d->columns.size(), "QSqlColumnBatch::int64Data",
+               "column out of range");
+    const auto &col = d->columns.at(column);
+    return col.type == Int64Column ? col.ints.constData() : nullptr;
+}
+
+/*!
+    Returns a pointer to the rowCount() values of \a column, or \c nullptr
+    if the column is not a \l DoubleColumn.
+*/
+const double *QSqlColumnBatch::doubleData(int column) const
+{
+    Q_ASSERT_X(column >= 0 && column < d->columns.size(), "QSqlColumnBatch::doubleData",
+               "column out of range");
+    const auto &col = d->columns.at(column);
+    return col.type == DoubleColumn ? col.doubles.constData() : nullptr;
+}
+
+/*!
+    Returns the value of \a column in \a row, if the column is a
+    \l StringColumn; otherwise returns a null string view. \a row and
+    \a column must be valid indexes.
+*/
+QStringView QSqlColumnBatch::string(int row, int column) const
+{
+    Q_ASSERT_X(column >= 0 && column < d->columns.size(), "QSqlColumnBatch::string",
+               "column out of range");
+    const auto &col = d->columns.at(column);
+    if (col.type != StringColumn)
+        return QStringView();
+    Q_ASSERT_X(row >= 0 && row < col.size, "QSqlColumnBatch::string", "row out of range");
+    const int begin = col.offsets.at(row);
+    return QStringView(col.chars.constData() + begin, col.offsets.at(row + 1) - begin);
+}
+
+/*!
+    Returns the value of \a column in \a row as a QVariant, whatever the
+    type of the column. Null values are returned as null variants of the
+    column's type. \a row and \a column must be valid indexes.
+*/
+QVariant QSqlColumnBatch::value(int row, int column) const
+{
+    Q_ASSERT_X(column >= 0 && column < d->columns.size(), "QSqlColumnBatch::value",
+               "column out of range");
+    const auto &col = d->columns.at(column);
+    Q_ASSERT_X(row >= 0 && row < col.size, "QSqlColumnBatch::value", "row out of range");
+    const bool null = col.nulls.testBit(row);
+    switch (col.type) {
+    case Int64Column:
+        return null ? QVariant(QVariant::LongLong) : QVariant(col.ints.at(row));
+    case DoubleColumn:
+        return null ? QVariant(QVariant::Double) : QVariant(col.doubles.at(row));
+    case StringColumn:
+        return null ? QVariant(QVariant::String) : QVariant(string(row, column).toString());
+    case VariantColumn:
+        break;
+    }
+    return col.variants.at(row);
+}
+
+/*!
+    Removes all rows and sets up one column for each entry of \a types.
+*/
+void QSqlColumnBatch::reset(const QVector<ColumnType> &types)
+{
+    d->columns.resize(types.size());
+    for (int i = 0; i < types.size(); ++i)
+        d->columns[i].reset(types.at(i));
+}
+
+/*!
+    \overload
+
+    Removes all rows and sets up one column for each field of \a record,
+    with the type given by columnTypeFor().
+*/
+void QSqlColumnBatch::reset(const QSqlRecord &record)
+{
+    d->columns.resize(record.count());
+    for (int i = 0; i < record.count(); ++i)
+        d->columns[i].reset(columnTypeFor(record.field(i).type()));
+}
+
+/*!
+    Removes all rows and columns.
+*/
+void QSqlColumnBatch::clear()
+{
+    d->columns.clear();
+}
+
+/*!
+    Appends a null value to \a column.
+*/
+void QSqlColumnBatch::appendNull(int column)
+{
+    Q_ASSERT_X(column >= 0 && column < d->columns.size(), "QSqlColumnBatch::appendNull",
+               "column out of range");
+    d->columns[column].appendNull();
+}
+
+/*!
+    Appends \a value to \a column, which must be an \l Int64Column.
+*/
+void QSqlColumnBatch::appendInt64(int column, qint64 value)
+{
+    Q_ASSERT_X(column >= 0 && column < d->columns.size(), "QSqlColumnBatch::appendInt64",
+               "column out of range");
+    auto &col = d->columns[column];
+    Q_ASSERT(col.type == Int64Column);
+    col.ints.append(value);
+    col.appendNotNull();
+}
+
+/*!
+    Appends \a value to \a column, which must be a \l DoubleColumn.
+*/
+void QSqlColumnBatch::appendDouble(int column, double value)
+{
+    Q_ASSERT_X(column >= 0 && column < d->columns.size(), "QSqlColumnBatch::appendDouble",
+               "column out of range");
+    auto &col = d->columns[column];
+    Q_ASSERT(col.type == DoubleColumn);
+    col.doubles.append(value);
+    col.appendNotNull();
+}
+
+/*!
+    Appends \a value to \a column, which must be a \l StringColumn.
+*/
+void QSqlColumnBatch::appendString(int column, QStringView value)
+{
+    Q_ASSERT_X(column >= 0 && column < d->columns.size(), "QSqlColumnBatch::appendString",
+               "column out of range");
+    auto &col = d->columns[column];
+    Q_ASSERT(col.type == StringColumn);
+    col.chars.append(value.data(), int(value.size()));
+    col.offsets.append(col.chars.size());
+    col.appendNotNull();
+}
+
+/*!
+    Appends \a value to \a column, converting it to the type of the
+    column. A null \a value is appended as a null value.
+*/
+void QSqlColumnBatch::appendValue(int column, const QVariant &value)
+{
+    Q_ASSERT_X(column >= 0 && column < d->columns.size(), "QSqlColumnBatch::appendValue",
+               "column out of range");
+    auto &col = d->columns[column];
+    if (value.isNull()) {
+        col.appendNull();
+        if (col.type == VariantColumn)
+            col.variants.last() = value;
+        return;
+    }
+    switch (col.type) {
+    case Int64Column:
+        appendInt64(column, value.toLongLong());
+        break;
+    case DoubleColumn:
+        appendDouble(column, value.toDouble());
+        break;
+    case StringColumn:
+        appendString(column, value.toString());
+        break;
+    case VariantColumn:
+        col.variants.append(value);
+        col.appendNotNull();
+        break;
+    }
+}
+
+/*!
+    Returns the column type used for fields of type \a type: integer and
+    boolean types are stored in an \l Int64Column, QVariant::Double in a
+    \l DoubleColumn, QVariant::String in a \l StringColumn and all other
+    types in a \l VariantColumn.
+*/
+QSqlColumnBatch::ColumnType QSqlColumnBatch::columnTypeFor(QVariant::Type type)
+{
+    switch (type) {
+    case QVariant::Bool:
+    case QVariant::Int:
+    case QVariant::UInt:
+    case QVariant::LongLong:
+    case QVariant::ULongLong:
+        return Int64Column;
+    case QVariant::Double:
+        return DoubleColumn;
+    case QVariant::String:
+        return StringColumn;
+    default:
+        break;
+    }
+    return VariantColumn;
+}
+
+QT_END_NAMESPACE
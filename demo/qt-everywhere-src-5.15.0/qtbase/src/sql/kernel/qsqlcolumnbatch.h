@@ -0,0 +1,106 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtSql module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QSQLCOLUMNBATCH_H
+#define QSQLCOLUMNBATCH_H
+
+#include <QtSql/qtsqlglobal.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qstringview.h>
+#include <QtCore/qvariant.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+
+class QBitArray;
+class QSqlRecord;
+class QSqlColumnBatchPrivate;
+
+class Q_SQL_EXPORT QSqlColumnBatch
+{
+public:
+    enum ColumnType {
+        Int64Column,
+        DoubleColumn,
+        StringColumn,
+        VariantColumn
+    };
+
+    QSqlColumnBatch();
+    QSqlColumnBatch(const QSqlColumnBatch &other);
+    ~QSqlColumnBatch();
+    QSqlColumnBatch &operator=(QSqlColumnBatch &&other) noexcept { swap(other); return *this; }
+    QSqlColumnBatch &operator=(const QSqlColumnBatch &other);
+
+    void swap(QSqlColumnBatch &other) noexcept { qSwap(d, other.d); }
+
+    int rowCount() const;
+    int columnCount() const;
+    ColumnType columnType(int column) const;
+
+    bool isNull(int row, int column) const;
+    const QBitArray &nulls(int column) const;
+    const qint64 *int64Data(int column) const;
+    const double *doubleData(int column) const;
+    QStringView string(int row, int column) const;
+    QVariant value(int row, int column) const;
+
+    // for driver implementations
+    void reset(const QVector<ColumnType> &types);
+    void reset(const QSqlRecord &record);
+    void clear();
+    void appendNull(int column);
+    void appendInt64(int column, qint64 value);
+    void appendDouble(int column, double value);
+    void appendString(int column, QStringView value);
+    void appendValue(int column, const QVariant &value);
+
+    static ColumnType columnTypeFor(QVariant::Type type);
+
+private:
+    QSharedDataPointer<QSqlColumnBatchPrivate> d;
+};
+
+Q_DECLARE_SHARED(QSqlColumnBatch)
+
+QT_END_NAMESPACE
+
+#endif // QSQLCOLUMNBATCH_H
@@ -1213,6 +1213,9 @@ QSqlRecord QSqlDatabase::record(const QString& tablename) const
     \li QSQLITE_OPEN_URI
     \li QSQLITE_ENABLE_SHARED_CACHE
     \li QSQLITE_ENABLE_REGEXP
+    \li QSQLITE_STATEMENT_CACHE_SIZE
+    \li QSQLITE_JOURNAL_MODE
+    \li QSQLITE_MMAP_SIZE
     \endlist
 
     \li
@@ -1223,6 +1226,14 @@ QSqlRecord QSqlDatabase::record(const QString& tablename) const
 
     \endtable
 
+    With SQLite, QSQLITE_STATEMENT_CACHE_SIZE=n keeps the compiled
+    statements of up to n finished queries per connection and reuses
+    them when a query with the same SQL is prepared again.
+    QSQLITE_JOURNAL_MODE and QSQLITE_MMAP_SIZE set the journal_mode and
+    mmap_size PRAGMAs when the connection is opened; in WAL journal mode,
+    connections that worker threads create with cloneDatabase() can read
+    the database concurrently with each other and with a writer.
+
     Examples:
     \snippet code/src_sql_kernel_qsqldatabase.cpp 4
 
@@ -44,11 +44,13 @@
 #include "qdebug.h"
 #include "qelapsedtimer.h"
 #include "qatomic.h"
+#include "qsqlcolumnbatch.h"
 #include "qsqlrecord.h"
 #include "qsqlresult.h"
 #include "qsqldriver.h"
 #include "qsqldatabase.h"
 #include "private/qsqlnulldriver_p.h"
+#include "private/qsqlresult_p.h"
 #include "qvector.h"
 #include "qmap.h"
 
@@ -667,6 +669,54 @@ bool QSqlQuery::next()
     }
 }
 
+/*!
+    \since 5.16
+
+    Retrieves up to \a maxRows records following the current one into
+    \a batch, storing the values column by column, and positions the
+    query on the last record retrieved. Returns \c true if at least one
+    record was retrieved; otherwise \a batch is left empty, the query is
+    positioned after the last record and false is returned. As with
+    next(), the query must be \l{isActive()}{active} and isSelect() must
+    return true.
+
+    This is a faster alternative to calling next() and value() for each
+    record when processing large results, as it avoids constructing a
+    QVariant for every value. The SQLite driver (for
+    \l{setForwardOnly()}{forward-only} queries) and the PostgreSQL driver
+    fill the batch directly from their native row buffers; for other
+    drivers the batch is filled from value().
+
+    \a batch is reset to the columns of record() before it is filled; its
+    storage is reused, so passing the same batch in a loop avoids
+    reallocating it.
+
+    \sa QSqlColumnBatch, next(), setForwardOnly()
+*/
+bool QSqlQuery::nextBatch(QSqlColumnBatch &batch, int maxRows)
+{
+    if (!isSelect() || !isActive() || maxRows <= 0 || at() == QSql::AfterLastRow) {
+        batch.clear();
+        return false;
+    }
+
+    QSqlColumnBatchFetch fetch{&batch, maxRows};
+    d->sqlResult->virtual_hook(QSqlResult::FetchColumnBatch, &fetch);
+    if (!fetch.handled) {
+        batch.reset(record());
+        const int columnCount = batch.columnCount();
+        while (columnCount > 0 && batch.rowCount() < maxRows && next()) {
+            for (int i = 0; i < columnCount; ++i)
+                batch.appendValue(i, d->sqlResult->data(i));
+        }
+    }
+    if (batch.rowCount() == 0) {
+        batch.clear();
+        return false;
+    }
+    return true;
+}
+
 /*!
 
   Retrieves the previous record in the result, if available, and
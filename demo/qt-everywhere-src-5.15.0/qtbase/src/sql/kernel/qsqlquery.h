@@ -52,6 +52,7 @@ class QSqlDriver;
 class QSqlError;
 class QSqlResult;
 class QSqlRecord;
+class QSqlColumnBatch;
 template <class Key, class T> class QMap;
 class QSqlQueryPrivate;
 
@@ -90,6 +91,7 @@ public:
 
     bool seek(int i, bool relative = false);
     bool next();
+    bool nextBatch(QSqlColumnBatch &batch, int maxRows);
     bool previous();
     bool first();
     bool last();
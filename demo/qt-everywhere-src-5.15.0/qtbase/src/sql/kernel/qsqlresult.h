@@ -127,7 +127,7 @@ protected:
     virtual QSqlRecord record() const;
     virtual QVariant lastInsertId() const;
 
-    enum VirtualHookOperation { };
+    enum VirtualHookOperation { FetchColumnBatch = 1 };
     virtual void virtual_hook(int id, void *data);
     virtual bool execBatch(bool arrayBind = false);
     virtual void detachFromResultSet();
@@ -64,6 +64,17 @@ QT_BEGIN_NAMESPACE
     inline const Class##Private* drv_d_func() const { return !sqldriver ? nullptr : reinterpret_cast<const Class *>(static_cast<const QSqlDriver*>(sqldriver))->d_func(); } \
     inline Class##Private* drv_d_func()  { return !sqldriver ? nullptr : reinterpret_cast<Class *>(static_cast<QSqlDriver*>(sqldriver))->d_func(); }
 
+class QSqlColumnBatch;
+
+// argument of QSqlResult::virtual_hook(FetchColumnBatch, ...); a driver that
+// fills the batch itself sets handled and positions the result on the last
+// row fetched, like the corresponding number of fetchNext() calls would
+struct QSqlColumnBatchFetch {
+    QSqlColumnBatch *batch;
+    int maxRows;
+    bool handled = false;
+};
+
 struct QHolder {
     QHolder(const QString &hldr = QString(), int index = -1): holderName(hldr), holderPos(index) { }
     bool operator==(const QHolder &h) const { return h.holderPos == holderPos && h.holderName == holderName; }
@@ -905,6 +905,31 @@ qreal addResult(qreal current, const QBenchmarkResult& r)
     return current + r.value;
 }
 
+// Reports the spread of the per-iteration values of all median runs, which
+// tells whether the reported median can be trusted.
+void logResultStatistics(const QVector<QBenchmarkResult> &results)
+{
+    QVector<qreal> values;
+    values.reserve(results.size());
+    for (const QBenchmarkResult &result : results)
+        values.append(result.value / result.iterations);
+    std::sort(values.begin(), values.end());
+
+    const int count = values.size();
+    const qreal mean = std::accumulate(values.cbegin(), values.cend(), qreal(0)) / count;
+    qreal variance = 0;
+    for (qreal value : qAsConst(values))
+        variance += (value - mean) * (value - mean);
+    const qreal deviation = std::sqrt(variance / (count - 1));
+
+    QTestLog::info(qPrintable(
+        QString::fromLatin1("per-iteration statistics : runs %1, min %2, median %3, max %4, "
+                            "mean %5, stddev %6 (%7%)")
+            .arg(count).arg(values.first()).arg(values.at(count / 2)).arg(values.last())
+            .arg(mean).arg(deviation).arg(mean ? 100 * deviation / mean : 0, 0, 'f', 1)),
+        nullptr, 0);
+}
+
 }
 
 void TestMethods::invokeTestOnData(int index) const
@@ -996,8 +1021,11 @@ void TestMethods::invokeTestOnData(int index) const
         bool testPassed = !QTestResult::skipCurrentTest() && !QTestResult::currentTestFailed();
         QTestResult::finishedCurrentTestDataCleanup();
         // Only report benchmark figures if the test passed
-        if (testPassed && QBenchmarkTestMethodData::current->resultsAccepted())
+        if (testPassed && QBenchmarkTestMethodData::current->resultsAccepted()) {
+            if (QBenchmarkGlobalData::current->verboseOutput && results.size() > 1)
+                logResultStatistics(results);
             QTestLog::addBenchmarkResult(qMedian(results));
+        }
     }
 }
 
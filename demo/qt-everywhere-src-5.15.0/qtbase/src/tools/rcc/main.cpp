@@ -183,6 +183,11 @@ int runRcc(int argc, char *argv[])
     QCommandLineOption thresholdOption(QStringLiteral("threshold"), QStringLiteral("Threshold to consider compressing files."), QStringLiteral("level"));
     parser.addOption(thresholdOption);
 
+    QCommandLineOption chunkSizeOption(QStringLiteral("compress-chunk-size"),
+                                       QStringLiteral("Compress files larger than <bytes> in separately readable chunks of that size (format version 4)."),
+                                       QStringLiteral("bytes"));
+    parser.addOption(chunkSizeOption);
+
     QCommandLineOption binaryOption(QStringLiteral("binary"), QStringLiteral("Output a binary file for use as a dynamic resource."));
     parser.addOption(binaryOption);
 
@@ -231,7 +236,7 @@ int runRcc(int argc, char *argv[])
         formatVersion = parser.value(formatVersionOption).toUInt(&ok);
         if (!ok) {
             errorMsg = QLatin1String("Invalid format version specified");
-        } else if (formatVersion < 1 || formatVersion > 3) {
+        } else if (formatVersion < 1 || formatVersion > 4) {
             errorMsg = QLatin1String("Unsupported format version specified");
         }
     }
@@ -258,6 +263,14 @@ int runRcc(int argc, char *argv[])
     }
     if (parser.isSet(thresholdOption))
         library.setCompressThreshold(parser.value(thresholdOption).toInt());
+    if (parser.isSet(chunkSizeOption)) {
+        bool ok = false;
+        const int chunkSize = parser.value(chunkSizeOption).toInt(&ok);
+        if (!ok || chunkSize <= 0)
+            errorMsg = QLatin1String("Invalid compression chunk size specified");
+        else
+            library.setCompressChunkSize(chunkSize);
+    }
     if (parser.isSet(binaryOption))
         library.setFormat(RCCResourceLibrary::Binary);
     if (parser.isSet(generatorOption)) {
@@ -56,7 +56,8 @@ enum {
     CONSTANT_COMPRESSLEVEL_DEFAULT = -1,
     CONSTANT_ZSTDCOMPRESSLEVEL_CHECK = 1,   // Zstd level to check if compressing is a good idea
     CONSTANT_ZSTDCOMPRESSLEVEL_STORE = 14,  // Zstd level to actually store the data
-    CONSTANT_COMPRESSTHRESHOLD_DEFAULT = 70
+    CONSTANT_COMPRESSTHRESHOLD_DEFAULT = 70,
+    CONSTANT_COMPRESSCHUNKSIZE_DEFAULT = 64 * 1024
 };
 
 #if QT_CONFIG(zstd) && QT_VERSION >= QT_VERSION_CHECK(6,0,0)
@@ -104,7 +105,8 @@ public:
         NoFlags = 0x00,
         Compressed = 0x01,
         Directory = 0x02,
-        CompressedZstd = 0x04
+        CompressedZstd = 0x04,
+        CompressedChunked = 0x08
     };
 
     RCCFileInfo(const QString &name = QString(), const QFileInfo &fileInfo = QFileInfo(),
@@ -120,6 +122,7 @@ public:
 
 public:
     qint64 writeDataBlob(RCCResourceLibrary &lib, qint64 offset, QString *errorMessage);
+    QByteArray compressChunked(RCCResourceLibrary &lib, const QByteArray &data);
     qint64 writeDataName(RCCResourceLibrary &, qint64 offset);
     void writeDataInfo(RCCResourceLibrary &lib);
 
@@ -263,6 +266,7 @@ qint64 RCCFileInfo::writeDataBlob(RCCResourceLibrary &lib, qint64 offset,
         return 0;
     }
     QByteArray data = file.readAll();
+    const QByteArray uncompressed = data;
 
     // Check if compression is useful for this file
     if (data.size() != 0) {
@@ -339,6 +343,23 @@ qint64 RCCFileInfo::writeDataBlob(RCCResourceLibrary &lib, qint64 offset,
             }
         }
 #endif // QT_NO_COMPRESS
+
+        // Large files are stored in chunks that can be decompressed on their
+        // own, so that QFile doesn't need to decompress all of it
+        if (lib.formatVersion() >= 4 && (m_flags & (Compressed | CompressedZstd))
+                && uncompressed.size() > lib.compressChunkSize()) {
+            QByteArray chunked = compressChunked(lib, uncompressed);
+            if (!chunked.isEmpty()) {
+                if (lib.verbose()) {
+                    QString msg = QString::fromLatin1("%1: note: stored in chunks of %2 bytes (%3 -> %4)\n")
+                            .arg(m_name).arg(lib.compressChunkSize()).arg(uncompressed.size()).arg(chunked.size());
+                    lib.m_errorDevice->write(msg.toUtf8());
+                }
+                data = std::move(chunked);
+                lib.m_overallFlags |= CompressedChunked;
+                m_flags |= CompressedChunked;
+            }
+        }
     }
 
     // some info
@@ -384,6 +405,68 @@ qint64 RCCFileInfo::writeDataBlob(RCCResourceLibrary &lib, qint64 offset,
     return offset;
 }
 
+/*
+    Compresses \a data in chunks of lib.compressChunkSize() bytes with the
+    algorithm already chosen in m_flags. The layout must match
+    QResourcePrivate::chunkTable(): the uncompressed size, the chunk size,
+    chunk count + 1 offsets relative to the end of the table, then the
+    chunks. Returns an empty array on failure.
+*/
+QByteArray RCCFileInfo::compressChunked(RCCResourceLibrary &lib, const QByteArray &data)
+{
+    const int chunkSize = lib.compressChunkSize();
+    const int chunkCount = (data.size() + chunkSize - 1) / chunkSize;
+
+    QByteArray chunks;
+    QVector<quint32> offsets;
+    offsets.reserve(chunkCount + 1);
+    for (int begin = 0; begin < data.size(); begin += chunkSize) {
+        offsets.append(chunks.size());
+        const int length = qMin(chunkSize, data.size() - begin);
+        const char *source = data.constData() + begin;
+#if QT_CONFIG(zstd)
+        if (m_flags & CompressedZstd) {
+            const int level = m_compressLevel < 0 ? int(CONSTANT_ZSTDCOMPRESSLEVEL_STORE) : m_compressLevel;
+            QByteArray compressed(int(ZSTD_COMPRESSBOUND(length)), Qt::Uninitialized);
+            const size_t n = ZSTD_compressCCtx(lib.m_zstdCCtx, compressed.data(), compressed.size(),
+                                               source, length, level);
+            if (ZSTD_isError(n))
+                return QByteArray();
+            chunks.append(compressed.constData(), int(n));
+            continue;
+        }
+#endif
+#ifndef QT_NO_COMPRESS
+        if (m_flags & Compressed) {
+            // drop the size qCompress() prepends, the chunk size is known
+            const QByteArray compressed = qCompress(reinterpret_cast<const uchar *>(source), length,
+                                                    m_compressLevel);
+            if (compressed.size() <= 4)
+                return QByteArray();
+            chunks.append(compressed.constData() + 4, compressed.size() - 4);
+            continue;
+        }
+#endif
+        return QByteArray();
+    }
+    offsets.append(chunks.size());
+
+    QByteArray result;
+    result.reserve(8 + 4 * offsets.size() + chunks.size());
+    const auto appendNumber4 = [&result](quint32 number) {
+        result.append(char(number >> 24));
+        result.append(char(number >> 16));
+        result.append(char(number >> 8));
+        result.append(char(number));
+    };
+    appendNumber4(data.size());
+    appendNumber4(chunkSize);
+    for (quint32 offset : qAsConst(offsets))
+        appendNumber4(offset);
+    result += chunks;
+    return result;
+}
+
 qint64 RCCFileInfo::writeDataName(RCCResourceLibrary &lib, qint64 offset)
 {
     const bool text = lib.m_format == RCCResourceLibrary::C_Code;
@@ -464,6 +547,7 @@ RCCResourceLibrary::RCCResourceLibrary(quint8 formatVersion)
     m_compressionAlgo(CONSTANT_COMPRESSALGO_DEFAULT),
     m_compressLevel(CONSTANT_COMPRESSLEVEL_DEFAULT),
     m_compressThreshold(CONSTANT_COMPRESSTHRESHOLD_DEFAULT),
+    m_compressChunkSize(CONSTANT_COMPRESSCHUNKSIZE_DEFAULT),
     m_treeOffset(0),
     m_namesOffset(0),
     m_dataOffset(0),
@@ -1393,6 +1477,13 @@ bool RCCResourceLibrary::writeInitializer()
             if (m_overallFlags & (RCCFileInfo::Compressed | RCCFileInfo::CompressedZstd)) {
                 // use variable relocations with ELF and Mach-O
                 writeString("#if defined(__ELF__) || defined(__APPLE__)\n");
+                if (m_overallFlags & RCCFileInfo::CompressedChunked) {
+                    writeString("static inline unsigned char qResourceFeatureChunked()\n"
+                                "{\n"
+                                "    extern const unsigned char qt_resourceFeatureChunked;\n"
+                                "    return qt_resourceFeatureChunked;\n"
+                                "}\n");
+                }
                 if (m_overallFlags & RCCFileInfo::Compressed) {
                     writeString("static inline unsigned char qResourceFeatureZlib()\n"
                                 "{\n"
@@ -1408,6 +1499,8 @@ bool RCCResourceLibrary::writeInitializer()
                                 "}\n");
                 }
                 writeString("#else\n");
+                if (m_overallFlags & RCCFileInfo::CompressedChunked)
+                    writeString("unsigned char qResourceFeatureChunked();\n");
                 if (m_overallFlags & RCCFileInfo::Compressed)
                     writeString("unsigned char qResourceFeatureZlib();\n");
                 if (m_overallFlags & RCCFileInfo::CompressedZstd)
@@ -1470,6 +1563,11 @@ bool RCCResourceLibrary::writeInitializer()
                 writeAddNamespaceFunction("qResourceFeatureZstd()");
                 writeString(";\n    ");
             }
+            if (m_overallFlags & RCCFileInfo::CompressedChunked) {
+                writeString("version += ");
+                writeAddNamespaceFunction("qResourceFeatureChunked()");
+                writeString(";\n    ");
+            }
 
             writeAddNamespaceFunction("qUnregisterResourceData");
             writeString("\n       (version, qt_resource_struct, "
@@ -1960,37 +1960,27 @@ void QFileSystemModelPrivate::_q_fileSystemChanged(const QString &path, const QV
     }
 
     // bundle up all of the changed signals into as few as possible.
-    std::sort(rowsToUpdate.begin(), rowsToUpdate.end());
-    QString min;
-    QString max;
+    QVector<int> visibleRowsToUpdate;
+    visibleRowsToUpdate.reserve(rowsToUpdate.count());
     for (const QString &value : qAsConst(rowsToUpdate)) {
-        //##TODO is there a way to bundle signals with QString as the content of the list?
-        /*if (min.isEmpty()) {
-            min = value;
-            if (i != rowsToUpdate.count() - 1)
-                continue;
+        const int visibleLocation = parentNode->visibleLocation(value);
+        if (visibleLocation >= 0
+            && visibleLocation < parentNode->visibleChildren.count()
+            && parentNode->visibleChildren.at(visibleLocation) == value) {
+            visibleRowsToUpdate.append(translateVisibleLocation(parentNode, visibleLocation));
         }
-        if (i != rowsToUpdate.count() - 1) {
-            if ((value == min + 1 && max.isEmpty()) || value == max + 1) {
-                max = value;
-                continue;
-            }
-        }*/
-        max = value;
-        min = value;
-        int visibleMin = parentNode->visibleLocation(min);
-        int visibleMax = parentNode->visibleLocation(max);
-        if (visibleMin >= 0
-            && visibleMin < parentNode->visibleChildren.count()
-            && parentNode->visibleChildren.at(visibleMin) == min
-            && visibleMax >= 0) {
-            QModelIndex bottom = q->index(translateVisibleLocation(parentNode, visibleMin), 0, parentIndex);
-            QModelIndex top = q->index(translateVisibleLocation(parentNode, visibleMax), 3, parentIndex);
-            emit q->dataChanged(bottom, top);
+    }
+    std::sort(visibleRowsToUpdate.begin(), visibleRowsToUpdate.end());
+    for (int i = 0; i < visibleRowsToUpdate.count(); ) {
+        int last = i;
+        while (last + 1 < visibleRowsToUpdate.count()
+               && visibleRowsToUpdate.at(last + 1) <= visibleRowsToUpdate.at(last) + 1) {
+            ++last;
         }
-
-        /*min = QString();
-        max = QString();*/
+        const QModelIndex topLeft = q->index(visibleRowsToUpdate.at(i), 0, parentIndex);
+        const QModelIndex bottomRight = q->index(visibleRowsToUpdate.at(last), 3, parentIndex);
+        emit q->dataChanged(topLeft, bottomRight);
+        i = last + 1;
     }
 
     if (newFiles.count() > 0) {
@@ -15,6 +15,7 @@ HEADERS += graphicsview/qgraphicsgridlayout.h \
     graphicsview/qgraphicsscene_bsp_p.h \
     graphicsview/qgraphicsscene_p.h \
     graphicsview/qgraphicsscenebsptreeindex_p.h \
+    graphicsview/qgraphicsscenedynamictreeindex_p.h \
     graphicsview/qgraphicssceneevent.h \
     graphicsview/qgraphicssceneindex_p.h \
     graphicsview/qgraphicsscenelinearindex_p.h \
@@ -41,6 +42,7 @@ SOURCES += graphicsview/qgraphicsgridlayout.cpp \
     graphicsview/qgraphicsscene.cpp \
     graphicsview/qgraphicsscene_bsp.cpp \
     graphicsview/qgraphicsscenebsptreeindex.cpp \
+    graphicsview/qgraphicsscenedynamictreeindex.cpp \
     graphicsview/qgraphicssceneevent.cpp \
     graphicsview/qgraphicssceneindex.cpp \
     graphicsview/qgraphicsscenelinearindex.cpp \
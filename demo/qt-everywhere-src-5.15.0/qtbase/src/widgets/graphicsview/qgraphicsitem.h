@@ -484,6 +484,8 @@ private:
     friend class QGraphicsSceneIndexPrivate;
     friend class QGraphicsSceneBspTreeIndex;
     friend class QGraphicsSceneBspTreeIndexPrivate;
+    friend class QGraphicsSceneDynamicTreeIndex;
+    friend class QGraphicsSceneDynamicTreeIndexPrivate;
     friend class QGraphicsItemEffectSourcePrivate;
     friend class QGraphicsTransformPrivate;
 #ifndef QT_NO_GESTURES
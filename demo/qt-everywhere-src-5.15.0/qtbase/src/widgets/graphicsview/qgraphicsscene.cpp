@@ -193,6 +193,14 @@
     removing items is logarithmic. This approach is best for static scenes
     (i.e., scenes where most items do not move).
 
+    \value DynamicTreeIndex A balanced tree of bounding boxes is applied.
+    Item location is of logarithmic complexity. Each item is indexed with a
+    slightly enlarged bounding box, so moving an item by a small amount does
+    not change the index, and larger moves and removals are logarithmic. The
+    tree does not depend on the scene rect and is never rebuilt as a whole.
+    This approach is suited for large scenes where many items move
+    continuously. This value was introduced in Qt 5.16.
+
     \value NoIndex No index is applied. Item location is of linear complexity,
     as all items on the scene are searched. Adding, moving and removing items,
     however, is done in constant time. This approach is ideal for dynamic
@@ -214,6 +222,7 @@
 #include "qgraphicswidget_p.h"
 #include "qgraphicssceneindex_p.h"
 #include "qgraphicsscenebsptreeindex_p.h"
+#include "qgraphicsscenedynamictreeindex_p.h"
 #include "qgraphicsscenelinearindex_p.h"
 
 #include <QtCore/qdebug.h>
@@ -1856,7 +1865,9 @@ void QGraphicsScene::render(QPainter *painter, const QRectF &target, const QRect
 
     For the common case, the default index method BspTreeIndex works fine.  If
     your scene uses many animations and you are experiencing slowness, you can
-    disable indexing by calling \c setItemIndexMethod(NoIndex).
+    disable indexing by calling \c setItemIndexMethod(NoIndex). Large scenes
+    in which many items move continuously can be indexed with
+    DynamicTreeIndex instead.
 
     \sa bspTreeDepth
 */
@@ -1877,6 +1888,8 @@ void QGraphicsScene::setItemIndexMethod(ItemIndexMethod method)
     delete d->index;
     if (method == BspTreeIndex)
         d->index = new QGraphicsSceneBspTreeIndex(this);
+    else if (method == DynamicTreeIndex)
+        d->index = new QGraphicsSceneDynamicTreeIndex(this);
     else
         d->index = new QGraphicsSceneLinearIndex(this);
     for (int i = oldItems.size() - 1; i >= 0; --i)
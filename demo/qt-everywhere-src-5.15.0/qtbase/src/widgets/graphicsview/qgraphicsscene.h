@@ -112,6 +112,7 @@ class Q_WIDGETS_EXPORT QGraphicsScene : public QObject
 public:
     enum ItemIndexMethod {
         BspTreeIndex,
+        DynamicTreeIndex,
         NoIndex = -1
     };
     Q_ENUM(ItemIndexMethod)
@@ -0,0 +1,711 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWidgets module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+/*!
+    \class QGraphicsSceneDynamicTreeIndex
+    \brief The QGraphicsSceneDynamicTreeIndex class provides an implementation of
+    a dynamic bounding volume tree for discovering items in QGraphicsScene.
+    \since 5.16
+    \ingroup graphicsview-api
+
+    \internal
+
+    QGraphicsSceneDynamicTreeIndex keeps every indexed item in a leaf of a
+    balanced binary tree of axis-aligned bounding boxes. The box stored in a
+    leaf is a little larger than the item's scene bounding rect, so an item
+    that moves by a small amount stays inside its box and costs nothing but
+    the check. Items that leave their box are removed and reinserted, which
+    is logarithmic in the number of items. Unlike QGraphicsSceneBspTreeIndex,
+    the tree does not depend on the scene rect and is never rebuilt as a
+    whole, which makes it a good fit for large scenes in which many items
+    move continuously.
+
+    Changes are recorded when they happen and applied to the tree the next
+    time the index is queried.
+
+    \sa QGraphicsScene, QGraphicsView, QGraphicsSceneIndex, QGraphicsSceneBspTreeIndex
+*/
+
+#include <QtCore/qglobal.h>
+
+#include <private/qgraphicsscene_p.h>
+#include <private/qgraphicsscenedynamictreeindex_p.h>
+#include <private/qgraphicsscenebsptreeindex_p.h>
+#include <private/qgraphicssceneindex_p.h>
+
+#include <QtCore/qvarlengtharray.h>
+
+QT_BEGIN_NAMESPACE
+
+typedef QGraphicsSceneDynamicTreeIndexPrivate::Node DynamicTreeNode;
+
+static inline void uniteBoxes(DynamicTreeNode *node, const DynamicTreeNode &a, const DynamicTreeNode &b)
+{
+    node->x1 = qMin(a.x1, b.x1);
+    node->y1 = qMin(a.y1, b.y1);
+    node->x2 = qMax(a.x2, b.x2);
+    node->y2 = qMax(a.y2, b.y2);
+}
+
+static inline qreal perimeter(qreal x1, qreal y1, qreal x2, qreal y2)
+{
+    return 2 * ((x2 - x1) + (y2 - y1));
+}
+
+static inline qreal unitedPerimeter(const DynamicTreeNode &a, const DynamicTreeNode &b)
+{
+    return perimeter(qMin(a.x1, b.x1), qMin(a.y1, b.y1), qMax(a.x2, b.x2), qMax(a.y2, b.y2));
+}
+
+/*!
+    Constructs a private scene dynamic tree index.
+*/
+QGraphicsSceneDynamicTreeIndexPrivate::QGraphicsSceneDynamicTreeIndexPrivate(QGraphicsScene *scene)
+    : QGraphicsSceneIndexPrivate(scene),
+    root(-1),
+    freeList(-1)
+{
+}
+
+/*!
+    \internal
+
+    Returns the index of an unused node, growing the pool if needed. The
+    dirty bit of a recycled node is kept, as the node may still be queued.
+*/
+int QGraphicsSceneDynamicTreeIndexPrivate::allocateNode()
+{
+    int id;
+    uint dirty = 0;
+    if (freeList == -1) {
+        id = nodes.size();
+        nodes.append(Node());
+    } else {
+        id = freeList;
+        freeList = nodes.at(id).parent;
+        dirty = nodes.at(id).dirty;
+    }
+
+    Node &node = nodes[id];
+    node.x1 = node.y1 = node.x2 = node.y2 = 0;
+    node.item = nullptr;
+    node.parent = -1;
+    node.child1 = -1;
+    node.child2 = -1;
+    node.height = 0;
+    node.linked = 0;
+    node.dirty = dirty;
+    node.untransformable = 0;
+    return id;
+}
+
+/*!
+    \internal
+*/
+void QGraphicsSceneDynamicTreeIndexPrivate::freeNode(int id)
+{
+    Node &node = nodes[id];
+    node.item = nullptr;
+    node.child1 = -1;
+    node.child2 = -1;
+    node.height = -1;
+    node.linked = 0;
+    node.untransformable = 0;
+    node.parent = freeList;
+    freeList = id;
+}
+
+/*!
+    \internal
+
+    Recomputes the height and box of the internal node \a id from its children.
+*/
+void QGraphicsSceneDynamicTreeIndexPrivate::refit(int id)
+{
+    Node &node = nodes[id];
+    const Node &child1 = nodes.at(node.child1);
+    const Node &child2 = nodes.at(node.child2);
+    node.height = 1 + qMax(child1.height, child2.height);
+    uniteBoxes(&node, child1, child2);
+}
+
+/*!
+    \internal
+
+    Links \a leaf into the tree next to the node whose box grows the least
+    from the union, then refits and rebalances its ancestors.
+*/
+void QGraphicsSceneDynamicTreeIndexPrivate::insertLeaf(int leaf)
+{
+    nodes[leaf].linked = 1;
+    if (root == -1) {
+        root = leaf;
+        nodes[leaf].parent = -1;
+        return;
+    }
+
+    int index = root;
+    while (!nodes.at(index).isLeaf()) {
+        const Node &leafNode = nodes.at(leaf);
+        const Node &node = nodes.at(index);
+        const Node &child1 = nodes.at(node.child1);
+        const Node &child2 = nodes.at(node.child2);
+
+        // Cost of pairing the leaf with this node, and the minimum cost of
+        // pushing it further down, which enlarges this node in any case.
+        const qreal combined = unitedPerimeter(node, leafNode);
+        const qreal cost = 2 * combined;
+        const qreal inheritance = 2 * (combined - perimeter(node.x1, node.y1, node.x2, node.y2));
+
+        qreal cost1 = unitedPerimeter(child1, leafNode) + inheritance;
+        if (!child1.isLeaf())
+            cost1 -= perimeter(child1.x1, child1.y1, child1.x2, child1.y2);
+        qreal cost2 = unitedPerimeter(child2, leafNode) + inheritance;
+        if (!child2.isLeaf())
+            cost2 -= perimeter(child2.x1, child2.y1, child2.x2, child2.y2);
+
+        if (cost < cost1 && cost < cost2)
+            break;
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    const int sibling = index;
+    const int oldParent = nodes.at(sibling).parent;
+    const int newParent = allocateNode();
+    Node &parentNode = nodes[newParent];
+    parentNode.parent = oldParent;
+    parentNode.child1 = sibling;
+    parentNode.child2 = leaf;
+    parentNode.height = nodes.at(sibling).height + 1;
+    uniteBoxes(&parentNode, nodes.at(sibling), nodes.at(leaf));
+
+    if (oldParent != -1) {
+        Node &grandParent = nodes[oldParent];
+        if (grandParent.child1 == sibling)
+            grandParent.child1 = newParent;
+        else
+            grandParent.child2 = newParent;
+    } else {
+        root = newParent;
+    }
+    nodes[sibling].parent = newParent;
+    nodes[leaf].parent = newParent;
+
+    for (index = newParent; index != -1; index = nodes.at(index).parent) {
+        index = balance(index);
+        refit(index);
+    }
+}
+
+/*!
+    \internal
+
+    Unlinks \a leaf from the tree. The node itself stays allocated.
+*/
+void QGraphicsSceneDynamicTreeIndexPrivate::removeLeaf(int leaf)
+{
+    nodes[leaf].linked = 0;
+    if (leaf == root) {
+        root = -1;
+        return;
+    }
+
+    const int parent = nodes.at(leaf).parent;
+    const int grandParent = nodes.at(parent).parent;
+    const int sibling = nodes.at(parent).child1 == leaf ? nodes.at(parent).child2 : nodes.at(parent).child1;
+
+    freeNode(parent);
+    nodes[leaf].parent = -1;
+    nodes[sibling].parent = grandParent;
+    if (grandParent == -1) {
+        root = sibling;
+        return;
+    }
+
+    Node &grandParentNode = nodes[grandParent];
+    if (grandParentNode.child1 == parent)
+        grandParentNode.child1 = sibling;
+    else
+        grandParentNode.child2 = sibling;
+
+    for (int index = grandParent; index != -1; index = nodes.at(index).parent) {
+        index = balance(index);
+        refit(index);
+    }
+}
+
+/*!
+    \internal
+
+    Performs a left or right rotation if the subtree rooted at \a iA is
+    imbalanced, and returns the new root of the subtree.
+*/
+int QGraphicsSceneDynamicTreeIndexPrivate::balance(int iA)
+{
+    Node *a = &nodes[iA];
+    if (a->isLeaf() || a->height < 2)
+        return iA;
+
+    const int iB = a->child1;
+    const int iC = a->child2;
+    Node *b = &nodes[iB];
+    Node *c = &nodes[iC];
+    const int balance = c->height - b->height;
+
+    if (balance > 1) {
+        // Rotate C up.
+        const int iF = c->child1;
+        const int iG = c->child2;
+        Node *f = &nodes[iF];
+        Node *g = &nodes[iG];
+
+        c->child1 = iA;
+        c->parent = a->parent;
+        a->parent = iC;
+        if (c->parent != -1) {
+            Node &parent = nodes[c->parent];
+            if (parent.child1 == iA)
+                parent.child1 = iC;
+            else
+                parent.child2 = iC;
+        } else {
+            root = iC;
+        }
+
+        if (f->height > g->height) {
+            c->child2 = iF;
+            a->child2 = iG;
+            g->parent = iA;
+            uniteBoxes(a, *b, *g);
+            uniteBoxes(c, *a, *f);
+            a->height = 1 + qMax(b->height, g->height);
+            c->height = 1 + qMax(a->height, f->height);
+        } else {
+            c->child2 = iG;
+            a->child2 = iF;
+            f->parent = iA;
+            uniteBoxes(a, *b, *f);
+            uniteBoxes(c, *a, *g);
+            a->height = 1 + qMax(b->height, f->height);
+            c->height = 1 + qMax(a->height, g->height);
+        }
+        return iC;
+    }
+
+    if (balance < -1) {
+        // Rotate B up.
+        const int iD = b->child1;
+        const int iE = b->child2;
+        Node *d = &nodes[iD];
+        Node *e = &nodes[iE];
+
+        b->child1 = iA;
+        b->parent = a->parent;
+        a->parent = iB;
+        if (b->parent != -1) {
+            Node &parent = nodes[b->parent];
+            if (parent.child1 == iA)
+                parent.child1 = iB;
+            else
+                parent.child2 = iB;
+        } else {
+            root = iB;
+        }
+
+        if (d->height > e->height) {
+            b->child2 = iD;
+            a->child1 = iE;
+            e->parent = iA;
+            uniteBoxes(a, *c, *e);
+            uniteBoxes(b, *a, *d);
+            a->height = 1 + qMax(c->height, e->height);
+            b->height = 1 + qMax(a->height, d->height);
+        } else {
+            b->child2 = iE;
+            a->child1 = iD;
+            d->parent = iA;
+            uniteBoxes(a, *c, *d);
+            uniteBoxes(b, *a, *e);
+            a->height = 1 + qMax(c->height, d->height);
+            b->height = 1 + qMax(a->height, e->height);
+        }
+        return iB;
+    }
+
+    return iA;
+}
+
+/*!
+    \internal
+
+    Queues the leaf of \a item, and of its descendants if \a recursive is
+    true, for the next updateIndex().
+*/
+void QGraphicsSceneDynamicTreeIndexPrivate::markDirty(const QGraphicsItem *item, bool recursive)
+{
+    const int id = item->d_ptr->index;
+    if (id != -1 && !nodes.at(id).dirty) {
+        nodes[id].dirty = 1;
+        dirtyNodes << id;
+    }
+
+    if (recursive) {
+        for (int i = 0; i < item->d_ptr->children.size(); ++i)
+            markDirty(item->d_ptr->children.at(i), recursive);
+    }
+}
+
+/*!
+    \internal
+
+    Brings the tree up to date with all queued leaves. A leaf is only
+    relinked if its item left the enlarged box it was inserted with, or
+    shrank well below it.
+*/
+void QGraphicsSceneDynamicTreeIndexPrivate::updateIndex()
+{
+    for (int i = 0; i < dirtyNodes.size(); ++i) {
+        const int id = dirtyNodes.at(i);
+        Node &node = nodes[id];
+        node.dirty = 0;
+
+        // The node was freed, or recycled as an internal node.
+        QGraphicsItem *item = node.item;
+        if (!item)
+            continue;
+
+        if (item->d_ptr->itemIsUntransformable()) {
+            if (node.linked)
+                removeLeaf(id);
+            if (!node.untransformable) {
+                node.untransformable = 1;
+                untransformableItems << item;
+            }
+            continue;
+        }
+        if (node.untransformable) {
+            node.untransformable = 0;
+            untransformableItems.removeOne(item);
+        }
+        if (item->d_ptr->ancestorFlags & QGraphicsItemPrivate::AncestorClipsChildren
+            || item->d_ptr->ancestorFlags & QGraphicsItemPrivate::AncestorContainsChildren) {
+            if (node.linked)
+                removeLeaf(id);
+            continue;
+        }
+
+        const QRectF rect = item->d_ptr->sceneEffectiveBoundingRect();
+        const qreal margin = qMax(qreal(1), qMax(rect.width(), rect.height()) / 8);
+        if (node.linked) {
+            if (rect.left() >= node.x1 && rect.top() >= node.y1
+                && rect.right() <= node.x2 && rect.bottom() <= node.y2
+                && node.x2 - node.x1 <= 2 * (rect.width() + 2 * margin)
+                && node.y2 - node.y1 <= 2 * (rect.height() + 2 * margin)) {
+                continue;
+            }
+            removeLeaf(id);
+        }
+
+        node.x1 = rect.left() - margin;
+        node.y1 = rect.top() - margin;
+        node.x2 = rect.right() + margin;
+        node.y2 = rect.bottom() + margin;
+        insertLeaf(id);
+    }
+    dirtyNodes.clear();
+}
+
+/*!
+    \internal
+
+    Resets the index of all items in the pool.
+*/
+void QGraphicsSceneDynamicTreeIndexPrivate::resetItems()
+{
+    for (int i = 0; i < nodes.size(); ++i) {
+        if (QGraphicsItem *item = nodes.at(i).item) {
+            Q_ASSERT(!item->d_ptr->itemDiscovered);
+            item->d_ptr->index = -1;
+        }
+    }
+}
+
+void QGraphicsSceneDynamicTreeIndexPrivate::addItem(QGraphicsItem *item)
+{
+    if (!item)
+        return;
+
+    // Indexing requires sceneBoundingRect(), but because \a item might
+    // not be completely constructed at this point, only queue it here.
+    if (item->d_ptr->index != -1) {
+        qWarning("QGraphicsSceneDynamicTreeIndex::addItem: item has already been added to this index");
+        return;
+    }
+
+    const int id = allocateNode();
+    nodes[id].item = item;
+    item->d_ptr->index = id;
+    markDirty(item, /*recursive=*/false);
+}
+
+void QGraphicsSceneDynamicTreeIndexPrivate::removeItem(QGraphicsItem *item)
+{
+    if (!item)
+        return;
+
+    // This only touches the node pool, so it is safe to call from the
+    // item's destructor.
+    const int id = item->d_ptr->index;
+    if (id == -1)
+        return;
+    Q_ASSERT(id < nodes.size() && nodes.at(id).item == item);
+    Q_ASSERT(!item->d_ptr->itemDiscovered);
+
+    if (nodes.at(id).linked)
+        removeLeaf(id);
+    if (nodes.at(id).untransformable)
+        untransformableItems.removeOne(item);
+    freeNode(id);
+    item->d_ptr->index = -1;
+}
+
+QList<QGraphicsItem *> QGraphicsSceneDynamicTreeIndexPrivate::estimateItems(const QRectF &rect, Qt::SortOrder order,
+                                                                            bool onlyTopLevelItems)
+{
+    Q_Q(QGraphicsSceneDynamicTreeIndex);
+    if (onlyTopLevelItems && rect.isNull())
+        return q->QGraphicsSceneIndex::estimateTopLevelItems(rect, order);
+
+    updateIndex();
+
+    QList<QGraphicsItem *> rectItems;
+    if (root != -1) {
+        const QRectF r = rect.normalized();
+        const qreal x1 = r.left();
+        const qreal y1 = r.top();
+        const qreal x2 = r.right();
+        const qreal y2 = r.bottom();
+
+        QVarLengthArray<int, 64> stack;
+        stack.append(root);
+        while (!stack.isEmpty()) {
+            const Node &node = nodes.at(stack.last());
+            stack.removeLast();
+            if (node.x2 < x1 || node.x1 > x2 || node.y2 < y1 || node.y1 > y2)
+                continue;
+
+            if (!node.isLeaf()) {
+                stack.append(node.child1);
+                stack.append(node.child2);
+                continue;
+            }
+
+            QGraphicsItem *item = node.item;
+            if (onlyTopLevelItems && item->d_ptr->parent)
+                item = item->topLevelItem();
+            if (!item->d_ptr->itemDiscovered && item->d_ptr->visible) {
+                item->d_ptr->itemDiscovered = 1;
+                rectItems << item;
+            }
+        }
+
+        for (int i = 0; i < rectItems.size(); ++i)
+            rectItems.at(i)->d_ptr->itemDiscovered = 0;
+    }
+
+    if (onlyTopLevelItems) {
+        for (int i = 0; i < untransformableItems.size(); ++i) {
+            QGraphicsItem *item = untransformableItems.at(i);
+            if (!item->d_ptr->parent) {
+                rectItems << item;
+            } else {
+                item = item->topLevelItem();
+                if (!rectItems.contains(item))
+                    rectItems << item;
+            }
+        }
+    } else {
+        rectItems += untransformableItems;
+    }
+
+    QGraphicsSceneBspTreeIndexPrivate::sortItems(&rectItems, order, /*cached=*/false, onlyTopLevelItems);
+    return rectItems;
+}
+
+/*!
+    Constructs a dynamic tree index for the given \a scene.
+*/
+QGraphicsSceneDynamicTreeIndex::QGraphicsSceneDynamicTreeIndex(QGraphicsScene *scene)
+    : QGraphicsSceneIndex(*new QGraphicsSceneDynamicTreeIndexPrivate(scene), scene)
+{
+}
+
+QGraphicsSceneDynamicTreeIndex::~QGraphicsSceneDynamicTreeIndex()
+{
+    Q_D(QGraphicsSceneDynamicTreeIndex);
+    d->resetItems();
+}
+
+/*!
+    \internal
+    Clear the whole index.
+*/
+void QGraphicsSceneDynamicTreeIndex::clear()
+{
+    Q_D(QGraphicsSceneDynamicTreeIndex);
+    d->resetItems();
+    d->nodes.clear();
+    d->root = -1;
+    d->freeList = -1;
+    d->dirtyNodes.clear();
+    d->untransformableItems.clear();
+}
+
+/*!
+    Add the \a item into the index.
+*/
+void QGraphicsSceneDynamicTreeIndex::addItem(QGraphicsItem *item)
+{
+    Q_D(QGraphicsSceneDynamicTreeIndex);
+    d->addItem(item);
+}
+
+/*!
+    Remove the \a item from the index.
+*/
+void QGraphicsSceneDynamicTreeIndex::removeItem(QGraphicsItem *item)
+{
+    Q_D(QGraphicsSceneDynamicTreeIndex);
+    d->removeItem(item);
+}
+
+/*!
+    \internal
+    Queue the \a item and its descendants for reindexing, as their scene
+    bounding rects are about to change.
+*/
+void QGraphicsSceneDynamicTreeIndex::prepareBoundingRectChange(const QGraphicsItem *item)
+{
+    if (!item)
+        return;
+
+    Q_D(QGraphicsSceneDynamicTreeIndex);
+    d->markDirty(item, /*recursive=*/true);
+}
+
+/*!
+    Returns an estimation visible items that are either inside or
+    intersect with the specified \a rect and return a list sorted using \a order.
+*/
+QList<QGraphicsItem *> QGraphicsSceneDynamicTreeIndex::estimateItems(const QRectF &rect, Qt::SortOrder order) const
+{
+    Q_D(const QGraphicsSceneDynamicTreeIndex);
+    return const_cast<QGraphicsSceneDynamicTreeIndexPrivate*>(d)->estimateItems(rect, order);
+}
+
+QList<QGraphicsItem *> QGraphicsSceneDynamicTreeIndex::estimateTopLevelItems(const QRectF &rect, Qt::SortOrder order) const
+{
+    Q_D(const QGraphicsSceneDynamicTreeIndex);
+    return const_cast<QGraphicsSceneDynamicTreeIndexPrivate*>(d)->estimateItems(rect, order, /*onlyTopLevels=*/true);
+}
+
+/*!
+    \fn QList<QGraphicsItem *> QGraphicsSceneDynamicTreeIndex::items(Qt::SortOrder order = Qt::DescendingOrder) const;
+
+    Return all items in the index and sort them using \a order.
+*/
+QList<QGraphicsItem *> QGraphicsSceneDynamicTreeIndex::items(Qt::SortOrder order) const
+{
+    Q_D(const QGraphicsSceneDynamicTreeIndex);
+    QList<QGraphicsItem *> itemList;
+    for (int i = 0; i < d->nodes.size(); ++i) {
+        if (QGraphicsItem *item = d->nodes.at(i).item)
+            itemList << item;
+    }
+
+    QGraphicsSceneBspTreeIndexPrivate::sortItems(&itemList, order, /*cached=*/false);
+    return itemList;
+}
+
+/*!
+    \internal
+
+    Returns the height of the tree, after applying all pending changes.
+    A balanced tree with n leaves has a height close to log2(n).
+*/
+int QGraphicsSceneDynamicTreeIndex::treeHeight() const
+{
+    Q_D(const QGraphicsSceneDynamicTreeIndex);
+    const_cast<QGraphicsSceneDynamicTreeIndexPrivate*>(d)->updateIndex();
+    return d->root == -1 ? 0 : d->nodes.at(d->root).height;
+}
+
+/*!
+    \internal
+
+    This method react to the \a change of the \a item and queues it and its
+    descendants for reindexing when they might move into or out of the tree.
+*/
+void QGraphicsSceneDynamicTreeIndex::itemChange(const QGraphicsItem *item, QGraphicsItem::GraphicsItemChange change, const void *const value)
+{
+    Q_D(QGraphicsSceneDynamicTreeIndex);
+    switch (change) {
+    case QGraphicsItem::ItemFlagsChange: {
+        // Handle ItemIgnoresTransformations and children clipping
+        QGraphicsItem::GraphicsItemFlags newFlags = *static_cast<const QGraphicsItem::GraphicsItemFlags *>(value);
+        const uint relevantFlags = QGraphicsItem::ItemIgnoresTransformations
+                                   | QGraphicsItem::ItemClipsChildrenToShape
+                                   | QGraphicsItem::ItemContainsChildrenInShape;
+        if ((item->d_ptr->flags & relevantFlags) != (uint(newFlags) & relevantFlags))
+            d->markDirty(item, /*recursive=*/true);
+        break;
+    }
+    case QGraphicsItem::ItemParentChange:
+        // The new ancestors decide whether the item and its descendants
+        // are untransformable or clipped; this is evaluated lazily.
+        d->markDirty(item, /*recursive=*/true);
+        break;
+    default:
+        break;
+    }
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qgraphicsscenedynamictreeindex_p.cpp"
@@ -0,0 +1,143 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWidgets module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#ifndef QGRAPHICSSCENEDYNAMICTREEINDEX_H
+#define QGRAPHICSSCENEDYNAMICTREEINDEX_H
+
+#include <QtWidgets/private/qtwidgetsglobal_p.h>
+
+#include "qgraphicssceneindex_p.h"
+#include "qgraphicsitem_p.h"
+
+#include <QtCore/qrect.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qvector.h>
+
+QT_REQUIRE_CONFIG(graphicsview);
+
+QT_BEGIN_NAMESPACE
+
+class QGraphicsScene;
+class QGraphicsSceneDynamicTreeIndexPrivate;
+
+class Q_AUTOTEST_EXPORT QGraphicsSceneDynamicTreeIndex : public QGraphicsSceneIndex
+{
+    Q_OBJECT
+public:
+    QGraphicsSceneDynamicTreeIndex(QGraphicsScene *scene = nullptr);
+    ~QGraphicsSceneDynamicTreeIndex();
+
+    QList<QGraphicsItem *> estimateItems(const QRectF &rect, Qt::SortOrder order) const override;
+    QList<QGraphicsItem *> estimateTopLevelItems(const QRectF &rect, Qt::SortOrder order) const override;
+    QList<QGraphicsItem *> items(Qt::SortOrder order = Qt::DescendingOrder) const override;
+
+    int treeHeight() const;
+
+protected:
+    void clear() override;
+
+    void addItem(QGraphicsItem *item) override;
+    void removeItem(QGraphicsItem *item) override;
+    void prepareBoundingRectChange(const QGraphicsItem *item) override;
+
+    void itemChange(const QGraphicsItem *item, QGraphicsItem::GraphicsItemChange change, const void *const value) override;
+
+private:
+    Q_DECLARE_PRIVATE(QGraphicsSceneDynamicTreeIndex)
+    Q_DISABLE_COPY_MOVE(QGraphicsSceneDynamicTreeIndex)
+};
+
+class QGraphicsSceneDynamicTreeIndexPrivate : public QGraphicsSceneIndexPrivate
+{
+    Q_DECLARE_PUBLIC(QGraphicsSceneDynamicTreeIndex)
+public:
+    QGraphicsSceneDynamicTreeIndexPrivate(QGraphicsScene *scene);
+
+    // Nodes live in one pool and refer to each other by index. Leaves hold
+    // an item and a box that is slightly larger than the item's scene
+    // bounding rect, so that small moves do not touch the tree at all.
+    struct Node {
+        qreal x1, y1, x2, y2;
+        QGraphicsItem *item;
+        int parent;             // next free node while the node is unused
+        int child1;
+        int child2;
+        int height;             // -1 while unused, 0 for leaves
+        uint linked : 1;        // leaf is part of the tree
+        uint dirty : 1;         // node is queued in dirtyNodes
+        uint untransformable : 1;
+
+        bool isLeaf() const { return child1 == -1; }
+    };
+
+    QVector<Node> nodes;
+    int root;
+    int freeList;
+    QVector<int> dirtyNodes;
+    QList<QGraphicsItem *> untransformableItems;
+
+    int allocateNode();
+    void freeNode(int id);
+    void insertLeaf(int leaf);
+    void removeLeaf(int leaf);
+    int balance(int a);
+    void refit(int id);
+    void markDirty(const QGraphicsItem *item, bool recursive);
+    void updateIndex();
+    void resetItems();
+
+    void addItem(QGraphicsItem *item);
+    void removeItem(QGraphicsItem *item);
+    QList<QGraphicsItem *> estimateItems(const QRectF &rect, Qt::SortOrder order, bool onlyTopLevelItems = false);
+};
+
+QT_END_NAMESPACE
+
+#endif // QGRAPHICSSCENEDYNAMICTREEINDEX_H
@@ -1903,6 +1903,10 @@ void QHeaderView::sectionsInserted(const QModelIndex &parent,
 
     QHeaderViewPrivate::SectionItem section(d->defaultSectionSize, d->globalResizeMode);
     d->sectionStartposRecalc = true;
+    if (d->sectionItems.isEmpty())
+        d->uniformSectionSize = d->defaultSectionSize;
+    else if (d->uniformSectionSize != d->defaultSectionSize)
+        d->uniformSectionSize = -1;
 
     if (d->sectionItems.isEmpty() || insertAt >= d->sectionItems.count()) {
         int insertLength = d->defaultSectionSize * insertCount;
@@ -2128,6 +2132,8 @@ void QHeaderViewPrivate::_q_sectionsAboutToBeChanged(const QList<QPersistentMode
             if (itemRef.size != lastSectionSize) {
                 length += lastSectionSize - itemRef.size;
                 itemRef.size = lastSectionSize;
+                sectionStartposRecalc = true;
+                uniformSectionSize = -1;
             }
         }
     }
@@ -2202,6 +2208,7 @@ void QHeaderViewPrivate::_q_sectionsChanged(const QList<QPersistentModelIndex> &
     }
     // reset sections
     sectionItems.fill(SectionItem(defaultSectionSize, globalResizeMode), newCount);
+    uniformSectionSize = newCount > 0 ? defaultSectionSize : -1;
 
     // all hidden sections are in oldPersistentSections
     hiddenSectionSize.clear();
@@ -2219,6 +2226,8 @@ void QHeaderViewPrivate::_q_sectionsChanged(const QList<QPersistentModelIndex> &
         if (newVisualIndex < sectionItems.count()) {
             auto &newSection = sectionItems[newVisualIndex];
             newSection = item.section;
+            if (newSection.size != uint(uniformSectionSize))
+                uniformSectionSize = -1;
 
             if (newSection.isHidden) {
                 // otherwise setSectionHidden will return without doing anything
@@ -3403,6 +3412,8 @@ bool QHeaderViewPrivate::isSectionSelected(int section) const
 
 bool QHeaderViewPrivate::isFirstVisibleSection(int section) const
 {
+    if (uniformSectionSize >= 0)
+        return uniformSectionSize > 0 && section == 0;
     if (sectionStartposRecalc)
         recalcSectionStartPos();
     const SectionItem &item = sectionItems.at(section);
@@ -3411,6 +3422,8 @@ bool QHeaderViewPrivate::isFirstVisibleSection(int section) const
 
 bool QHeaderViewPrivate::isLastVisibleSection(int section) const
 {
+    if (uniformSectionSize >= 0)
+        return uniformSectionSize > 0 && (section + 1) * uniformSectionSize == length;
     if (sectionStartposRecalc)
         recalcSectionStartPos();
     const SectionItem &item = sectionItems.at(section);
@@ -3614,10 +3627,15 @@ void QHeaderViewPrivate::resizeSections(QHeaderView::ResizeMode globalMode, bool
 void QHeaderViewPrivate::createSectionItems(int start, int end, int size, QHeaderView::ResizeMode mode)
 {
     int sizePerSection = size / (end - start + 1);
-    if (end >= sectionItems.count()) {
+    const int oldCount = sectionItems.count();
+    if (end >= oldCount) {
         sectionItems.resize(end + 1);
         sectionStartposRecalc = true;
     }
+    if (oldCount == 0 && start == 0)
+        uniformSectionSize = sizePerSection;
+    else if (start > oldCount || sizePerSection != uniformSectionSize)
+        uniformSectionSize = -1;
     SectionItem *sectiondata = sectionItems.data();
     for (int i = start; i <= end; ++i) {
         length += (sizePerSection - sectiondata[i].size);
@@ -3647,6 +3665,7 @@ void QHeaderViewPrivate::clear()
         sectionSelected.clear();
         hiddenSectionSize.clear();
         sectionItems.clear();
+        uniformSectionSize = -1;
         lastSectionLogicalIdx = -1;
         invalidateCachedSizeHint();
     }
@@ -3805,6 +3824,8 @@ void QHeaderViewPrivate::setDefaultSectionSize(int size)
         }
     }
     sectionStartposRecalc = true;
+    // hidden sections keep a size of 0, so the rest can only be uniform without them
+    uniformSectionSize = (hiddenSectionSize.isEmpty() && !sectionItems.isEmpty()) ? size : -1;
     if (hasAutoResizeSections())
         doDelayedResizeSections();
     viewport->update();
@@ -3824,10 +3845,14 @@ void QHeaderViewPrivate::updateDefaultSectionSizeFromStyle()
 void QHeaderViewPrivate::recalcSectionStartPos() const // linear (but fast)
 {
     int pixelpos = 0;
+    int uniformSize = sectionItems.isEmpty() ? -1 : int(sectionItems.first().size);
     for (const SectionItem &i : sectionItems) {
         i.calculated_startpos = pixelpos; // write into const mutable
         pixelpos += i.size;
+        if (int(i.size) != uniformSize)
+            uniformSize = -1;
     }
+    uniformSectionSize = uniformSize;
     sectionStartposRecalc = false;
 }
 
@@ -3849,6 +3874,10 @@ int QHeaderViewPrivate::headerSectionSize(int visual) const
 int QHeaderViewPrivate::headerSectionPosition(int visual) const
 {
     if (visual < sectionCount() && visual >= 0) {
+        // while all sections share one size the position follows directly
+        // from the index, and the start positions need not be recalculated
+        if (uniformSectionSize >= 0)
+            return visual * uniformSectionSize;
         if (sectionStartposRecalc)
             recalcSectionStartPos();
         return sectionItems.at(visual).calculated_startpos;
@@ -3858,6 +3887,12 @@ int QHeaderViewPrivate::headerSectionPosition(int visual) const
 
 int QHeaderViewPrivate::headerVisualIndexAt(int position) const
 {
+    if (uniformSectionSize >= 0) {
+        if (uniformSectionSize == 0 || position < 0)
+            return -1;
+        const int visual = position / uniformSectionSize;
+        return visual < sectionItems.count() ? visual : -1;
+    }
     if (sectionStartposRecalc)
         recalcSectionStartPos();
     int startidx = 0;
@@ -106,6 +106,7 @@ public:
 #endif
           globalResizeMode(QHeaderView::Interactive),
           sectionStartposRecalc(true),
+          uniformSectionSize(-1),
           resizeContentsPrecision(1000)
     {}
 
@@ -301,6 +302,7 @@ public:
 #endif
     QHeaderView::ResizeMode globalResizeMode;
     mutable bool sectionStartposRecalc;
+    mutable int uniformSectionSize; // size shared by all sections, or -1 if they differ
     int resizeContentsPrecision;
     // header sections
 
@@ -487,9 +487,12 @@ void QWidgetPrivate::moveRect(const QRect &rect, int dx, int dy)
             overlappedExpose = (overlappedRegion(sourceRect) | overlappedRegion(destRect)) & clipR;
 
             const qreal factor = QHighDpiScaling::factor(q->windowHandle());
-            if (overlappedExpose.isEmpty() || qFloor(factor) == factor) {
-                const QVector<QRect> rectsToScroll
-                        = getSortedRectsToScroll(QRegion(sourceRect) - overlappedExpose, dx, dy);
+            const bool integerScaling = qFloor(factor) == factor;
+            if (overlappedExpose.isEmpty() || integerScaling) {
+                QRegion toScroll = QRegion(sourceRect) - overlappedExpose;
+                if (integerScaling)
+                    toScroll = repaintManager->blittableRegion(toScroll, pw);
+                const QVector<QRect> rectsToScroll = getSortedRectsToScroll(toScroll, dx, dy);
                 for (QRect rect : rectsToScroll) {
                     if (repaintManager->bltRect(rect, dx, dy, pw)) {
                         childExpose -= rect.translated(dx, dy);
@@ -569,9 +572,12 @@ void QWidgetPrivate::scrollRect(const QRect &rect, int dx, int dy)
         QRegion childExpose(scrollRect);
 
         const qreal factor = QHighDpiScaling::factor(q->windowHandle());
-        if (overlappedExpose.isEmpty() || qFloor(factor) == factor) {
-            const QVector<QRect> rectsToScroll
-                    = getSortedRectsToScroll(QRegion(sourceRect) - overlappedExpose, dx, dy);
+        const bool integerScaling = qFloor(factor) == factor;
+        if (overlappedExpose.isEmpty() || integerScaling) {
+            QRegion toScroll = QRegion(sourceRect) - overlappedExpose;
+            if (integerScaling)
+                toScroll = repaintManager->blittableRegion(toScroll, q);
+            const QVector<QRect> rectsToScroll = getSortedRectsToScroll(toScroll, dx, dy);
             for (const QRect &rect : rectsToScroll) {
                 if (repaintManager->bltRect(rect, dx, dy, q)) {
                     childExpose -= rect.translated(dx, dy);
@@ -624,6 +630,23 @@ bool QWidgetRepaintManager::bltRect(const QRect &rect, int dx, int dy, QWidget *
     return store->scroll(tlwRect, dx, dy);
 }
 
+/*
+    Returns the part of \a region, in \a widget's coordinate system, whose
+    content in the backing store is up to date and can be moved with bltRect().
+
+    Splitting the region around the invalid parts lets the rest be scrolled,
+    instead of bltRect() refusing the whole rectangle and everything in it
+    being repainted. Callers only do this when the high-DPI scale factor is
+    an integer, as blitting arbitrary sub-rectangles would otherwise leave
+    rounding artifacts along their edges.
+*/
+QRegion QWidgetRepaintManager::blittableRegion(const QRegion &region, QWidget *widget) const
+{
+    if (dirty.isEmpty())
+        return region;
+    return region - dirty.translated(-widget->mapTo(tlw, QPoint()));
+}
+
 // ---------------------------------------------------------------------------
 
 #ifndef QT_NO_OPENGL
@@ -102,6 +102,7 @@ public:
     QRegion staticContents(QWidget *widget = nullptr, const QRect &withinClipRect = QRect()) const;
 
     bool bltRect(const QRect &rect, int dx, int dy, QWidget *widget);
+    QRegion blittableRegion(const QRegion &region, QWidget *widget) const;
 
 private:
     void updateLists(QWidget *widget);
@@ -878,6 +878,21 @@ QString QCommonStylePrivate::calculateElidedText(const QString &text, const QTex
 {
     QTextLayout textLayout(text, font);
     textLayout.setTextOption(textOption);
+    return calculateElidedText(textLayout, textRect, valign, textElideMode, flags,
+                               lastVisibleLineShouldBeElided, paintStartPosition);
+}
+
+/*! \internal
+    Lays out \a textLayout, which must have its text and text option set, and
+    returns the text that fits into \a textRect. If the returned text is the
+    same as the text of \a textLayout, the layout can be drawn as it is.
+*/
+QString QCommonStylePrivate::calculateElidedText(QTextLayout &textLayout, const QRect &textRect,
+                                                 const Qt::Alignment valign,
+                                                 Qt::TextElideMode textElideMode, int flags,
+                                                 bool lastVisibleLineShouldBeElided, QPointF *paintStartPosition) const
+{
+    const QFont font = textLayout.font();
 
     // In AlignVCenter mode when more than one line is displayed and the height only allows
     // some of the lines it makes no sense to display those. From a users perspective it makes
@@ -1026,14 +1041,17 @@ void QCommonStylePrivate::viewItemDrawText(QPainter *p, const QStyleOptionViewIt
     textOption.setAlignment(QStyle::visualAlignment(option->direction, option->displayAlignment));
 
     QPointF paintPosition;
-    const QString newText = calculateElidedText(option->text, textOption,
-                                                option->font, textRect, option->displayAlignment,
+    QTextLayout textLayout(option->text, option->font);
+    textLayout.setTextOption(textOption);
+    const QString newText = calculateElidedText(textLayout, textRect, option->displayAlignment,
                                                 option->textElideMode, 0,
                                                 true, &paintPosition);
 
-    QTextLayout textLayout(newText, option->font);
-    textLayout.setTextOption(textOption);
-    viewItemTextLayout(textLayout, textRect.width());
+    // Most items fit; only lay the text out again if it had to be elided.
+    if (newText != option->text) {
+        textLayout.setText(newText);
+        viewItemTextLayout(textLayout, textRect.width());
+    }
     textLayout.draw(p, paintPosition);
 }
 
@@ -3139,11 +3157,10 @@ QRect QCommonStyle::subElementRect(SubElement sr, const QStyleOption *opt,
         if (const QStyleOptionViewItem *vopt = qstyleoption_cast<const QStyleOptionViewItem *>(opt)) {
             if (!d->isViewItemCached(*vopt)) {
                 d->viewItemLayout(vopt, &d->checkRect, &d->decorationRect, &d->displayRect, false);
-                if (d->cachedOption) {
-                    delete d->cachedOption;
-                    d->cachedOption = nullptr;
-                }
-                d->cachedOption = new QStyleOptionViewItem(*vopt);
+                if (d->cachedOption)
+                    *d->cachedOption = *vopt;
+                else
+                    d->cachedOption = new QStyleOptionViewItem(*vopt);
             }
             if (sr == SE_ItemViewItemCheckIndicator)
                 r = d->checkRect;
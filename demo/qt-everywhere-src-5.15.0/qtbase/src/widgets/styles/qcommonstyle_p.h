@@ -62,6 +62,7 @@ QT_BEGIN_NAMESPACE
 //
 
 class QStringList;
+class QTextLayout;
 class QTextOption;
 
 // Private class
@@ -90,6 +91,9 @@ public:
                                 const QFont &font, const QRect &textRect, const Qt::Alignment valign,
                                 Qt::TextElideMode textElideMode, int flags,
                                 bool lastVisibleLineShouldBeElided, QPointF *paintStartPosition) const;
+    QString calculateElidedText(QTextLayout &textLayout, const QRect &textRect, const Qt::Alignment valign,
+                                Qt::TextElideMode textElideMode, int flags,
+                                bool lastVisibleLineShouldBeElided, QPointF *paintStartPosition) const;
 #if QT_CONFIG(itemviews)
     void viewItemDrawText(QPainter *p, const QStyleOptionViewItem *option, const QRect &rect) const;
     void viewItemLayout(const QStyleOptionViewItem *opt,  QRect *checkRect,
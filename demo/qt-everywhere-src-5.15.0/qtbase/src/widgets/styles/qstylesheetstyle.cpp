@@ -67,6 +67,7 @@
 #include "private/qabstractscrollarea_p.h"
 #include <qtooltip.h>
 #include <qshareddata.h>
+#include <qvarlengtharray.h>
 #if QT_CONFIG(toolbutton)
 #include <qtoolbutton.h>
 #endif
@@ -1597,6 +1598,51 @@ private:
     mutable QHash<const QObject *, QHash<QString, QString> > m_attributeCache;
 };
 
+/*!
+    \internal
+
+    Returns what the selectors of the parsed style sheets can see of \a obj:
+    the style sheets that apply to it, and the class, relevant object name
+    and attribute values of the object and, if any selector has combinators,
+    of its ancestors.
+*/
+static QStyleSheetSelectorSignature selectorSignature(const QStyleSheetStyleSelector &styleSelector,
+                                                      const QObject *obj,
+                                                      const QVarLengthArray<const QObject *, 8> &styleSheetOwners,
+                                                      const QStyle *baseStyle)
+{
+    const QStyleSheetSelectorInfo &info = styleSheetCaches->selectorInfo();
+    QStyleSheetSelectorSignature signature;
+    signature.pointers << baseStyle;
+
+    int ownerIndex = 0;
+    for (const QObject *o = obj; o; o = parentObject(o)) {
+        const bool ownsStyleSheet = ownerIndex < styleSheetOwners.size()
+                                    && styleSheetOwners.at(ownerIndex) == o;
+        if (ownsStyleSheet)
+            ++ownerIndex;
+
+        if (o != obj && !info.hasCombinators) {
+            if (ownsStyleSheet)
+                signature.pointers << o;
+            continue;
+        }
+
+        signature.pointers << o->metaObject() << (ownsStyleSheet ? o : nullptr);
+        const QString name = o->objectName();
+        signature.strings << (info.ids.contains(name) ? name : QString());
+
+        StyleSelector::NodePtr n;
+        n.ptr = const_cast<QObject *>(o);
+        for (const QString &attributeName : info.attributeNames) {
+            // A missing attribute never matches, an empty one may.
+            const QString value = styleSelector.attribute(n, attributeName);
+            signature.strings << (value.isNull() ? QString() : QLatin1Char('=') + value);
+        }
+    }
+    return signature;
+}
+
 QVector<QCss::StyleRule> QStyleSheetStyle::styleRules(const QObject *obj) const
 {
     QHash<const QObject *, QVector<StyleRule> >::const_iterator cacheIt = styleSheetCaches->styleRulesCache.constFind(obj);
@@ -1614,7 +1660,7 @@ QVector<QCss::StyleRule> QStyleSheetStyle::styleRules(const QObject *obj) const
     if (defaultCacheIt == styleSheetCaches->styleSheetCache.constEnd()) {
         defaultSs = getDefaultStyleSheet();
         QStyle *bs = baseStyle();
-        styleSheetCaches->styleSheetCache.insert(bs, defaultSs);
+        styleSheetCaches->insertStyleSheet(bs, defaultSs);
         QObject::connect(bs, SIGNAL(destroyed(QObject*)), styleSheetCaches, SLOT(styleDestroyed(QObject*)), Qt::UniqueConnection);
     } else {
         defaultSs = defaultCacheIt.value();
@@ -1633,7 +1679,7 @@ QVector<QCss::StyleRule> QStyleSheetStyle::styleRules(const QObject *obj) const
                 qWarning("Could not parse application stylesheet");
             appSs.origin = StyleSheetOrigin_Inline;
             appSs.depth = 1;
-            styleSheetCaches->styleSheetCache.insert(qApp, appSs);
+            styleSheetCaches->insertStyleSheet(qApp, appSs);
         } else {
             appSs = appCacheIt.value();
         }
@@ -1641,10 +1687,12 @@ QVector<QCss::StyleRule> QStyleSheetStyle::styleRules(const QObject *obj) const
     }
 
     QVector<QCss::StyleSheet> objectSs;
+    QVarLengthArray<const QObject *, 8> styleSheetOwners;
     for (const QObject *o = obj; o; o = parentObject(o)) {
         QString styleSheet = o->property("styleSheet").toString();
         if (styleSheet.isEmpty())
             continue;
+        styleSheetOwners.append(o);
         StyleSheet ss;
         QHash<const void *, StyleSheet>::const_iterator objCacheIt = styleSheetCaches->styleSheetCache.constFind(o);
         if (objCacheIt == styleSheetCaches->styleSheetCache.constEnd()) {
@@ -1655,7 +1703,7 @@ QVector<QCss::StyleRule> QStyleSheetStyle::styleRules(const QObject *obj) const
                    qWarning() << "Could not parse stylesheet of object" << o;
             }
             ss.origin = StyleSheetOrigin_Inline;
-            styleSheetCaches->styleSheetCache.insert(o, ss);
+            styleSheetCaches->insertStyleSheet(o, ss);
         } else {
             ss = objCacheIt.value();
         }
@@ -1667,11 +1715,18 @@ QVector<QCss::StyleRule> QStyleSheetStyle::styleRules(const QObject *obj) const
 
     styleSelector.styleSheets += objectSs;
 
-    StyleSelector::NodePtr n;
-    n.ptr = const_cast<QObject *>(obj);
-    QVector<QCss::StyleRule> rules = styleSelector.styleRulesForNode(n);
-    styleSheetCaches->styleRulesCache.insert(obj, rules);
-    return rules;
+    // Many objects, like the items of a large form, cannot be told apart by
+    // any selector. Match the rules once and share them.
+    const QStyleSheetSelectorSignature signature =
+            selectorSignature(styleSelector, obj, styleSheetOwners, baseStyle());
+    auto sharedIt = styleSheetCaches->sharedStyleRulesCache.constFind(signature);
+    if (sharedIt == styleSheetCaches->sharedStyleRulesCache.constEnd()) {
+        StyleSelector::NodePtr n;
+        n.ptr = const_cast<QObject *>(obj);
+        sharedIt = styleSheetCaches->sharedStyleRulesCache.insert(signature, styleSelector.styleRulesForNode(n));
+    }
+    styleSheetCaches->styleRulesCache.insert(obj, sharedIt.value());
+    return sharedIt.value();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -2788,13 +2843,89 @@ void QStyleSheetStyleCaches::objectDestroyed(QObject *o)
     renderRulesCache.remove(o);
     customPaletteWidgets.remove((const QWidget *)o);
     customFontWidgets.remove(static_cast<QWidget *>(o));
-    styleSheetCache.remove(o);
+    removeStyleSheet(o);
     autoFillDisabledWidgets.remove((const QWidget *)o);
 }
 
 void QStyleSheetStyleCaches::styleDestroyed(QObject *o)
 {
-    styleSheetCache.remove(o);
+    removeStyleSheet(o);
+}
+
+static bool addSelectorInfo(QStyleSheetSelectorInfo *info, const StyleRule &rule)
+{
+    bool changed = false;
+    for (const Selector &selector : rule.selectors) {
+        if (selector.basicSelectors.count() > 1 && !info->hasCombinators) {
+            info->hasCombinators = true;
+            changed = true;
+        }
+        for (const BasicSelector &basicSelector : selector.basicSelectors) {
+            for (const QString &id : basicSelector.ids) {
+                if (!info->ids.contains(id)) {
+                    info->ids.insert(id);
+                    changed = true;
+                }
+            }
+            for (const AttributeSelector &attributeSelector : basicSelector.attributeSelectors) {
+                if (!info->attributeNames.contains(attributeSelector.name)) {
+                    info->attributeNames.append(attributeSelector.name);
+                    changed = true;
+                }
+            }
+        }
+    }
+    return changed;
+}
+
+static bool addSelectorInfo(QStyleSheetSelectorInfo *info, const StyleSheet &styleSheet)
+{
+    bool changed = false;
+    for (const StyleRule &rule : styleSheet.styleRules)
+        changed |= addSelectorInfo(info, rule);
+    for (const StyleRule &rule : styleSheet.nameIndex)
+        changed |= addSelectorInfo(info, rule);
+    for (const StyleRule &rule : styleSheet.idIndex)
+        changed |= addSelectorInfo(info, rule);
+    for (const MediaRule &mediaRule : styleSheet.mediaRules) {
+        for (const StyleRule &rule : mediaRule.styleRules)
+            changed |= addSelectorInfo(info, rule);
+    }
+    return changed;
+}
+
+void QStyleSheetStyleCaches::insertStyleSheet(const void *key, const QCss::StyleSheet &styleSheet)
+{
+    styleSheetCache.insert(key, styleSheet);
+    // Shared rules stay valid unless the new selectors look at something
+    // that the signatures do not cover yet.
+    if (selectorInfoCache.valid && addSelectorInfo(&selectorInfoCache, styleSheet))
+        sharedStyleRulesCache.clear();
+}
+
+void QStyleSheetStyleCaches::removeStyleSheet(const void *key)
+{
+    if (!styleSheetCache.remove(key))
+        return;
+
+    // Signatures refer to the owners of style sheets by address. The
+    // selector info may keep covering more than needed, which only makes
+    // the signatures more specific.
+    sharedStyleRulesCache.clear();
+    if (styleSheetCache.isEmpty())
+        selectorInfoCache = QStyleSheetSelectorInfo();
+}
+
+const QStyleSheetSelectorInfo &QStyleSheetStyleCaches::selectorInfo()
+{
+    if (!selectorInfoCache.valid) {
+        selectorInfoCache = QStyleSheetSelectorInfo();
+        for (const StyleSheet &styleSheet : qAsConst(styleSheetCache))
+            addSelectorInfo(&selectorInfoCache, styleSheet);
+        selectorInfoCache.valid = true;
+        sharedStyleRulesCache.clear();
+    }
+    return selectorInfoCache;
 }
 
 /*!
@@ -2831,7 +2962,7 @@ void QStyleSheetStyle::polish(QWidget *w)
         styleSheetCaches->styleRulesCache.remove(w);
         styleSheetCaches->hasStyleRuleCache.remove(w);
         styleSheetCaches->renderRulesCache.remove(w);
-        styleSheetCaches->styleSheetCache.remove(w);
+        styleSheetCaches->removeStyleSheet(w);
     }
     setGeometry(w);
     setProperties(w);
@@ -2921,24 +3052,33 @@ void QStyleSheetStyle::polish(QPalette &pal)
 
 void QStyleSheetStyle::repolish(QWidget *w)
 {
-    QList<const QObject *> children;
-    children.reserve(w->children().size() + 1);
-    for (auto child: qAsConst(w->children()))
-        children.append(child);
-    children.append(w);
-    styleSheetCaches->styleSheetCache.remove(w);
-    updateObjects(children);
+    // updateObjects() walks the children of w; listing them as well would
+    // polish the whole subtree twice.
+    styleSheetCaches->removeStyleSheet(w);
+    updateObjects(QList<const QObject *>() << w);
 }
 
 void QStyleSheetStyle::repolish(QApplication *app)
 {
     Q_UNUSED(app);
     const QList<const QObject*> allObjects = styleSheetCaches->styleRulesCache.keys();
-    styleSheetCaches->styleSheetCache.remove(qApp);
+    styleSheetCaches->removeStyleSheet(qApp);
     styleSheetCaches->styleRulesCache.clear();
     styleSheetCaches->hasStyleRuleCache.clear();
     styleSheetCaches->renderRulesCache.clear();
-    updateObjects(allObjects);
+
+    // Only update the roots; updateObjects() takes care of the widgets below
+    // them, which would otherwise be polished once per ancestor.
+    const QSet<const QObject *> objectSet(allObjects.cbegin(), allObjects.cend());
+    QList<const QObject *> roots;
+    for (const QObject *object : allObjects) {
+        const QObject *ancestor = object->parent();
+        while (ancestor && !(ancestor->isWidgetType() && objectSet.contains(ancestor)))
+            ancestor = ancestor->parent();
+        if (!ancestor)
+            roots.append(object);
+    }
+    updateObjects(roots);
 }
 
 void QStyleSheetStyle::unpolish(QWidget *w)
@@ -2951,7 +3091,7 @@ void QStyleSheetStyle::unpolish(QWidget *w)
     styleSheetCaches->styleRulesCache.remove(w);
     styleSheetCaches->hasStyleRuleCache.remove(w);
     styleSheetCaches->renderRulesCache.remove(w);
-    styleSheetCaches->styleSheetCache.remove(w);
+    styleSheetCaches->removeStyleSheet(w);
     unsetPalette(w);
     setGeometry(w);
     w->setAttribute(Qt::WA_StyleSheetTarget, false);
@@ -2975,7 +3115,7 @@ void QStyleSheetStyle::unpolish(QApplication *app)
     styleSheetCaches->styleRulesCache.clear();
     styleSheetCaches->hasStyleRuleCache.clear();
     styleSheetCaches->renderRulesCache.clear();
-    styleSheetCaches->styleSheetCache.remove(qApp);
+    styleSheetCaches->removeStyleSheet(qApp);
 }
 
 #if QT_CONFIG(tabbar)
@@ -177,6 +177,33 @@ private:
     Q_DECLARE_PRIVATE(QStyleSheetStyle)
 };
 
+// Everything the selectors of a set of style sheets can distinguish an
+// object by; objects with equal signatures get the same style rules.
+struct QStyleSheetSelectorSignature
+{
+    QVector<const void *> pointers;
+    QStringList strings;
+
+    bool operator==(const QStyleSheetSelectorSignature &other) const
+    { return pointers == other.pointers && strings == other.strings; }
+};
+
+inline uint qHash(const QStyleSheetSelectorSignature &signature, uint seed = 0)
+{
+    QtPrivate::QHashCombine hash;
+    seed = hash(seed, signature.pointers);
+    return hash(seed, signature.strings);
+}
+
+// What the selectors of all parsed style sheets look at.
+struct QStyleSheetSelectorInfo
+{
+    QStringList attributeNames;
+    QSet<QString> ids;
+    bool hasCombinators = false;
+    bool valid = false;
+};
+
 class QStyleSheetStyleCaches : public QObject
 {
     Q_OBJECT
@@ -189,6 +216,11 @@ public:
     typedef QHash<int, QHash<quint64, QRenderRule> > QRenderRules;
     QHash<const QObject *, QRenderRules> renderRulesCache;
     QHash<const void *, QCss::StyleSheet> styleSheetCache; // parsed style sheets
+    QHash<QStyleSheetSelectorSignature, QVector<QCss::StyleRule> > sharedStyleRulesCache;
+    QStyleSheetSelectorInfo selectorInfoCache;
+    void insertStyleSheet(const void *key, const QCss::StyleSheet &styleSheet);
+    void removeStyleSheet(const void *key);
+    const QStyleSheetSelectorInfo &selectorInfo();
     QSet<const QWidget *> autoFillDisabledWidgets;
     // widgets with whose palettes and fonts we have tampered:
     template <typename T>
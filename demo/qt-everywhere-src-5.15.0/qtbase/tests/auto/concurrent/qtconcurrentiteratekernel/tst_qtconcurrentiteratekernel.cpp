@@ -82,6 +82,7 @@ private slots:
     void noIterations();
     void throttling();
     void multipleResults();
+    void eachIterationOnce();
 };
 
 QAtomicInt iterations;
@@ -261,6 +262,34 @@ void tst_QtConcurrentIterateKernel::multipleResults()
     f.waitForFinished();
 }
 
+class VisitFor : public IterateKernel<TestIterator, void>
+{
+public:
+    VisitFor(TestIterator begin, TestIterator end, QVector<QAtomicInt> *_visits)
+        : IterateKernel<TestIterator, void>(begin, end), visits(_visits) { }
+    bool runIterations(TestIterator/*beginIterator*/, int begin, int end, void *) override
+    {
+        for (int i = begin; i < end; ++i)
+            (*visits)[i].fetchAndAddRelaxed(1);
+        return false;
+    }
+
+    QVector<QAtomicInt> *visits;
+};
+
+void tst_QtConcurrentIterateKernel::eachIterationOnce()
+{
+    // the iteration range is split between the threads and stolen back and
+    // forth; no index may be lost or visited twice
+    for (int iterations : {1, 7, 1000, 100000}) {
+        QVector<QAtomicInt> visits(iterations);
+        VisitFor f(0, iterations, &visits);
+        f.startBlocking();
+        for (int i = 0; i < iterations; ++i)
+            QCOMPARE(visits.at(i).loadRelaxed(), 1);
+    }
+}
+
 QTEST_MAIN(tst_QtConcurrentIterateKernel)
 
 #include "tst_qtconcurrentiteratekernel.moc"
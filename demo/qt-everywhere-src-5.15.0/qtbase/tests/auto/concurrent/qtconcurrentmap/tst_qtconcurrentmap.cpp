@@ -46,6 +46,7 @@ private slots:
     void blocking_mapped();
     void mappedReduced();
     void blocking_mappedReduced();
+    void parallelReduce();
     void assignResult();
     void functionOverloads();
     void noExceptFunctionOverloads();
@@ -2110,6 +2111,88 @@ QT_WARNING_POP
     // ### the same as above, with an initial result value
 }
 
+static qint64 squareToInt64(int x)
+{
+    return qint64(x) * x;
+}
+
+static void int64SumReduce(qint64 &result, qint64 value)
+{
+    result += value;
+}
+
+static int histogramBucket(int x)
+{
+    return x % 16;
+}
+
+static void appendReduce(QList<qint64> &result, qint64 value)
+{
+    result.append(value);
+}
+
+class HistogramReduce
+{
+public:
+    void operator()(QVector<int> &histogram, int bucket)
+    {
+        if (histogram.size() <= bucket)
+            histogram.resize(bucket + 1);
+        ++histogram[bucket];
+    }
+
+    void operator()(QVector<int> &histogram, const QVector<int> &partial)
+    {
+        if (histogram.size() < partial.size())
+            histogram.resize(partial.size());
+        for (int i = 0; i < partial.size(); ++i)
+            histogram[i] += partial.at(i);
+    }
+};
+
+void tst_QtConcurrentMap::parallelReduce()
+{
+    QList<int> list;
+    for (int i = 0; i < 10000; ++i)
+        list << i;
+
+    qint64 expectedSum = 0;
+    for (int i : qAsConst(list))
+        expectedSum += squareToInt64(i);
+
+    {
+        const qint64 result = QtConcurrent::blockingMappedReduced<qint64>(
+                list, squareToInt64, int64SumReduce, QtConcurrent::ParallelReduce);
+        QCOMPARE(result, expectedSum);
+    }
+    {
+        const qint64 result = QtConcurrent::mappedReduced<qint64>(
+                list, squareToInt64, int64SumReduce, QtConcurrent::ParallelReduce).result();
+        QCOMPARE(result, expectedSum);
+    }
+    {
+        const QVector<int> histogram = QtConcurrent::blockingMappedReduced<QVector<int>>(
+                list, histogramBucket, HistogramReduce(),
+                QtConcurrent::ParallelReduce | QtConcurrent::UnorderedReduce);
+        QCOMPARE(histogram, QVector<int>(16, list.size() / 16));
+    }
+    {
+        // reducers that cannot merge partial results fall back to sequential reduction
+        const QList<qint64> result = QtConcurrent::blockingMappedReduced<QList<qint64>>(
+                list, squareToInt64, appendReduce, QtConcurrent::ParallelReduce);
+        QCOMPARE(result.size(), list.size());
+    }
+    {
+        // OrderedReduce takes precedence
+        const QList<qint64> result = QtConcurrent::blockingMappedReduced<QList<qint64>>(
+                list, squareToInt64, appendReduce,
+                QtConcurrent::ParallelReduce | QtConcurrent::OrderedReduce);
+        QCOMPARE(result.size(), list.size());
+        for (int i = 0; i < list.size(); ++i)
+            QCOMPARE(result.at(i), squareToInt64(list.at(i)));
+    }
+}
+
 int sleeper(int val)
 {
     QTest::qSleep(100);
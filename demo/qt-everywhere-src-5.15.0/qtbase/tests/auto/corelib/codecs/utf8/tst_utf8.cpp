@@ -61,6 +61,9 @@ private slots:
 
     void nonCharacters_data();
     void nonCharacters();
+
+    void longMultiByteText_data();
+    void longMultiByteText();
 };
 
 void tst_Utf8::initTestCase()
@@ -273,5 +276,66 @@ void tst_Utf8::nonCharacters()
         qWarning("System codec reports failure when it shouldn't. Should report bug upstream.");
 }
 
+void tst_Utf8::longMultiByteText_data()
+{
+    QTest::addColumn<QString>("text");
+
+    // long enough to go through the block decoder and encoder several times,
+    // with the sequences starting at every possible offset within a block
+    const QString cyrillic = QString::fromUtf8("\320\241\321\212\320\265\321\210\321\214 ");
+    const QString cjk = QString::fromUtf8("\346\227\245\346\234\254\350\252\236");
+    const QString mixed = QString::fromUtf8("a\303\251\342\202\254 \360\237\230\200\346\227\245b");
+    for (int offset = 0; offset < 4; ++offset) {
+        const QString prefix(offset, QLatin1Char('x'));
+        QTest::addRow("cyrillic-%d", offset) << prefix + cyrillic.repeated(20);
+        QTest::addRow("cjk-%d", offset) << prefix + cjk.repeated(20);
+        QTest::addRow("mixed-%d", offset) << prefix + mixed.repeated(20);
+        QTest::addRow("cyrillic-cjk-%d", offset) << prefix + (cyrillic + cjk).repeated(10);
+    }
+}
+
+void tst_Utf8::longMultiByteText()
+{
+    QFETCH(QString, text);
+
+    const QByteArray utf8 = to8Bit(text);
+    QCOMPARE(from8Bit(utf8), text);
+
+    // compare against the result of converting one character at a time
+    {
+        const QScopedPointer<QTextEncoder> encoder(codec->makeEncoder(QTextCodec::IgnoreHeader));
+        QByteArray encoded;
+        for (int i = 0; i < text.length(); ++i)
+            encoded += encoder->fromUnicode(text.constData() + i, 1);
+        QCOMPARE(utf8, encoded);
+    }
+
+    // corrupt every byte in turn: only the characters around the corrupted
+    // byte may change, so the result must match decoding the three parts
+    // separately (the middle part is too short for the block decoder)
+    QFETCH_GLOBAL(bool, useLocale);
+    if (useLocale)
+        return;
+    const auto isContinuation = [&utf8](int i) { return (uchar(utf8.at(i)) & 0xc0) == 0x80; };
+    for (int i = 0; i < utf8.size(); ++i) {
+        int begin = i;
+        while (begin > 0 && isContinuation(begin))
+            --begin;
+        int end = i + 1;
+        while (end < utf8.size() && isContinuation(end))
+            ++end;
+
+        for (char bad : { '\x80', '\xc0', '\xe0', '\xed', '\xf0', 'A' }) {
+            QByteArray corrupted = utf8;
+            corrupted[i] = bad;
+
+            const QString expected = from8Bit(utf8.left(begin))
+                    + from8Bit(corrupted.mid(begin, end - begin))
+                    + from8Bit(utf8.mid(end));
+            QCOMPARE(from8Bit(corrupted), expected);
+        }
+    }
+}
+
 QTEST_MAIN(tst_Utf8)
 #include "tst_utf8.moc"
@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qdirwalker
+QT = core-private testlib
+SOURCES = tst_qdirwalker.cpp
@@ -0,0 +1,238 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+
+#include <qdiriterator.h>
+#include <qfileinfo.h>
+#include <qmutex.h>
+#include <qsemaphore.h>
+#include <qtemporarydir.h>
+#include <qthreadpool.h>
+
+#include <QtCore/private/qdirwalker_p.h>
+
+#if defined(Q_OS_VXWORKS) || defined(Q_OS_WINRT)
+#define Q_NO_SYMLINKS
+#endif
+
+Q_DECLARE_METATYPE(QDirIterator::IteratorFlags)
+Q_DECLARE_METATYPE(QDir::Filters)
+
+class tst_QDirWalker : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void matchesDirIterator_data();
+    void matchesDirIterator();
+    void nameFilters();
+    void fields();
+    void singleThread();
+    void cancel();
+#ifndef Q_NO_SYMLINKS
+    void symlinkLoop();
+#endif
+
+private:
+    static QStringList walk(QDirWalker &walker);
+    static QStringList iterate(const QString &path, const QStringList &nameFilters,
+                               QDir::Filters filters, QDirIterator::IteratorFlags flags);
+
+    QTemporaryDir tempDir;
+    int fileCount = 0;
+};
+
+QStringList tst_QDirWalker::walk(QDirWalker &walker)
+{
+    QMutex mutex;
+    QStringList paths;
+    walker.walk([&](const QFileInfo &info) {
+        QMutexLocker locker(&mutex);
+        paths << info.filePath();
+    });
+    paths.sort();
+    return paths;
+}
+
+QStringList tst_QDirWalker::iterate(const QString &path, const QStringList &nameFilters,
+                                    QDir::Filters filters, QDirIterator::IteratorFlags flags)
+{
+    QStringList paths;
+    QDirIterator it(path, nameFilters, filters | QDir::NoDotAndDotDot, flags);
+    while (it.hasNext())
+        paths << it.next();
+    paths.sort();
+    return paths;
+}
+
+void tst_QDirWalker::initTestCase()
+{
+    QVERIFY2(tempDir.isValid(), qPrintable(tempDir.errorString()));
+
+    // a tree that's wide and deep enough for several threads to get work
+    QDir root(tempDir.path());
+    for (int i = 0; i < 8; ++i) {
+        const QString top = QString::fromLatin1("dir%1").arg(i);
+        for (int j = 0; j < 4; ++j) {
+            const QString sub = top + QString::fromLatin1("/sub%1/leaf").arg(j);
+            QVERIFY(root.mkpath(sub));
+            for (int k = 0; k < 5; ++k) {
+                const QString name = QString::fromLatin1("%1/file%2.%3")
+                        .arg(sub).arg(k).arg(k % 2 ? "txt" : "dat");
+                QFile file(root.filePath(name));
+                QVERIFY(file.open(QIODevice::WriteOnly));
+                file.write(QByteArray(k, 'x'));
+                ++fileCount;
+            }
+        }
+    }
+    QVERIFY(root.mkpath(".hidden/inside"));
+    QFile hiddenFile(root.filePath(".hidden/inside/file.txt"));
+    QVERIFY(hiddenFile.open(QIODevice::WriteOnly));
+}
+
+void tst_QDirWalker::matchesDirIterator_data()
+{
+    QTest::addColumn<QDir::Filters>("filters");
+    QTest::addColumn<QDirIterator::IteratorFlags>("flags");
+
+    QTest::newRow("all-recursive") << QDir::Filters(QDir::NoFilter)
+                                   << QDirIterator::IteratorFlags(QDirIterator::Subdirectories);
+    QTest::newRow("files-recursive") << QDir::Filters(QDir::Files)
+                                     << QDirIterator::IteratorFlags(QDirIterator::Subdirectories);
+    QTest::newRow("dirs-recursive") << QDir::Filters(QDir::Dirs)
+                                    << QDirIterator::IteratorFlags(QDirIterator::Subdirectories);
+    QTest::newRow("hidden-recursive") << QDir::Filters(QDir::AllEntries | QDir::Hidden)
+                                      << QDirIterator::IteratorFlags(QDirIterator::Subdirectories);
+    QTest::newRow("flat") << QDir::Filters(QDir::NoFilter)
+                          << QDirIterator::IteratorFlags(QDirIterator::NoIteratorFlags);
+}
+
+void tst_QDirWalker::matchesDirIterator()
+{
+    QFETCH(QDir::Filters, filters);
+    QFETCH(QDirIterator::IteratorFlags, flags);
+
+    QDirWalker walker(tempDir.path(), filters, flags);
+    QCOMPARE(walker.path(), tempDir.path());
+    const QStringList expected = iterate(tempDir.path(), QStringList(), filters, flags);
+    QVERIFY(!expected.isEmpty());
+    QCOMPARE(walk(walker), expected);
+}
+
+void tst_QDirWalker::nameFilters()
+{
+    const QStringList filters{ QLatin1String("*.txt") };
+    QDirWalker walker(tempDir.path(), filters, QDir::Files);
+    const QStringList paths = walk(walker);
+    QCOMPARE(paths, iterate(tempDir.path(), filters, QDir::Files, QDirIterator::Subdirectories));
+    QCOMPARE(paths.size(), fileCount * 2 / 5);
+    for (const QString &path : paths)
+        QVERIFY2(path.endsWith(QLatin1String(".txt")), qPrintable(path));
+}
+
+void tst_QDirWalker::fields()
+{
+    QDirWalker walker(tempDir.path(), QDir::Files);
+    QCOMPARE(walker.fields(), QDirWalker::Fields(QDirWalker::TypeField));
+    walker.setFields(QDirWalker::SizeField | QDirWalker::TimesField);
+    QCOMPARE(walker.fields(), QDirWalker::SizeField | QDirWalker::TimesField);
+
+    QMutex mutex;
+    int count = 0;
+    bool sizesMatch = true;
+    bool timesValid = true;
+    walker.walk([&](const QFileInfo &info) {
+        const QFileInfo fresh(info.filePath());
+        QMutexLocker locker(&mutex);
+        ++count;
+        sizesMatch = sizesMatch && info.isFile() && info.size() == fresh.size();
+        timesValid = timesValid && info.lastModified() == fresh.lastModified();
+    });
+    QCOMPARE(count, fileCount);
+    QVERIFY(sizesMatch);
+    QVERIFY(timesValid);
+}
+
+void tst_QDirWalker::singleThread()
+{
+    // the calling thread does the work if the pool can't help
+    QThreadPool pool;
+    pool.setMaxThreadCount(1);
+    QDirWalker walker(tempDir.path(), QDir::Files);
+    walker.setThreadPool(&pool);
+    QCOMPARE(walker.threadPool(), &pool);
+
+    QSemaphore release;
+    QVERIFY(pool.tryStart([&]() { release.acquire(); }));
+    QCOMPARE(walk(walker).size(), fileCount);
+    release.release();
+    QVERIFY(pool.waitForDone());
+}
+
+void tst_QDirWalker::cancel()
+{
+    QDirWalker walker(tempDir.path(), QDir::Files);
+    QAtomicInt count;
+    const bool finished = walker.walk([&](const QFileInfo &) {
+        if (count.fetchAndAddRelaxed(1) == 0)
+            walker.cancel();
+    });
+    QVERIFY(!finished);
+    QVERIFY(count.loadRelaxed() < fileCount);
+
+    // the walker can be reused after a cancellation
+    QCOMPARE(walk(walker).size(), fileCount);
+}
+
+#ifndef Q_NO_SYMLINKS
+void tst_QDirWalker::symlinkLoop()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QDir root(dir.path());
+    QVERIFY(root.mkpath("a/b"));
+    QFile file(root.filePath("a/b/file"));
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    if (!QFile::link(root.filePath("a"), root.filePath("a/b/loop")))
+        QSKIP("Cannot create symbolic links");
+
+    QDirWalker notFollowing(dir.path(), QDir::Files);
+    QCOMPARE(walk(notFollowing), QStringList{ root.filePath("a/b/file") });
+
+    QDirWalker following(dir.path(), QDir::Files, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+    QCOMPARE(walk(following),
+             iterate(dir.path(), QStringList(), QDir::Files,
+                     QDirIterator::Subdirectories | QDirIterator::FollowSymlinks));
+}
+#endif
+
+QTEST_MAIN(tst_QDirWalker)
+
+#include "tst_qdirwalker.moc"
@@ -165,6 +165,7 @@ private slots:
     void readAll_data();
     void readAll();
     void readAllBuffer();
+    void readChunks();
     void readAllStdin();
     void readLineStdin();
     void readLineStdin_lineByLine();
@@ -946,6 +947,47 @@ void tst_QFile::readAllBuffer()
     QFile::remove(fileName);
 }
 
+void tst_QFile::readChunks()
+{
+    QString fileName = QLatin1String("readChunks.txt");
+
+    QFile::remove(fileName);
+
+    QByteArray data;
+    for (int i = 0; i < 1000; ++i)
+        data += QByteArray::number(i) + ' ';
+
+    QFile writer(fileName);
+    QVERIFY2(writer.open(QIODevice::WriteOnly), msgOpenFailed(writer).constData());
+    QCOMPARE( writer.write(data), qint64(data.size()) );
+    writer.close();
+
+    QFile reader(fileName);
+    QVERIFY2(reader.open(QIODevice::ReadOnly), msgOpenFailed(reader).constData());
+
+    // Nothing buffered yet: falls back to read().
+    QByteArrayList chunks = reader.readChunks(10);
+    QCOMPARE( chunks.size(), 1 );
+    QCOMPARE( chunks.first(), data.left(10) );
+    QCOMPARE( reader.pos(), qint64(10) );
+
+    // Served from the read buffer, stopping in the middle of a chunk.
+    chunks = reader.readChunks(20);
+    QCOMPARE( chunks.join(), data.mid(10, 20) );
+    QCOMPARE( reader.pos(), qint64(30) );
+
+    // Everything that is left.
+    QByteArray result;
+    while (!(chunks = reader.readChunks()).isEmpty())
+        result += chunks.join();
+    QCOMPARE( result, data.mid(30) );
+    QVERIFY( reader.atEnd() );
+    QCOMPARE( reader.pos(), qint64(data.size()) );
+
+    reader.close();
+    QFile::remove(fileName);
+}
+
 #if QT_CONFIG(process)
 class StdinReaderProcessGuard { // Ensure the stdin reader process is stopped on destruction.
     Q_DISABLE_COPY(StdinReaderProcessGuard)
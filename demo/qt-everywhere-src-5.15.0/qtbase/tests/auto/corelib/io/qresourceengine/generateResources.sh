@@ -4,4 +4,5 @@ dd if=/dev/zero of=zero.txt bs=1 count=$count
 rcc --binary -o uncompressed.rcc --no-compress compressed.qrc
 rcc --binary -o zlib.rcc --compress-algo zlib --compress 9 compressed.qrc
 rcc --binary -o zstd.rcc --compress-algo zstd --compress 19 compressed.qrc
+rcc --binary -o zlib-chunked.rcc --format-version 4 --compress-algo zlib --compress 9 --compress-chunk-size 4096 compressed.qrc
 rm zero.txt
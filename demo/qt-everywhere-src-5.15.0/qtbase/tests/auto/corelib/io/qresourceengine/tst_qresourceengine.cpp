@@ -120,6 +120,8 @@ void tst_QResourceEngine::compressedResource_data()
             << QFINDTESTDATA("zlib.rcc") << int(QResource::ZlibCompression) << true;
     QTest::newRow("zstd")
             << QFINDTESTDATA("zstd.rcc") << int(QResource::ZstdCompression) << QT_CONFIG(zstd);
+    QTest::newRow("zlib-chunked")
+            << QFINDTESTDATA("zlib-chunked.rcc") << int(QResource::ZlibCompression) << true;
 }
 
 // Note: generateResource.sh parses this line. Make sure it's a simple number.
@@ -174,6 +176,15 @@ void tst_QResourceEngine::compressedResource()
     data = f.readAll();
     QCOMPARE(data.size(), expectedData.size());
     QCOMPARE(data, expectedData);
+
+    // reads that start and end inside chunks
+    QVERIFY(f.seek(ZERO_FILE_LEN / 3));
+    char buffer[5000];
+    QCOMPARE(f.read(buffer, sizeof(buffer)), qint64(sizeof(buffer)));
+    QCOMPARE(memcmp(buffer, expectedData.constData(), sizeof(buffer)), 0);
+    QVERIFY(f.seek(ZERO_FILE_LEN - 10));
+    QCOMPARE(f.read(buffer, sizeof(buffer)), qint64(10));
+    QVERIFY(f.atEnd());
 }
 
 
@@ -215,6 +226,7 @@ void tst_QResourceEngine::checkStructure_data()
                                            << "search_file.txt"
 #if defined(BUILTIN_TESTDATA)
                                            << "uncompressed.rcc"
+                                           << "zlib-chunked.rcc"
                                            << "zlib.rcc"
                                            << "zstd.rcc"
 #endif
@@ -191,6 +191,7 @@ private slots:
     void embeddedZeroByte_data();
     void embeddedZeroByte();
     void spaceAfterComment();
+    void syncPicksUpCreatedFile();
 
     void testXdg();
 private:
@@ -799,6 +800,36 @@ void tst_QSettings::spaceAfterComment()
     settings.endGroup();
 }
 
+void tst_QSettings::syncPicksUpCreatedFile()
+{
+    QTemporaryDir tempDir;
+    QVERIFY2(tempDir.isValid(), qPrintable(tempDir.errorString()));
+    const QString fileName = tempDir.filePath(QStringLiteral("created.ini"));
+
+    QSettings settings(fileName, QSettings::IniFormat);
+    QCOMPARE(settings.status(), QSettings::NoError);
+    QVERIFY(!settings.contains("key"));
+
+    // Syncing again while the file is still missing must not change anything
+    settings.sync();
+    QCOMPARE(settings.status(), QSettings::NoError);
+    QVERIFY(settings.allKeys().isEmpty());
+
+    {
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("[General]\nkey=42\n");
+    }
+
+    settings.sync();
+    QCOMPARE(settings.status(), QSettings::NoError);
+    QCOMPARE(settings.value("key").toInt(), 42);
+
+    // And a second object for the same file shares the loaded data
+    QSettings other(fileName, QSettings::IniFormat);
+    QCOMPARE(other.value("key").toInt(), 42);
+}
+
 void tst_QSettings::testErrorHandling_data()
 {
     QTest::addColumn<int>("filePerms"); // -1 means file should not exist
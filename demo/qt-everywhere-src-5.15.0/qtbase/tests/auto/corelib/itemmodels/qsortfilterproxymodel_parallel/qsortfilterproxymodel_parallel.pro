@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qsortfilterproxymodel_parallel
+QT = core testlib
+SOURCES = tst_qsortfilterproxymodel_parallel.cpp
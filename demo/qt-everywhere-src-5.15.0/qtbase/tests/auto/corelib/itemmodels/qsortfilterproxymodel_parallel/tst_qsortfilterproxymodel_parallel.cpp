@@ -0,0 +1,155 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+
+#include <QtCore/qsortfilterproxymodel.h>
+#include <QtCore/qstringlistmodel.h>
+
+class tst_QSortFilterProxyModelParallel : public QObject
+{
+    Q_OBJECT
+private slots:
+    void sort_data();
+    void sort();
+    void filter();
+    void insertRows();
+
+private:
+    static QStringList proxyContents(const QAbstractItemModel &model);
+};
+
+static QStringList makeStrings(int count)
+{
+    QStringList strings;
+    strings.reserve(count);
+    QRandomGenerator generator(count);
+    for (int i = 0; i < count; ++i)
+        strings.append(QString::number(generator.bounded(count / 4)) + QLatin1Char('-') + QString::number(i % 7));
+    return strings;
+}
+
+QStringList tst_QSortFilterProxyModelParallel::proxyContents(const QAbstractItemModel &model)
+{
+    QStringList contents;
+    const int rows = model.rowCount();
+    contents.reserve(rows);
+    for (int row = 0; row < rows; ++row)
+        contents.append(model.index(row, 0).data().toString());
+    return contents;
+}
+
+void tst_QSortFilterProxyModelParallel::sort_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<Qt::SortOrder>("order");
+    QTest::addColumn<Qt::CaseSensitivity>("caseSensitivity");
+
+    QTest::newRow("small") << 100 << Qt::AscendingOrder << Qt::CaseSensitive;
+    QTest::newRow("ascending") << 50000 << Qt::AscendingOrder << Qt::CaseSensitive;
+    QTest::newRow("descending") << 50000 << Qt::DescendingOrder << Qt::CaseSensitive;
+    QTest::newRow("insensitive") << 20000 << Qt::AscendingOrder << Qt::CaseInsensitive;
+}
+
+void tst_QSortFilterProxyModelParallel::sort()
+{
+    QFETCH(int, count);
+    QFETCH(Qt::SortOrder, order);
+    QFETCH(Qt::CaseSensitivity, caseSensitivity);
+
+    QStringListModel source(makeStrings(count));
+    QSortFilterProxyModel serial;
+    serial.setSortCaseSensitivity(caseSensitivity);
+    serial.setSourceModel(&source);
+    QSortFilterProxyModel parallel;
+    QSignalSpy enabledSpy(&parallel, &QSortFilterProxyModel::parallelSortFilterEnabledChanged);
+    parallel.setParallelSortFilterEnabled(true);
+    QVERIFY(parallel.isParallelSortFilterEnabled());
+    QCOMPARE(enabledSpy.count(), 1);
+    parallel.setSortCaseSensitivity(caseSensitivity);
+    parallel.setSourceModel(&source);
+
+    QSignalSpy layoutSpy(&parallel, &QAbstractItemModel::layoutChanged);
+    serial.sort(0, order);
+    parallel.sort(0, order);
+    QCOMPARE(layoutSpy.count(), 1);
+
+    // the result, including the order of equal rows, must not change
+    QCOMPARE(proxyContents(parallel), proxyContents(serial));
+    for (int row = 0; row < parallel.rowCount(); row += 997)
+        QCOMPARE(parallel.mapToSource(parallel.index(row, 0)), serial.mapToSource(serial.index(row, 0)));
+}
+
+void tst_QSortFilterProxyModelParallel::filter()
+{
+    QStringListModel source(makeStrings(40000));
+    QSortFilterProxyModel serial;
+    serial.setSourceModel(&source);
+    serial.sort(0);
+    QSortFilterProxyModel parallel;
+    parallel.setParallelSortFilterEnabled(true);
+    parallel.setSourceModel(&source);
+    parallel.sort(0);
+
+    const QStringList patterns = {
+        QStringLiteral("-3"), QStringLiteral("1"), QStringLiteral("12"), QString(), QStringLiteral("nothing")
+    };
+    for (const QString &pattern : patterns) {
+        serial.setFilterFixedString(pattern);
+        parallel.setFilterFixedString(pattern);
+        QCOMPARE(parallel.rowCount(), serial.rowCount());
+        QCOMPARE(proxyContents(parallel), proxyContents(serial));
+    }
+}
+
+void tst_QSortFilterProxyModelParallel::insertRows()
+{
+    QStringListModel source(makeStrings(10000));
+    QSortFilterProxyModel serial;
+    serial.setSourceModel(&source);
+    serial.sort(0);
+    QSortFilterProxyModel parallel;
+    parallel.setParallelSortFilterEnabled(true);
+    parallel.setSourceModel(&source);
+    parallel.sort(0);
+
+    // inserted rows are merged into the existing mapping
+    QSignalSpy layoutSpy(&parallel, &QAbstractItemModel::layoutChanged);
+    QSignalSpy insertSpy(&parallel, &QAbstractItemModel::rowsInserted);
+    QVERIFY(source.insertRows(500, 3));
+    QCOMPARE(layoutSpy.count(), 0);
+    QCOMPARE(insertSpy.count(), 1);
+    QCOMPARE(proxyContents(parallel), proxyContents(serial));
+
+    source.setData(source.index(500), QStringLiteral("0-0"));
+    source.setData(source.index(501), QStringLiteral("5-5"));
+    source.setData(source.index(502), QStringLiteral("999-9"));
+    QCOMPARE(proxyContents(parallel), proxyContents(serial));
+}
+
+QTEST_MAIN(tst_QSortFilterProxyModelParallel)
+#include "tst_qsortfilterproxymodel_parallel.moc"
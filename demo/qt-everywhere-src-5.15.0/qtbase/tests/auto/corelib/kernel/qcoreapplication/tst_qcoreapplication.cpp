@@ -532,6 +532,90 @@ void tst_QCoreApplication::deliverInDefinedOrder()
     QObject::connect(&obj, SIGNAL(done()), &app, SLOT(quit()));
     app.exec();
 }
+
+class QueuedCallReceiver : public QObject
+{
+public:
+    // one entry per producer, in delivery order; negative values mark plain events
+    QVector<QVector<int>> calls;
+    int received = 0;
+
+    bool event(QEvent *event) override
+    {
+        if (event->type() >= QEvent::User && event->type() < QEvent::MaxUser) {
+            calls[event->type() - QEvent::User].append(-1);
+            ++received;
+            return true;
+        }
+        return QObject::event(event);
+    }
+};
+
+class QueuedCallProducer : public QThread
+{
+public:
+    QueuedCallReceiver *receiver = nullptr;
+    int id = 0;
+    int count = 0;
+
+    void run() override
+    {
+        QueuedCallReceiver *r = receiver;
+        const int producer = id;
+        for (int i = 0; i < count; ++i) {
+            QMetaObject::invokeMethod(r, [r, producer, i] {
+                r->calls[producer].append(i);
+                ++r->received;
+            }, Qt::QueuedConnection);
+        }
+        // not a meta-call, so it takes the locked path, but must still be
+        // delivered after everything this thread posted before
+        QCoreApplication::postEvent(r, new QEvent(QEvent::Type(QEvent::User + producer)));
+    }
+};
+
+void tst_QCoreApplication::queuedCallsFromManyThreads()
+{
+    int argc = 1;
+    char *argv[] = { const_cast<char*>(QTest::currentAppName()) };
+    TestApplication app(argc, argv);
+
+    const int producerCount = 8;
+    const int callCount = 2000;
+
+    QueuedCallReceiver receiver;
+    receiver.calls.resize(producerCount);
+
+    QVector<QueuedCallProducer *> producers;
+    for (int i = 0; i < producerCount; ++i) {
+        QueuedCallProducer *producer = new QueuedCallProducer;
+        producer->receiver = &receiver;
+        producer->id = i;
+        producer->count = callCount;
+        producers.append(producer);
+    }
+    for (QueuedCallProducer *producer : qAsConst(producers))
+        producer->start();
+
+    QTRY_COMPARE(receiver.received, producerCount * (callCount + 1));
+
+    for (QueuedCallProducer *producer : qAsConst(producers))
+        QVERIFY(producer->wait());
+    qDeleteAll(producers);
+
+    for (const QVector<int> &calls : qAsConst(receiver.calls)) {
+        QCOMPARE(calls.size(), callCount + 1);
+        for (int i = 0; i < callCount; ++i)
+            QCOMPARE(calls.at(i), i);
+        QCOMPARE(calls.last(), -1);
+    }
+
+    // events queued without the lock are removed like any other
+    QMetaObject::invokeMethod(&receiver, [&receiver] { ++receiver.received; }, Qt::QueuedConnection);
+    QCoreApplication::removePostedEvents(&receiver, QEvent::MetaCall);
+    QCoreApplication::processEvents();
+    QCOMPARE(receiver.received, producerCount * (callCount + 1));
+}
 #endif // QT_CONFIG(thread)
 
 void tst_QCoreApplication::applicationPid()
@@ -41,6 +41,8 @@
   #endif
 #endif
 #include <qmutex.h>
+#include <qsocketnotifier.h>
+#include <qtemporaryfile.h>
 #include <qthread.h>
 #include <qtimer.h>
 #include <qwaitcondition.h>
@@ -170,6 +172,7 @@ private slots:
     void quit();
 #if defined(Q_OS_UNIX)
     void processEventsExcludeSocket();
+    void socketNotifierKinds();
 #endif
     void processEventsExcludeTimers();
     void deliverInDefinedOrder();
@@ -478,6 +481,51 @@ void tst_QEventLoop::processEventsExcludeSocket()
     QVERIFY(!thread.testResult);
     QVERIFY(thread.dataArrived);
 }
+
+void tst_QEventLoop::socketNotifierKinds()
+{
+    // the dispatcher must handle pipes and regular files alike, and keep
+    // up with notifiers being disabled and enabled again
+    int pipefds[2];
+    QCOMPARE(qt_safe_pipe(pipefds, O_NONBLOCK), 0);
+
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    QCOMPARE(file.write("data"), qint64(4));
+    QVERIFY(file.flush());
+
+    QSocketNotifier pipeNotifier(pipefds[0], QSocketNotifier::Read);
+    QSocketNotifier fileNotifier(file.handle(), QSocketNotifier::Read);
+    QSignalSpy pipeSpy(&pipeNotifier, &QSocketNotifier::activated);
+    QSignalSpy fileSpy(&fileNotifier, &QSocketNotifier::activated);
+
+    // a regular file is always readable
+    QTRY_VERIFY(fileSpy.count() > 0);
+    QCOMPARE(pipeSpy.count(), 0);
+    fileNotifier.setEnabled(false);
+
+    char c = 'x';
+    QCOMPARE(qt_safe_write(pipefds[1], &c, 1), qint64(1));
+    QTRY_COMPARE(pipeSpy.count(), 1);
+
+    // drain the pipe, disable, refill: nothing may arrive until re-enabled
+    QCOMPARE(qt_safe_read(pipefds[0], &c, 1), qint64(1));
+    pipeNotifier.setEnabled(false);
+    QCOMPARE(qt_safe_write(pipefds[1], &c, 1), qint64(1));
+    QCoreApplication::processEvents();
+    QCOMPARE(pipeSpy.count(), 1);
+    pipeNotifier.setEnabled(true);
+    QTRY_COMPARE(pipeSpy.count(), 2);
+
+    fileSpy.clear();
+    fileNotifier.setEnabled(true);
+    QTRY_VERIFY(fileSpy.count() > 0);
+
+    pipeNotifier.setEnabled(false);
+    fileNotifier.setEnabled(false);
+    qt_safe_close(pipefds[0]);
+    qt_safe_close(pipefds[1]);
+}
 #endif
 
 class TimerReceiver : public QObject
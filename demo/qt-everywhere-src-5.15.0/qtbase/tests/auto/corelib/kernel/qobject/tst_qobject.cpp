@@ -92,6 +92,7 @@ private slots:
     void recursiveSignalEmission();
     void signalBlocking();
     void blockingQueuedConnection();
+    void batchedConnection();
     void childEvents();
     void installEventFilter();
     void deleteSelfInSlot();
@@ -3084,6 +3085,110 @@ void tst_QObject::blockingQueuedConnection()
     }
 }
 
+void tst_QObject::batchedConnection()
+{
+    const Qt::ConnectionType type =
+            Qt::ConnectionType(Qt::QueuedConnection | Qt::BatchedConnection);
+
+    {
+        // emissions before the event loop runs end up in a single event
+        SenderObject sender;
+        QObject context;
+        QVector<QPair<int, QString>> calls;
+        connect(&sender, &SenderObject::signal7, &context,
+                [&calls](int i, const QString &s) { calls.append(qMakePair(i, s)); }, type);
+
+        int metaCallEvents = 0;
+        class MetaCallCounter : public QObject
+        {
+        public:
+            int *counter;
+            bool eventFilter(QObject *, QEvent *e) override
+            {
+                if (e->type() == QEvent::MetaCall)
+                    ++*counter;
+                return false;
+            }
+        } counter;
+        counter.counter = &metaCallEvents;
+        context.installEventFilter(&counter);
+
+        for (int i = 0; i < 100; ++i)
+            emit sender.signal7(i, QString::number(i));
+        QVERIFY(calls.isEmpty());
+
+        QCoreApplication::processEvents();
+        QCOMPARE(metaCallEvents, 1);
+        QCOMPARE(calls.size(), 100);
+        for (int i = 0; i < 100; ++i) {
+            QCOMPARE(calls.at(i).first, i);
+            QCOMPARE(calls.at(i).second, QString::number(i));
+        }
+
+        // a new batch is started once the previous one was delivered
+        emit sender.signal7(100, QString());
+        QCoreApplication::processEvents();
+        QCOMPARE(metaCallEvents, 2);
+        QCOMPARE(calls.size(), 101);
+    }
+
+    {
+        // string based connections without arguments
+        SenderObject sender;
+        ReceiverObject receiver;
+        receiver.reset();
+        QVERIFY(connect(&sender, SIGNAL(signal1()), &receiver, SLOT(slot1()), type));
+        for (int i = 0; i < 10; ++i)
+            sender.emitSignal1();
+        QCOMPARE(receiver.count_slot1, 0);
+        QCoreApplication::processEvents();
+        QCOMPARE(receiver.count_slot1, 10);
+    }
+
+    {
+        // pending emissions are dropped with the receiver
+        SenderObject sender;
+        QObject *context = new QObject;
+        int called = 0;
+        connect(&sender, &SenderObject::signal7, context,
+                [&called](int, const QString &) { ++called; }, type);
+        emit sender.signal7(1, QStringLiteral("one"));
+        emit sender.signal7(2, QStringLiteral("two"));
+        delete context;
+        QCoreApplication::processEvents();
+        QCOMPARE(called, 0);
+    }
+
+    {
+        // emissions from another thread are delivered in order
+        class Emitter : public QThread
+        {
+        public:
+            SenderObject *sender;
+            void run() override
+            {
+                for (int i = 0; i < 10000; ++i)
+                    emit sender->signal7(i, QString());
+            }
+        };
+
+        SenderObject sender;
+        QObject context;
+        QVector<int> values;
+        connect(&sender, &SenderObject::signal7, &context,
+                [&values](int i, const QString &) { values.append(i); },
+                Qt::ConnectionType(Qt::AutoConnection | Qt::BatchedConnection));
+
+        Emitter emitter;
+        emitter.sender = &sender;
+        emitter.start();
+        QVERIFY(emitter.wait());
+        QTRY_COMPARE(values.size(), 10000);
+        for (int i = 0; i < values.size(); ++i)
+            QCOMPARE(values.at(i), i);
+    }
+}
+
 class EventSpy : public QObject
 {
     Q_OBJECT
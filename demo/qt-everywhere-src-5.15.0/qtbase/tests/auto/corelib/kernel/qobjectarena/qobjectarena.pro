@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qobjectarena
+QT = core-private testlib
+SOURCES = tst_qobjectarena.cpp
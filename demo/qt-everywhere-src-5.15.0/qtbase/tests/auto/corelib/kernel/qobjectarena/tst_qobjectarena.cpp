@@ -0,0 +1,194 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+
+#include <QtCore/qpointer.h>
+#include <QtCore/private/qobjectarena_p.h>
+#include <QtCore/private/qobject_p.h>
+
+class Node : public QObject
+{
+public:
+    explicit Node(QObject *parent = nullptr, int *destroyed = nullptr)
+        : QObject(parent), destroyedCounter(destroyed)
+    {}
+    ~Node()
+    {
+        if (destroyedCounter)
+            ++*destroyedCounter;
+    }
+
+    int *destroyedCounter;
+    char payload[100];
+};
+
+class tst_QObjectArena : public QObject
+{
+    Q_OBJECT
+private slots:
+    void createTree();
+    void deleteObjects();
+    void deleteLater();
+    void mixedOwnership();
+    void largeObjects();
+    void reuseAfterRelease();
+};
+
+void tst_QObjectArena::createTree()
+{
+    int destroyed = 0;
+    QObjectArena arena(4096);
+    Node *root = arena.create<Node>(nullptr, &destroyed);
+    for (int i = 0; i < 100; ++i) {
+        Node *child = arena.create<Node>(root, &destroyed);
+        for (int j = 0; j < 10; ++j)
+            arena.create<Node>(child, &destroyed);
+    }
+    QCOMPARE(arena.objectCount(), qsizetype(1 + 100 + 1000));
+    QCOMPARE(root->children().size(), 100);
+    QVERIFY(arena.bytesAllocated() > qsizetype(1101 * sizeof(Node)));
+
+    QPointer<Node> guard(root);
+    QSignalSpy spy(root, &QObject::destroyed);
+    arena.release();
+    QCOMPARE(destroyed, 1101);
+    QCOMPARE(spy.count(), 1);
+    QVERIFY(guard.isNull());
+    QCOMPARE(arena.objectCount(), qsizetype(0));
+    QCOMPARE(arena.bytesAllocated(), qsizetype(0));
+}
+
+void tst_QObjectArena::deleteObjects()
+{
+    int destroyed = 0;
+    QObjectArena arena;
+    Node *root = arena.create<Node>(nullptr, &destroyed);
+    Node *first = arena.create<Node>(root, &destroyed);
+    Node *second = arena.create<Node>(root, &destroyed);
+    arena.create<Node>(first, &destroyed);
+
+    delete second;
+    QCOMPARE(destroyed, 1);
+    QCOMPARE(arena.objectCount(), qsizetype(3));
+    QCOMPARE(root->children().size(), 1);
+
+    // deleting a parent deletes its arena children too
+    delete first;
+    QCOMPARE(destroyed, 3);
+    QCOMPARE(arena.objectCount(), qsizetype(1));
+
+    arena.release();
+    QCOMPARE(destroyed, 4);
+}
+
+void tst_QObjectArena::deleteLater()
+{
+    int destroyed = 0;
+    QObjectArena arena;
+    Node *root = arena.create<Node>(nullptr, &destroyed);
+    Node *child = arena.create<Node>(root, &destroyed);
+    Node *pending = arena.create<Node>(root, &destroyed);
+
+    child->deleteLater();
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    QCOMPARE(destroyed, 1);
+    QCOMPARE(arena.objectCount(), qsizetype(2));
+
+    // releasing the arena removes the deferred delete of objects it destroys
+    pending->deleteLater();
+    arena.release();
+    QCOMPARE(destroyed, 3);
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    QCOMPARE(destroyed, 3);
+}
+
+void tst_QObjectArena::mixedOwnership()
+{
+    int destroyed = 0;
+    QScopedPointer<Node> heapParent(new Node(nullptr, &destroyed));
+    {
+        QObjectArena arena;
+        Node *arenaChild = arena.create<Node>(heapParent.data(), &destroyed);
+        QPointer<Node> heapGrandChild(new Node(arenaChild, &destroyed));
+        QCOMPARE(heapParent->children().size(), 1);
+        QCOMPARE(arena.objectCount(), qsizetype(1));
+
+        // heap objects can be owned by arena objects
+        QVERIFY(QObjectPrivate::get(heapGrandChild.data())->parent == arenaChild);
+
+        arena.release();
+        QVERIFY(heapGrandChild.isNull());
+        QCOMPARE(destroyed, 2);
+        QVERIFY(heapParent->children().isEmpty());
+    }
+
+    // deleting an arena object's heap parent before the release
+    QObjectArena arena;
+    Node *parent = new Node(nullptr, &destroyed);
+    arena.create<Node>(parent, &destroyed);
+    delete parent;
+    QCOMPARE(destroyed, 4);
+    QCOMPARE(arena.objectCount(), qsizetype(0));
+}
+
+void tst_QObjectArena::largeObjects()
+{
+    struct Large : QObject
+    {
+        char data[10000];
+    };
+
+    QObjectArena arena(1024);
+    QObject *root = arena.create<QObject>();
+    for (int i = 0; i < 10; ++i) {
+        Large *large = arena.create<Large>();
+        large->setParent(root);
+        memset(large->data, i, sizeof(large->data));
+    }
+    QCOMPARE(root->children().size(), 10);
+    QCOMPARE(arena.objectCount(), qsizetype(11));
+    QVERIFY(arena.bytesAllocated() >= qsizetype(10 * sizeof(Large)));
+}
+
+void tst_QObjectArena::reuseAfterRelease()
+{
+    QObjectArena arena;
+    for (int round = 0; round < 3; ++round) {
+        QObject *root = arena.create<QObject>();
+        root->setObjectName(QStringLiteral("root"));
+        for (int i = 0; i < 50; ++i)
+            arena.create<QObject>(root)->setProperty("index", i);
+        QCOMPARE(root->findChildren<QObject *>().size(), 50);
+        QCOMPARE(arena.objectCount(), qsizetype(51));
+        arena.release();
+        QCOMPARE(arena.objectCount(), qsizetype(0));
+    }
+}
+
+QTEST_MAIN(tst_QObjectArena)
+#include "tst_qobjectarena.moc"
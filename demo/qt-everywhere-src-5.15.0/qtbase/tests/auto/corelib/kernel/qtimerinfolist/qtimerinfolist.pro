@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qtimerinfolist
+QT = core-private testlib
+SOURCES = tst_qtimerinfolist.cpp
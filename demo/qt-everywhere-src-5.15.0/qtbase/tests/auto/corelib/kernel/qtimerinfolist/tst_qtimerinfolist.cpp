@@ -0,0 +1,157 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/private/qtimerinfo_unix_p.h>
+
+class TimerReceiver : public QObject
+{
+public:
+    QVector<int> fired;
+
+protected:
+    void timerEvent(QTimerEvent *event) override
+    {
+        fired.append(event->timerId());
+    }
+};
+
+class tst_QTimerInfoList : public QObject
+{
+    Q_OBJECT
+private slots:
+    void registerAndUnregister();
+    void activationOrder();
+    void remainingTime();
+    void statistics();
+
+private:
+    static void activateUntil(QTimerInfoList &list, TimerReceiver &receiver, int count);
+};
+
+void tst_QTimerInfoList::activateUntil(QTimerInfoList &list, TimerReceiver &receiver, int count)
+{
+    QElapsedTimer timer;
+    timer.start();
+    while (receiver.fired.size() < count && timer.elapsed() < 5000) {
+        timespec tm;
+        if (list.timerWait(tm))
+            QTest::qSleep(int(tm.tv_sec * 1000 + (tm.tv_nsec + 999999) / 1000000));
+        list.activateTimers();
+    }
+}
+
+void tst_QTimerInfoList::registerAndUnregister()
+{
+    QTimerInfoList list;
+    TimerReceiver receiver;
+    QVERIFY(list.isEmpty());
+
+    // spread the timeouts over several wheel levels
+    for (int i = 1; i <= 1000; ++i)
+        list.registerTimer(i, i * 37, Qt::PreciseTimer, &receiver);
+    QCOMPARE(list.size(), 1000);
+    QCOMPARE(list.registeredTimers(&receiver).size(), 1000);
+
+    for (int i = 2; i <= 1000; i += 2)
+        QVERIFY(list.unregisterTimer(i));
+    QVERIFY(!list.unregisterTimer(2));
+    QCOMPARE(list.size(), 500);
+
+    timespec tm;
+    QVERIFY(list.timerWait(tm));
+    QVERIFY(tm.tv_sec < 1);
+
+    QVERIFY(list.unregisterTimers(&receiver));
+    QVERIFY(list.isEmpty());
+    QVERIFY(!list.timerWait(tm));
+    QVERIFY(!list.unregisterTimers(&receiver));
+}
+
+void tst_QTimerInfoList::activationOrder()
+{
+    QTimerInfoList list;
+    TimerReceiver receiver;
+
+    list.registerTimer(1, 60, Qt::PreciseTimer, &receiver);
+    list.registerTimer(2, 20, Qt::PreciseTimer, &receiver);
+    list.registerTimer(3, 0, Qt::PreciseTimer, &receiver);
+    list.registerTimer(4, 40, Qt::PreciseTimer, &receiver);
+
+    activateUntil(list, receiver, 4);
+    QCOMPARE(receiver.fired.mid(0, 4), QVector<int>({ 3, 2, 4, 1 }));
+
+    // zero timers fire on every pass, in registration order
+    QTimerInfoList zeroList;
+    TimerReceiver zeroReceiver;
+    for (int i = 1; i <= 5; ++i)
+        zeroList.registerTimer(i, 0, Qt::PreciseTimer, &zeroReceiver);
+    zeroList.activateTimers();
+    QCOMPARE(zeroReceiver.fired, QVector<int>({ 1, 2, 3, 4, 5 }));
+}
+
+void tst_QTimerInfoList::remainingTime()
+{
+    QTimerInfoList list;
+    TimerReceiver receiver;
+
+    list.registerTimer(1, 10000, Qt::PreciseTimer, &receiver);
+    list.registerTimer(2, 1000000, Qt::VeryCoarseTimer, &receiver);
+
+    int remaining = list.timerRemainingTime(1);
+    QVERIFY(remaining > 9000 && remaining <= 10000);
+    remaining = list.timerRemainingTime(2);
+    QVERIFY(remaining > 999000 && remaining <= 1000000);
+    QCOMPARE(list.timerRemainingTime(3), -1);
+}
+
+void tst_QTimerInfoList::statistics()
+{
+    QTimerInfoList list;
+    TimerReceiver receiver;
+
+    list.registerTimer(1, 10, Qt::PreciseTimer, &receiver);
+    list.registerTimer(2, 30, Qt::CoarseTimer, &receiver);
+    activateUntil(list, receiver, 6);
+
+    const QTimerInfoList::TimerStatistics precise = list.statistics(Qt::PreciseTimer);
+    QVERIFY(precise.activations > 0);
+    QCOMPARE(precise.totalSlack, qint64(0));
+    QVERIFY(precise.maxLatency >= 0);
+    QVERIFY(precise.totalLatency >= precise.maxLatency);
+    QVERIFY(list.statistics(Qt::CoarseTimer).activations > 0);
+    QCOMPARE(list.statistics(Qt::VeryCoarseTimer).activations, quint64(0));
+
+    list.resetStatistics();
+    QCOMPARE(list.statistics(Qt::PreciseTimer).activations, quint64(0));
+    QCOMPARE(list.statistics(Qt::CoarseTimer).maxSlack, qint64(0));
+}
+
+QTEST_MAIN(tst_QTimerInfoList)
+#include "tst_qtimerinfolist.moc"
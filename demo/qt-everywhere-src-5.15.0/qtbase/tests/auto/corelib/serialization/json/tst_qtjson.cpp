@@ -32,6 +32,7 @@
 #include "qjsonobject.h"
 #include "qjsonvalue.h"
 #include "qjsondocument.h"
+#include "private/qjsontape_p.h"
 #include "qregularexpression.h"
 #include <limits>
 
@@ -167,6 +168,11 @@ private Q_SLOTS:
     void streamVariantSerialization();
     void escapeSurrogateCodePoints_data();
     void escapeSurrogateCodePoints();
+
+    void jsonTape_data();
+    void jsonTape();
+    void jsonTapeAccess();
+    void jsonTapeFile();
 private:
     QString testDataDir;
 };
@@ -3366,5 +3372,157 @@ void tst_QtJson::escapeSurrogateCodePoints()
     QVERIFY(buffer.contains(escStr));
 }
 
+static QJsonValue documentValue(const QJsonDocument &doc)
+{
+    return doc.isArray() ? QJsonValue(doc.array()) : QJsonValue(doc.object());
+}
+
+// Rebuilds the value by walking the tape instead of materializing it.
+static QJsonValue walkTape(const QJsonTapeValue &value)
+{
+    if (value.isArray()) {
+        QJsonArray array;
+        for (const QJsonTapeValue &element : value)
+            array.append(walkTape(element));
+        return array;
+    }
+    if (value.isObject()) {
+        QJsonObject object;
+        for (auto it = value.begin(); it != value.end(); ++it)
+            object.insert(it.key(), walkTape(it.value()));
+        return object;
+    }
+    if (value.isString())
+        return value.toString();
+    if (value.isBool())
+        return value.toBool();
+    if (value.isNull())
+        return QJsonValue(QJsonValue::Null);
+    return value.toValue();
+}
+
+void tst_QtJson::jsonTape_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("empty-object") << QByteArray("{}");
+    QTest::newRow("empty-array") << QByteArray(" [ ] ");
+    QTest::newRow("literals") << QByteArray("[null, true, false]");
+    QTest::newRow("numbers") << QByteArray("[0, -1, 1.5, -2e3, 1E-2, 9007199254740993, "
+                                           "9223372036854775807, 9223372036854775808]");
+    QTest::newRow("strings") << QByteArray("[\"\", \"abc\", \"" UNICODE_DJE "\", "
+                                           "\"\\\"\\\\\\/\\b\\f\\n\\r\\t\", \"\\u00e9\\ud834\\udd1e\", \"\\ud800\"]");
+    QTest::newRow("nested") << QByteArray("{\"a\": [1, {\"b\": [[], {}]}], \"c\": {\"d\": null}}");
+    QTest::newRow("duplicate-keys") << QByteArray("{\"a\": 1, \"b\": 2, \"a\": 3}");
+    QTest::newRow("escaped-keys") << QByteArray("{\"\\u0061\": 1, \"a\": 2, \"\\n\": 3}");
+    QTest::newRow("bom") << QByteArray("\xef\xbb\xbf[1]");
+
+    QTest::newRow("not-a-container") << QByteArray("42");
+    QTest::newRow("trailing-comma") << QByteArray("{ \"value\": false, }");
+    QTest::newRow("missing-value") << QByteArray("{ \"value\": , } ");
+    QTest::newRow("missing-separator") << QByteArray("{ \"value\" false }");
+    QTest::newRow("unterminated-array") << QByteArray("[1, 2");
+    QTest::newRow("unterminated-string") << QByteArray("[\"abc");
+    QTest::newRow("illegal-literal") << QByteArray("[tru]");
+    QTest::newRow("illegal-number") << QByteArray("[-]");
+    QTest::newRow("illegal-escape") << QByteArray("[\"\\u12\"]");
+    QTest::newRow("illegal-utf8") << QByteArray("[\"" INVALID_UNICODE "\"]");
+    QTest::newRow("garbage-at-end") << QByteArray("[1] x");
+    QTest::newRow("deep-nesting") << (QByteArray(2000, '[') + QByteArray(2000, ']'));
+}
+
+void tst_QtJson::jsonTape()
+{
+    QFETCH(QByteArray, json);
+
+    QJsonParseError expected;
+    const QJsonDocument doc = QJsonDocument::fromJson(json, &expected);
+
+    QJsonTape tape;
+    QJsonParseError error;
+    QCOMPARE(tape.load(json, &error), expected.error == QJsonParseError::NoError);
+    QCOMPARE(error.error, expected.error);
+    QCOMPARE(error.offset, expected.offset);
+    QCOMPARE(tape.isEmpty(), doc.isNull());
+    if (doc.isNull()) {
+        QVERIFY(tape.root().isUndefined());
+        return;
+    }
+
+    QCOMPARE(tape.root().toValue(), documentValue(doc));
+    QCOMPARE(walkTape(tape.root()), documentValue(doc));
+}
+
+void tst_QtJson::jsonTapeAccess()
+{
+    const QByteArray json("{\"name\": \"tape\", \"list\": [1, 2.5, \"x\", null, true],"
+                          " \"escaped\": \"a\\\"b\\u00e9\", \"nested\": {\"k\": [{}]},"
+                          " \"dup\": 1, \"dup\": 2}");
+    QJsonTape tape;
+    QVERIFY(tape.load(json));
+
+    const QJsonTapeValue root = tape.root();
+    QVERIFY(root.isObject());
+    QCOMPARE(root.size(), 6);
+    QCOMPARE(root.keys(), QStringList({ "name", "list", "escaped", "nested", "dup", "dup" }));
+    QVERIFY(root.contains(u"list"));
+    QVERIFY(!root.contains(u"missing"));
+    QVERIFY(root[u"missing"].isUndefined());
+    QCOMPARE(root[u"dup"].toInt(), 2);
+
+    const QJsonTapeValue list = root[u"list"];
+    QVERIFY(list.isArray());
+    QCOMPARE(list.size(), 5);
+    QCOMPARE(list[0].toInt(), 1);
+    QCOMPARE(list[1].toDouble(), 2.5);
+    QCOMPARE(list[1].toInt(-1), -1);
+    QCOMPARE(list[2].toString(), QString("x"));
+    QVERIFY(list[3].isNull());
+    QCOMPARE(list[4].toBool(), true);
+    QVERIFY(list[5].isUndefined());
+    QVERIFY(list[-1].isUndefined());
+    QVERIFY(list[u"x"].isUndefined());
+    QCOMPARE(list.toArray(), QJsonArray({ 1, 2.5, "x", QJsonValue(), true }));
+
+    QCOMPARE(root[u"escaped"].toString(), QString::fromUtf8("a\"b\xc3\xa9"));
+    QCOMPARE(root[u"escaped"].toUtf8(), QByteArray("a\"b\xc3\xa9"));
+    QCOMPARE(root[u"nested"].toObject(), QJsonObject({ { "k", QJsonArray({ QJsonObject() }) } }));
+
+    // unescaped strings refer to the document's bytes
+    const QByteArray name = root[u"name"].toUtf8();
+    QCOMPARE(name, QByteArray("tape"));
+    QVERIFY(name.constData() > json.constData());
+    QVERIFY(name.constData() < json.constData() + json.size());
+    QVERIFY(list.toUtf8().isNull());
+    QVERIFY(list.begin() != list.end());
+    QVERIFY(list[0].begin() == list[0].end());
+
+    QVERIFY(QJsonTapeValue().isUndefined());
+    QCOMPARE(QJsonTapeValue().size(), 0);
+    QCOMPARE(QJsonTapeValue().toValue(), QJsonValue(QJsonValue::Undefined));
+}
+
+void tst_QtJson::jsonTapeFile()
+{
+    const QString fileName = testDataDir + "/test.json";
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+    QVERIFY(!doc.isNull());
+
+    QJsonTape tape;
+    QVERIFY(tape.loadFile(fileName));
+    QCOMPARE(tape.root().toValue(), documentValue(doc));
+    QCOMPARE(walkTape(tape.root()), documentValue(doc));
+
+    tape.clear();
+    QVERIFY(tape.isEmpty());
+
+    QJsonParseError error;
+    QVERIFY(!tape.loadFile(testDataDir + "/does-not-exist.json", &error));
+    QVERIFY(error.error != QJsonParseError::NoError);
+    QVERIFY(tape.isEmpty());
+}
+
 QTEST_MAIN(tst_QtJson)
 #include "tst_qtjson.moc"
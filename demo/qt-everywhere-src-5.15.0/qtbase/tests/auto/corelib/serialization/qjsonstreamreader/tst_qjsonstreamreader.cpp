@@ -0,0 +1,420 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/qjsonstreamreader.h>
+#include <QtCore/qbuffer.h>
+#include <QtTest>
+
+class tst_QJsonStreamReader : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void basics();
+    void tokens_data();
+    void tokens();
+    void incremental_data() { tokens_data(); }
+    void incremental();
+    void device_data() { tokens_data(); }
+    void device();
+    void values_data();
+    void values();
+    void errors_data();
+    void errors();
+    void truncatedDevice_data();
+    void truncatedDevice();
+    void skipCurrentElement();
+    void skipIncremental();
+    void multipleDocuments();
+    void currentOffset();
+};
+
+static QString describe(const QJsonStreamReader &reader)
+{
+    switch (reader.tokenType()) {
+    case QJsonStreamReader::Name:
+    case QJsonStreamReader::String:
+    case QJsonStreamReader::Number:
+    case QJsonStreamReader::Bool:
+        return reader.tokenString() + QLatin1Char(':') + reader.text();
+    default:
+        return reader.tokenString();
+    }
+}
+
+static QStringList readAll(QJsonStreamReader &reader)
+{
+    QStringList result;
+    while (reader.readNext() != QJsonStreamReader::NoToken) {
+        result << describe(reader);
+        if (reader.hasError())
+            break;
+    }
+    return result;
+}
+
+void tst_QJsonStreamReader::basics()
+{
+    QJsonStreamReader reader;
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::NoToken);
+    QCOMPARE(reader.device(), nullptr);
+    QCOMPARE(reader.depth(), 0);
+    QVERIFY(reader.atEnd());
+    QVERIFY(!reader.hasError());
+    QCOMPARE(reader.error(), QJsonParseError::NoError);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::NoToken);
+    QVERIFY(reader.text().isNull());
+    QVERIFY(reader.value().isUndefined());
+
+    reader.addData("[1]");
+    QVERIFY(!reader.atEnd());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.depth(), 1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.depth(), 0);
+    QVERIFY(reader.atEnd());
+
+    reader.addData("{");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    reader.clear();
+    QCOMPARE(reader.depth(), 0);
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::NoToken);
+    QVERIFY(reader.atEnd());
+}
+
+void tst_QJsonStreamReader::tokens_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<QStringList>("expected");
+
+    QTest::newRow("empty-object") << QByteArray("{}")
+                                  << QStringList{ "StartObject", "EndObject" };
+    QTest::newRow("empty-array") << QByteArray(" [ ] \n")
+                                 << QStringList{ "StartArray", "EndArray" };
+    QTest::newRow("bom") << QByteArray("\xef\xbb\xbf[null]")
+                         << QStringList{ "StartArray", "Null", "EndArray" };
+    QTest::newRow("literals") << QByteArray("[null, true, false]")
+                              << QStringList{ "StartArray", "Null", "Bool:true", "Bool:false",
+                                              "EndArray" };
+    QTest::newRow("numbers") << QByteArray("[0,-1, 1.5e3 ,2E-2]")
+                             << QStringList{ "StartArray", "Number:0", "Number:-1",
+                                             "Number:1.5e3", "Number:2E-2", "EndArray" };
+    QTest::newRow("strings") << QByteArray("[\"\", \"a\\\"b\\u00e9\", \"\xc3\xa9\xe2\x82\xac\xf0\x9d\x84\x9e\"]")
+                             << QStringList{ "StartArray", "String:",
+                                             QString::fromUtf8("String:a\"b\xc3\xa9"),
+                                             QString::fromUtf8("String:\xc3\xa9\xe2\x82\xac\xf0\x9d\x84\x9e"),
+                                             "EndArray" };
+    QTest::newRow("nested") << QByteArray("{\"a\": [1, {\"b\": {}}], \"c\": \"d\"}")
+                            << QStringList{ "StartObject", "Name:a", "StartArray", "Number:1",
+                                            "StartObject", "Name:b", "StartObject", "EndObject",
+                                            "EndObject", "EndArray", "Name:c", "String:d",
+                                            "EndObject" };
+}
+
+void tst_QJsonStreamReader::tokens()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QStringList, expected);
+
+    QJsonStreamReader reader(json);
+    QCOMPARE(readAll(reader), expected);
+    QVERIFY(!reader.hasError());
+    QVERIFY(reader.atEnd());
+}
+
+void tst_QJsonStreamReader::incremental()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QStringList, expected);
+
+    // feed one byte at a time, so that every token is split
+    QJsonStreamReader reader;
+    QStringList result;
+    for (char c : qAsConst(json)) {
+        reader.addData(QByteArray(1, c));
+        result += readAll(reader);
+    }
+    QCOMPARE(result, expected);
+    QVERIFY(!reader.hasError());
+    QVERIFY(reader.atEnd());
+}
+
+void tst_QJsonStreamReader::device()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(QStringList, expected);
+
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QJsonStreamReader reader(&buffer);
+    QCOMPARE(reader.device(), &buffer);
+    QCOMPARE(readAll(reader), expected);
+    QVERIFY(!reader.hasError());
+    QVERIFY(reader.atEnd());
+}
+
+void tst_QJsonStreamReader::values_data()
+{
+    QTest::addColumn<QByteArray>("number");
+    QTest::addColumn<bool>("isInteger");
+    QTest::addColumn<qint64>("integer");
+    QTest::addColumn<double>("dbl");
+
+    QTest::newRow("zero") << QByteArray("0") << true << qint64(0) << 0.;
+    QTest::newRow("negative") << QByteArray("-42") << true << qint64(-42) << -42.;
+    QTest::newRow("large") << QByteArray("9007199254740993") << true
+                           << Q_INT64_C(9007199254740993) << 9007199254740993.;
+    QTest::newRow("fraction") << QByteArray("2.5") << false << qint64(-1) << 2.5;
+    QTest::newRow("integral-exponent") << QByteArray("1e3") << false << qint64(1000) << 1000.;
+    QTest::newRow("overflow") << QByteArray("9223372036854775808") << true << qint64(-1)
+                              << 9223372036854775808.;
+}
+
+void tst_QJsonStreamReader::values()
+{
+    QFETCH(QByteArray, number);
+    QFETCH(bool, isInteger);
+    QFETCH(qint64, integer);
+    QFETCH(double, dbl);
+
+    const QByteArray json = "[" + number + "]";
+    QJsonStreamReader reader(json);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.isInteger(), isInteger);
+    QCOMPARE(reader.toInteger(-1), integer);
+    QCOMPARE(reader.toDouble(), dbl);
+    QCOMPARE(reader.value(), QJsonDocument::fromJson(json).array().at(0));
+    QCOMPARE(reader.toBool(true), true);
+
+    QJsonStreamReader other("{\"s\": \"x\", \"b\": false, \"n\": null}");
+    QCOMPARE(other.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(other.readNext(), QJsonStreamReader::Name);
+    QVERIFY(other.value().isUndefined());
+    QCOMPARE(other.readNext(), QJsonStreamReader::String);
+    QCOMPARE(other.value(), QJsonValue("x"));
+    QCOMPARE(other.toDouble(1.5), 1.5);
+    other.readNext();
+    QCOMPARE(other.readNext(), QJsonStreamReader::Bool);
+    QCOMPARE(other.toBool(true), false);
+    QCOMPARE(other.value(), QJsonValue(false));
+    other.readNext();
+    QCOMPARE(other.readNext(), QJsonStreamReader::Null);
+    QCOMPARE(other.value(), QJsonValue(QJsonValue::Null));
+}
+
+void tst_QJsonStreamReader::errors_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("not-a-container") << QByteArray("42 ");
+    QTest::newRow("trailing-comma-object") << QByteArray("{ \"value\": false, }");
+    QTest::newRow("trailing-comma-array") << QByteArray("[ false, ]");
+    QTest::newRow("missing-value") << QByteArray("{ \"value\": , } ");
+    QTest::newRow("missing-name-separator") << QByteArray("{ \"value\" false }");
+    QTest::newRow("missing-value-separator") << QByteArray("[1 2]");
+    QTest::newRow("non-string-name") << QByteArray("{1: 2}");
+    QTest::newRow("illegal-literal") << QByteArray("[nul1]");
+    QTest::newRow("illegal-number") << QByteArray("[-]");
+    QTest::newRow("illegal-escape") << QByteArray("[\"\\u12\"]");
+    QTest::newRow("illegal-utf8") << QByteArray("[\"\xce\xba\xe1\"]");
+    QTest::newRow("deep-nesting") << (QByteArray(2000, '[') + QByteArray(2000, ']'));
+}
+
+void tst_QJsonStreamReader::errors()
+{
+    QFETCH(QByteArray, json);
+
+    QJsonParseError expected;
+    QJsonDocument::fromJson(json, &expected);
+    QVERIFY(expected.error != QJsonParseError::NoError);
+
+    QJsonStreamReader reader(json);
+    while (reader.readNext() != QJsonStreamReader::NoToken && !reader.hasError()) {}
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error(), expected.error);
+    QCOMPARE(reader.errorString(), expected.errorString());
+    QVERIFY(reader.atEnd());
+
+    // errors are sticky
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Invalid);
+    QCOMPARE(reader.error(), expected.error);
+}
+
+void tst_QJsonStreamReader::truncatedDevice_data()
+{
+    QTest::addColumn<QByteArray>("json");
+
+    QTest::newRow("object") << QByteArray("{\"a\": 1 ");
+    QTest::newRow("array") << QByteArray("[1,");
+    QTest::newRow("string") << QByteArray("[\"abc");
+    QTest::newRow("number") << QByteArray("[1, 2");
+}
+
+void tst_QJsonStreamReader::truncatedDevice()
+{
+    QFETCH(QByteArray, json);
+
+    QJsonParseError expected;
+    QJsonDocument::fromJson(json, &expected);
+
+    // without a device the reader keeps waiting for more data
+    QJsonStreamReader waiting(json);
+    readAll(waiting);
+    QVERIFY(!waiting.hasError());
+    QVERIFY(!waiting.atEnd());
+
+    // an exhausted random-access device means the document is truncated
+    QBuffer buffer(&json);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QJsonStreamReader reader(&buffer);
+    readAll(reader);
+    QVERIFY(reader.hasError());
+    QCOMPARE(reader.error(), expected.error);
+}
+
+void tst_QJsonStreamReader::skipCurrentElement()
+{
+    QJsonStreamReader reader("[{\"a\": [1, \"\\u00e9\", {\"b\": null}], \"c\": 2}, 3]");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QVERIFY(reader.skipCurrentElement());
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.depth(), 0);
+    QVERIFY(reader.atEnd());
+
+    QJsonStreamReader second("[{\"a\": [1, \"\\u00e9\", {\"b\": null}], \"c\": 2}, 3]");
+    QCOMPARE(second.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(second.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(second.depth(), 2);
+    QVERIFY(second.skipCurrentElement());
+    QCOMPARE(second.tokenType(), QJsonStreamReader::EndObject);
+    QCOMPARE(second.depth(), 1);
+    QCOMPARE(second.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(second.toInteger(), qint64(3));
+
+    // on scalars, nothing happens
+    QVERIFY(second.skipCurrentElement());
+    QCOMPARE(second.tokenType(), QJsonStreamReader::Number);
+    QCOMPARE(second.readNext(), QJsonStreamReader::EndArray);
+}
+
+void tst_QJsonStreamReader::skipIncremental()
+{
+    const QByteArray json("{\"skip\": {\"x\": [1, 2, {\"y\": \"z\"}]}, \"keep\": true}");
+    QJsonStreamReader reader;
+    int i = 0;
+    auto feed = [&]() {
+        if (i >= json.size())
+            return false;
+        reader.addData(json.mid(i++, 1));
+        return true;
+    };
+
+    while (reader.readNext() != QJsonStreamReader::StartObject)
+        QVERIFY(feed());
+    while (reader.readNext() != QJsonStreamReader::Name)
+        QVERIFY(feed());
+    QCOMPARE(reader.text(), QString("skip"));
+    while (reader.readNext() != QJsonStreamReader::StartObject)
+        QVERIFY(feed());
+
+    bool skipped = reader.skipCurrentElement();
+    while (!skipped) {
+        QVERIFY(feed());
+        skipped = reader.readNext() == QJsonStreamReader::EndObject;
+    }
+    QCOMPARE(reader.depth(), 1);
+
+    while (reader.readNext() != QJsonStreamReader::Name)
+        QVERIFY(feed());
+    QCOMPARE(reader.text(), QString("keep"));
+    while (reader.readNext() != QJsonStreamReader::Bool)
+        QVERIFY(feed());
+    QCOMPARE(reader.toBool(), true);
+}
+
+void tst_QJsonStreamReader::multipleDocuments()
+{
+    QByteArray log;
+    for (int i = 0; i < 5000; ++i)
+        log += "{\"id\": " + QByteArray::number(i) + ", \"payload\": [\"" + QByteArray(i % 97, 'x')
+                + "\"]}\n";
+
+    QBuffer buffer(&log);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QJsonStreamReader reader(&buffer);
+    int documents = 0;
+    qint64 idSum = 0;
+    while (!reader.atEnd()) {
+        switch (reader.readNext()) {
+        case QJsonStreamReader::Name:
+            if (reader.text() == QLatin1String("id")) {
+                QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+                idSum += reader.toInteger();
+            } else {
+                QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+                QVERIFY(reader.skipCurrentElement());
+            }
+            break;
+        case QJsonStreamReader::EndObject:
+            if (reader.depth() == 0)
+                ++documents;
+            break;
+        default:
+            break;
+        }
+    }
+    QVERIFY(!reader.hasError());
+    QCOMPARE(documents, 5000);
+    QCOMPARE(idSum, qint64(4999) * 5000 / 2);
+}
+
+void tst_QJsonStreamReader::currentOffset()
+{
+    QJsonStreamReader reader;
+    reader.addData("  {\"ab\"");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.currentOffset(), qint64(2));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.currentOffset(), qint64(3));
+    reader.addData(": 1234, \"x\": tru");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Number);
+    QCOMPARE(reader.currentOffset(), qint64(9));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+    QCOMPARE(reader.currentOffset(), qint64(15));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::NoToken);
+    reader.addData("e}");
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Bool);
+    QCOMPARE(reader.currentOffset(), qint64(20));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+    QCOMPARE(reader.currentOffset(), qint64(24));
+}
+
+QTEST_MAIN(tst_QJsonStreamReader)
+#include "tst_qjsonstreamreader.moc"
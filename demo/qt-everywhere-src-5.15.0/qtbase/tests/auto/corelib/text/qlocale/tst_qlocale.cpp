@@ -899,6 +899,15 @@ void tst_QLocale::stringToDouble_data()
     // Underflow:
     QTest::newRow("C tiny") << QString("C") << QString("2e-324") << false << 0.;
     QTest::newRow("C -tiny") << QString("C") << QString("-2e-324") << false << 0.;
+    // Either side of the limits of the exact short-decimal conversion:
+    QTest::newRow("C 15 digits") << QString("C") << QString("123456789012345") << true << 123456789012345.;
+    QTest::newRow("C 16 digits") << QString("C") << QString("1234567890123456") << true << 1234567890123456.;
+    QTest::newRow("C 1e22") << QString("C") << QString("1e22") << true << 1e22;
+    QTest::newRow("C 1e23") << QString("C") << QString("1e23") << true << 1e23;
+    QTest::newRow("C 0.1") << QString("C") << QString("0.1") << true << 0.1;
+    QTest::newRow("C -0.0031") << QString("C") << QString("-0.0031") << true << -0.0031;
+    QTest::newRow("C 6.02e3") << QString("C") << QString("6.02e3") << true << 6.02e3;
+    QTest::newRow("C 1e-22") << QString("C") << QString("1e-22") << true << 1e-22;
 }
 
 void tst_QLocale::stringToDouble()
@@ -78,6 +78,7 @@ private slots:
     void QStringAndQStringRefEquivalence();
     void threadSafety_data();
     void threadSafety();
+    void sharedCompiledPatterns();
 
     void wildcard_data();
     void wildcard();
@@ -2157,6 +2158,42 @@ void tst_QRegularExpression::threadSafety()
     }
 }
 
+void tst_QRegularExpression::sharedCompiledPatterns()
+{
+    // objects built from the same pattern share the compiled code, but
+    // must still honor their own pattern options
+    QRegularExpression caseSensitive("ab(?<x>c)");
+    QRegularExpression caseInsensitive("ab(?<x>c)", QRegularExpression::CaseInsensitiveOption);
+    QVERIFY(caseSensitive.isValid());
+    QVERIFY(caseInsensitive.isValid());
+    QVERIFY(!caseSensitive.match("ABC").hasMatch());
+    QVERIFY(caseInsensitive.match("ABC").hasMatch());
+
+    {
+        QRegularExpression again("ab(?<x>c)");
+        QCOMPARE(again.captureCount(), 1);
+        QCOMPARE(again.namedCaptureGroups(), QStringList() << QString() << "x");
+        QCOMPARE(again.match("xabc").captured("x"), QString("c"));
+    }
+    QVERIFY(caseSensitive.match("abc").hasMatch());
+
+    // changing the pattern releases the shared code
+    caseSensitive.setPattern("ab(");
+    QVERIFY(!caseSensitive.isValid());
+    QVERIFY(!caseSensitive.match("ab(").hasMatch());
+    caseSensitive.setPattern("ab(?<x>c)");
+    QVERIFY(caseSensitive.isValid());
+    QCOMPARE(caseSensitive.match("abc").captured("x"), QString("c"));
+
+    // a pattern that was used before and dropped is found again
+    for (int i = 0; i < 3; ++i) {
+        QRegularExpression re("^(\\d+)-(\\d+)$");
+        QRegularExpressionMatch match = re.match("12-345");
+        QVERIFY(match.hasMatch());
+        QCOMPARE(match.captured(2), QString("345"));
+    }
+}
+
 void tst_QRegularExpression::wildcard_data()
 {
     QTest::addColumn<QString>("pattern");
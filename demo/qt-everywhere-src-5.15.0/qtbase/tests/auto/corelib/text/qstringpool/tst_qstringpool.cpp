@@ -0,0 +1,149 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtCore/QString>
+#include <QtCore/QThreadPool>
+#include <QtCore/QVector>
+#include <private/qstringpool_p.h>
+
+class tst_QStringPool : public QObject
+{
+    Q_OBJECT
+private slots:
+    void intern();
+    void internView();
+    void compactsStorage();
+    void empty();
+    void removeUnused();
+    void concurrent();
+};
+
+void tst_QStringPool::intern()
+{
+    QStringPool pool;
+    QString a = QString(QLatin1String("12345"));
+    QString b = QString(QLatin1String("12345"));
+    QVERIFY(!a.isSharedWith(b));
+
+    const QString ia = pool.intern(a);
+    const QString ib = pool.intern(b);
+    QCOMPARE(ia, a);
+    QVERIFY(ia.isSharedWith(ib));
+    QVERIFY(ia.isSharedWith(a));
+    QCOMPARE(pool.size(), 1);
+
+    const QString other = pool.intern(QString::number(54321));
+    QVERIFY(!other.isSharedWith(ia));
+    QCOMPARE(pool.size(), 2);
+    QVERIFY(pool.contains(u"12345"));
+    QVERIFY(!pool.contains(u"99999"));
+}
+
+void tst_QStringPool::internView()
+{
+    QStringPool pool;
+    const QString source = QStringLiteral("key=value");
+    const QString key = pool.intern(QStringView(source).left(3));
+    QCOMPARE(key, QStringLiteral("key"));
+    QVERIFY(pool.intern(QStringView(source).mid(4)) == QLatin1String("value"));
+    QVERIFY(pool.intern(QLatin1String("key")).isSharedWith(key));
+    QCOMPARE(pool.size(), 2);
+}
+
+void tst_QStringPool::compactsStorage()
+{
+    QStringPool pool;
+    QString built;
+    built.reserve(100);
+    built += QLatin1String("abc");
+    const QString interned = pool.intern(built);
+    QCOMPARE(interned, built);
+    QVERIFY(!interned.isSharedWith(built));
+    QCOMPARE(interned.capacity(), interned.size());
+
+    const QChar raw[] = { QLatin1Char('x'), QLatin1Char('y') };
+    const QString rawString = QString::fromRawData(raw, 2);
+    const QString internedRaw = pool.intern(rawString);
+    QVERIFY(internedRaw.constData() != raw);
+    QCOMPARE(internedRaw, QStringLiteral("xy"));
+}
+
+void tst_QStringPool::empty()
+{
+    QStringPool pool;
+    QVERIFY(pool.intern(QString()).isNull());
+    QVERIFY(pool.intern(QStringView()).isNull());
+    QVERIFY(pool.intern(QString(QLatin1String(""))).isEmpty());
+    QCOMPARE(pool.size(), 0);
+}
+
+void tst_QStringPool::removeUnused()
+{
+    QStringPool pool;
+    QString kept = pool.intern(QString::number(1));
+    pool.intern(QString::number(2));
+    pool.intern(QString::number(3));
+    QCOMPARE(pool.size(), 3);
+
+    QCOMPARE(pool.removeUnused(), 2);
+    QCOMPARE(pool.size(), 1);
+    QVERIFY(pool.contains(kept));
+
+    pool.clear();
+    QCOMPARE(pool.size(), 0);
+    QCOMPARE(kept, QString::number(1));
+}
+
+void tst_QStringPool::concurrent()
+{
+    QStringPool pool;
+    const int threadCount = 8;
+    QVector<QVector<QString>> results(threadCount);
+
+    QThreadPool threads;
+    threads.setMaxThreadCount(threadCount);
+    for (int t = 0; t < threadCount; ++t) {
+        threads.start([&pool, &results, t]() {
+            for (int i = 0; i < 1000; ++i)
+                results[t].append(pool.intern(QString::number(i % 100)));
+        });
+    }
+    threads.waitForDone();
+
+    QCOMPARE(pool.size(), 100);
+    for (int t = 1; t < threadCount; ++t) {
+        for (int i = 0; i < 1000; ++i)
+            QVERIFY(results.at(t).at(i).isSharedWith(results.at(0).at(i)));
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QStringPool)
+
+#include "tst_qstringpool.moc"
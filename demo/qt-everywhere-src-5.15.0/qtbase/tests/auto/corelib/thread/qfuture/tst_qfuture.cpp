@@ -94,6 +94,13 @@ private slots:
     void nestedExceptions();
 #endif
     void nonGlobalThreadPool();
+    void continuations();
+    void continuationsOnThreadPool();
+#ifndef QT_NO_EXCEPTIONS
+    void continuationExceptions();
+#endif
+    void whenAll();
+    void whenAny();
 };
 
 void tst_QFuture::resultStore()
@@ -1557,5 +1564,182 @@ void tst_QFuture::nonGlobalThreadPool()
     }
 }
 
+void tst_QFuture::continuations()
+{
+    // attached before the future finishes: runs in the finishing thread
+    {
+        QFutureInterface<int> promise;
+        promise.reportStarted();
+        bool called = false;
+        QFuture<QString> str = promise.future().then([&called](int value) {
+            called = true;
+            return QString::number(value);
+        });
+        QFuture<int> length = str.then([](const QFuture<QString> &f) { return f.result().size(); });
+        QVERIFY(!called);
+        QVERIFY(str.isRunning());
+
+        const int value = 123;
+        promise.reportFinished(&value);
+        QVERIFY(called);
+        QVERIFY(str.isFinished());
+        QCOMPARE(str.result(), QStringLiteral("123"));
+        QVERIFY(length.isFinished());
+        QCOMPARE(length.result(), 3);
+    }
+
+    // attached after the future has finished: runs right away
+    {
+        QFutureInterface<void> promise;
+        promise.reportStarted();
+        promise.reportFinished();
+        int calls = 0;
+        QFuture<void> f = promise.future().then([&calls]() { ++calls; });
+        QVERIFY(f.isFinished());
+        QCOMPARE(calls, 1);
+
+        QFuture<int> g = f.then([](QFuture<void> parent) { return parent.isFinished() ? 1 : 0; });
+        QCOMPARE(g.result(), 1);
+    }
+
+    // several continuations on the same future
+    {
+        QFutureInterface<int> promise;
+        promise.reportStarted();
+        QFuture<int> f = promise.future();
+        QFuture<int> a = f.then([](int value) { return value + 1; });
+        QFuture<int> b = f.then([](int value) { return value * 2; });
+        const int result = 10;
+        promise.reportFinished(&result);
+        QCOMPARE(a.result(), 11);
+        QCOMPARE(b.result(), 20);
+    }
+
+    // a continuation that takes the result is skipped for a canceled future
+    {
+        QFutureInterface<int> promise;
+        promise.reportStarted();
+        bool called = false;
+        QFuture<int> f = promise.future().then([&called](int value) { called = true; return value; });
+        QFuture<bool> canceled = promise.future().then([](const QFuture<int> &parent) {
+            return parent.isCanceled();
+        });
+        promise.reportCanceled();
+        promise.reportFinished();
+        QVERIFY(!called);
+        QVERIFY(f.isFinished());
+        QVERIFY(f.isCanceled());
+        QVERIFY(canceled.result());
+    }
+}
+
+void tst_QFuture::continuationsOnThreadPool()
+{
+    QThreadPool pool;
+    QFutureInterface<int> promise;
+    promise.reportStarted();
+
+    QThread *continuationThread = nullptr;
+    QFuture<int> f = promise.future().then(&pool, [&continuationThread](int value) {
+        continuationThread = QThread::currentThread();
+        return value * value;
+    });
+    const int value = 7;
+    promise.reportFinished(&value);
+
+    QCOMPARE(f.result(), 49);
+    QVERIFY(continuationThread);
+    QVERIFY(continuationThread != QThread::currentThread());
+    QVERIFY(pool.waitForDone());
+}
+
+#ifndef QT_NO_EXCEPTIONS
+void tst_QFuture::continuationExceptions()
+{
+    // an exception thrown by the continuation ends up in the returned future
+    {
+        QFutureInterface<int> promise;
+        promise.reportStarted();
+        QFuture<int> f = promise.future().then([](int) -> int { throw DerivedException(); });
+        const int value = 1;
+        promise.reportFinished(&value);
+        QVERIFY(f.isCanceled());
+        QVERIFY_EXCEPTION_THROWN(f.waitForFinished(), DerivedException);
+    }
+
+    // an exception stored in the parent is passed down the chain
+    {
+        bool called = false;
+        QFuture<void> f = createDerivedExceptionFuture().then([&called]() { called = true; });
+        QFuture<void> g = f.then([&called]() { called = true; });
+        QVERIFY(!called);
+        QVERIFY_EXCEPTION_THROWN(g.waitForFinished(), DerivedException);
+    }
+
+    // unknown exceptions become QUnhandledException
+    {
+        QFutureInterface<void> promise;
+        promise.reportStarted();
+        promise.reportFinished();
+        QFuture<void> f = promise.future().then([]() { throw 42; });
+        QVERIFY_EXCEPTION_THROWN(f.waitForFinished(), QUnhandledException);
+    }
+}
+#endif
+
+void tst_QFuture::whenAll()
+{
+    QVector<QFutureInterface<int>> promises(3);
+    QVector<QFuture<int>> futures;
+    for (QFutureInterface<int> &promise : promises) {
+        promise.reportStarted();
+        futures.append(promise.future());
+    }
+
+    QFuture<QList<QFuture<int>>> all = QtFuture::whenAll(futures.cbegin(), futures.cend());
+    QVERIFY(!all.isFinished());
+    for (int i = 0; i < promises.size(); ++i) {
+        QVERIFY(!all.isFinished());
+        promises[i].reportFinished(&i);
+    }
+    QVERIFY(all.isFinished());
+    const QList<QFuture<int>> results = all.result();
+    QCOMPARE(results.size(), 3);
+    for (int i = 0; i < results.size(); ++i)
+        QCOMPARE(results.at(i).result(), i);
+
+    const QVector<QFuture<void>> none;
+    QFuture<QList<QFuture<void>>> empty = QtFuture::whenAll(none.cbegin(), none.cend());
+    QVERIFY(empty.isFinished());
+    QVERIFY(empty.result().isEmpty());
+}
+
+void tst_QFuture::whenAny()
+{
+    QVector<QFutureInterface<int>> promises(3);
+    QVector<QFuture<int>> futures;
+    for (QFutureInterface<int> &promise : promises) {
+        promise.reportStarted();
+        futures.append(promise.future());
+    }
+
+    QFuture<QtFuture::WhenAnyResult<int>> any = QtFuture::whenAny(futures.cbegin(), futures.cend());
+    QVERIFY(!any.isFinished());
+    const int value = 42;
+    promises[1].reportFinished(&value);
+    QVERIFY(any.isFinished());
+    promises[0].reportFinished(&value);
+    promises[2].reportFinished(&value);
+
+    QCOMPARE(any.result().index, 1);
+    QCOMPARE(any.result().future, futures.at(1));
+    QCOMPARE(any.result().future.result(), 42);
+
+    const QVector<QFuture<int>> none;
+    QFuture<QtFuture::WhenAnyResult<int>> empty = QtFuture::whenAny(none.cbegin(), none.cend());
+    QVERIFY(empty.isFinished());
+    QCOMPARE(empty.result().index, -1);
+}
+
 QTEST_MAIN(tst_QFuture)
 #include "tst_qfuture.moc"
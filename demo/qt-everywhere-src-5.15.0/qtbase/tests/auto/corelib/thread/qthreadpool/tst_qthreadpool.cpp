@@ -103,6 +103,8 @@ private slots:
     void stressTest();
     void takeAllAndIncreaseMaxThreadCount();
     void waitForDoneAfterTake();
+    void workStealing();
+    void workStealingPriority();
 
 private:
     QMutex m_functionTestMutex;
@@ -1359,5 +1361,85 @@ void tst_QThreadPool::waitForDoneAfterTake()
 
 }
 
+void tst_QThreadPool::workStealing()
+{
+    class Task : public QRunnable
+    {
+    public:
+        Task(QThreadPool *pool, QAtomicInt *counter, int depth)
+            : m_pool(pool), m_counter(counter), m_depth(depth)
+        {}
+
+        void run() override
+        {
+            m_counter->ref();
+            // fan out from inside the pool, so the work lands on local queues
+            if (m_depth > 0) {
+                for (int i = 0; i < 4; ++i)
+                    m_pool->start(new Task(m_pool, m_counter, m_depth - 1));
+            }
+        }
+
+    private:
+        QThreadPool *m_pool;
+        QAtomicInt *m_counter;
+        int m_depth;
+    };
+
+    QThreadPool pool;
+    QVERIFY(!pool.isWorkStealingEnabled());
+    pool.setMaxThreadCount(4);
+    pool.setWorkStealingEnabled(true);
+    QVERIFY(pool.isWorkStealingEnabled());
+
+    QAtomicInt counter;
+    for (int i = 0; i < 4; ++i)
+        pool.start(new Task(&pool, &counter, 5));
+    QVERIFY(pool.waitForDone(5 * 60 * 1000));
+
+    // 4 roots, each with 4^1 + ... + 4^5 descendants
+    QCOMPARE(counter.loadRelaxed(), 4 * 1365);
+
+    const QVector<quint64> steals = pool.stealCounts();
+    QVERIFY(steals.size() <= pool.maxThreadCount());
+
+    // switching modes with nothing queued must leave the pool usable
+    pool.setWorkStealingEnabled(false);
+    counter.storeRelaxed(0);
+    pool.start(new Task(&pool, &counter, 2));
+    QVERIFY(pool.waitForDone(5 * 60 * 1000));
+    QCOMPARE(counter.loadRelaxed(), 21);
+}
+
+void tst_QThreadPool::workStealingPriority()
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(1);
+    pool.setWorkStealingEnabled(true);
+
+    QSemaphore blocker;
+    QMutex mutex;
+    QVector<int> order;
+
+    pool.start([&blocker] { blocker.acquire(); });
+    for (int i = 0; i < 3; ++i)
+        pool.start([&mutex, &order] { QMutexLocker locker(&mutex); order.append(0); });
+    pool.start([&mutex, &order] { QMutexLocker locker(&mutex); order.append(1); }, 1);
+
+    // taking back a runnable from a local queue works like for the shared queue
+    QRunnable *taken = createTask(emptyFunct);
+    taken->setAutoDelete(false);
+    pool.start(taken);
+    QVERIFY(pool.tryTake(taken));
+    delete taken;
+
+    blocker.release();
+    QVERIFY(pool.waitForDone(5 * 60 * 1000));
+
+    // the prioritized runnable still runs before default-priority ones
+    QCOMPARE(order.size(), 4);
+    QCOMPARE(order.first(), 1);
+}
+
 QTEST_MAIN(tst_QThreadPool);
 #include "tst_qthreadpool.moc"
@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qflathash
+QT = core testlib core-private
+SOURCES = tst_qflathash.cpp
@@ -0,0 +1,366 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/private/qflathash_p.h>
+
+#include <QHash>
+#include <QString>
+
+class tst_QFlatHash : public QObject
+{
+    Q_OBJECT
+private slots:
+    void empty();
+    void insertAndLookup();
+    void operatorBrackets();
+    void remove();
+    void take();
+    void eraseWhileIterating();
+    void compareWithQHash_data();
+    void compareWithQHash();
+    void reserve();
+    void squeeze();
+    void copyAndMove();
+    void stringKeys();
+    void customKey();
+    void nonTrivialValues();
+};
+
+struct Key
+{
+    int id;
+    QString name;
+};
+
+static bool operator==(const Key &lhs, const Key &rhs)
+{
+    return lhs.id == rhs.id && lhs.name == rhs.name;
+}
+
+static uint qHash(const Key &key, uint seed = 0)
+{
+    // deliberately bad, to make sure collisions are handled
+    Q_UNUSED(key);
+    return seed;
+}
+
+// counts the live instances to find leaks and double destructions
+struct Counted
+{
+    static int instances;
+    int value;
+
+    Counted(int v = 0) : value(v) { ++instances; }
+    Counted(const Counted &other) : value(other.value) { ++instances; }
+    ~Counted() { --instances; }
+    Counted &operator=(const Counted &other) = default;
+};
+int Counted::instances = 0;
+
+void tst_QFlatHash::empty()
+{
+    QFlatHash<int, int> hash;
+    QVERIFY(hash.isEmpty());
+    QCOMPARE(hash.size(), 0);
+    QCOMPARE(hash.capacity(), 0);
+    QVERIFY(!hash.contains(0));
+    QCOMPARE(hash.value(1), 0);
+    QCOMPARE(hash.value(1, 42), 42);
+    QCOMPARE(hash.remove(1), 0);
+    QVERIFY(hash.begin() == hash.end());
+    QVERIFY(hash.constFind(1) == hash.constEnd());
+
+    hash.clear();
+    hash.squeeze();
+    QVERIFY(hash.isEmpty());
+}
+
+void tst_QFlatHash::insertAndLookup()
+{
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i * 7, i);
+    QCOMPARE(hash.size(), 1000);
+
+    for (int i = 0; i < 1000; ++i) {
+        QVERIFY(hash.contains(i * 7));
+        QCOMPARE(hash.value(i * 7), i);
+        QVERIFY(!hash.contains(i * 7 + 1));
+    }
+
+    // inserting an existing key replaces the value
+    auto it = hash.insert(7, -1);
+    QCOMPARE(it.key(), 7);
+    QCOMPARE(*it, -1);
+    QCOMPARE(hash.value(7), -1);
+    QCOMPARE(hash.size(), 1000);
+
+    auto found = hash.find(14);
+    QVERIFY(found != hash.end());
+    found.value() = 100;
+    QCOMPARE(hash.value(14), 100);
+}
+
+void tst_QFlatHash::operatorBrackets()
+{
+    QFlatHash<QString, int> hash;
+    hash[QStringLiteral("one")] = 1;
+    ++hash[QStringLiteral("one")];
+    ++hash[QStringLiteral("two")];
+    QCOMPARE(hash.size(), 2);
+    QCOMPARE(hash.value(QStringLiteral("one")), 2);
+    QCOMPARE(hash.value(QStringLiteral("two")), 1);
+
+    const QFlatHash<QString, int> &constHash = hash;
+    QCOMPARE(constHash[QStringLiteral("three")], 0);
+    QCOMPARE(hash.size(), 2);
+}
+
+void tst_QFlatHash::remove()
+{
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, i);
+
+    for (int i = 0; i < 100; i += 2)
+        QCOMPARE(hash.remove(i), 1);
+    QCOMPARE(hash.remove(0), 0);
+    QCOMPARE(hash.size(), 50);
+
+    for (int i = 0; i < 100; ++i)
+        QCOMPARE(hash.contains(i), bool(i & 1));
+
+    // reinsert in the freed slots
+    for (int i = 0; i < 100; i += 2)
+        hash.insert(i, -i);
+    QCOMPARE(hash.size(), 100);
+    for (int i = 0; i < 100; ++i)
+        QCOMPARE(hash.value(i), i & 1 ? i : -i);
+}
+
+void tst_QFlatHash::take()
+{
+    QFlatHash<int, QString> hash;
+    hash.insert(1, QStringLiteral("one"));
+    hash.insert(2, QStringLiteral("two"));
+
+    QCOMPARE(hash.take(1), QStringLiteral("one"));
+    QCOMPARE(hash.take(1), QString());
+    QCOMPARE(hash.size(), 1);
+    QVERIFY(!hash.contains(1));
+    QVERIFY(hash.contains(2));
+}
+
+void tst_QFlatHash::eraseWhileIterating()
+{
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 500; ++i)
+        hash.insert(i, i);
+
+    for (auto it = hash.begin(); it != hash.end(); ) {
+        if (it.key() % 3 == 0)
+            it = hash.erase(it);
+        else
+            ++it;
+    }
+
+    int visited = 0;
+    for (auto it = hash.cbegin(); it != hash.cend(); ++it) {
+        QVERIFY(it.key() % 3 != 0);
+        QCOMPARE(it.value(), it.key());
+        ++visited;
+    }
+    QCOMPARE(visited, hash.size());
+    QCOMPARE(hash.size(), 500 - 167);
+}
+
+void tst_QFlatHash::compareWithQHash_data()
+{
+    QTest::addColumn<int>("range");
+    QTest::addColumn<int>("multiplier");
+
+    QTest::newRow("small") << 16 << 1;
+    QTest::newRow("medium") << 1000 << 1;
+    QTest::newRow("large") << 50000 << 1;
+    // keys differing only in their high bits
+    QTest::newRow("strided") << 1000 << 65536;
+}
+
+void tst_QFlatHash::compareWithQHash()
+{
+    QFETCH(int, range);
+    QFETCH(int, multiplier);
+
+    QFlatHash<int, int> hash;
+    QHash<int, int> reference;
+
+    // a fixed pseudo-random sequence of operations
+    uint seed = 42;
+    for (int op = 0; op < 100000; ++op) {
+        seed = seed * 1103515245 + 12345;
+        const int key = int((seed >> 8) % uint(range)) * multiplier;
+        switch ((seed >> 4) % 4) {
+        case 0:
+        case 1:
+            hash.insert(key, op);
+            reference.insert(key, op);
+            break;
+        case 2:
+            QCOMPARE(hash.remove(key), reference.remove(key));
+            break;
+        case 3:
+            QCOMPARE(hash.contains(key), reference.contains(key));
+            QCOMPARE(hash.value(key, -1), reference.value(key, -1));
+            break;
+        }
+        QCOMPARE(hash.size(), reference.size());
+    }
+
+    for (auto it = hash.cbegin(); it != hash.cend(); ++it)
+        QCOMPARE(it.value(), reference.value(it.key()));
+}
+
+void tst_QFlatHash::reserve()
+{
+    QFlatHash<int, int> hash;
+    hash.reserve(1000);
+    const int capacity = hash.capacity();
+    QVERIFY(capacity >= 1000);
+
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i);
+    QCOMPARE(hash.capacity(), capacity);
+
+    // reserving less than the size does nothing
+    hash.reserve(10);
+    QCOMPARE(hash.capacity(), capacity);
+    QCOMPARE(hash.size(), 1000);
+}
+
+void tst_QFlatHash::squeeze()
+{
+    QFlatHash<int, int> hash;
+    hash.reserve(10000);
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, i);
+
+    hash.squeeze();
+    QVERIFY(hash.capacity() < 10000);
+    QVERIFY(hash.capacity() >= 100);
+    for (int i = 0; i < 100; ++i)
+        QCOMPARE(hash.value(i), i);
+
+    for (int i = 0; i < 100; ++i)
+        hash.remove(i);
+    hash.squeeze();
+    QCOMPARE(hash.capacity(), 0);
+}
+
+void tst_QFlatHash::copyAndMove()
+{
+    QFlatHash<int, QString> hash;
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, QString::number(i));
+
+    QFlatHash<int, QString> copy = hash;
+    copy.insert(1000, QStringLiteral("extra"));
+    QCOMPARE(copy.size(), 101);
+    QCOMPARE(hash.size(), 100);
+    for (int i = 0; i < 100; ++i)
+        QCOMPARE(copy.value(i), QString::number(i));
+
+    QFlatHash<int, QString> moved = std::move(copy);
+    QCOMPARE(moved.size(), 101);
+    QCOMPARE(moved.value(1000), QStringLiteral("extra"));
+
+    hash = moved;
+    QCOMPARE(hash.size(), 101);
+    moved = QFlatHash<int, QString>();
+    QVERIFY(moved.isEmpty());
+    QCOMPARE(hash.value(1000), QStringLiteral("extra"));
+
+    QFlatHash<int, QString> list = { { 1, QStringLiteral("a") }, { 2, QStringLiteral("b") } };
+    QCOMPARE(list.size(), 2);
+    QCOMPARE(list.value(2), QStringLiteral("b"));
+}
+
+void tst_QFlatHash::stringKeys()
+{
+    QFlatHash<QString, int> hash;
+    for (int i = 0; i < 5000; ++i)
+        hash.insert(QLatin1String("key") + QString::number(i), i);
+    for (int i = 0; i < 5000; ++i)
+        QCOMPARE(hash.value(QLatin1String("key") + QString::number(i), -1), i);
+    QVERIFY(!hash.contains(QStringLiteral("key5000")));
+}
+
+void tst_QFlatHash::customKey()
+{
+    // all keys collide, so every lookup has to probe
+    QFlatHash<Key, int> hash;
+    for (int i = 0; i < 200; ++i)
+        hash.insert(Key{ i, QString::number(i) }, i);
+    QCOMPARE(hash.size(), 200);
+
+    for (int i = 0; i < 200; ++i)
+        QCOMPARE(hash.value(Key{ i, QString::number(i) }, -1), i);
+    QVERIFY(!hash.contains(Key{ 1, QStringLiteral("2") }));
+
+    for (int i = 0; i < 200; i += 2)
+        QCOMPARE(hash.remove(Key{ i, QString::number(i) }), 1);
+    for (int i = 0; i < 200; ++i)
+        QCOMPARE(hash.contains(Key{ i, QString::number(i) }), bool(i & 1));
+}
+
+void tst_QFlatHash::nonTrivialValues()
+{
+    {
+        QFlatHash<int, Counted> hash;
+        for (int i = 0; i < 1000; ++i)
+            hash.insert(i, Counted(i));
+        QCOMPARE(Counted::instances, 1000);
+
+        for (int i = 0; i < 1000; i += 2)
+            hash.remove(i);
+        QCOMPARE(Counted::instances, 500);
+
+        QFlatHash<int, Counted> copy = hash;
+        QCOMPARE(Counted::instances, 1000);
+        copy.clear();
+        QCOMPARE(Counted::instances, 500);
+
+        hash.squeeze();
+        QCOMPARE(Counted::instances, 500);
+        QCOMPARE(hash.value(1).value, 1);
+    }
+    QCOMPARE(Counted::instances, 0);
+}
+
+QTEST_APPLESS_MAIN(tst_QFlatHash)
+#include "tst_qflathash.moc"
@@ -31,6 +31,7 @@
 
 #include <qimage.h>
 #include <qimagereader.h>
+#include <qimagewriter.h>
 #include <qlist.h>
 #include <qtransform.h>
 #include <qrandom.h>
@@ -97,6 +98,12 @@ private slots:
 
     void load();
     void loadFromData();
+    void parallelPngWrite_data();
+    void parallelPngWrite();
+#if QT_CONFIG(future)
+    void readAsync_data();
+    void readAsync();
+#endif
 #if !defined(QT_NO_DATASTREAM)
     void loadFromDataStream();
 #endif
@@ -125,6 +132,8 @@ private slots:
 
     void smoothScaleBig();
     void smoothScaleAlpha();
+    void smoothScaleGrayscale_data();
+    void smoothScaleGrayscale();
 
     void transformed_data();
     void transformed();
@@ -1284,6 +1293,122 @@ void tst_QImage::loadFromData()
     QVERIFY(dest.isNull());
 }
 
+void tst_QImage::parallelPngWrite_data()
+{
+    QTest::addColumn<QImage::Format>("format");
+    QTest::addColumn<QByteArray>("filter");
+
+    const QByteArray filters[] = { "none", "sub", "up", "average", "paeth", "adaptive" };
+    for (const QByteArray &filter : filters) {
+        QTest::newRow(("ARGB32_Premultiplied " + filter).constData())
+            << QImage::Format_ARGB32_Premultiplied << filter;
+    }
+    QTest::newRow("RGB32") << QImage::Format_RGB32 << QByteArray();
+    QTest::newRow("RGB888") << QImage::Format_RGB888 << QByteArray("paeth");
+    QTest::newRow("BGR888") << QImage::Format_BGR888 << QByteArray("sub");
+    QTest::newRow("RGBA8888") << QImage::Format_RGBA8888 << QByteArray("adaptive");
+    QTest::newRow("RGB16") << QImage::Format_RGB16 << QByteArray("up");
+    QTest::newRow("RGBA64_Premultiplied") << QImage::Format_RGBA64_Premultiplied << QByteArray("average");
+    QTest::newRow("Grayscale8") << QImage::Format_Grayscale8 << QByteArray("adaptive");
+    QTest::newRow("Grayscale16") << QImage::Format_Grayscale16 << QByteArray("paeth");
+}
+
+void tst_QImage::parallelPngWrite()
+{
+    QFETCH(QImage::Format, format);
+    QFETCH(QByteArray, filter);
+
+    // Large enough to be compressed in several strips
+    QImage original(997, 1031, QImage::Format_ARGB32);
+    for (int y = 0; y < original.height(); ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(original.scanLine(y));
+        for (int x = 0; x < original.width(); ++x)
+            line[x] = qRgba(x, y, x ^ y, (x + y) & 0xff);
+    }
+    original = original.convertToFormat(format);
+
+    QByteArray serialData;
+    {
+        QBuffer buf(&serialData);
+        QVERIFY(buf.open(QIODevice::WriteOnly));
+        QImageWriter writer(&buf, "PNG");
+        writer.setScanlineFilter(filter);
+        QVERIFY(writer.write(original));
+    }
+    QByteArray parallelData;
+    {
+        QBuffer buf(&parallelData);
+        QVERIFY(buf.open(QIODevice::WriteOnly));
+        QImageWriter writer(&buf, "PNG");
+        QVERIFY(writer.supportsOption(QImageIOHandler::ParallelWrite));
+        writer.setParallelWrite(true);
+        writer.setScanlineFilter(filter);
+        QVERIFY(writer.write(original));
+    }
+
+    QImage serial;
+    QVERIFY(serial.loadFromData(serialData, "PNG"));
+    QImage parallel;
+    QVERIFY(parallel.loadFromData(parallelData, "PNG"));
+    QCOMPARE(parallel.format(), serial.format());
+    QCOMPARE(parallel, serial);
+}
+
+#if QT_CONFIG(future)
+void tst_QImage::readAsync_data()
+{
+    QTest::addColumn<QByteArray>("format");
+    QTest::addColumn<QRect>("clipRect");
+    QTest::addColumn<QSize>("scaledSize");
+
+    QTest::newRow("png") << QByteArray("png") << QRect() << QSize();
+    QTest::newRow("png scaled") << QByteArray("png") << QRect() << QSize(100, 75);
+    QTest::newRow("jpeg") << QByteArray("jpeg") << QRect() << QSize();
+    QTest::newRow("jpeg clipped") << QByteArray("jpeg") << QRect(37, 53, 101, 77) << QSize();
+    QTest::newRow("jpeg scaled") << QByteArray("jpeg") << QRect() << QSize(100, 75);
+    QTest::newRow("jpeg clipped and scaled") << QByteArray("jpeg") << QRect(64, 32, 256, 128) << QSize(64, 32);
+}
+
+void tst_QImage::readAsync()
+{
+    QFETCH(QByteArray, format);
+    QFETCH(QRect, clipRect);
+    QFETCH(QSize, scaledSize);
+
+    if (!QImageReader::supportedImageFormats().contains(format))
+        QSKIP("Image format not supported");
+
+    QImage original(400, 300, QImage::Format_RGB32);
+    for (int y = 0; y < original.height(); ++y) {
+        for (int x = 0; x < original.width(); ++x)
+            original.setPixel(x, y, qRgb(x, y, (x * y) >> 4));
+    }
+    QByteArray data;
+    {
+        QBuffer buf(&data);
+        QVERIFY(buf.open(QIODevice::WriteOnly));
+        QVERIFY(original.save(&buf, format.constData()));
+    }
+
+    QBuffer syncBuffer(&data);
+    QImageReader syncReader(&syncBuffer, format);
+    syncReader.setClipRect(clipRect);
+    syncReader.setScaledSize(scaledSize);
+    const QImage expected = syncReader.read();
+    QVERIFY(!expected.isNull());
+
+    QFuture<QImage> future;
+    {
+        QBuffer buffer(&data);
+        QImageReader reader(&buffer, format);
+        reader.setClipRect(clipRect);
+        reader.setScaledSize(scaledSize);
+        future = reader.readAsync();
+    }
+    QCOMPARE(future.result(), expected);
+}
+#endif
+
 #if !defined(QT_NO_DATASTREAM)
 void tst_QImage::loadFromDataStream()
 {
@@ -1950,6 +2075,42 @@ void tst_QImage::smoothScaleAlpha()
     QCOMPARE(dst, expected);
 }
 
+void tst_QImage::smoothScaleGrayscale_data()
+{
+    QTest::addColumn<QSize>("size");
+
+    QTest::newRow("up") << QSize(200, 150);
+    QTest::newRow("up x, down y") << QSize(200, 30);
+    QTest::newRow("down x, up y") << QSize(30, 150);
+    QTest::newRow("down") << QSize(30, 20);
+}
+
+// grayscale images are scaled without widening them to 32 bits first
+void tst_QImage::smoothScaleGrayscale()
+{
+    QFETCH(QSize, size);
+
+    QImage gray(77, 55, QImage::Format_Grayscale8);
+    for (int y = 0; y < gray.height(); ++y) {
+        uchar *line = gray.scanLine(y);
+        for (int x = 0; x < gray.width(); ++x)
+            line[x] = rand8();
+    }
+
+    const QImage scaled = gray.scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    QCOMPARE(scaled.format(), QImage::Format_Grayscale8);
+    QCOMPARE(scaled.size(), size);
+
+    const QImage reference = gray.convertToFormat(QImage::Format_RGB32)
+            .scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    for (int y = 0; y < size.height(); ++y) {
+        const uchar *line = scaled.constScanLine(y);
+        const QRgb *referenceLine = reinterpret_cast<const QRgb *>(reference.constScanLine(y));
+        for (int x = 0; x < size.width(); ++x)
+            QVERIFY(qAbs(line[x] - qGreen(referenceLine[x])) <= 1);
+    }
+}
+
 static int count(const QImage &img, int x, int y, int dx, int dy, QRgb pixel)
 {
     int i = 0;
@@ -308,6 +308,11 @@ private slots:
 
     void drawImageAtPointF();
 
+    void parallelPainting_data();
+    void parallelPainting();
+
+    void strokeCachedPath();
+
 private:
     void fillData();
     void setPenColor(QPainter& p);
@@ -5431,6 +5436,138 @@ void tst_QPainter::drawImageAtPointF()
     paint.end();
 }
 
+void tst_QPainter::parallelPainting_data()
+{
+    QTest::addColumn<QImage::Format>("format");
+    QTest::addColumn<bool>("antialiased");
+
+    QTest::newRow("argb32pm") << QImage::Format_ARGB32_Premultiplied << true;
+    QTest::newRow("argb32pm aliased") << QImage::Format_ARGB32_Premultiplied << false;
+    QTest::newRow("rgb32") << QImage::Format_RGB32 << true;
+    QTest::newRow("rgb16") << QImage::Format_RGB16 << true;
+    QTest::newRow("rgba64pm") << QImage::Format_RGBA64_Premultiplied << true;
+    QTest::newRow("mono") << QImage::Format_Mono << true;
+}
+
+static void paintParallelPaintingScene(QImage *image, bool antialiased)
+{
+    QPainter p(image);
+    p.setRenderHint(QPainter::Antialiasing, antialiased);
+
+    QLinearGradient background(0, 0, 0, image->height());
+    background.setColorAt(0, QColor(40, 60, 200));
+    background.setColorAt(1, QColor(220, 180, 40, 200));
+    p.fillRect(image->rect(), background);
+
+    p.setPen(QPen(QColor(255, 0, 0, 160), 7));
+    p.setBrush(QColor(0, 200, 80, 127));
+    p.drawEllipse(QRectF(30.5, 20.25, 700, 900));
+
+    QRadialGradient radial(400, 400, 300);
+    radial.setColorAt(0, Qt::white);
+    radial.setColorAt(1, QColor(0, 0, 0, 0));
+    p.setBrush(radial);
+    p.setPen(Qt::NoPen);
+    p.rotate(12);
+    p.drawRoundedRect(QRectF(100, 50, 600, 700), 40, 40);
+    p.resetTransform();
+
+    QPainterPath clip;
+    clip.addEllipse(QRectF(200, 100, 500, 800));
+    p.setClipPath(clip);
+    QPainterPath polyline;
+    for (int i = 0; i < 200; ++i)
+        polyline.lineTo(i * 4, 500 + 400 * sin(i / 10.0));
+    p.setPen(QPen(Qt::black, 3.5));
+    p.setBrush(Qt::NoBrush);
+    p.drawPath(polyline);
+
+    p.setCompositionMode(QPainter::CompositionMode_Xor);
+    p.fillRect(QRect(0, 0, 800, 1000), QColor(10, 20, 30, 100));
+}
+
+void tst_QPainter::parallelPainting()
+{
+    QFETCH(QImage::Format, format);
+    QFETCH(bool, antialiased);
+
+    QImage image(800, 1000, format);
+    image.fill(Qt::gray);
+    QVERIFY(!image.isParallelPaintingEnabled());
+
+    QImage parallelImage = image;
+    parallelImage.setParallelPaintingEnabled(true);
+    QVERIFY(parallelImage.isParallelPaintingEnabled());
+    QVERIFY(!image.isParallelPaintingEnabled());
+
+    paintParallelPaintingScene(&image, antialiased);
+    paintParallelPaintingScene(&parallelImage, antialiased);
+
+    QVERIFY(parallelImage.isParallelPaintingEnabled());
+    QCOMPARE(parallelImage, image);
+}
+
+static QPainterPath strokeCachedPathShape()
+{
+    QPainterPath path;
+    path.moveTo(10, 10);
+    for (int i = 1; i < 40; ++i)
+        path.lineTo(10 + i * 4, 60 + 40 * sin(i / 4.0));
+    path.cubicTo(170, 20, 120, 150, 40, 140);
+    return path;
+}
+
+void tst_QPainter::strokeCachedPath()
+{
+    const QPainterPath path = strokeCachedPathShape();
+    const QVector<QPen> pens = {
+        QPen(Qt::red, 5, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin),
+        QPen(Qt::blue, 3, Qt::SolidLine, Qt::FlatCap, Qt::MiterJoin),
+    };
+    const QVector<QPointF> offsets = { QPointF(0, 0), QPointF(7.5, 3.25), QPointF(-12, 20) };
+
+    QImage cached(200, 200, QImage::Format_ARGB32_Premultiplied);
+    QImage reference(200, 200, QImage::Format_ARGB32_Premultiplied);
+    for (const QPen &pen : pens) {
+        for (const QPointF &offset : offsets) {
+            cached.fill(Qt::white);
+            reference.fill(Qt::white);
+
+            QPainter p(&cached);
+            p.setRenderHint(QPainter::Antialiasing);
+            p.translate(offset);
+            p.strokePath(path, pen);
+            p.end();
+
+            // A new path every time can never hit the cache
+            p.begin(&reference);
+            p.setRenderHint(QPainter::Antialiasing);
+            p.translate(offset);
+            p.strokePath(strokeCachedPathShape(), pen);
+            p.end();
+
+            QCOMPARE(cached, reference);
+        }
+    }
+
+    // Modifying the path must not reuse the outline of the old one
+    QPainterPath modified = path;
+    modified.lineTo(190, 190);
+    cached.fill(Qt::white);
+    reference.fill(Qt::white);
+    QPainter p(&cached);
+    p.strokePath(modified, pens.first());
+    p.strokePath(modified, pens.first());
+    p.end();
+    QPainterPath expected = strokeCachedPathShape();
+    expected.lineTo(190, 190);
+    p.begin(&reference);
+    p.strokePath(expected, pens.first());
+    p.strokePath(expected, pens.first());
+    p.end();
+    QCOMPARE(cached, reference);
+}
+
 QTEST_MAIN(tst_QPainter)
 
 #include "tst_qpainter.moc"
@@ -49,6 +49,7 @@ private slots:
     void rects();
     void swap();
     void setRects();
+    void inPlaceOperations();
     void ellipseRegion();
     void polygonRegion();
     void bitmapRegion();
@@ -241,6 +242,41 @@ void tst_QRegion::setRects()
     }
 }
 
+void tst_QRegion::inPlaceOperations()
+{
+    // Combining multi-rectangle regions in place must not read back
+    // rectangles that were already overwritten by the result.
+    QVector<QRect> evenRects, oddRects, allRects;
+    for (int i = 0; i < 8; ++i) {
+        evenRects << QRect(i * 40, 0, 10, 10);
+        oddRects << QRect(i * 40 + 20, 0, 10, 10);
+        allRects << evenRects.last() << oddRects.last();
+    }
+    QRegion even;
+    even.setRects(evenRects.constData(), evenRects.size());
+    QRegion odd;
+    odd.setRects(oddRects.constData(), oddRects.size());
+
+    QRegion region = even;
+    region += odd;
+    QCOMPARE(region.rectCount(), allRects.size());
+    QVERIFY(std::equal(region.begin(), region.end(), allRects.cbegin()));
+
+    region -= odd;
+    QCOMPARE(region, even);
+    QVERIFY(std::equal(region.begin(), region.end(), evenRects.cbegin()));
+
+    region &= even;
+    QCOMPARE(region, even);
+
+    region ^= odd;
+    QCOMPARE(region, even + odd);
+
+    region &= QRect(0, 0, 30, 10);
+    QCOMPARE(region.rectCount(), 2);
+    QCOMPARE(region.boundingRect(), QRect(0, 0, 30, 10));
+}
+
 void tst_QRegion::ellipseRegion()
 {
     QRegion region(0, 0, 100, 100, QRegion::Ellipse);
@@ -101,6 +101,8 @@ private slots:
     void srbLayoutCompatibility();
     void renderPassDescriptorCompatibility_data();
     void renderPassDescriptorCompatibility();
+    void pipelineCache_data();
+    void pipelineCache();
 
 private:
     struct {
@@ -2289,4 +2291,59 @@ void tst_QRhi::renderPassDescriptorCompatibility()
 }
 
 #include <tst_qrhi.moc>
+void tst_QRhi::pipelineCache_data()
+{
+    rhiTestData();
+}
+
+void tst_QRhi::pipelineCache()
+{
+    QFETCH(QRhi::Implementation, impl);
+    QFETCH(QRhiInitParams *, initParams);
+
+    QByteArray data;
+    for (int run = 0; run < 2; ++run) {
+        QScopedPointer<QRhi> rhi(QRhi::create(impl, initParams, QRhi::Flags(), nullptr));
+        if (!rhi)
+            QSKIP("QRhi could not be created, skipping testing pipeline cache");
+        if (!rhi->isFeatureSupported(QRhi::PipelineCache))
+            QSKIP("Pipeline cache not supported with this backend, skipping test");
+
+        // garbage, and data from the backend itself in the second run
+        rhi->setPipelineCacheData(QByteArrayLiteral("not a pipeline cache"));
+        rhi->setPipelineCacheData(data);
+
+        QScopedPointer<QRhiTexture> texture(rhi->newTexture(QRhiTexture::RGBA8, QSize(64, 64), 1, QRhiTexture::RenderTarget));
+        QVERIFY(texture->build());
+        QScopedPointer<QRhiTextureRenderTarget> rt(rhi->newTextureRenderTarget({ texture.data() }));
+        QScopedPointer<QRhiRenderPassDescriptor> rpDesc(rt->newCompatibleRenderPassDescriptor());
+        rt->setRenderPassDescriptor(rpDesc.data());
+        QVERIFY(rt->build());
+
+        QScopedPointer<QRhiShaderResourceBindings> srb(rhi->newShaderResourceBindings());
+        QVERIFY(srb->build());
+
+        QRhiVertexInputLayout inputLayout;
+        inputLayout.setBindings({ { 2 * sizeof(float) } });
+        inputLayout.setAttributes({ { 0, 0, QRhiVertexInputAttribute::Float2, 0 } });
+
+        QShader vs = loadShader(":/data/simple.vert.qsb");
+        QVERIFY(vs.isValid());
+        QShader fs = loadShader(":/data/simple.frag.qsb");
+        QVERIFY(fs.isValid());
+
+        QScopedPointer<QRhiGraphicsPipeline> pipeline(rhi->newGraphicsPipeline());
+        pipeline->setShaderStages({ { QRhiShaderStage::Vertex, vs }, { QRhiShaderStage::Fragment, fs } });
+        pipeline->setVertexInputLayout(inputLayout);
+        pipeline->setShaderResourceBindings(srb.data());
+        pipeline->setRenderPassDescriptor(rpDesc.data());
+        QVERIFY(pipeline->build());
+
+        const QByteArray newData = rhi->pipelineCacheData();
+        if (run == 1 && !data.isEmpty())
+            QVERIFY(!newData.isEmpty());
+        data = newData;
+    }
+}
+
 QTEST_MAIN(tst_QRhi)
@@ -58,6 +58,7 @@ private slots:
     void floatingTablePageBreak();
     void imageAtRightAlignedTab();
     void blockVisibility();
+    void editKeepsLayoutOfFollowingBlocks();
 
     void largeImage();
 
@@ -407,5 +408,48 @@ void tst_QTextDocumentLayout::largeImage()
      }
 }
 
+void tst_QTextDocumentLayout::editKeepsLayoutOfFollowingBlocks()
+{
+    QStringList lines;
+    for (int i = 0; i < 2000; ++i)
+        lines << QString::fromLatin1("line %1 of a document that is long enough to wrap").arg(i);
+
+    doc->setTextWidth(150);
+    doc->setPlainText(lines.join(QLatin1Char('\n')));
+    const QSizeF size = doc->size();
+
+    const auto compareWithReference = [this]() {
+        QTextDocument reference;
+        reference.setTextWidth(150);
+        reference.setPlainText(doc->toPlainText());
+        QCOMPARE(doc->size(), reference.size());
+        for (int i : {20, 1000, 1999, 2000}) {
+            const QTextBlock block = doc->findBlockByNumber(i);
+            const QTextBlock referenceBlock = reference.findBlockByNumber(i);
+            if (!referenceBlock.isValid())
+                continue;
+            const QRectF rect = doc->documentLayout()->blockBoundingRect(block);
+            QCOMPARE(rect, reference.documentLayout()->blockBoundingRect(referenceBlock));
+            const int hit = doc->documentLayout()->hitTest(rect.center(), Qt::FuzzyHit);
+            QVERIFY(hit >= block.position());
+            QVERIFY(hit < block.position() + block.length());
+        }
+    };
+
+    // an edit that does not change the height of its block leaves the rest as it was;
+    // digits share one advance, so replacing one keeps the line breaks
+    QTextCursor cursor(doc->findBlockByNumber(10));
+    cursor.setPosition(cursor.position() + 5);
+    cursor.movePosition(QTextCursor::NextCharacter, QTextCursor::KeepAnchor);
+    cursor.insertText(QLatin1String("2"));
+    QCOMPARE(doc->size(), size);
+    compareWithReference();
+
+    // an edit that changes the height moves everything after it
+    cursor.insertBlock();
+    QVERIFY(doc->size().height() > size.height());
+    compareWithReference();
+}
+
 QTEST_MAIN(tst_QTextDocumentLayout)
 #include "tst_qtextdocumentlayout.moc"
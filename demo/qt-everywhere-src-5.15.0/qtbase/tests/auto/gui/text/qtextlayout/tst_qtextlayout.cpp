@@ -142,6 +142,7 @@ private slots:
     void koreanWordWrap();
     void tooManyDirectionalCharctersCrash_qtbug77819();
     void softHyphens();
+    void shapedTextCache();
 
 private:
     QFont testFont;
@@ -2488,5 +2489,34 @@ void tst_QTextLayout::softHyphens()
     }
 }
 
+void tst_QTextLayout::shapedTextCache()
+{
+    const QString text = QStringLiteral("shaped text");
+
+    const auto glyphRuns = [&text](const QFont &font) {
+        QTextLayout layout(text, font);
+        layout.setCacheEnabled(true);
+        layout.beginLayout();
+        layout.createLine();
+        layout.endLayout();
+        return layout.glyphRuns();
+    };
+
+    const QList<QGlyphRun> first = glyphRuns(testFont);
+    QCOMPARE(first.size(), 1);
+
+    // the second layout reuses the shaped item, and has to end up the same
+    const QList<QGlyphRun> second = glyphRuns(testFont);
+    QCOMPARE(second, first);
+
+    // the same text with a different spacing must not come from the cache
+    QFont spacedFont = testFont;
+    spacedFont.setLetterSpacing(QFont::AbsoluteSpacing, 5);
+    const QList<QGlyphRun> spaced = glyphRuns(spacedFont);
+    QCOMPARE(spaced.size(), 1);
+    QCOMPARE(spaced.first().glyphIndexes(), first.first().glyphIndexes());
+    QVERIFY(spaced.first().positions().last().x() > first.first().positions().last().x());
+}
+
 QTEST_MAIN(tst_QTextLayout)
 #include "tst_qtextlayout.moc"
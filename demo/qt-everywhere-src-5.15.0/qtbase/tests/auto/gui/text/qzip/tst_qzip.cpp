@@ -40,6 +40,7 @@ private slots:
     void symlinks();
     void readTest();
     void createArchive();
+    void compressionPolicy();
 };
 
 void tst_QZip::basicUnpack()
@@ -135,5 +136,36 @@ void tst_QZip::createArchive()
     QCOMPARE(zip2.fileData("My Filename"), fileContents);
 }
 
+void tst_QZip::compressionPolicy()
+{
+    QByteArray compressible(64 * 1024, 'a');
+    QByteArray incompressible(64 * 1024, Qt::Uninitialized);
+    quint32 seed = 1;
+    for (int i = 0; i < incompressible.size(); ++i) {
+        seed = seed * 1103515245u + 12345u;
+        incompressible[i] = char(seed >> 24);
+    }
+
+    QBuffer buffer;
+    QZipWriter zip(&buffer);
+    zip.addFile("compressible", compressible);
+    zip.addFile("incompressible", incompressible);
+    zip.setCompressionPolicy(QZipWriter::AlwaysCompress);
+    zip.addFile("forced", incompressible);
+    zip.close();
+    QByteArray zipFile = buffer.buffer();
+
+    // the incompressible entry is stored, so the archive can't be much
+    // bigger than the two copies of the random data
+    QVERIFY(zipFile.size() < 2 * incompressible.size() + 2048);
+
+    QBuffer buffer2(&zipFile);
+    QZipReader zip2(&buffer2);
+    QCOMPARE(zip2.count(), 3);
+    QCOMPARE(zip2.fileData("compressible"), compressible);
+    QCOMPARE(zip2.fileData("incompressible"), incompressible);
+    QCOMPARE(zip2.fileData("forced"), incompressible);
+}
+
 QTEST_MAIN(tst_QZip)
 #include "tst_qzip.moc"
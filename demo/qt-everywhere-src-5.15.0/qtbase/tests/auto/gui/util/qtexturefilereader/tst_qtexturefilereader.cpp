@@ -36,6 +36,8 @@ class tst_qtexturefilereader : public QObject
 private slots:
     void checkHandlers_data();
     void checkHandlers();
+    void ktx2_data();
+    void ktx2();
 };
 
 void tst_qtexturefilereader::checkHandlers_data()
@@ -128,6 +130,85 @@ void tst_qtexturefilereader::checkHandlers()
     }
 }
 
+// Builds a minimal KTX2 file: header, level index and the level data, with
+// empty data format descriptor and key/value data.
+static QByteArray createKtx2(quint32 vkFormat, const QSize &size,
+                             const QList<QByteArray> &levels, quint32 supercompressionScheme)
+{
+    QList<QByteArray> storedLevels;
+    for (const QByteArray &level : levels)
+        storedLevels.append(supercompressionScheme == 3 ? qCompress(level).mid(4) : level);
+
+    QByteArray file;
+    QDataStream stream(&file, QIODevice::WriteOnly);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    const char identifier[] = { '\xAB', 'K', 'T', 'X', ' ', '2', '0', '\xBB', '\r', '\n', '\x1A', '\n' };
+    stream.writeRawData(identifier, sizeof(identifier));
+    stream << vkFormat << quint32(1) << quint32(size.width()) << quint32(size.height())
+           << quint32(0) << quint32(0) << quint32(1) << quint32(levels.size())
+           << supercompressionScheme
+           << quint32(0) << quint32(0) << quint32(0) << quint32(0)
+           << quint64(0) << quint64(0);
+
+    // level data follows the index, smallest level first like the spec suggests
+    quint64 offset = quint64(file.size()) + quint64(levels.size()) * 3 * sizeof(quint64);
+    QVector<quint64> offsets(levels.size());
+    for (int i = levels.size() - 1; i >= 0; --i) {
+        offsets[i] = offset;
+        offset += quint64(storedLevels.at(i).size());
+    }
+    for (int i = 0; i < levels.size(); ++i)
+        stream << offsets.at(i) << quint64(storedLevels.at(i).size()) << quint64(levels.at(i).size());
+    for (int i = levels.size() - 1; i >= 0; --i)
+        stream.writeRawData(storedLevels.at(i).constData(), storedLevels.at(i).size());
+
+    return file;
+}
+
+void tst_qtexturefilereader::ktx2_data()
+{
+    QTest::addColumn<quint32>("vkFormat");
+    QTest::addColumn<quint32>("glInternalFormat");
+    QTest::addColumn<quint32>("supercompressionScheme");
+
+    QTest::addRow("bc7") << quint32(145) << quint32(0x8e8c) << quint32(0);
+    QTest::addRow("etc2 srgb") << quint32(148) << quint32(0x9275) << quint32(0);
+    QTest::addRow("astc 6x6 srgb") << quint32(166) << quint32(0x93d4) << quint32(0);
+    QTest::addRow("bc7 zlib") << quint32(145) << quint32(0x8e8c) << quint32(3);
+}
+
+void tst_qtexturefilereader::ktx2()
+{
+    QFETCH(quint32, vkFormat);
+    QFETCH(quint32, glInternalFormat);
+    QFETCH(quint32, supercompressionScheme);
+
+    QList<QByteArray> levels;
+    levels << QByteArray(64, 'a') << QByteArray(16, 'b');
+
+    QByteArray file = createKtx2(vkFormat, QSize(8, 8), levels, supercompressionScheme);
+    QBuffer buffer(&file);
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QTextureFileReader r(&buffer, QStringLiteral("test.ktx2"));
+    QVERIFY(r.canRead());
+
+    QTextureFileData tex = r.read();
+    QVERIFY(tex.isValid());
+    QCOMPARE(tex.size(), QSize(8, 8));
+    QCOMPARE(tex.glInternalFormat(), glInternalFormat);
+    QCOMPARE(tex.numLevels(), levels.size());
+    for (int i = 0; i < tex.numLevels(); i++)
+        QCOMPARE(tex.data().mid(tex.dataOffset(i), tex.dataLength(i)), levels.at(i));
+
+    // BasisLZ needs a transcoder, which is not available
+    file = createKtx2(vkFormat, QSize(8, 8), levels, 1);
+    QBuffer basisBuffer(&file);
+    QVERIFY(basisBuffer.open(QIODevice::ReadOnly));
+    QTextureFileReader basisReader(&basisBuffer, QStringLiteral("test.ktx2"));
+    QVERIFY(basisReader.canRead());
+    QVERIFY(basisReader.read().isNull());
+}
+
 QTEST_MAIN(tst_qtexturefilereader)
 
 #include "tst_qtexturefilereader.moc"
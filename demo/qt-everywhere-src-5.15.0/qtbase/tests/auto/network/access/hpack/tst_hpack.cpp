@@ -70,6 +70,9 @@ private Q_SLOTS:
     void hpackDecodeResponse_data();
     void hpackDecodeResponse();
 
+    void hpackIndexingPolicy();
+    void hpackTableSizeUpdate();
+
     // TODO: more-more-more tests needed!
 
 private:
@@ -824,6 +827,87 @@ void tst_Hpack::hpackDecodeResponse()
     }
 }
 
+void tst_Hpack::hpackIndexingPolicy()
+{
+    Encoder encoder(4096, false);
+    Decoder decoder(4096);
+
+    const QByteArray token("Bearer " + QByteArray(1024, 'x'));
+    const HttpHeader header = {{":method", "GET"},
+                               {":scheme", "https"},
+                               {":path", "/api/v1/items?id=42"},
+                               {":authority", "www.example.com"},
+                               {"authorization", token},
+                               {"cookie", "id=1"}};
+
+    std::vector<uchar> buffer;
+    BitOStream outputStream(buffer);
+    QVERIFY(encoder.encodeRequest(outputStream, header));
+    // :path is not indexed, '0000' + name index 4:
+    QCOMPARE(buffer[2], uchar(0x04));
+    // A short cookie is never indexed, '0001' + name index 32 (does not fit into 4 bits):
+    QCOMPARE(buffer[buffer.size() - 7], uchar(0x1f));
+    QCOMPARE(buffer[buffer.size() - 6], uchar(32 - 15));
+
+    BitIStream inputStream(outputStream.begin(), outputStream.end());
+    QVERIFY(decoder.decodeHeaderFields(inputStream));
+    QVERIFY(decoder.decodedHeader() == header);
+    QCOMPARE(decoder.dynamicTableSize(), encoder.dynamicTableSize());
+
+    // The second time the long token is sent as a table reference:
+    const quint64 firstSize = outputStream.byteLength();
+    outputStream.clear();
+    QVERIFY(encoder.encodeRequest(outputStream, header));
+    QVERIFY(outputStream.byteLength() < firstSize - quint64(token.size()));
+
+    BitIStream inputStream2(outputStream.begin(), outputStream.end());
+    QVERIFY(decoder.decodeHeaderFields(inputStream2));
+    QVERIFY(decoder.decodedHeader() == header);
+}
+
+void tst_Hpack::hpackTableSizeUpdate()
+{
+    Encoder encoder(4096, true);
+    Decoder decoder(8192);
+
+    const HttpHeader header = {{":method", "GET"},
+                               {":scheme", "https"},
+                               {":path", "/"},
+                               {":authority", "www.example.com"},
+                               {"x-trace-id", "0123456789abcdef"}};
+
+    std::vector<uchar> buffer;
+    BitOStream outputStream(buffer);
+    QVERIFY(encoder.encodeRequest(outputStream, header));
+    BitIStream inputStream(outputStream.begin(), outputStream.end());
+    QVERIFY(decoder.decodeHeaderFields(inputStream));
+    QVERIFY(encoder.dynamicTableSize() > 0);
+    QCOMPARE(decoder.dynamicTableSize(), encoder.dynamicTableSize());
+
+    // The peer first shrinks its table, then increases its size: both
+    // changes must be signalled, the smallest size first.
+    encoder.setMaxDynamicTableSize(0);
+    encoder.setMaxDynamicTableSize(8192);
+    QCOMPARE(encoder.dynamicTableSize(), quint32(0));
+
+    outputStream.clear();
+    QVERIFY(encoder.encodeRequest(outputStream, header));
+    QVERIFY(outputStream.byteLength() > 4);
+    QCOMPARE(buffer[0], uchar(0x20)); // '001' + 0
+    QCOMPARE(buffer[1], uchar(0x3f)); // '001' + 8192 (does not fit into 5 bits)
+
+    BitIStream inputStream2(outputStream.begin(), outputStream.end());
+    QVERIFY(decoder.decodeHeaderFields(inputStream2));
+    QVERIFY(decoder.decodedHeader() == header);
+    QCOMPARE(decoder.dynamicTableSize(), encoder.dynamicTableSize());
+
+    // No change, nothing to signal:
+    encoder.setMaxDynamicTableSize(8192);
+    outputStream.clear();
+    QVERIFY(encoder.encodeRequest(outputStream, header));
+    QVERIFY((buffer[0] & 0xe0) != 0x20);
+}
+
 QTEST_MAIN(tst_Hpack)
 
 #include "tst_hpack.moc"
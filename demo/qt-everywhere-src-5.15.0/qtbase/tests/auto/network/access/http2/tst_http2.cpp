@@ -110,6 +110,8 @@ private slots:
     void connectToHost_data();
     void connectToHost();
     void maxFrameSize();
+    void connectionSharing();
+    void requestTimings();
 
 protected slots:
     // Slots to listen to our in-process server:
@@ -153,6 +155,7 @@ private:
 
     int windowUpdates = 0;
     bool prefaceOK = false;
+    int clientPrefaces = 0;
     bool serverGotSettingsACK = false;
 
     static const RawSettings defaultServerSettings;
@@ -767,6 +770,105 @@ void tst_Http2::maxFrameSize()
     QVERIFY(serverGotSettingsACK);
 }
 
+void tst_Http2::connectionSharing()
+{
+    // Requests from two managers, sharing the connection and limiting the
+    // number of concurrent streams on it, so that some of them have to wait.
+    clearHTTP2State();
+
+    serverPort = 0;
+    nRequests = 10;
+
+    ServerPtr srv(newServer(defaultServerSettings, defaultConnectionType()));
+
+    QMetaObject::invokeMethod(srv.data(), "startServer", Qt::QueuedConnection);
+    runEventLoop();
+    QVERIFY(serverPort != 0);
+
+    QHttp2Configuration h2Config(qt_defaultH2Configuration());
+    h2Config.setConnectionSharingEnabled(true);
+    h2Config.setMaxConcurrentStreams(2);
+    QCOMPARE(h2Config.maxConcurrentStreams(), 2u);
+
+    std::unique_ptr<QNetworkAccessManager> secondManager(new QNetworkAccessManager);
+    for (int i = 0; i < nRequests; ++i) {
+        if (i % 2)
+            std::swap(manager, secondManager);
+        sendRequest(i, QNetworkRequest::NormalPriority, QByteArray(), h2Config);
+        if (i % 2)
+            std::swap(manager, secondManager);
+    }
+
+    runEventLoop();
+    STOP_ON_FAILURE
+
+    QCOMPARE(nRequests, 0);
+    QVERIFY(prefaceOK);
+    QVERIFY(serverGotSettingsACK);
+    QCOMPARE(clientPrefaces, 1);
+}
+
+void tst_Http2::requestTimings()
+{
+    clearHTTP2State();
+
+    serverPort = 0;
+    nRequests = 3;
+
+    ServerPtr srv(newServer(defaultServerSettings, defaultConnectionType()));
+
+    QMetaObject::invokeMethod(srv.data(), "startServer", Qt::QueuedConnection);
+    runEventLoop();
+    QVERIFY(serverPort != 0);
+
+    QList<QNetworkReply *> replies;
+    connect(manager.get(), &QNetworkAccessManager::finished, this, [&replies](QNetworkReply *reply) {
+        replies.append(reply);
+    });
+    for (int i = 0; i < nRequests; ++i)
+        sendRequest(i);
+
+    runEventLoop();
+    STOP_ON_FAILURE
+
+    QCOMPARE(nRequests, 0);
+    QCOMPARE(replies.size(), 3);
+
+    QSet<int> requestNumbers;
+    int reusedCount = 0;
+    for (QNetworkReply *reply : qAsConst(replies)) {
+        const auto time = [reply](QNetworkRequest::Attribute code) {
+            const QVariant value = reply->attribute(code);
+            return value.isValid() ? value.toLongLong() : qint64(-1);
+        };
+        const qint64 queued = time(QNetworkRequest::RequestQueuedTimeAttribute);
+        const qint64 connectStart = time(QNetworkRequest::ConnectStartTimeAttribute);
+        const qint64 connectEnd = time(QNetworkRequest::ConnectEndTimeAttribute);
+        const qint64 requestStart = time(QNetworkRequest::RequestStartTimeAttribute);
+        const qint64 responseStart = time(QNetworkRequest::ResponseStartTimeAttribute);
+        const qint64 responseEnd = time(QNetworkRequest::ResponseEndTimeAttribute);
+
+        // The server is addressed by its IP address, no lookup is needed:
+        QCOMPARE(time(QNetworkRequest::HostLookupStartTimeAttribute), qint64(-1));
+        QVERIFY(queued > 0);
+        QVERIFY(connectStart > 0);
+        QVERIFY(connectEnd >= connectStart);
+        QVERIFY(requestStart >= connectEnd);
+        QVERIFY(requestStart >= queued);
+        QVERIFY(responseStart >= requestStart);
+        QVERIFY(responseEnd >= responseStart);
+        if (reply->url().scheme() == QLatin1String("https"))
+            QVERIFY(time(QNetworkRequest::SecureConnectEndTimeAttribute) >= connectEnd);
+
+        requestNumbers.insert(reply->attribute(QNetworkRequest::ConnectionRequestCountAttribute).toInt());
+        if (reply->attribute(QNetworkRequest::ConnectionReusedAttribute).toBool())
+            ++reusedCount;
+    }
+    // All three were sent as streams on the same connection:
+    QCOMPARE(requestNumbers, (QSet<int>{1, 2, 3}));
+    QCOMPARE(reusedCount, 2);
+}
+
 void tst_Http2::serverStarted(quint16 port)
 {
     serverPort = port;
@@ -777,6 +879,7 @@ void tst_Http2::clearHTTP2State()
 {
     windowUpdates = 0;
     prefaceOK = false;
+    clientPrefaces = 0;
     serverGotSettingsACK = false;
 }
 
@@ -864,6 +967,7 @@ QUrl tst_Http2::requestUrl(H2Type connectionType) const
 void tst_Http2::clientPrefaceOK()
 {
     prefaceOK = true;
+    ++clientPrefaces;
 }
 
 void tst_Http2::clientPrefaceError()
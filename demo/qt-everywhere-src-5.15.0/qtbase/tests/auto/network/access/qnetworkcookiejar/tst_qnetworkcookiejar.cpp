@@ -49,6 +49,7 @@ private slots:
     void setCookiesFromUrl();
     void cookiesForUrl_data();
     void cookiesForUrl();
+    void insertionOrder();
 #if defined(QT_BUILD_INTERNAL) && QT_CONFIG(topleveldomain)
     void effectiveTLDs_data();
     void effectiveTLDs();
@@ -404,6 +405,40 @@ void tst_QNetworkCookieJar::cookiesForUrl()
     QCOMPARE(result, expectedResult);
 }
 
+void tst_QNetworkCookieJar::insertionOrder()
+{
+    MyCookieJar jar;
+
+    QNetworkCookie a("a", "1");
+    a.setDomain(".example.com");
+    a.setPath("/");
+    QNetworkCookie b("b", "2");
+    b.setDomain("www.example.com");
+    b.setPath("/");
+    QNetworkCookie c("c", "3");
+    c.setDomain(".example.com");
+    c.setPath("/foo");
+
+    QVERIFY(jar.insertCookie(a));
+    QVERIFY(jar.insertCookie(b));
+    QVERIFY(jar.insertCookie(c));
+    QCOMPARE(jar.allCookies(), QList<QNetworkCookie>() << a << b << c);
+    QCOMPARE(jar.cookiesForUrl(QUrl("http://www.example.com/foo")),
+             QList<QNetworkCookie>() << c << a << b);
+
+    // an updated cookie moves to the end
+    a.setValue("4");
+    QVERIFY(jar.updateCookie(a));
+    QCOMPARE(jar.allCookies(), QList<QNetworkCookie>() << b << c << a);
+    QCOMPARE(jar.cookiesForUrl(QUrl("http://www.example.com/foo")),
+             QList<QNetworkCookie>() << c << b << a);
+    QCOMPARE(jar.cookiesForUrl(QUrl("http://example.com/")), QList<QNetworkCookie>() << a);
+
+    QVERIFY(jar.deleteCookie(c));
+    QVERIFY(!jar.deleteCookie(c));
+    QCOMPARE(jar.allCookies(), QList<QNetworkCookie>() << b << a);
+}
+
 // This test requires private API.
 #if defined(QT_BUILD_INTERNAL) && QT_CONFIG(topleveldomain)
 void tst_QNetworkCookieJar::effectiveTLDs_data()
@@ -69,6 +69,8 @@ private slots:
     void updateMetaData();
     void fileMetaData();
     void expire();
+    void expireLeastRecentlyUsed();
+    void indexPersistence();
 
     void oldCacheVersionFile_data();
     void oldCacheVersionFile();
@@ -513,6 +515,8 @@ void tst_QNetworkDiskCache::expire()
     }
 
     QString cacheDirectory = cache.cacheDirectory();
+    // evicted files are removed from a worker thread
+    QTRY_COMPARE(countFiles(cacheDirectory).count(), NUM_SUBDIRECTORIES + 6);
     QStringList list = countFiles(cacheDirectory);
     QStringList cacheList;
     foreach(QString fileName, list) {
@@ -529,6 +533,69 @@ void tst_QNetworkDiskCache::expire()
     }
 }
 
+void tst_QNetworkDiskCache::expireLeastRecentlyUsed()
+{
+    SubQNetworkDiskCache cache;
+    cache.setCacheDirectory(tempDir.path());
+
+    const QByteArray data(100 * 1024, 'Z');
+    QUrl urls[3];
+    for (int i = 0; i < 3; ++i) {
+        urls[i] = QUrl("http://localhost:4/" + QString::number(i));
+        QNetworkCacheMetaData m;
+        m.setUrl(urls[i]);
+        QIODevice *d = cache.prepare(m);
+        QVERIFY(d);
+        d->write(data);
+        cache.insert(d);
+    }
+    QVERIFY(cache.metaData(urls[0]).isValid());
+    QVERIFY(cache.metaData(urls[1]).isValid());
+
+    // using the oldest entry makes the second one the least recently used
+    delete cache.data(urls[0]);
+
+    qint64 size = 0;
+    const QStringList files = countFiles(cache.cacheDirectory());
+    for (const QString &fileName : files)
+        size += QFileInfo(fileName).isFile() ? QFileInfo(fileName).size() : 0;
+    cache.setMaximumCacheSize(size - 1);
+    QVERIFY(cache.metaData(urls[0]).isValid());
+    QVERIFY(!cache.metaData(urls[1]).isValid());
+    QVERIFY(!cache.data(urls[1]));
+    QVERIFY(cache.metaData(urls[2]).isValid());
+    QTRY_COMPARE(countFiles(cache.cacheDirectory()).count(), NUM_SUBDIRECTORIES + 4);
+}
+
+void tst_QNetworkDiskCache::indexPersistence()
+{
+    QUrl url(EXAMPLE_URL);
+    QString cacheDirectory;
+    {
+        QNetworkDiskCache cache;
+        cache.setCacheDirectory(tempDir.path());
+        QNetworkCacheMetaData m;
+        m.setUrl(url);
+        QIODevice *d = cache.prepare(m);
+        QVERIFY(d);
+        d->write("Hello World!");
+        cache.insert(d);
+        cacheDirectory = cache.cacheDirectory();
+        QCOMPARE(countFiles(cacheDirectory).count(), NUM_SUBDIRECTORIES + 3);
+    }
+    // the index is written when the cache is destroyed
+    QCOMPARE(countFiles(cacheDirectory).count(), NUM_SUBDIRECTORIES + 4);
+
+    SubQNetworkDiskCache cache;
+    cache.setCacheDirectory(tempDir.path());
+    QVERIFY(cache.metaData(url).isValid());
+    QCOMPARE(countFiles(cacheDirectory).count(), NUM_SUBDIRECTORIES + 3);
+    QVERIFY(cache.cacheSize() > 0);
+    QScopedPointer<QIODevice> device(cache.data(url));
+    QVERIFY(device);
+    QCOMPARE(device->readAll(), QByteArray("Hello World!"));
+}
+
 void tst_QNetworkDiskCache::oldCacheVersionFile_data()
 {
     QTest::addColumn<int>("pass");
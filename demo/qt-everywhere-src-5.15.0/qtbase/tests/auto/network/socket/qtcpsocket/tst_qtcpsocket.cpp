@@ -179,6 +179,7 @@ private slots:
     void suddenRemoteDisconnect_data();
     void suddenRemoteDisconnect();
     void connectToMultiIP();
+    void raceConnectionAttempts();
     void moveToThread0();
     void increaseReadBufferSize();
     void increaseReadBufferSizeFromSlot();
@@ -2580,6 +2581,36 @@ void tst_QTcpSocket::connectToMultiIP()
 #endif
 }
 
+//----------------------------------------------------------------------------------
+void tst_QTcpSocket::raceConnectionAttempts()
+{
+    QFETCH_GLOBAL(bool, setProxy);
+    if (setProxy)
+        return;
+
+    QTcpServer server;
+    QVERIFY(server.listen(QHostAddress::LocalHost));
+
+    // 100::1 is in the IPv6 discard prefix (RFC 6666), connecting to it
+    // hangs (or fails at once without an IPv6 route). We should not wait
+    // for the connect timeout before trying the IPv4 address.
+    const QString name = QStringLiteral("qt-test-server-race");
+    QHostInfo info;
+    info.setAddresses(QList<QHostAddress>() << QHostAddress("100::1") << QHostAddress(QHostAddress::LocalHost));
+    qt_qhostinfo_cache_inject(name, info);
+
+    QTcpSocket *socket = newSocket();
+    QElapsedTimer stopWatch;
+    stopWatch.start();
+    socket->connectToHost(name, server.serverPort());
+    QTRY_COMPARE_WITH_TIMEOUT(socket->state(), QAbstractSocket::ConnectedState, 5000);
+    QVERIFY(stopWatch.elapsed() < 5000);
+    QCOMPARE(socket->peerAddress(), QHostAddress(QHostAddress::LocalHost));
+    QCOMPARE(socket->peerPort(), server.serverPort());
+
+    delete socket;
+}
+
 //----------------------------------------------------------------------------------
 void tst_QTcpSocket::moveToThread0()
 {
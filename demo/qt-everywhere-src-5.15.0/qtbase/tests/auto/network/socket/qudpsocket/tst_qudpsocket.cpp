@@ -119,6 +119,7 @@ private slots:
     void readyReadForEmptyDatagram();
     void asyncReadDatagram();
     void writeInHostLookupState();
+    void batchedDatagrams();
 
 protected slots:
     void empty_readyReadSlot();
@@ -1944,5 +1945,45 @@ void tst_QUdpSocket::writeInHostLookupState()
     QVERIFY(!socket.putChar('0'));
 }
 
+void tst_QUdpSocket::batchedDatagrams()
+{
+    QFETCH_GLOBAL(bool, setProxy);
+    if (setProxy)
+        return;
+
+    QUdpSocket receiver;
+    QVERIFY(receiver.bind(QHostAddress(QHostAddress::LocalHost), 0));
+    QUdpSocket sender;
+    QVERIFY(sender.bind(QHostAddress(QHostAddress::LocalHost), 0));
+
+    // runs of equally sized datagrams, each ending with a shorter one, so that
+    // the segmentation offload path is taken where the kernel supports it
+    QVector<QNetworkDatagram> datagrams;
+    for (int i = 0; i < 24; ++i) {
+        const int size = (i % 8 == 7) ? 100 : 1000 + 1000 * (i / 8);
+        const QByteArray data(size, char('a' + i));
+        datagrams << QNetworkDatagram(data, receiver.localAddress(), receiver.localPort());
+    }
+    datagrams << QNetworkDatagram(QByteArray(), receiver.localAddress(), receiver.localPort());
+
+    QCOMPARE(sender.writeDatagrams(QVector<QNetworkDatagram>()), 0);
+    QCOMPARE(sender.writeDatagrams(datagrams), datagrams.size());
+
+    QVector<QNetworkDatagram> received;
+    while (received.size() < datagrams.size()) {
+        if (!receiver.hasPendingDatagrams())
+            QVERIFY2(receiver.waitForReadyRead(5000), QtNetworkSettings::msgSocketError(receiver).constData());
+        received += receiver.receiveDatagrams(datagrams.size() - received.size());
+    }
+    QVERIFY(receiver.receiveDatagrams(0).isEmpty());
+
+    for (int i = 0; i < datagrams.size(); ++i) {
+        QCOMPARE(received.at(i).data(), datagrams.at(i).data());
+        QCOMPARE(received.at(i).senderAddress(), sender.localAddress());
+        QCOMPARE(received.at(i).senderPort(), int(sender.localPort()));
+        QCOMPARE(received.at(i).destinationPort(), int(receiver.localPort()));
+    }
+}
+
 QTEST_MAIN(tst_QUdpSocket)
 #include "tst_qudpsocket.moc"
@@ -0,0 +1,5 @@
+CONFIG += testcase
+TARGET = tst_qsqlcolumnbatch
+QT = core sql testlib
+
+SOURCES += tst_qsqlcolumnbatch.cpp
@@ -0,0 +1,229 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include <qbitarray.h>
+#include <qsqlcolumnbatch.h>
+#include <qsqlfield.h>
+#include <qsqlrecord.h>
+
+Q_DECLARE_METATYPE(QSqlColumnBatch::ColumnType)
+
+class tst_QSqlColumnBatch : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void empty();
+    void typedColumns();
+    void appendValue();
+    void columnTypeFor_data();
+    void columnTypeFor();
+    void resetFromRecord();
+    void implicitSharing();
+};
+
+void tst_QSqlColumnBatch::empty()
+{
+    QSqlColumnBatch batch;
+    QCOMPARE(batch.rowCount(), 0);
+    QCOMPARE(batch.columnCount(), 0);
+
+    batch.reset({QSqlColumnBatch::Int64Column, QSqlColumnBatch::StringColumn});
+    QCOMPARE(batch.rowCount(), 0);
+    QCOMPARE(batch.columnCount(), 2);
+
+    batch.clear();
+    QCOMPARE(batch.columnCount(), 0);
+}
+
+void tst_QSqlColumnBatch::typedColumns()
+{
+    QSqlColumnBatch batch;
+    batch.reset({QSqlColumnBatch::Int64Column, QSqlColumnBatch::DoubleColumn,
+                 QSqlColumnBatch::StringColumn, QSqlColumnBatch::VariantColumn});
+    QCOMPARE(batch.columnType(0), QSqlColumnBatch::Int64Column);
+    QCOMPARE(batch.columnType(3), QSqlColumnBatch::VariantColumn);
+
+    const QDate date(2020, 2, 29);
+    batch.appendInt64(0, 42);
+    batch.appendDouble(1, 1.5);
+    batch.appendString(2, u"first");
+    batch.appendValue(3, date);
+
+    batch.appendNull(0);
+    batch.appendNull(1);
+    batch.appendNull(2);
+    batch.appendNull(3);
+
+    batch.appendInt64(0, -1);
+    batch.appendDouble(1, -2.25);
+    batch.appendString(2, QString());
+    batch.appendValue(3, QByteArray("blob"));
+
+    QCOMPARE(batch.rowCount(), 3);
+
+    const qint64 *ints = batch.int64Data(0);
+    QVERIFY(ints);
+    QCOMPARE(ints[0], 42);
+    QCOMPARE(ints[1], 0);
+    QCOMPARE(ints[2], -1);
+    QVERIFY(!batch.int64Data(1));
+
+    const double *doubles = batch.doubleData(1);
+    QVERIFY(doubles);
+    QCOMPARE(doubles[0], 1.5);
+    QCOMPARE(doubles[2], -2.25);
+    QVERIFY(!batch.doubleData(0));
+
+    QCOMPARE(batch.string(0, 2), QStringView(u"first"));
+    QVERIFY(batch.string(1, 2).isEmpty());
+    QVERIFY(batch.string(2, 2).isEmpty());
+    QVERIFY(batch.string(0, 0).isNull());
+
+    for (int column = 0; column < batch.columnCount(); ++column) {
+        QVERIFY(!batch.isNull(0, column));
+        QVERIFY(batch.isNull(1, column));
+        QVERIFY(!batch.isNull(2, column));
+        QCOMPARE(batch.nulls(column).size(), 3);
+        QCOMPARE(batch.nulls(column).count(true), 1);
+    }
+
+    QCOMPARE(batch.value(0, 0), QVariant(qint64(42)));
+    QCOMPARE(batch.value(0, 1), QVariant(1.5));
+    QCOMPARE(batch.value(0, 2), QVariant(QStringLiteral("first")));
+    QCOMPARE(batch.value(0, 3), QVariant(date));
+    QCOMPARE(batch.value(2, 3), QVariant(QByteArray("blob")));
+    QVERIFY(batch.value(1, 0).isNull());
+    QCOMPARE(batch.value(1, 0).type(), QVariant::LongLong);
+    QCOMPARE(batch.value(1, 2).type(), QVariant::String);
+
+    // Refilling with the same shape starts from scratch
+    batch.reset({QSqlColumnBatch::Int64Column, QSqlColumnBatch::DoubleColumn,
+                 QSqlColumnBatch::StringColumn, QSqlColumnBatch::VariantColumn});
+    QCOMPARE(batch.rowCount(), 0);
+    batch.appendInt64(0, 7);
+    batch.appendDouble(1, 7);
+    batch.appendString(2, u"again");
+    batch.appendNull(3);
+    QCOMPARE(batch.rowCount(), 1);
+    QCOMPARE(batch.int64Data(0)[0], 7);
+    QCOMPARE(batch.string(0, 2), QStringView(u"again"));
+    QVERIFY(batch.isNull(0, 3));
+}
+
+void tst_QSqlColumnBatch::appendValue()
+{
+    QSqlColumnBatch batch;
+    batch.reset({QSqlColumnBatch::Int64Column, QSqlColumnBatch::DoubleColumn,
+                 QSqlColumnBatch::StringColumn, QSqlColumnBatch::VariantColumn});
+
+    batch.appendValue(0, true);
+    batch.appendValue(1, 3);
+    batch.appendValue(2, 12);
+    batch.appendValue(3, QVariant(QVariant::Date));
+
+    batch.appendValue(0, QVariant(QVariant::Int));
+    batch.appendValue(1, QStringLiteral("2.5"));
+    batch.appendValue(2, QStringLiteral("text"));
+    batch.appendValue(3, 5);
+
+    QCOMPARE(batch.rowCount(), 2);
+    QCOMPARE(batch.int64Data(0)[0], 1);
+    QVERIFY(batch.isNull(1, 0));
+    QCOMPARE(batch.doubleData(1)[0], 3.0);
+    QCOMPARE(batch.doubleData(1)[1], 2.5);
+    QCOMPARE(batch.string(0, 2), QStringView(u"12"));
+    QCOMPARE(batch.string(1, 2), QStringView(u"text"));
+
+    // Null variants keep their type in variant columns
+    QVERIFY(batch.isNull(0, 3));
+    QCOMPARE(batch.value(0, 3).type(), QVariant::Date);
+    QCOMPARE(batch.value(1, 3), QVariant(5));
+}
+
+void tst_QSqlColumnBatch::columnTypeFor_data()
+{
+    QTest::addColumn<int>("type");
+    QTest::addColumn<QSqlColumnBatch::ColumnType>("columnType");
+
+    QTest::newRow("bool") << int(QVariant::Bool) << QSqlColumnBatch::Int64Column;
+    QTest::newRow("int") << int(QVariant::Int) << QSqlColumnBatch::Int64Column;
+    QTest::newRow("uint") << int(QVariant::UInt) << QSqlColumnBatch::Int64Column;
+    QTest::newRow("longlong") << int(QVariant::LongLong) << QSqlColumnBatch::Int64Column;
+    QTest::newRow("ulonglong") << int(QVariant::ULongLong) << QSqlColumnBatch::Int64Column;
+    QTest::newRow("double") << int(QVariant::Double) << QSqlColumnBatch::DoubleColumn;
+    QTest::newRow("string") << int(QVariant::String) << QSqlColumnBatch::StringColumn;
+    QTest::newRow("bytearray") << int(QVariant::ByteArray) << QSqlColumnBatch::VariantColumn;
+    QTest::newRow("datetime") << int(QVariant::DateTime) << QSqlColumnBatch::VariantColumn;
+    QTest::newRow("invalid") << int(QVariant::Invalid) << QSqlColumnBatch::VariantColumn;
+}
+
+void tst_QSqlColumnBatch::columnTypeFor()
+{
+    QFETCH(int, type);
+    QFETCH(QSqlColumnBatch::ColumnType, columnType);
+
+    QCOMPARE(QSqlColumnBatch::columnTypeFor(QVariant::Type(type)), columnType);
+}
+
+void tst_QSqlColumnBatch::resetFromRecord()
+{
+    QSqlRecord record;
+    record.append(QSqlField("id", QVariant::Int));
+    record.append(QSqlField("name", QVariant::String));
+    record.append(QSqlField("created", QVariant::DateTime));
+
+    QSqlColumnBatch batch;
+    batch.reset(record);
+    QCOMPARE(batch.columnCount(), 3);
+    QCOMPARE(batch.columnType(0), QSqlColumnBatch::Int64Column);
+    QCOMPARE(batch.columnType(1), QSqlColumnBatch::StringColumn);
+    QCOMPARE(batch.columnType(2), QSqlColumnBatch::VariantColumn);
+}
+
+void tst_QSqlColumnBatch::implicitSharing()
+{
+    QSqlColumnBatch batch;
+    batch.reset({QSqlColumnBatch::StringColumn});
+    batch.appendString(0, u"shared");
+
+    QSqlColumnBatch copy = batch;
+    batch.appendString(0, u"detached");
+    QCOMPARE(copy.rowCount(), 1);
+    QCOMPARE(batch.rowCount(), 2);
+    QCOMPARE(copy.string(0, 0), QStringView(u"shared"));
+
+    QSqlColumnBatch moved = std::move(batch);
+    QCOMPARE(moved.rowCount(), 2);
+    QCOMPARE(moved.string(1, 0), QStringView(u"detached"));
+}
+
+QTEST_MAIN(tst_QSqlColumnBatch)
+#include "tst_qsqlcolumnbatch.moc"
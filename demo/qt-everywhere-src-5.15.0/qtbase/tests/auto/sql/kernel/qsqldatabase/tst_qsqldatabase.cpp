@@ -34,6 +34,8 @@
 #include <qsqlrecord.h>
 #include <qsqlfield.h>
 #include <qsqlindex.h>
+#include <qsqlcolumnbatch.h>
+#include <qsqlresult.h>
 #include <qregularexpression.h>
 #include <qvariant.h>
 #include <qdatetime.h>
@@ -130,6 +132,8 @@ private slots:
     void infinityAndNan();
     void multipleThreads_data() { generic_data(); }
     void multipleThreads();
+    void columnBatches_data() { generic_data(); }
+    void columnBatches();
 
     void db2_valueCacheUpdate_data() { generic_data("QDB2"); }
     void db2_valueCacheUpdate();
@@ -142,6 +146,8 @@ private slots:
     void psql_escapeBytea();
     void psql_bug249059_data() { generic_data("QPSQL"); }
     void psql_bug249059();
+    void psql_batchExec_data() { generic_data("QPSQL"); }
+    void psql_batchExec();
 
     void mysqlOdbc_unsignedIntegers_data() { generic_data(); }
     void mysqlOdbc_unsignedIntegers();
@@ -198,6 +204,7 @@ private slots:
     void sqlite_enableRegexp();
 
     void sqlite_openError();
+    void sqlite_connectionOptions();
 
     void sqlite_check_json1_data() { generic_data("QSQLITE"); }
     void sqlite_check_json1();
@@ -359,6 +366,7 @@ void tst_QSqlDatabase::dropTestTables(QSqlDatabase db)
             << qTableName("uint_table", __FILE__, db)
             << qTableName("uint_test", __FILE__, db)
             << qTableName("bug_249059", __FILE__, db)
+            << qTableName("batch_exec", __FILE__, db)
             << qTableName("regexp_test", __FILE__, db);
 
     QSqlQuery q(0, db);
@@ -1398,6 +1406,99 @@ void tst_QSqlDatabase::psql_bug249059()
     QCOMPARE(t1, t2);
 }
 
+void tst_QSqlDatabase::psql_batchExec()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+
+    QSqlQuery q(db);
+    const QString tableName(qTableName("batch_exec", __FILE__, db));
+    QVERIFY_SQL(q, exec(QString("CREATE TABLE %1 (id int PRIMARY KEY, t varchar(20))").arg(tableName)));
+
+    // Enough rows to need several pipeline sync points
+    const int rowCount = 1000;
+    QVariantList ids;
+    QVariantList texts;
+    for (int i = 0; i < rowCount; ++i) {
+        ids << i;
+        texts << (i % 10 ? QVariant(QString::number(i)) : QVariant(QVariant::String));
+    }
+
+    QSqlQuery iq(db);
+    QVERIFY_SQL(iq, prepare(QString("INSERT INTO %1 VALUES (?, ?)").arg(tableName)));
+    iq.addBindValue(ids);
+    iq.addBindValue(texts);
+    QVERIFY_SQL(iq, execBatch());
+
+    QVERIFY_SQL(q, exec(QString("SELECT count(*), count(t), sum(id) FROM %1").arg(tableName)));
+    QVERIFY_SQL(q, next());
+    QCOMPARE(q.value(0).toInt(), rowCount);
+    QCOMPARE(q.value(1).toInt(), rowCount - rowCount / 10);
+    QCOMPARE(q.value(2).toLongLong(), qlonglong(rowCount) * (rowCount - 1) / 2);
+
+    // A failing row makes the whole batch fail, without leaving any of its rows behind
+    ids.clear();
+    texts.clear();
+    for (int i = 0; i < rowCount; ++i) {
+        ids << rowCount + i;
+        texts << QString::number(i);
+    }
+    ids[rowCount / 2] = 0;
+    iq.addBindValue(ids);
+    iq.addBindValue(texts);
+    QVERIFY(!iq.execBatch());
+    QVERIFY(iq.lastError().isValid());
+
+    QVERIFY_SQL(q, exec(QString("SELECT count(*) FROM %1").arg(tableName)));
+    QVERIFY_SQL(q, next());
+    QCOMPARE(q.value(0).toInt(), rowCount);
+}
+
+void tst_QSqlDatabase::columnBatches()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+    const QString qtest(qTableName("qtest", __FILE__, db));
+
+    for (bool forwardOnly : {false, true}) {
+        QSqlQuery q(db);
+        q.setForwardOnly(forwardOnly);
+        QVERIFY_SQL(q, exec("select id, t_varchar, t_numeric from " + qtest + " order by id"));
+
+        QSqlColumnBatch batch;
+        QVERIFY(q.nextBatch(batch, 2));
+        QCOMPARE(batch.rowCount(), 2);
+        QCOMPARE(batch.columnCount(), 3);
+        QCOMPARE(batch.value(0, 0).toInt(), 0);
+        QCOMPARE(batch.value(1, 0).toInt(), 1);
+        QCOMPARE(batch.value(1, 1).toString(), QStringLiteral("VarChar1"));
+        QCOMPARE(q.at(), 1);
+        QCOMPARE(q.value(0).toInt(), 1);
+
+        QVERIFY(q.nextBatch(batch, 2));
+        QCOMPARE(batch.rowCount(), 2);
+        QCOMPARE(batch.value(0, 0).toInt(), 2);
+        QCOMPARE(batch.value(1, 1).toString(), QStringLiteral("VarChar3"));
+        if (batch.columnType(0) == QSqlColumnBatch::Int64Column)
+            QCOMPARE(batch.int64Data(0)[1], 3);
+        QVERIFY(!batch.isNull(1, 2));
+        QCOMPARE(q.value(0).toInt(), 3);
+
+        // Only one row left, and its numeric column is null
+        QVERIFY(q.nextBatch(batch, 2));
+        QCOMPARE(batch.rowCount(), 1);
+        QCOMPARE(batch.value(0, 0).toInt(), 4);
+        QVERIFY(batch.isNull(0, 2));
+        QVERIFY(batch.value(0, 2).isNull());
+
+        QVERIFY(!q.nextBatch(batch, 2));
+        QCOMPARE(batch.rowCount(), 0);
+        QCOMPARE(q.at(), int(QSql::AfterLastRow));
+    }
+}
+
 // This test should be rewritten to work with Oracle as well - or the Oracle driver
 // should be fixed to make this test pass (handle overflows)
 void tst_QSqlDatabase::precisionPolicy()
@@ -2361,6 +2462,74 @@ void tst_QSqlDatabase::sqlite_openError()
     QCOMPARE(error.databaseText(), "unable to open database file");
 }
 
+void tst_QSqlDatabase::sqlite_connectionOptions()
+{
+    if (!QSqlDatabase::drivers().contains("QSQLITE"))
+        QSKIP("Database driver QSQLITE not available");
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "sqlite_connectionOptions");
+        db.setDatabaseName(dir.filePath("options.sqlite"));
+        db.setConnectOptions("QSQLITE_STATEMENT_CACHE_SIZE=4;QSQLITE_JOURNAL_MODE=wal;"
+                             "QSQLITE_MMAP_SIZE=1048576");
+        QVERIFY_SQL(db, open());
+
+        QSqlQuery q(db);
+        QVERIFY_SQL(q, exec("PRAGMA journal_mode"));
+        QVERIFY_SQL(q, next());
+        QCOMPARE(q.value(0).toString(), QString("wal"));
+        QVERIFY_SQL(q, exec("CREATE TABLE t (id INTEGER PRIMARY KEY, name TEXT)"));
+        QVERIFY_SQL(q, exec("INSERT INTO t VALUES (1, 'one')"));
+
+        // The compiled statement of a finished query is reused
+        const auto statement = [](const QSqlQuery &query) {
+            const QVariant handle = query.result()->handle();
+            return *static_cast<void *const *>(handle.constData());
+        };
+        const QString select("SELECT name FROM t WHERE id = ?");
+        void *firstHandle = nullptr;
+        {
+            QSqlQuery first(db);
+            QVERIFY_SQL(first, prepare(select));
+            firstHandle = statement(first);
+            QVERIFY(firstHandle);
+            first.addBindValue(1);
+            QVERIFY_SQL(first, exec());
+            QVERIFY_SQL(first, next());
+            QCOMPARE(first.value(0).toString(), QString("one"));
+        }
+        QSqlQuery second(db);
+        QVERIFY_SQL(second, prepare(select));
+        QCOMPARE(statement(second), firstHandle);
+        second.addBindValue(2);
+        QVERIFY_SQL(second, exec());
+        QVERIFY(!second.next());
+        second.addBindValue(1);
+        QVERIFY_SQL(second, exec());
+        QVERIFY_SQL(second, next());
+        QCOMPARE(second.value(0).toString(), QString("one"));
+
+        // A query running concurrently with the same SQL gets its own statement
+        QSqlQuery third(db);
+        QVERIFY_SQL(third, prepare(select));
+        QVERIFY(statement(third) != firstHandle);
+
+        // Statements survive changes of the schema they depend on
+        second.finish();
+        second.clear();
+        QVERIFY_SQL(q, exec("ALTER TABLE t ADD COLUMN extra INTEGER"));
+        QVERIFY_SQL(second, prepare(select));
+        second.addBindValue(1);
+        QVERIFY_SQL(second, exec());
+        QVERIFY_SQL(second, next());
+        QCOMPARE(second.value(0).toString(), QString("one"));
+        db.close();
+    }
+    QSqlDatabase::removeDatabase("sqlite_connectionOptions");
+}
+
 void tst_QSqlDatabase::sqlite_check_json1()
 {
     QFETCH(QString, dbName);
@@ -47,6 +47,7 @@
 
 #include <private/qgraphicsscene_p.h>
 #include <private/qgraphicssceneindex_p.h>
+#include <private/qgraphicsscenedynamictreeindex_p.h>
 #include <math.h>
 #include "../../../gui/painting/qpathclipper/pathcompare.h"
 #include "../../../shared/platforminputcontext.h"
@@ -195,6 +196,7 @@ private slots:
     void sceneRect();
     void itemIndexMethod();
     void bspTreeDepth();
+    void dynamicTreeIndex();
     void itemsBoundingRect_data();
     void itemsBoundingRect();
     void items();
@@ -428,6 +430,75 @@ void tst_QGraphicsScene::itemIndexMethod()
         for (int x = minX; x < maxX; x += 100)
             QCOMPARE(itemAt(scene, x, y), items.at(n++));
     }
+
+    scene.setItemIndexMethod(QGraphicsScene::DynamicTreeIndex);
+    QCOMPARE(scene.itemIndexMethod(), QGraphicsScene::DynamicTreeIndex);
+
+    n = 0;
+    for (int y = minY; y < maxY; y += 100) {
+        for (int x = minX; x < maxX; x += 100)
+            QCOMPARE(itemAt(scene, x, y), items.at(n++));
+    }
+}
+
+void tst_QGraphicsScene::dynamicTreeIndex()
+{
+    QGraphicsScene scene;
+    scene.setItemIndexMethod(QGraphicsScene::DynamicTreeIndex);
+
+    QList<QGraphicsItem *> items;
+    for (int y = 0; y < 2000; y += 100) {
+        for (int x = 0; x < 2000; x += 100) {
+            QGraphicsItem *item = scene.addRect(QRectF(0, 0, 10, 10));
+            item->setPos(x, y);
+            items << item;
+        }
+    }
+    QCOMPARE(itemAt(scene, 500, 500), items.at(5 * 20 + 5));
+
+    QGraphicsSceneDynamicTreeIndex *index = qobject_cast<QGraphicsSceneDynamicTreeIndex *>(QGraphicsScenePrivate::get(&scene)->index);
+    QVERIFY(index);
+    QVERIFY(index->treeHeight() <= 2 * 9); // 400 leaves, log2(400) < 9
+
+    // Small moves stay inside the enlarged box, larger ones relink the leaf.
+    QGraphicsItem *item = items.at(5 * 20 + 5);
+    item->setPos(501, 501);
+    QCOMPARE(itemAt(scene, 505, 505), item);
+    item->setPos(1550, 50);
+    QVERIFY(!itemAt(scene, 505, 505));
+    QCOMPARE(itemAt(scene, 1555, 55), item);
+    QCOMPARE(scene.items(QRectF(1520, 20, 60, 60)).size(), 1);
+
+    // Children are reindexed when their parent moves.
+    QGraphicsRectItem *child = new QGraphicsRectItem(QRectF(0, 0, 10, 10), item);
+    child->setPos(20, 0);
+    QCOMPARE(itemAt(scene, 1575, 55), child);
+    item->setPos(50, 1550);
+    QCOMPARE(itemAt(scene, 75, 1555), child);
+    QVERIFY(!itemAt(scene, 1575, 55));
+
+    // Untransformable items are found through their own list.
+    child->setFlag(QGraphicsItem::ItemIgnoresTransformations);
+    QVERIFY(scene.items(QRectF(75, 1550, 1, 1)).contains(child));
+    child->setFlag(QGraphicsItem::ItemIgnoresTransformations, false);
+    QCOMPARE(itemAt(scene, 75, 1555), child);
+
+    // Removing and deleting items unlinks them.
+    scene.removeItem(items.at(0));
+    QVERIFY(!itemAt(scene, 5, 5));
+    delete items.takeAt(0);
+    delete items.takeAt(0);
+    QVERIFY(!itemAt(scene, 105, 5));
+    QCOMPARE(scene.items().size(), items.size() + 1);
+
+    // Agree with an unindexed scene after random moves.
+    QRandomGenerator random(42);
+    for (int i = 0; i < 1000; ++i)
+        items.at(random.bounded(items.size()))->setPos(random.bounded(2000), random.bounded(2000));
+    const QRectF rect(300, 300, 700, 500);
+    const QList<QGraphicsItem *> dynamicItems = scene.items(rect);
+    scene.setItemIndexMethod(QGraphicsScene::NoIndex);
+    QCOMPARE(dynamicItems, scene.items(rect));
 }
 
 void tst_QGraphicsScene::bspTreeDepth()
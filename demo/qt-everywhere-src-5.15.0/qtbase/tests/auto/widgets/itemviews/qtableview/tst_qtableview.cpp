@@ -397,6 +397,7 @@ private slots:
 
     void tabFocus();
     void bigModel();
+    void uniformSectionPositions();
     void selectionSignal();
     void setCurrentIndex();
 
@@ -3803,6 +3804,37 @@ void tst_QTableView::bigModel()
     QTest::qWait(100);
 }
 
+void tst_QTableView::uniformSectionPositions()
+{
+    QtTestTableModel model(1000, 1);
+    QTableView view;
+    view.setModel(&model);
+    QHeaderView *header = view.verticalHeader();
+    header->setDefaultSectionSize(20);
+
+    QCOMPARE(header->sectionPosition(500), 500 * 20);
+    QCOMPARE(header->visualIndexAt(500 * 20 + 19), 500);
+    QCOMPARE(header->visualIndexAt(1000 * 20), -1);
+    QCOMPARE(header->visualIndexAt(-1), -1);
+
+    // break the uniform layout and check the positions follow
+    view.setRowHeight(10, 40);
+    QCOMPARE(header->sectionPosition(500), 500 * 20 + 20);
+    QCOMPARE(header->visualIndexAt(500 * 20 + 20), 500);
+    QCOMPARE(header->length(), 1000 * 20 + 20);
+
+    view.hideRow(20);
+    QCOMPARE(header->sectionPosition(500), 500 * 20);
+    QCOMPARE(header->visualIndexAt(20 * 20 + 20), 21);
+
+    // and restore it again
+    view.showRow(20);
+    view.setRowHeight(10, 20);
+    QCOMPARE(header->sectionPosition(999), 999 * 20);
+    QCOMPARE(header->visualIndexAt(999 * 20), 999);
+    QCOMPARE(header->length(), 1000 * 20);
+}
+
 void tst_QTableView::selectionSignal()
 {
     QtTestTableModel model(10, 10);
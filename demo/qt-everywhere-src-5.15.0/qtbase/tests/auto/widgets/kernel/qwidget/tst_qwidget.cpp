@@ -5029,6 +5029,18 @@ void tst_QWidget::scroll()
         QTRY_COMPARE(updateWidget.paintedRegion, dirty);
     }
 
+    const qreal factor = QHighDpiScaling::factor(updateWidget.windowHandle());
+    if (qFloor(factor) == factor) {
+        // Invalid backing store content must not prevent scrolling the rest
+        updateWidget.reset();
+        qt_widget_private(&updateWidget)->invalidateBackingStore(QRect(0, 0, 10, 10));
+        updateWidget.scroll(0, 10);
+        QCoreApplication::processEvents();
+        QRegion dirty(QRect(0, 0, w, 10));
+        dirty += QRegion(QRect(0, 10, 10, 10));
+        QTRY_COMPARE(updateWidget.paintedRegion, dirty);
+    }
+
     if (updateWidget.width() < 200 || updateWidget.height() < 200)
          QSKIP("Skip this test due to too small screen geometry.");
 
@@ -88,6 +88,7 @@ private slots:
     void reparentWithNoChildStyleSheet();
     void reparentWithChildStyleSheet();
     void dynamicProperty();
+    void sharedStyleRules();
     // NB! Invoking this slot after layoutSpacing crashes on Mac.
     void namespaces();
 #ifdef Q_OS_MAC
@@ -654,6 +655,53 @@ void tst_QStyleSheetStyle::dynamicProperty()
     QVERIFY(COLOR(pb2) == Qt::blue);
 }
 
+void tst_QStyleSheetStyle::sharedStyleRules()
+{
+    // Widgets that no selector can tell apart share their rules; make sure
+    // that everything the selectors look at still makes a difference.
+    qApp->setStyleSheet("QLabel { color: red }"
+                        "QLabel#special { color: blue }"
+                        "QLabel[state=\"\"] { color: green }"
+                        "QFrame[mode=\"dark\"] QLabel { color: white }");
+
+    QLabel plain1("plain1");
+    QLabel plain2("plain2");
+    QLabel special("special");
+    special.setObjectName("special");
+    QLabel named("named");
+    named.setObjectName("named");
+    QLabel emptyState("emptyState");
+    emptyState.setProperty("state", QString(""));
+    QFrame darkFrame;
+    darkFrame.setProperty("mode", "dark");
+    QLabel dark("dark", &darkFrame);
+    QFrame lightFrame;
+    lightFrame.setProperty("mode", "light");
+    QLabel light("light", &lightFrame);
+
+    QCOMPARE(COLOR(plain1), QColor(Qt::red));
+    QCOMPARE(COLOR(plain2), QColor(Qt::red));
+    QCOMPARE(COLOR(special), QColor(Qt::blue));
+    QCOMPARE(COLOR(named), QColor(Qt::red));
+    QCOMPARE(COLOR(emptyState), QColor(Qt::green));
+    QCOMPARE(COLOR(dark), QColor(Qt::white));
+    QCOMPARE(COLOR(light), QColor(Qt::red));
+
+    // The attributes of ancestors are read again on repolish.
+    lightFrame.setProperty("mode", "dark");
+    light.style()->unpolish(&light);
+    light.style()->polish(&light);
+    QCOMPARE(COLOR(light), QColor(Qt::white));
+
+    // A widget style sheet only applies below its owner.
+    darkFrame.setStyleSheet("QLabel { color: black }");
+    QCOMPARE(COLOR(dark), QColor(Qt::black));
+    QCOMPARE(COLOR(light), QColor(Qt::white));
+    QCOMPARE(COLOR(plain1), QColor(Qt::red));
+
+    qApp->setStyleSheet(QString());
+}
+
 #ifdef Q_OS_MAC
 void tst_QStyleSheetStyle::layoutSpacing()
 {
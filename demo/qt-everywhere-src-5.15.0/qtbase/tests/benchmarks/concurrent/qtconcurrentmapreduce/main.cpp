@@ -0,0 +1,140 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtConcurrent/qtconcurrentmap.h>
+
+#include <QTest>
+#include <QVector>
+
+#include <numeric>
+
+Q_DECLARE_METATYPE(QtConcurrent::ReduceOptions)
+
+static const int HistogramBuckets = 256;
+
+static qint64 square(int x)
+{
+    return qint64(x) * x;
+}
+
+static void sumReduce(qint64 &result, qint64 value)
+{
+    result += value;
+}
+
+static int bucket(int x)
+{
+    return int((uint(x) * 2654435761u) % HistogramBuckets);
+}
+
+class HistogramReduce
+{
+public:
+    void operator()(QVector<int> &histogram, int bucket)
+    {
+        if (histogram.isEmpty())
+            histogram.resize(HistogramBuckets);
+        ++histogram[bucket];
+    }
+
+    void operator()(QVector<int> &histogram, const QVector<int> &partial)
+    {
+        if (histogram.isEmpty())
+            histogram.resize(HistogramBuckets);
+        for (int i = 0; i < partial.size(); ++i)
+            histogram[i] += partial.at(i);
+    }
+};
+
+class tst_QtConcurrentMapReduce : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void sum_data() { reduceOptionsData(); }
+    void sum();
+    void histogram_data() { reduceOptionsData(); }
+    void histogram();
+
+private:
+    void reduceOptionsData();
+};
+
+void tst_QtConcurrentMapReduce::reduceOptionsData()
+{
+    QTest::addColumn<int>("size");
+    QTest::addColumn<QtConcurrent::ReduceOptions>("options");
+
+    for (int size : {10000, 1000000}) {
+        const QByteArray suffix = ':' + QByteArray::number(size);
+        QTest::newRow("sequential" + suffix) << size
+            << QtConcurrent::ReduceOptions(QtConcurrent::UnorderedReduce | QtConcurrent::SequentialReduce);
+        QTest::newRow("parallel" + suffix) << size
+            << QtConcurrent::ReduceOptions(QtConcurrent::ParallelReduce);
+    }
+}
+
+static QVector<int> input(int size)
+{
+    QVector<int> values(size);
+    for (int i = 0; i < size; ++i)
+        values[i] = i;
+    return values;
+}
+
+void tst_QtConcurrentMapReduce::sum()
+{
+    QFETCH(int, size);
+    QFETCH(QtConcurrent::ReduceOptions, options);
+    const QVector<int> values = input(size);
+
+    qint64 result = 0;
+    QBENCHMARK {
+        result = QtConcurrent::blockingMappedReduced<qint64>(values, square, sumReduce, options);
+    }
+    QCOMPARE(result, (qint64(size) - 1) * size * (2 * qint64(size) - 1) / 6);
+}
+
+void tst_QtConcurrentMapReduce::histogram()
+{
+    QFETCH(int, size);
+    QFETCH(QtConcurrent::ReduceOptions, options);
+    const QVector<int> values = input(size);
+
+    QVector<int> result;
+    QBENCHMARK {
+        result = QtConcurrent::blockingMappedReduced<QVector<int>>(values, bucket,
+                                                                   HistogramReduce(), options);
+    }
+    QCOMPARE(std::accumulate(result.cbegin(), result.cend(), 0), size);
+}
+
+QTEST_MAIN(tst_QtConcurrentMapReduce)
+
+#include "main.moc"
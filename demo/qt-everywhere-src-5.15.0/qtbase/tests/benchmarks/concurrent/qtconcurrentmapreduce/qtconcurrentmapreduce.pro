@@ -0,0 +1,5 @@
+CONFIG += benchmark
+QT = core concurrent testlib
+
+TARGET = tst_bench_qtconcurrentmapreduce
+SOURCES += main.cpp
@@ -0,0 +1,214 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QAbstractItemModel>
+#include <QPersistentModelIndex>
+#include <QVector>
+
+#include <qtest.h>
+
+// Two level model: top-level groups with a number of leaf children each.
+class GroupModel : public QAbstractItemModel
+{
+public:
+    struct Group {
+        int row;
+        int childCount;
+    };
+
+    GroupModel(int groups, int children)
+    {
+        for (int i = 0; i < groups; ++i)
+            m_groups.append(new Group{ i, children });
+    }
+
+    ~GroupModel() override
+    {
+        qDeleteAll(m_groups);
+    }
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override
+    {
+        if (row < 0 || column != 0)
+            return QModelIndex();
+        if (!parent.isValid())
+            return row < m_groups.size() ? createIndex(row, 0, nullptr) : QModelIndex();
+        if (parent.internalPointer())
+            return QModelIndex();
+        Group *group = m_groups.at(parent.row());
+        return row < group->childCount ? createIndex(row, 0, group) : QModelIndex();
+    }
+
+    QModelIndex parent(const QModelIndex &child) const override
+    {
+        const Group *group = static_cast<const Group *>(child.internalPointer());
+        return group ? createIndex(group->row, 0, nullptr) : QModelIndex();
+    }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        if (!parent.isValid())
+            return m_groups.size();
+        if (parent.internalPointer())
+            return 0;
+        return m_groups.at(parent.row())->childCount;
+    }
+
+    int columnCount(const QModelIndex & = QModelIndex()) const override
+    {
+        return 1;
+    }
+
+    QVariant data(const QModelIndex &, int = Qt::DisplayRole) const override
+    {
+        return QVariant();
+    }
+
+    void insertGroups(int first, int count, int children)
+    {
+        beginInsertRows(QModelIndex(), first, first + count - 1);
+        for (int i = 0; i < count; ++i)
+            m_groups.insert(first + i, new Group{ first + i, children });
+        renumber(first + count);
+        endInsertRows();
+    }
+
+    void removeGroups(int first, int count)
+    {
+        beginRemoveRows(QModelIndex(), first, first + count - 1);
+        for (int i = 0; i < count; ++i)
+            delete m_groups.at(first + i);
+        m_groups.remove(first, count);
+        renumber(first);
+        endRemoveRows();
+    }
+
+    void insertChildren(int group, int first, int count)
+    {
+        beginInsertRows(index(group, 0), first, first + count - 1);
+        m_groups.at(group)->childCount += count;
+        endInsertRows();
+    }
+
+    void removeChildren(int group, int first, int count)
+    {
+        beginRemoveRows(index(group, 0), first, first + count - 1);
+        m_groups.at(group)->childCount -= count;
+        endRemoveRows();
+    }
+
+private:
+    void renumber(int from)
+    {
+        for (int i = from; i < m_groups.size(); ++i)
+            m_groups.at(i)->row = i;
+    }
+
+    QVector<Group *> m_groups;
+};
+
+class tst_QAbstractItemModel : public QObject
+{
+    Q_OBJECT
+private slots:
+    void insertRemoveTopLevel_data();
+    void insertRemoveTopLevel();
+    void insertRemoveChildren_data();
+    void insertRemoveChildren();
+
+private:
+    static QVector<QPersistentModelIndex> persistAllChildren(const GroupModel &model);
+};
+
+QVector<QPersistentModelIndex> tst_QAbstractItemModel::persistAllChildren(const GroupModel &model)
+{
+    QVector<QPersistentModelIndex> result;
+    for (int i = 0; i < model.rowCount(); ++i) {
+        const QModelIndex group = model.index(i, 0);
+        for (int j = 0; j < model.rowCount(group); ++j)
+            result.append(model.index(j, 0, group));
+    }
+    return result;
+}
+
+static void addRows()
+{
+    QTest::addColumn<int>("groups");
+    QTest::addColumn<int>("children");
+
+    QTest::newRow("100x100") << 100 << 100;
+    QTest::newRow("1000x100") << 1000 << 100;
+    QTest::newRow("100x1000") << 100 << 1000;
+}
+
+void tst_QAbstractItemModel::insertRemoveTopLevel_data()
+{
+    addRows();
+}
+
+void tst_QAbstractItemModel::insertRemoveTopLevel()
+{
+    QFETCH(int, groups);
+    QFETCH(int, children);
+
+    GroupModel model(groups, children);
+    const QVector<QPersistentModelIndex> persistent = persistAllChildren(model);
+    const int middle = groups / 2;
+
+    // removing an empty group still has to look at every persistent index
+    QBENCHMARK {
+        model.insertGroups(middle, 1, 0);
+        model.removeGroups(middle, 1);
+    }
+    QCOMPARE(persistent.first(), model.index(0, 0, model.index(0, 0)));
+}
+
+void tst_QAbstractItemModel::insertRemoveChildren_data()
+{
+    addRows();
+}
+
+void tst_QAbstractItemModel::insertRemoveChildren()
+{
+    QFETCH(int, groups);
+    QFETCH(int, children);
+
+    GroupModel model(groups, children);
+    const QVector<QPersistentModelIndex> persistent = persistAllChildren(model);
+    const int middle = groups / 2;
+
+    QBENCHMARK {
+        model.insertChildren(middle, children, 1);
+        model.removeChildren(middle, children, 1);
+    }
+    QCOMPARE(persistent.last(), model.index(children - 1, 0, model.index(groups - 1, 0)));
+}
+
+QTEST_MAIN(tst_QAbstractItemModel)
+
+#include "main.moc"
@@ -0,0 +1,148 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QTest>
+#include <QString>
+#include <QByteArray>
+#include <QTextCodec>
+
+class tst_QUtfCodec : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void fromUtf8_data();
+    void fromUtf8();
+    void toUtf8_data();
+    void toUtf8();
+    void decoder_data();
+    void decoder();
+};
+
+// Builds about 64 kB of text out of the words of the given samples, in a
+// fixed pseudo-random order so that the mix of sequence lengths is not
+// entirely predictable.
+static QString corpus(const QStringList &samples)
+{
+    QStringList words;
+    for (const QString &sample : samples)
+        words += sample.split(QLatin1Char(' '));
+
+    QString result;
+    uint seed = 1;
+    while (result.size() < 64 * 1024) {
+        seed = seed * 1103515245 + 12345;
+        result += words.at((seed >> 16) % words.size());
+        result += QLatin1Char(' ');
+    }
+    return result;
+}
+
+static void corpusData()
+{
+    const QString ascii = QStringLiteral("The quick brown fox jumps over the lazy dog");
+    const QString latin = QString::fromUtf8("Portez ce vieux whisky au juge blond qui fume à côté");
+    const QString cyrillic = QString::fromUtf8("Съешь же ещё этих мягких французских булок да выпей чаю");
+    const QString greek = QString::fromUtf8("Ξεσκεπάζω την ψυχοφθόρα βδελυγμία");
+    const QString cjk = QString::fromUtf8("いろはにほへと ちりぬるを 我能吞下玻璃而不伤身体 다람쥐 헌 쳇바퀴에 타고파");
+    const QString json = QString::fromUtf8("{\"id\": 1, \"name\": \"Иван\", \"city\": \"東京\"}");
+
+    QTest::addColumn<QString>("text");
+    QTest::newRow("ascii") << corpus({ ascii });
+    QTest::newRow("latin") << corpus({ latin });
+    QTest::newRow("cyrillic") << corpus({ cyrillic });
+    QTest::newRow("greek") << corpus({ greek });
+    QTest::newRow("cjk") << corpus({ cjk });
+    QTest::newRow("mixed-cyrillic-cjk") << corpus({ cyrillic, cjk });
+    QTest::newRow("mixed-all") << corpus({ ascii, latin, cyrillic, greek, cjk });
+    QTest::newRow("json") << corpus({ json });
+}
+
+void tst_QUtfCodec::fromUtf8_data()
+{
+    corpusData();
+}
+
+void tst_QUtfCodec::fromUtf8()
+{
+    QFETCH(QString, text);
+    const QByteArray utf8 = text.toUtf8();
+
+    QString result;
+    QBENCHMARK {
+        result = QString::fromUtf8(utf8);
+    }
+    QCOMPARE(result, text);
+}
+
+void tst_QUtfCodec::toUtf8_data()
+{
+    corpusData();
+}
+
+void tst_QUtfCodec::toUtf8()
+{
+    QFETCH(QString, text);
+
+    QByteArray result;
+    QBENCHMARK {
+        result = text.toUtf8();
+    }
+    QCOMPARE(QString::fromUtf8(result), text);
+}
+
+void tst_QUtfCodec::decoder_data()
+{
+    corpusData();
+}
+
+void tst_QUtfCodec::decoder()
+{
+#if QT_CONFIG(textcodec)
+    QFETCH(QString, text);
+    const QByteArray utf8 = text.toUtf8();
+    QTextCodec *codec = QTextCodec::codecForName("UTF-8");
+    QVERIFY(codec);
+
+    QString result;
+    QBENCHMARK {
+        // feed the decoder in chunks, as QTextStream would
+        QTextDecoder decoder(codec);
+        result.clear();
+        for (int i = 0; i < utf8.size(); i += 4096)
+            result += decoder.toUnicode(utf8.constData() + i, qMin(4096, utf8.size() - i));
+    }
+    QCOMPARE(result, text);
+#else
+    QSKIP("This test requires QTextCodec");
+#endif
+}
+
+QTEST_APPLESS_MAIN(tst_QUtfCodec)
+
+#include "main.moc"
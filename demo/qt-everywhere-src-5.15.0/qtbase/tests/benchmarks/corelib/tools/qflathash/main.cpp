@@ -0,0 +1,286 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/private/qflathash_p.h>
+
+#include <QHash>
+#include <QString>
+#include <QTest>
+#include <QVector>
+
+#include <algorithm>
+#include <unordered_map>
+
+class tst_QFlatHash : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void insert_int_data() { containerData(); }
+    void insert_int();
+    void insertReserved_int_data() { containerData(); }
+    void insertReserved_int();
+    void lookup_int_data() { containerData(); }
+    void lookup_int();
+    void lookupMissing_int_data() { containerData(); }
+    void lookupMissing_int();
+    void insert_string_data() { containerData(); }
+    void insert_string();
+    void lookup_string_data() { containerData(); }
+    void lookup_string();
+    void removeAndInsert_int_data() { containerData(); }
+    void removeAndInsert_int();
+    void iterate_int_data() { containerData(); }
+    void iterate_int();
+
+private:
+    void containerData();
+};
+
+enum Container { FlatHash, Hash, StdUnorderedMap };
+
+void tst_QFlatHash::containerData()
+{
+    QTest::addColumn<int>("container");
+    QTest::addColumn<int>("size");
+
+    for (int size : { 1000, 100000, 1000000 }) {
+        QTest::addRow("QFlatHash-%d", size) << int(FlatHash) << size;
+        QTest::addRow("QHash-%d", size) << int(Hash) << size;
+        QTest::addRow("std::unordered_map-%d", size) << int(StdUnorderedMap) << size;
+    }
+}
+
+// keys spread over the whole int range, in a fixed order
+static QVector<int> intKeys(int size, uint seed = 1)
+{
+    QVector<int> keys;
+    keys.reserve(size);
+    for (int i = 0; i < size; ++i) {
+        seed = seed * 1103515245 + 12345;
+        keys.append(int(seed));
+    }
+    return keys;
+}
+
+static QVector<QString> stringKeys(int size)
+{
+    QVector<QString> keys;
+    keys.reserve(size);
+    for (int key : intKeys(size))
+        keys.append(QLatin1String("symbol_") + QString::number(key, 16));
+    return keys;
+}
+
+// the same operations on the three containers, which don't share an API
+template <typename Key>
+struct Operations
+{
+    static void reserve(QFlatHash<Key, int> &h, int n) { h.reserve(n); }
+    static void reserve(QHash<Key, int> &h, int n) { h.reserve(n); }
+    static void reserve(std::unordered_map<Key, int> &h, int n) { h.reserve(n); }
+
+    static void insert(QFlatHash<Key, int> &h, const Key &k, int v) { h.insert(k, v); }
+    static void insert(QHash<Key, int> &h, const Key &k, int v) { h.insert(k, v); }
+    static void insert(std::unordered_map<Key, int> &h, const Key &k, int v) { h[k] = v; }
+
+    static int value(const QFlatHash<Key, int> &h, const Key &k) { return h.value(k); }
+    static int value(const QHash<Key, int> &h, const Key &k) { return h.value(k); }
+    static int value(const std::unordered_map<Key, int> &h, const Key &k)
+    {
+        const auto it = h.find(k);
+        return it == h.end() ? 0 : it->second;
+    }
+
+    static void remove(QFlatHash<Key, int> &h, const Key &k) { h.remove(k); }
+    static void remove(QHash<Key, int> &h, const Key &k) { h.remove(k); }
+    static void remove(std::unordered_map<Key, int> &h, const Key &k) { h.erase(k); }
+
+    static int sum(const QFlatHash<Key, int> &h)
+    {
+        int result = 0;
+        for (auto it = h.cbegin(); it != h.cend(); ++it)
+            result += it.value();
+        return result;
+    }
+    static int sum(const QHash<Key, int> &h)
+    {
+        int result = 0;
+        for (auto it = h.cbegin(); it != h.cend(); ++it)
+            result += it.value();
+        return result;
+    }
+    static int sum(const std::unordered_map<Key, int> &h)
+    {
+        int result = 0;
+        for (const auto &entry : h)
+            result += entry.second;
+        return result;
+    }
+};
+
+template <typename Map, typename Key>
+static void benchInsert(const QVector<Key> &keys, bool reserve)
+{
+    typedef Operations<Key> Ops;
+    QBENCHMARK {
+        Map map;
+        if (reserve)
+            Ops::reserve(map, keys.size());
+        for (int i = 0; i < keys.size(); ++i)
+            Ops::insert(map, keys.at(i), i);
+    }
+}
+
+template <typename Map, typename Key>
+static void benchLookup(const QVector<Key> &keys, const QVector<Key> &lookups)
+{
+    typedef Operations<Key> Ops;
+    Map map;
+    for (int i = 0; i < keys.size(); ++i)
+        Ops::insert(map, keys.at(i), i);
+
+    int result = 0;
+    QBENCHMARK {
+        for (const Key &key : lookups)
+            result += Ops::value(map, key);
+    }
+    Q_UNUSED(result);
+}
+
+template <typename Map>
+static void benchRemoveAndInsert(const QVector<int> &keys)
+{
+    typedef Operations<int> Ops;
+    Map map;
+    for (int i = 0; i < keys.size(); ++i)
+        Ops::insert(map, keys.at(i), i);
+
+    QBENCHMARK {
+        for (int i = 0; i < keys.size(); i += 2)
+            Ops::remove(map, keys.at(i));
+        for (int i = 0; i < keys.size(); i += 2)
+            Ops::insert(map, keys.at(i), i);
+    }
+}
+
+template <typename Map>
+static void benchIterate(const QVector<int> &keys)
+{
+    typedef Operations<int> Ops;
+    Map map;
+    for (int i = 0; i < keys.size(); ++i)
+        Ops::insert(map, keys.at(i), i);
+
+    int result = 0;
+    QBENCHMARK {
+        result += Ops::sum(map);
+    }
+    Q_UNUSED(result);
+}
+
+#define DISPATCH(function, Key, ...) \
+    switch (container) { \
+    case FlatHash: function<QFlatHash<Key, int> >(__VA_ARGS__); break; \
+    case Hash: function<QHash<Key, int> >(__VA_ARGS__); break; \
+    case StdUnorderedMap: function<std::unordered_map<Key, int> >(__VA_ARGS__); break; \
+    }
+
+void tst_QFlatHash::insert_int()
+{
+    QFETCH(int, container);
+    QFETCH(int, size);
+    const QVector<int> keys = intKeys(size);
+    DISPATCH(benchInsert, int, keys, false);
+}
+
+void tst_QFlatHash::insertReserved_int()
+{
+    QFETCH(int, container);
+    QFETCH(int, size);
+    const QVector<int> keys = intKeys(size);
+    DISPATCH(benchInsert, int, keys, true);
+}
+
+void tst_QFlatHash::lookup_int()
+{
+    QFETCH(int, container);
+    QFETCH(int, size);
+    const QVector<int> keys = intKeys(size);
+    // look the keys up in a different order than they were inserted
+    QVector<int> lookups = keys;
+    std::reverse(lookups.begin(), lookups.end());
+    DISPATCH(benchLookup, int, keys, lookups);
+}
+
+void tst_QFlatHash::lookupMissing_int()
+{
+    QFETCH(int, container);
+    QFETCH(int, size);
+    const QVector<int> keys = intKeys(size);
+    const QVector<int> lookups = intKeys(size, 2);
+    DISPATCH(benchLookup, int, keys, lookups);
+}
+
+void tst_QFlatHash::insert_string()
+{
+    QFETCH(int, container);
+    QFETCH(int, size);
+    const QVector<QString> keys = stringKeys(size);
+    DISPATCH(benchInsert, QString, keys, false);
+}
+
+void tst_QFlatHash::lookup_string()
+{
+    QFETCH(int, container);
+    QFETCH(int, size);
+    const QVector<QString> keys = stringKeys(size);
+    QVector<QString> lookups = keys;
+    std::reverse(lookups.begin(), lookups.end());
+    DISPATCH(benchLookup, QString, keys, lookups);
+}
+
+void tst_QFlatHash::removeAndInsert_int()
+{
+    QFETCH(int, container);
+    QFETCH(int, size);
+    const QVector<int> keys = intKeys(size);
+    DISPATCH(benchRemoveAndInsert, int, keys);
+}
+
+void tst_QFlatHash::iterate_int()
+{
+    QFETCH(int, container);
+    QFETCH(int, size);
+    const QVector<int> keys = intKeys(size);
+    DISPATCH(benchIterate, int, keys);
+}
+
+QTEST_MAIN(tst_QFlatHash)
+
+#include "main.moc"
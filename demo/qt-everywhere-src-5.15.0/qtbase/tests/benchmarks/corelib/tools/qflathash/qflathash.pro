@@ -0,0 +1,5 @@
+CONFIG += benchmark
+QT = core testlib core-private
+
+TARGET = tst_bench_qflathash
+SOURCES += main.cpp
@@ -0,0 +1,174 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QList>
+#include <QPointF>
+#include <QVariant>
+#include <QVector>
+
+#include <qtest.h>
+
+// QList stores types larger than a pointer, or types that are not movable,
+// in individually heap-allocated nodes. These benchmarks compare that with
+// the contiguous storage of QVector for such types.
+
+struct Record
+{
+    qint64 id;
+    double values[3];
+};
+Q_DECLARE_TYPEINFO(Record, Q_MOVABLE_TYPE);
+
+static inline double valueOf(const QPointF &p) { return p.x() + p.y(); }
+static inline double valueOf(const QVariant &v) { return v.toDouble(); }
+static inline double valueOf(const Record &r) { return r.values[0]; }
+static inline double valueOf(int i) { return i; }
+
+static inline QPointF makeValue(int i, const QPointF *) { return QPointF(i, -i); }
+static inline QVariant makeValue(int i, const QVariant *) { return QVariant(double(i)); }
+static inline Record makeValue(int i, const Record *) { return Record{ i, { double(i), 0, 0 } }; }
+static inline int makeValue(int i, const int *) { return i; }
+
+class tst_QList : public QObject
+{
+    Q_OBJECT
+private slots:
+    void append_data() { addSizes(); }
+    void append();
+    void iterate_data() { addSizes(); }
+    void iterate();
+    void insertMiddle_data() { addSizes(); }
+    void insertMiddle();
+
+private:
+    static void addSizes();
+};
+
+enum Type { Int, PointF, Variant, Struct };
+enum Container { List, Vector };
+
+void tst_QList::addSizes()
+{
+    QTest::addColumn<int>("type");
+    QTest::addColumn<int>("container");
+    QTest::addColumn<int>("size");
+
+    const struct { const char *name; Type type; } types[] = {
+        { "int", Int }, { "QPointF", PointF }, { "QVariant", Variant }, { "Record", Struct }
+    };
+    for (const auto &t : types) {
+        for (int size : { 100, 10000 }) {
+            QTest::addRow("QList<%s>/%d", t.name, size) << int(t.type) << int(List) << size;
+            QTest::addRow("QVector<%s>/%d", t.name, size) << int(t.type) << int(Vector) << size;
+        }
+    }
+}
+
+template <typename C>
+static void benchAppend(int size)
+{
+    using T = typename C::value_type;
+    QBENCHMARK {
+        C container;
+        container.reserve(size);
+        for (int i = 0; i < size; ++i)
+            container.append(makeValue(i, static_cast<const T *>(nullptr)));
+    }
+}
+
+template <typename C>
+static void benchIterate(int size)
+{
+    using T = typename C::value_type;
+    C container;
+    for (int i = 0; i < size; ++i)
+        container.append(makeValue(i, static_cast<const T *>(nullptr)));
+
+    double sum = 0;
+    QBENCHMARK {
+        for (const T &t : qAsConst(container))
+            sum += valueOf(t);
+    }
+    QVERIFY(sum != -1);
+}
+
+template <typename C>
+static void benchInsertMiddle(int size)
+{
+    using T = typename C::value_type;
+    C container;
+    for (int i = 0; i < size; ++i)
+        container.append(makeValue(i, static_cast<const T *>(nullptr)));
+
+    const T value = makeValue(-1, static_cast<const T *>(nullptr));
+    QBENCHMARK {
+        container.insert(size / 2, value);
+        container.removeAt(size / 2);
+    }
+}
+
+#define DISPATCH(function) \
+    do { \
+        QFETCH(int, type); \
+        QFETCH(int, container); \
+        QFETCH(int, size); \
+        switch (Type(type)) { \
+        case Int: \
+            container == List ? function<QList<int>>(size) : function<QVector<int>>(size); \
+            break; \
+        case PointF: \
+            container == List ? function<QList<QPointF>>(size) : function<QVector<QPointF>>(size); \
+            break; \
+        case Variant: \
+            container == List ? function<QList<QVariant>>(size) : function<QVector<QVariant>>(size); \
+            break; \
+        case Struct: \
+            container == List ? function<QList<Record>>(size) : function<QVector<Record>>(size); \
+            break; \
+        } \
+    } while (false)
+
+void tst_QList::append()
+{
+    DISPATCH(benchAppend);
+}
+
+void tst_QList::iterate()
+{
+    DISPATCH(benchIterate);
+}
+
+void tst_QList::insertMiddle()
+{
+    DISPATCH(benchInsertMiddle);
+}
+
+QTEST_APPLESS_MAIN(tst_QList)
+
+#include "main.moc"
@@ -170,6 +170,8 @@ private slots:
 
     void compositionModes_data();
     void compositionModes();
+    void compositionModesImage_data();
+    void compositionModesImage();
 
     void fillPrimitives_10_data() { drawPrimitives_data_helper(false); }
     void fillPrimitives_100_data() { drawPrimitives_data_helper(false); }
@@ -831,6 +833,65 @@ void tst_QPainter::compositionModes()
     }
 }
 
+void tst_QPainter::compositionModesImage_data()
+{
+    QTest::addColumn<QPainter::CompositionMode>("mode");
+    QTest::addColumn<QImage::Format>("format");
+    QTest::addColumn<qreal>("opacity");
+
+    const struct {
+        QImage::Format format;
+        const char *name;
+    } formats[] = {
+        { QImage::Format_RGB32, "rgb32" },
+        { QImage::Format_ARGB32_Premultiplied, "argb32pm" },
+        { QImage::Format_RGBA64_Premultiplied, "rgba64pm" }
+    };
+
+    // Only the Porter-Duff modes and Plus; the separable blend modes are not
+    // vectorized.
+    for (int i = QPainter::CompositionMode_SourceOver; i <= QPainter::CompositionMode_Plus; ++i) {
+        for (const auto &format : formats) {
+            const QString title = QString("%1:%2").arg(i).arg(format.name);
+            QTest::newRow(qPrintable(title + ":opaque"))
+                << QPainter::CompositionMode(i) << format.format << qreal(1.0);
+            QTest::newRow(qPrintable(title + ":opacity"))
+                << QPainter::CompositionMode(i) << format.format << qreal(0.5);
+        }
+    }
+}
+
+// Composes two images with varying alpha, so that the spans do not take the
+// fully opaque or fully transparent shortcuts of the composition functions.
+void tst_QPainter::compositionModesImage()
+{
+    QFETCH(QPainter::CompositionMode, mode);
+    QFETCH(QImage::Format, format);
+    QFETCH(qreal, opacity);
+
+    const QSize size(1024, 256);
+    QImage src(size, QImage::Format_ARGB32);
+    QImage dest(size, QImage::Format_ARGB32);
+    for (int y = 0; y < size.height(); ++y) {
+        QRgb *srcLine = reinterpret_cast<QRgb *>(src.scanLine(y));
+        QRgb *destLine = reinterpret_cast<QRgb *>(dest.scanLine(y));
+        for (int x = 0; x < size.width(); ++x) {
+            srcLine[x] = qRgba(x & 0xff, y & 0xff, 0x7f, (x + y) & 0xff);
+            destLine[x] = qRgba(0x7f, x & 0xff, y & 0xff, (x * 3 + y) & 0xff);
+        }
+    }
+    src = src.convertToFormat(format);
+    dest = dest.convertToFormat(format);
+
+    QPainter p(&dest);
+    p.setCompositionMode(mode);
+    p.setOpacity(opacity);
+
+    QBENCHMARK {
+        p.drawImage(0, 0, src);
+    }
+}
+
 void tst_QPainter::drawTiledPixmap_data()
 {
     QTest::addColumn<QSize>("srcSize");
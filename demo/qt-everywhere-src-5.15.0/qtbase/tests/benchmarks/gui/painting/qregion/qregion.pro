@@ -0,0 +1,6 @@
+QT += testlib
+
+TEMPLATE = app
+TARGET = tst_bench_qregion
+
+SOURCES += tst_qregion.cpp
@@ -0,0 +1,137 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <qtest.h>
+#include <QtGui/QRegion>
+
+class tst_QRegion : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void united_data();
+    void united();
+    void intersected_data();
+    void intersected();
+    void subtracted_data();
+    void subtracted();
+    void dirtyRegion();
+};
+
+// A grid of disjoint squares, producing rows * columns rectangles in
+// rows bands.
+static QRegion grid(int rows, int columns, int offset = 0)
+{
+    QVector<QRect> rects;
+    rects.reserve(rows * columns);
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < columns; ++x)
+            rects << QRect(offset + x * 20, offset + y * 20, 10, 10);
+    }
+    QRegion region;
+    region.setRects(rects.constData(), rects.size());
+    return region;
+}
+
+static void addRegionData()
+{
+    QTest::addColumn<QRegion>("r1");
+    QTest::addColumn<QRegion>("r2");
+
+    QTest::newRow("2 rects") << grid(1, 2) << grid(1, 2, 5);
+    QTest::newRow("4 rects") << grid(2, 2) << grid(2, 2, 5);
+    QTest::newRow("100 rects") << grid(10, 10) << grid(10, 10, 5);
+    QTest::newRow("10000 rects") << grid(100, 100) << grid(100, 100, 5);
+    QTest::newRow("tall") << grid(1000, 2) << grid(1000, 2, 5);
+    QTest::newRow("wide") << grid(2, 1000) << grid(2, 1000, 5);
+}
+
+void tst_QRegion::united_data()
+{
+    addRegionData();
+}
+
+void tst_QRegion::united()
+{
+    QFETCH(QRegion, r1);
+    QFETCH(QRegion, r2);
+
+    QBENCHMARK {
+        QRegion result = r1.united(r2);
+        Q_UNUSED(result);
+    }
+}
+
+void tst_QRegion::intersected_data()
+{
+    addRegionData();
+}
+
+void tst_QRegion::intersected()
+{
+    QFETCH(QRegion, r1);
+    QFETCH(QRegion, r2);
+
+    QBENCHMARK {
+        QRegion result = r1.intersected(r2);
+        Q_UNUSED(result);
+    }
+}
+
+void tst_QRegion::subtracted_data()
+{
+    addRegionData();
+}
+
+void tst_QRegion::subtracted()
+{
+    QFETCH(QRegion, r1);
+    QFETCH(QRegion, r2);
+
+    QBENCHMARK {
+        QRegion result = r1.subtracted(r2);
+        Q_UNUSED(result);
+    }
+}
+
+// Mimics how a repaint manager accumulates dirty areas: many small
+// overlapping updates folded into one region, clipped at the end.
+void tst_QRegion::dirtyRegion()
+{
+    QBENCHMARK {
+        QRegion dirty;
+        for (int i = 0; i < 64; ++i)
+            dirty += QRect((i * 37) % 600, (i * 53) % 400, 40, 20);
+        dirty &= QRect(0, 0, 640, 480);
+    }
+}
+
+QTEST_MAIN(tst_QRegion)
+
+#include "tst_qregion.moc"
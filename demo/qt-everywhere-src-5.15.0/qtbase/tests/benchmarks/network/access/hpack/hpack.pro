@@ -0,0 +1,10 @@
+TEMPLATE = app
+TARGET = tst_bench_hpack
+
+QT = core network-private testlib
+
+CONFIG += release
+
+requires(qtConfig(private_tests))
+
+SOURCES += tst_bench_hpack.cpp
@@ -0,0 +1,135 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include <QtNetwork/private/bitstreams_p.h>
+#include <QtNetwork/private/hpack_p.h>
+
+#include <vector>
+
+QT_USE_NAMESPACE
+
+using namespace HPack;
+
+class tst_bench_Hpack : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void encodeRequests_data();
+    void encodeRequests();
+    void decodeRequests_data();
+    void decodeRequests();
+
+private:
+    static HttpHeader apiRequest(int n);
+};
+
+// A typical API client request: a few KB of headers repeated
+// with every request, only the path and the trace id change.
+HttpHeader tst_bench_Hpack::apiRequest(int n)
+{
+    static const QByteArray token = "Bearer " + QByteArray(1500, 'a');
+    static const QByteArray userAgent = "ExampleClient/4.2 (X11; Linux x86_64) Qt/5.16";
+
+    return {{":method", "POST"},
+            {":scheme", "https"},
+            {":path", "/api/v2/items/" + QByteArray::number(n)},
+            {":authority", "api.example.com"},
+            {"authorization", token},
+            {"user-agent", userAgent},
+            {"accept", "application/json"},
+            {"content-type", "application/json"},
+            {"traceparent", "00-" + QByteArray::number(n * 7919, 16).rightJustified(32, '0')
+                            + "-00f067aa0ba902b7-01"},
+            {"x-client-session", QByteArray(400, 's')}};
+}
+
+void tst_bench_Hpack::encodeRequests_data()
+{
+    QTest::addColumn<bool>("huffman");
+    QTest::newRow("literal") << false;
+    QTest::newRow("huffman") << true;
+}
+
+void tst_bench_Hpack::encodeRequests()
+{
+    QFETCH(bool, huffman);
+
+    std::vector<HttpHeader> requests;
+    for (int i = 0; i < 1000; ++i)
+        requests.push_back(apiRequest(i));
+
+    std::vector<uchar> buffer;
+    BitOStream outputStream(buffer);
+    quint64 encoded = 0;
+    QBENCHMARK {
+        Encoder encoder(FieldLookupTable::DefaultSize, huffman);
+        for (const HttpHeader &header : requests) {
+            outputStream.clear();
+            encoder.encodeRequest(outputStream, header);
+            encoded += outputStream.byteLength();
+        }
+    }
+    QVERIFY(encoded);
+}
+
+void tst_bench_Hpack::decodeRequests_data()
+{
+    encodeRequests_data();
+}
+
+void tst_bench_Hpack::decodeRequests()
+{
+    QFETCH(bool, huffman);
+
+    std::vector<std::vector<uchar>> blocks;
+    {
+        Encoder encoder(FieldLookupTable::DefaultSize, huffman);
+        for (int i = 0; i < 1000; ++i) {
+            std::vector<uchar> buffer;
+            BitOStream outputStream(buffer);
+            QVERIFY(encoder.encodeRequest(outputStream, apiRequest(i)));
+            blocks.push_back(buffer);
+        }
+    }
+
+    QBENCHMARK {
+        Decoder decoder(FieldLookupTable::DefaultSize);
+        for (const auto &block : blocks) {
+            BitIStream inputStream(&block[0], &block[0] + block.size());
+            if (!decoder.decodeHeaderFields(inputStream))
+                QFAIL("failed to decode a header block");
+        }
+    }
+}
+
+QTEST_MAIN(tst_bench_Hpack)
+
+#include "tst_bench_hpack.moc"
@@ -55,6 +55,9 @@ public:
 };
 static StaticLabelFormatMatcherDeleter staticLabelFormatMatcherDeleter;
 
+// QGraphicsItem data key holding the text last set to a label item
+static const int labelTextKey = 0;
+
 ChartAxisElement::ChartAxisElement(QAbstractAxis *axis, QGraphicsItem *item, bool intervalAxis)
     : ChartElement(item),
       m_axis(axis),
@@ -408,6 +411,25 @@ QString ChartAxisElement::formatLabel(const QString &formatSpec, const QByteArra
     return retVal;
 }
 
+void ChartAxisElement::setLabelText(QGraphicsTextItem *labelItem, const QString &text,
+                                    qreal textWidth)
+{
+    // Setting the html makes the item rebuild and lay out its document, so skip it when the
+    // label already shows the same text, which is usually the case when only the range moves.
+    // Editable labels can be changed through their document, so those are always updated.
+    if (m_labelsEditable) {
+        labelItem->setData(labelTextKey, QVariant());
+    } else if (labelItem->textWidth() == textWidth
+               && labelItem->data(labelTextKey) == QVariant(text)) {
+        return;
+    }
+
+    labelItem->setTextWidth(textWidth);
+    labelItem->setHtml(text);
+    if (!m_labelsEditable)
+        labelItem->setData(labelTextKey, text);
+}
+
 QStringList ChartAxisElement::createValueLabels(qreal min, qreal max, int ticks,
                                                 qreal tickInterval, qreal tickAnchor,
                                                 QValueAxis::TickType tickType,
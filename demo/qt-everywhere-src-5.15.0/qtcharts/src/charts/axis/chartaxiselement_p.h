@@ -134,6 +134,7 @@ protected:
     QGraphicsItemGroup *shadeGroup() { return m_shades.data(); }
     QGraphicsItemGroup *arrowGroup() { return m_arrow.data(); }
     QGraphicsItemGroup *minorArrowGroup() { return m_minorArrow.data(); }
+    void setLabelText(QGraphicsTextItem *labelItem, const QString &text, qreal textWidth);
 
 public Q_SLOTS:
     void handleVisibleChanged(bool visible);
@@ -157,16 +157,16 @@ void HorizontalAxis::updateGeometry()
         QRectF boundingRect;
         // don't truncate empty labels
         if (text.isEmpty()) {
-            labelItem->setHtml(text);
+            setLabelText(labelItem, text, labelItem->textWidth());
         } else  {
             qreal labelWidth = axisRect.width() / layout.count() - (2 * labelPadding());
             QString truncatedText = ChartPresenter::truncatedText(axis()->labelsFont(), text,
                                                                   axis()->labelsAngle(),
                                                                   labelWidth,
                                                                   availableSpace, boundingRect);
-            labelItem->setTextWidth(ChartPresenter::textBoundingRect(axis()->labelsFont(),
-                                                                     truncatedText).width());
-            labelItem->setHtml(truncatedText);
+            setLabelText(labelItem, truncatedText,
+                         ChartPresenter::textBoundingRect(axis()->labelsFont(),
+                                                          truncatedText).width());
         }
 
         //label transformation origin point
@@ -163,15 +163,15 @@ void VerticalAxis::updateGeometry()
         QRectF boundingRect;
         // don't truncate empty labels
         if (text.isEmpty()) {
-            labelItem->setHtml(text);
+            setLabelText(labelItem, text, labelItem->textWidth());
         } else {
             qreal labelHeight = (axisRect.height() / layout.count()) - (2 * labelPadding());
             QString truncatedText =
                     ChartPresenter::truncatedText(axis()->labelsFont(), text, axis()->labelsAngle(),
                                                   labelAvailableSpace, labelHeight, boundingRect);
-            labelItem->setTextWidth(ChartPresenter::textBoundingRect(axis()->labelsFont(),
-                                                                     truncatedText).width());
-            labelItem->setHtml(truncatedText);
+            setLabelText(labelItem, truncatedText,
+                         ChartPresenter::textBoundingRect(axis()->labelsFont(),
+                                                          truncatedText).width());
         }
 
         //label transformation origin point
@@ -1831,6 +1831,11 @@ void QLowEnergyControllerPrivateBluez::discoverServiceDescriptors(
 
 void QLowEnergyControllerPrivateBluez::processUnsolicitedReply(const QByteArray &payload)
 {
+    if (payload.size() < 3) {
+        qCWarning(QT_BT_BLUEZ) << "Ignoring truncated notification/indication";
+        return;
+    }
+
     const char *data = payload.constData();
     bool isNotification = (data[0] == ATT_OP_HANDLE_VAL_NOTIFICATION);
     const QLowEnergyHandle changedHandle = bt_get_le16(&data[1]);
@@ -1844,9 +1849,11 @@ void QLowEnergyControllerPrivateBluez::processUnsolicitedReply(const QByteArray
 
     const QLowEnergyCharacteristic ch = characteristicForHandle(changedHandle);
     if (ch.isValid() && ch.handle() == changedHandle) {
+        // share one copy of the value between the cache and the signal
+        const QByteArray value = payload.mid(3);
         if (ch.properties() & QLowEnergyCharacteristic::Read)
-            updateValueOfCharacteristic(ch.attributeHandle(), payload.mid(3), NEW_VALUE);
-        emit ch.d_ptr->characteristicChanged(ch, payload.mid(3));
+            updateValueOfCharacteristic(ch.attributeHandle(), value, NEW_VALUE);
+        emit ch.d_ptr->characteristicChanged(ch, value);
     } else {
         qCWarning(QT_BT_BLUEZ) << "Cannot find matching characteristic for "
                                   "notification/indication";
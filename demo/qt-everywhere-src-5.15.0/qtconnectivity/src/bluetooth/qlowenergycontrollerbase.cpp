@@ -138,12 +138,10 @@ void QLowEnergyControllerPrivate::setState(
 QSharedPointer<QLowEnergyServicePrivate> QLowEnergyControllerPrivate::serviceForHandle(
         QLowEnergyHandle handle)
 {
-    ServiceDataMap &currentList = serviceList;
-    if (role == QLowEnergyController::PeripheralRole)
-        currentList = localServices;
+    const ServiceDataMap &currentList = (role == QLowEnergyController::PeripheralRole)
+            ? localServices : serviceList;
 
-    const QList<QSharedPointer<QLowEnergyServicePrivate>> values = currentList.values();
-    for (auto service: values)
+    for (const auto &service : currentList)
         if (service->startHandle <= handle && handle <= service->endHandle)
             return service;
 
@@ -168,16 +166,21 @@ QLowEnergyCharacteristic QLowEnergyControllerPrivate::characteristicForHandle(
     if (service->characteristicList.contains(handle))
         return QLowEnergyCharacteristic(service, handle);
 
-    // check whether it is the handle of the characteristic value or its descriptors
-    QList<QLowEnergyHandle> charHandles = service->characteristicList.keys();
-    std::sort(charHandles.begin(), charHandles.end());
-    for (int i = charHandles.size() - 1; i >= 0; i--) {
-        if (charHandles.at(i) > handle)
-            continue;
-
-        return QLowEnergyCharacteristic(service, charHandles.at(i));
+    // check whether it is the handle of the characteristic value or its descriptors,
+    // i.e. find the closest characteristic header below the handle
+    bool found = false;
+    QLowEnergyHandle closest = 0;
+    for (auto it = service->characteristicList.cbegin(),
+              end = service->characteristicList.cend(); it != end; ++it) {
+        if (it.key() < handle && (!found || it.key() > closest)) {
+            closest = it.key();
+            found = true;
+        }
     }
 
+    if (found)
+        return QLowEnergyCharacteristic(service, closest);
+
     return QLowEnergyCharacteristic();
 }
 
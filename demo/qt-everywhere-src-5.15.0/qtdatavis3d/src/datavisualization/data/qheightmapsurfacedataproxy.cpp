@@ -509,11 +509,15 @@ void QHeightMapSurfaceDataProxyPrivate::handlePendingResolve()
 {
     QImage heightImage = m_heightMap;
 
+    // Check before the conversion, as for 8-bit formats this does not need to scan the pixels
+    const bool isGrayscale = heightImage.isGrayscale();
+
     // Convert to RGB32 to be sure we're reading the right bytes
     if (heightImage.format() != QImage::Format_RGB32)
         heightImage = heightImage.convertToFormat(QImage::Format_RGB32);
 
-    uchar *bits = heightImage.bits();
+    // Read-only access, so that an image shared with m_heightMap is not detached and copied
+    const uchar *bits = heightImage.constBits();
 
     int imageHeight = heightImage.height();
     int imageWidth = heightImage.width();
@@ -542,7 +546,7 @@ void QHeightMapSurfaceDataProxyPrivate::handlePendingResolve()
     int lastRow = imageHeight - 1;
     int lastCol = imageWidth - 1;
 
-    if (heightImage.isGrayscale()) {
+    if (isGrayscale) {
         // Grayscale, it's enough to read Red byte
         for (int i = 0; i < imageHeight; i++, bitCount -= widthBits) {
             QSurfaceDataRow &newRow = *dataArray->at(i);
@@ -81,6 +81,12 @@ void Scatter3DController::synchDataToRenderer()
     if (!isInitialized())
         return;
 
+    // Appends must reach the renderer before the base class triggers the data update
+    if (m_appendedSeriesList.size()) {
+        m_renderer->updateAppendedItems(m_appendedSeriesList);
+        m_appendedSeriesList.clear();
+    }
+
     Abstract3DController::synchDataToRenderer();
 
     // Notify changes to renderer
@@ -161,8 +167,10 @@ void Scatter3DController::handleItemsAdded(int startIndex, int count)
         adjustAxisRanges();
         m_isDataDirty = true;
     }
-    if (!m_changedSeriesList.contains(series))
-        m_changedSeriesList.append(series);
+    // Items are always added to the end of the array, so the renderer only needs to process
+    // the new items. Any other change marking the series modified still forces a full update.
+    if (!m_appendedSeriesList.contains(series))
+        m_appendedSeriesList.append(series);
     emitNeedRender();
 }
 
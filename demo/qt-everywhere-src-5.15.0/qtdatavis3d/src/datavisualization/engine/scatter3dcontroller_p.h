@@ -72,6 +72,7 @@ public:
 private:
     Scatter3DChangeBitField m_changeTracker;
     QVector<ChangeItem> m_changedItems;
+    QVector<QScatter3DSeries *> m_appendedSeriesList;
 
     // Rendering
     Scatter3DRenderer *m_renderer;
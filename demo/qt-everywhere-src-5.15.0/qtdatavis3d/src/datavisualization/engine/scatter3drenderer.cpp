@@ -184,7 +184,17 @@ void Scatter3DRenderer::getVisibleItemBounds(QVector3D &minBounds, QVector3D &ma
 
 void Scatter3DRenderer::updateData()
 {
+    const float oldScaleX = m_scaleX;
+    const float oldScaleY = m_scaleY;
+    const float oldScaleZ = m_scaleZ;
+    const float oldPolarRadius = m_polarRadius;
     calculateSceneScalingFactors();
+    // Item translations depend on the scene scaling, so appended items can be processed
+    // on their own only as long as the scaling stays the same.
+    const bool scalingChanged = oldScaleX != m_scaleX || oldScaleY != m_scaleY
+            || oldScaleZ != m_scaleZ || oldPolarRadius != m_polarRadius;
+    const bool optimizationStatic = m_cachedOptimizationHint.testFlag(
+                QAbstract3DGraph::OptimizationStatic);
     int totalDataSize = 0;
 
     foreach (SeriesRenderCache *baseCache, m_renderCacheList) {
@@ -196,6 +206,8 @@ void Scatter3DRenderer::updateData()
             const QScatterDataArray &dataArray = *dataProxy->array();
             int dataSize = dataArray.size();
             totalDataSize += dataSize;
+            if (cache->itemsAppended() && (scalingChanged || dataSize < renderArray.size()))
+                cache->setDataDirty(true);
             if (cache->dataDirty()) {
                 if (dataSize != renderArray.size())
                     renderArray.resize(dataSize);
@@ -203,10 +215,21 @@ void Scatter3DRenderer::updateData()
                 for (int i = 0; i < dataSize; i++)
                     updateRenderItem(dataArray.at(i), renderArray[i]);
 
-                if (m_cachedOptimizationHint.testFlag(QAbstract3DGraph::OptimizationStatic))
+                if (optimizationStatic)
                     cache->setStaticBufferDirty(true);
 
                 cache->setDataDirty(false);
+                cache->setItemsAppended(false);
+            } else if (cache->itemsAppended()) {
+                const int oldSize = renderArray.size();
+                renderArray.resize(dataSize);
+
+                for (int i = oldSize; i < dataSize; i++)
+                    updateRenderItem(dataArray.at(i), renderArray[i]);
+
+                // Static buffers are extended in the buffer update below
+                if (!optimizationStatic)
+                    cache->setItemsAppended(false);
             }
         }
     }
@@ -231,7 +254,10 @@ void Scatter3DRenderer::updateData()
                         cache->setBufferPoints(points);
                     }
                     points->setScaleY(m_scaleY);
-                    points->load(cache);
+                    if (cache->itemsAppended())
+                        points->append(cache);
+                    else
+                        points->load(cache);
                 } else {
                     ScatterObjectBufferHelper *object = cache->bufferObject();
                     if (!object) {
@@ -251,6 +277,7 @@ void Scatter3DRenderer::updateData()
                 }
 
                 cache->setStaticBufferDirty(false);
+                cache->setItemsAppended(false);
             }
         }
     }
@@ -415,6 +442,22 @@ void Scatter3DRenderer::updateItems(const QVector<Scatter3DController::ChangeIte
     }
 }
 
+void Scatter3DRenderer::updateAppendedItems(const QVector<QScatter3DSeries *> &seriesList)
+{
+    foreach (QScatter3DSeries *series, seriesList) {
+        ScatterSeriesRenderCache *cache =
+                static_cast<ScatterSeriesRenderCache *>(m_renderCacheList.value(series));
+        if (!cache)
+            continue;
+        // Invisible series render caches are recalculated completely when they are turned
+        // visible, same as with changed items.
+        if (cache->isVisible())
+            cache->setItemsAppended(true);
+        else
+            cache->setDataDirty(true);
+    }
+}
+
 void Scatter3DRenderer::updateScene(Q3DScene *scene)
 {
     scene->activeCamera()->d_ptr->setMinYRotation(-90.0f);
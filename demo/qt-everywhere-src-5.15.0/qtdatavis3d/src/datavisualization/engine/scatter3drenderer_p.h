@@ -101,6 +101,7 @@ public:
     void updateSeries(const QList<QAbstract3DSeries *> &seriesList);
     SeriesRenderCache *createNewCache(QAbstract3DSeries *series);
     void updateItems(const QVector<Scatter3DController::ChangeItem> &items);
+    void updateAppendedItems(const QVector<QScatter3DSeries *> &seriesList);
     void updateScene(Q3DScene *scene);
     void updateAxisLabels(QAbstract3DAxis::AxisOrientation orientation,
                           const QStringList &labels);
@@ -43,7 +43,8 @@ ScatterSeriesRenderCache::ScatterSeriesRenderCache(QAbstract3DSeries *series,
       m_oldMeshFileName(QString()),
       m_scatterBufferObj(0),
       m_scatterBufferPoints(0),
-      m_visibilityChanged(false)
+      m_visibilityChanged(false),
+      m_itemsAppended(false)
 {
 }
 
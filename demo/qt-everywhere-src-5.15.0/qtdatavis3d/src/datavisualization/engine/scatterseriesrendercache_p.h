@@ -78,6 +78,8 @@ public:
     inline QVector<int> &bufferIndices() { return m_bufferIndices; }
     inline void setVisibilityChanged(bool changed) { m_visibilityChanged = changed; }
     inline bool visibilityChanged() const { return m_visibilityChanged; }
+    inline void setItemsAppended(bool appended) { m_itemsAppended = appended; }
+    inline bool itemsAppended() const { return m_itemsAppended; }
 
 protected:
     ScatterRenderItemArray m_renderArray;
@@ -91,6 +93,7 @@ protected:
     QVector<int> m_updateIndices; // Used as temporary cache during item updates
     QVector<int> m_bufferIndices; // Cache for mapping renderarray to mesh buffer
     bool m_visibilityChanged; // Used to detect if full buffer change needed
+    bool m_itemsAppended; // Only new items at the end of the array need processing
 };
 
 QT_END_NAMESPACE_DATAVISUALIZATION
@@ -36,7 +36,8 @@ const QVector3D hiddenPos(-1000.0f, -1000.0f, -1000.0f);
 
 ScatterPointBufferHelper::ScatterPointBufferHelper()
     : m_pointbuffer(0),
-      m_oldRemoveIndex(-1)
+      m_oldRemoveIndex(-1),
+      m_bufferCapacity(0)
 {
 }
 
@@ -124,6 +125,7 @@ void ScatterPointBufferHelper::load(ScatterSeriesRenderCache *cache)
         glBufferData(GL_ARRAY_BUFFER, m_bufferedPoints.size() * sizeof(QVector3D),
                      &m_bufferedPoints.at(0),
                      GL_DYNAMIC_DRAW);
+        m_bufferCapacity = m_bufferedPoints.size();
 
         if (buffered_uvs.size()) {
             glGenBuffers(1, &m_uvbuffer);
@@ -138,6 +140,50 @@ void ScatterPointBufferHelper::load(ScatterSeriesRenderCache *cache)
     }
 }
 
+void ScatterPointBufferHelper::append(ScatterSeriesRenderCache *cache)
+{
+    const ScatterRenderItemArray &renderArray = cache->renderArray();
+    const int renderArraySize = renderArray.size();
+    const int oldSize = m_bufferedPoints.size();
+
+    // Gradient UVs are not kept for the spare capacity, so reload fully in that case
+    if (!m_meshDataLoaded || !m_indexCount || renderArraySize < oldSize
+            || cache->colorStyle() == Q3DTheme::ColorStyleRangeGradient) {
+        load(cache);
+        return;
+    }
+
+    m_bufferedPoints.resize(renderArraySize);
+    for (int i = oldSize; i < renderArraySize; i++) {
+        const ScatterRenderItem &item = renderArray.at(i);
+        if (!item.isVisible())
+            m_bufferedPoints[i] = hiddenPos;
+        else
+            m_bufferedPoints[i] = item.translation();
+    }
+    m_indexCount = renderArraySize;
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_pointbuffer);
+    if (renderArraySize > m_bufferCapacity) {
+        // Grow geometrically so that a steady stream of appends does not reallocate
+        // the buffer every frame.
+        m_bufferCapacity = qMax(renderArraySize, m_bufferCapacity * 2);
+        glBufferData(GL_ARRAY_BUFFER, m_bufferCapacity * sizeof(QVector3D), 0, GL_DYNAMIC_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, renderArraySize * sizeof(QVector3D),
+                        &m_bufferedPoints.at(0));
+        // Keep the selected point hidden
+        if (m_oldRemoveIndex >= 0) {
+            glBufferSubData(GL_ARRAY_BUFFER, m_oldRemoveIndex * sizeof(QVector3D),
+                            sizeof(QVector3D), &hiddenPos);
+        }
+    } else if (renderArraySize > oldSize) {
+        glBufferSubData(GL_ARRAY_BUFFER, oldSize * sizeof(QVector3D),
+                        (renderArraySize - oldSize) * sizeof(QVector3D),
+                        &m_bufferedPoints.at(oldSize));
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
 void ScatterPointBufferHelper::update(ScatterSeriesRenderCache *cache)
 {
     // It may be that the buffer hasn't yet been initialized, in case the entire series was
@@ -57,6 +57,7 @@ public:
     void pushPoint(uint pointIndex);
     void popPoint();
     void load(ScatterSeriesRenderCache *cache);
+    void append(ScatterSeriesRenderCache *cache);
     void update(ScatterSeriesRenderCache *cache);
     void setScaleY(float scale) { m_scaleY = scale; }
     void updateUVs(ScatterSeriesRenderCache *cache);
@@ -71,6 +72,7 @@ private:
 private:
     QVector<QVector3D> m_bufferedPoints;
     int m_oldRemoveIndex;
+    int m_bufferCapacity; // Point count the GL buffer has been allocated for
     float m_scaleY;
 };
 
@@ -0,0 +1 @@
+/tmp/qtcfg/qq/qtquick-config.h
\ No newline at end of file
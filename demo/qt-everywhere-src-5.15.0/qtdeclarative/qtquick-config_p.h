@@ -0,0 +1 @@
+/tmp/qtcfg/qq/qtquick-config_p.h
\ No newline at end of file
@@ -2250,6 +2250,13 @@ void QQuickImageParticle::commit(int gIdx, int pIdx)
     DeformableVertex *deformableVertices = (DeformableVertex *) node->geometry()->vertexData();
     ColoredVertex *coloredVertices = (ColoredVertex *) node->geometry()->vertexData();
     SimpleVertex *simpleVertices = (SimpleVertex *) node->geometry()->vertexData();
+    //Resolve shadowed data once per particle, not once per vertex
+    QQuickParticleData *deformDatum = (m_explicitDeformation && datum->deformationOwner != this)
+            ? getShadowDatum(datum) : datum;
+    QQuickParticleData *rotationDatum = (m_explicitRotation && datum->rotationOwner != this)
+            ? getShadowDatum(datum) : datum;
+    QQuickParticleData *colorDatum = (m_explicitColor && datum->colorOwner != this)
+            ? getShadowDatum(datum) : datum;
     switch (perfLevel){//No automatic fall through intended on this one
     case Sprites:
         spriteVertices += pIdx*4;
@@ -2264,41 +2271,18 @@ void QQuickImageParticle::commit(int gIdx, int pIdx)
             spriteVertices[i].vy = datum->vy;
             spriteVertices[i].ax = datum->ax;
             spriteVertices[i].ay = datum->ay;
-            if (m_explicitDeformation && datum->deformationOwner != this) {
-                QQuickParticleData* shadow = getShadowDatum(datum);
-                spriteVertices[i].xx = shadow->xx;
-                spriteVertices[i].xy = shadow->xy;
-                spriteVertices[i].yx = shadow->yx;
-                spriteVertices[i].yy = shadow->yy;
-            } else {
-                spriteVertices[i].xx = datum->xx;
-                spriteVertices[i].xy = datum->xy;
-                spriteVertices[i].yx = datum->yx;
-                spriteVertices[i].yy = datum->yy;
-            }
-            if (m_explicitRotation && datum->rotationOwner != this) {
-                QQuickParticleData* shadow = getShadowDatum(datum);
-                spriteVertices[i].rotation = shadow->rotation;
-                spriteVertices[i].rotationVelocity = shadow->rotationVelocity;
-                spriteVertices[i].autoRotate = shadow->autoRotate;
-            } else {
-                spriteVertices[i].rotation = datum->rotation;
-                spriteVertices[i].rotationVelocity = datum->rotationVelocity;
-                spriteVertices[i].autoRotate = datum->autoRotate;
-            }
+            spriteVertices[i].xx = deformDatum->xx;
+            spriteVertices[i].xy = deformDatum->xy;
+            spriteVertices[i].yx = deformDatum->yx;
+            spriteVertices[i].yy = deformDatum->yy;
+            spriteVertices[i].rotation = rotationDatum->rotation;
+            spriteVertices[i].rotationVelocity = rotationDatum->rotationVelocity;
+            spriteVertices[i].autoRotate = rotationDatum->autoRotate;
             //Sprite-related vertices updated per-frame in spritesUpdate(), not on demand
-            if (m_explicitColor && datum->colorOwner != this) {
-                QQuickParticleData* shadow = getShadowDatum(datum);
-                spriteVertices[i].color.r = shadow->color.r;
-                spriteVertices[i].color.g = shadow->color.g;
-                spriteVertices[i].color.b = shadow->color.b;
-                spriteVertices[i].color.a = shadow->color.a;
-            } else {
-                spriteVertices[i].color.r = datum->color.r;
-                spriteVertices[i].color.g = datum->color.g;
-                spriteVertices[i].color.b = datum->color.b;
-                spriteVertices[i].color.a = datum->color.a;
-            }
+            spriteVertices[i].color.r = colorDatum->color.r;
+            spriteVertices[i].color.g = colorDatum->color.g;
+            spriteVertices[i].color.b = colorDatum->color.b;
+            spriteVertices[i].color.a = colorDatum->color.a;
         }
         break;
     case Tabled: //Fall through until it has its own vertex class
@@ -2315,40 +2299,17 @@ void QQuickImageParticle::commit(int gIdx, int pIdx)
             deformableVertices[i].vy = datum->vy;
             deformableVertices[i].ax = datum->ax;
             deformableVertices[i].ay = datum->ay;
-            if (m_explicitDeformation && datum->deformationOwner != this) {
-                QQuickParticleData* shadow = getShadowDatum(datum);
-                deformableVertices[i].xx = shadow->xx;
-                deformableVertices[i].xy = shadow->xy;
-                deformableVertices[i].yx = shadow->yx;
-                deformableVertices[i].yy = shadow->yy;
-            } else {
-                deformableVertices[i].xx = datum->xx;
-                deformableVertices[i].xy = datum->xy;
-                deformableVertices[i].yx = datum->yx;
-                deformableVertices[i].yy = datum->yy;
-            }
-            if (m_explicitRotation && datum->rotationOwner != this) {
-                QQuickParticleData* shadow = getShadowDatum(datum);
-                deformableVertices[i].rotation = shadow->rotation;
-                deformableVertices[i].rotationVelocity = shadow->rotationVelocity;
-                deformableVertices[i].autoRotate = shadow->autoRotate;
-            } else {
-                deformableVertices[i].rotation = datum->rotation;
-                deformableVertices[i].rotationVelocity = datum->rotationVelocity;
-                deformableVertices[i].autoRotate = datum->autoRotate;
-            }
-            if (m_explicitColor && datum->colorOwner != this) {
-                QQuickParticleData* shadow = getShadowDatum(datum);
-                deformableVertices[i].color.r = shadow->color.r;
-                deformableVertices[i].color.g = shadow->color.g;
-                deformableVertices[i].color.b = shadow->color.b;
-                deformableVertices[i].color.a = shadow->color.a;
-            } else {
-                deformableVertices[i].color.r = datum->color.r;
-                deformableVertices[i].color.g = datum->color.g;
-                deformableVertices[i].color.b = datum->color.b;
-                deformableVertices[i].color.a = datum->color.a;
-            }
+            deformableVertices[i].xx = deformDatum->xx;
+            deformableVertices[i].xy = deformDatum->xy;
+            deformableVertices[i].yx = deformDatum->yx;
+            deformableVertices[i].yy = deformDatum->yy;
+            deformableVertices[i].rotation = rotationDatum->rotation;
+            deformableVertices[i].rotationVelocity = rotationDatum->rotationVelocity;
+            deformableVertices[i].autoRotate = rotationDatum->autoRotate;
+            deformableVertices[i].color.r = colorDatum->color.r;
+            deformableVertices[i].color.g = colorDatum->color.g;
+            deformableVertices[i].color.b = colorDatum->color.b;
+            deformableVertices[i].color.a = colorDatum->color.a;
         }
         break;
     case Colored:
@@ -2364,18 +2325,10 @@ void QQuickImageParticle::commit(int gIdx, int pIdx)
             coloredVertices[i].vy = datum->vy;
             coloredVertices[i].ax = datum->ax;
             coloredVertices[i].ay = datum->ay;
-            if (m_explicitColor && datum->colorOwner != this) {
-                QQuickParticleData* shadow = getShadowDatum(datum);
-                coloredVertices[i].color.r = shadow->color.r;
-                coloredVertices[i].color.g = shadow->color.g;
-                coloredVertices[i].color.b = shadow->color.b;
-                coloredVertices[i].color.a = shadow->color.a;
-            } else {
-                coloredVertices[i].color.r = datum->color.r;
-                coloredVertices[i].color.g = datum->color.g;
-                coloredVertices[i].color.b = datum->color.b;
-                coloredVertices[i].color.a = datum->color.a;
-            }
+            coloredVertices[i].color.r = colorDatum->color.r;
+            coloredVertices[i].color.g = colorDatum->color.g;
+            coloredVertices[i].color.b = colorDatum->color.b;
+            coloredVertices[i].color.a = colorDatum->color.a;
         }
         break;
     case Simple:
@@ -160,28 +160,39 @@ bool QQuickParticleAffector::shouldAffect(QQuickParticleData* d)
 {
     if (!d)
         return false;
-    if (activeGroup(d->groupId)){
-        if ((m_onceOff && m_onceOffed.contains(qMakePair(d->groupId, d->index)))
-                || !d->stillAlive(m_system))
-            return false;
-        //Need to have previous location for affected anyways
-        if (width() == 0 || height() == 0
-                || m_shape->contains(QRectF(m_offset.x(), m_offset.y(), width(), height()), QPointF(d->curX(m_system), d->curY(m_system)))){
-            if (m_whenCollidingWith.isEmpty() || isColliding(d)){
-                return true;
-            }
+    if (activeGroup(d->groupId))
+        return shouldAffectInGroup(d, affectedArea());
+    return false;
+
+}
+
+//For use in loops over an active group, with affectedArea() calculated once per frame
+bool QQuickParticleAffector::shouldAffectInGroup(QQuickParticleData* d, const QRectF &area)
+{
+    if ((m_onceOff && m_onceOffed.contains(qMakePair(d->groupId, d->index)))
+            || !d->stillAlive(m_system))
+        return false;
+    //Need to have previous location for affected anyways
+    if (area.width() == 0 || area.height() == 0
+            || m_shape->contains(area, QPointF(d->curX(m_system), d->curY(m_system)))){
+        if (m_whenCollidingWith.isEmpty() || isColliding(d)){
+            return true;
         }
     }
     return false;
-
 }
 
 void QQuickParticleAffector::postAffect(QQuickParticleData* d)
 {
-    m_system->needsReset << d;
+    postAffect(d, isAffectedConnected());
+}
+
+void QQuickParticleAffector::postAffect(QQuickParticleData* d, bool emitAffected)
+{
+    m_system->markNeedsReset(d);
     if (m_onceOff)
         m_onceOffed << qMakePair(d->groupId, d->index);
-    if (isAffectedConnected())
+    if (emitAffected)
         emit affected(d->curX(m_system), d->curY(m_system));
 }
 
@@ -197,10 +208,13 @@ void QQuickParticleAffector::affectSystem(qreal dt)
     updateOffsets();//### Needed if an ancestor is transformed.
     if (m_onceOff)
         dt = 1.0;
+    //Same for all particles in this frame, so not checked per particle
+    const QRectF area = affectedArea();
+    const bool emitAffected = isAffectedConnected();
     foreach (QQuickParticleGroupData* gd, m_system->groupData) {
         if (activeGroup(gd->index)) {
             foreach (QQuickParticleData* d, gd->data) {
-                if (shouldAffect(d)) {
+                if (d && shouldAffectInGroup(d, area)) {
                     bool affected = false;
                     qreal myDt = dt;
                     if (!m_ignoresTime && myDt < simulationCutoff) {
@@ -217,7 +231,7 @@ void QQuickParticleAffector::affectSystem(qreal dt)
                     if (myDt > 0.0)
                         affected = affectParticle(d, myDt) || affected;
                     if (affected)
-                        postAffect(d);
+                        postAffect(d, emitAffected);
                 }
             }
         }
@@ -188,6 +188,9 @@ protected:
     bool activeGroup(int g);
     bool shouldAffect(QQuickParticleData* datum);//Call to do the logic on whether it is affecting that datum
     void postAffect(QQuickParticleData* datum);//Call to do the post-affect logic on particles which WERE affected(once off, needs reset, affected signal)
+    QRectF affectedArea() const { return QRectF(m_offset.x(), m_offset.y(), width(), height()); }
+    bool shouldAffectInGroup(QQuickParticleData* datum, const QRectF &area);//As shouldAffect, for a datum of a group already known to be active
+    void postAffect(QQuickParticleData* datum, bool emitAffected);
     void componentComplete() override;
     bool isAffectedConnected();
     static const qreal simulationDelta;
@@ -427,6 +427,7 @@ QQuickParticleData::QQuickParticleData()
     , rotationOwner(nullptr)
     , deformationOwner(nullptr)
     , animationOwner(nullptr)
+    , queuedForReset(false)
     , v8Datum(nullptr)
 {
     x = 0;
@@ -470,6 +471,7 @@ QQuickParticleData::~QQuickParticleData()
 }
 
 QQuickParticleData::QQuickParticleData(const QQuickParticleData &other)
+    : queuedForReset(false)
 {
     *this = other;
 }
@@ -1059,7 +1061,6 @@ void QQuickParticleSystem::updateCurrentTime( int currentTime )
     timeInt = currentTime;
     qreal time =  timeInt / 1000.;
     dt = time - dt;
-    needsReset.clear();
 
     m_emitters.removeAll(nullptr);
     m_painters.removeAll(nullptr);
@@ -1077,9 +1078,12 @@ void QQuickParticleSystem::updateCurrentTime( int currentTime )
         emitter->emitWindow(timeInt);
     foreach (QQuickParticleAffector* a, m_affectors)
         a->affectSystem(dt);
-    foreach (QQuickParticleData* d, needsReset)
+    for (QQuickParticleData* d : qAsConst(needsReset)) {
+        d->queuedForReset = false;
         foreach (QQuickParticlePainter* p, groupData[d->groupId]->painters)
             p->reload(d);
+    }
+    needsReset.clear();
 
     if (oldClear != m_empty)
         emptyChanged(m_empty);
@@ -326,7 +326,10 @@ public:
     //Used by CustomParticle
     float r;
 
-    // 4 bytes wasted
+    //Set while the datum is in QQuickParticleSystem::needsReset, instead of hashing it every frame
+    bool queuedForReset;
+
+    // 3 bytes wasted
 
 
     void debugDump(QQuickParticleSystem *particleSystem) const;
@@ -408,8 +411,17 @@ public:
     //This one only once per painter per frame
     int systemSync(QQuickParticlePainter* p);
 
+    //Called by affectors, many times per frame
+    void markNeedsReset(QQuickParticleData* d)
+    {
+        if (!d->queuedForReset) {
+            d->queuedForReset = true;
+            needsReset << d;
+        }
+    }
+
     //Data members here for ease of related class and auto-test usage. Not "public" API. TODO: d_ptrize
-    QSet<QQuickParticleData*> needsReset;
+    QVector<QQuickParticleData*> needsReset;
     QVector<QQuickParticleData*> bySysIdx; //Another reference to the data (data owned by group), but by sysIdx
     QQuickStochasticEngine* stateEngine;
 
@@ -180,11 +180,13 @@ void QQuickTurbulenceAffector::affectSystem(qreal dt)
     updateOffsets();//### Needed if an ancestor is transformed.
 
     QRect boundsRect(0,0,m_gridSize,m_gridSize);
+    const QRectF area = affectedArea();
+    const bool emitAffected = isAffectedConnected();
     foreach (QQuickParticleGroupData *gd, m_system->groupData){
         if (!activeGroup(gd->index))
             continue;
         foreach (QQuickParticleData *d, gd->data){
-            if (!shouldAffect(d))
+            if (!d || !shouldAffectInGroup(d, area))
                 continue;
             QPoint pos = (QPointF(d->curX(m_system), d->curY(m_system)) - m_offset).toPoint();
             if (!boundsRect.contains(pos,true))//Need to redo bounds checking due to quantization.
@@ -196,7 +198,7 @@ void QQuickTurbulenceAffector::affectSystem(qreal dt)
             if (fx || fy){
                 d->setInstantaneousVX(d->curVX(m_system)+ fx * dt, m_system);
                 d->setInstantaneousVY(d->curVY(m_system)+ fy * dt, m_system);
-                postAffect(d);
+                postAffect(d, emitAffected);
             }
         }
     }
@@ -32,5 +32,6 @@ HEADERS += \
     $$PWD/qv4alloca_p.h \
     $$PWD/qv4calldata_p.h \
     $$PWD/qv4compileddata_p.h \
+    $$PWD/qv4compileddatabundle_p.h \
     $$PWD/qv4staticvalue_p.h \
     $$PWD/qv4stringtoarrayindex_p.h
@@ -82,6 +82,10 @@ class QQmlTypeNameCache;
 class QQmlType;
 class QQmlEngine;
 
+namespace QQmlPrivate {
+struct AOTCompiledFunction;
+}
+
 namespace QmlIR {
 struct Document;
 }
@@ -1212,8 +1216,12 @@ struct CompilationUnit : public CompilationUnitBase
 public:
     using CompiledObject = CompiledData::Object;
 
+    const QQmlPrivate::AOTCompiledFunction *aotCompiledFunctions = nullptr;
+
     CompilationUnit(const Unit *unitData = nullptr, const QString &fileName = QString(),
-                    const QString &finalUrlString = QString())
+                    const QString &finalUrlString = QString(),
+                    const QQmlPrivate::AOTCompiledFunction *aotCompiledFunctions = nullptr)
+        : aotCompiledFunctions(aotCompiledFunctions)
     {
         setUnitData(unitData, nullptr, fileName, finalUrlString);
     }
@@ -1252,6 +1260,8 @@ public:
             other.qmlData = nullptr;
             dynamicStrings = std::move(other.dynamicStrings);
             other.dynamicStrings.clear();
+            aotCompiledFunctions = other.aotCompiledFunctions;
+            other.aotCompiledFunctions = nullptr;
             m_fileName = std::move(other.m_fileName);
             other.m_fileName.clear();
             m_finalUrlString = std::move(other.m_finalUrlString);
@@ -0,0 +1,208 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QV4COMPILEDDATABUNDLE_P_H
+#define QV4COMPILEDDATABUNDLE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qv4compileddata_p.h>
+
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qmap.h>
+
+#include <cstring>
+
+QT_BEGIN_NAMESPACE
+
+namespace QV4 {
+namespace CompiledData {
+
+// A bundle is a single file holding many pre-compiled units, each keyed by the
+// resource path of its source and a checksum of the source contents. It is
+// meant to be memory mapped read-only, so the units are stored with the
+// StaticData flag and aligned like the individual cache files.
+
+static const char bundle_magic_str[] = "qv4cbndl";
+
+enum { BundleVersion = 1, BundleUnitAlignment = 16 };
+
+struct BundleHeader
+{
+    char magic[8];
+    quint32_le version;
+    quint32_le entryCount;
+    quint32_le offsetToEntries;
+    quint32_le bundleSize;
+};
+static_assert(sizeof(BundleHeader) == 24, "BundleHeader structure needs to have the expected size to be binary compatible on disk when generated by host compiler and loaded by target");
+
+// Entries are sorted by their UTF-8 encoded path.
+struct BundleEntry
+{
+    quint32_le offsetToPath;
+    quint32_le pathLength;
+    quint32_le offsetToUnit;
+    quint32_le unitSize;
+    char sourceChecksum[16];
+};
+static_assert(sizeof(BundleEntry) == 32, "BundleEntry structure needs to have the expected size to be binary compatible on disk when generated by host compiler and loaded by target");
+
+inline QByteArray bundleSourceChecksum(const QByteArray &source)
+{
+    return QCryptographicHash::hash(source, QCryptographicHash::Md5);
+}
+
+class BundleWriter
+{
+public:
+    // Adds the unit in \a unitData, which has the same layout as a cache file,
+    // for the source at \a resourcePath. An existing unit for the same path is
+    // replaced.
+    bool addUnit(const QString &resourcePath, const QByteArray &source, const QByteArray &unitData,
+                 QString *errorString)
+    {
+        if (unitData.size() < int(sizeof(Unit))
+                || memcmp(unitData.constData(), magic_str, sizeof(Unit::magic)) != 0) {
+            *errorString = QStringLiteral("%1 is not a compilation unit").arg(resourcePath);
+            return false;
+        }
+        const Unit *unit = reinterpret_cast<const Unit *>(unitData.constData());
+        if (unit->unitSize > quint32(unitData.size())) {
+            *errorString = QStringLiteral("Compilation unit for %1 is truncated").arg(resourcePath);
+            return false;
+        }
+
+        Entry &entry = m_entries[resourcePath.toUtf8()];
+        entry.sourceChecksum = bundleSourceChecksum(source);
+        entry.unitData = unitData.left(int(unit->unitSize));
+        return true;
+    }
+
+    QByteArray data() const
+    {
+        const quint32 offsetToEntries = sizeof(BundleHeader);
+        quint32 offsetToPaths = offsetToEntries + quint32(m_entries.size() * sizeof(BundleEntry));
+
+        quint32 offset = offsetToPaths;
+        for (auto it = m_entries.cbegin(), end = m_entries.cend(); it != end; ++it)
+            offset += quint32(it.key().size());
+
+        QByteArray result(int(offset), Qt::Uninitialized);
+        QVector<BundleEntry> entries;
+        entries.reserve(m_entries.size());
+
+        quint32 pathOffset = offsetToPaths;
+        for (auto it = m_entries.cbegin(), end = m_entries.cend(); it != end; ++it) {
+            offset = align(offset);
+            BundleEntry entry;
+            entry.offsetToPath = pathOffset;
+            entry.pathLength = quint32(it.key().size());
+            entry.offsetToUnit = offset;
+            entry.unitSize = quint32(it->unitData.size());
+            memcpy(entry.sourceChecksum, it->sourceChecksum.constData(), sizeof(entry.sourceChecksum));
+            entries.append(entry);
+
+            memcpy(result.data() + pathOffset, it.key().constData(), size_t(it.key().size()));
+            pathOffset += entry.pathLength;
+            offset += entry.unitSize;
+        }
+
+        const int pathsEnd = result.size();
+        result.resize(int(offset));
+        memset(result.data() + pathsEnd, 0, size_t(result.size() - pathsEnd));
+
+        int i = 0;
+        for (auto it = m_entries.cbegin(), end = m_entries.cend(); it != end; ++it, ++i) {
+            char *unit = result.data() + entries.at(i).offsetToUnit;
+            memcpy(unit, it->unitData.constData(), size_t(it->unitData.size()));
+            // The mapped units are never freed, so they are static data just like
+            // the ones in the individual cache files.
+            reinterpret_cast<Unit *>(unit)->flags |= Unit::StaticData;
+        }
+
+        BundleHeader header;
+        memcpy(header.magic, bundle_magic_str, sizeof(header.magic));
+        header.version = BundleVersion;
+        header.entryCount = quint32(entries.size());
+        header.offsetToEntries = offsetToEntries;
+        header.bundleSize = quint32(result.size());
+        memcpy(result.data(), &header, sizeof(header));
+        memcpy(result.data() + offsetToEntries, entries.constData(),
+               size_t(entries.size()) * sizeof(BundleEntry));
+        return result;
+    }
+
+    bool writeToFile(const QString &outputFileName, QString *errorString) const
+    {
+        const QByteArray bundle = data();
+        return SaveableUnitPointer::writeDataToFile(outputFileName, bundle.constData(),
+                                                    quint32(bundle.size()), errorString);
+    }
+
+private:
+    static quint32 align(quint32 offset)
+    {
+        return (offset + BundleUnitAlignment - 1) & ~quint32(BundleUnitAlignment - 1);
+    }
+
+    struct Entry
+    {
+        QByteArray sourceChecksum;
+        QByteArray unitData;
+    };
+    // QMap keeps the paths sorted the way the reader expects.
+    QMap<QByteArray, Entry> m_entries;
+};
+
+} // CompiledData namespace
+} // QV4 namespace
+
+QT_END_NAMESPACE
+
+#endif // QV4COMPILEDDATABUNDLE_P_H
@@ -488,6 +488,37 @@ bool QJSEngine::isInterrupted() const
     return m_v4Engine->isInterrupted.loadAcquire();
 }
 
+/*!
+  \since 5.16
+  Enables or disables just-in-time compilation of JavaScript for this engine.
+
+  Functions are always interpreted first. When the JIT is enabled, a function
+  is compiled to native code once it has been called often enough; the
+  threshold can be tuned with the \c QV4_JIT_CALL_THRESHOLD environment
+  variable. Disabling the JIT only affects functions that have not been
+  compiled yet. The JIT is enabled by default.
+
+  This setting has no effect if Qt was built without the \c qml-jit feature, or
+  if the platform does not allow executable memory to be allocated.
+
+  \sa isJitEnabled()
+*/
+void QJSEngine::setJitEnabled(bool enabled)
+{
+    m_v4Engine->setJitEnabled(enabled);
+}
+
+/*!
+  \since 5.16
+  Returns whether just-in-time compilation is enabled for this engine.
+
+  \sa setJitEnabled()
+*/
+bool QJSEngine::isJitEnabled() const
+{
+    return m_v4Engine->isJitEnabled();
+}
+
 static QUrl urlForFileName(const QString &fileName)
 {
     if (!fileName.startsWith(QLatin1Char(':')))
@@ -117,6 +117,9 @@ public:
     void setInterrupted(bool interrupted);
     bool isInterrupted() const;
 
+    void setJitEnabled(bool enabled);
+    bool isJitEnabled() const;
+
     QV4::ExecutionEngine *handle() const { return m_v4Engine; }
 
     void throwError(const QString &message);
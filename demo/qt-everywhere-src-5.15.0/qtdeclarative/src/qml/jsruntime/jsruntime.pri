@@ -61,6 +61,7 @@ SOURCES += \
     $$PWD/qv4runtime.cpp \
     $$PWD/qv4value.cpp \
     $$PWD/qv4compilationunitmapper.cpp \
+    $$PWD/qv4compilationunitbundle.cpp \
     $$PWD/qv4executablecompilationunit.cpp \
     $$PWD/qv4executableallocator.cpp
 
@@ -136,6 +137,7 @@ HEADERS += \
     $$PWD/qv4runtime_p.h \
     $$PWD/qv4value_p.h \
     $$PWD/qv4compilationunitmapper_p.h \
+    $$PWD/qv4compilationunitbundle_p.h \
     $$PWD/qv4executablecompilationunit_p.h \
     $$PWD/qv4functiontable_p.h \
     $$PWD/qv4runtimeapi_p.h
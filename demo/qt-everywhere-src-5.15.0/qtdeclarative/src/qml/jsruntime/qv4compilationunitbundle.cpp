@@ -0,0 +1,292 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qv4compilationunitbundle_p.h"
+
+#include <private/qv4compileddatabundle_p.h>
+#include <private/qqmlmetatype_p.h>
+
+#include <QtCore/qdir.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qresource.h>
+#include <QtCore/qurl.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(DBG_DISK_CACHE)
+
+using namespace QV4;
+
+namespace {
+struct BundleRegistry
+{
+    QMutex mutex;
+    std::vector<std::unique_ptr<CompilationUnitBundle>> bundles;
+    bool hookRegistered = false;
+};
+}
+
+Q_GLOBAL_STATIC(BundleRegistry, bundleRegistry)
+
+CompilationUnitBundle::CompilationUnitBundle() = default;
+
+CompilationUnitBundle::~CompilationUnitBundle()
+{
+    close();
+}
+
+bool CompilationUnitBundle::open(const QString &bundleFilePath, QString *errorString)
+{
+    close();
+
+    m_file.setFileName(bundleFilePath);
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        *errorString = m_file.errorString();
+        return false;
+    }
+
+    const qint64 size = m_file.size();
+    if (size < qint64(sizeof(CompiledData::BundleHeader))) {
+        *errorString = QStringLiteral("File too small for the header fields");
+        close();
+        return false;
+    }
+
+    // Map the file read-only and shared, so that processes using the same
+    // bundle share its pages.
+    const uchar *data = m_file.map(0, size);
+    if (!data) {
+        *errorString = m_file.errorString();
+        close();
+        return false;
+    }
+
+    const auto *header = reinterpret_cast<const CompiledData::BundleHeader *>(data);
+    if (memcmp(header->magic, CompiledData::bundle_magic_str, sizeof(header->magic)) != 0) {
+        *errorString = QStringLiteral("Magic bytes in the header do not match");
+        close();
+        return false;
+    }
+
+    if (header->version != quint32(CompiledData::BundleVersion)) {
+        *errorString = QString::fromUtf8("Bundle version mismatch. Found %1 expected %2")
+                .arg(header->version).arg(CompiledData::BundleVersion);
+        close();
+        return false;
+    }
+
+    if (header->bundleSize != quint64(size)
+            || header->offsetToEntries > header->bundleSize
+            || header->entryCount > (header->bundleSize - header->offsetToEntries)
+                                    / sizeof(CompiledData::BundleEntry)) {
+        *errorString = QStringLiteral("Bundle is truncated");
+        close();
+        return false;
+    }
+
+    m_data = data;
+    m_cachedUnits.reserve(int(header->entryCount));
+    for (quint32 i = 0; i < header->entryCount; ++i) {
+        const CompiledData::BundleEntry *e = entry(int(i));
+        if (e->offsetToPath > header->bundleSize
+                || e->pathLength > header->bundleSize - e->offsetToPath
+                || e->offsetToUnit > header->bundleSize
+                || e->unitSize > header->bundleSize - e->offsetToUnit
+                || e->unitSize < sizeof(CompiledData::Unit)
+                || e->offsetToUnit % CompiledData::BundleUnitAlignment != 0) {
+            *errorString = QStringLiteral("Bundle entry %1 is out of bounds").arg(i);
+            close();
+            return false;
+        }
+
+        const auto *unit = reinterpret_cast<const CompiledData::Unit *>(m_data + e->offsetToUnit);
+        if (unit->unitSize != e->unitSize || !(unit->flags & CompiledData::Unit::StaticData)) {
+            *errorString = QStringLiteral("Bundle entry %1 does not hold a valid unit").arg(i);
+            close();
+            return false;
+        }
+
+        m_cachedUnits.append({ unit, nullptr, nullptr });
+    }
+
+    return true;
+}
+
+void CompilationUnitBundle::close()
+{
+    // The units are static data, so QString instances may still point into them.
+    // Only unregistered bundles are ever closed, and nobody got a unit out of those.
+    m_cachedUnits.clear();
+    m_data = nullptr;
+    m_file.close();
+}
+
+const CompiledData::BundleEntry *CompilationUnitBundle::entry(int index) const
+{
+    const auto *header = reinterpret_cast<const CompiledData::BundleHeader *>(m_data);
+    return reinterpret_cast<const CompiledData::BundleEntry *>(m_data + header->offsetToEntries)
+            + index;
+}
+
+int CompilationUnitBundle::indexOf(const QByteArray &path) const
+{
+    int begin = 0;
+    int end = m_cachedUnits.size();
+    while (begin < end) {
+        const int middle = begin + (end - begin) / 2;
+        const CompiledData::BundleEntry *e = entry(middle);
+        const QByteArray entryPath = QByteArray::fromRawData(
+                reinterpret_cast<const char *>(m_data + e->offsetToPath), int(e->pathLength));
+        if (entryPath == path)
+            return middle;
+        if (entryPath < path)
+            begin = middle + 1;
+        else
+            end = middle;
+    }
+    return -1;
+}
+
+const CompiledData::Unit *CompilationUnitBundle::unit(const QString &resourcePath,
+                                                      const QByteArray &sourceChecksum) const
+{
+    const int index = indexOf(resourcePath.toUtf8());
+    if (index < 0)
+        return nullptr;
+
+    if (!checksumMatches(index, sourceChecksum))
+        return nullptr;
+
+    return m_cachedUnits.at(index).qmlData;
+}
+
+bool CompilationUnitBundle::checksumMatches(int index, const QByteArray &sourceChecksum) const
+{
+    if (sourceChecksum.isEmpty())
+        return true;
+
+    const CompiledData::BundleEntry *e = entry(index);
+    return sourceChecksum.size() == int(sizeof(e->sourceChecksum))
+            && memcmp(sourceChecksum.constData(), e->sourceChecksum,
+                      sizeof(e->sourceChecksum)) == 0;
+}
+
+bool CompilationUnitBundle::registerBundle(const QString &bundleFilePath, QString *errorString)
+{
+    auto bundle = std::make_unique<CompilationUnitBundle>();
+    if (!bundle->open(bundleFilePath, errorString))
+        return false;
+
+    bool registerHook = false;
+    {
+        BundleRegistry *registry = bundleRegistry();
+        QMutexLocker locker(&registry->mutex);
+        registry->bundles.push_back(std::move(bundle));
+        registerHook = !registry->hookRegistered;
+        registry->hookRegistered = true;
+    }
+
+    // Units compiled into the application have already registered their hooks
+    // by now and keep taking precedence.
+    if (registerHook) {
+        QQmlPrivate::RegisterQmlUnitCacheHook hook = { 0, &lookupCachedQmlUnit };
+        QQmlMetaType::registerUnitCacheHook(hook);
+    }
+    return true;
+}
+
+void CompilationUnitBundle::registerBundlesFromEnvironment()
+{
+    static const bool registered = []() {
+        const QString paths = qEnvironmentVariable("QML_CACHE_BUNDLES");
+        for (const QString &path : paths.split(QDir::listSeparator(), Qt::SkipEmptyParts)) {
+            QString error;
+            if (!registerBundle(path, &error))
+                qWarning("Could not load QML cache bundle %s: %s", qPrintable(path), qPrintable(error));
+        }
+        return true;
+    }();
+    Q_UNUSED(registered);
+}
+
+const QQmlPrivate::CachedQmlUnit *CompilationUnitBundle::lookupCachedQmlUnit(const QUrl &url)
+{
+    if (url.scheme() != QLatin1String("qrc"))
+        return nullptr;
+
+    const QString path = url.path();
+    const QByteArray utf8Path = path.toUtf8();
+
+    BundleRegistry *registry = bundleRegistry();
+    QMutexLocker locker(&registry->mutex);
+
+    QByteArray sourceChecksum;
+    bool checksumComputed = false;
+    for (const auto &bundle : registry->bundles) {
+        const int index = bundle->indexOf(utf8Path);
+        if (index < 0)
+            continue;
+
+        // Compare against the source that is actually in the resources, so that
+        // a stale bundle never shadows changed QML. If the source was left out of
+        // the resources, the unit is all there is.
+        if (!checksumComputed) {
+            QResource resource(QLatin1Char(':') + path);
+            if (resource.isValid())
+                sourceChecksum = CompiledData::bundleSourceChecksum(resource.uncompressedData());
+            checksumComputed = true;
+        }
+
+        if (!bundle->checksumMatches(index, sourceChecksum)) {
+            qCDebug(DBG_DISK_CACHE) << "Source checksum mismatch for bundled unit" << url;
+            continue;
+        }
+
+        return &bundle->m_cachedUnits.at(index);
+    }
+
+    return nullptr;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,108 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QV4COMPILATIONUNITBUNDLE_P_H
+#define QV4COMPILATIONUNITBUNDLE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qv4global_p.h>
+#include <QtQml/qqmlprivate.h>
+#include <QFile>
+#include <QVector>
+
+QT_BEGIN_NAMESPACE
+
+namespace QV4 {
+
+namespace CompiledData {
+struct Unit;
+struct BundleEntry;
+}
+
+// Maps a bundle written by CompiledData::BundleWriter and hands out the units
+// in it. Registered bundles are consulted by the type loader for qrc URLs
+// before anything gets compiled, so applications that keep their QML in
+// resources do not pay for parsing and code generation on every start.
+class Q_QML_PRIVATE_EXPORT CompilationUnitBundle
+{
+    Q_DISABLE_COPY_MOVE(CompilationUnitBundle)
+public:
+    CompilationUnitBundle();
+    ~CompilationUnitBundle();
+
+    bool open(const QString &bundleFilePath, QString *errorString);
+    void close();
+
+    int count() const { return m_cachedUnits.size(); }
+
+    // Returns the unit for \a resourcePath if its source checksum matches
+    // \a sourceChecksum. An empty \a sourceChecksum matches any unit and is
+    // meant for sources that are not available anymore.
+    const CompiledData::Unit *unit(const QString &resourcePath,
+                                   const QByteArray &sourceChecksum) const;
+
+    static bool registerBundle(const QString &bundleFilePath, QString *errorString);
+    static void registerBundlesFromEnvironment();
+    static const QQmlPrivate::CachedQmlUnit *lookupCachedQmlUnit(const QUrl &url);
+
+private:
+    int indexOf(const QByteArray &path) const;
+    bool checksumMatches(int index, const QByteArray &sourceChecksum) const;
+    const CompiledData::BundleEntry *entry(int index) const;
+
+    QFile m_file;
+    const uchar *m_data = nullptr;
+    QVector<QQmlPrivate::CachedQmlUnit> m_cachedUnits;
+};
+
+}
+
+QT_END_NAMESPACE
+
+#endif // QV4COMPILATIONUNITBUNDLE_P_H
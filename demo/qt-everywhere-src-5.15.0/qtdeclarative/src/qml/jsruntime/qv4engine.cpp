@@ -1882,9 +1882,10 @@ ReturnedValue ExecutionEngine::global()
 QQmlRefPointer<ExecutableCompilationUnit> ExecutionEngine::compileModule(const QUrl &url)
 {
     QQmlMetaType::CachedUnitLookupError cacheError = QQmlMetaType::CachedUnitLookupError::NoError;
-    if (const QV4::CompiledData::Unit *cachedUnit = QQmlMetaType::findCachedCompilationUnit(url, &cacheError)) {
+    if (const QQmlPrivate::CachedQmlUnit *cachedUnit = QQmlMetaType::findCachedCompilationUnit(url, &cacheError)) {
         return ExecutableCompilationUnit::create(
-                    QV4::CompiledData::CompilationUnit(cachedUnit, url.fileName(), url.toString()));
+                    QV4::CompiledData::CompilationUnit(cachedUnit->qmlData, url.fileName(), url.toString(),
+                                                       cachedUnit->aotCompiledFunctions));
     }
 
     QFile f(QQmlFile::urlToLocalFileOrQrc(url));
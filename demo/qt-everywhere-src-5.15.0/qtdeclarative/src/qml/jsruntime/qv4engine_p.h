@@ -656,10 +656,13 @@ public:
 
     bool checkStackLimits();
 
+    bool isJitEnabled() const { return m_jitEnabled; }
+    void setJitEnabled(bool enabled) { m_jitEnabled = enabled; }
+
     bool canJIT(Function *f = nullptr)
     {
 #if QT_CONFIG(qml_jit)
-        if (!m_canAllocateExecutableMemory)
+        if (!m_canAllocateExecutableMemory || !m_jitEnabled)
             return false;
         if (f)
             return !f->isGenerator() && f->interpreterCallCount >= jitCallCountThreshold;
@@ -729,6 +732,7 @@ private:
 #endif
     QSet<QString> m_illegalNames;
     int jitCallCountThreshold;
+    bool m_jitEnabled = true;
 
     // used by generated Promise objects to handle 'then' events
     QScopedPointer<QV4::Promise::ReactionHandler> m_reactionHandler;
@@ -84,7 +84,9 @@ struct Q_QML_EXPORT EngineBase {
 #endif
 
     quint8 isExecutingInRegExpJIT = false;
-    quint8 padding[3];
+    // set while an incremental GC cycle is marking; checked by the write barrier
+    quint8 isGCMarking = false;
+    quint8 padding[2];
     MemoryManager *memoryManager = nullptr;
 
     qint32 callDepth = 0;
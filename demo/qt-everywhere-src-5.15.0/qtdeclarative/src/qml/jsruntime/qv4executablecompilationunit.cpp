@@ -56,6 +56,7 @@
 #include <private/inlinecomponentutils_p.h>
 
 #include <QtQml/qqmlfile.h>
+#include <QtQml/qqmlprivate.h>
 #include <QtQml/qqmlpropertymap.h>
 
 #include <QtCore/qdir.h>
@@ -212,6 +213,17 @@ QV4::Function *ExecutableCompilationUnit::linkToEngine(ExecutionEngine *engine)
         runtimeFunctions[i] = QV4::Function::create(engine, this, compiledFunction);
     }
 
+    if (aotCompiledFunctions) {
+        for (const QQmlPrivate::AOTCompiledFunction *aotFunction = aotCompiledFunctions;
+             aotFunction->functionPtr; ++aotFunction) {
+            if (aotFunction->index < 0 || aotFunction->index >= runtimeFunctions.size())
+                continue;
+            QV4::Function *function = runtimeFunctions[aotFunction->index];
+            if (function->nFormals == 0)
+                function->aotFunction = aotFunction;
+        }
+    }
+
     Scope scope(engine);
     Scoped<InternalClass> ic(scope);
 
@@ -313,6 +325,9 @@ void ExecutableCompilationUnit::unlink()
                 if (QQmlPropertyCache *pc = l.qobjectLookup.propertyCache)
                     pc->release();
             }
+
+            if (l.hasPolymorphicCache())
+                l.releasePolymorphicCache(this);
         }
     }
 
@@ -158,6 +158,12 @@ public:
     // lookups by string (property name).
     QVector<BindingPropertyData> bindingPropertyDataPerObject;
 
+    // Values of literal bindings that have to be converted from their string form
+    // (colors, dates, geometry, enums), keyed by binding. They are converted once
+    // on the type loader thread when the bindings are validated, so that object
+    // creation only needs to write them.
+    QHash<const CompiledData::Binding *, QVariant> convertedBindingValues;
+
     // mapping from component object index (CompiledData::Unit object index that points to component) to identifier hash of named objects
     // this is initialized on-demand by QQmlContextData
     QHash<int, IdentifierHash> namedObjectsPerComponentCache;
@@ -49,7 +49,9 @@
 #include <private/qv4functiontable_p.h>
 #include <assembler/MacroAssemblerCodeRef.h>
 #include <private/qv4vme_moth_p.h>
+#include <private/qv4qmlcontext_p.h>
 #include <private/qqmlglobal_p.h>
+#include <QtQml/qqmlprivate.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -57,6 +59,9 @@ using namespace QV4;
 
 ReturnedValue Function::call(const Value *thisObject, const Value *argv, int argc, const ExecutionContext *context) {
     ExecutionEngine *engine = context->engine();
+    if (aotFunction && context->d()->type == Heap::ExecutionContext::Type_QmlContext && !engine->debugger())
+        return callAotFunction(context);
+
     CppStackFrame frame;
     frame.init(engine, this, argv, argc);
     frame.setupJSFrame(engine->jsStackTop, Value::undefinedValue(), context->d(),
@@ -73,6 +78,28 @@ ReturnedValue Function::call(const Value *thisObject, const Value *argv, int arg
     return result;
 }
 
+ReturnedValue Function::callAotFunction(const ExecutionContext *context)
+{
+    Q_ASSERT(aotFunction);
+    ExecutionEngine *engine = context->engine();
+    Heap::QQmlContextWrapper *qml = static_cast<Heap::QmlContext *>(context->d())->qml();
+
+    QQmlPrivate::AOTCompiledContext aotContext;
+    aotContext.qmlContext = *qml->context;
+    aotContext.qmlScopeObject = qml->scopeObject;
+    aotContext.engine = engine->jsEngine();
+    aotContext.compilationUnit = executableCompilationUnit();
+
+    if (aotFunction->returnType == QMetaType::Void) {
+        aotFunction->functionPtr(&aotContext, nullptr);
+        return Encode::undefined();
+    }
+
+    QVariant result(aotFunction->returnType, nullptr);
+    aotFunction->functionPtr(&aotContext, result.data());
+    return engine->metaTypeToJS(aotFunction->returnType, result.constData());
+}
+
 Function *Function::create(ExecutionEngine *engine, ExecutableCompilationUnit *unit,
                            const CompiledData::Function *function)
 {
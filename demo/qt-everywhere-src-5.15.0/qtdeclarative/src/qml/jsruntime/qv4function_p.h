@@ -63,6 +63,10 @@ QT_BEGIN_NAMESPACE
 
 struct QQmlSourceLocation;
 
+namespace QQmlPrivate {
+struct AOTCompiledFunction;
+}
+
 namespace QV4 {
 
 struct Q_QML_EXPORT FunctionData {
@@ -100,6 +104,7 @@ public:
     }
 
     ReturnedValue call(const Value *thisObject, const Value *argv, int argc, const ExecutionContext *context);
+    ReturnedValue callAotFunction(const ExecutionContext *context);
 
     const char *codeData;
 
@@ -113,6 +118,10 @@ public:
     int interpreterCallCount = 0;
     bool isEval = false;
 
+    // Set if the function was compiled to C++ ahead of time. Used in place of the
+    // byte code when called from a QML context.
+    const QQmlPrivate::AOTCompiledFunction *aotFunction = nullptr;
+
     static Function *create(ExecutionEngine *engine, ExecutableCompilationUnit *unit,
                             const CompiledData::Function *function);
     void destroy();
@@ -41,11 +41,120 @@
 #include "qv4jscall_p.h"
 #include "qv4string_p.h"
 #include <private/qv4identifiertable_p.h>
+#include <private/qv4executablecompilationunit_p.h>
+#include <QtCore/qloggingcategory.h>
 
 QT_BEGIN_NAMESPACE
 
+Q_LOGGING_CATEGORY(lcLookupStats, "qt.qml.lookup.statistics")
+
 using namespace QV4;
 
+bool PolymorphicLookup::addEntry(quintptr key, const Value *data, uint offset, Kind kind)
+{
+    if (count == MaxEntries)
+        return false;
+    entries[count++] = { key, data, offset, kind };
+    return true;
+}
+
+bool PolymorphicLookup::addEntry(const Lookup &l)
+{
+    if (l.getter == Lookup::getter0Inline)
+        return addEntry(quintptr(l.objectLookup.ic), nullptr, l.objectLookup.offset, Inline);
+    if (l.getter == Lookup::getter0MemberData)
+        return addEntry(quintptr(l.objectLookup.ic), nullptr, l.objectLookup.offset, MemberData);
+    if (l.getter == Lookup::getterAccessor)
+        return addEntry(quintptr(l.objectLookup.ic), nullptr, l.objectLookup.offset, Accessor);
+    if (l.getter == Lookup::getterProto)
+        return addEntry(l.protoLookup.protoId, l.protoLookup.data, 0, Proto);
+    if (l.getter == Lookup::getterProtoAccessor)
+        return addEntry(l.protoLookup.protoId, l.protoLookup.data, 0, ProtoAccessor);
+    if (l.setter == Lookup::setter0Inline || l.setter == Lookup::setter0MemberData)
+        return addEntry(quintptr(l.objectLookup.ic), nullptr, l.objectLookup.index, Property);
+    return false;
+}
+
+void PolymorphicLookup::markObjects(MarkStack *stack)
+{
+    for (uint i = 0; i < count; ++i) {
+        if (entries[i].kind != Proto && entries[i].kind != ProtoAccessor)
+            reinterpret_cast<Heap::InternalClass *>(entries[i].key)->mark(stack);
+    }
+}
+
+// Adds the shapes a monomorphic or two class lookup has cached so far.
+static bool addCachedShapes(PolymorphicLookup *p, const Lookup &l)
+{
+    typedef PolymorphicLookup P;
+    const auto &o = l.objectLookupTwoClasses;
+    const auto &proto = l.protoLookupTwoClasses;
+    if (l.getter == Lookup::getter0Inlinegetter0Inline)
+        return p->addEntry(quintptr(o.ic), nullptr, o.offset, P::Inline)
+                && p->addEntry(quintptr(o.ic2), nullptr, o.offset2, P::Inline);
+    if (l.getter == Lookup::getter0Inlinegetter0MemberData)
+        return p->addEntry(quintptr(o.ic), nullptr, o.offset, P::Inline)
+                && p->addEntry(quintptr(o.ic2), nullptr, o.offset2, P::MemberData);
+    if (l.getter == Lookup::getter0MemberDatagetter0MemberData)
+        return p->addEntry(quintptr(o.ic), nullptr, o.offset, P::MemberData)
+                && p->addEntry(quintptr(o.ic2), nullptr, o.offset2, P::MemberData);
+    if (l.getter == Lookup::getterProtoTwoClasses)
+        return p->addEntry(proto.protoId, proto.data, 0, P::Proto)
+                && p->addEntry(proto.protoId2, proto.data2, 0, P::Proto);
+    if (l.getter == Lookup::getterProtoAccessorTwoClasses)
+        return p->addEntry(proto.protoId, proto.data, 0, P::ProtoAccessor)
+                && p->addEntry(proto.protoId2, proto.data2, 0, P::ProtoAccessor);
+    if (l.setter == Lookup::setter0setter0)
+        return p->addEntry(quintptr(o.ic), nullptr, o.offset, P::Property)
+                && p->addEntry(quintptr(o.ic2), nullptr, o.offset2, P::Property);
+    return p->addEntry(l);
+}
+
+static PolymorphicLookup *createPolymorphicLookup(Lookup *l, ExecutionEngine *engine)
+{
+    PolymorphicLookup *p = new PolymorphicLookup;
+    if (!addCachedShapes(p, *l)) {
+        delete p;
+        return nullptr;
+    }
+    p->line = engine->currentStackFrame->lineNumber();
+    l->clear();
+    l->polymorphicLookup.cache = p;
+    return p;
+}
+
+static void reportMegamorphic(const Lookup *l, ExecutionEngine *engine)
+{
+    if (!lcLookupStats().isDebugEnabled())
+        return;
+    const CppStackFrame *frame = engine->currentStackFrame;
+    qCDebug(lcLookupStats).nospace()
+            << "Lookup of '" << frame->v4Function->compilationUnit->runtimeStrings[l->nameIndex]->toQString()
+            << "' at " << frame->source() << ':' << l->polymorphicLookup.cache->line
+            << " became megamorphic";
+}
+
+static ReturnedValue callGetter(ExecutionEngine *engine, const Value *getter, const Value &thisObject)
+{
+    if (!getter->isFunctionObject()) // ### catch at resolve time
+        return Encode::undefined();
+
+    return checkedResult(engine, static_cast<const FunctionObject *>(getter)->call(
+                             &thisObject, nullptr, 0));
+}
+
+void Lookup::releasePolymorphicCache(const ExecutableCompilationUnit *unit)
+{
+    PolymorphicLookup *p = polymorphicLookup.cache;
+    qCDebug(lcLookupStats).nospace()
+            << "Lookup of '" << unit->stringAt(nameIndex) << "' at " << unit->fileName() << ':'
+            << p->line << ": " << p->count << " shapes, " << p->hits << " hits, " << p->misses
+            << " misses" << (getter == getterMegamorphic || setter == setterMegamorphic
+                             ? " (megamorphic)" : "");
+    delete p;
+    clear();
+}
+
 
 void Lookup::resolveProtoGetter(PropertyKey name, const Heap::Object *proto)
 {
@@ -185,6 +294,15 @@ ReturnedValue Lookup::getterTwoClasses(Lookup *l, ExecutionEngine *engine, const
             return result;
         }
 
+        if (PolymorphicLookup *p = createPolymorphicLookup(l, engine)) {
+            if (p->addEntry(second)) {
+                l->getter = getterPolymorphic;
+                return result;
+            }
+            l->getter = getterMegamorphic;
+            reportMegamorphic(l, engine);
+            return result;
+        }
     }
 
     l->getter = getterFallback;
@@ -248,8 +366,7 @@ ReturnedValue Lookup::getter0Inlinegetter0Inline(Lookup *l, ExecutionEngine *eng
         if (l->objectLookupTwoClasses.ic2 == o->internalClass)
             return o->inlinePropertyDataWithOffset(l->objectLookupTwoClasses.offset2)->asReturnedValue();
     }
-    l->getter = getterFallback;
-    return getterFallback(l, engine, object);
+    return getterToPolymorphic(l, engine, object);
 }
 
 ReturnedValue Lookup::getter0Inlinegetter0MemberData(Lookup *l, ExecutionEngine *engine, const Value &object)
@@ -263,8 +380,7 @@ ReturnedValue Lookup::getter0Inlinegetter0MemberData(Lookup *l, ExecutionEngine
         if (l->objectLookupTwoClasses.ic2 == o->internalClass)
             return o->memberData->values.data()[l->objectLookupTwoClasses.offset2].asReturnedValue();
     }
-    l->getter = getterFallback;
-    return getterFallback(l, engine, object);
+    return getterToPolymorphic(l, engine, object);
 }
 
 ReturnedValue Lookup::getter0MemberDatagetter0MemberData(Lookup *l, ExecutionEngine *engine, const Value &object)
@@ -278,8 +394,7 @@ ReturnedValue Lookup::getter0MemberDatagetter0MemberData(Lookup *l, ExecutionEng
         if (l->objectLookupTwoClasses.ic2 == o->internalClass)
             return o->memberData->values.data()[l->objectLookupTwoClasses.offset2].asReturnedValue();
     }
-    l->getter = getterFallback;
-    return getterFallback(l, engine, object);
+    return getterToPolymorphic(l, engine, object);
 }
 
 ReturnedValue Lookup::getterProtoTwoClasses(Lookup *l, ExecutionEngine *engine, const Value &object)
@@ -292,10 +407,8 @@ ReturnedValue Lookup::getterProtoTwoClasses(Lookup *l, ExecutionEngine *engine,
             return l->protoLookupTwoClasses.data->asReturnedValue();
         if (l->protoLookupTwoClasses.protoId2 == o->internalClass->protoId)
             return l->protoLookupTwoClasses.data2->asReturnedValue();
-        return getterFallback(l, engine, object);
     }
-    l->getter = getterFallback;
-    return getterFallback(l, engine, object);
+    return getterToPolymorphic(l, engine, object);
 }
 
 ReturnedValue Lookup::getterAccessor(Lookup *l, ExecutionEngine *engine, const Value &object)
@@ -313,8 +426,7 @@ ReturnedValue Lookup::getterAccessor(Lookup *l, ExecutionEngine *engine, const V
                                      &object, nullptr, 0));
         }
     }
-    l->getter = getterFallback;
-    return getterFallback(l, engine, object);
+    return getterTwoClasses(l, engine, object);
 }
 
 ReturnedValue Lookup::getterProtoAccessor(Lookup *l, ExecutionEngine *engine, const Value &object)
@@ -352,8 +464,7 @@ ReturnedValue Lookup::getterProtoAccessorTwoClasses(Lookup *l, ExecutionEngine *
                                      &object, nullptr, 0));
         }
     }
-    l->getter = getterFallback;
-    return getterFallback(l, engine, object);
+    return getterToPolymorphic(l, engine, object);
 }
 
 ReturnedValue Lookup::getterIndexed(Lookup *l, ExecutionEngine *engine, const Value &object)
@@ -374,6 +485,92 @@ ReturnedValue Lookup::getterIndexed(Lookup *l, ExecutionEngine *engine, const Va
 
 }
 
+ReturnedValue Lookup::getterToPolymorphic(Lookup *l, ExecutionEngine *engine, const Value &object)
+{
+    PolymorphicLookup *p = l->getter == getterPolymorphic ? l->polymorphicLookup.cache
+                                                          : createPolymorphicLookup(l, engine);
+    if (!p) {
+        l->getter = getterFallback;
+        return getterFallback(l, engine, object);
+    }
+    l->getter = getterPolymorphic;
+
+    // Only plain objects resolve to lookups we know how to cache here
+    const Object *o = object.as<Object>();
+    if (o && o->vtable()->resolveLookupGetter == Object::staticVTable()->resolveLookupGetter) {
+        Lookup resolved;
+        resolved.clear();
+        resolved.getter = getterGeneric;
+        resolved.nameIndex = l->nameIndex;
+        const ReturnedValue result = resolved.resolveGetter(engine, o);
+        if (!p->addEntry(resolved) && l->getter == getterPolymorphic) {
+            l->getter = getterMegamorphic;
+            reportMegamorphic(l, engine);
+        }
+        return result;
+    }
+
+    l->getter = getterMegamorphic;
+    reportMegamorphic(l, engine);
+    return getterFallback(l, engine, object);
+}
+
+ReturnedValue Lookup::getterPolymorphic(Lookup *l, ExecutionEngine *engine, const Value &object)
+{
+    PolymorphicLookup *p = l->polymorphicLookup.cache;
+    // we can safely cast to a QV4::Object here. If object is actually a string,
+    // the internal class won't match
+    Heap::Object *o = static_cast<Heap::Object *>(object.heapObject());
+    if (o) {
+        Heap::InternalClass *ic = o->internalClass;
+        for (uint i = 0; i < p->count; ++i) {
+            const PolymorphicLookup::Entry &e = p->entries[i];
+            switch (e.kind) {
+            case PolymorphicLookup::Inline:
+                if (e.key == quintptr(ic)) {
+                    ++p->hits;
+                    return o->inlinePropertyDataWithOffset(e.offset)->asReturnedValue();
+                }
+                break;
+            case PolymorphicLookup::MemberData:
+                if (e.key == quintptr(ic)) {
+                    ++p->hits;
+                    return o->memberData->values.data()[e.offset].asReturnedValue();
+                }
+                break;
+            case PolymorphicLookup::Accessor:
+                if (e.key == quintptr(ic)) {
+                    ++p->hits;
+                    return callGetter(engine, o->propertyData(e.offset), object);
+                }
+                break;
+            case PolymorphicLookup::Proto:
+                if (e.key == ic->protoId) {
+                    ++p->hits;
+                    return e.data->asReturnedValue();
+                }
+                break;
+            case PolymorphicLookup::ProtoAccessor:
+                if (e.key == ic->protoId) {
+                    ++p->hits;
+                    return callGetter(engine, e.data, object);
+                }
+                break;
+            case PolymorphicLookup::Property:
+                Q_UNREACHABLE();
+            }
+        }
+    }
+    ++p->misses;
+    return getterToPolymorphic(l, engine, object);
+}
+
+ReturnedValue Lookup::getterMegamorphic(Lookup *l, ExecutionEngine *engine, const Value &object)
+{
+    ++l->polymorphicLookup.cache->misses;
+    return getterFallback(l, engine, object);
+}
+
 ReturnedValue Lookup::primitiveGetterProto(Lookup *l, ExecutionEngine *engine, const Value &object)
 {
     if (object.type() == l->primitiveLookup.type && !object.isObject()) {
@@ -463,8 +660,7 @@ bool Lookup::setterGeneric(Lookup *l, ExecutionEngine *engine, Value &object, co
 
 bool Lookup::setterTwoClasses(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value)
 {
-    Lookup first = *l;
-    Lookup second = *l;
+    const Lookup first = *l;
 
     if (object.isObject()) {
         if (!l->resolveSetter(engine, static_cast<Object *>(&object), value)) {
@@ -473,6 +669,7 @@ bool Lookup::setterTwoClasses(Lookup *l, ExecutionEngine *engine, Value &object,
         }
 
         if (l->setter == Lookup::setter0MemberData || l->setter == Lookup::setter0Inline) {
+            const Lookup second = *l;
             l->objectLookupTwoClasses.ic = first.objectLookup.ic;
             l->objectLookupTwoClasses.ic2 = second.objectLookup.ic;
             l->objectLookupTwoClasses.offset = first.objectLookup.index;
@@ -533,7 +730,61 @@ bool Lookup::setter0setter0(Lookup *l, ExecutionEngine *engine, Value &object, c
         }
     }
 
-    l->setter = setterFallback;
+    return setterToPolymorphic(l, engine, object, value);
+}
+
+bool Lookup::setterToPolymorphic(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value)
+{
+    PolymorphicLookup *p = l->setter == setterPolymorphic ? l->polymorphicLookup.cache
+                                                          : createPolymorphicLookup(l, engine);
+    if (!p) {
+        l->setter = setterFallback;
+        return setterFallback(l, engine, object, value);
+    }
+    l->setter = setterPolymorphic;
+
+    // Only plain objects resolve to lookups we know how to cache here
+    Object *o = object.as<Object>();
+    if (o && o->vtable()->resolveLookupSetter == Object::staticVTable()->resolveLookupSetter) {
+        Lookup resolved;
+        resolved.clear();
+        resolved.setter = setterGeneric;
+        resolved.nameIndex = l->nameIndex;
+        const bool result = resolved.resolveSetter(engine, o, value);
+        if (!p->addEntry(resolved) && l->setter == setterPolymorphic) {
+            l->setter = setterMegamorphic;
+            reportMegamorphic(l, engine);
+        }
+        return result;
+    }
+
+    l->setter = setterMegamorphic;
+    reportMegamorphic(l, engine);
+    return setterFallback(l, engine, object, value);
+}
+
+bool Lookup::setterPolymorphic(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value)
+{
+    PolymorphicLookup *p = l->polymorphicLookup.cache;
+    Heap::Object *o = static_cast<Heap::Object *>(object.heapObject());
+    if (o) {
+        const quintptr ic = quintptr(o->internalClass.get());
+        for (uint i = 0; i < p->count; ++i) {
+            Q_ASSERT(p->entries[i].kind == PolymorphicLookup::Property);
+            if (p->entries[i].key == ic) {
+                ++p->hits;
+                o->setProperty(engine, p->entries[i].offset, value);
+                return true;
+            }
+        }
+    }
+    ++p->misses;
+    return setterToPolymorphic(l, engine, object, value);
+}
+
+bool Lookup::setterMegamorphic(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value)
+{
+    ++l->polymorphicLookup.cache->misses;
     return setterFallback(l, engine, object, value);
 }
 
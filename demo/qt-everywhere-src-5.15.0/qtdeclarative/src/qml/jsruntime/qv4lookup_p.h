@@ -61,6 +61,40 @@ QT_BEGIN_NAMESPACE
 
 namespace QV4 {
 
+class ExecutableCompilationUnit;
+
+// Out of line cache for lookup sites that have seen more than two shapes. Own properties are
+// matched by internal class, properties found on the prototype chain by protoId. The counters
+// are reported through qt.qml.lookup.statistics when the compilation unit goes away.
+struct PolymorphicLookup
+{
+    enum { MaxEntries = 4 };
+    enum Kind : quint8 {
+        Inline,
+        MemberData,
+        Accessor,
+        Proto,
+        ProtoAccessor,
+        Property // setters, offset is the property index
+    };
+    struct Entry {
+        quintptr key; // Heap::InternalClass * or protoId
+        const Value *data;
+        uint offset;
+        Kind kind;
+    };
+
+    Entry entries[MaxEntries];
+    uint count = 0;
+    int line = -1;
+    quint64 hits = 0;
+    quint64 misses = 0;
+
+    bool addEntry(quintptr key, const Value *data, uint offset, Kind kind);
+    bool addEntry(const Lookup &l);
+    void markObjects(MarkStack *stack);
+};
+
 struct Q_QML_PRIVATE_EXPORT Lookup {
     union {
         ReturnedValue (*getter)(Lookup *l, ExecutionEngine *engine, const Value &object);
@@ -112,6 +146,11 @@ struct Q_QML_PRIVATE_EXPORT Lookup {
             uint offset;
             uint unused;
         } insertionLookup;
+        struct {
+            quintptr unused;
+            quintptr unused2;
+            PolymorphicLookup *cache;
+        } polymorphicLookup;
         struct {
             quintptr _unused;
             quintptr _unused2;
@@ -187,6 +226,9 @@ struct Q_QML_PRIVATE_EXPORT Lookup {
     static ReturnedValue getterProtoAccessor(Lookup *l, ExecutionEngine *engine, const Value &object);
     static ReturnedValue getterProtoAccessorTwoClasses(Lookup *l, ExecutionEngine *engine, const Value &object);
     static ReturnedValue getterIndexed(Lookup *l, ExecutionEngine *engine, const Value &object);
+    static ReturnedValue getterToPolymorphic(Lookup *l, ExecutionEngine *engine, const Value &object);
+    static ReturnedValue getterPolymorphic(Lookup *l, ExecutionEngine *engine, const Value &object);
+    static ReturnedValue getterMegamorphic(Lookup *l, ExecutionEngine *engine, const Value &object);
 
     static ReturnedValue primitiveGetterProto(Lookup *l, ExecutionEngine *engine, const Value &object);
     static ReturnedValue primitiveGetterAccessor(Lookup *l, ExecutionEngine *engine, const Value &object);
@@ -203,10 +245,23 @@ struct Q_QML_PRIVATE_EXPORT Lookup {
     static bool setter0MemberData(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
     static bool setter0Inline(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
     static bool setter0setter0(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
+    static bool setterToPolymorphic(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
+    static bool setterPolymorphic(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
+    static bool setterMegamorphic(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
     static bool setterInsert(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
     static bool arrayLengthSetter(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
 
+    bool hasPolymorphicCache() const {
+        return getter == getterPolymorphic || getter == getterMegamorphic
+                || setter == setterPolymorphic || setter == setterMegamorphic;
+    }
+    void releasePolymorphicCache(const ExecutableCompilationUnit *unit);
+
     void markObjects(MarkStack *stack) {
+        if (hasPolymorphicCache()) {
+            polymorphicLookup.cache->markObjects(stack);
+            return;
+        }
         if (markDef.h1 && !(reinterpret_cast<quintptr>(markDef.h1) & 1))
             markDef.h1->mark(stack);
         if (markDef.h2 && !(reinterpret_cast<quintptr>(markDef.h2) & 1))
@@ -148,15 +148,30 @@ public:
 
     FunctionCall(const FunctionCall &other) :
         m_function(other.m_function), m_start(other.m_start), m_end(other.m_end)
-    { m_function->executableCompilationUnit()->addref(); }
+    {
+        if (m_function)
+            m_function->executableCompilationUnit()->addref();
+    }
+
+    // Moving saves the reference count traffic on the compilation unit, both
+    // when recording a call and when sorting the recorded calls.
+    FunctionCall(FunctionCall &&other) noexcept :
+        m_function(qExchange(other.m_function, nullptr)), m_start(other.m_start),
+        m_end(other.m_end)
+    {}
 
     ~FunctionCall()
-    { m_function->executableCompilationUnit()->release(); }
+    {
+        if (m_function)
+            m_function->executableCompilationUnit()->release();
+    }
 
     FunctionCall &operator=(const FunctionCall &other) {
         if (&other != this) {
-            other.m_function->executableCompilationUnit()->addref();
-            m_function->executableCompilationUnit()->release();
+            if (other.m_function)
+                other.m_function->executableCompilationUnit()->addref();
+            if (m_function)
+                m_function->executableCompilationUnit()->release();
             m_function = other.m_function;
             m_start = other.m_start;
             m_end = other.m_end;
@@ -164,6 +179,13 @@ public:
         return *this;
     }
 
+    FunctionCall &operator=(FunctionCall &&other) noexcept {
+        qSwap(m_function, other.m_function);
+        m_start = other.m_start;
+        m_end = other.m_end;
+        return *this;
+    }
+
     Function *function() const
     {
         return m_function;
@@ -55,11 +55,17 @@
 
 #include <QElapsedTimer>
 #include <QMap>
+#include <QMutex>
 #include <QScopedValueRollback>
+#include <QWaitCondition>
+#if QT_CONFIG(thread)
+#include <QThreadPool>
+#endif
 
 #include <iostream>
 #include <cstdlib>
 #include <algorithm>
+#include <atomic>
 #include "qv4profiling_p.h"
 #include "qv4mapobject_p.h"
 #include "qv4setobject_p.h"
@@ -304,16 +310,16 @@ static void increaseFreedCountForClass(const char *className)
 }
 
 //bool Chunk::sweep(ClassDestroyStatsCallback classCountPtr)
-bool Chunk::sweep(ExecutionEngine *engine)
+// With unmarkedDestroyed set, destroyUnmarked() has already run the destructors and only the
+// bitmaps are updated. engine can then be null, which allows sweeping from another thread.
+bool Chunk::sweep(ExecutionEngine *engine, bool unmarkedDestroyed)
 {
     bool hasUsedSlots = false;
     SDUMP() << "sweeping chunk" << this;
     HeapItem *o = realBase();
     bool lastSlotFree = false;
     for (uint i = 0; i < Chunk::EntriesInBitmap; ++i) {
-#if WRITEBARRIER(none)
         Q_ASSERT((grayBitmap[i] | blackBitmap[i]) == blackBitmap[i]); // check that we don't have gray only objects
-#endif
         quintptr toFree = objectBitmap[i] ^ blackBitmap[i];
         Q_ASSERT((toFree & objectBitmap[i]) == toFree); // check all black objects are marked as being used
         quintptr e = extendsBitmap[i];
@@ -341,21 +347,25 @@ bool Chunk::sweep(ExecutionEngine *engine)
             e &= result;
 
             HeapItem *itemToFree = o + index;
-            Heap::Base *b = *itemToFree;
-            const VTable *v = b->internalClass->vtable;
-//            if (Q_UNLIKELY(classCountPtr))
-//                classCountPtr(v->className);
-            if (v->destroy) {
-                v->destroy(b);
-                b->_checkIsDestroyed();
+            if (!unmarkedDestroyed) {
+                Heap::Base *b = *itemToFree;
+                const VTable *v = b->internalClass->vtable;
+//                if (Q_UNLIKELY(classCountPtr))
+//                    classCountPtr(v->className);
+                if (v->destroy) {
+                    v->destroy(b);
+                    b->_checkIsDestroyed();
+                }
             }
 #ifdef V4_USE_HEAPTRACK
             heaptrack_report_free(itemToFree);
 #endif
         }
-        Q_V4_PROFILE_DEALLOC(engine, qPopulationCount((objectBitmap[i] | extendsBitmap[i])
-                                                      - (blackBitmap[i] | e)) * Chunk::SlotSize,
-                             Profiling::SmallItem);
+        if (engine) {
+            Q_V4_PROFILE_DEALLOC(engine, qPopulationCount((objectBitmap[i] | extendsBitmap[i])
+                                                          - (blackBitmap[i] | e)) * Chunk::SlotSize,
+                                 Profiling::SmallItem);
+        }
         objectBitmap[i] = blackBitmap[i];
         grayBitmap[i] = 0;
         hasUsedSlots |= (blackBitmap[i] != 0);
@@ -370,6 +380,25 @@ bool Chunk::sweep(ExecutionEngine *engine)
     return hasUsedSlots;
 }
 
+void Chunk::destroyUnmarked()
+{
+    HeapItem *o = realBase();
+    for (uint i = 0; i < Chunk::EntriesInBitmap; ++i) {
+        quintptr toFree = objectBitmap[i] ^ blackBitmap[i];
+        while (toFree) {
+            uint index = qCountTrailingZeroBits(toFree);
+            toFree ^= (static_cast<quintptr>(1) << index);
+
+            Heap::Base *b = *(o + index);
+            if (const VTable::Destroy destroy = b->internalClass->vtable->destroy) {
+                destroy(b);
+                b->_checkIsDestroyed();
+            }
+        }
+        o += Chunk::Bits;
+    }
+}
+
 void Chunk::freeAll(ExecutionEngine *engine)
 {
     //    DEBUG << "sweeping chunk" << this << (*freeList);
@@ -424,9 +453,7 @@ void Chunk::collectGrayItems(MarkStack *markStack)
     //    DEBUG << "sweeping chunk" << this << (*freeList);
     HeapItem *o = realBase();
     for (uint i = 0; i < Chunk::EntriesInBitmap; ++i) {
-#if WRITEBARRIER(none)
         Q_ASSERT((grayBitmap[i] | blackBitmap[i]) == blackBitmap[i]); // check that we don't have gray only objects
-#endif
         quintptr toMark = blackBitmap[i] & grayBitmap[i]; // correct for a Steele type barrier
         Q_ASSERT((toMark & objectBitmap[i]) == toMark); // check all black objects are marked as being used
         //        DEBUG << hex << "   index=" << i << toFree;
@@ -523,6 +550,7 @@ HeapItem *BlockAllocator::allocate(size_t size, bool forceAllocation) {
 
     HeapItem *m;
 
+retry:
     if (slotsRequired < NumBins - 1) {
         m = freeBins[slotsRequired];
         if (m) {
@@ -592,6 +620,9 @@ HeapItem *BlockAllocator::allocate(size_t size, bool forceAllocation) {
     }
 
     if (!m) {
+        // prefer the chunks the sweeper is done with over getting a new one
+        if (sweeping && takeSweptChunks())
+            goto retry;
         if (!forceAllocation)
             return nullptr;
         Chunk *newChunk = chunkAllocator->allocate();
@@ -614,6 +645,38 @@ done:
     return m;
 }
 
+struct BlockAllocator::ConcurrentSweep
+{
+    std::vector<Chunk *> chunks; // only written while the helper is not running
+    std::atomic<size_t> nextChunk{0};
+    size_t chunksTaken = 0;
+    std::vector<Chunk *> emptyChunks;
+
+    QMutex mutex;
+    QWaitCondition chunkSwept;
+    std::vector<std::pair<Chunk *, bool>> swept; // guarded by mutex, with hasUsedSlots
+
+#if QT_CONFIG(thread)
+    QThreadPool helper;
+#endif
+
+    // Called from both the helper and the engine thread, to share the remaining work.
+    bool sweepNextChunk()
+    {
+        const size_t index = nextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (index >= chunks.size())
+            return false;
+        Chunk *c = chunks[index];
+        const bool hasUsedSlots = c->sweep(nullptr, /*unmarkedDestroyed*/ true);
+        c->resetBlackBits();
+
+        QMutexLocker locker(&mutex);
+        swept.push_back(std::make_pair(c, hasUsedSlots));
+        chunkSwept.wakeAll();
+        return true;
+    }
+};
+
 void BlockAllocator::sweep()
 {
     nextFree = nullptr;
@@ -644,6 +707,11 @@ void BlockAllocator::sweep()
 
 void BlockAllocator::freeAll()
 {
+    if (sweeping)
+        finishConcurrentSweep();
+    delete concurrentSweep;
+    concurrentSweep = nullptr;
+
     for (auto c : chunks)
         c->freeAll(engine);
     for (auto c : chunks) {
@@ -665,6 +733,94 @@ void BlockAllocator::collectGrayItems(MarkStack *markStack)
 
 }
 
+void BlockAllocator::startConcurrentSweep()
+{
+    Q_ASSERT(!sweeping);
+
+    // the same as in sweep(), chunks are only handed out again once they have been swept
+    nextFree = nullptr;
+    nFree = 0;
+    memset(freeBins, 0, sizeof(freeBins));
+    usedSlotsAfterLastSweep = 0;
+
+    for (auto c : chunks)
+        c->destroyUnmarked();
+
+    if (!concurrentSweep) {
+        concurrentSweep = new ConcurrentSweep;
+#if QT_CONFIG(thread)
+        concurrentSweep->helper.setMaxThreadCount(1);
+#endif
+    }
+    ConcurrentSweep *s = concurrentSweep;
+    s->chunks = chunks;
+    s->nextChunk.store(0, std::memory_order_relaxed);
+    s->chunksTaken = 0;
+    sweeping = true;
+
+#if QT_CONFIG(thread)
+    s->helper.start([s]() {
+        while (s->sweepNextChunk()) {}
+    });
+#endif
+}
+
+bool BlockAllocator::takeSweptChunks()
+{
+    Q_ASSERT(sweeping);
+    ConcurrentSweep *s = concurrentSweep;
+    if (s->chunksTaken == s->chunks.size())
+        return false;
+
+    std::vector<std::pair<Chunk *, bool>> swept;
+    {
+        QMutexLocker locker(&s->mutex);
+        while (s->swept.empty()) {
+            // rather help out than wait, unless the helper is busy with the last chunks
+            locker.unlock();
+            const bool sweptOne = s->sweepNextChunk();
+            locker.relock();
+            if (!sweptOne && s->swept.empty())
+                s->chunkSwept.wait(&s->mutex);
+        }
+        std::swap(swept, s->swept);
+    }
+
+    for (const auto &c : swept) {
+        if (c.second) {
+            c.first->sortIntoBins(freeBins, NumBins);
+            usedSlotsAfterLastSweep += c.first->nUsedSlots();
+        } else {
+            s->emptyChunks.push_back(c.first);
+        }
+    }
+    s->chunksTaken += swept.size();
+    return true;
+}
+
+void BlockAllocator::finishConcurrentSweep()
+{
+    Q_ASSERT(sweeping);
+    ConcurrentSweep *s = concurrentSweep;
+    while (takeSweptChunks()) {}
+#if QT_CONFIG(thread)
+    s->helper.waitForDone();
+#endif
+
+    std::sort(s->emptyChunks.begin(), s->emptyChunks.end());
+    chunks.erase(std::remove_if(chunks.begin(), chunks.end(), [s](Chunk *c) {
+        return std::binary_search(s->emptyChunks.begin(), s->emptyChunks.end(), c);
+    }), chunks.end());
+    for (Chunk *c : s->emptyChunks) {
+        Q_V4_PROFILE_DEALLOC(engine, Chunk::DataSize, Profiling::HeapPage);
+        chunkAllocator->free(c);
+    }
+
+    s->emptyChunks.clear();
+    s->chunks.clear();
+    sweeping = false;
+}
+
 HeapItem *HugeItemAllocator::allocate(size_t size) {
     MemorySegment *m = nullptr;
     Chunk *c = nullptr;
@@ -736,14 +892,18 @@ void HugeItemAllocator::resetBlackBits()
 
 void HugeItemAllocator::collectGrayItems(MarkStack *markStack)
 {
-    for (auto c : chunks)
+    for (auto c : chunks) {
         // Correct for a Steele type barrier
-        if (Chunk::testBit(c.chunk->blackBitmap, c.chunk->first() - c.chunk->realBase()) &&
-            Chunk::testBit(c.chunk->grayBitmap, c.chunk->first() - c.chunk->realBase())) {
+        const size_t index = c.chunk->first() - c.chunk->realBase();
+        if (Chunk::testBit(c.chunk->blackBitmap, index) &&
+            Chunk::testBit(c.chunk->grayBitmap, index)) {
             HeapItem *i = c.chunk->first();
             Heap::Base *b = *i;
-            b->mark(markStack);
+            // already black, so b->mark() would skip it
+            markStack->push(b);
         }
+        Chunk::clearBit(c.chunk->grayBitmap, index);
+    }
 }
 
 void HugeItemAllocator::freeAll()
@@ -767,6 +927,8 @@ MemoryManager::MemoryManager(ExecutionEngine *engine)
     , aggressiveGC(!qEnvironmentVariableIsEmpty("QV4_MM_AGGRESSIVE_GC"))
     , gcStats(lcGcStats().isDebugEnabled())
     , gcCollectorStats(lcGcAllocatorStats().isDebugEnabled())
+    , incrementalSliceBudget(qMax(0, qEnvironmentVariableIntValue(QV4_MM_INCREMENTAL_GC)))
+    , sweepConcurrently(!qEnvironmentVariableIsEmpty(QV4_MM_CONCURRENT_SWEEP))
 {
 #ifdef V4_USE_VALGRIND
     VALGRIND_CREATE_MEMPOOL(this, 0, true);
@@ -833,6 +995,8 @@ Heap::Object *MemoryManager::allocObjectWithMemberData(const QV4::VTable *vtable
             Chunk::setBit(c->objectBitmap, index);
             Chunk::clearBit(c->extendsBitmap, index);
         }
+        if (Q_UNLIKELY(engine->isGCMarking))
+            markAllocatedDuringGC(reinterpret_cast<HeapItem *>(m));
         o->memberData.set(engine, m);
         m->internalClass.set(engine, engine->internalClasses(EngineBase::Class_MemberData));
         Q_ASSERT(o->memberData->internalClass);
@@ -867,6 +1031,29 @@ void MarkStack::drain()
     }
 }
 
+bool MarkStack::drainUntil(QDeadlineTimer deadline)
+{
+    enum { ObjectsBetweenDeadlineChecks = 128 };
+    do {
+        for (int i = 0; i < ObjectsBetweenDeadlineChecks; ++i) {
+            if (m_top == m_base)
+                return true;
+            Heap::Base *h = pop();
+            ++markStackSize;
+            Q_ASSERT(h);
+            h->internalClass->vtable->markObjects(h, this);
+        }
+    } while (!deadline.hasExpired());
+    return m_top == m_base;
+}
+
+void WriteBarrier::markBarrier(Heap::Base *base)
+{
+    // white objects get scanned anyway, only black ones need another look
+    if (base && base->isMarked())
+        base->setGrayBit();
+}
+
 void MemoryManager::collectRoots(MarkStack *markStack)
 {
     engine->markObjects(markStack);
@@ -988,7 +1175,11 @@ void MemoryManager::sweep(bool lastSweep, ClassDestroyStatsCallback classCountPt
 
     if (!lastSweep) {
         engine->identifierTable->sweep();
-        blockAllocator.sweep(/*classCountPtr*/);
+        // the collector and profiler statistics expect the heap to be swept when we return
+        if (sweepConcurrently && !aggressiveGC && !gcCollectorStats && !engine->profiler())
+            blockAllocator.startConcurrentSweep();
+        else
+            blockAllocator.sweep(/*classCountPtr*/);
         hugeItemAllocator.sweep(classCountPtr);
         icAllocator.sweep(/*classCountPtr*/);
     }
@@ -1041,14 +1232,34 @@ void MemoryManager::runGC()
     QScopedValueRollback<bool> gcBlocker(gcBlocked, true);
 //    qDebug() << "runGC";
 
+    if (engine->isGCMarking) {
+        // complete the cycle in progress
+        finishIncrementalGC();
+        return;
+    }
+
+    if (blockAllocator.sweeping)
+        finishConcurrentSweep();
+
     if (gcStats) {
         statistics.maxReservedMem = qMax(statistics.maxReservedMem, getAllocatedMem());
         statistics.maxAllocatedMem = qMax(statistics.maxAllocatedMem, getUsedMem() + getLargeItemsMem());
     }
 
     if (!gcCollectorStats) {
+        QElapsedTimer t;
+        if (gcStats)
+            t.start();
         mark();
+        const qint64 markTime = gcStats ? t.nsecsElapsed()/1000 : 0;
         sweep();
+        if (gcStats) {
+            const qint64 pause = t.nsecsElapsed()/1000;
+            statistics.totalMarkTime += markTime;
+            statistics.totalSweepTime += pause - markTime;
+            statistics.longestPause = qMax(statistics.longestPause, pause);
+            ++statistics.markSlices;
+        }
     } else {
         bool triggeredByUnmanagedHeap = (unmanagedHeapSize > unmanagedHeapSizeGCLimit);
         size_t oldUnmanagedSize = unmanagedHeapSize;
@@ -1124,6 +1335,24 @@ void MemoryManager::runGC()
         }
 
         qDebug(stats) << "======== End GC ========";
+
+        statistics.totalMarkTime += markTime;
+        statistics.totalSweepTime += sweepTime;
+        statistics.longestPause = qMax(statistics.longestPause, markTime + sweepTime);
+        ++statistics.markSlices;
+    }
+
+    finishGC();
+}
+
+void MemoryManager::finishGC()
+{
+    ++statistics.gcCycles;
+    if (blockAllocator.sweeping) {
+        // the sweeper resets the black bits of the block chunks, finishConcurrentSweep() does the rest
+        hugeItemAllocator.resetBlackBits();
+        icAllocator.resetBlackBits();
+        return;
     }
 
     if (gcStats)
@@ -1145,6 +1374,131 @@ void MemoryManager::runGC()
     icAllocator.resetBlackBits();
 }
 
+void MemoryManager::finishConcurrentSweep()
+{
+    QElapsedTimer t;
+    if (gcStats)
+        t.start();
+
+    blockAllocator.finishConcurrentSweep();
+    usedSlotsAfterLastFullSweep = blockAllocator.usedSlotsAfterLastSweep + icAllocator.usedSlotsAfterLastSweep;
+
+    if (gcStats) {
+        const qint64 pause = t.nsecsElapsed()/1000;
+        statistics.totalSweepTime += pause;
+        statistics.longestPause = qMax(statistics.longestPause, pause);
+        statistics.maxUsedMem = qMax(statistics.maxUsedMem, getUsedMem() + getLargeItemsMem());
+    }
+}
+
+void MemoryManager::triggerGC()
+{
+    if (!incrementalSliceBudget || aggressiveGC) {
+        runGC();
+        return;
+    }
+
+    if (gcBlocked)
+        return;
+
+    QScopedValueRollback<bool> gcBlocker(gcBlocked, true);
+    if (engine->isGCMarking)
+        runIncrementalMarkSlice();
+    else
+        startIncrementalGC();
+}
+
+void MemoryManager::startIncrementalGC()
+{
+    Q_ASSERT(!incrementalMarkStack);
+
+    if (blockAllocator.sweeping)
+        finishConcurrentSweep();
+
+    if (gcStats) {
+        statistics.maxReservedMem = qMax(statistics.maxReservedMem, getAllocatedMem());
+        statistics.maxAllocatedMem = qMax(statistics.maxAllocatedMem, getUsedMem() + getLargeItemsMem());
+    }
+
+    QElapsedTimer t;
+    t.start();
+    incrementalCycle = {};
+    markStackSize = 0;
+    incrementalMarkStack = new MarkStack(engine);
+    collectRoots(incrementalMarkStack);
+    engine->isGCMarking = true;
+
+    const qint64 rootsTime = t.nsecsElapsed()/1000;
+    incrementalCycle.markTime += rootsTime;
+    incrementalCycle.longestSlice = rootsTime;
+    ++incrementalCycle.slices;
+
+    runIncrementalMarkSlice();
+}
+
+void MemoryManager::runIncrementalMarkSlice()
+{
+    QElapsedTimer t;
+    t.start();
+    const bool done = incrementalMarkStack->drainUntil(QDeadlineTimer(incrementalSliceBudget));
+    const qint64 sliceTime = t.nsecsElapsed()/1000;
+    incrementalCycle.markTime += sliceTime;
+    incrementalCycle.longestSlice = qMax(incrementalCycle.longestSlice, sliceTime);
+    ++incrementalCycle.slices;
+
+    if (done)
+        finishIncrementalGC();
+}
+
+void MemoryManager::finishIncrementalGC()
+{
+    QElapsedTimer t;
+    t.start();
+
+    // The mutator ran between the slices: pick up what the roots reference
+    // now, and rescan the objects that were written to after being marked.
+    collectRoots(incrementalMarkStack);
+    blockAllocator.collectGrayItems(incrementalMarkStack);
+    icAllocator.collectGrayItems(incrementalMarkStack);
+    hugeItemAllocator.collectGrayItems(incrementalMarkStack);
+    delete incrementalMarkStack; // drains
+    incrementalMarkStack = nullptr;
+    engine->isGCMarking = false;
+    const qint64 remarkTime = t.nsecsElapsed()/1000;
+
+    t.restart();
+    const size_t usedBefore = getUsedMem();
+    sweep();
+    const qint64 sweepTime = t.nsecsElapsed()/1000;
+
+    if (gcCollectorStats) {
+        const QLoggingCategory &stats = lcGcAllocatorStats();
+        qDebug(stats) << "========== Incremental GC ==========";
+        qDebug(stats) << "Marked" << markStackSize << "objects in" << incrementalCycle.slices
+                      << "slices taking" << incrementalCycle.markTime << "us, longest slice"
+                      << incrementalCycle.longestSlice << "us.";
+        qDebug(stats) << "Final marking took" << remarkTime << "us.";
+        qDebug(stats) << "Sweeped object in" << sweepTime << "us.";
+        qDebug(stats) << "Freed up bytes      :" << (usedBefore - getUsedMem());
+        qDebug(stats) << "======== End Incremental GC ========";
+    }
+
+    statistics.totalMarkTime += incrementalCycle.markTime + remarkTime;
+    statistics.totalSweepTime += sweepTime;
+    statistics.longestPause = qMax(statistics.longestPause,
+                                   qMax(incrementalCycle.longestSlice, remarkTime + sweepTime));
+    statistics.markSlices += incrementalCycle.slices + 1;
+
+    finishGC();
+}
+
+void MemoryManager::markAllocatedDuringGC(HeapItem *item)
+{
+    Heap::Base *b = *item;
+    b->setMarkBit();
+    b->setGrayBit();
+}
+
 size_t MemoryManager::getUsedMem() const
 {
     return blockAllocator.usedMem() + icAllocator.usedMem();
@@ -1174,6 +1528,11 @@ void MemoryManager::registerWeakSet(Heap::SetObject *set)
 
 MemoryManager::~MemoryManager()
 {
+    delete incrementalMarkStack;
+    engine->isGCMarking = false;
+    if (blockAllocator.sweeping)
+        finishConcurrentSweep();
+
     delete m_persistentValues;
 
     dumpStats();
@@ -1201,6 +1560,11 @@ void MemoryManager::dumpStats() const
     qDebug(stats) << "Total memory allocated:" << statistics.maxReservedMem;
     qDebug(stats) << "Max memory used before a GC run:" << statistics.maxAllocatedMem;
     qDebug(stats) << "Max memory used after a GC run:" << statistics.maxUsedMem;
+    qDebug(stats) << "GC cycles:" << statistics.gcCycles << "in" << statistics.markSlices
+                  << (incrementalSliceBudget ? "incremental slices" : "pauses");
+    qDebug(stats) << "Time spent marking:" << statistics.totalMarkTime << "us";
+    qDebug(stats) << "Time spent sweeping:" << statistics.totalSweepTime << "us";
+    qDebug(stats) << "Longest GC pause:" << statistics.longestPause << "us";
     qDebug(stats) << "Requests for different item sizes:";
     for (int i = 1; i < BlockAllocator::NumBins - 1; ++i)
         qDebug(stats) << "     <" << (i << Chunk::SlotSizeShift) << " bytes: " << statistics.allocations[i];
@@ -61,6 +61,8 @@
 #define QV4_MM_MAXBLOCK_SHIFT "QV4_MM_MAXBLOCK_SHIFT"
 #define QV4_MM_MAX_CHUNK_SIZE "QV4_MM_MAX_CHUNK_SIZE"
 #define QV4_MM_STATS "QV4_MM_STATS"
+#define QV4_MM_INCREMENTAL_GC "QV4_MM_INCREMENTAL_GC"
+#define QV4_MM_CONCURRENT_SWEEP "QV4_MM_CONCURRENT_SWEEP"
 
 #define MM_DEBUG 0
 
@@ -105,6 +107,15 @@ struct BlockAllocator {
     void resetBlackBits();
     void collectGrayItems(MarkStack *markStack);
 
+    // Concurrent sweeping: the destructors of unreachable objects are run right away on the
+    // engine thread, the bitmaps of the chunks are then updated by a helper thread. The
+    // allocator takes over chunks as they are swept, and only frees the empty ones once
+    // finishConcurrentSweep() has been called.
+    struct ConcurrentSweep;
+    void startConcurrentSweep();
+    bool takeSweptChunks();
+    void finishConcurrentSweep();
+
     // bump allocations
     HeapItem *nextFree = nullptr;
     size_t nFree = 0;
@@ -114,6 +125,8 @@ struct BlockAllocator {
     ExecutionEngine *engine;
     std::vector<Chunk *> chunks;
     uint *allocationStats = nullptr;
+    ConcurrentSweep *concurrentSweep = nullptr;
+    bool sweeping = false;
 };
 
 struct HugeItemAllocator {
@@ -293,8 +306,29 @@ private:
     void sweep(bool lastSweep = false, ClassDestroyStatsCallback classCountPtr = nullptr);
     bool shouldRunGC() const;
     void collectRoots(MarkStack *markStack);
+    void finishGC();
+
+    // Incremental marking: the first slice collects the roots, each further
+    // slice marks for at most incrementalSliceBudget ms, and the final slice
+    // rescans the roots and all objects the write barrier turned gray before
+    // sweeping.
+    void triggerGC();
+    void startIncrementalGC();
+    void runIncrementalMarkSlice();
+    void finishIncrementalGC();
+    void markAllocatedDuringGC(HeapItem *item);
+    void finishConcurrentSweep();
 
     HeapItem *allocate(BlockAllocator *allocator, std::size_t size)
+    {
+        HeapItem *m = allocateItem(allocator, size);
+        // objects allocated while marking survive this cycle and get scanned in the final slice
+        if (Q_UNLIKELY(engine->isGCMarking))
+            markAllocatedDuringGC(m);
+        return m;
+    }
+
+    HeapItem *allocateItem(BlockAllocator *allocator, std::size_t size)
     {
         bool didGCRun = false;
         if (aggressiveGC) {
@@ -304,16 +338,19 @@ private:
 
         if (unmanagedHeapSize > unmanagedHeapSizeGCLimit) {
             if (!didGCRun)
-                runGC();
-
-            if (3*unmanagedHeapSizeGCLimit <= 4 * unmanagedHeapSize) {
-                // more than 75% full, raise limit
-                unmanagedHeapSizeGCLimit = std::max(unmanagedHeapSizeGCLimit,
-                                                    unmanagedHeapSize) * 2;
-            } else if (unmanagedHeapSize * 4 <= unmanagedHeapSizeGCLimit) {
-                // less than 25% full, lower limit
-                unmanagedHeapSizeGCLimit = qMax(std::size_t(MinUnmanagedHeapSizeGCLimit),
-                                                unmanagedHeapSizeGCLimit/2);
+                triggerGC();
+
+            // the unmanaged heap only shrinks once a cycle has completed
+            if (!engine->isGCMarking) {
+                if (3*unmanagedHeapSizeGCLimit <= 4 * unmanagedHeapSize) {
+                    // more than 75% full, raise limit
+                    unmanagedHeapSizeGCLimit = std::max(unmanagedHeapSizeGCLimit,
+                                                        unmanagedHeapSize) * 2;
+                } else if (unmanagedHeapSize * 4 <= unmanagedHeapSizeGCLimit) {
+                    // less than 25% full, lower limit
+                    unmanagedHeapSizeGCLimit = qMax(std::size_t(MinUnmanagedHeapSizeGCLimit),
+                                                    unmanagedHeapSizeGCLimit/2);
+                }
             }
             didGCRun = true;
         }
@@ -324,8 +361,12 @@ private:
         if (HeapItem *m = allocator->allocate(size))
             return m;
 
+        // all swept chunks are in use by now, update the numbers shouldRunGC() looks at
+        if (blockAllocator.sweeping)
+            finishConcurrentSweep();
+
         if (!didGCRun && shouldRunGC())
-            runGC();
+            triggerGC();
 
         return allocator->allocate(size, true);
     }
@@ -351,6 +392,15 @@ public:
     bool gcStats = false;
     bool gcCollectorStats = false;
 
+    int incrementalSliceBudget = 0; // in ms, 0 if marking is done in one go
+    MarkStack *incrementalMarkStack = nullptr;
+    bool sweepConcurrently = false;
+    struct {
+        qint64 markTime = 0; // us, summed over the slices
+        qint64 longestSlice = 0;
+        uint slices = 0;
+    } incrementalCycle;
+
     int allocationCount = 0;
     size_t lastAllocRequestedSlots = 0;
 
@@ -358,6 +408,11 @@ public:
         size_t maxReservedMem = 0;
         size_t maxAllocatedMem = 0;
         size_t maxUsedMem = 0;
+        uint gcCycles = 0;
+        uint markSlices = 0;
+        qint64 totalMarkTime = 0; // us
+        qint64 totalSweepTime = 0; // us
+        qint64 longestPause = 0; // us
         uint allocations[BlockAllocator::NumBins];
     } statistics;
 };
@@ -53,6 +53,7 @@
 #include <private/qv4global_p.h>
 #include <private/qv4runtimeapi_p.h>
 #include <QtCore/qalgorithms.h>
+#include <QtCore/qdeadlinetimer.h>
 #include <QtCore/qmath.h>
 #include <qdebug.h>
 
@@ -190,7 +191,8 @@ struct Chunk {
     bool sweep(ClassDestroyStatsCallback classCountPtr);
     void resetBlackBits();
     void collectGrayItems(QV4::MarkStack *markStack);
-    bool sweep(ExecutionEngine *engine);
+    bool sweep(ExecutionEngine *engine, bool unmarkedDestroyed = false);
+    void destroyUnmarked();
     void freeAll(ExecutionEngine *engine);
 
     void sortIntoBins(HeapItem **bins, uint nBins);
@@ -296,6 +298,10 @@ struct Q_QML_PRIVATE_EXPORT MarkStack {
 
     ExecutionEngine *engine() const { return m_engine; }
 
+    // Marks objects until the stack is empty or the deadline has expired.
+    // Returns true if the stack is empty.
+    bool drainUntil(QDeadlineTimer deadline);
+
 private:
     Heap::Base *pop() { return *(--m_top); }
     void drain();
@@ -51,10 +51,11 @@
 //
 
 #include <private/qv4global_p.h>
+#include <private/qv4enginebase_p.h>
 
 QT_BEGIN_NAMESPACE
 
-#define WRITEBARRIER_none 1
+#define WRITEBARRIER_steele 1
 
 #define WRITEBARRIER(x) (1/WRITEBARRIER_##x == 1)
 
@@ -77,25 +78,30 @@ enum NewValueType {
 // ### this needs to be filled with a real memory fence once marking is concurrent
 Q_ALWAYS_INLINE void fence() {}
 
-#if WRITEBARRIER(none)
+#if WRITEBARRIER(steele)
+
+// Marking can be spread over several slices with the mutator running in
+// between. Storing a reference into an object that is already marked turns
+// it gray again, so that the final slice scans it once more.
+Q_QML_PRIVATE_EXPORT void markBarrier(Heap::Base *base);
 
 template <NewValueType type>
 static Q_CONSTEXPR inline bool isRequired() {
-    return false;
+    return type != Primitive;
 }
 
 inline void write(EngineBase *engine, Heap::Base *base, ReturnedValue *slot, ReturnedValue value)
 {
-    Q_UNUSED(engine);
-    Q_UNUSED(base);
     *slot = value;
+    if (Q_UNLIKELY(engine->isGCMarking))
+        markBarrier(base);
 }
 
 inline void write(EngineBase *engine, Heap::Base *base, Heap::Base **slot, Heap::Base *value)
 {
-    Q_UNUSED(engine);
-    Q_UNUSED(base);
     *slot = value;
+    if (Q_UNLIKELY(engine->isGCMarking))
+        markBarrier(base);
 }
 
 #endif
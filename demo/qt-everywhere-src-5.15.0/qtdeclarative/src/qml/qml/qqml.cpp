@@ -42,6 +42,7 @@
 #include <QtQml/qqmlprivate.h>
 
 #include <private/qqmlengine_p.h>
+#include <private/qqmljavascriptexpression_p.h>
 #include <private/qqmlmetatype_p.h>
 #include <private/qqmlmetatypedata_p.h>
 #include <private/qqmltype_p_p.h>
@@ -322,6 +323,31 @@ void QQmlPrivate::qmlunregister(RegistrationType type, quintptr data)
     }
 }
 
+QQmlEngine *QQmlPrivate::AOTCompiledContext::qmlEngine() const
+{
+    return qmlContext ? qmlContext->engine : nullptr;
+}
+
+void QQmlPrivate::AOTCompiledContext::captureProperty(QObject *object, int propertyIndex) const
+{
+    QQmlEngine *engine = qmlEngine();
+    if (!engine || !object)
+        return;
+    if (QQmlPropertyCapture *capture = QQmlEnginePrivate::get(engine)->propertyCapture) {
+        const QMetaProperty property = object->metaObject()->property(propertyIndex);
+        capture->captureProperty(object, propertyIndex, property.notifySignalIndex());
+    }
+}
+
+bool QQmlPrivate::AOTCompiledContext::readProperty(QObject *object, int propertyIndex,
+                                                   void *target) const
+{
+    if (!object)
+        return false;
+    void *args[] = { target, nullptr };
+    return QMetaObject::metacall(object, QMetaObject::ReadProperty, propertyIndex, args) < 0;
+}
+
 namespace QQmlPrivate {
     template<>
     void qmlRegisterTypeAndRevisions<QQmlTypeNotAvailable, void>(
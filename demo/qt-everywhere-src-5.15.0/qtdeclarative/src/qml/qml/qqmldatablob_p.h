@@ -68,6 +68,10 @@
 
 QT_BEGIN_NAMESPACE
 
+namespace QQmlPrivate {
+struct CachedQmlUnit;
+}
+
 class QQmlTypeLoader;
 class Q_QML_PRIVATE_EXPORT QQmlDataBlob : public QQmlRefCount
 {
@@ -138,7 +142,7 @@ protected:
 
     // Callbacks made in load thread
     virtual void dataReceived(const SourceCodeData &) = 0;
-    virtual void initializeFromCachedUnit(const QV4::CompiledData::Unit*) = 0;
+    virtual void initializeFromCachedUnit(const QQmlPrivate::CachedQmlUnit *) = 0;
     virtual void done();
 #if QT_CONFIG(qml_network)
     virtual void networkError(QNetworkReply::NetworkError);
@@ -334,6 +334,20 @@ void QQmlObjectCreator::finalizePopulateDeferred()
     phase = ObjectsCreated;
 }
 
+// Returns the value converted by QQmlPropertyValidator at type compile time, or converts it now.
+template <typename T>
+static T convertedBindingValue(const QV4::ExecutableCompilationUnit *compilationUnit,
+                               const QV4::CompiledData::Binding *binding,
+                               T (*fromString)(const QString &, bool *), bool *ok)
+{
+    const auto it = compilationUnit->convertedBindingValues.constFind(binding);
+    if (it != compilationUnit->convertedBindingValues.constEnd()) {
+        *ok = true;
+        return it->value<T>();
+    }
+    return fromString(compilationUnit->bindingValueAsString(binding), ok);
+}
+
 void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const QV4::CompiledData::Binding *binding)
 {
     QQmlPropertyData::WriteFlags propertyWriteFlags = QQmlPropertyData::BypassInterceptor | QQmlPropertyData::RemoveBindingOnAliasWrite;
@@ -345,7 +359,12 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
         if (binding->flags & QV4::CompiledData::Binding::IsResolvedEnum) {
             propertyType = QMetaType::Int;
         } else {
-            // ### This should be resolved earlier at compile time and the binding value should be changed accordingly.
+            const QVariant converted = compilationUnit->convertedBindingValues.value(binding);
+            if (converted.isValid()) {
+                int value = converted.toInt();
+                property->writeProperty(_qobject, &value, propertyWriteFlags);
+                return;
+            }
             QVariant value = compilationUnit->bindingValueAsString(binding);
             bool ok = QQmlPropertyPrivate::write(_qobject, *property, value, context);
             Q_ASSERT(ok);
@@ -484,7 +503,7 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
     break;
     case QMetaType::QColor: {
         bool ok = false;
-        uint colorValue = QQmlStringConverters::rgbaFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        uint colorValue = convertedBindingValue(compilationUnit.data(), binding, QQmlStringConverters::rgbaFromString, &ok);
         assertOrNull(ok);
         struct { void *data[4]; } buffer;
         if (QQml_valueTypeProvider()->storeValueType(property->propType(), &colorValue, &buffer, sizeof(buffer))) {
@@ -495,21 +514,21 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
 #if QT_CONFIG(datestring)
     case QMetaType::QDate: {
         bool ok = false;
-        QDate value = QQmlStringConverters::dateFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        QDate value = convertedBindingValue(compilationUnit.data(), binding, QQmlStringConverters::dateFromString, &ok);
         assertOrNull(ok);
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QMetaType::QTime: {
         bool ok = false;
-        QTime value = QQmlStringConverters::timeFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        QTime value = convertedBindingValue(compilationUnit.data(), binding, QQmlStringConverters::timeFromString, &ok);
         assertOrNull(ok);
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QMetaType::QDateTime: {
         bool ok = false;
-        QDateTime value = QQmlStringConverters::dateTimeFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        QDateTime value = convertedBindingValue(compilationUnit.data(), binding, QQmlStringConverters::dateTimeFromString, &ok);
         // ### VME compatibility :(
         {
             const qint64 date = value.date().toJulianDay();
@@ -523,42 +542,42 @@ void QQmlObjectCreator::setPropertyValue(const QQmlPropertyData *property, const
 #endif // datestring
     case QMetaType::QPoint: {
         bool ok = false;
-        QPoint value = QQmlStringConverters::pointFFromString(compilationUnit->bindingValueAsString(binding), &ok).toPoint();
+        QPoint value = convertedBindingValue(compilationUnit.data(), binding, QQmlStringConverters::pointFFromString, &ok).toPoint();
         assertOrNull(ok);
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QMetaType::QPointF: {
         bool ok = false;
-        QPointF value = QQmlStringConverters::pointFFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        QPointF value = convertedBindingValue(compilationUnit.data(), binding, QQmlStringConverters::pointFFromString, &ok);
         assertOrNull(ok);
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QMetaType::QSize: {
         bool ok = false;
-        QSize value = QQmlStringConverters::sizeFFromString(compilationUnit->bindingValueAsString(binding), &ok).toSize();
+        QSize value = convertedBindingValue(compilationUnit.data(), binding, QQmlStringConverters::sizeFFromString, &ok).toSize();
         assertOrNull(ok);
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QMetaType::QSizeF: {
         bool ok = false;
-        QSizeF value = QQmlStringConverters::sizeFFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        QSizeF value = convertedBindingValue(compilationUnit.data(), binding, QQmlStringConverters::sizeFFromString, &ok);
         assertOrNull(ok);
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QMetaType::QRect: {
         bool ok = false;
-        QRect value = QQmlStringConverters::rectFFromString(compilationUnit->bindingValueAsString(binding), &ok).toRect();
+        QRect value = convertedBindingValue(compilationUnit.data(), binding, QQmlStringConverters::rectFFromString, &ok).toRect();
         assertOrNull(ok);
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
     break;
     case QMetaType::QRectF: {
         bool ok = false;
-        QRectF value = QQmlStringConverters::rectFFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        QRectF value = convertedBindingValue(compilationUnit.data(), binding, QQmlStringConverters::rectFFromString, &ok);
         assertOrNull(ok);
         property->writeProperty(_qobject, &value, propertyWriteFlags);
     }
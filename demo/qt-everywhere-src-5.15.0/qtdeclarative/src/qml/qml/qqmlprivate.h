@@ -84,15 +84,19 @@
 QT_BEGIN_NAMESPACE
 
 class QQmlPropertyValueInterceptor;
+class QQmlContextData;
+class QJSEngine;
 
 namespace QQmlPrivate {
 struct CachedQmlUnit;
+struct AOTCompiledFunction;
 template<typename A>
 using QQmlAttachedPropertiesFunc = A *(*)(QObject *);
 }
 
 namespace QV4 {
 struct ExecutionEngine;
+class ExecutableCompilationUnit;
 namespace CompiledData {
 struct Unit;
 struct CompilationUnit;
@@ -464,9 +468,43 @@ namespace QQmlPrivate
         const char *typeName;
     };
 
+    struct Q_QML_EXPORT AOTCompiledContext {
+        QQmlContextData *qmlContext;
+        QObject *qmlScopeObject;
+        QJSEngine *engine;
+        QV4::ExecutableCompilationUnit *compilationUnit;
+
+        QQmlEngine *qmlEngine() const;
+
+        // Registers a dependency of the currently evaluated binding on the given
+        // property, so that the binding is re-evaluated when it changes.
+        void captureProperty(QObject *object, int propertyIndex) const;
+
+        // Reads the property into target, which must point to a value of the
+        // property's exact type. Returns false if the property cannot be read.
+        bool readProperty(QObject *object, int propertyIndex, void *target) const;
+
+        bool captureAndReadProperty(QObject *object, int propertyIndex, void *target) const
+        {
+            captureProperty(object, propertyIndex);
+            return readProperty(object, propertyIndex, target);
+        }
+    };
+
+    // A function generated ahead of time for the parameterless JavaScript function
+    // (usually a binding) at the given index in the compilation unit. The result is
+    // written to resultPtr, which points to a default constructed value of the
+    // metatype returnType. A table of these is terminated by an entry with a null
+    // functionPtr.
+    struct AOTCompiledFunction {
+        int index;
+        int returnType;
+        void (*functionPtr)(const AOTCompiledContext *context, void *resultPtr);
+    };
+
     struct CachedQmlUnit {
         const QV4::CompiledData::Unit *qmlData;
-        void *unused1;
+        const AOTCompiledFunction *aotCompiledFunctions;
         void *unused2;
     };
 
@@ -372,14 +372,16 @@ QQmlError QQmlPropertyValidator::validateLiteralBinding(QQmlPropertyCache *prope
         QString value = compilationUnit->bindingValueAsString(binding);
         QMetaProperty p = propertyCache->firstCppMetaObject()->property(property->coreIndex());
         bool ok;
+        int enumValue;
         if (p.isFlagType()) {
-            p.enumerator().keysToValue(value.toUtf8().constData(), &ok);
+            enumValue = p.enumerator().keysToValue(value.toUtf8().constData(), &ok);
         } else
-            p.enumerator().keyToValue(value.toUtf8().constData(), &ok);
+            enumValue = p.enumerator().keyToValue(value.toUtf8().constData(), &ok);
 
         if (!ok) {
             return qQmlCompileError(binding->valueLocation, tr("Invalid property assignment: unknown enumeration"));
         }
+        compilationUnit->convertedBindingValues.insert(binding, enumValue);
         return noError;
     }
 
@@ -457,84 +459,94 @@ QQmlError QQmlPropertyValidator::validateLiteralBinding(QQmlPropertyCache *prope
     break;
     case QMetaType::QColor: {
         bool ok = false;
-        QQmlStringConverters::rgbaFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        const uint value = QQmlStringConverters::rgbaFromString(compilationUnit->bindingValueAsString(binding), &ok);
         if (!ok) {
             return warnOrError(tr("Invalid property assignment: color expected"));
         }
+        compilationUnit->convertedBindingValues.insert(binding, QVariant::fromValue(value));
     }
     break;
 #if QT_CONFIG(datestring)
     case QMetaType::QDate: {
         bool ok = false;
-        QQmlStringConverters::dateFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        const QDate value = QQmlStringConverters::dateFromString(compilationUnit->bindingValueAsString(binding), &ok);
         if (!ok) {
             return warnOrError(tr("Invalid property assignment: date expected"));
         }
+        compilationUnit->convertedBindingValues.insert(binding, QVariant::fromValue(value));
     }
     break;
     case QMetaType::QTime: {
         bool ok = false;
-        QQmlStringConverters::timeFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        const QTime value = QQmlStringConverters::timeFromString(compilationUnit->bindingValueAsString(binding), &ok);
         if (!ok) {
             return warnOrError(tr("Invalid property assignment: time expected"));
         }
+        compilationUnit->convertedBindingValues.insert(binding, QVariant::fromValue(value));
     }
     break;
     case QMetaType::QDateTime: {
         bool ok = false;
-        QQmlStringConverters::dateTimeFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        const QDateTime value = QQmlStringConverters::dateTimeFromString(compilationUnit->bindingValueAsString(binding), &ok);
         if (!ok) {
             return warnOrError(tr("Invalid property assignment: datetime expected"));
         }
+        compilationUnit->convertedBindingValues.insert(binding, QVariant::fromValue(value));
     }
     break;
 #endif // datestring
     case QMetaType::QPoint: {
         bool ok = false;
-        QQmlStringConverters::pointFFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        const QPointF value = QQmlStringConverters::pointFFromString(compilationUnit->bindingValueAsString(binding), &ok);
         if (!ok) {
             return warnOrError(tr("Invalid property assignment: point expected"));
         }
+        compilationUnit->convertedBindingValues.insert(binding, QVariant::fromValue(value));
     }
     break;
     case QMetaType::QPointF: {
         bool ok = false;
-        QQmlStringConverters::pointFFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        const QPointF value = QQmlStringConverters::pointFFromString(compilationUnit->bindingValueAsString(binding), &ok);
         if (!ok) {
             return warnOrError(tr("Invalid property assignment: point expected"));
         }
+        compilationUnit->convertedBindingValues.insert(binding, QVariant::fromValue(value));
     }
     break;
     case QMetaType::QSize: {
         bool ok = false;
-        QQmlStringConverters::sizeFFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        const QSizeF value = QQmlStringConverters::sizeFFromString(compilationUnit->bindingValueAsString(binding), &ok);
         if (!ok) {
             return warnOrError(tr("Invalid property assignment: size expected"));
         }
+        compilationUnit->convertedBindingValues.insert(binding, QVariant::fromValue(value));
     }
     break;
     case QMetaType::QSizeF: {
         bool ok = false;
-        QQmlStringConverters::sizeFFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        const QSizeF value = QQmlStringConverters::sizeFFromString(compilationUnit->bindingValueAsString(binding), &ok);
         if (!ok) {
             return warnOrError(tr("Invalid property assignment: size expected"));
         }
+        compilationUnit->convertedBindingValues.insert(binding, QVariant::fromValue(value));
     }
     break;
     case QMetaType::QRect: {
         bool ok = false;
-        QQmlStringConverters::rectFFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        const QRectF value = QQmlStringConverters::rectFFromString(compilationUnit->bindingValueAsString(binding), &ok);
         if (!ok) {
             return warnOrError(tr("Invalid property assignment: rect expected"));
         }
+        compilationUnit->convertedBindingValues.insert(binding, QVariant::fromValue(value));
     }
     break;
     case QMetaType::QRectF: {
         bool ok = false;
-        QQmlStringConverters::rectFFromString(compilationUnit->bindingValueAsString(binding), &ok);
+        const QRectF value = QQmlStringConverters::rectFFromString(compilationUnit->bindingValueAsString(binding), &ok);
         if (!ok) {
             return warnOrError(tr("Invalid property assignment: point expected"));
         }
+        compilationUnit->convertedBindingValues.insert(binding, QVariant::fromValue(value));
     }
     break;
     case QMetaType::Bool: {
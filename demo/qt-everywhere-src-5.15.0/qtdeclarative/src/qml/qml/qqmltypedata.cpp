@@ -579,6 +579,8 @@ void QQmlTypeData::dataReceived(const SourceCodeData &data)
 {
     m_backupSourceCode = data;
 
+    QScopedPointer<QmlIR::Document> preparsed(typeLoader()->takePreparsedType(url(), isDebugging()));
+
     if (tryLoadFromDiskCache())
         return;
 
@@ -595,25 +597,32 @@ void QQmlTypeData::dataReceived(const SourceCodeData &data)
         return;
     }
 
-    if (!loadFromSource())
+    if (!loadFromSource(preparsed.take()))
         return;
 
     continueLoadFromIR();
 }
 
-void QQmlTypeData::initializeFromCachedUnit(const QV4::CompiledData::Unit *unit)
+void QQmlTypeData::initializeFromCachedUnit(const QQmlPrivate::CachedQmlUnit *unit)
 {
     m_document.reset(new QmlIR::Document(isDebugging()));
-    QQmlIRLoader loader(unit, m_document.data());
+    QQmlIRLoader loader(unit->qmlData, m_document.data());
     loader.load();
     m_document->jsModule.fileName = urlString();
     m_document->jsModule.finalUrl = finalUrlString();
-    m_document->javaScriptCompilationUnit = QV4::CompiledData::CompilationUnit(unit);
+    m_document->javaScriptCompilationUnit = QV4::CompiledData::CompilationUnit(
+                unit->qmlData, QString(), QString(), unit->aotCompiledFunctions);
     continueLoadFromIR();
 }
 
-bool QQmlTypeData::loadFromSource()
+bool QQmlTypeData::loadFromSource(QmlIR::Document *preparsed)
 {
+    if (preparsed) {
+        m_document.reset(preparsed);
+        m_document->jsModule.sourceTimeStamp = m_backupSourceCode.sourceTimeStamp();
+        return true;
+    }
+
     m_document.reset(new QmlIR::Document(isDebugging()));
     m_document->jsModule.sourceTimeStamp = m_backupSourceCode.sourceTimeStamp();
     QQmlEngine *qmlEngine = typeLoader()->engine();
@@ -852,6 +861,10 @@ void QQmlTypeData::resolveTypes()
         }
     }
 
+    // Composite types are loaded once all references are resolved, so that their
+    // sources can be parsed in parallel beforehand.
+    QVector<int> compositeTypes;
+
     for (QV4::CompiledData::TypeReferenceMap::ConstIterator unresolvedRef = m_typeReferences.constBegin(), end = m_typeReferences.constEnd();
          unresolvedRef != end; ++unresolvedRef) {
 
@@ -872,8 +885,12 @@ void QQmlTypeData::resolveTypes()
             return;
 
         if (ref.type.isComposite() && !ref.selfReference) {
-            ref.typeData = typeLoader()->getType(ref.type.sourceUrl());
-            addDependency(ref.typeData.data());
+            if (ref.type.isInlineComponentType()) {
+                ref.typeData = typeLoader()->getType(ref.type.sourceUrl());
+                addDependency(ref.typeData.data());
+            } else {
+                compositeTypes.append(unresolvedRef.key());
+            }
         }
         if (ref.type.isInlineComponentType()) {
             auto containingType = ref.type.containingType();
@@ -896,6 +913,20 @@ void QQmlTypeData::resolveTypes()
         m_resolvedTypes.insert(unresolvedRef.key(), ref);
     }
 
+    if (compositeTypes.size() > 1) {
+        QList<QUrl> urls;
+        urls.reserve(compositeTypes.size());
+        for (int key : qAsConst(compositeTypes))
+            urls.append(m_resolvedTypes.value(key).type.sourceUrl());
+        typeLoader()->preparseTypes(urls);
+    }
+
+    for (int key : qAsConst(compositeTypes)) {
+        TypeReference &ref = m_resolvedTypes[key];
+        ref.typeData = typeLoader()->getType(ref.type.sourceUrl());
+        addDependency(ref.typeData.data());
+    }
+
     // ### this allows enums to work without explicit import or instantiation of the type
     if (!m_implicitImportLoaded)
         loadImplicitImport();
@@ -113,7 +113,7 @@ protected:
     void done() override;
     void completed() override;
     void dataReceived(const SourceCodeData &) override;
-    void initializeFromCachedUnit(const QV4::CompiledData::Unit *unit) override;
+    void initializeFromCachedUnit(const QQmlPrivate::CachedQmlUnit *unit) override;
     void allDependenciesDone() override;
     void downloadProgressChanged(qreal) override;
 
@@ -121,7 +121,7 @@ protected:
 
 private:
     bool tryLoadFromDiskCache();
-    bool loadFromSource();
+    bool loadFromSource(QmlIR::Document *preparsed = nullptr);
     void restoreIR(QV4::CompiledData::CompilationUnit &&unit);
     void continueLoadFromIR();
     void resolveTypes();
@@ -46,6 +46,8 @@
 #include <private/qqmltypeloaderqmldircontent_p.h>
 #include <private/qqmltypeloaderthread_p.h>
 #include <private/qqmlsourcecoordinate_p.h>
+#include <private/qqmlirbuilder_p.h>
+#include <private/qv4compilationunitbundle_p.h>
 
 #include <QtQml/qqmlabstracturlinterceptor.h>
 #include <QtQml/qqmlengine.h>
@@ -58,6 +60,7 @@
 #include <QtCore/qdiriterator.h>
 #include <QtCore/qfile.h>
 #include <QtCore/qthread.h>
+#include <QtCore/qwaitcondition.h>
 
 #include <functional>
 
@@ -70,6 +73,7 @@
 
 DEFINE_BOOL_CONFIG_OPTION(disableDiskCache, QML_DISABLE_DISK_CACHE);
 DEFINE_BOOL_CONFIG_OPTION(forceDiskCache, QML_FORCE_DISK_CACHE);
+DEFINE_BOOL_CONFIG_OPTION(disableParallelParsing, QML_DISABLE_PARALLEL_PARSING);
 
 QT_BEGIN_NAMESPACE
 
@@ -174,8 +178,8 @@ struct StaticLoader {
 };
 
 struct CachedLoader {
-    const QV4::CompiledData::Unit *unit;
-    CachedLoader(const QV4::CompiledData::Unit *unit) :  unit(unit) {}
+    const QQmlPrivate::CachedQmlUnit *unit;
+    CachedLoader(const QQmlPrivate::CachedQmlUnit *unit) :  unit(unit) {}
 
     void loadThread(QQmlTypeLoader *loader, QQmlDataBlob *blob) const
     {
@@ -247,7 +251,7 @@ void QQmlTypeLoader::loadWithStaticData(QQmlDataBlob *blob, const QByteArray &da
     doLoad(StaticLoader(data), blob, mode);
 }
 
-void QQmlTypeLoader::loadWithCachedUnit(QQmlDataBlob *blob, const QV4::CompiledData::Unit *unit, Mode mode)
+void QQmlTypeLoader::loadWithCachedUnit(QQmlDataBlob *blob, const QQmlPrivate::CachedQmlUnit *unit, Mode mode)
 {
     doLoad(CachedLoader(unit), blob, mode);
 }
@@ -259,7 +263,7 @@ void QQmlTypeLoader::loadWithStaticDataThread(QQmlDataBlob *blob, const QByteArr
     setData(blob, data);
 }
 
-void QQmlTypeLoader::loadWithCachedUnitThread(QQmlDataBlob *blob, const QV4::CompiledData::Unit *unit)
+void QQmlTypeLoader::loadWithCachedUnitThread(QQmlDataBlob *blob, const QQmlPrivate::CachedQmlUnit *unit)
 {
     ASSERT_LOADTHREAD();
 
@@ -269,6 +273,7 @@ void QQmlTypeLoader::loadWithCachedUnitThread(QQmlDataBlob *blob, const QV4::Com
 void QQmlTypeLoader::loadThread(QQmlDataBlob *blob)
 {
     ASSERT_LOADTHREAD();
+    Q_TRACE_SCOPE(QQmlTypeLoader_load, blob->url());
 
     // Don't continue loading if we've been shutdown
     if (m_thread->isShutdown()) {
@@ -300,6 +305,7 @@ void QQmlTypeLoader::loadThread(QQmlDataBlob *blob)
 
     } else {
 #if QT_CONFIG(qml_network)
+        Q_TRACE(QQmlTypeLoader_networkRequest, blob->m_url);
         QNetworkReply *reply = m_thread->networkAccessManager()->get(QNetworkRequest(blob->m_url));
         QQmlTypeLoaderNetworkReplyProxy *nrp = m_thread->networkReplyProxy();
         blob->addref();
@@ -337,6 +343,7 @@ void QQmlTypeLoader::networkReplyFinished(QNetworkReply *reply)
     QQmlDataBlob *blob = m_networkReplies.take(reply);
 
     Q_ASSERT(blob);
+    Q_TRACE(QQmlTypeLoader_networkReplyFinished, reply->url(), int(reply->error()));
 
     blob->m_redirectCount++;
 
@@ -347,6 +354,7 @@ void QQmlTypeLoader::networkReplyFinished(QNetworkReply *reply)
             blob->m_finalUrl = url;
             blob->m_finalUrlString.clear();
 
+            Q_TRACE(QQmlTypeLoader_networkRequest, url);
             QNetworkReply *reply = m_thread->networkAccessManager()->get(QNetworkRequest(url));
             QObject *nrp = m_thread->networkReplyProxy();
             QObject::connect(reply, SIGNAL(finished()), nrp, SLOT(finished()));
@@ -457,7 +465,7 @@ void QQmlTypeLoader::setData(QQmlDataBlob *blob, const QQmlDataBlob::SourceCodeD
     blob->tryDone();
 }
 
-void QQmlTypeLoader::setCachedUnit(QQmlDataBlob *blob, const QV4::CompiledData::Unit *unit)
+void QQmlTypeLoader::setCachedUnit(QQmlDataBlob *blob, const QQmlPrivate::CachedQmlUnit *unit)
 {
     Q_TRACE_SCOPE(QQmlCompiling, blob->url());
     QQmlCompilingProfiler prof(profiler(), blob);
@@ -765,6 +773,7 @@ QQmlTypeLoader::QQmlTypeLoader(QQmlEngine *engine)
     , m_mutex(m_thread->mutex())
     , m_typeCacheTrimThreshold(TYPELOADER_MINIMUM_TRIM_THRESHOLD)
 {
+    QV4::CompilationUnitBundle::registerBundlesFromEnvironment();
 }
 
 /*!
@@ -778,6 +787,10 @@ QQmlTypeLoader::~QQmlTypeLoader()
 
     clearCache();
 
+#if QT_CONFIG(thread)
+    m_preparsePool.reset();
+#endif
+
     invalidate();
 }
 
@@ -818,7 +831,7 @@ QQmlRefPointer<QQmlTypeData> QQmlTypeLoader::getType(const QUrl &unNormalizedUrl
         // TODO: if (compiledData == 0), is it safe to omit this insertion?
         m_typeCache.insert(url, typeData);
         QQmlMetaType::CachedUnitLookupError error = QQmlMetaType::CachedUnitLookupError::NoError;
-        if (const QV4::CompiledData::Unit *cachedUnit = QQmlMetaType::findCachedCompilationUnit(typeData->url(), &error)) {
+        if (const QQmlPrivate::CachedQmlUnit *cachedUnit = QQmlMetaType::findCachedCompilationUnit(typeData->url(), &error)) {
             QQmlTypeLoader::loadWithCachedUnit(typeData, cachedUnit, mode);
         } else {
             typeData->setCachedUnitStatus(error);
@@ -877,7 +890,7 @@ QQmlRefPointer<QQmlScriptBlob> QQmlTypeLoader::getScript(const QUrl &unNormalize
         m_scriptCache.insert(url, scriptBlob);
 
         QQmlMetaType::CachedUnitLookupError error;
-        if (const QV4::CompiledData::Unit *cachedUnit = QQmlMetaType::findCachedCompilationUnit(scriptBlob->url(), &error)) {
+        if (const QQmlPrivate::CachedQmlUnit *cachedUnit = QQmlMetaType::findCachedCompilationUnit(scriptBlob->url(), &error)) {
             QQmlTypeLoader::loadWithCachedUnit(scriptBlob, cachedUnit);
         } else {
             scriptBlob->setCachedUnitStatus(error);
@@ -1165,6 +1178,8 @@ void QQmlTypeLoader::clearCache()
 
     qDeleteAll(m_importQmlDirCache);
 
+    cancelPreparsedTypes();
+
     m_typeCache.clear();
     m_typeCacheTrimThreshold = TYPELOADER_MINIMUM_TRIM_THRESHOLD;
     m_scriptCache.clear();
@@ -1174,6 +1189,153 @@ void QQmlTypeLoader::clearCache()
     QQmlMetaType::freeUnusedTypesAndCaches();
 }
 
+/*
+Source files of types that are parsed to QmlIR ahead of their turn on a thread pool. The
+loader thread takes the document once it gets around to loading the type. If the job has
+not started by then, it is cancelled and the loader thread parses the file itself.
+*/
+struct QQmlTypeLoader::PreparsedType
+{
+    enum State { Queued, Running, Finished, Cancelled };
+
+    QMutex mutex;
+    QWaitCondition finished;
+    State state = Queued;
+    QScopedPointer<QmlIR::Document> document;
+
+    void parse(const QQmlDataBlob::SourceCodeData &source, const QString &urlString,
+               const QSet<QString> &illegalNames, bool debugging)
+    {
+        {
+            QMutexLocker locker(&mutex);
+            if (state == Cancelled)
+                return;
+            state = Running;
+        }
+
+        QScopedPointer<QmlIR::Document> parsed(new QmlIR::Document(debugging));
+        QString error;
+        const QString code = source.readAll(&error);
+        // Errors are reported when the loader thread parses the file again.
+        bool ok = error.isEmpty() && !code.isEmpty();
+        if (ok) {
+            QmlIR::IRBuilder builder(illegalNames);
+            ok = builder.generateFromQml(code, urlString, parsed.data());
+        }
+
+        QMutexLocker locker(&mutex);
+        if (ok)
+            document.swap(parsed);
+        state = Finished;
+        finished.wakeAll();
+    }
+
+    QmlIR::Document *take()
+    {
+        QMutexLocker locker(&mutex);
+        if (state == Queued) {
+            state = Cancelled;
+            return nullptr;
+        }
+        while (state == Running)
+            finished.wait(&mutex);
+        return document.take();
+    }
+
+    void cancel()
+    {
+        QMutexLocker locker(&mutex);
+        if (state == Queued)
+            state = Cancelled;
+    }
+};
+
+/*!
+Starts parsing the QML files behind \a urls on a thread pool, so that independent
+dependencies of a type are parsed concurrently rather than one after the other on the
+loader thread. Files that will be loaded from a cached or disk cached compilation unit
+are skipped.
+
+Set the \c QML_DISABLE_PARALLEL_PARSING environment variable to turn this off.
+*/
+void QQmlTypeLoader::preparseTypes(const QList<QUrl> &urls)
+{
+#if QT_CONFIG(thread)
+    if (urls.isEmpty() || disableParallelParsing())
+        return;
+
+    QV4::ExecutionEngine *v4 = engine()->handle();
+    // Interceptors may redirect the url, in which case the document would never be taken.
+    if (!v4 || engine()->urlInterceptor())
+        return;
+
+    if (!m_preparsePool) {
+        const int threadCount = QThread::idealThreadCount();
+        if (threadCount < 2)
+            return;
+        m_preparsePool.reset(new QThreadPool);
+        // The loader thread parses too when it runs out of prepared documents.
+        m_preparsePool->setMaxThreadCount(threadCount - 1);
+    }
+
+    const bool debugging = v4->debugger() != nullptr;
+    const bool diskCache = (!disableDiskCache() && !debugging) || forceDiskCache();
+    const QSet<QString> illegalNames = v4->illegalNames();
+
+    LockHolder<QQmlTypeLoader> holder(this);
+    for (const QUrl &unNormalizedUrl : urls) {
+        const QUrl url = normalize(unNormalizedUrl);
+        if (!QQmlFile::isSynchronous(url) || m_typeCache.contains(url) || m_preparsedTypes.contains(url))
+            continue;
+        if (QQmlMetaType::findCachedCompilationUnit(url, nullptr))
+            continue;
+        if (diskCache && QFile::exists(QV4::ExecutableCompilationUnit::localCacheFilePath(url)))
+            continue;
+
+        QQmlDataBlob::SourceCodeData source;
+        source.fileInfo = QFileInfo(QQmlFile::urlToLocalFileOrQrc(url));
+        const QString urlString = url.toString();
+
+        const QSharedPointer<PreparsedType> preparsed = QSharedPointer<PreparsedType>::create();
+        m_preparsedTypes.insert(url, preparsed);
+        m_preparsePool->start(QRunnable::create([=]() {
+            preparsed->parse(source, urlString, illegalNames, debugging);
+        }));
+    }
+#else
+    Q_UNUSED(urls);
+#endif
+}
+
+/*!
+Returns the document parsed ahead of time for \a url, or \c nullptr if there is none.
+Waits for the parse to finish if it is still running. The caller takes ownership.
+*/
+QmlIR::Document *QQmlTypeLoader::takePreparsedType(const QUrl &url, bool debugging)
+{
+    QSharedPointer<PreparsedType> preparsed;
+    {
+        LockHolder<QQmlTypeLoader> holder(this);
+        if (m_preparsedTypes.isEmpty())
+            return nullptr;
+        preparsed = m_preparsedTypes.take(url);
+    }
+    if (!preparsed)
+        return nullptr;
+
+    QScopedPointer<QmlIR::Document> document(preparsed->take());
+    if (document && document->jsModule.debugMode != debugging)
+        return nullptr;
+    return document.take();
+}
+
+void QQmlTypeLoader::cancelPreparsedTypes()
+{
+    for (const QSharedPointer<PreparsedType> &preparsed : qAsConst(m_preparsedTypes))
+        preparsed->cancel();
+    m_preparsedTypes.clear();
+}
+
 void QQmlTypeLoader::updateTypeCacheTrimThreshold()
 {
     int size = m_typeCache.size();
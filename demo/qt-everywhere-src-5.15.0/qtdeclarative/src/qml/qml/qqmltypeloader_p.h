@@ -60,6 +60,10 @@
 
 #include <QtCore/qcache.h>
 #include <QtCore/qmutex.h>
+#include <QtCore/qsharedpointer.h>
+#if QT_CONFIG(thread)
+#include <QtCore/qthreadpool.h>
+#endif
 
 #include <memory>
 
@@ -74,6 +78,10 @@ class QQmlProfiler;
 class QQmlTypeLoaderThread;
 class QQmlEngine;
 
+namespace QmlIR {
+struct Document;
+}
+
 class Q_QML_PRIVATE_EXPORT QQmlTypeLoader
 {
     Q_DECLARE_TR_FUNCTIONS(QQmlTypeLoader)
@@ -163,12 +171,15 @@ public:
     bool isTypeLoaded(const QUrl &url) const;
     bool isScriptLoaded(const QUrl &url) const;
 
+    void preparseTypes(const QList<QUrl> &urls);
+    QmlIR::Document *takePreparsedType(const QUrl &url, bool debugging);
+
     void lock() { m_mutex.lock(); }
     void unlock() { m_mutex.unlock(); }
 
     void load(QQmlDataBlob *, Mode = PreferSynchronous);
     void loadWithStaticData(QQmlDataBlob *, const QByteArray &, Mode = PreferSynchronous);
-    void loadWithCachedUnit(QQmlDataBlob *blob, const QV4::CompiledData::Unit *unit, Mode mode = PreferSynchronous);
+    void loadWithCachedUnit(QQmlDataBlob *blob, const QQmlPrivate::CachedQmlUnit *unit, Mode mode = PreferSynchronous);
 
     QQmlEngine *engine() const;
     void initializeEngine(QQmlEngineExtensionInterface *, const char *);
@@ -195,7 +206,7 @@ private:
 
     void loadThread(QQmlDataBlob *);
     void loadWithStaticDataThread(QQmlDataBlob *, const QByteArray &);
-    void loadWithCachedUnitThread(QQmlDataBlob *blob, const QV4::CompiledData::Unit *unit);
+    void loadWithCachedUnitThread(QQmlDataBlob *blob, const QQmlPrivate::CachedQmlUnit *unit);
 #if QT_CONFIG(qml_network)
     void networkReplyFinished(QNetworkReply *);
     void networkReplyProgress(QNetworkReply *, qint64, qint64);
@@ -206,7 +217,7 @@ private:
     void setData(QQmlDataBlob *, const QByteArray &);
     void setData(QQmlDataBlob *, const QString &fileName);
     void setData(QQmlDataBlob *, const QQmlDataBlob::SourceCodeData &);
-    void setCachedUnit(QQmlDataBlob *blob, const QV4::CompiledData::Unit *unit);
+    void setCachedUnit(QQmlDataBlob *blob, const QQmlPrivate::CachedQmlUnit *unit);
 
     template<typename T>
     struct TypedCallback
@@ -248,6 +259,13 @@ private:
     ImportDirCache m_importDirCache;
     ImportQmlDirCache m_importQmlDirCache;
 
+    struct PreparsedType;
+    QHash<QUrl, QSharedPointer<PreparsedType>> m_preparsedTypes;
+#if QT_CONFIG(thread)
+    QScopedPointer<QThreadPool> m_preparsePool;
+#endif
+    void cancelPreparsedTypes();
+
     template<typename Loader>
     void doLoad(const Loader &loader, QQmlDataBlob *blob, Mode mode);
     void updateTypeCacheTrimThreshold();
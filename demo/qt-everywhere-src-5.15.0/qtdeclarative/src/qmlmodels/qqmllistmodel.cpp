@@ -73,6 +73,43 @@ enum { MIN_LISTMODEL_UID = 1024 };
 
 static QAtomicInt uidCounter(MIN_LISTMODEL_UID);
 
+// Collects the rows whose roles changed during a sync into contiguous ranges, so that a
+// WorkerScript updating many rows results in one dataChanged() per range instead of one per row.
+class SyncChangedRows
+{
+public:
+    explicit SyncChangedRows(QQmlListModel *model) : m_model(model) {}
+
+    void add(int row, const QVector<int> &roles)
+    {
+        if (m_first != -1 && row != m_last + 1)
+            flush();
+        if (m_first == -1)
+            m_first = row;
+        m_last = row;
+        for (int role : roles) {
+            if (!m_roles.contains(role))
+                m_roles.append(role);
+        }
+    }
+
+    void flush()
+    {
+        if (m_first == -1)
+            return;
+        if (m_model)
+            emit m_model->dataChanged(m_model->index(m_first, 0, QModelIndex()), m_model->index(m_last, 0, QModelIndex()), m_roles);
+        m_first = -1;
+        m_roles.clear();
+    }
+
+private:
+    QQmlListModel *m_model;
+    int m_first = -1;
+    int m_last = -1;
+    QVector<int> m_roles;
+};
+
 template <typename T>
 static bool isMemoryUsed(const char *mem)
 {
@@ -446,12 +483,14 @@ bool ListModel::sync(ListModel *src, ListModel *target)
     // to ensure things are kept in the correct order, emit inserts and moves first. This shouls ensure all persistent
     // model indices are updated correctly
     int rowsInserted = 0;
+    SyncChangedRows changedRows(targetModel);
     for (int i = 0 ; i < target->elements.count() ; ++i) {
         ListElement *element = target->elements.at(i);
         ElementSync &s = elementHash.find(element->getUid()).value();
         Q_ASSERT(s.srcIndex >= 0);
         s.srcIndex += rowsInserted;
         if (s.srcIndex != s.targetIndex) {
+            changedRows.flush();
             if (targetModel) {
                 if (s.targetIndex == -1) {
                     targetModel->beginInsertRows(QModelIndex(), i, i);
@@ -465,12 +504,11 @@ bool ListModel::sync(ListModel *src, ListModel *target)
             ++rowsInserted;
         }
         if (s.targetIndex != -1 && !s.changedRoles.isEmpty()) {
-            QModelIndex idx = targetModel->createIndex(i, 0);
-            if (targetModel)
-                targetModel->dataChanged(idx, idx, s.changedRoles);
+            changedRows.add(i, s.changedRoles);
             hasChanges = true;
         }
     }
+    changedRows.flush();
     return hasChanges;
 }
 
@@ -2097,12 +2135,14 @@ bool QQmlListModel::sync(QQmlListModel *src, QQmlListModel *target)
     // to ensure things are kept in the correct order, emit inserts and moves first. This shouls ensure all persistent
     // model indices are updated correctly
     int rowsInserted = 0;
+    SyncChangedRows changedRows(target);
     for (int i = 0 ; i < target->m_modelObjects.count() ; ++i) {
         DynamicRoleModelNode *element = target->m_modelObjects.at(i);
         ElementSync &s = elementHash.find(element->getUid()).value();
         Q_ASSERT(s.srcIndex >= 0);
         s.srcIndex += rowsInserted;
         if (s.srcIndex != s.targetIndex) {
+            changedRows.flush();
             if (s.targetIndex == -1) {
                 target->beginInsertRows(QModelIndex(), i, i);
                 target->endInsertRows();
@@ -2114,11 +2154,11 @@ bool QQmlListModel::sync(QQmlListModel *src, QQmlListModel *target)
             ++rowsInserted;
         }
         if (s.targetIndex != -1 && !s.changedRoles.isEmpty()) {
-            QModelIndex idx = target->createIndex(i, 0);
-            emit target->dataChanged(idx, idx, s.changedRoles);
+            changedRows.add(i, s.changedRoles);
             hasChanges = true;
         }
     }
+    changedRows.flush();
     return hasChanges;
 }
 
@@ -71,6 +71,7 @@
 #include <QtCore/qabstractanimation.h>
 #include <QtCore/QLibraryInfo>
 #include <QtCore/QRunnable>
+#include <QtCore/private/qmetaobject_p.h>
 #include <QtQml/qqmlincubator.h>
 
 #include <QtQuick/private/qquickpixmapcache_p.h>
@@ -497,6 +498,13 @@ void QQuickWindowPrivate::renderSceneGraph(const QSize &size, const QSize &surfa
     }
 
     animationController->advance();
+
+    // The renderer's damage only covers the scene graph, so it can only be
+    // passed on when nothing else renders into the window.
+    const bool canReportDamage = rhi && swapchain && !renderTargetId && !customRenderStage
+            && beforeRenderingJobs.isEmpty() && afterRenderingJobs.isEmpty()
+            && !hasRenderingSignalConnections();
+
     emit q->beforeRendering();
     runAndClearJobs(&beforeRenderingJobs);
     if (!customRenderStage || !customRenderStage->render()) {
@@ -543,6 +551,14 @@ void QQuickWindowPrivate::renderSceneGraph(const QSize &size, const QSize &surfa
     emit q->afterRendering();
     runAndClearJobs(&afterRenderingJobs);
 
+    if (swapchain) {
+        QRect damage;
+        QVector<QRect> presentDamage;
+        if (canReportDamage && renderer->damageRect(&damage) && !damage.isEmpty())
+            presentDamage.append(damage);
+        swapchain->setPresentDamage(presentDamage);
+    }
+
     if (rhi)
         context->endNextRhiFrame(renderer);
     else
@@ -556,6 +572,21 @@ void QQuickWindowPrivate::renderSceneGraph(const QSize &size, const QSize &surfa
     }
 }
 
+bool QQuickWindowPrivate::hasRenderingSignalConnections() const
+{
+    static const int signalIndices[] = {
+        QMetaObjectPrivate::signalIndex(QMetaMethod::fromSignal(&QQuickWindow::beforeRendering)),
+        QMetaObjectPrivate::signalIndex(QMetaMethod::fromSignal(&QQuickWindow::afterRendering)),
+        QMetaObjectPrivate::signalIndex(QMetaMethod::fromSignal(&QQuickWindow::beforeRenderPassRecording)),
+        QMetaObjectPrivate::signalIndex(QMetaMethod::fromSignal(&QQuickWindow::afterRenderPassRecording))
+    };
+    for (int signalIndex : signalIndices) {
+        if (isSignalConnected(uint(signalIndex)))
+            return true;
+    }
+    return false;
+}
+
 QQuickWindowPrivate::QQuickWindowPrivate()
     : contentItem(nullptr)
     , activeFocusItem(nullptr)
@@ -222,6 +222,7 @@ public:
     void forcePolish();
     void syncSceneGraph();
     void renderSceneGraph(const QSize &size, const QSize &surfaceSize = QSize());
+    bool hasRenderingSignalConnections() const;
 
     bool isRenderable() const;
 
@@ -181,6 +181,20 @@ static QPair<QRhiTexture::Format, bool> toRhiCompressedFormat(uint glinternalfor
     case QOpenGLTexture::SRGB_Alpha_DXT5:
         return { QRhiTexture::BC5, true };
 
+    case QOpenGLTexture::R_ATI1N_UNorm:
+        return { QRhiTexture::BC4, false };
+
+    case QOpenGLTexture::RG_ATI2N_UNorm:
+        return { QRhiTexture::BC5, false };
+
+    case QOpenGLTexture::RGB_BP_UNSIGNED_FLOAT:
+        return { QRhiTexture::BC6H, false };
+
+    case QOpenGLTexture::RGB_BP_UNorm:
+        return { QRhiTexture::BC7, false };
+    case QOpenGLTexture::SRGB_BP_UNorm:
+        return { QRhiTexture::BC7, true };
+
     case QOpenGLTexture::RGB8_ETC2:
         return { QRhiTexture::ETC2_RGB8, false };
     case QOpenGLTexture::SRGB8_ETC2:
@@ -975,6 +975,9 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
     , m_zRange(0)
     , m_renderOrderRebuildLower(-1)
     , m_renderOrderRebuildUpper(-1)
+    , m_damageTracking(false)
+    , m_fullDamage(true)
+    , m_damagedElements(64)
     , m_currentMaterial(nullptr)
     , m_currentShader(nullptr)
     , m_currentStencilValue(0)
@@ -983,6 +986,7 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
     , m_currentClipType(ClipState::NoClip)
     , m_vertexUploadPool(256)
     , m_indexUploadPool(64)
+    , m_mergedUploads(64)
     , m_vao(nullptr)
 {
     m_rhi = m_context->rhi();
@@ -992,12 +996,17 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
         if (qEnvironmentVariableIntValue("QSG_RHI_UINT32_INDEX"))
             m_uint32IndexForRhi = true;
         m_visualizer = new RhiVisualizer(this);
+        // Collect what changed between frames so that it can be passed on to
+        // the swapchain as a hint for the presentation engine.
+        m_damageTracking = qEnvironmentVariableIntValue("QSG_PRESENT_DAMAGE");
     } else {
         initializeOpenGLFunctions();
         m_uint32IndexForRhi = false;
         m_visualizer = new OpenGLVisualizer(this);
     }
 
+    m_damage.set(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+
     setNodeUpdater(new Updater(this));
 
     // The shader manager is shared between renderers (think for example Item
@@ -1022,10 +1031,14 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
 
     m_batchNodeThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_NODE_THRESHOLD", 64);
     m_batchVertexThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_VERTEX_THRESHOLD", 1024);
+    // Merged batches with at least this many vertices are filled on several threads, 0 disables
+    m_parallelUploadVertexThreshold = QThread::idealThreadCount() > 1
+            ? qt_sg_envInt("QSG_RENDERER_PARALLEL_UPLOAD_THRESHOLD", 16384)
+            : 0;
 
     if (Q_UNLIKELY(debug_build() || debug_render())) {
-        qDebug("Batch thresholds: nodes: %d vertices: %d",
-               m_batchNodeThreshold, m_batchVertexThreshold);
+        qDebug("Batch thresholds: nodes: %d vertices: %d parallel upload vertices: %d",
+               m_batchNodeThreshold, m_batchVertexThreshold, m_parallelUploadVertexThreshold);
         qDebug("Using buffer strategy: %s",
                (m_bufferStrategy == GL_STATIC_DRAW
                 ? "static" : (m_bufferStrategy == GL_DYNAMIC_DRAW ? "dynamic" : "stream")));
@@ -1100,6 +1113,8 @@ Renderer::~Renderer()
 
     destroyGraphicsResources();
 
+    m_uploadThreadPool.reset();
+
     delete m_visualizer;
 }
 
@@ -1331,6 +1346,8 @@ void Renderer::nodeWasAdded(QSGNode *node, Node *shadowParent)
     if (node->type() == QSGNode::GeometryNodeType) {
         snode->data = m_elementAllocator.allocate();
         snode->element()->setNode(static_cast<QSGGeometryNode *>(node));
+        if (m_damageTracking)
+            markDamaged(snode->element());
 
     } else if (node->type() == QSGNode::ClipNodeType) {
         snode->data = new ClipBatchRootInfo;
@@ -1373,6 +1390,8 @@ void Renderer::nodeWasRemoved(Node *node)
             e->removed = true;
             m_elementsToDelete.add(e);
             e->node = nullptr;
+            if (e->damageBoundsValid)
+                m_damage |= e->damageBounds;
             if (e->root) {
                 BatchRootInfo *info = batchRootInfo(e->root);
                 info->availableOrders++;
@@ -1518,6 +1537,18 @@ void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
         }
     }
 
+    if (m_damageTracking && !(state & QSGNode::DirtyNodeRemoved)) {
+        if (node->type() == QSGNode::GeometryNodeType) {
+            if (state & (QSGNode::DirtyGeometry | QSGNode::DirtyMaterial | QSGNode::DirtyOpacity)) {
+                if (Element *e = shadowNode->element())
+                    markDamaged(e);
+            }
+        } else if (state & (QSGNode::DirtyMatrix | QSGNode::DirtyOpacity)
+                   || (state & QSGNode::DirtyGeometry && node->type() == QSGNode::ClipNodeType)) {
+            markSubtreeDamaged(shadowNode);
+        }
+    }
+
     if (state & QSGNode::DirtyGeometry && node->type() == QSGNode::GeometryNodeType) {
         QSGGeometryNode *gn = static_cast<QSGGeometryNode *>(node);
         Element *e = shadowNode->element();
@@ -2108,6 +2139,28 @@ void Renderer::uploadMergedElement(Element *e, int vaOffset, char **vertexData,
     *indexCount += iCount;
 }
 
+/* Writes the elements [from, to) recorded in m_mergedUploads for the merged batch \a b.
+ *
+ * Elements only write to their own, non-overlapping part of the buffers, so
+ * disjoint ranges can be uploaded on different threads.
+ */
+void Renderer::uploadMergedElements(Batch *b, int from, int to)
+{
+    for (int i = from; i < to; ++i) {
+        const MergedElementUpload &upload = m_mergedUploads.at(i);
+        char *vertexData = upload.vertexData;
+        char *zData = upload.zData;
+        char *indexData = upload.indexData;
+        quint16 iOffset16 = quint16(upload.iBase);
+        quint32 iOffset32 = upload.iBase;
+        void *iBasePtr = &iOffset16;
+        if (m_uint32IndexForRhi)
+            iBasePtr = &iOffset32;
+        int indexCount = 0;
+        uploadMergedElement(upload.element, b->positionAttribute, &vertexData, &zData, &indexData, iBasePtr, &indexCount);
+    }
+}
+
 QMatrix4x4 qsg_matrixForRoot(Node *node)
 {
     if (node->type() == QSGNode::TransformNodeType)
@@ -2219,8 +2272,7 @@ void Renderer::uploadBatch(Batch *b)
                 ? b->ibo.data
                 : zData + (int(m_useDepthBuffer) * b->vertexCount * sizeof(float));
 
-        quint16 iOffset16 = 0;
-        quint32 iOffset32 = 0;
+        quint32 iOffset = 0;
         e = b->first;
         uint verticesInSet = 0;
         // Start a new set already after 65534 vertices because 0xFFFF may be
@@ -2232,8 +2284,11 @@ void Renderer::uploadBatch(Batch *b)
         int drawSetIndices = separateIndexBuffer ? 0 : indexData - vertexData;
         const char *indexBase = separateIndexBuffer ? b->ibo.data : b->vbo.data;
         b->drawSets << DrawSet(0, zData - vertexData, drawSetIndices);
+        m_mergedUploads.reset();
         while (e) {
-            verticesInSet += e->node->geometry()->vertexCount();
+            QSGGeometry *eg = e->node->geometry();
+            const int vCount = eg->vertexCount();
+            verticesInSet += vCount;
             if (verticesInSet > verticesInSetLimit) {
                 b->drawSets.last().indexCount = indicesInSet;
                 if (g->drawingMode() == QSGGeometry::DrawTriangleStrip) {
@@ -2244,15 +2299,21 @@ void Renderer::uploadBatch(Batch *b)
                 b->drawSets << DrawSet(vertexData - b->vbo.data,
                                        zData - b->vbo.data,
                                        drawSetIndices);
-                iOffset16 = 0;
-                iOffset32 = 0;
-                verticesInSet = e->node->geometry()->vertexCount();
+                iOffset = 0;
+                verticesInSet = vCount;
                 indicesInSet = 0;
             }
-            void *iBasePtr = &iOffset16;
-            if (m_uint32IndexForRhi)
-                iBasePtr = &iOffset32;
-            uploadMergedElement(e, b->positionAttribute, &vertexData, &zData, &indexData, iBasePtr, &indicesInSet);
+
+            // Only record where the element goes, the data is written by uploadMergedElements().
+            // This has to match what uploadMergedElement() writes.
+            m_mergedUploads.add({ e, vertexData, zData, indexData, iOffset });
+            const int iCount = qsg_fixIndexCount(eg->indexCount() ? eg->indexCount() : vCount, g->drawingMode());
+            vertexData += vCount * eg->sizeOfVertex();
+            if (m_useDepthBuffer)
+                zData += vCount * sizeof(float);
+            indexData += iCount * mergedIndexElemSize();
+            indicesInSet += iCount;
+            iOffset += vCount;
             e = e->nextInBatch;
         }
         b->drawSets.last().indexCount = indicesInSet;
@@ -2262,6 +2323,27 @@ void Renderer::uploadBatch(Batch *b)
             b->drawSets.last().indices += 1 * mergedIndexElemSize();
             b->drawSets.last().indexCount -= 2;
         }
+
+        const int elementCount = m_mergedUploads.size();
+        if (m_parallelUploadVertexThreshold > 0 && b->vertexCount >= m_parallelUploadVertexThreshold && elementCount > 1) {
+            if (!m_uploadThreadPool) {
+                m_uploadThreadPool.reset(new QThreadPool);
+                m_uploadThreadPool->setMaxThreadCount(QThread::idealThreadCount() - 1);
+            }
+            // The render thread takes the first range itself
+            const int jobCount = qMin(elementCount, m_uploadThreadPool->maxThreadCount() + 1);
+            const int elementsPerJob = (elementCount + jobCount - 1) / jobCount;
+            for (int from = elementsPerJob; from < elementCount; from += elementsPerJob) {
+                const int to = qMin(from + elementsPerJob, elementCount);
+                m_uploadThreadPool->start(QRunnable::create([this, b, from, to]() {
+                    uploadMergedElements(b, from, to);
+                }));
+            }
+            uploadMergedElements(b, 0, elementsPerJob);
+            m_uploadThreadPool->waitForDone();
+        } else {
+            uploadMergedElements(b, 0, elementCount);
+        }
     } else {
         char *vboData = b->vbo.data;
         char *iboData = separateIndexBuffer ? b->ibo.data
@@ -2960,6 +3042,107 @@ void Renderer::setActiveRhiShader(QSGMaterialRhiShader *program, ShaderManager::
     m_currentMaterial = nullptr;
 }
 
+void Renderer::markDamaged(Element *e)
+{
+    if (!e->damaged) {
+        e->damaged = true;
+        m_damagedElements.add(e);
+    }
+}
+
+void Renderer::markSubtreeDamaged(Node *node)
+{
+    if (node->type() == QSGNode::GeometryNodeType) {
+        if (Element *e = node->element())
+            markDamaged(e);
+    }
+
+    SHADOWNODE_TRAVERSE(node)
+        markSubtreeDamaged(child);
+}
+
+/*
+ * Turns the elements marked in nodeChanged() into the area of the render
+ * target that differs from the previous frame: the union of where the
+ * changed elements were and where they are now. Anything that cannot be
+ * tracked per element, such as render nodes, the visualizer, or a change of
+ * the projection, viewport or clear color, damages the whole target.
+ *
+ * Must be called after the render lists are up to date (so that the roots
+ * of new elements are known) and before removed elements are deleted.
+ */
+void Renderer::updateDamage()
+{
+    bool full = m_fullDamage
+            || !m_renderNodeElements.isEmpty()
+            || m_visualizer->mode() != Visualizer::VisualizeNothing
+            || projectionMatrix() != m_damageProjectionMatrix
+            || viewportRect() != m_damageViewportRect
+            || clearColor() != m_damageClearColor;
+
+    m_damageProjectionMatrix = projectionMatrix();
+    m_damageViewportRect = viewportRect();
+    m_damageClearColor = clearColor();
+
+    // Scene coordinates to pixels, with a top-left origin.
+    const QRect vp = viewportRect();
+    QMatrix4x4 toTarget;
+    toTarget.translate(vp.x() + vp.width() * 0.5f, vp.y() + vp.height() * 0.5f);
+    toTarget.scale(vp.width() * 0.5f, (m_rhi->isYUpInNDC() ? -0.5f : 0.5f) * vp.height());
+    toTarget *= projectionMatrix();
+
+    for (int i = 0; i < m_damagedElements.size(); ++i) {
+        Element *e = m_damagedElements.at(i);
+        e->damaged = false;
+        if (e->removed || !e->node)
+            continue;
+
+        if (e->damageBoundsValid)
+            m_damage |= e->damageBounds;
+
+        e->ensureBoundsValid();
+        const QMatrix4x4 rootMatrix = e->root ? qsg_matrixForRoot(e->root) : QMatrix4x4();
+        if (e->boundsOutsideFloatRange || e->bounds.tl.x == -FLT_MAX || e->bounds.tl.y == -FLT_MAX
+                || e->bounds.br.x == FLT_MAX || e->bounds.br.y == FLT_MAX
+                || !rootMatrix.isAffine() || !e->node->matrix()->isAffine()) {
+            e->damageBoundsValid = false;
+            full = true;
+            continue;
+        }
+
+        Rect r = e->bounds;
+        r.map(rootMatrix);
+        r.map(toTarget);
+        e->damageBounds = r;
+        e->damageBoundsValid = true;
+        m_damage |= r;
+    }
+    m_damagedElements.reset();
+
+    if (full) {
+        m_damageRect = vp;
+    } else if (m_damage.tl.x < m_damage.br.x && m_damage.tl.y < m_damage.br.y) {
+        // Keep a pixel of margin for geometry that ends up partially covering
+        // pixels at the edges.
+        const QRect r = QRectF(QPointF(m_damage.tl.x, m_damage.tl.y),
+                               QPointF(m_damage.br.x, m_damage.br.y)).toAlignedRect();
+        m_damageRect = r.adjusted(-1, -1, 1, 1) & vp;
+    } else {
+        m_damageRect = QRect();
+    }
+
+    m_fullDamage = false;
+    m_damage.set(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+}
+
+bool Renderer::damageRect(QRect *rect) const
+{
+    if (!m_damageTracking)
+        return false;
+    *rect = m_damageRect;
+    return true;
+}
+
 void Renderer::updateLineWidth(QSGGeometry *g) // legacy (GL-only)
 {
     if (g->drawingMode() == GL_LINE_STRIP || g->drawingMode() == GL_LINE_LOOP || g->drawingMode() == GL_LINES)
@@ -4179,13 +4362,24 @@ void Renderer::render()
         QSGNodeDumper::dump(rootNode());
     }
 
+    // Per-phase timings are reported with QSG_RENDERER_DEBUG=render and with
+    // the qt.scenegraph.time.renderer category (QSG_RENDER_TIMING).
+    const bool profileFrames = debug_render() || QSG_LOG_TIME_RENDERER().isDebugEnabled();
     QElapsedTimer timer;
-    quint64 timeRenderLists = 0;
-    quint64 timePrepareOpaque = 0;
-    quint64 timePrepareAlpha = 0;
-    quint64 timeSorting = 0;
-    quint64 timeUploadOpaque = 0;
-    quint64 timeUploadAlpha = 0;
+    qint64 timeRenderLists = 0;
+    qint64 timePrepareOpaque = 0;
+    qint64 timePrepareAlpha = 0;
+    qint64 timeSorting = 0;
+    qint64 timeUploadOpaque = 0;
+    qint64 timeUploadAlpha = 0;
+    auto lap = [&timer]() {
+        const qint64 elapsed = timer.nsecsElapsed();
+        timer.restart();
+        return elapsed;
+    };
+
+    if (Q_UNLIKELY(profileFrames))
+        timer.start();
 
     if (Q_UNLIKELY(debug_render() || debug_build())) {
         QByteArray type("rebuild:");
@@ -4203,7 +4397,6 @@ void Renderer::render()
         }
 
         qDebug() << "Renderer::render()" << this << type;
-        timer.start();
     }
 
     if (!m_rhi) {
@@ -4235,7 +4428,10 @@ void Renderer::render()
             }
         }
     }
-    if (Q_UNLIKELY(debug_render())) timeRenderLists = timer.restart();
+    if (Q_UNLIKELY(profileFrames)) timeRenderLists = lap();
+
+    if (m_damageTracking)
+        updateDamage();
 
     for (int i=0; i<m_opaqueBatches.size(); ++i)
         m_opaqueBatches.at(i)->cleanupRemovedElements();
@@ -4248,9 +4444,9 @@ void Renderer::render()
 
     if (m_rebuild & BuildBatches) {
         prepareOpaqueBatches();
-        if (Q_UNLIKELY(debug_render())) timePrepareOpaque = timer.restart();
+        if (Q_UNLIKELY(profileFrames)) timePrepareOpaque = lap();
         prepareAlphaBatches();
-        if (Q_UNLIKELY(debug_render())) timePrepareAlpha = timer.restart();
+        if (Q_UNLIKELY(profileFrames)) timePrepareAlpha = lap();
 
         if (Q_UNLIKELY(debug_build())) {
             qDebug("Opaque Batches:");
@@ -4271,7 +4467,7 @@ void Renderer::render()
             }
         }
     } else {
-        if (Q_UNLIKELY(debug_render())) timePrepareOpaque = timePrepareAlpha = timer.restart();
+        if (Q_UNLIKELY(profileFrames)) timePrepareOpaque = timePrepareAlpha = lap();
     }
 
 
@@ -4292,7 +4488,7 @@ void Renderer::render()
                  : 0;
     }
 
-    if (Q_UNLIKELY(debug_render())) timeSorting = timer.restart();
+    if (Q_UNLIKELY(profileFrames)) timeSorting = lap();
 
     int largestVBO = 0;
     int largestIBO = 0;
@@ -4304,7 +4500,7 @@ void Renderer::render()
         largestIBO = qMax(b->ibo.size, largestIBO);
         uploadBatch(b);
     }
-    if (Q_UNLIKELY(debug_render())) timeUploadOpaque = timer.restart();
+    if (Q_UNLIKELY(profileFrames)) timeUploadOpaque = lap();
 
 
     if (Q_UNLIKELY(debug_upload())) qDebug("Uploading Alpha Batches:");
@@ -4314,7 +4510,7 @@ void Renderer::render()
         largestVBO = qMax(b->vbo.size, largestVBO);
         largestIBO = qMax(b->ibo.size, largestIBO);
     }
-    if (Q_UNLIKELY(debug_render())) timeUploadAlpha = timer.restart();
+    if (Q_UNLIKELY(profileFrames)) timeUploadAlpha = lap();
 
     if (largestVBO * 2 < m_vertexUploadPool.size())
         m_vertexUploadPool.resize(largestVBO * 2);
@@ -4323,13 +4519,23 @@ void Renderer::render()
 
     renderBatches();
 
-    if (Q_UNLIKELY(debug_render())) {
-        qDebug(" -> times: build: %d, prepare(opaque/alpha): %d/%d, sorting: %d, upload(opaque/alpha): %d/%d, render: %d",
-               (int) timeRenderLists,
-               (int) timePrepareOpaque, (int) timePrepareAlpha,
-               (int) timeSorting,
-               (int) timeUploadOpaque, (int) timeUploadAlpha,
-               (int) timer.elapsed());
+    if (Q_UNLIKELY(profileFrames)) {
+        const qint64 timeRender = timer.nsecsElapsed();
+        if (debug_render()) {
+            qDebug(" -> times: build: %d, prepare(opaque/alpha): %d/%d, sorting: %d, upload(opaque/alpha): %d/%d, render: %d",
+                   int(timeRenderLists / 1000000),
+                   int(timePrepareOpaque / 1000000), int(timePrepareAlpha / 1000000),
+                   int(timeSorting / 1000000),
+                   int(timeUploadOpaque / 1000000), int(timeUploadAlpha / 1000000),
+                   int(timeRender / 1000000));
+        }
+        qCDebug(QSG_LOG_TIME_RENDERER,
+                "batch renderer phases (us): build=%d, prepare(opaque/alpha)=%d/%d, sorting=%d, upload(opaque/alpha)=%d/%d, render=%d",
+                int(timeRenderLists / 1000),
+                int(timePrepareOpaque / 1000), int(timePrepareAlpha / 1000),
+                int(timeSorting / 1000),
+                int(timeUploadOpaque / 1000), int(timeUploadAlpha / 1000),
+                int(timeRender / 1000));
     }
 
     m_rebuild = 0;
@@ -62,6 +62,7 @@
 
 #include <QtCore/QBitArray>
 #include <QtCore/QStack>
+#include <QtCore/QThreadPool>
 #include <QtGui/QOpenGLFunctions>
 
 #include <QtGui/private/qrhi_p.h>
@@ -316,6 +317,8 @@ struct Element {
         , orphaned(false)
         , isRenderNode(false)
         , isMaterialBlended(false)
+        , damageBoundsValid(false)
+        , damaged(false)
     {
     }
 
@@ -336,6 +339,7 @@ struct Element {
     Node *root = nullptr;
 
     Rect bounds; // in device coordinates
+    Rect damageBounds; // in render target pixels, as of the last frame
 
     int order = 0;
     QRhiShaderResourceBindings *srb = nullptr;
@@ -348,6 +352,8 @@ struct Element {
     uint orphaned : 1;
     uint isRenderNode : 1;
     uint isMaterialBlended : 1;
+    uint damageBoundsValid : 1;
+    uint damaged : 1;
 };
 
 struct RenderNodeElement : public Element {
@@ -764,6 +770,7 @@ protected:
     void nodeChanged(QSGNode *node, QSGNode::DirtyState state) override;
     void render() override;
     void releaseCachedResources() override;
+    bool damageRect(QRect *rect) const override;
 
 private:
     enum RebuildFlag {
@@ -795,6 +802,7 @@ private:
 
     void uploadBatch(Batch *b);
     void uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, void *iBasePtr, int *indexCount);
+    void uploadMergedElements(Batch *b, int from, int to);
 
     struct PreparedRenderBatch {
         const Batch *batch;
@@ -841,6 +849,10 @@ private:
     BatchRootInfo *batchRootInfo(Node *node);
     void updateLineWidth(QSGGeometry *g);
 
+    void markDamaged(Element *e);
+    void markSubtreeDamaged(Node *node);
+    void updateDamage();
+
     inline Batch *newBatch();
     void invalidateAndRecycleBatch(Batch *b);
 
@@ -875,9 +887,21 @@ private:
     GLuint m_bufferStrategy;
     int m_batchNodeThreshold;
     int m_batchVertexThreshold;
+    int m_parallelUploadVertexThreshold;
 
     Visualizer *m_visualizer;
 
+    // Area of the render target that changed since the previous frame,
+    // collected when QSG_PRESENT_DAMAGE is set.
+    bool m_damageTracking;
+    bool m_fullDamage;
+    Rect m_damage;
+    QRect m_damageRect;
+    QDataBuffer<Element *> m_damagedElements;
+    QMatrix4x4 m_damageProjectionMatrix;
+    QRect m_damageViewportRect;
+    QColor m_damageClearColor;
+
     // Stuff used during rendering only...
     ShaderManager *m_shaderManager; // per rendercontext, shared
     QSGMaterial *m_currentMaterial;
@@ -897,6 +921,19 @@ private:
 
     QDataBuffer<char> m_vertexUploadPool;
     QDataBuffer<char> m_indexUploadPool;
+
+    // Destinations of the elements of the merged batch being uploaded, so that
+    // large batches can be filled in parallel on m_uploadThreadPool.
+    struct MergedElementUpload {
+        Element *element;
+        char *vertexData;
+        char *zData;
+        char *indexData;
+        quint32 iBase;
+    };
+    QDataBuffer<MergedElementUpload> m_mergedUploads;
+    QScopedPointer<QThreadPool> m_uploadThreadPool;
+
     // For minimal OpenGL core profile support
     QOpenGLVertexArrayObject *m_vao;
 
@@ -99,6 +99,7 @@ public:
     virtual void setCustomRenderMode(const QByteArray &) { }
     virtual bool hasCustomRenderModeWithContinuousUpdate() const { return false; }
     virtual void releaseCachedResources() { }
+    virtual bool damageRect(QRect *) const { return false; }
 
     void clearChangedFlag() { m_changed_emitted = false; }
 
@@ -435,6 +435,8 @@ void QSGGuiThreadRenderLoop::windowDestroyed(QQuickWindow *window)
     if (m_windows.size() == 0) {
         rc->invalidate();
         d->rhi = nullptr;
+        if (rhi)
+            QSGRhiSupport::instance()->savePipelineCache(rhi);
         delete rhi;
         rhi = nullptr;
         delete gl;
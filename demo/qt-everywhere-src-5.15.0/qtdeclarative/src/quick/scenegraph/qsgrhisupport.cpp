@@ -43,6 +43,8 @@
 #  include "qsgdefaultrendercontext_p.h"
 #endif
 #include <QtGui/qwindow.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qsavefile.h>
 
 #if QT_CONFIG(vulkan)
 #include <QtGui/qvulkaninstance.h>
@@ -190,6 +192,9 @@ void QSGRhiSupport::applySettings()
     if (m_killDeviceFrameCount > 0 && m_rhiBackend == QRhi::D3D11)
         qDebug("Graphics device will be reset every %d frames", m_killDeviceFrameCount);
 
+    // pipeline cache contents restored when creating and saved when destroying the QRhi
+    m_pipelineCacheFile = qEnvironmentVariable("QSG_RHI_PIPELINE_CACHE");
+
     const QString backendName = rhiBackendName();
     qCDebug(QSG_LOG_INFO,
             "Using QRhi with backend %s\n  graphics API debug/validation layers: %d\n  QRhi profiling and debug markers: %d",
@@ -542,10 +547,47 @@ QRhi *QSGRhiSupport::createRhi(QWindow *window, QOffscreenSurface *offscreenSurf
 
     if (!rhi)
         qWarning("Failed to create RHI (backend %d)", backend);
+    else
+        restorePipelineCache(rhi);
 
     return rhi;
 }
 
+void QSGRhiSupport::restorePipelineCache(QRhi *rhi)
+{
+    if (m_pipelineCacheFile.isEmpty() || !rhi->isFeatureSupported(QRhi::PipelineCache))
+        return;
+
+    QFile f(m_pipelineCacheFile);
+    if (!f.open(QIODevice::ReadOnly)) {
+        // Expected on the first run
+        qCDebug(QSG_LOG_INFO, "No pipeline cache found at %s", qPrintable(m_pipelineCacheFile));
+        return;
+    }
+    const QByteArray data = f.readAll();
+    qCDebug(QSG_LOG_INFO, "Restoring %d bytes of pipeline cache data from %s", data.size(), qPrintable(m_pipelineCacheFile));
+    rhi->setPipelineCacheData(data);
+}
+
+// To be called by the render loops right before destroying the QRhi, but not
+// after losing the device.
+void QSGRhiSupport::savePipelineCache(QRhi *rhi)
+{
+    if (m_pipelineCacheFile.isEmpty() || !rhi->isFeatureSupported(QRhi::PipelineCache))
+        return;
+
+    const QByteArray data = rhi->pipelineCacheData();
+    if (data.isEmpty())
+        return;
+
+    QSaveFile f(m_pipelineCacheFile);
+    if (!f.open(QIODevice::WriteOnly) || f.write(data) != data.size() || !f.commit()) {
+        qWarning("Failed to write pipeline cache to %s: %s", qPrintable(m_pipelineCacheFile), qPrintable(f.errorString()));
+        return;
+    }
+    qCDebug(QSG_LOG_INFO, "Saved %d bytes of pipeline cache data to %s", data.size(), qPrintable(m_pipelineCacheFile));
+}
+
 QImage QSGRhiSupport::grabAndBlockInCurrentFrame(QRhi *rhi, QRhiSwapChain *swapchain)
 {
     Q_ASSERT(rhi->isRecordingFrame());
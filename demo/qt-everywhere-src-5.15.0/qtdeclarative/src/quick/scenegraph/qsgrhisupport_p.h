@@ -125,6 +125,7 @@ public:
 
     QOffscreenSurface *maybeCreateOffscreenSurface(QWindow *window);
     QRhi *createRhi(QWindow *window, QOffscreenSurface *offscreenSurface);
+    void savePipelineCache(QRhi *rhi);
 
     QImage grabAndBlockInCurrentFrame(QRhi *rhi, QRhiSwapChain *swapchain);
 
@@ -134,6 +135,7 @@ private:
     QSGRhiSupport();
     void applySettings();
     static QSGRhiSupport *staticInst();
+    void restorePipelineCache(QRhi *rhi);
     struct {
         bool valid = false;
         QSGRendererInterface::GraphicsApi api;
@@ -141,6 +143,7 @@ private:
     } m_requested;
     QRhi::Implementation m_rhiBackend = QRhi::Null;
     int m_killDeviceFrameCount;
+    QString m_pipelineCacheFile;
     uint m_set : 1;
     uint m_enableRhi : 1;
     uint m_debugLayer : 1;
@@ -587,6 +587,8 @@ void QSGRenderThread::invalidateGraphics(QQuickWindow *window, bool inDestructor
         }
         delete gl;
         gl = nullptr;
+        if (rhi)
+            QSGRhiSupport::instance()->savePipelineCache(rhi);
         delete rhi;
         rhi = nullptr;
         qCDebug(QSG_LOG_RENDERLOOP, QSG_RT_PAD, "- invalidated OpenGL");
@@ -88,22 +88,28 @@ Manager::Manager(QSGDefaultRenderContext *rc, const QSize &surfacePixelSize, QSu
     m_atlas_size_limit = qt_sg_envInt("QSG_ATLAS_SIZE_LIMIT", qMax(w, h) / 2);
     m_atlas_size = QSize(w, h);
 
-    qCDebug(QSG_LOG_INFO, "rhi texture atlas dimensions: %dx%d", w, h);
+    // Once the first page is full, further pages are allocated on demand
+    // rather than falling back to standalone textures, which cannot be
+    // batched. Each page costs one w x h RGBA texture.
+    m_atlas_max_pages = qMax(1, qt_sg_envInt("QSG_ATLAS_MAX_PAGES", 4));
+
+    qCDebug(QSG_LOG_INFO, "rhi texture atlas dimensions: %dx%d, up to %d pages",
+            w, h, m_atlas_max_pages);
 }
 
 Manager::~Manager()
 {
-    Q_ASSERT(m_atlas == nullptr);
+    Q_ASSERT(m_atlas_pages.isEmpty());
     Q_ASSERT(m_atlases.isEmpty());
 }
 
 void Manager::invalidate()
 {
-    if (m_atlas) {
-        m_atlas->invalidate();
-        m_atlas->deleteLater();
-        m_atlas = nullptr;
+    for (Atlas *atlas : qAsConst(m_atlas_pages)) {
+        atlas->invalidate();
+        atlas->deleteLater();
     }
+    m_atlas_pages.clear();
 
  #if 0
     QHash<unsigned int, QSGCompressedAtlasTexture::Atlas*>::iterator i = m_atlases.begin();
@@ -120,15 +126,48 @@ QSGTexture *Manager::create(const QImage &image, bool hasAlphaChannel)
 {
     Texture *t = nullptr;
     if (image.width() < m_atlas_size_limit && image.height() < m_atlas_size_limit) {
-        if (!m_atlas)
-            m_atlas = new Atlas(m_rc, m_atlas_size);
-        t = m_atlas->create(image);
+        // Try the existing pages in order, so that the early pages stay
+        // densely packed and the later ones drain as their images go away.
+        for (Atlas *atlas : qAsConst(m_atlas_pages)) {
+            t = atlas->create(image);
+            if (t)
+                break;
+        }
+        if (!t && m_atlas_pages.size() < m_atlas_max_pages) {
+            if (!m_atlas_pages.isEmpty())
+                logAtlasUsage("page full");
+            Atlas *atlas = new Atlas(m_rc, m_atlas_size);
+            m_atlas_pages.append(atlas);
+            t = atlas->create(image);
+        }
+        if (!t && !m_atlas_pages.isEmpty() && QSG_LOG_INFO().isDebugEnabled()) {
+            qCDebug(QSG_LOG_INFO, "rhi texture atlas: no room for %dx%d image, using a standalone texture",
+                    image.width(), image.height());
+            logAtlasUsage("all pages full");
+        }
         if (t && !hasAlphaChannel && t->hasAlphaChannel())
             t->setHasAlphaChannel(false);
     }
     return t;
 }
 
+void Manager::logAtlasUsage(const char *reason) const
+{
+    if (!QSG_LOG_INFO().isDebugEnabled())
+        return;
+
+    // Occupancy is the share of the page covered by live sub-textures
+    // (including their padding). A page that rejects an image while its
+    // occupancy is well below 100% is fragmented rather than full.
+    qCDebug(QSG_LOG_INFO, "rhi texture atlas usage (%s): %d of at most %d pages",
+            reason, m_atlas_pages.size(), m_atlas_max_pages);
+    for (int i = 0; i < m_atlas_pages.size(); ++i) {
+        const Atlas *atlas = m_atlas_pages.at(i);
+        qCDebug(QSG_LOG_INFO, "  page %d: %d textures, %.1f%% occupied",
+                i, atlas->textureCount(), atlas->occupancy() * 100.0);
+    }
+}
+
 QSGTexture *Manager::create(const QSGCompressedTextureFactory *factory)
 {
     Q_UNUSED(factory);
@@ -227,10 +266,19 @@ void AtlasBase::updateRhiTexture(QRhiResourceUpdateBatch *resourceUpdates)
 void AtlasBase::remove(TextureBase *t)
 {
     QRect atlasRect = t->atlasSubRect();
-    m_allocator.deallocate(atlasRect);
+    if (m_allocator.deallocate(atlasRect)) {
+        --m_texture_count;
+        m_used_area -= qint64(atlasRect.width()) * atlasRect.height();
+    }
     m_pending_uploads.removeOne(t);
 }
 
+qreal AtlasBase::occupancy() const
+{
+    const qint64 total = qint64(m_size.width()) * m_size.height();
+    return total > 0 ? qreal(m_used_area) / total : 0.0;
+}
+
 Atlas::Atlas(QSGDefaultRenderContext *rc, const QSize &size)
     : AtlasBase(rc, size)
 {
@@ -256,6 +304,8 @@ Texture *Atlas::create(const QImage &image)
     if (rect.width() > 0 && rect.height() > 0) {
         Texture *t = new Texture(this, rect, image);
         m_pending_uploads << t;
+        ++m_texture_count;
+        m_used_area += qint64(rect.width()) * rect.height();
         return t;
     }
     return nullptr;
@@ -87,14 +87,18 @@ public:
     void invalidate();
 
 private:
+    void logAtlasUsage(const char *reason) const;
+
     QSGDefaultRenderContext *m_rc;
     QRhi *m_rhi;
-    Atlas *m_atlas = nullptr;
+    // atlas pages for uncompressed images, filled in order
+    QVector<Atlas *> m_atlas_pages;
     // set of atlases for different compressed formats
     QHash<unsigned int, QSGCompressedAtlasTexture::Atlas*> m_atlases;
 
     QSize m_atlas_size;
     int m_atlas_size_limit;
+    int m_atlas_max_pages;
 };
 
 class AtlasBase : public QObject
@@ -112,6 +116,8 @@ public:
     QRhi *rhi() const { return m_rhi; }
     QRhiTexture *texture() const { return m_texture; }
     QSize size() const { return m_size; }
+    int textureCount() const { return m_texture_count; }
+    qreal occupancy() const;
 
 protected:
     virtual bool generateTexture() = 0;
@@ -124,6 +130,8 @@ protected:
     QRhiTexture *m_texture = nullptr;
     QSize m_size;
     QVector<TextureBase *> m_pending_uploads;
+    int m_texture_count = 0;
+    qint64 m_used_area = 0;
     friend class TextureBase;
     friend class TextureBasePrivate;
 
@@ -727,6 +727,14 @@ QQuickShape::RendererType QQuickShape::rendererType() const
     results of the path rendering are shown only when all the asynchronous
     work has been finished.
 
+    The results of the triangulation are cached and shared between all Shape
+    items, so that paths with the same geometry and stroke parameters are only
+    triangulated once. Changing only colors never causes triangulation. Paths
+    found in the cache become available right away, also when this property is
+    \c true. The size of the cache, in kilobytes, can be changed with the
+    \c QT_QUICKSHAPES_GEOMETRY_CACHE_SIZE environment variable. Setting it to
+    \c 0 disables the cache. The default is 4096.
+
     The default value is \c false.
  */
 
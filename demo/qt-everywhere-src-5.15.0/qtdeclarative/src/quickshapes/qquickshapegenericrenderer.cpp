@@ -44,6 +44,8 @@
 
 #if QT_CONFIG(thread)
 #include <QThreadPool>
+#include <QCache>
+#include <QMutex>
 #endif
 
 #if QT_CONFIG(opengl)
@@ -77,6 +79,145 @@ static inline QQuickShapeGenericRenderer::Color4ub colorToColor4ub(const QColor
     return color;
 }
 
+// Triangulation results are shared between all Shape items, keyed by
+// everything that affects the generated vertices. A path used by many items
+// (icons, map markers) is then triangulated only once, while items with
+// another color get a recolored copy of the cached vertices. The cache is
+// used from the path worker threads as well, hence the mutex.
+struct QQuickShapeGeometryCacheEntry
+{
+    QQuickShapeGenericRenderer::VertexContainerType vertices;
+    QQuickShapeGenericRenderer::IndexContainerType indices;
+    QSGGeometry::Type indexType;
+};
+
+struct QQuickShapeGeometryCache
+{
+    QQuickShapeGeometryCache()
+    {
+        bool ok = false;
+        const int sizeKb = qEnvironmentVariableIntValue("QT_QUICKSHAPES_GEOMETRY_CACHE_SIZE", &ok);
+        cache.setMaxCost(ok ? qMax(0, sizeKb) * 1024 : 4 * 1024 * 1024);
+    }
+
+    QMutex mutex;
+    QCache<QByteArray, QQuickShapeGeometryCacheEntry> cache;
+};
+
+Q_GLOBAL_STATIC(QQuickShapeGeometryCache, shapeGeometryCache)
+
+template <typename T>
+static inline void appendToCacheKey(QByteArray *key, const T &value)
+{
+    key->append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+static void appendPathToCacheKey(QByteArray *key, const QPainterPath &path)
+{
+    const int count = path.elementCount();
+    key->reserve(key->size() + count * int(sizeof(int) + 2 * sizeof(qreal)));
+    for (int i = 0; i < count; ++i) {
+        const QPainterPath::Element e = path.elementAt(i);
+        appendToCacheKey(key, int(e.type));
+        appendToCacheKey(key, e.x);
+        appendToCacheKey(key, e.y);
+    }
+}
+
+// An empty key means the cache is disabled.
+static QByteArray fillCacheKey(const QPainterPath &path, bool supportsElementIndexUint)
+{
+    QByteArray key;
+    if (!shapeGeometryCache()->cache.maxCost())
+        return key;
+    key.append('F');
+    appendToCacheKey(&key, int(path.fillRule()));
+    appendToCacheKey(&key, supportsElementIndexUint);
+    appendPathToCacheKey(&key, path);
+    return key;
+}
+
+static QByteArray strokeCacheKey(const QPainterPath &path, const QPen &pen, const QSize &clipSize)
+{
+    QByteArray key;
+    if (!shapeGeometryCache()->cache.maxCost())
+        return key;
+    key.append('S');
+    appendToCacheKey(&key, pen.widthF());
+    appendToCacheKey(&key, int(pen.style()));
+    appendToCacheKey(&key, int(pen.capStyle()));
+    appendToCacheKey(&key, int(pen.joinStyle()));
+    appendToCacheKey(&key, pen.miterLimit());
+    appendToCacheKey(&key, pen.isCosmetic());
+    appendToCacheKey(&key, clipSize.width());
+    appendToCacheKey(&key, clipSize.height());
+    if (pen.style() != Qt::SolidLine) {
+        const QVector<qreal> dashPattern = pen.dashPattern();
+        appendToCacheKey(&key, pen.dashOffset());
+        appendToCacheKey(&key, dashPattern.count());
+        for (qreal dash : dashPattern)
+            appendToCacheKey(&key, dash);
+    }
+    appendPathToCacheKey(&key, path);
+    return key;
+}
+
+static void recolorVertices(QQuickShapeGenericRenderer::VertexContainerType *vertices,
+                            const QQuickShapeGenericRenderer::Color4ub &color)
+{
+    if (vertices->isEmpty())
+        return;
+    const QSGGeometry::ColoredPoint2D &first(vertices->constFirst());
+    if (first.r == color.r && first.g == color.g && first.b == color.b && first.a == color.a)
+        return; // keep sharing the data with the cache
+    ColoredVertex *vdst = reinterpret_cast<ColoredVertex *>(vertices->data());
+    for (int i = 0; i < vertices->count(); ++i)
+        vdst[i].color = color;
+}
+
+static bool findCachedGeometry(const QByteArray &key,
+                               const QQuickShapeGenericRenderer::Color4ub &color,
+                               QQuickShapeGenericRenderer::VertexContainerType *vertices,
+                               QQuickShapeGenericRenderer::IndexContainerType *indices = nullptr,
+                               QSGGeometry::Type *indexType = nullptr)
+{
+    if (key.isEmpty())
+        return false;
+    {
+        QQuickShapeGeometryCache *c = shapeGeometryCache();
+        QMutexLocker lock(&c->mutex);
+        const QQuickShapeGeometryCacheEntry *e = c->cache.object(key);
+        if (!e)
+            return false;
+        *vertices = e->vertices;
+        if (indices) {
+            *indices = e->indices;
+            *indexType = e->indexType;
+        }
+    }
+    recolorVertices(vertices, color);
+    return true;
+}
+
+static void insertCachedGeometry(const QByteArray &key,
+                                 const QQuickShapeGenericRenderer::VertexContainerType &vertices,
+                                 const QQuickShapeGenericRenderer::IndexContainerType &indices = QQuickShapeGenericRenderer::IndexContainerType(),
+                                 QSGGeometry::Type indexType = QSGGeometry::UnsignedIntType)
+{
+    if (key.isEmpty())
+        return;
+    QQuickShapeGeometryCacheEntry *e = new QQuickShapeGeometryCacheEntry;
+    e->vertices = vertices;
+    e->indices = indices;
+    e->indexType = indexType;
+    const int cost = key.size()
+            + vertices.count() * int(sizeof(QSGGeometry::ColoredPoint2D))
+            + indices.count() * int(sizeof(quint32));
+    QQuickShapeGeometryCache *c = shapeGeometryCache();
+    QMutexLocker lock(&c->mutex);
+    c->cache.insert(key, e, cost); // deletes e right away when it is too expensive
+}
+
 QQuickShapeGenericStrokeFillNode::QQuickShapeGenericStrokeFillNode(QQuickWindow *window)
     : m_material(nullptr)
 {
@@ -265,13 +406,14 @@ void QQuickShapeGenericRenderer::setFillGradient(int index, QQuickShapeGradient
 
 void QQuickShapeFillRunnable::run()
 {
-    QQuickShapeGenericRenderer::triangulateFill(path, fillColor, &fillVertices, &fillIndices, &indexType, supportsElementIndexUint);
+    QQuickShapeGenericRenderer::triangulateFill(path, fillColor, &fillVertices, &fillIndices, &indexType,
+                                                supportsElementIndexUint, cacheKey);
     emit done(this);
 }
 
 void QQuickShapeStrokeRunnable::run()
 {
-    QQuickShapeGenericRenderer::triangulateStroke(path, pen, strokeColor, &strokeVertices, clipSize);
+    QQuickShapeGenericRenderer::triangulateStroke(path, pen, strokeColor, &strokeVertices, clipSize, cacheKey);
     emit done(this);
 }
 
@@ -334,7 +476,14 @@ void QQuickShapeGenericRenderer::endSync(bool async)
             d.path.setFillRule(d.fillRule);
             if (m_api == QSGRendererInterface::Unknown)
                 m_api = m_item->window()->rendererInterface()->graphicsApi();
-            if (async) {
+            const bool supportsElementIndexUint = q_supportsElementIndexUint(m_api);
+            const QByteArray cacheKey = fillCacheKey(d.path, supportsElementIndexUint);
+            if (findCachedGeometry(cacheKey, d.fillColor, &d.fillVertices, &d.fillIndices, &d.indexType)) {
+                if (d.pendingFill) {
+                    d.pendingFill->orphaned = true;
+                    d.pendingFill = nullptr;
+                }
+            } else if (async) {
                 QQuickShapeFillRunnable *r = new QQuickShapeFillRunnable;
                 r->setAutoDelete(false);
                 if (d.pendingFill)
@@ -342,7 +491,8 @@ void QQuickShapeGenericRenderer::endSync(bool async)
                 d.pendingFill = r;
                 r->path = d.path;
                 r->fillColor = d.fillColor;
-                r->supportsElementIndexUint = q_supportsElementIndexUint(m_api);
+                r->supportsElementIndexUint = supportsElementIndexUint;
+                r->cacheKey = cacheKey;
                 // Unlikely in practice but in theory m_sp could be
                 // resized. Therefore, capture 'i' instead of 'd'.
                 QObject::connect(r, &QQuickShapeFillRunnable::done, qApp, [this, i](QQuickShapeFillRunnable *r) {
@@ -367,12 +517,20 @@ void QQuickShapeGenericRenderer::endSync(bool async)
                 pathWorkThreadPool->start(r);
 #endif
             } else {
-                triangulateFill(d.path, d.fillColor, &d.fillVertices, &d.fillIndices, &d.indexType, q_supportsElementIndexUint(m_api));
+                triangulateFill(d.path, d.fillColor, &d.fillVertices, &d.fillIndices, &d.indexType,
+                                supportsElementIndexUint, cacheKey);
             }
         }
 
         if ((d.syncDirty & DirtyStrokeGeom) && d.strokeWidth >= 0.0f && d.strokeColor.a) {
-            if (async) {
+            const QSize clipSize(m_item->width(), m_item->height());
+            const QByteArray cacheKey = strokeCacheKey(d.path, d.pen, clipSize);
+            if (findCachedGeometry(cacheKey, d.strokeColor, &d.strokeVertices)) {
+                if (d.pendingStroke) {
+                    d.pendingStroke->orphaned = true;
+                    d.pendingStroke = nullptr;
+                }
+            } else if (async) {
                 QQuickShapeStrokeRunnable *r = new QQuickShapeStrokeRunnable;
                 r->setAutoDelete(false);
                 if (d.pendingStroke)
@@ -381,7 +539,8 @@ void QQuickShapeGenericRenderer::endSync(bool async)
                 r->path = d.path;
                 r->pen = d.pen;
                 r->strokeColor = d.strokeColor;
-                r->clipSize = QSize(m_item->width(), m_item->height());
+                r->clipSize = clipSize;
+                r->cacheKey = cacheKey;
                 QObject::connect(r, &QQuickShapeStrokeRunnable::done, qApp, [this, i](QQuickShapeStrokeRunnable *r) {
                     if (!r->orphaned && i < m_sp.count()) {
                         ShapePathData &d(m_sp[i]);
@@ -400,8 +559,7 @@ void QQuickShapeGenericRenderer::endSync(bool async)
                 pathWorkThreadPool->start(r);
 #endif
             } else {
-                triangulateStroke(d.path, d.pen, d.strokeColor, &d.strokeVertices,
-                                  QSize(m_item->width(), m_item->height()));
+                triangulateStroke(d.path, d.pen, d.strokeColor, &d.strokeVertices, clipSize, cacheKey);
             }
         }
     }
@@ -429,7 +587,8 @@ void QQuickShapeGenericRenderer::triangulateFill(const QPainterPath &path,
                                                     VertexContainerType *fillVertices,
                                                     IndexContainerType *fillIndices,
                                                     QSGGeometry::Type *indexType,
-                                                    bool supportsElementIndexUint)
+                                                    bool supportsElementIndexUint,
+                                                    const QByteArray &cacheKey)
 {
     const QVectorPath &vp = qtVectorPathForPath(path);
 
@@ -454,13 +613,16 @@ void QQuickShapeGenericRenderer::triangulateFill(const QPainterPath &path,
         indexByteSize = ts.indices.size() * sizeof(quint32);
     }
     memcpy(fillIndices->data(), ts.indices.data(), indexByteSize);
+
+    insertCachedGeometry(cacheKey, *fillVertices, *fillIndices, *indexType);
 }
 
 void QQuickShapeGenericRenderer::triangulateStroke(const QPainterPath &path,
                                                       const QPen &pen,
                                                       const Color4ub &strokeColor,
                                                       VertexContainerType *strokeVertices,
-                                                      const QSize &clipSize)
+                                                      const QSize &clipSize,
+                                                      const QByteArray &cacheKey)
 {
     const QVectorPath &vp = qtVectorPathForPath(path);
     const QRectF clip(QPointF(0, 0), clipSize);
@@ -482,6 +644,7 @@ void QQuickShapeGenericRenderer::triangulateStroke(const QPainterPath &path,
 
     if (!stroker.vertexCount()) {
         strokeVertices->clear();
+        insertCachedGeometry(cacheKey, *strokeVertices);
         return;
     }
 
@@ -491,6 +654,8 @@ void QQuickShapeGenericRenderer::triangulateStroke(const QPainterPath &path,
     const float *vsrc = stroker.vertices();
     for (int i = 0; i < vertexCount; ++i)
         vdst[i].set(vsrc[i * 2], vsrc[i * 2 + 1], strokeColor);
+
+    insertCachedGeometry(cacheKey, *strokeVertices);
 }
 
 void QQuickShapeGenericRenderer::setRootNode(QQuickShapeGenericNode *node)
@@ -116,12 +116,14 @@ public:
                                 VertexContainerType *fillVertices,
                                 IndexContainerType *fillIndices,
                                 QSGGeometry::Type *indexType,
-                                bool supportsElementIndexUint);
+                                bool supportsElementIndexUint,
+                                const QByteArray &cacheKey = QByteArray());
     static void triangulateStroke(const QPainterPath &path,
                                   const QPen &pen,
                                   const Color4ub &strokeColor,
                                   VertexContainerType *strokeVertices,
-                                  const QSize &clipSize);
+                                  const QSize &clipSize,
+                                  const QByteArray &cacheKey = QByteArray());
 
 private:
     void maybeUpdateAsyncItem();
@@ -171,6 +173,7 @@ public:
     QPainterPath path;
     QQuickShapeGenericRenderer::Color4ub fillColor;
     bool supportsElementIndexUint;
+    QByteArray cacheKey;
 
     // output
     QQuickShapeGenericRenderer::VertexContainerType fillVertices;
@@ -195,6 +198,7 @@ public:
     QPen pen;
     QQuickShapeGenericRenderer::Color4ub strokeColor;
     QSize clipSize;
+    QByteArray cacheKey;
 
     // output
     QQuickShapeGenericRenderer::VertexContainerType strokeVertices;
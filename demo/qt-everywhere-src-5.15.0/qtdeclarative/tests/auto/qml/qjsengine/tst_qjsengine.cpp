@@ -246,6 +246,10 @@ private slots:
 
     void equality();
     void aggressiveGc();
+    void incrementalGc();
+    void concurrentSweep();
+    void polymorphicLookups();
+    void jitSwitch();
     void noAccumulatorInTemplateLiteral();
 
     void interrupt_data();
@@ -4864,6 +4868,121 @@ void tst_QJSEngine::aggressiveGc()
     qputenv("QV4_MM_AGGRESSIVE_GC", origAggressiveGc);
 }
 
+void tst_QJSEngine::incrementalGc()
+{
+    const QByteArray origIncrementalGc = qgetenv("QV4_MM_INCREMENTAL_GC");
+    qputenv("QV4_MM_INCREMENTAL_GC", "1");
+    {
+        QJSEngine engine;
+        // Keep a live structure around while producing lots of garbage, so that marking is
+        // spread over several slices and the barrier has to catch stores into black objects.
+        QJSValue result = engine.evaluate(
+                    "var keep = [];\n"
+                    "for (var i = 0; i < 20000; ++i) {\n"
+                    "    var o = { index: i, data: [i, i + 1, 'x' + i] };\n"
+                    "    if (i % 100 == 0)\n"
+                    "        keep.push(o);\n"
+                    "}");
+        QVERIFY(!result.isError());
+        engine.collectGarbage();
+        result = engine.evaluate(
+                    "var sum = 0;\n"
+                    "for (var j = 0; j < keep.length; ++j)\n"
+                    "    sum += keep[j].data[1] - keep[j].index;\n"
+                    "sum + keep.length");
+        QVERIFY(!result.isError());
+        QCOMPARE(result.toInt(), 400);
+    }
+    qputenv("QV4_MM_INCREMENTAL_GC", origIncrementalGc);
+}
+
+void tst_QJSEngine::concurrentSweep()
+{
+    const QByteArray origConcurrentSweep = qgetenv("QV4_MM_CONCURRENT_SWEEP");
+    qputenv("QV4_MM_CONCURRENT_SWEEP", "1");
+    {
+        QJSEngine engine;
+        // Strings and arrays have destructors, plain objects don't; allocate enough of
+        // both so that collections happen while chunks are still being swept.
+        for (int round = 0; round < 3; ++round) {
+            QJSValue result = engine.evaluate(
+                        "var keep = [];\n"
+                        "for (var i = 0; i < 50000; ++i) {\n"
+                        "    var o = { index: i, name: 'item' + i, data: [i, i * 2] };\n"
+                        "    if (i % 500 == 0)\n"
+                        "        keep.push(o);\n"
+                        "}\n"
+                        "var ok = keep.length === 100;\n"
+                        "for (var j = 0; j < keep.length; ++j)\n"
+                        "    ok = ok && keep[j].name === 'item' + keep[j].index\n"
+                        "            && keep[j].data[1] === 2 * keep[j].index;\n"
+                        "ok");
+            QVERIFY(!result.isError());
+            QVERIFY(result.toBool());
+            engine.collectGarbage();
+        }
+    }
+    qputenv("QV4_MM_CONCURRENT_SWEEP", origConcurrentSweep);
+}
+
+void tst_QJSEngine::polymorphicLookups()
+{
+    QJSEngine engine;
+    // Go through the monomorphic, two class, polymorphic and megamorphic states of the
+    // same getter and setter sites, with own, inherited and accessor properties.
+    QJSValue result = engine.evaluate(
+                "function Proto() {}\n"
+                "Proto.prototype.x = 10;\n"
+                "var shapes = [\n"
+                "    function(i) { return { x: i }; },\n"
+                "    function(i) { return { a: 0, x: i }; },\n"
+                "    function(i) { var o = new Proto; return o; },\n"
+                "    function(i) { return { get x() { return i; }, set x(v) {} }; },\n"
+                "    function(i) { return { a: 0, b: 0, x: i }; },\n"
+                "    function(i) { return { a: 0, b: 0, c: 0, x: i }; }\n"
+                "];\n"
+                "function getX(o) { return o.x; }\n"
+                "function setX(o, v) { o.x = v; return o.x; }\n"
+                "var errors = [];\n"
+                "for (var n = 1; n <= shapes.length; ++n) {\n"
+                "    for (var i = 0; i < 50; ++i) {\n"
+                "        var kind = i % n;\n"
+                "        var o = shapes[kind](i);\n"
+                "        var expected = kind == 2 ? 10 : i;\n"
+                "        if (getX(o) !== expected)\n"
+                "            errors.push('get ' + n + ' ' + kind);\n"
+                "        var stored = setX(o, i + 1);\n"
+                "        if (stored !== (kind == 3 ? i : i + 1))\n"
+                "            errors.push('set ' + n + ' ' + kind);\n"
+                "    }\n"
+                "}\n"
+                "errors.join(', ')");
+    QVERIFY(!result.isError());
+    QCOMPARE(result.toString(), QString());
+}
+
+void tst_QJSEngine::jitSwitch()
+{
+    QJSEngine engine;
+    QVERIFY(engine.isJitEnabled());
+    engine.setJitEnabled(false);
+    QVERIFY(!engine.isJitEnabled());
+
+    QJSValue result = engine.evaluate(
+                "function sum(n) { var s = 0; for (var i = 0; i < n; ++i) s += i; return s; }\n"
+                "var total = 0;\n"
+                "for (var j = 0; j < 100; ++j)\n"
+                "    total += sum(10);\n"
+                "total");
+    QVERIFY(!result.isError());
+    QCOMPARE(result.toInt(), 4500);
+
+    engine.setJitEnabled(true);
+    QVERIFY(engine.isJitEnabled());
+    result = engine.evaluate("sum(100)");
+    QCOMPARE(result.toInt(), 4950);
+}
+
 void tst_QJSEngine::noAccumulatorInTemplateLiteral()
 {
     const QByteArray origAggressiveGc = qgetenv("QV4_MM_AGGRESSIVE_GC");
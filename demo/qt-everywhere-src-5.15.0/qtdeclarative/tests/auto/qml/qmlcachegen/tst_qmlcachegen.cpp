@@ -75,6 +75,7 @@ private slots:
     void reproducibleCache();
 
     void parameterAdjustment();
+    void aotCompiledBindings();
 };
 
 // A wrapper around QQmlComponent to ensure the temporary reference counts
@@ -367,11 +368,11 @@ void tst_qmlcachegen::versionChecksForAheadOfTimeUnits()
 
     Q_ASSERT(!temporaryModifiedCachedUnit);
     QQmlMetaType::CachedUnitLookupError error = QQmlMetaType::CachedUnitLookupError::NoError;
-    const QV4::CompiledData::Unit *originalUnit = QQmlMetaType::findCachedCompilationUnit(
+    const QQmlPrivate::CachedQmlUnit *originalUnit = QQmlMetaType::findCachedCompilationUnit(
             QUrl("qrc:/data/versionchecks.qml"), &error);
     QVERIFY(originalUnit);
-    QV4::CompiledData::Unit *tweakedUnit = (QV4::CompiledData::Unit *)malloc(originalUnit->unitSize);
-    memcpy(reinterpret_cast<void *>(tweakedUnit), reinterpret_cast<const void *>(originalUnit), originalUnit->unitSize);
+    QV4::CompiledData::Unit *tweakedUnit = (QV4::CompiledData::Unit *)malloc(originalUnit->qmlData->unitSize);
+    memcpy(reinterpret_cast<void *>(tweakedUnit), reinterpret_cast<const void *>(originalUnit->qmlData), originalUnit->qmlData->unitSize);
     tweakedUnit->version = QV4_DATA_STRUCTURE_VERSION - 1;
     temporaryModifiedCachedUnit = new QQmlPrivate::CachedQmlUnit{tweakedUnit, nullptr, nullptr};
 
@@ -596,11 +597,11 @@ void tst_qmlcachegen::moduleScriptImport()
         QVERIFY(unitData->flags & QV4::CompiledData::Unit::IsESModule);
 
         QQmlMetaType::CachedUnitLookupError error = QQmlMetaType::CachedUnitLookupError::NoError;
-        const QV4::CompiledData::Unit *unitFromResources = QQmlMetaType::findCachedCompilationUnit(
+        const QQmlPrivate::CachedQmlUnit *unitFromResources = QQmlMetaType::findCachedCompilationUnit(
                 QUrl("qrc:/data/script.mjs"), &error);
         QVERIFY(unitFromResources);
 
-        QCOMPARE(unitFromResources, compilationUnit->unitData());
+        QCOMPARE(unitFromResources->qmlData, compilationUnit->unitData());
     }
 }
 
@@ -627,11 +628,11 @@ void tst_qmlcachegen::sourceFileIndices()
     QVERIFY(QFileInfo(":/data/versionchecks.qml").size() > 0);
 
     QQmlMetaType::CachedUnitLookupError error = QQmlMetaType::CachedUnitLookupError::NoError;
-    const QV4::CompiledData::Unit *unitFromResources = QQmlMetaType::findCachedCompilationUnit(
+    const QQmlPrivate::CachedQmlUnit *unitFromResources = QQmlMetaType::findCachedCompilationUnit(
             QUrl("qrc:/data/versionchecks.qml"), &error);
     QVERIFY(unitFromResources);
-    QVERIFY(unitFromResources->flags & QV4::CompiledData::Unit::PendingTypeCompilation);
-    QCOMPARE(uint(unitFromResources->sourceFileIndex), uint(0));
+    QVERIFY(unitFromResources->qmlData->flags & QV4::CompiledData::Unit::PendingTypeCompilation);
+    QCOMPARE(uint(unitFromResources->qmlData->sourceFileIndex), uint(0));
 }
 
 void tst_qmlcachegen::reproducibleCache_data()
@@ -674,6 +675,54 @@ void tst_qmlcachegen::parameterAdjustment()
     QVERIFY(!obj.isNull()); // Doesn't crash
 }
 
+static const QQmlPrivate::CachedQmlUnit *aotCachedUnit = nullptr;
+
+static void aotValueBinding(const QQmlPrivate::AOTCompiledContext *context, void *result)
+{
+    QObject *scope = context->qmlScopeObject;
+    int base = 0;
+    context->captureAndReadProperty(scope, scope->metaObject()->indexOfProperty("base"), &base);
+    *static_cast<int *>(result) = base + 100;
+}
+
+static const QQmlPrivate::AOTCompiledFunction aotFunctions[] = {
+    { 0, QMetaType::Int, aotValueBinding },
+    { 0, 0, nullptr }
+};
+
+void tst_qmlcachegen::aotCompiledBindings()
+{
+    QQmlEngine sourceEngine;
+    QQmlComponent source(&sourceEngine);
+    source.setData("import QtQml 2.0\nQtObject { property int base: 5; property int value: base * 2 }",
+                   QUrl("qrc:/aot/source.qml"));
+    QCOMPARE(source.status(), QQmlComponent::Ready);
+    auto compilationUnit = QQmlComponentPrivate::get(&source)->compilationUnit;
+    QVERIFY(compilationUnit);
+    QQmlPrivate::CachedQmlUnit cachedUnit = { compilationUnit->unitData(), aotFunctions, nullptr };
+    aotCachedUnit = &cachedUnit;
+
+    auto testHandler = [](const QUrl &url) -> const QQmlPrivate::CachedQmlUnit * {
+        if (url == QUrl("qrc:/aot/binding.qml"))
+            return aotCachedUnit;
+        return nullptr;
+    };
+    QQmlMetaType::prependCachedUnitLookupFunction(testHandler);
+
+    {
+        QQmlEngine engine;
+        CleanlyLoadingComponent component(&engine, QUrl("qrc:/aot/binding.qml"));
+        QScopedPointer<QObject> obj(component.create());
+        QVERIFY(!obj.isNull());
+        QCOMPARE(obj->property("value").toInt(), 105);
+        obj->setProperty("base", 7);
+        QCOMPARE(obj->property("value").toInt(), 107);
+    }
+
+    QQmlMetaType::removeCachedUnitLookupFunction(testHandler);
+    aotCachedUnit = nullptr;
+}
+
 QTEST_GUILESS_MAIN(tst_qmlcachegen)
 
 #include "tst_qmlcachegen.moc"
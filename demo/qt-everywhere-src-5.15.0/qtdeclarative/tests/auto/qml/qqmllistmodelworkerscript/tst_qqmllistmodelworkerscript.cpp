@@ -104,6 +104,8 @@ private slots:
     void worker_remove_list();
     void dynamic_role_data();
     void dynamic_role();
+    void worker_sync_coalesces_changes_data();
+    void worker_sync_coalesces_changes();
 };
 
 bool tst_qqmllistmodelworkerscript::compareVariantList(const QVariantList &testList, QVariant object)
@@ -842,6 +844,56 @@ void tst_qqmllistmodelworkerscript::dynamic_role()
     qApp->processEvents();
 }
 
+void tst_qqmllistmodelworkerscript::worker_sync_coalesces_changes_data()
+{
+    worker_sync_data();
+}
+
+void tst_qqmllistmodelworkerscript::worker_sync_coalesces_changes()
+{
+    QFETCH(bool, dynamicRoles);
+
+    QQmlListModel model;
+    model.setDynamicRoles(dynamicRoles);
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("model.qml"));
+    QVERIFY2(component.errorString().isEmpty(), component.errorString().toUtf8());
+    QQuickItem *item = createWorkerTest(&engine, &component, &model);
+    QVERIFY(item != nullptr);
+
+    QQmlExpression expr(engine.rootContext(), &model,
+                        "for (var i = 0; i < 10; ++i) append({'a': i, 'b': 0});");
+    expr.evaluate();
+    QVERIFY2(!expr.hasError(), QTest::toString(expr.error().toString()));
+
+    QSignalSpy spyItemsChanged(&model, SIGNAL(dataChanged(QModelIndex,QModelIndex,QVector<int>)));
+
+    // Rows 0-4 and 7-9 change, rows 5 and 6 are left alone
+    QVERIFY(QMetaObject::invokeMethod(item, "evalExpressionViaWorker",
+            Q_ARG(QVariant, QStringList()
+                  << "for (var i = 0; i < 5; ++i) setProperty(i, 'a', i + 10);"
+                  << "for (var i = 0; i < 5; ++i) setProperty(i, 'b', 1);"
+                  << "for (var i = 7; i < 10; ++i) setProperty(i, 'b', 1);")));
+    waitForWorker(item);
+
+    QCOMPARE(spyItemsChanged.count(), 2);
+    QCOMPARE(spyItemsChanged.at(0).at(0).value<QModelIndex>(), model.index(0, 0, QModelIndex()));
+    QCOMPARE(spyItemsChanged.at(0).at(1).value<QModelIndex>(), model.index(4, 0, QModelIndex()));
+    QVector<int> roles = spyItemsChanged.at(0).at(2).value<QVector<int>>();
+    QCOMPARE(roles.count(), 2);
+    QVERIFY(roles.contains(roleFromName(&model, "a")));
+    QVERIFY(roles.contains(roleFromName(&model, "b")));
+    QCOMPARE(spyItemsChanged.at(1).at(0).value<QModelIndex>(), model.index(7, 0, QModelIndex()));
+    QCOMPARE(spyItemsChanged.at(1).at(1).value<QModelIndex>(), model.index(9, 0, QModelIndex()));
+    QCOMPARE(spyItemsChanged.at(1).at(2).value<QVector<int>>(), QVector<int>(1, roleFromName(&model, "b")));
+
+    QQmlExpression check(engine.rootContext(), &model, "get(4).a == 14 && get(9).b == 1");
+    QVERIFY(check.evaluate().toBool());
+
+    delete item;
+    qApp->processEvents();
+}
+
 QTEST_MAIN(tst_qqmllistmodelworkerscript)
 
 #include "tst_qqmllistmodelworkerscript.moc"
@@ -35,9 +35,12 @@
 #if QT_CONFIG(process)
 #include <QtCore/qprocess.h>
 #endif
+#include <QtQml/private/qqmlcomponent_p.h>
 #include <QtQml/private/qqmlengine_p.h>
 #include <QtQml/private/qqmltypedata_p.h>
 #include <QtQml/private/qqmltypeloader_p.h>
+#include <QtQml/private/qv4compilationunitbundle_p.h>
+#include <QtQml/private/qv4compileddatabundle_p.h>
 #include "../../shared/testhttpserver.h"
 #include "../../shared/util.h"
 
@@ -63,6 +66,8 @@ private slots:
     void implicitImport();
     void compositeSingletonCycle();
     void declarativeCppType();
+    void compilationUnitBundle();
+    void parallelParsing();
 };
 
 void tst_QQMLTypeLoader::testLoadComplete()
@@ -592,6 +597,104 @@ void tst_QQMLTypeLoader::declarativeCppType()
     QVERIFY(!obj.isNull());
 }
 
+void tst_QQMLTypeLoader::compilationUnitBundle()
+{
+    const QUrl url(QStringLiteral("qrc:/bundled/Bundled.qml"));
+    const QString resourcePath = QStringLiteral("/bundled/Bundled.qml");
+    const QByteArray source = "import QtQml 2.0\nQtObject { property int answer: 42 }\n";
+
+    QByteArray unitData;
+    {
+        QQmlEngine engine;
+        QQmlComponent component(&engine);
+        component.setData(source, url);
+        QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+        const QV4::CompiledData::Unit *unit
+                = QQmlComponentPrivate::get(&component)->compilationUnit->unitData();
+        unitData = QByteArray(reinterpret_cast<const char *>(unit), int(unit->unitSize));
+    }
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString bundlePath = dir.filePath(QStringLiteral("units.qmlcbundle"));
+
+    QString error;
+    QV4::CompiledData::BundleWriter writer;
+    QVERIFY(!writer.addUnit(resourcePath, source, QByteArray("garbage"), &error));
+    QVERIFY2(writer.addUnit(resourcePath, source, unitData, &error), qPrintable(error));
+    QVERIFY2(writer.writeToFile(bundlePath, &error), qPrintable(error));
+
+    {
+        QV4::CompilationUnitBundle bundle;
+        QVERIFY2(bundle.open(bundlePath, &error), qPrintable(error));
+        QCOMPARE(bundle.count(), 1);
+        QVERIFY(bundle.unit(resourcePath, QByteArray()));
+        QVERIFY(bundle.unit(resourcePath, QV4::CompiledData::bundleSourceChecksum(source)));
+        QVERIFY(!bundle.unit(resourcePath, QV4::CompiledData::bundleSourceChecksum("QtObject {}")));
+        QVERIFY(!bundle.unit(QStringLiteral("/bundled/Other.qml"), QByteArray()));
+
+        QVERIFY(!bundle.open(testFile("Base.qml"), &error));
+        QCOMPARE(bundle.count(), 0);
+    }
+
+    // The source is not part of the resources, so only the bundle can provide it.
+    QVERIFY2(QV4::CompilationUnitBundle::registerBundle(bundlePath, &error), qPrintable(error));
+    QQmlEngine engine;
+    QQmlComponent component(&engine, url);
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    QScopedPointer<QObject> obj(component.create());
+    QVERIFY(!obj.isNull());
+    QCOMPARE(obj->property("answer").toInt(), 42);
+}
+
+static bool writeQmlFile(const QTemporaryDir &dir, const QString &name, const QByteArray &source)
+{
+    QFile file(dir.filePath(name));
+    return file.open(QIODevice::WriteOnly) && file.write(source) == source.size();
+}
+
+void tst_QQMLTypeLoader::parallelParsing()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const int typeCount = 8;
+    QByteArray main = "import QtQml 2.0\nQtObject {\n    property int sum: 0";
+    QByteArray children;
+    for (int i = 0; i < typeCount; ++i) {
+        const QByteArray name = "Type" + QByteArray::number(i);
+        QVERIFY(writeQmlFile(dir, name + ".qml",
+                             "import QtQml 2.0\nQtObject { property int value: "
+                             + QByteArray::number(i) + " * 2 }\n"));
+        main += "\n    property QtObject o" + QByteArray::number(i) + ": " + name + " {}";
+        children += (i ? " + o" : "o") + QByteArray::number(i) + ".value";
+    }
+    main += "\n    Component.onCompleted: sum = " + children + "\n}\n";
+    QVERIFY(writeQmlFile(dir, "main.qml", main));
+
+    {
+        QQmlEngine engine;
+        QQmlComponent component(&engine, QUrl::fromLocalFile(dir.filePath("main.qml")));
+        QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+        QScopedPointer<QObject> obj(component.create());
+        QVERIFY(!obj.isNull());
+        QCOMPARE(obj->property("sum").toInt(), 56);
+    }
+
+    // Errors in files parsed ahead of time are still reported with their location.
+    QVERIFY(writeQmlFile(dir, "Broken.qml", "import QtQml 2.0\nQtObject {\n    property int value: (\n}\n"));
+    QVERIFY(writeQmlFile(dir, "broken.qml", "import QtQml 2.0\nQtObject {\n"
+                                            "    property QtObject a: Type0 {}\n"
+                                            "    property QtObject b: Broken {}\n}\n"));
+    {
+        QQmlEngine engine;
+        QQmlComponent component(&engine, QUrl::fromLocalFile(dir.filePath("broken.qml")));
+        QVERIFY(component.isError());
+        QVERIFY2(component.errorString().contains(QLatin1String("Broken.qml:")),
+                 qPrintable(component.errorString()));
+    }
+}
+
 QTEST_MAIN(tst_QQMLTypeLoader)
 
 #include "tst_qqmltypeloader.moc"
@@ -0,0 +1,126 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the tools applications of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <private/qv4compileddatabundle_p.h>
+
+#include <QtCore/qcommandlineparser.h>
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qfile.h>
+#include <QtCore/qfileinfo.h>
+
+static bool readFile(const QString &fileName, QByteArray *contents, QString *errorString)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        *errorString = QStringLiteral("%1: %2").arg(fileName, file.errorString());
+        return false;
+    }
+    *contents = file.readAll();
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationVersion(QLatin1String(QT_VERSION_STR));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QLatin1String(
+            "Packs QML cache files produced by qmlcachegen into a single bundle that is memory "
+            "mapped at run time. Point QML_CACHE_BUNDLES at the bundle to use it."));
+    parser.addHelpOption();
+    parser.addVersionOption();
+
+    QCommandLineOption outputFileOption(QStringList() << "o" << "output",
+                                        QCoreApplication::translate("main", "Write the bundle to <file>."),
+                                        QCoreApplication::translate("main", "file"));
+    parser.addOption(outputFileOption);
+
+    QCommandLineOption resourceRootOption(QStringLiteral("resource-root"),
+                                          QCoreApplication::translate("main", "Source files are resolved relative to <directory> when computing their resource path."),
+                                          QCoreApplication::translate("main", "directory"),
+                                          QStringLiteral("."));
+    parser.addOption(resourceRootOption);
+
+    QCommandLineOption resourcePrefixOption(QStringLiteral("resource-prefix"),
+                                            QCoreApplication::translate("main", "Prepend <prefix> to the resource paths."),
+                                            QCoreApplication::translate("main", "prefix"),
+                                            QStringLiteral("/"));
+    parser.addOption(resourcePrefixOption);
+
+    parser.addPositionalArgument(QStringLiteral("source cache"),
+                                 QCoreApplication::translate("main", "Pairs of a QML or JavaScript source file and the cache file compiled from it."),
+                                 QStringLiteral("[source cache...]"));
+    parser.process(app);
+
+    const QStringList positionalArguments = parser.positionalArguments();
+    if (!parser.isSet(outputFileOption) || positionalArguments.isEmpty()
+            || positionalArguments.size() % 2 != 0) {
+        parser.showHelp(1);
+    }
+
+    const QDir resourceRoot(parser.value(resourceRootOption));
+    QString prefix = QDir::cleanPath(QLatin1Char('/') + parser.value(resourcePrefixOption));
+    if (!prefix.endsWith(QLatin1Char('/')))
+        prefix += QLatin1Char('/');
+
+    QV4::CompiledData::BundleWriter writer;
+    QString error;
+    for (int i = 0; i < positionalArguments.size(); i += 2) {
+        const QString &sourceFile = positionalArguments.at(i);
+        const QString &cacheFile = positionalArguments.at(i + 1);
+
+        QByteArray source;
+        QByteArray unitData;
+        if (!readFile(sourceFile, &source, &error) || !readFile(cacheFile, &unitData, &error)) {
+            fprintf(stderr, "%s\n", qPrintable(error));
+            return EXIT_FAILURE;
+        }
+
+        const QString relativePath = resourceRoot.relativeFilePath(QFileInfo(sourceFile).absoluteFilePath());
+        if (relativePath.startsWith(QLatin1String("../"))) {
+            fprintf(stderr, "%s is outside of the resource root %s\n", qPrintable(sourceFile),
+                    qPrintable(resourceRoot.path()));
+            return EXIT_FAILURE;
+        }
+
+        if (!writer.addUnit(prefix + relativePath, source, unitData, &error)) {
+            fprintf(stderr, "%s: %s\n", qPrintable(cacheFile), qPrintable(error));
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!writer.writeToFile(parser.value(outputFileOption), &error)) {
+        fprintf(stderr, "Error writing to %s: %s\n", qPrintable(parser.value(outputFileOption)),
+                qPrintable(error));
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,9 @@
+option(host_build)
+
+QT = qmldevtools-private
+
+SOURCES += main.cpp
+
+QMAKE_TARGET_DESCRIPTION = QML Cache Bundle Generator
+
+load(qt_tool)
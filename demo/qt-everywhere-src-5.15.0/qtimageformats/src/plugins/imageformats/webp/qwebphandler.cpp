@@ -192,18 +192,52 @@ bool QWebpHandler::read(QImage *image)
         return false;
 
     QImage::Format format = m_features.has_alpha ? QImage::Format_ARGB32 : QImage::Format_RGB32;
-    QImage frame(m_iter.width, m_iter.height, format);
-    uint8_t *output = frame.bits();
-    size_t output_size = frame.sizeInBytes();
+
+    WebPDecoderConfig config;
+    if (!WebPInitDecoderConfig(&config))
+        return false;
+
+    // For single images let libwebp crop and scale while decoding, so that only the
+    // requested part of a large image is reconstructed. Animation frames are composited
+    // at full size and clipped/scaled afterwards.
+    QSize outputSize(m_iter.width, m_iter.height);
+    if (!m_features.has_animation) {
+        if (m_clipRect.isValid()) {
+            const QRect clipRect = m_clipRect.intersected(QRect(QPoint(0, 0), outputSize));
+            if (clipRect.isEmpty())
+                return false;
+            config.options.use_cropping = 1;
+            config.options.crop_left = clipRect.x();
+            config.options.crop_top = clipRect.y();
+            config.options.crop_width = clipRect.width();
+            config.options.crop_height = clipRect.height();
+            outputSize = clipRect.size();
+        }
+        if (m_scaledSize.isValid() && !m_scaledSize.isEmpty()) {
+            config.options.use_scaling = 1;
+            config.options.scaled_width = m_scaledSize.width();
+            config.options.scaled_height = m_scaledSize.height();
+            outputSize = m_scaledSize;
+        }
+    }
+    config.options.use_threads = 1;
+
+    QImage frame(outputSize, format);
+    if (frame.isNull())
+        return false;
 #if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
-    if (!WebPDecodeBGRAInto(
-        reinterpret_cast<const uint8_t*>(m_iter.fragment.bytes), m_iter.fragment.size,
-        output, output_size, frame.bytesPerLine()))
+    config.output.colorspace = MODE_BGRA;
 #else
-    if (!WebPDecodeARGBInto(
-        reinterpret_cast<const uint8_t*>(m_iter.fragment.bytes), m_iter.fragment.size,
-        output, output_size, frame.bytesPerLine()))
+    config.output.colorspace = MODE_ARGB;
 #endif
+    config.output.is_external_memory = 1;
+    config.output.u.RGBA.rgba = frame.bits();
+    config.output.u.RGBA.stride = frame.bytesPerLine();
+    config.output.u.RGBA.size = frame.sizeInBytes();
+
+    status = WebPDecode(reinterpret_cast<const uint8_t*>(m_iter.fragment.bytes), m_iter.fragment.size, &config);
+    WebPFreeDecBuffer(&config.output);
+    if (status != VP8_STATUS_OK)
         return false;
 
     if (!m_features.has_animation) {
@@ -225,6 +259,10 @@ bool QWebpHandler::read(QImage *image)
         painter.drawImage(currentImageRect(), frame);
 
         *image = *m_composited;
+        if (m_clipRect.isValid())
+            *image = image->copy(m_clipRect);
+        if (m_scaledSize.isValid() && !m_scaledSize.isEmpty())
+            *image = image->scaled(m_scaledSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
     }
     image->setColorSpace(m_colorSpace);
 
@@ -350,6 +388,10 @@ QVariant QWebpHandler::option(ImageOption option) const
         return m_quality;
     case Size:
         return QSize(m_features.width, m_features.height);
+    case ClipRect:
+        return m_clipRect;
+    case ScaledSize:
+        return m_scaledSize;
     case Animation:
         return m_features.has_animation;
     case BackgroundColor:
@@ -365,6 +407,12 @@ void QWebpHandler::setOption(ImageOption option, const QVariant &value)
     case Quality:
         m_quality = value.toInt();
         return;
+    case ClipRect:
+        m_clipRect = value.toRect();
+        return;
+    case ScaledSize:
+        m_scaledSize = value.toSize();
+        return;
     default:
         break;
     }
@@ -375,6 +423,8 @@ bool QWebpHandler::supportsOption(ImageOption option) const
 {
     return option == Quality
         || option == Size
+        || option == ClipRect
+        || option == ScaledSize
         || option == Animation
         || option == BackgroundColor;
 }
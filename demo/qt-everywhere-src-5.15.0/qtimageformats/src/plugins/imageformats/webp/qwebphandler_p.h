@@ -45,6 +45,7 @@
 #include <QtGui/qimage.h>
 #include <QtGui/qimageiohandler.h>
 #include <QtCore/qbytearray.h>
+#include <QtCore/qrect.h>
 #include <QtCore/qsize.h>
 
 #include "webp/decode.h"
@@ -85,6 +86,8 @@ private:
     };
 
     int m_quality;
+    QRect m_clipRect;
+    QSize m_scaledSize;
     mutable ScanState m_scanState;
     WebPBitstreamFeatures m_features;
     uint32_t m_formatFlags;
@@ -40,6 +40,7 @@
 #include "qgeomappingmanager_p.h"
 
 #include <QDir>
+#include <QDirIterator>
 #include <QStandardPaths>
 #include <QMetaType>
 #include <QPixmap>
@@ -152,9 +153,9 @@ void QGeoFileTileCache::loadTiles()
     QStringList formats;
     formats << QLatin1String("*.*");
 
+#if 0 // workaround for QTBUG-60581
     QDir dir(directory_);
     QStringList files = dir.entryList(formats, QDir::Files);
-#if 0 // workaround for QTBUG-60581
     // Method:
     // 1. read each queue file then, if each file exists, deserialize the data into the appropriate
     // cache queue.
@@ -196,11 +197,14 @@ void QGeoFileTileCache::loadTiles()
     // 2. remaining tiles that aren't registered in a queue get pushed into cache here
     // this is a backup, in case the queue manifest files get deleted or out of sync due to
     // the application not closing down properly
-    for (int i = 0; i < files.size(); ++i) {
-        QGeoTileSpec spec = filenameToTileSpec(files.at(i));
+    // Iterate instead of using entryList(): large offline caches hold millions of tiles,
+    // and building and sorting the full name list dominates startup.
+    QDirIterator it(directory_, formats, QDir::Files);
+    while (it.hasNext()) {
+        const QString filename = it.next();
+        QGeoTileSpec spec = filenameToTileSpec(it.fileName());
         if (spec.zoom() == -1)
             continue;
-        QString filename = dir.filePath(files.at(i));
         addToDiskCache(spec, filename);
     }
 }
@@ -432,13 +436,13 @@ QGeoTileSpec QGeoFileTileCache::filenameToTileSpecDefault(const QString &filenam
 {
     QGeoTileSpec emptySpec;
 
-    QStringList parts = filename.split('.');
+    const QVector<QStringRef> parts = filename.splitRef(QLatin1Char('.'));
 
     if (parts.length() != 2)
         return emptySpec;
 
-    QString name = parts.at(0);
-    QStringList fields = name.split('-');
+    const QStringRef name = parts.at(0);
+    const QVector<QStringRef> fields = name.split(QLatin1Char('-'));
 
     int length = fields.length();
     if (length != 5 && length != 6)
@@ -459,7 +463,7 @@ QGeoTileSpec QGeoFileTileCache::filenameToTileSpecDefault(const QString &filenam
     if (numbers.length() < 5)
         numbers.append(-1);
 
-    return QGeoTileSpec(fields.at(0),
+    return QGeoTileSpec(fields.at(0).toString(),
                     numbers.at(0),
                     numbers.at(1),
                     numbers.at(2),
@@ -557,6 +561,9 @@ QSharedPointer<QGeoTileTexture> QGeoFileTileCache::getFromMemory(const QGeoTileS
             handleError(spec, QLatin1String("Problem with tile image"));
             return QSharedPointer<QGeoTileTexture>(0);
         }
+        // Same as in getFromDisk(): convert once here, so the cached texture image can be
+        // uploaded as-is every time the tile scrolls back into view.
+        image = convertTileImage(image);
         QSharedPointer<QGeoTileTexture> tt = addToTextureCache(spec, image);
         if (tt)
             return tt;
@@ -592,8 +599,7 @@ QSharedPointer<QGeoTileTexture> QGeoFileTileCache::getFromDisk(const QGeoTileSpe
         }
 
         // Converting it here, instead of in each QSGTexture::bind()
-        if (image.format() != QImage::Format_RGB32 && image.format() != QImage::Format_ARGB32_Premultiplied)
-            image = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+        image = convertTileImage(image);
 
         addToMemoryCache(spec, bytes, format);
         QSharedPointer<QGeoTileTexture> tt = addToTextureCache(td->spec, image);
@@ -604,6 +610,13 @@ QSharedPointer<QGeoTileTexture> QGeoFileTileCache::getFromDisk(const QGeoTileSpe
     return QSharedPointer<QGeoTileTexture>();
 }
 
+QImage QGeoFileTileCache::convertTileImage(const QImage &image)
+{
+    if (image.format() != QImage::Format_RGB32 && image.format() != QImage::Format_ARGB32_Premultiplied)
+        return image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    return image;
+}
+
 bool QGeoFileTileCache::isTileBogus(const QByteArray &bytes) const
 {
     if (bytes.size() == 7 && bytes == QByteArrayLiteral("NoRetry"))
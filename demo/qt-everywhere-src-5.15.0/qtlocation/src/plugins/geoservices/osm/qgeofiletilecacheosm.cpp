@@ -171,7 +171,7 @@ QSharedPointer<QGeoTileTexture> QGeoFileTileCacheOsm::getFromOfflineStorage(cons
     }
 
     addToMemoryCache(spec, bytes, QString());
-    return addToTextureCache(spec, image);
+    return addToTextureCache(spec, convertTileImage(image));
 }
 
 void QGeoFileTileCacheOsm::dropTiles(int mapId)
@@ -198,14 +198,12 @@ void QGeoFileTileCacheOsm::loadTiles(int mapId)
     QStringList formats;
     formats << QLatin1String("*.*");
 
-    QDir dir(directory_);
-    QStringList files = dir.entryList(formats, QDir::Files);
-
-    for (int i = 0; i < files.size(); ++i) {
-        QGeoTileSpec spec = filenameToTileSpec(files.at(i));
+    QDirIterator it(directory_, formats, QDir::Files);
+    while (it.hasNext()) {
+        const QString filename = it.next();
+        QGeoTileSpec spec = filenameToTileSpec(it.fileName());
         if (spec.zoom() == -1 || spec.mapId() != mapId)
             continue;
-        QString filename = dir.filePath(files.at(i));
         addToDiskCache(spec, filename);
     }
 }
@@ -48,6 +48,8 @@
 #include <QLoggingCategory>
 #include <QtMath>
 
+#include <algorithm>
+
 #include <QDebug>
 
 #include <QtBodymovin/private/bmconstants_p.h>
@@ -141,15 +143,24 @@ protected:
 
     const EasingSegment<T>* getEasingSegment(int frame)
     {
-        // TODO: Improve with a faster search algorithm
         const EasingSegment<T> *easing = m_currentEasing;
-        if (!easing || easing->startFrame < frame ||
-                easing->endFrame > frame) {
-            for (int i=0; i < m_easingCurves.length(); i++) {
-                if (m_easingCurves.at(i).startFrame <= frame &&
-                        m_easingCurves.at(i).endFrame >= frame) {
-                    m_currentEasing = &m_easingCurves.at(i);
-                    break;
+        if (!easing || easing->startFrame > frame ||
+                easing->endFrame < frame) {
+            // Segments are stored in keyframe order, so find the last one
+            // starting at or before the frame
+            auto it = std::upper_bound(m_easingCurves.cbegin(), m_easingCurves.cend(), frame,
+                                       [](int f, const EasingSegment<T> &segment) {
+                                           return f < segment.startFrame;
+                                       });
+            if (it != m_easingCurves.cbegin() && (it - 1)->endFrame >= frame) {
+                m_currentEasing = &*(it - 1);
+            } else {
+                for (int i=0; i < m_easingCurves.length(); i++) {
+                    if (m_easingCurves.at(i).startFrame <= frame &&
+                            m_easingCurves.at(i).endFrame >= frame) {
+                        m_currentEasing = &m_easingCurves.at(i);
+                        break;
+                    }
                 }
             }
         }
@@ -39,6 +39,17 @@
 
 #include "qvideoframeconversionhelper_p.h"
 
+#if QT_CONFIG(thread)
+#include <qsemaphore.h>
+#include <qthreadpool.h>
+#ifndef Q_OS_WASM
+// WebAssembly has threads; however we can't block the main thread.
+#define QT_USE_THREAD_PARALLEL_VIDEO_CONVERSIONS
+#endif
+#endif
+
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 #define CLAMP(n) (n > 255 ? 255 : (n < 0 ? 0 : n))
@@ -66,32 +77,63 @@ static inline void planarYUV420_to_ARGB32(const uchar *y, int yStride,
                                           quint32 *rgb,
                                           int width, int height)
 {
-    quint32 *rgb0 = rgb;
-    quint32 *rgb1 = rgb + width;
-
-    for (int j = 0; j < height; j += 2) {
-        const uchar *lineY0 = y;
-        const uchar *lineY1 = y + yStride;
-        const uchar *lineU = u;
-        const uchar *lineV = v;
-
-        for (int i = 0; i < width; i += 2) {
-            EXPAND_UV(*lineU, *lineV);
-            lineU += uvPixelStride;
-            lineV += uvPixelStride;
-
-            *rgb0++ = qYUVToARGB32(*lineY0++, rv, guv, bu);
-            *rgb0++ = qYUVToARGB32(*lineY0++, rv, guv, bu);
-            *rgb1++ = qYUVToARGB32(*lineY1++, rv, guv, bu);
-            *rgb1++ = qYUVToARGB32(*lineY1++, rv, guv, bu);
+    // Converts the row pairs [first, last), each sharing one line of chroma
+    auto convertSegment = [=](int first, int last) {
+        const uchar *lineY = y + first * (yStride << 1);
+        const uchar *lineUStart = u + first * uStride;
+        const uchar *lineVStart = v + first * vStride;
+        quint32 *rgb0 = rgb + first * (width << 1);
+        quint32 *rgb1 = rgb0 + width;
+
+        for (int j = first; j < last; ++j) {
+            const uchar *lineY0 = lineY;
+            const uchar *lineY1 = lineY + yStride;
+            const uchar *lineU = lineUStart;
+            const uchar *lineV = lineVStart;
+
+            for (int i = 0; i < width; i += 2) {
+                EXPAND_UV(*lineU, *lineV);
+                lineU += uvPixelStride;
+                lineV += uvPixelStride;
+
+                *rgb0++ = qYUVToARGB32(*lineY0++, rv, guv, bu);
+                *rgb0++ = qYUVToARGB32(*lineY0++, rv, guv, bu);
+                *rgb1++ = qYUVToARGB32(*lineY1++, rv, guv, bu);
+                *rgb1++ = qYUVToARGB32(*lineY1++, rv, guv, bu);
+            }
+
+            lineY += yStride << 1; // stride * 2
+            lineUStart += uStride;
+            lineVStart += vStride;
+            rgb0 += width;
+            rgb1 += width;
         }
-
-        y += yStride << 1; // stride * 2
-        u += uStride;
-        v += vStride;
-        rgb0 += width;
-        rgb1 += width;
+    };
+
+    const int rowPairs = (height + 1) / 2;
+
+#ifdef QT_USE_THREAD_PARALLEL_VIDEO_CONVERSIONS
+    // Same segment size as the parallel QImage conversions
+    int segments = int(qint64(width) * height * 4 / (1 << 16));
+    segments = std::min(segments, rowPairs);
+
+    if (segments <= 1)
+        return convertSegment(0, rowPairs);
+
+    QSemaphore semaphore;
+    int pair = 0;
+    for (int i = 0; i < segments; ++i) {
+        const int count = (rowPairs - pair) / (segments - i);
+        QThreadPool::globalInstance()->start([&, pair, count]() {
+            convertSegment(pair, pair + count);
+            semaphore.release(1);
+        });
+        pair += count;
     }
+    semaphore.acquire(segments);
+#else
+    convertSegment(0, rowPairs);
+#endif
 }
 
 
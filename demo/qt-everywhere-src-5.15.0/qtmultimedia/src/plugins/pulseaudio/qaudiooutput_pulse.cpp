@@ -465,16 +465,18 @@ void QPulseAudioOutput::userFeed()
     if (m_pullMode) {
         int writableSize = bytesFree();
         int chunks = writableSize / m_periodSize;
-        if (chunks == 0)
-            return;
 
-        int input = m_periodSize; // always request 1 chunk of data from user
+        int input = m_periodSize; // always request 1 chunk of data from user at a time
         if (input > m_maxBufferSize)
             input = m_maxBufferSize;
 
-        int audioBytesPulled = m_audioSource->read(m_audioBuffer, input);
-        Q_ASSERT(audioBytesPulled <= input);
-        if (m_audioBuffer && audioBytesPulled > 0) {
+        // Fill everything PulseAudio can take now instead of queuing another
+        // userFeed() per chunk, so that a busy event loop does not starve the stream.
+        for (; chunks > 0; --chunks) {
+            int audioBytesPulled = m_audioSource->read(m_audioBuffer, input);
+            Q_ASSERT(audioBytesPulled <= input);
+            if (!m_audioBuffer || audioBytesPulled <= 0)
+                break;
             if (audioBytesPulled > input) {
                 qWarning() << "QPulseAudioOutput::userFeed() - Invalid audio data size provided from user:"
                            << audioBytesPulled << "should be less than" << input;
@@ -482,12 +484,12 @@ void QPulseAudioOutput::userFeed()
             }
             qint64 bytesWritten = write(m_audioBuffer, audioBytesPulled);
             Q_ASSERT(bytesWritten == audioBytesPulled); //unfinished write should not happen since the data provided is less than writableSize
-            Q_UNUSED(bytesWritten);
 
-            if (chunks > 1) {
-                // PulseAudio needs more data. Ask for it immediately.
-                QMetaObject::invokeMethod(this, "userFeed", Qt::QueuedConnection);
-            }
+            // Stop when the source could not provide a whole chunk, or when writing failed
+            // or changed the state, which may have closed the stream already.
+            if (audioBytesPulled < input || bytesWritten <= 0
+                    || m_deviceState != QAudio::ActiveState)
+                break;
         }
     }
 
@@ -516,6 +518,7 @@ qint64 QPulseAudioOutput::write(const char *data, qint64 len)
         if (pa_stream_begin_write(m_stream, &dest, &nbytes) < 0) {
             qWarning("QAudioOutput(pulseaudio): pa_stream_begin_write, error = %s",
                      pa_strerror(pa_context_errno(pulseEngine->context())));
+            pulseEngine->unlock();
             setError(QAudio::IOError);
             return 0;
         }
@@ -528,6 +531,7 @@ qint64 QPulseAudioOutput::write(const char *data, qint64 len)
     if (pa_stream_write(m_stream, data, len, NULL, 0, PA_SEEK_RELATIVE) < 0) {
         qWarning("QAudioOutput(pulseaudio): pa_stream_write, error = %s",
                  pa_strerror(pa_context_errno(pulseEngine->context())));
+        pulseEngine->unlock();
         setError(QAudio::IOError);
         return 0;
     }
@@ -279,13 +279,14 @@ public:
     }
 
     void bind();
-    void bindTexture(int id, int w, int h, const uchar *bits, GLenum format);
+    void bindTexture(int plane, int w, int h, const uchar *bits, GLenum format);
 
     QVideoSurfaceFormat m_format;
     QSize m_textureSize;
     int m_planeCount;
 
     GLuint m_textureIds[3];
+    QSize m_planeSizes[3]; // Allocated size of each plane texture
     GLfloat m_planeWidth[3];
 
     qreal m_opacity;
@@ -371,6 +372,8 @@ void QSGVideoMaterial_YUV::bind()
                 if (!m_textureSize.isEmpty())
                     functions->glDeleteTextures(m_planeCount, m_textureIds);
                 functions->glGenTextures(m_planeCount, m_textureIds);
+                for (QSize &planeSize : m_planeSizes)
+                    planeSize = QSize();
                 m_textureSize = m_frame.size();
             }
 
@@ -393,10 +396,10 @@ void QSGVideoMaterial_YUV::bind()
                 // Additionally U and V are set per 2 pixels hence only 1/2 of image width is used.
                 // Interpreting this properly in shaders allows to not copy or not make conditionals inside shaders,
                 // only interpretation of data changes.
-                bindTexture(m_textureIds[1], m_planeWidth[1], m_frame.height(), m_frame.bits(), GL_RGBA);
+                bindTexture(1, m_planeWidth[1], m_frame.height(), m_frame.bits(), GL_RGBA);
                 functions->glActiveTexture(GL_TEXTURE0); // Finish with 0 as default texture unit
                 // Either red (YUYV) or alpha (UYVY) values are used as source of Y
-                bindTexture(m_textureIds[0], m_planeWidth[0], m_frame.height(), m_frame.bits(), texFormat2);
+                bindTexture(0, m_planeWidth[0], m_frame.height(), m_frame.bits(), texFormat2);
             } else if (m_format.pixelFormat() == QVideoFrame::Format_NV12
                     || m_format.pixelFormat() == QVideoFrame::Format_NV21) {
                 const int y = 0;
@@ -405,9 +408,9 @@ void QSGVideoMaterial_YUV::bind()
                 m_planeWidth[0] = m_planeWidth[1] = qreal(fw) / m_frame.bytesPerLine(y);
 
                 functions->glActiveTexture(GL_TEXTURE1);
-                bindTexture(m_textureIds[1], m_frame.bytesPerLine(uv) / 2, fh / 2, m_frame.bits(uv), texFormat2);
+                bindTexture(1, m_frame.bytesPerLine(uv) / 2, fh / 2, m_frame.bits(uv), texFormat2);
                 functions->glActiveTexture(GL_TEXTURE0); // Finish with 0 as default texture unit
-                bindTexture(m_textureIds[0], m_frame.bytesPerLine(y), fh, m_frame.bits(y), texFormat1);
+                bindTexture(0, m_frame.bytesPerLine(y), fh, m_frame.bits(y), texFormat1);
 
             } else { // YUV420P || YV12 || YUV422P
                 const int y = 0;
@@ -420,11 +423,11 @@ void QSGVideoMaterial_YUV::bind()
                 const int uvHeight = m_frame.pixelFormat() == QVideoFrame::Format_YUV422P ? fh : fh / 2;
 
                 functions->glActiveTexture(GL_TEXTURE1);
-                bindTexture(m_textureIds[1], m_frame.bytesPerLine(u), uvHeight, m_frame.bits(u), texFormat1);
+                bindTexture(1, m_frame.bytesPerLine(u), uvHeight, m_frame.bits(u), texFormat1);
                 functions->glActiveTexture(GL_TEXTURE2);
-                bindTexture(m_textureIds[2], m_frame.bytesPerLine(v), uvHeight, m_frame.bits(v), texFormat1);
+                bindTexture(2, m_frame.bytesPerLine(v), uvHeight, m_frame.bits(v), texFormat1);
                 functions->glActiveTexture(GL_TEXTURE0); // Finish with 0 as default texture unit
-                bindTexture(m_textureIds[0], m_frame.bytesPerLine(y), fh, m_frame.bits(y), texFormat1);
+                bindTexture(0, m_frame.bytesPerLine(y), fh, m_frame.bits(y), texFormat1);
             }
 
             functions->glPixelStorei(GL_UNPACK_ALIGNMENT, previousAlignment);
@@ -441,10 +444,20 @@ void QSGVideoMaterial_YUV::bind()
     }
 }
 
-void QSGVideoMaterial_YUV::bindTexture(int id, int w, int h, const uchar *bits, GLenum format)
+void QSGVideoMaterial_YUV::bindTexture(int plane, int w, int h, const uchar *bits, GLenum format)
 {
     QOpenGLFunctions *functions = QOpenGLContext::currentContext()->functions();
-    functions->glBindTexture(GL_TEXTURE_2D, id);
+    functions->glBindTexture(GL_TEXTURE_2D, m_textureIds[plane]);
+
+    // Reuse the texture storage while the plane size stays the same, which saves
+    // reallocating it, and setting up its parameters again, for every frame.
+    const QSize planeSize(w, h);
+    if (m_planeSizes[plane] == planeSize) {
+        functions->glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, format, GL_UNSIGNED_BYTE, bits);
+        return;
+    }
+    m_planeSizes[plane] = planeSize;
+
     functions->glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, GL_UNSIGNED_BYTE, bits);
     // replacement for GL_LUMINANCE_ALPHA in core profile
     if (format == GL_RG) {
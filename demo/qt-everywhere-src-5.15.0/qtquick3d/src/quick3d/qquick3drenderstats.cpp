@@ -97,6 +97,31 @@ float QQuick3DRenderStats::maxFrameTime() const
     return m_maxFrameTime;
 }
 
+/*!
+    \qmlproperty quint64 QtQuick3D::RenderStats::meshMemory
+    \since 5.16
+
+    This property holds an estimate, in bytes, of the vertex and index buffer
+    memory used by the meshes currently loaded for the scene.
+*/
+quint64 QQuick3DRenderStats::meshMemory() const
+{
+    return m_meshMemory;
+}
+
+/*!
+    \qmlproperty quint64 QtQuick3D::RenderStats::textureMemory
+    \since 5.16
+
+    This property holds an estimate, in bytes, of the memory used by the
+    textures currently loaded for the scene. Textures provided by Qt Quick
+    items and compressed textures are not included.
+*/
+quint64 QQuick3DRenderStats::textureMemory() const
+{
+    return m_textureMemory;
+}
+
 void QQuick3DRenderStats::startSync()
 {
     m_syncStartTime = timestamp();
@@ -144,6 +169,16 @@ void QQuick3DRenderStats::endRender(bool dump)
             m_notifiedRenderTime = m_renderTime;
             emit renderTimeChanged();
         }
+
+        if (m_meshMemory != m_notifiedMeshMemory) {
+            m_notifiedMeshMemory = m_meshMemory;
+            emit meshMemoryChanged();
+        }
+
+        if (m_textureMemory != m_notifiedTextureMemory) {
+            m_notifiedTextureMemory = m_textureMemory;
+            emit textureMemoryChanged();
+        }
     }
 
     const float fpsInterval = 1000.0f;
@@ -165,6 +200,12 @@ void QQuick3DRenderStats::endRender(bool dump)
         qDebug() << "Render took: " << m_renderTime << "ms";
 }
 
+void QQuick3DRenderStats::setResourceMemory(quint64 meshBytes, quint64 textureBytes)
+{
+    m_meshMemory = meshBytes;
+    m_textureMemory = textureBytes;
+}
+
 float QQuick3DRenderStats::timestamp() const
 {
     return m_frameTimer.nsecsElapsed() / 1000000.0f;
@@ -55,6 +55,8 @@ class Q_QUICK3D_EXPORT QQuick3DRenderStats : public QObject
     Q_PROPERTY(float renderTime READ renderTime NOTIFY renderTimeChanged)
     Q_PROPERTY(float syncTime READ syncTime NOTIFY syncTimeChanged)
     Q_PROPERTY(float maxFrameTime READ maxFrameTime NOTIFY maxFrameTimeChanged)
+    Q_PROPERTY(quint64 meshMemory READ meshMemory NOTIFY meshMemoryChanged)
+    Q_PROPERTY(quint64 textureMemory READ textureMemory NOTIFY textureMemoryChanged)
 
 public:
     QQuick3DRenderStats(QObject *parent = nullptr);
@@ -64,11 +66,14 @@ public:
     float renderTime() const;
     float syncTime() const;
     float maxFrameTime() const;
+    quint64 meshMemory() const;
+    quint64 textureMemory() const;
 
     void startSync();
     void endSync(bool dump = false);
     void startRender();
     void endRender(bool dump = false);
+    void setResourceMemory(quint64 meshBytes, quint64 textureBytes);
 
 Q_SIGNALS:
     void fpsChanged();
@@ -76,6 +81,8 @@ Q_SIGNALS:
     void renderTimeChanged();
     void syncTimeChanged();
     void maxFrameTimeChanged();
+    void meshMemoryChanged();
+    void textureMemoryChanged();
 
 private:
     float timestamp() const;
@@ -91,12 +98,16 @@ private:
     float m_notifiedFrameTime = 0;
     float m_notifiedRenderTime = 0;
     float m_notifiedSyncTime = 0;
+    quint64 m_notifiedMeshMemory = 0;
+    quint64 m_notifiedTextureMemory = 0;
 
     int m_fps = 0;
     float m_frameTime = 0;
     float m_renderTime = 0;
     float m_syncTime = 0;
     float m_maxFrameTime = 0;
+    quint64 m_meshMemory = 0;
+    quint64 m_textureMemory = 0;
 };
 
 QT_END_NAMESPACE
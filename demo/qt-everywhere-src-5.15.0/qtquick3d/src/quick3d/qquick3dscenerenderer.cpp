@@ -387,8 +387,11 @@ void QQuick3DSceneRenderer::synchronize(QQuick3DViewport *item, const QSize &siz
         m_layerSizeIsDirty = false;
     }
 
-    if (m_renderStats)
+    if (m_renderStats) {
+        const auto memory = m_sgContext->bufferManager()->memoryStats();
+        m_renderStats->setResourceMemory(memory.meshBytes, memory.textureBytes);
         m_renderStats->endSync(dumpRenderTimes);
+    }
 }
 
 void QQuick3DSceneRenderer::update()
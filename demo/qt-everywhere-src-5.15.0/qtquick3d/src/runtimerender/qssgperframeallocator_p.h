@@ -55,7 +55,7 @@ class QSSGPerFrameAllocator
 
         enum : size_t {
             ChunkSize = 8192*2,
-            Alignment = 4,
+            Alignment = sizeof(void *), // the renderables placed here hold pointers
             SlabSize = ChunkSize - sizeof(Slab *),
             MaxAlloc = ChunkSize/2 // don't go all the way up to SlabSize, or we'd almost always get a big hole
         };
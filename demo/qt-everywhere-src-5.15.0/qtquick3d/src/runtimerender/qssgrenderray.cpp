@@ -282,9 +282,7 @@ void QSSGRenderRay::intersectWithBVH(const RayData &data,
     // If this is a leaf node, process it's triangles
     if (bvh->count != 0) {
         // If there is an intersection on a leaf node, then test against geometry
-        auto results = intersectWithBVHTriangles(data, mesh->bvh->triangles, bvh->offset, bvh->count);
-        if (!results.isEmpty())
-            intersections.append(results);
+        intersectWithBVHTriangles(data, mesh->bvh->triangles, bvh->offset, bvh->count, intersections);
         return;
     }
 
@@ -303,16 +301,27 @@ QVector<QSSGRenderRay::IntersectionResult> QSSGRenderRay::intersectWithBVHTriang
                                                                                     const QVector<QSSGMeshBVHTriangle *> &bvhTriangles,
                                                                                     int triangleOffset,
                                                                                     int triangleCount)
+{
+    QVector<QSSGRenderRay::IntersectionResult> results;
+    intersectWithBVHTriangles(data, bvhTriangles, triangleOffset, triangleCount, results);
+    return results;
+}
+
+// Appends the hits directly to intersections, which saves a temporary
+// vector for each leaf of the BVH the ray goes through
+void QSSGRenderRay::intersectWithBVHTriangles(const RayData &data,
+                                              const QVector<QSSGMeshBVHTriangle *> &bvhTriangles,
+                                              int triangleOffset,
+                                              int triangleCount,
+                                              QVector<IntersectionResult> &intersections)
 {
     Q_ASSERT(bvhTriangles.count() >= triangleOffset + triangleCount);
 
-    QVector<QSSGRenderRay::IntersectionResult> results;
+    const QSSGRenderRay relativeRay(data.origin, data.direction);
 
     for (int i = triangleOffset; i < triangleCount + triangleOffset; ++i) {
         const auto &triangle = bvhTriangles[i];
 
-        QSSGRenderRay relativeRay(data.origin, data.direction);
-
         // Use Barycentric Coordinates to get the intersection values
         float u = 0.f;
         float v = 0.f;
@@ -337,12 +346,9 @@ QVector<QSSGRenderRay::IntersectionResult> QSSGRenderRay::intersectWithBVHTriang
             const QVector3D hitVector = data.ray.origin - sceneIntersectionPos;
             // Get the magnitude of the hit vector
             const float rayLengthSquared = vec3::magnitudeSquared(hitVector);
-            results.append(IntersectionResult(rayLengthSquared, uvCoordinate, sceneIntersectionPos));
+            intersections.append(IntersectionResult(rayLengthSquared, uvCoordinate, sceneIntersectionPos));
         }
     }
-
-    // Does not intersect with any of the triangles
-    return results;
 }
 
 QSSGOption<QVector2D> QSSGRenderRay::relative(const QMatrix4x4 &inGlobalTransform,
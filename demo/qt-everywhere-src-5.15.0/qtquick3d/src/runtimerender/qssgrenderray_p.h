@@ -145,6 +145,11 @@ struct Q_AUTOTEST_EXPORT QSSGRenderRay
                                                                  const QVector<QSSGMeshBVHTriangle *> &bvhTriangles,
                                                                  int triangleOffset,
                                                                  int triangleCount);
+    static void intersectWithBVHTriangles(const RayData &data,
+                                          const QVector<QSSGMeshBVHTriangle *> &bvhTriangles,
+                                          int triangleOffset,
+                                          int triangleCount,
+                                          QVector<IntersectionResult> &intersections);
 
     QSSGOption<QVector2D> relative(const QMatrix4x4 &inGlobalTransform,
                                         const QSSGBounds3 &inBounds,
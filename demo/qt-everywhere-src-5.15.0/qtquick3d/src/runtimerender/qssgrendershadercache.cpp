@@ -745,9 +745,7 @@ void QSSGShaderCache::importShaderCache(const QByteArray &shaderCache, QByteArra
 
             QSSGRenderVertFragCompilationResult result = m_renderContext->compileBinary(key, format, binary);
             theShader = result.m_shader;
-            if (theShader.isNull())
-                errors += theShader->errorMessage();
-            else
+            if (!theShader.isNull())
                 m_shaders.insert(tempKey, theShader);
         } else {
             QByteArray loadVertexData;
@@ -767,18 +765,17 @@ void QSSGShaderCache::importShaderCache(const QByteArray &shaderCache, QByteArra
                 QByteArray error;
                 QSSGRenderVertFragCompilationResult result
                         = m_renderContext->compileSource(key, QSSGByteView(loadVertexData), QSSGByteView(loadFragmentData),
-                                                         QSSGByteView(loadTessControlData), QSSGByteView(loadTessControlData),
+                                                         QSSGByteView(loadTessControlData), QSSGByteView(loadTessEvalData),
                                                          QSSGByteView(loadGeometryData));
                 theShader = result.m_shader;
-                if (theShader.isNull())
-                    errors += theShader->errorMessage();
-                else
+                if (!theShader.isNull())
                     m_shaders.insert(tempKey, theShader);
             }
         }
         // If something doesn't save or load correctly, get the runtime to re-generate.
         if (theShader.isNull()) {
             qWarning() << __FUNCTION__ << "Failed to load a cached a shader:" << key;
+            errors += QByteArrayLiteral("Failed to load a cached shader: ") + key + '\n';
             m_shadersInitializedFromCache = false;
         }
     }
@@ -784,6 +784,50 @@ QSSGRenderMesh *QSSGBufferManager::createMesh(const QString &inSourcePath, quint
     return theMesh.first.value();
 }
 
+QSSGBufferManager::MemoryStats QSSGBufferManager::memoryStats() const
+{
+    MemoryStats stats;
+
+    // Subsets of one mesh usually share their buffers, so count each buffer once.
+    QSet<const QSSGRenderDataBuffer *> seenBuffers;
+    const auto countBuffer = [&stats, &seenBuffers](QSSGRenderDataBuffer *buffer) {
+        if (buffer && !seenBuffers.contains(buffer)) {
+            seenBuffers.insert(buffer);
+            stats.meshBytes += buffer->size();
+        }
+    };
+    for (auto iter = meshMap.cbegin(), end = meshMap.cend(); iter != end; ++iter) {
+        const QSSGRenderMesh *theMesh = iter.value();
+        if (!theMesh)
+            continue;
+        ++stats.meshCount;
+        for (const QSSGRenderSubset &subset : theMesh->subsets) {
+            countBuffer(subset.vertexBuffer.data());
+            countBuffer(subset.posVertexBuffer.data());
+            countBuffer(subset.indexBuffer.data());
+        }
+    }
+
+    for (auto iter = imageMap.cbegin(), end = imageMap.cend(); iter != end; ++iter) {
+        const QSSGRef<QSSGRenderTexture2D> &texture = iter.value().m_texture;
+        if (!texture)
+            continue;
+        ++stats.textureCount;
+        const QSSGTextureDetails details = texture->textureDetails();
+        // Compressed formats have no fixed per-pixel size; they are counted but not sized.
+        if (!details.format.isUncompressedTextureFormat())
+            continue;
+        quint64 bytes = quint64(details.width) * quint64(details.height)
+                * quint64(qMax(details.depth, 1)) * quint64(details.format.getSizeofFormat());
+        // A full mip chain adds roughly a third on top of the base level
+        if (texture->numMipmaps() > 0)
+            bytes += bytes / 3;
+        stats.textureBytes += bytes;
+    }
+
+    return stats;
+}
+
 void QSSGBufferManager::releaseMesh(QSSGRenderMesh &inMesh)
 {
     delete &inMesh;
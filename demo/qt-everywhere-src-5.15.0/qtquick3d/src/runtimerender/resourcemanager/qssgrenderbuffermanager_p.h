@@ -154,6 +154,18 @@ public:
 
     void invalidateBuffer(const QString &inSourcePath);
 
+    struct MemoryStats
+    {
+        int meshCount = 0;
+        quint64 meshBytes = 0;
+        int textureCount = 0;
+        quint64 textureBytes = 0;
+    };
+
+    // Estimate of the GPU memory held by the meshes and images owned by this
+    // manager. Textures coming from Qt Quick are not owned here and not counted.
+    MemoryStats memoryStats() const;
+
 };
 QT_END_NAMESPACE
 
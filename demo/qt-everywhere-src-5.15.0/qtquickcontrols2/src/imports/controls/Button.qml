@@ -72,8 +72,10 @@ T.Button {
         implicitWidth: 100
         implicitHeight: 40
         visible: !control.flat || control.down || control.checked || control.highlighted
-        color: Color.blend(control.checked || control.highlighted ? control.palette.dark : control.palette.button,
-                                                                    control.palette.mid, control.down ? 0.5 : 0.0)
+        color: {
+            var base = control.checked || control.highlighted ? control.palette.dark : control.palette.button
+            return control.down ? Color.blend(base, control.palette.mid, 0.5) : base
+        }
         border.color: control.palette.highlight
         border.width: control.visualFocus ? 2 : 0
     }
@@ -91,7 +91,7 @@ T.DelayButton {
     background: Rectangle {
         implicitWidth: 100
         implicitHeight: 40
-        color: Color.blend(control.palette.button, control.palette.mid, control.down ? 0.5 : 0.0)
+        color: control.down ? Color.blend(control.palette.button, control.palette.mid, 0.5) : control.palette.button
         border.color: control.palette.highlight
         border.width: control.visualFocus ? 2 : 0
 
@@ -99,7 +99,7 @@ T.DelayButton {
             padding: control.visualFocus ? 2 : 0
             width: control.progress * parent.width
             height: parent.height
-            color: Color.blend(control.palette.dark, control.palette.mid, control.down ? 0.5 : 0.0)
+            color: control.down ? Color.blend(control.palette.dark, control.palette.mid, 0.5) : control.palette.dark
         }
     }
 }
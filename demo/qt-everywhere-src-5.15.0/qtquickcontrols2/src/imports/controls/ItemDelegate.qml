@@ -71,7 +71,9 @@ T.ItemDelegate {
         implicitWidth: 100
         implicitHeight: 40
         visible: control.down || control.highlighted || control.visualFocus
-        color: Color.blend(control.down ? control.palette.midlight : control.palette.light,
-                                          control.palette.highlight, control.visualFocus ? 0.15 : 0.0)
+        color: {
+            var base = control.down ? control.palette.midlight : control.palette.light
+            return control.visualFocus ? Color.blend(base, control.palette.highlight, 0.15) : base
+        }
     }
 }
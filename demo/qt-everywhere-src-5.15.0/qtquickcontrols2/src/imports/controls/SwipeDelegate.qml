@@ -72,7 +72,9 @@ T.SwipeDelegate {
     background: Rectangle {
         implicitWidth: 100
         implicitHeight: 40
-        color: Color.blend(control.down ? control.palette.midlight : control.palette.light,
-                                          control.palette.highlight, control.visualFocus ? 0.15 : 0.0)
+        color: {
+            var base = control.down ? control.palette.midlight : control.palette.light
+            return control.visualFocus ? Color.blend(base, control.palette.highlight, 0.15) : base
+        }
     }
 }
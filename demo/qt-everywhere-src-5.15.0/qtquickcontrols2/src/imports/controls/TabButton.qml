@@ -67,7 +67,9 @@ T.TabButton {
 
     background: Rectangle {
         implicitHeight: 40
-        color: Color.blend(control.checked ? control.palette.window : control.palette.dark,
-                                             control.palette.mid, control.down ? 0.5 : 0.0)
+        color: {
+            var base = control.checked ? control.palette.window : control.palette.dark
+            return control.down ? Color.blend(base, control.palette.mid, 0.5) : base
+        }
     }
 }
@@ -545,8 +545,11 @@ void QAbstractItemModelReplicaImplementation::requestedData(QRemoteObjectPending
     const int rowCount = parentItem->rowCount;
     const int columnCount = parentItem->columnCount;
 
-    if (rowCount < 1 || columnCount < 1)
+    if (rowCount < 1 || columnCount < 1) {
+        m_pendingRequests.removeAll(watcher);
+        delete watcher;
         return;
+    }
 
     const int startRow =  std::min(watcher->start.last().row, rowCount - 1);
     const int endRow = std::min(watcher->end.last().row, rowCount - 1);
@@ -656,6 +659,33 @@ void QAbstractItemModelReplicaImplementation::fetchPendingData()
     }
 }
 
+static bool coversRow(const IndexList &start, const IndexList &end, const QVector<int> &roles,
+                      const IndexList &parentList, int row, int role)
+{
+    if (start.size() != parentList.size() + 1)
+        return false;
+    for (int i = 0; i < parentList.size(); ++i) {
+        if (start.at(i) != parentList.at(i))
+            return false;
+    }
+    return start.last().row <= row && row <= end.last().row
+            && (roles.isEmpty() || roles.contains(role));
+}
+
+bool QAbstractItemModelReplicaImplementation::isRowRequested(const IndexList &parentList, int row, int role) const
+{
+    for (const RequestedData &data : m_requestedData) {
+        if (coversRow(data.start, data.end, data.roles, parentList, row, role))
+            return true;
+    }
+    for (QRemoteObjectPendingCallWatcher *pending : m_pendingRequests) {
+        const RowWatcher *watcher = qobject_cast<const RowWatcher *>(pending);
+        if (watcher && coversRow(watcher->start, watcher->end, watcher->roles, parentList, row, role))
+            return true;
+    }
+    return false;
+}
+
 void QAbstractItemModelReplicaImplementation::onModelReset()
 {
     if (!m_initDone)
@@ -843,6 +873,10 @@ QVariant QAbstractItemModelReplica::data(const QModelIndex & index, int role) co
     Q_ASSERT(index.row() < parentItem->rowCount);
     const int row = index.row();
     IndexList parentList = toModelIndexList(index.parent(), this);
+    // Views ask for the same rows on every repaint; don't send another request while
+    // one covering this row and role is queued or still waiting for its reply.
+    if (d->isRowRequested(parentList, row, role))
+        return QVariant{};
     IndexList start = IndexList() << parentList << ModelIndex(row, 0);
     IndexList end = IndexList() << parentList << ModelIndex(row, std::max(0, parentItem->columnCount - 1));
     Q_ASSERT(toQModelIndex(start, this).isValid());
@@ -853,9 +887,11 @@ QVariant QAbstractItemModelReplica::data(const QModelIndex & index, int role) co
     data.start = start;
     data.end = end;
     data.roles = roles;
+    const bool fetchQueued = !d->m_requestedData.isEmpty();
     d->m_requestedData.push_back(data);
     qCDebug(QT_REMOTEOBJECT_MODELS) << "FETCH PENDING DATA" << start << end << roles;
-    QMetaObject::invokeMethod(d.data(), "fetchPendingData", Qt::QueuedConnection);
+    if (!fetchQueued)
+        QMetaObject::invokeMethod(d.data(), "fetchPendingData", Qt::QueuedConnection);
     return QVariant{};
 }
 QModelIndex QAbstractItemModelReplica::parent(const QModelIndex &index) const
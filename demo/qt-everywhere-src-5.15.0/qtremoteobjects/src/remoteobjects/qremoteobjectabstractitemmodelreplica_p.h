@@ -417,6 +417,7 @@ public Q_SLOTS:
     void init();
     void fetchPendingData();
     void fetchPendingHeaderData();
+    bool isRowRequested(const IndexList &parentList, int row, int role) const;
     void handleInitDone(QRemoteObjectPendingCallWatcher *watcher);
     void handleModelResetDone(QRemoteObjectPendingCallWatcher *watcher);
     void handleSizeDone(QRemoteObjectPendingCallWatcher *watcher);
@@ -355,6 +355,8 @@ void QRemoteObjectSourceBase::handleMetaCall(int index, QMetaObject::Call call,
     if (d->m_listeners.empty())
         return;
 
+    const QVariantList noArgs;
+    const QVariantList *args = marshalArgs(index, a);
     int propertyIndex = m_api->propertyIndexFromSignal(index);
     if (propertyIndex >= 0) {
         const int internalIndex = m_api->propertyRawIndexFromSignal(index);
@@ -365,14 +367,23 @@ void QRemoteObjectSourceBase::handleMetaCall(int index, QMetaObject::Call call,
         serializePropertyChangePacket(this, index);
         d->m_packet.baseAddress = d->m_packet.size;
         propertyIndex = internalIndex;
+
+        // A notify signal usually just carries the new value, which was sent in the
+        // property change packet above. Replicas pass the property value to the signal
+        // when no arguments come with it, so don't send the value a second time.
+        if (args->size() == 1) {
+            const int type = m_api->signalParameterType(index, 0);
+            if (type == mp.userType() && type != QMetaType::QVariant && args->at(0) == mp.read(target))
+                args = &noArgs;
+        }
     }
 
     qCDebug(QT_REMOTEOBJECT) << "# Listeners" << d->m_listeners.length();
     qCDebug(QT_REMOTEOBJECT) << "Invoke args:" << m_object
                              << (call == 0 ? QLatin1String("InvokeMetaMethod") : QStringLiteral("Non-invoked call: %d").arg(call))
-                             << m_api->signalSignature(index) << *marshalArgs(index, a);
+                             << m_api->signalSignature(index) << *args;
 
-    serializeInvokePacket(d->m_packet, name(), call, index, *marshalArgs(index, a), -1, propertyIndex);
+    serializeInvokePacket(d->m_packet, name(), call, index, *args, -1, propertyIndex);
     d->m_packet.baseAddress = 0;
 
     for (IoDeviceBase *io : qAsConst(d->m_listeners))
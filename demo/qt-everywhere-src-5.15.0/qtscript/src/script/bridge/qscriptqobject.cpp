@@ -188,6 +188,18 @@ static unsigned flagsForMetaProperty(const QMetaProperty &prop)
             | QObjectMemberAttribute);
 }
 
+// Returns the property function if \a value was cached for a property of
+// \a meta; this avoids looking the property up by name again.
+static QtPropertyFunction *cachedPropertyFunction(JSC::JSValue value, const QMetaObject *meta)
+{
+    if (!GeneratePropertyFunctions || !value.isObject()
+        || !JSC::asObject(value)->inherits(&QtPropertyFunction::info)) {
+        return 0;
+    }
+    QtPropertyFunction *fun = static_cast<QtPropertyFunction*>(JSC::asObject(value));
+    return (fun->metaObject() == meta) ? fun : 0;
+}
+
 static int indexOfMetaEnum(const QMetaObject *meta, const QByteArray &str)
 {
     QByteArray scope;
@@ -1219,7 +1231,7 @@ bool QObjectDelegate::getOwnPropertySlot(QScriptObject *object, JSC::ExecState *
     {
         QHash<QByteArray, JSC::JSValue>::const_iterator it = data->cachedMembers.constFind(name);
         if (it != data->cachedMembers.constEnd()) {
-            if (GeneratePropertyFunctions && (meta->indexOfProperty(name) != -1))
+            if (cachedPropertyFunction(it.value(), meta))
                 slot.setGetterSlot(JSC::asObject(it.value()));
             else
                 slot.setValue(it.value());
@@ -1337,9 +1349,8 @@ bool QObjectDelegate::getOwnPropertyDescriptor(QScriptObject *object, JSC::ExecS
     {
         QHash<QByteArray, JSC::JSValue>::const_iterator it = data->cachedMembers.constFind(name);
         if (it != data->cachedMembers.constEnd()) {
-            int index;
-            if (GeneratePropertyFunctions && ((index = meta->indexOfProperty(name)) != -1)) {
-                QMetaProperty prop = meta->property(index);
+            if (QtPropertyFunction *fun = cachedPropertyFunction(it.value(), meta)) {
+                QMetaProperty prop = meta->property(fun->propertyIndex());
                 descriptor.setAccessorDescriptor(it.value(), it.value(), flagsForMetaProperty(prop));
                 if (!prop.isWritable())
                     descriptor.setWritable(false);
@@ -1467,6 +1478,22 @@ void QObjectDelegate::put(QScriptObject *object, JSC::ExecState* exec,
     const QScriptEngine::QObjectWrapOptions &opt = data->options;
     const QMetaObject *meta = qobject->metaObject();
     QScriptEnginePrivate *eng = scriptEngineFromExec(exec);
+    JSC::JSValue fun;
+    {
+        // fast path for properties that have been accessed before
+        QHash<QByteArray, JSC::JSValue>::const_iterator it = data->cachedMembers.constFind(name);
+        if ((it != data->cachedMembers.constEnd()) && cachedPropertyFunction(it.value(), meta))
+            fun = it.value();
+    }
+    if (fun) {
+        JSC::CallData callData;
+        JSC::CallType callType = fun.getCallData(callData);
+        JSC::JSValue argv[1] = { value };
+        JSC::ArgList args(argv, 1);
+        (void)JSC::call(exec, fun, callType, callData, object, args);
+        return;
+    }
+
     int index = -1;
     if (name.contains('(')) {
         QByteArray normalized = QMetaObject::normalizedSignature(name);
@@ -1492,7 +1519,6 @@ void QObjectDelegate::put(QScriptObject *object, JSC::ExecState* exec,
                     // ### ideally JSC would do this for us already, i.e. find out
                     // that the property is a setter and call the setter.
                     // Maybe QtPropertyFunction needs to inherit JSC::GetterSetter.
-                    JSC::JSValue fun;
                     QHash<QByteArray, JSC::JSValue>::const_iterator it;
                     it = data->cachedMembers.constFind(name);
                     if (it != data->cachedMembers.constEnd()) {
@@ -1564,7 +1590,7 @@ bool QObjectDelegate::deleteProperty(QScriptObject *object, JSC::ExecState *exec
     {
         QHash<QByteArray, JSC::JSValue>::iterator it = data->cachedMembers.find(name);
         if (it != data->cachedMembers.end()) {
-            if (GeneratePropertyFunctions && (meta->indexOfProperty(name) != -1))
+            if (cachedPropertyFunction(it.value(), meta))
                 return false;
             data->cachedMembers.erase(it);
             return true;
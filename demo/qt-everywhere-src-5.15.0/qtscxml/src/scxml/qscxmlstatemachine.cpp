@@ -852,12 +852,14 @@ bool QScxmlStateMachinePrivate::nameMatch(const StateTable::Array &patterns,
     const QString eventName = event->name();
     bool selected = false;
     for (int eventSelectorIter = 0; eventSelectorIter < patterns.size(); ++eventSelectorIter) {
-        QString eventStr = m_tableData->string(patterns[eventSelectorIter]);
-        if (eventStr == QStringLiteral("*")) {
+        const QString pattern = m_tableData->string(patterns[eventSelectorIter]);
+        if (pattern == QLatin1String("*")) {
             selected = true;
             break;
         }
-        if (eventStr.endsWith(QStringLiteral(".*")))
+        // Use a view, so that chopping the wildcard doesn't detach the pattern string
+        QStringView eventStr(pattern);
+        if (eventStr.endsWith(QLatin1String(".*")))
             eventStr.chop(2);
         if (eventName.startsWith(eventStr)) {
             QChar nextC = QLatin1Char('.');
@@ -902,9 +904,7 @@ void QScxmlStateMachinePrivate::selectTransitions(OrderedSet &enabledTransitions
                 const StateTable::Array transitions = m_stateTable->array(state.transitions);
                 if (!transitions.isValid())
                     continue;
-                std::vector<int> sortedTransitions(transitions.size(), -1);
-                std::copy(transitions.begin(), transitions.end(), sortedTransitions.begin());
-                for (int transitionIndex : sortedTransitions) {
+                for (int transitionIndex : transitions) {
                     const StateTable::Transition &t = m_stateTable->transition(transitionIndex);
                     bool enabled = false;
                     if (event == nullptr) {
@@ -946,6 +946,10 @@ void QScxmlStateMachinePrivate::removeConflictingTransitions(OrderedSet *enabled
 {
     Q_ASSERT(enabledTransitions);
 
+    // A single transition cannot conflict with anything
+    if (enabledTransitions->list().size() < 2)
+        return;
+
     auto sortedTransitions = enabledTransitions->takeList();
     std::sort(sortedTransitions.begin(), sortedTransitions.end(), [this](int t1, int t2) -> bool {
         auto descendantDepth = [this](int state, int ancestor)->int {
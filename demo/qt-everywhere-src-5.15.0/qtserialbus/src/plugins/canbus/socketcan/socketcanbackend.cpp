@@ -51,6 +51,7 @@
 #include <linux/can/raw.h>
 #include <linux/sockios.h>
 #include <errno.h>
+#include <string.h>
 #include <unistd.h>
 #include <net/if.h>
 #include <sys/ioctl.h>
@@ -387,6 +388,12 @@ bool SocketCanBackend::connectSocket()
         return false;
     }
 
+    // Let the kernel pass the receive time stamp along with each frame, so that
+    // readSocket() does not need an additional SIOCGSTAMP ioctl per frame.
+    const int timeStamps = 1;
+    m_timeStampsInControlMessage = setsockopt(canSocket, SOL_SOCKET, SO_TIMESTAMP,
+                                              &timeStamps, sizeof(timeStamps)) == 0;
+
     m_iov.iov_base = &m_frame;
     m_msg.msg_name = &m_address;
     m_msg.msg_iov = &m_iov;
@@ -709,7 +716,17 @@ void SocketCanBackend::readSocket()
         }
 
         struct timeval timeStamp = {};
-        if (Q_UNLIKELY(ioctl(canSocket, SIOCGSTAMP, &timeStamp) < 0)) {
+        bool haveTimeStamp = false;
+        if (m_timeStampsInControlMessage) {
+            for (cmsghdr *cmsg = CMSG_FIRSTHDR(&m_msg); cmsg; cmsg = CMSG_NXTHDR(&m_msg, cmsg)) {
+                if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMP) {
+                    memcpy(&timeStamp, CMSG_DATA(cmsg), sizeof(timeStamp));
+                    haveTimeStamp = true;
+                    break;
+                }
+            }
+        }
+        if (!haveTimeStamp && Q_UNLIKELY(ioctl(canSocket, SIOCGSTAMP, &timeStamp) < 0)) {
             setError(qt_error_string(errno),
                      QCanBusDevice::CanBusError::ReadError);
             timeStamp = {};
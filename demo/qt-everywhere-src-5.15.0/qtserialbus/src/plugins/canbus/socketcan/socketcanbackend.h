@@ -124,6 +124,7 @@ private:
     std::unique_ptr<LibSocketCan> libSocketCan;
     QString canSocketName;
     bool canFdOptionEnabled = false;
+    bool m_timeStampsInControlMessage = false;
 };
 
 QT_END_NAMESPACE
@@ -104,22 +104,29 @@ public:
             responseBuffer += m_socket->read(m_socket->bytesAvailable());
             qCDebug(QT_MODBUS_LOW) << "(TCP client) Response buffer:" << responseBuffer.toHex();
 
-            while (!responseBuffer.isEmpty()) {
+            // With several requests in flight, many responses usually arrive in one read.
+            // Parse all complete ADUs first and drop them from the buffer in one go,
+            // instead of shifting the remaining data after every single response.
+            QVector<QPair<quint16, QModbusResponse>> responses;
+            int offset = 0;
+            while (offset < responseBuffer.size()) {
+                const QByteArray adu = QByteArray::fromRawData(responseBuffer.constData() + offset,
+                                                               responseBuffer.size() - offset);
                 // can we read enough for Modbus ADU header?
-                if (responseBuffer.size() < mbpaHeaderSize) {
+                if (adu.size() < mbpaHeaderSize) {
                     qCDebug(QT_MODBUS_LOW) << "(TCP client) Modbus ADU not complete";
-                    return;
+                    break;
                 }
 
                 quint8 serverAddress;
                 quint16 transactionId, bytesPdu, protocolId;
-                QDataStream input(responseBuffer);
+                QDataStream input(adu);
                 input >> transactionId >> protocolId >> bytesPdu >> serverAddress;
 
                 // stop the timer as soon as we know enough about the transaction
-                const bool knownTransaction = m_transactionStore.contains(transactionId);
-                if (knownTransaction && m_transactionStore[transactionId].timer)
-                    m_transactionStore[transactionId].timer->stop();
+                const auto it = m_transactionStore.constFind(transactionId);
+                if (it != m_transactionStore.cend() && it->timer)
+                    it->timer->stop();
 
                 qCDebug(QT_MODBUS) << "(TCP client) tid:" << Qt::hex << transactionId << "size:"
                     << bytesPdu << "server address:" << serverAddress;
@@ -129,9 +136,9 @@ public:
                 bytesPdu--;
 
                 int tcpAduSize = mbpaHeaderSize + bytesPdu;
-                if (responseBuffer.size() < tcpAduSize) {
+                if (adu.size() < tcpAduSize) {
                     qCDebug(QT_MODBUS) << "(TCP client) PDU too short. Waiting for more data";
-                    return;
+                    break;
                 }
 
                 QModbusResponse responsePdu;
@@ -139,13 +146,19 @@ public:
                 qCDebug(QT_MODBUS) << "(TCP client) Received PDU:" << responsePdu.functionCode()
                                    << responsePdu.data().toHex();
 
-                responseBuffer.remove(0, tcpAduSize);
+                offset += tcpAduSize;
+                responses.append(qMakePair(transactionId, responsePdu));
+            }
+            responseBuffer.remove(0, offset);
 
-                if (!knownTransaction) {
+            for (const auto &response : qAsConst(responses)) {
+                // look the transaction up again, handling an earlier response may have removed it
+                const auto it = m_transactionStore.constFind(response.first);
+                if (it == m_transactionStore.cend()) {
                     qCDebug(QT_MODBUS) << "(TCP client) No pending request for response with "
                         "given transaction ID, ignoring response message.";
                 } else {
-                    processQueueElement(responsePdu, m_transactionStore[transactionId]);
+                    processQueueElement(response.second, *it);
                 }
             }
         });
@@ -94,6 +94,9 @@ QSvgIconEngine::QSvgIconEngine()
 QSvgIconEngine::QSvgIconEngine(const QSvgIconEngine &other)
     : QIconEngine(other), d(new QSvgIconEnginePrivate)
 {
+    // The copy renders the same pixmaps, so let it share the other engine's
+    // QPixmapCache entries. Any later modification steps the serial number.
+    d->serialNum = other.d->serialNum;
     d->svgFiles = other.d->svgFiles;
     if (other.d->svgBuffers)
         d->svgBuffers = new QHash<int, QByteArray>(*other.d->svgBuffers);
@@ -10,7 +10,8 @@ SOURCES += \
     main.cpp \
     mainwindow.cpp \
     distancefieldmodel.cpp \
-    distancefieldmodelworker.cpp
+    distancefieldmodelworker.cpp \
+    distancefieldwriter.cpp
 
 DEFINES += QT_NO_CAST_FROM_ASCII QT_NO_CAST_TO_ASCII
 DEFINES += QT_NO_FOREACH
@@ -21,7 +22,8 @@ FORMS += \
 HEADERS += \
     mainwindow.h \
     distancefieldmodel.h \
-    distancefieldmodelworker.h
+    distancefieldmodelworker.h \
+    distancefieldwriter.h
 
 QMAKE_DOCS = $$PWD/doc/qtdistancefieldgenerator.qdocconf
 
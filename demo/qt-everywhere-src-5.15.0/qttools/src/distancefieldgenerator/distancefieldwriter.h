@@ -0,0 +1,56 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the tools applications of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef DISTANCEFIELDWRITER_H
+#define DISTANCEFIELDWRITER_H
+
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qstring.h>
+#include <QtGui/private/qtextengine_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class DistanceFieldModel;
+class DistanceFieldWriter
+{
+    Q_DECLARE_TR_FUNCTIONS(DistanceFieldWriter)
+public:
+    static QByteArray createSfntTable(const DistanceFieldModel *model,
+                                      const QList<glyph_t> &glyphs,
+                                      quint32 maximumTextureSize,
+                                      QString *errorString);
+    static QByteArray insertSfntTable(const QString &fontFile,
+                                      const QByteArray &qtdf,
+                                      QString *errorString);
+};
+
+QT_END_NAMESPACE
+
+#endif // DISTANCEFIELDWRITER_H
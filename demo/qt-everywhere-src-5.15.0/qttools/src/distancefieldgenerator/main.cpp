@@ -27,19 +27,180 @@
 ****************************************************************************/
 
 #include "mainwindow.h"
+#include "distancefieldmodel.h"
+#include "distancefieldwriter.h"
 
 #include <QApplication>
 #include <QCommandLineParser>
+#include <QFile>
+#include <QSet>
+
+#include <algorithm>
 
 QT_USE_NAMESPACE
 
+static bool isBatchMode(int argc, char **argv)
+{
+    for (int i = 1; i < argc; ++i) {
+        if (qstrcmp(argv[i], "-o") == 0
+                || qstrcmp(argv[i], "--output") == 0
+                || qstrncmp(argv[i], "--output=", 9) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Parses a comma-separated list of hexadecimal code points and code point
+// ranges, for instance "20-7e,U+4E00-U+9FFF,20ac"
+static bool parseUnicodeRanges(const QString &specification,
+                               QVector<QPair<quint32, quint32>> *ranges)
+{
+    const QStringList parts = specification.split(QLatin1Char(','), Qt::SkipEmptyParts);
+    for (const QString &part : parts) {
+        QStringList bounds = part.trimmed().split(QLatin1Char('-'));
+        if (bounds.size() > 2)
+            return false;
+
+        quint32 values[2];
+        for (int i = 0; i < bounds.size(); ++i) {
+            QString bound = bounds.at(i).trimmed();
+            if (bound.startsWith(QLatin1String("U+"), Qt::CaseInsensitive))
+                bound = bound.mid(2);
+            bool ok;
+            values[i] = bound.toUInt(&ok, 16);
+            if (!ok)
+                return false;
+        }
+        if (bounds.size() == 1)
+            values[1] = values[0];
+        if (values[1] < values[0])
+            return false;
+
+        ranges->append(qMakePair(values[0], values[1]));
+    }
+    return true;
+}
+
+static int generateFont(QGuiApplication &app, const QCommandLineParser &parser,
+                        const QCommandLineOption &outputOption,
+                        const QCommandLineOption &unicodeRangesOption,
+                        const QCommandLineOption &charactersOption,
+                        const QCommandLineOption &textureSizeOption)
+{
+    if (parser.positionalArguments().size() != 1) {
+        qWarning("Exactly one font file must be given when generating with --output.");
+        return 1;
+    }
+
+    const QString fontFile = parser.positionalArguments().constFirst();
+    const QString outputFile = parser.value(outputOption);
+
+    bool ok;
+    const quint32 textureSize = parser.value(textureSizeOption).toUInt(&ok);
+    if (!ok || textureSize < 64) {
+        qWarning("Invalid texture size '%s'.", qPrintable(parser.value(textureSizeOption)));
+        return 1;
+    }
+
+    QVector<QPair<quint32, quint32>> ranges;
+    if (parser.isSet(unicodeRangesOption)
+            && !parseUnicodeRanges(parser.value(unicodeRangesOption), &ranges)) {
+        qWarning("Invalid Unicode ranges '%s'.", qPrintable(parser.value(unicodeRangesOption)));
+        return 1;
+    }
+
+    QVector<uint> characters;
+    if (parser.isSet(charactersOption)) {
+        QFile file(parser.value(charactersOption));
+        if (!file.open(QIODevice::ReadOnly)) {
+            qWarning("Cannot open '%s' for reading.", qPrintable(file.fileName()));
+            return 1;
+        }
+        characters = QString::fromUtf8(file.readAll()).toUcs4();
+    }
+
+    qRegisterMetaType<glyph_t>("glyph_t");
+    qRegisterMetaType<QPainterPath>("QPainterPath");
+
+    DistanceFieldModel model;
+    QObject::connect(&model, &DistanceFieldModel::error, [](const QString &errorString) {
+        qWarning("%s", qPrintable(errorString));
+    });
+    QObject::connect(&model, &DistanceFieldModel::stopGeneration, &app, [&]() {
+        QList<glyph_t> glyphs;
+        if (ranges.isEmpty() && characters.isEmpty()) {
+            for (int i = 0; i < model.rowCount(); ++i)
+                glyphs.append(glyph_t(i));
+        } else {
+            QSet<glyph_t> selectedGlyphs;
+            for (const QPair<quint32, quint32> &range : qAsConst(ranges)) {
+                for (quint32 ucs4 = range.first; ucs4 <= range.second; ++ucs4) {
+                    glyph_t glyph = model.glyphIndexForUcs4(ucs4);
+                    if (glyph != 0)
+                        selectedGlyphs.insert(glyph);
+                    if (ucs4 == range.second) // avoid wrapping at 0xffffffff
+                        break;
+                }
+            }
+            for (uint ucs4 : qAsConst(characters)) {
+                glyph_t glyph = model.glyphIndexForUcs4(ucs4);
+                if (glyph != 0)
+                    selectedGlyphs.insert(glyph);
+            }
+            glyphs = selectedGlyphs.values();
+            std::sort(glyphs.begin(), glyphs.end());
+        }
+
+        if (glyphs.isEmpty()) {
+            qWarning("No glyphs in '%s' match the selection.", qPrintable(fontFile));
+            app.exit(1);
+            return;
+        }
+
+        QString errorString;
+        QByteArray qtdf = DistanceFieldWriter::createSfntTable(&model, glyphs, textureSize, &errorString);
+        QByteArray output;
+        if (!qtdf.isEmpty())
+            output = DistanceFieldWriter::insertSfntTable(fontFile, qtdf, &errorString);
+        if (output.isEmpty()) {
+            qWarning("%s", qPrintable(errorString));
+            app.exit(1);
+            return;
+        }
+
+        QFile outFile(outputFile);
+        if (!outFile.open(QIODevice::WriteOnly) || outFile.write(output) != output.size()) {
+            qWarning("Cannot write to '%s'.", qPrintable(outputFile));
+            app.exit(1);
+            return;
+        }
+
+        app.exit(0);
+    });
+
+    model.setFont(fontFile);
+    return app.exec();
+}
+
 int main(int argc, char **argv)
 {
-    QApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
-    QApplication app(argc, argv);
-    app.setOrganizationName(QStringLiteral("QtProject"));
-    app.setApplicationName(QStringLiteral("Qt Distance Field Generator"));
-    app.setApplicationVersion(QStringLiteral(QT_VERSION_STR));
+    const bool batchMode = isBatchMode(argc, argv);
+
+    QScopedPointer<QGuiApplication> app;
+    if (batchMode) {
+        // Nothing is shown when generating from the command line, typically
+        // as part of a build, so do not require a display for that.
+        if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+            qputenv("QT_QPA_PLATFORM", "minimal");
+        app.reset(new QGuiApplication(argc, argv));
+    } else {
+        QApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
+        app.reset(new QApplication(argc, argv));
+    }
+    app->setOrganizationName(QStringLiteral("QtProject"));
+    app->setApplicationName(QStringLiteral("Qt Distance Field Generator"));
+    app->setApplicationVersion(QStringLiteral(QT_VERSION_STR));
 
     QCommandLineParser parser;
     parser.setApplicationDescription(
@@ -50,12 +211,43 @@ int main(int argc, char **argv)
     parser.addPositionalArgument(QLatin1String("file"),
                                  QCoreApplication::translate("main",
                                                              "Font file (*.ttf, *.otf)"));
-    parser.process(app);
+
+    QCommandLineOption outputOption(QStringList() << QStringLiteral("o") << QStringLiteral("output"),
+                                    QCoreApplication::translate("main",
+                                                                "Generate the distance fields without showing the user interface and write the font, with the cache embedded, to <file>."),
+                                    QStringLiteral("file"));
+    parser.addOption(outputOption);
+
+    QCommandLineOption unicodeRangesOption(QStringLiteral("unicode-ranges"),
+                                           QCoreApplication::translate("main",
+                                                                       "Comma-separated list of hexadecimal code points or code point ranges, such as 20-7e,4e00-9fff, to include. By default all glyphs in the font are included."),
+                                           QStringLiteral("ranges"));
+    parser.addOption(unicodeRangesOption);
+
+    QCommandLineOption charactersOption(QStringLiteral("characters"),
+                                        QCoreApplication::translate("main",
+                                                                    "Include the glyphs for all characters in the UTF-8 encoded <file>, such as the translated strings of an application."),
+                                        QStringLiteral("file"));
+    parser.addOption(charactersOption);
+
+    QCommandLineOption textureSizeOption(QStringLiteral("texture-size"),
+                                         QCoreApplication::translate("main",
+                                                                     "Maximum size of the cache textures. The default is 2048."),
+                                         QStringLiteral("size"),
+                                         QStringLiteral("2048"));
+    parser.addOption(textureSizeOption);
+
+    parser.process(*app);
+
+    if (batchMode) {
+        return generateFont(*app, parser, outputOption, unicodeRangesOption,
+                            charactersOption, textureSizeOption);
+    }
 
     MainWindow mainWindow;
     if (!parser.positionalArguments().isEmpty())
         mainWindow.open(parser.positionalArguments().constFirst());
     mainWindow.show();
 
-    return app.exec();
+    return app->exec();
 }
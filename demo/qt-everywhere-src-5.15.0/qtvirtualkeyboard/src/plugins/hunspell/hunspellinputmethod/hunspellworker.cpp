@@ -420,6 +420,13 @@ void HunspellBuildSuggestionsTask::run()
 
     char **slst = nullptr;
     int n = Hunspell_suggest(hunspell, &slst, textCodec->fromUnicode(word).constData());
+    /*  The suggestions are obsolete if a new key press arrived while
+        Hunspell was busy; the follow-up tasks have been dropped too.
+     */
+    if (isCancelled()) {
+        Hunspell_free_list(hunspell, &slst, n);
+        return;
+    }
     if (n > 0) {
         /*  Collect word candidates from the Hunspell suggestions.
             Insert word completions in the beginning of the list.
@@ -482,7 +489,7 @@ void HunspellBuildSuggestionsTask::run()
     }
     Hunspell_free_list(hunspell, &slst, n);
 
-    for (int i = 0, count = wordList->size(); i < count; ++i) {
+    for (int i = 0, count = wordList->size(); i < count && !isCancelled(); ++i) {
         HunspellWordList::Flags flags;
         wordList->wordAt(i, word, flags);
         if (flags.testFlag(HunspellWordList::CompoundWord))
@@ -496,7 +503,8 @@ bool HunspellBuildSuggestionsTask::spellCheck(const QString &word)
 {
     if (!hunspell)
         return false;
-    if (word.contains(QRegularExpression(QLatin1String("[0-9]"))))
+    static const QRegularExpression digits(QLatin1String("[0-9]"));
+    if (word.contains(digits))
         return true;
     return Hunspell_spell(hunspell, textCodec->fromUnicode(word).constData()) != 0;
 }
@@ -745,9 +753,9 @@ void HunspellWorker::run()
         if (abort)
             break;
         idleSema.acquire();
-        QSharedPointer<HunspellTask> currentTask;
         {
             QMutexLocker guard(&taskLock);
+            currentTask.reset();
             if (!taskList.isEmpty()) {
                 currentTask = taskList.front();
                 taskList.pop_front();
@@ -766,6 +774,10 @@ void HunspellWorker::run()
             qCDebug(lcHunspell) << QString(QLatin1String(currentTask->metaObject()->className()) + QLatin1String("::run(): time:")).toLatin1().constData() << perf.elapsed() << "ms";
         }
     }
+    {
+        QMutexLocker guard(&taskLock);
+        currentTask.reset();
+    }
     if (hunspell) {
         Hunspell_destroy(hunspell);
         hunspell = nullptr;
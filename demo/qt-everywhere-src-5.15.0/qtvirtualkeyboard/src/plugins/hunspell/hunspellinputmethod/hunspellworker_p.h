@@ -122,11 +122,19 @@ public:
     explicit HunspellTask(QObject *parent = nullptr) :
         QObject(parent),
         hunspell(nullptr)
-    {}
+    {
+        cancelled = false;
+    }
 
     virtual void run() = 0;
 
+    void cancel() { cancelled = true; }
+    bool isCancelled() const { return cancelled.loadRelaxed(); }
+
     Hunhandle *hunspell;
+
+private:
+    QBasicAtomicInt cancelled;
 };
 
 class HunspellLoadDictionaryTask : public HunspellTask
@@ -259,6 +267,10 @@ public:
     template <class X>
     void removeAllTasksOfType() {
         QMutexLocker guard(&taskLock);
+        if (currentTask && currentTask.objectCast<X>()) {
+            qCDebug(lcHunspell) << "Cancel task" << QLatin1String(currentTask->metaObject()->className());
+            currentTask->cancel();
+        }
         for (int i = 0; i < taskList.size();) {
             QSharedPointer<X> task(taskList[i].objectCast<X>());
             if (task) {
@@ -279,6 +291,7 @@ private:
 private:
     friend class HunspellLoadDictionaryTask;
     QList<QSharedPointer<HunspellTask> > taskList;
+    QSharedPointer<HunspellTask> currentTask;
     QSemaphore idleSema;
     QSemaphore taskSema;
     QMutex taskLock;
@@ -109,6 +109,7 @@ QWaylandShmBuffer::QWaylandShmBuffer(QWaylandDisplay *display,
     wl_shm_format wl_format = shm->formatFrom(format);
     mImage = QImage(data, size.width(), size.height(), stride, format);
     mImage.setDevicePixelRatio(qreal(scale));
+    mDirtyRegion = QRect(QPoint(0, 0), size);
 
     mShmPool = wl_shm_create_pool(shm->object(), fd, alloc);
     init(wl_shm_pool_create_buffer(mShmPool,0, size.width(), size.height(),
@@ -152,6 +153,38 @@ QImage *QWaylandShmBuffer::imageInsideMargins(const QMargins &marginsIn)
 
 }
 
+static QRegion toBufferRegion(const QRegion &region, const QMargins &margins, int scale)
+{
+    QVector<QRect> rects;
+    rects.reserve(region.rectCount());
+    for (const QRect &rect : region.translated(margins.left(), margins.top()))
+        rects.append(QRect(rect.topLeft() * scale, rect.size() * scale));
+    QRegion result;
+    result.setRects(rects.constData(), rects.size());
+    return result;
+}
+
+static void copyBufferRegion(const QImage *source, QImage *target, const QRegion &region)
+{
+    const int bytesPerLine = source->bytesPerLine();
+    const int bytesPerPixel = source->depth() / 8;
+    const uchar *sourceBits = source->constBits();
+    uchar *targetBits = target->bits();
+    for (const QRect &dirtyRect : region) {
+        const QRect rect = dirtyRect & source->rect();
+        if (rect.isEmpty())
+            continue;
+        const qsizetype offset = qsizetype(rect.y()) * bytesPerLine + rect.x() * bytesPerPixel;
+        const size_t length = size_t(rect.width()) * bytesPerPixel;
+        if (rect.width() == source->width()) {
+            memcpy(targetBits + offset, sourceBits + offset, qsizetype(rect.height()) * bytesPerLine);
+            continue;
+        }
+        for (int y = 0; y < rect.height(); ++y)
+            memcpy(targetBits + offset + y * bytesPerLine, sourceBits + offset + y * bytesPerLine, length);
+    }
+}
+
 QWaylandShmBackingStore::QWaylandShmBackingStore(QWindow *window, QWaylandDisplay *display)
     : QPlatformBackingStore(window)
     , mDisplay(display)
@@ -182,6 +215,14 @@ void QWaylandShmBackingStore::beginPaint(const QRegion &region)
 
     waylandWindow()->setCanResize(false);
 
+    // The other buffers miss what is painted now; remember it so that only this part
+    // needs to be copied over when one of them becomes the back buffer again.
+    const QRegion bufferRegion = toBufferRegion(region, windowDecorationMargins(), waylandWindow()->scale());
+    for (QWaylandShmBuffer *b : mBuffers) {
+        if (b != mBackBuffer)
+            b->dirtyRegion() += bufferRegion;
+    }
+
     if (mBackBuffer->image()->hasAlphaChannel()) {
         QPainter p(paintDevice());
         p.setCompositionMode(QPainter::CompositionMode_Source);
@@ -228,8 +269,13 @@ void QWaylandShmBackingStore::flush(QWindow *window, const QRegion &region, cons
     mPendingFlush = false;
     mPendingRegion = QRegion();
 
-    if (windowDecoration() && windowDecoration()->isDirty())
+    if (windowDecoration() && windowDecoration()->isDirty()) {
         updateDecorations();
+        for (QWaylandShmBuffer *b : mBuffers) {
+            if (b != mBackBuffer)
+                b->dirtyRegion() += QRect(QPoint(0, 0), b->size());
+        }
+    }
 
     mFrontBuffer = mBackBuffer;
 
@@ -275,8 +321,9 @@ void QWaylandShmBackingStore::resize(const QSize &size)
     QSize sizeWithMargins = (size + QSize(margins.left()+margins.right(),margins.top()+margins.bottom())) * scale;
 
     // We look for a free buffer to draw into. If the buffer is not the last buffer we used,
-    // that is mBackBuffer, and the size is the same we memcpy the old content into the new
-    // buffer so that QPainter is happy to find the stuff it had drawn before. If the new
+    // that is mBackBuffer, and the size is the same we copy the old content into the new
+    // buffer so that QPainter is happy to find the stuff it had drawn before. Only the parts
+    // painted since the buffer was last used are copied, see dirtyRegion(). If the new
     // buffer has a different size it needs to be redrawn completely anyway, and if the buffer
     // is the same the stuff is there already.
     // You can exercise the different codepaths with weston, switching between the gl and the
@@ -294,8 +341,9 @@ void QWaylandShmBackingStore::resize(const QSize &size)
     qsizetype newSizeInBytes = buffer->image()->sizeInBytes();
 
     // mBackBuffer may have been deleted here but if so it means its size was different so we wouldn't copy it anyway
-    if (mBackBuffer != buffer && oldSizeInBytes == newSizeInBytes)
-        memcpy(buffer->image()->bits(), mBackBuffer->image()->constBits(), newSizeInBytes);
+    if (mBackBuffer && mBackBuffer != buffer && mBackBuffer->size() == buffer->size())
+        copyBufferRegion(mBackBuffer->image(), buffer->image(), buffer->dirtyRegion());
+    buffer->dirtyRegion() = QRegion();
 
     mBackBuffer = buffer;
 
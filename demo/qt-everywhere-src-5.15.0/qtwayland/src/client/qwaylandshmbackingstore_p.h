@@ -78,11 +78,15 @@ public:
     QImage *image() { return &mImage; }
 
     QImage *imageInsideMargins(const QMargins &margins);
+
+    // Area, in device pixels, painted into other buffers since this one was the back buffer
+    QRegion &dirtyRegion() { return mDirtyRegion; }
 private:
     QImage mImage;
     struct wl_shm_pool *mShmPool = nullptr;
     QMargins mMargins;
     QImage *mMarginsImage = nullptr;
+    QRegion mDirtyRegion;
 };
 
 class Q_WAYLAND_CLIENT_EXPORT QWaylandShmBackingStore : public QPlatformBackingStore
@@ -81,7 +81,7 @@ static const struct {
         ":/qt-project.org/wayland/compositor/shaders/surface.vert",
         ":/qt-project.org/wayland/compositor/shaders/surface_rgbx.frag",
         GL_TEXTURE_2D, 1, true,
-        QSGMaterial::Blending,
+        {},
         {}
     },
 
@@ -108,7 +108,7 @@ static const struct {
         ":/qt-project.org/wayland/compositor/shaders/surface.vert",
         ":/qt-project.org/wayland/compositor/shaders/surface_y_u_v.frag",
         GL_TEXTURE_2D, 3, false,
-        QSGMaterial::Blending,
+        {},
         {}
     },
 
@@ -117,7 +117,7 @@ static const struct {
         ":/qt-project.org/wayland/compositor/shaders/surface.vert",
         ":/qt-project.org/wayland/compositor/shaders/surface_y_uv.frag",
         GL_TEXTURE_2D, 2, false,
-        QSGMaterial::Blending,
+        {},
         {}
     },
 
@@ -126,7 +126,7 @@ static const struct {
         ":/qt-project.org/wayland/compositor/shaders/surface.vert",
         ":/qt-project.org/wayland/compositor/shaders/surface_y_xuxv.frag",
         GL_TEXTURE_2D, 2, false,
-        QSGMaterial::Blending,
+        {},
         {}
     }
 };
@@ -284,7 +284,9 @@ public:
 #if QT_CONFIG(opengl)
                 QQuickWindow::CreateTextureOptions opt;
                 QWaylandQuickSurface *surface = qobject_cast<QWaylandQuickSurface *>(surfaceItem->surface());
-                if (surface && surface->useTextureAlpha()) {
+                // RGB buffers are opaque, let the scene graph render them in the opaque pass
+                if (surface && surface->useTextureAlpha()
+                        && buffer.bufferFormatEgl() != QWaylandBufferRef::BufferFormatEgl_RGB) {
                     opt |= QQuickWindow::TextureHasAlphaChannel;
                 }
 
@@ -379,6 +379,7 @@ void QMetaObjectPublisher::sendPendingPropertyUpdates()
         const QMetaObject *const metaObject = object->metaObject();
         const QString objectId = registeredObjectIds.value(object);
         const SignalToPropertyNameMap &objectsSignalToPropertyMap = signalToPropertyMap.value(object);
+        PropertyValueMap &sentValues = sentPropertyValues[object];
         // maps property name to current property value
         QJsonObject properties;
         // maps signal index to list of arguments of the last emit
@@ -389,7 +390,16 @@ void QMetaObjectPublisher::sendPendingPropertyUpdates()
             foreach (const int propertyIndex, objectsSignalToPropertyMap.value(sigIt.key())) {
                 const QMetaProperty &property = metaObject->property(propertyIndex);
                 Q_ASSERT(property.isValid());
-                properties[QString::number(propertyIndex)] = wrapResult(property.read(object), Q_NULLPTR, objectId);
+                const QJsonValue value = wrapResult(property.read(object), Q_NULLPTR, objectId);
+                // the clients still have the last sent value cached, only send actual changes
+                PropertyValueMap::iterator sent = sentValues.find(propertyIndex);
+                if (sent != sentValues.end() && *sent == value)
+                    continue;
+                if (sent != sentValues.end())
+                    *sent = value;
+                else
+                    sentValues.insert(propertyIndex, value);
+                properties[QString::number(propertyIndex)] = value;
             }
             sigs[QString::number(sigIt.key())] = QJsonArray::fromVariantList(sigIt.value());
         }
@@ -532,6 +542,12 @@ QVariant QMetaObjectPublisher::invokeMethod(QObject *const object, const QByteAr
 
 void QMetaObjectPublisher::setProperty(QObject *object, const int propertyIndex, const QJsonValue &value)
 {
+    // The client has already put the new value into its property cache. Forget what was
+    // sent last, so that the value the property really ends up with is sent back.
+    const auto sent = sentPropertyValues.find(object);
+    if (sent != sentPropertyValues.end())
+        sent->remove(propertyIndex);
+
     QMetaProperty property = object->metaObject()->property(propertyIndex);
     if (!property.isValid()) {
         qWarning() << "Cannot set unknown property" << propertyIndex << "of object" << object;
@@ -594,6 +610,7 @@ void QMetaObjectPublisher::objectDestroyed(const QObject *object)
         signalToPropertyMap.remove(object);
     }
     pendingPropertyUpdates.remove(object);
+    sentPropertyValues.remove(object);
 }
 
 QObject *QMetaObjectPublisher::unwrapObject(const QString &objectId) const
@@ -317,6 +317,11 @@ private:
     typedef QHash<const QObject *, SignalToArgumentsMap> PendingPropertyUpdates;
     PendingPropertyUpdates pendingPropertyUpdates;
 
+    // Property values last broadcast in a property update, per object and property index.
+    // Values that did not change since are left out of the next update.
+    typedef QHash<int, QJsonValue> PropertyValueMap;
+    QHash<const QObject *, PropertyValueMap> sentPropertyValues;
+
     // Aggregate property updates since we get multiple Qt.idle message when we have multiple
     // clients. They all share the same QWebProcess though so we must take special care to
     // prevent message flooding.
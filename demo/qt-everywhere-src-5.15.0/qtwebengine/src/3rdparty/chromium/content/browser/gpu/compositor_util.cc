@@ -402,17 +402,24 @@ int NumberOfRendererRasterThreads() {
   const base::CommandLine& command_line =
       *base::CommandLine::ForCurrentProcess();
 
+  // The heuristic is capped at kMaxRasterThreads, but an explicit request
+  // may use up to one raster thread per processor, e.g. for software
+  // raster on many-core devices.
+  int max_raster_threads = kMaxRasterThreads;
   if (command_line.HasSwitch(switches::kNumRasterThreads)) {
     std::string string_value = command_line.GetSwitchValueASCII(
         switches::kNumRasterThreads);
-    if (!base::StringToInt(string_value, &num_raster_threads)) {
+    if (base::StringToInt(string_value, &num_raster_threads)) {
+      max_raster_threads = std::max(kMaxRasterThreads,
+                                    base::SysInfo::NumberOfProcessors());
+    } else {
       DLOG(WARNING) << "Failed to parse switch " <<
           switches::kNumRasterThreads  << ": " << string_value;
     }
   }
 
   return base::ClampToRange(num_raster_threads, kMinRasterThreads,
-                            kMaxRasterThreads);
+                            max_raster_threads);
 }
 
 bool IsZeroCopyUploadEnabled() {
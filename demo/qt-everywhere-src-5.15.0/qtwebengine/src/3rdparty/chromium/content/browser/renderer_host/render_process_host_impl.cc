@@ -2937,12 +2937,21 @@ void RenderProcessHostImpl::DiscardSpareRenderProcessHostForTesting() {
 
 // static
 bool RenderProcessHostImpl::IsSpareProcessKeptAtAllTimes() {
-  if (!SiteIsolationPolicy::UseDedicatedProcessesForAllSites())
-    return false;
-
   if (!base::FeatureList::IsEnabled(features::kSpareRendererForSitePerProcess))
     return false;
 
+  // Without site-per-process a spare renderer is only kept when the embedder
+  // explicitly asks for it, e.g. to hide renderer startup from navigations.
+  if (!SiteIsolationPolicy::UseDedicatedProcessesForAllSites()) {
+    base::FeatureList* feature_list = base::FeatureList::GetInstance();
+    if (!feature_list ||
+        !feature_list->IsFeatureOverriddenFromCommandLine(
+            features::kSpareRendererForSitePerProcess.name,
+            base::FeatureList::OVERRIDE_ENABLE_FEATURE)) {
+      return false;
+    }
+  }
+
   // Spare renderer actually hurts performance on low-memory devices.  See
   // https://crbug.com/843775 for more details.
   //